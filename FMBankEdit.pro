@@ -124,15 +124,20 @@ SOURCES += \
     src/FileFormats/format_smaf_importer.cpp \
     src/audio.cpp \
     src/bank.cpp \
+    src/bank_packed.cpp \
     src/bank_editor.cpp \
     src/operator_editor.cpp \
     src/bank_comparison.cpp \
+    src/bank_transform.cpp \
+    src/bank_transform_dialog.cpp \
     src/common.cpp \
     src/controlls.cpp \
     src/proxystyle.cpp \
     src/FileFormats/ffmt_base.cpp \
     src/FileFormats/ffmt_enums.cpp \
+    src/FileFormats/ffmt_archive.cpp \
     src/FileFormats/ffmt_factory.cpp \
+    src/FileFormats/ffmt_library.cpp \
     src/FileFormats/format_adlib_bnk.cpp \
     src/FileFormats/format_adlib_tim.cpp \
     src/FileFormats/format_adlibgold_bnk2.cpp \
@@ -156,15 +161,19 @@ SOURCES += \
     src/FileFormats/ymf262_to_wopi.cpp \
     src/formats_sup.cpp \
     src/importer.cpp \
+    src/instruments_model.cpp \
     src/audio_config.cpp \
     src/hardware.cpp \
     src/ins_names.cpp \
     src/main.cpp \
     src/opl/generator.cpp \
     src/opl/generator_realtime.cpp \
+    src/opl/mixer.cpp \
+    src/opl/multichip_engine.cpp \
     src/opl/realtime/ring_buffer.cpp \
     src/piano.cpp \
     src/opl/measurer.cpp \
+    src/opl/register_log.cpp \
     src/FileFormats/wopl/wopl_file.c
 
 HEADERS += \
@@ -172,12 +181,17 @@ HEADERS += \
     src/bank_editor.h \
     src/operator_editor.h \
     src/bank_comparison.h \
+    src/bank_transform.h \
+    src/bank_transform_dialog.h \
     src/bank.h \
+    src/bank_packed.h \
     src/common.h \
     src/proxystyle.h \
     src/FileFormats/ffmt_base.h \
     src/FileFormats/ffmt_enums.h \
+    src/FileFormats/ffmt_archive.h \
     src/FileFormats/ffmt_factory.h \
+    src/FileFormats/ffmt_library.h \
     src/FileFormats/format_adlib_bnk.h \
     src/FileFormats/format_adlib_tim.h \
     src/FileFormats/format_adlibgold_bnk2.h \
@@ -201,25 +215,32 @@ HEADERS += \
     src/FileFormats/ymf262_to_wopi.h \
     src/formats_sup.h \
     src/importer.h \
+    src/instruments_model.h \
     src/audio_config.h \
     src/hardware.h \
     src/ins_names.h \
     src/ins_names_data.h \
+    src/ins_names_index.h \
     src/main.h \
     src/opl/generator.h \
     src/opl/generator_realtime.h \
+    src/opl/mixer.h \
+    src/opl/multichip_engine.h \
+    src/opl/shadow_registers.h \
     src/opl/nukedopl3.h \
     src/opl/realtime/ring_buffer.h \
     src/opl/realtime/ring_buffer.tcc \
     src/piano.h \
     src/version.h \
     src/opl/measurer.h \
+    src/opl/register_log.h \
     src/FileFormats/wopl/wopl_file.h
 
 FORMS += \
     src/bank_editor.ui \
     src/operator_editor.ui \
     src/bank_comparison.ui \
+    src/bank_transform_dialog.ui \
     src/formats_sup.ui \
     src/importer.ui \
     src/audio_config.ui \
@@ -0,0 +1,517 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ffmt_archive.h"
+#include "../common.h"
+#include <QBuffer>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <zlib.h>
+#include <cstring>
+
+static const uint32_t zip_local_header = 0x04034b50;
+static const uint32_t zip_central_header = 0x02014b50;
+static const uint32_t zip_end_of_directory = 0x06054b50;
+static const uint32_t zip64_end_of_directory = 0x06064b50;
+static const uint32_t zip64_locator = 0x07064b50;
+
+static const uint16_t zip_method_store = 0;
+static const uint16_t zip_method_deflate = 8;
+static const uint16_t zip_flag_encrypted = 0x0001;
+static const uint16_t zip_flag_utf8 = 0x0800;
+
+static const int zip_local_header_size = 30;
+static const int zip_central_header_size = 46;
+static const int zip_end_size = 22;
+static const int zip64_end_size = 56;
+static const int zip64_locator_size = 20;
+
+static uint64_t toUint64LE(const uint8_t *arr)
+{
+    return uint64_t(toUint32LE(arr)) | (uint64_t(toUint32LE(arr + 4)) << 32);
+}
+
+static qint64 dosTimeToMSecs(uint16_t time, uint16_t date)
+{
+    QDate d(1980 + (date >> 9), (date >> 5) & 0x0F, date & 0x1F);
+    QTime t((time >> 11) & 0x1F, (time >> 5) & 0x3F, (time & 0x1F) * 2);
+    if(!d.isValid() || !t.isValid())
+        return 0;
+    return QDateTime(d, t).toMSecsSinceEpoch();
+}
+
+FmBankArchive::FmBankArchive()
+{}
+
+FmBankArchive::~FmBankArchive()
+{
+    close();
+}
+
+FfmtErrCode FmBankArchive::open(const QString &filePath)
+{
+    close();
+    m_file.setFileName(filePath);
+    if(!m_file.open(QIODevice::ReadOnly))
+        return FfmtErrCode::ERR_NOFILE;
+    FfmtErrCode err = open(&m_file);
+    if(err != FfmtErrCode::ERR_OK)
+        m_file.close();
+    return err;
+}
+
+FfmtErrCode FmBankArchive::open(QIODevice *device)
+{
+    if(device != &m_file)
+        close();
+    m_device = device;
+    if(!readDirectory())
+    {
+        m_device = nullptr;
+        m_entries.clear();
+        return FfmtErrCode::ERR_BADFORMAT;
+    }
+    return FfmtErrCode::ERR_OK;
+}
+
+void FmBankArchive::close()
+{
+    m_device = nullptr;
+    m_entries.clear();
+    if(m_file.isOpen())
+        m_file.close();
+}
+
+bool FmBankArchive::readDirectory()
+{
+    const qint64 fileSize = m_device->size();
+    if(m_device->isSequential() || fileSize < zip_end_size)
+        return false;
+
+    // The end record is followed by the comment of up to 65535 bytes
+    const qint64 tailSize = qMin<qint64>(fileSize, zip_end_size + 0xFFFF);
+    const qint64 tailPos = fileSize - tailSize;
+    if(!m_device->seek(tailPos))
+        return false;
+    QByteArray tail = m_device->read(tailSize);
+    if(tail.size() != tailSize)
+        return false;
+
+    const uint8_t *t = reinterpret_cast<const uint8_t *>(tail.constData());
+    int end = -1;
+    for(int i = int(tailSize) - zip_end_size; i >= 0; i--)
+    {
+        if(toUint32LE(t + i) == zip_end_of_directory)
+        {
+            end = i;
+            break;
+        }
+    }
+    if(end < 0)
+        return false;
+
+    uint64_t count = toUint16LE(t + end + 10);
+    uint64_t dirSize = toUint32LE(t + end + 12);
+    uint64_t dirOffset = toUint32LE(t + end + 16);
+
+    if(count == 0xFFFF || dirSize == 0xFFFFFFFF || dirOffset == 0xFFFFFFFF)
+    {
+        // Sizes and offsets are in the ZIP64 end record
+        if(end < zip64_locator_size || toUint32LE(t + end - zip64_locator_size) != zip64_locator)
+            return false;
+        uint64_t end64 = toUint64LE(t + end - zip64_locator_size + 8);
+        if(end64 + zip64_end_size > uint64_t(fileSize) || !m_device->seek(qint64(end64)))
+            return false;
+        QByteArray rec = m_device->read(zip64_end_size);
+        const uint8_t *r = reinterpret_cast<const uint8_t *>(rec.constData());
+        if(rec.size() != zip64_end_size || toUint32LE(r) != zip64_end_of_directory)
+            return false;
+        count = toUint64LE(r + 32);
+        dirSize = toUint64LE(r + 40);
+        dirOffset = toUint64LE(r + 48);
+    }
+
+    if(dirOffset + dirSize > uint64_t(fileSize) || dirSize > uint64_t(maxUnpackedSize) ||
+       count > dirSize / zip_central_header_size)
+        return false;
+
+    // The whole central directory is read at once
+    if(!m_device->seek(qint64(dirOffset)))
+        return false;
+    QByteArray dir = m_device->read(qint64(dirSize));
+    if(uint64_t(dir.size()) != dirSize)
+        return false;
+
+    const uint8_t *d = reinterpret_cast<const uint8_t *>(dir.constData());
+    const uint8_t *dEnd = d + dir.size();
+    m_entries.clear();
+    m_entries.reserve(int(count));
+
+    for(uint64_t n = 0; n < count; n++)
+    {
+        if(dEnd - d < zip_central_header_size || toUint32LE(d) != zip_central_header)
+            return false;
+
+        const uint16_t nameLen = toUint16LE(d + 28);
+        const uint16_t extraLen = toUint16LE(d + 30);
+        const uint16_t commentLen = toUint16LE(d + 32);
+        if(dEnd - d < zip_central_header_size + nameLen + extraLen + commentLen)
+            return false;
+
+        Entry e;
+        e.flags = toUint16LE(d + 8);
+        e.method = toUint16LE(d + 10);
+        e.mtime = dosTimeToMSecs(toUint16LE(d + 12), toUint16LE(d + 14));
+        e.crc32 = toUint32LE(d + 16);
+
+        uint64_t compressedSize = toUint32LE(d + 20);
+        uint64_t size = toUint32LE(d + 24);
+        uint64_t offset = toUint32LE(d + 42);
+
+        const char *name = reinterpret_cast<const char *>(d + zip_central_header_size);
+        e.name = (e.flags & zip_flag_utf8) ?
+                    QString::fromUtf8(name, nameLen) :
+                    QString::fromLocal8Bit(name, nameLen);
+
+        // Values which don't fit 32 bits are following in the ZIP64 extra field
+        const uint8_t *x = d + zip_central_header_size + nameLen;
+        const uint8_t *xEnd = x + extraLen;
+        while(xEnd - x >= 4)
+        {
+            const uint16_t id = toUint16LE(x);
+            const uint16_t len = toUint16LE(x + 2);
+            const uint8_t *v = x + 4;
+            const uint8_t *vEnd = v + len;
+            if(vEnd > xEnd)
+                break;
+            if(id == 0x0001)
+            {
+                if(size == 0xFFFFFFFF && vEnd - v >= 8)
+                {
+                    size = toUint64LE(v);
+                    v += 8;
+                }
+                if(compressedSize == 0xFFFFFFFF && vEnd - v >= 8)
+                {
+                    compressedSize = toUint64LE(v);
+                    v += 8;
+                }
+                if(offset == 0xFFFFFFFF && vEnd - v >= 8)
+                    offset = toUint64LE(v);
+            }
+            x = vEnd;
+        }
+
+        if(offset + compressedSize > uint64_t(fileSize))
+            return false;
+
+        e.size = qint64(size);
+        e.compressedSize = qint64(compressedSize);
+        e.headerOffset = qint64(offset);
+        m_entries.push_back(e);
+
+        d += zip_central_header_size + nameLen + extraLen + commentLen;
+    }
+
+    return true;
+}
+
+int FmBankArchive::findEntry(const QString &name) const
+{
+    QString path = QDir::fromNativeSeparators(name);
+    for(int i = 0; i < m_entries.size(); i++)
+    {
+        if(m_entries[i].name == path)
+            return i;
+    }
+    return -1;
+}
+
+FfmtErrCode FmBankArchive::extract(int i, QIODevice &out) const
+{
+    if(!m_device || i < 0 || i >= m_entries.size())
+        return FfmtErrCode::ERR_NOFILE;
+
+    const Entry &e = m_entries[i];
+    if((e.flags & zip_flag_encrypted) ||
+       (e.method != zip_method_store && e.method != zip_method_deflate))
+        return FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
+
+    uint8_t head[zip_local_header_size];
+    if(!m_device->seek(e.headerOffset) ||
+       m_device->read(reinterpret_cast<char *>(head), zip_local_header_size) != zip_local_header_size ||
+       toUint32LE(head) != zip_local_header)
+        return FfmtErrCode::ERR_BADFORMAT;
+
+    // Name and extra field of the local header may differ from the central directory
+    const qint64 dataPos = e.headerOffset + zip_local_header_size + toUint16LE(head + 26) + toUint16LE(head + 28);
+    if(dataPos + e.compressedSize > m_device->size() || !m_device->seek(dataPos))
+        return FfmtErrCode::ERR_BADFORMAT;
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    if(e.method == zip_method_deflate && inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+        return FfmtErrCode::ERR_UNKNOWN;
+
+    char inBuf[16384];
+    char outBuf[32768];
+    qint64 left = e.compressedSize;
+    qint64 total = 0;
+    uLong crc = crc32(0L, Z_NULL, 0);
+    bool ok = true;
+    int ret = Z_OK;
+
+    while(ok && ret != Z_STREAM_END)
+    {
+        if(zs.avail_in == 0 && left > 0)
+        {
+            qint64 got = m_device->read(inBuf, qMin<qint64>(left, sizeof(inBuf)));
+            if(got <= 0)
+            {
+                ok = false;
+                break;
+            }
+            left -= got;
+            zs.next_in = reinterpret_cast<Bytef *>(inBuf);
+            zs.avail_in = uInt(got);
+        }
+        else if(zs.avail_in == 0 && e.method == zip_method_store)
+            break;
+
+        const char *chunk;
+        qint64 have;
+        if(e.method == zip_method_store)
+        {
+            chunk = reinterpret_cast<const char *>(zs.next_in);
+            have = zs.avail_in;
+            zs.avail_in = 0;
+        }
+        else
+        {
+            zs.next_out = reinterpret_cast<Bytef *>(outBuf);
+            zs.avail_out = sizeof(outBuf);
+            ret = inflate(&zs, Z_NO_FLUSH);
+            if(ret != Z_OK && ret != Z_STREAM_END)
+            {
+                ok = false;
+                break;
+            }
+            chunk = outBuf;
+            have = qint64(sizeof(outBuf) - zs.avail_out);
+        }
+
+        total += have;
+        if(total > e.size)
+        {
+            ok = false;
+            break;
+        }
+        crc = crc32(crc, reinterpret_cast<const Bytef *>(chunk), uInt(have));
+        if(out.write(chunk, have) != have)
+            ok = false;
+    }
+
+    if(e.method == zip_method_deflate)
+    {
+        ok = ok && ret == Z_STREAM_END;
+        inflateEnd(&zs);
+    }
+
+    if(!ok || total != e.size || crc != e.crc32)
+        return FfmtErrCode::ERR_BADFORMAT;
+
+    return FfmtErrCode::ERR_OK;
+}
+
+FfmtErrCode FmBankArchive::read(int i, QByteArray &data) const
+{
+    if(i < 0 || i >= m_entries.size())
+        return FfmtErrCode::ERR_NOFILE;
+    if(m_entries[i].size > maxUnpackedSize)
+        return FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
+
+    QBuffer buffer;
+    buffer.buffer().reserve(int(m_entries[i].size));
+    buffer.open(QIODevice::WriteOnly);
+    FfmtErrCode err = extract(i, buffer);
+    buffer.close();
+    if(err == FfmtErrCode::ERR_OK)
+        data = buffer.data();
+    return err;
+}
+
+bool FmBankArchive::isZip(const char *magic)
+{
+    // Local header of the first file, or the end record of an empty archive
+    return magic[0] == 'P' && magic[1] == 'K' &&
+           ((magic[2] == 0x03 && magic[3] == 0x04) ||
+            (magic[2] == 0x05 && magic[3] == 0x06));
+}
+
+bool FmBankArchive::isGzip(const char *magic)
+{
+    return uint8_t(magic[0]) == 0x1F && uint8_t(magic[1]) == 0x8B;
+}
+
+bool FmBankArchive::isZipFile(const QString &filePath)
+{
+    QFile file(filePath);
+    char magic[4];
+    if(!file.open(QIODevice::ReadOnly) || file.read(magic, 4) != 4)
+        return false;
+    return isZip(magic);
+}
+
+bool FmBankArchive::splitPath(const QString &path, QString &archivePath, QString &entryName)
+{
+    QString p = QDir::fromNativeSeparators(path);
+    if(QFileInfo(p).exists())
+        return false;
+
+    int slash = p.lastIndexOf('/');
+    while(slash > 0)
+    {
+        QFileInfo info(p.left(slash));
+        if(info.isFile())
+        {
+            archivePath = p.left(slash);
+            entryName = p.mid(slash + 1);
+            return !entryName.isEmpty();
+        }
+        if(info.exists())
+            return false;
+        slash = p.lastIndexOf('/', slash - 1);
+    }
+
+    return false;
+}
+
+FfmtErrCode FmBankArchive::readFile(const QString &filePath, QByteArray &data)
+{
+    QString archivePath, entryName;
+    if(splitPath(filePath, archivePath, entryName))
+    {
+        FmBankArchive archive;
+        FfmtErrCode err = archive.open(archivePath);
+        if(err != FfmtErrCode::ERR_OK)
+            return err;
+        int i = archive.findEntry(entryName);
+        if(i < 0)
+            return FfmtErrCode::ERR_NOFILE;
+        return archive.read(i, data);
+    }
+
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return FfmtErrCode::ERR_NOFILE;
+    data = file.readAll();
+    return FfmtErrCode::ERR_OK;
+}
+
+/*
+ * Makes sure the input holds at least two bytes when there are any,
+ * and tells whether they begin another gzip member
+ */
+static bool nextGzipMember(QIODevice &in, z_stream &zs, char *buf, size_t bufSize)
+{
+    if(zs.avail_in < 2)
+    {
+        if(zs.avail_in == 1)
+            buf[0] = char(*zs.next_in);
+        qint64 got = in.read(buf + zs.avail_in, qint64(bufSize - zs.avail_in));
+        zs.next_in = reinterpret_cast<Bytef *>(buf);
+        if(got > 0)
+            zs.avail_in += uInt(got);
+    }
+    // Anything else is trailing garbage, which is ignored like gzip(1) does
+    return zs.avail_in >= 2 && zs.next_in[0] == 0x1F && zs.next_in[1] == 0x8B;
+}
+
+bool FmBankArchive::gunzip(QIODevice &in, QIODevice &out, qint64 maxSize)
+{
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    if(inflateInit2(&zs, 15 + 16) != Z_OK)
+        return false;
+
+    char inBuf[4096];
+    char outBuf[16384];
+    qint64 total = 0;
+    int ret = Z_OK;
+
+    while(ret != Z_STREAM_END)
+    {
+        if(zs.avail_in == 0)
+        {
+            // Inflate is called on the end of input too, to flush the pending output
+            qint64 got = in.read(inBuf, sizeof(inBuf));
+            if(got < 0)
+                break;
+            zs.next_in = reinterpret_cast<Bytef *>(inBuf);
+            zs.avail_in = uInt(got);
+        }
+
+        zs.next_out = reinterpret_cast<Bytef *>(outBuf);
+        zs.avail_out = sizeof(outBuf);
+        ret = inflate(&zs, Z_NO_FLUSH);
+        if(ret != Z_OK && ret != Z_STREAM_END)
+            break;
+
+        qint64 have = qint64(sizeof(outBuf) - zs.avail_out);
+        if(maxSize >= 0 && total + have >= maxSize)
+        {
+            out.write(outBuf, maxSize - total);
+            inflateEnd(&zs);
+            return true;
+        }
+        out.write(outBuf, have);
+        total += have;
+
+        // Concatenated members are parts of the same data
+        if(ret == Z_STREAM_END && nextGzipMember(in, zs, inBuf, sizeof(inBuf)))
+        {
+            if(inflateReset(&zs) != Z_OK)
+                break;
+            ret = Z_OK;
+        }
+    }
+
+    inflateEnd(&zs);
+    return ret == Z_STREAM_END;
+}
+
+FfmtErrCode FmBankArchive::gunzipData(const QByteArray &data, const QString &fileName, QByteArray &out, QString &outName)
+{
+    QBuffer in;
+    in.setData(data);
+    in.open(QIODevice::ReadOnly);
+
+    QBuffer unpacked;
+    unpacked.open(QIODevice::WriteOnly);
+    // One byte over the limit tells the too large data from the data of the limit size
+    if(!gunzip(in, unpacked, maxUnpackedSize + 1) || unpacked.size() > maxUnpackedSize)
+        return FfmtErrCode::ERR_BADFORMAT;
+    unpacked.close();
+
+    out = unpacked.data();
+    outName = fileName;
+    if(outName.endsWith(".gz", Qt::CaseInsensitive))
+        outName.chop(3);
+    return FfmtErrCode::ERR_OK;
+}
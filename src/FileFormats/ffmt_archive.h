@@ -0,0 +1,154 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FFMT_ARCHIVE_H
+#define FFMT_ARCHIVE_H
+
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+#include <QFile>
+#include "ffmt_enums.h"
+
+/**
+ * @brief Reader of ZIP archives and gzip streams with banks
+ *
+ * Opening of the ZIP archive reads its central directory only, entries are
+ * inflated one by one right into the memory when requested.
+ *
+ * A file in the archive is addressed by the path which continues after the
+ * archive file, like "patches.zip/ibk/drums.ibk".
+ */
+class FmBankArchive
+{
+public:
+    //! Largest unpacked file which can be read into the memory
+    static const qint64 maxUnpackedSize = 256 * 1024 * 1024;
+
+    struct Entry
+    {
+        //! Path in the archive, '/' separated
+        QString name;
+        qint64  size = 0;
+        qint64  compressedSize = 0;
+        //! Offset of the local header
+        qint64  headerOffset = 0;
+        //! Modification time, milliseconds since epoch
+        qint64  mtime = 0;
+        quint32 crc32 = 0;
+        quint16 method = 0;
+        quint16 flags = 0;
+
+        inline bool isDir() const { return name.endsWith('/'); }
+    };
+
+    FmBankArchive();
+    ~FmBankArchive();
+
+    /**
+     * @brief Open the ZIP archive and read its central directory
+     * @param filePath Path to the archive
+     * @return ERR_NOFILE if the file can't be opened, ERR_BADFORMAT if it's not a valid archive
+     */
+    FfmtErrCode open(const QString &filePath);
+    /**
+     * @brief Open the ZIP archive from the device
+     * @param device Seekable device, must stay open while the archive is used
+     * @return ERR_BADFORMAT if the device has no valid archive
+     */
+    FfmtErrCode open(QIODevice *device);
+    void close();
+
+    inline bool isOpen() const { return m_device != nullptr; }
+    inline const QVector<Entry> &entries() const { return m_entries; }
+
+    /**
+     * @brief Find the entry by its path
+     * @param name Path in the archive
+     * @return index of the entry or -1 if there is no such entry
+     */
+    int findEntry(const QString &name) const;
+
+    /**
+     * @brief Unpack the entry into the device
+     * @param i Index of the entry
+     * @param out Destination device
+     * @return ERR_BADFORMAT if data is damaged, ERR_UNSUPPORTED_FORMAT for encrypted or unknown compression
+     */
+    FfmtErrCode extract(int i, QIODevice &out) const;
+    /**
+     * @brief Unpack the entry into the memory
+     * @param i Index of the entry
+     * @param [out] data Receives the unpacked data
+     * @return error code, ERR_UNSUPPORTED_FORMAT when the entry is larger than maxUnpackedSize
+     */
+    FfmtErrCode read(int i, QByteArray &data) const;
+
+    static bool isZip(const char *magic);
+    static bool isGzip(const char *magic);
+    /**
+     * @brief Is the file a ZIP archive
+     * @param filePath Path to the file
+     */
+    static bool isZipFile(const QString &filePath);
+
+    /**
+     * @brief Split the path of the file in the archive
+     * @param path Path which may continue after the archive file
+     * @param [out] archivePath Receives the path to the archive
+     * @param [out] entryName Receives the path in the archive
+     * @return false if the path doesn't go into the file
+     */
+    static bool splitPath(const QString &path, QString &archivePath, QString &entryName);
+
+    /**
+     * @brief Read the whole file, which may be in the ZIP archive
+     * @param filePath Path to the file, see splitPath()
+     * @param [out] data Receives the file data
+     * @return error code
+     */
+    static FfmtErrCode readFile(const QString &filePath, QByteArray &data);
+
+    /**
+     * @brief Decompress the gzip stream, concatenated members are decompressed one after another
+     * @param in Source device, positioned at the begin of the stream
+     * @param out Destination device
+     * @param maxSize Stop after this count of decompressed bytes, or -1 to decompress everything
+     * @return true on success, or if the limit has been reached
+     */
+    static bool gunzip(QIODevice &in, QIODevice &out, qint64 maxSize = -1);
+
+    /**
+     * @brief Unpack the gzip-wrapped data
+     * @param data Compressed data
+     * @param fileName Name of the compressed file
+     * @param [out] out Receives the unpacked data
+     * @param [out] outName Receives the file name without ".gz" suffix
+     * @return ERR_BADFORMAT if the data is damaged or larger than maxUnpackedSize
+     */
+    static FfmtErrCode gunzipData(const QByteArray &data, const QString &fileName, QByteArray &out, QString &outName);
+
+private:
+    bool readDirectory();
+
+    QFile           m_file;
+    QIODevice      *m_device = nullptr;
+    QVector<Entry>  m_entries;
+};
+
+#endif // FFMT_ARCHIVE_H
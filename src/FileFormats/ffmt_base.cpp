@@ -20,42 +20,202 @@
  */
 
 #include "ffmt_base.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QBuffer>
+#include <cstring>
 
 FmBankFormatBase::FmBankFormatBase() {}
 
 FmBankFormatBase::~FmBankFormatBase()
 {}
 
-bool FmBankFormatBase::detect(const QString&, char*)
+bool FmBankFormatBase::detectDevice(const QString &, QIODevice &, char *)
 {
     return false;
 }
 
-bool FmBankFormatBase::detectInst(const QString &, char *)
+bool FmBankFormatBase::detectInstDevice(const QString &, QIODevice &, char *)
 {
     return false;
 }
 
-FfmtErrCode FmBankFormatBase::loadFile(QString, FmBank &)
+FfmtErrCode FmBankFormatBase::loadDevice(QIODevice &, FmBank &)
 {
     return FfmtErrCode::ERR_NOT_IMPLEMENTED;
 }
 
-FfmtErrCode FmBankFormatBase::saveFile(QString, FmBank &)
+FfmtErrCode FmBankFormatBase::saveDevice(QIODevice &, FmBank &)
 {
     return FfmtErrCode::ERR_NOT_IMPLEMENTED;
 }
 
-FfmtErrCode FmBankFormatBase::loadFileInst(QString, FmBank::Instrument &, bool *)
+FfmtErrCode FmBankFormatBase::loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format)
+{
+    format = formatId();
+    return loadDevice(file, bank);
+}
+
+FfmtErrCode FmBankFormatBase::loadInstDevice(QIODevice &, FmBank::Instrument &, bool *)
 {
     return FfmtErrCode::ERR_NOT_IMPLEMENTED;
 }
 
-FfmtErrCode FmBankFormatBase::saveFileInst(QString, FmBank::Instrument &, bool)
+FfmtErrCode FmBankFormatBase::saveInstDevice(QIODevice &, FmBank::Instrument &, bool)
 {
     return FfmtErrCode::ERR_NOT_IMPLEMENTED;
 }
 
+qint64 FmBankFormatBase::saveSize(const FmBank &) const
+{
+    return -1;
+}
+
+qint64 FmBankFormatBase::saveInstSize(const FmBank::Instrument &, bool) const
+{
+    return -1;
+}
+
+bool FmBankFormatBase::detect(const QString &filePath, char *magic)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+    return detectDevice(filePath, file, magic);
+}
+
+bool FmBankFormatBase::detectInst(const QString &filePath, char *magic)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+    return detectInstDevice(filePath, file, magic);
+}
+
+FfmtErrCode FmBankFormatBase::loadFile(QString filePath, FmBank &bank)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return FfmtErrCode::ERR_NOFILE;
+    return loadDevice(file, bank);
+}
+
+FfmtErrCode FmBankFormatBase::saveFile(QString filePath, FmBank &bank)
+{
+    QByteArray data;
+    FfmtErrCode err = saveData(data, bank);
+    if(err != FfmtErrCode::ERR_OK)
+        return err;
+    return writeFileData(filePath, data);
+}
+
+FfmtErrCode FmBankFormatBase::loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return FfmtErrCode::ERR_NOFILE;
+    return loadInstDevice(file, inst, isDrum);
+}
+
+FfmtErrCode FmBankFormatBase::saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum)
+{
+    QByteArray data;
+    FfmtErrCode err = saveInstData(data, inst, isDrum);
+    if(err != FfmtErrCode::ERR_OK)
+        return err;
+    return writeFileData(filePath, data);
+}
+
+bool FmBankFormatBase::detectData(const QByteArray &data, const QString &fileName)
+{
+    char magic[32];
+    dataMagic(data, magic);
+    QBuffer buffer;
+    buffer.setObjectName(fileName);
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    return detectDevice(fileName, buffer, magic);
+}
+
+bool FmBankFormatBase::detectInstData(const QByteArray &data, const QString &fileName)
+{
+    char magic[32];
+    dataMagic(data, magic);
+    QBuffer buffer;
+    buffer.setObjectName(fileName);
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    return detectInstDevice(fileName, buffer, magic);
+}
+
+FfmtErrCode FmBankFormatBase::loadData(const QByteArray &data, FmBank &bank)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    return loadDevice(buffer, bank);
+}
+
+FfmtErrCode FmBankFormatBase::saveData(QByteArray &data, FmBank &bank)
+{
+    data.clear();
+    qint64 size = saveSize(bank);
+    if(size > 0)
+        data.reserve(int(size));
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    return saveDevice(buffer, bank);
+}
+
+FfmtErrCode FmBankFormatBase::loadInstData(const QByteArray &data, FmBank::Instrument &inst, bool *isDrum, const QString &fileName)
+{
+    QBuffer buffer;
+    buffer.setObjectName(fileName);
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    return loadInstDevice(buffer, inst, isDrum);
+}
+
+FfmtErrCode FmBankFormatBase::saveInstData(QByteArray &data, FmBank::Instrument &inst, bool isDrum)
+{
+    data.clear();
+    qint64 size = saveInstSize(inst, isDrum);
+    if(size > 0)
+        data.reserve(int(size));
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    return saveInstDevice(buffer, inst, isDrum);
+}
+
+void FmBankFormatBase::dataMagic(const QByteArray &data, char *magic)
+{
+    std::memset(magic, 0, 32);
+    std::memcpy(magic, data.constData(), size_t(qMin(data.size(), 32)));
+}
+
+QString FmBankFormatBase::deviceFileName(const QIODevice &file)
+{
+    const QFileDevice *fileDev = qobject_cast<const QFileDevice*>(&file);
+    if(fileDev)
+        return fileDev->fileName();
+    return file.objectName();
+}
+
+FfmtErrCode FmBankFormatBase::writeFileData(const QString &filePath, const QByteArray &data)
+{
+    QSaveFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly))
+        return FfmtErrCode::ERR_NOFILE;
+    if(file.write(data) != data.size())
+    {
+        file.cancelWriting();
+        return FfmtErrCode::ERR_NOFILE;
+    }
+    if(!file.commit())
+        return FfmtErrCode::ERR_NOFILE;
+    return FfmtErrCode::ERR_OK;
+}
+
 int FmBankFormatBase::formatCaps() const
 {
     return (int)FormatCaps::FORMAT_CAPS_NOTHING;
@@ -23,11 +23,19 @@
 #define FMBANKFORMATBASE_H
 
 #include <QString>
+#include <QByteArray>
 #include "../bank.h"
 #include "ffmt_enums.h"
 
+class QIODevice;
+
 /*!
  * \brief Base class provides errors enum and commonly used headers
+ *
+ * Formats are implementing the device-based methods, which are working with
+ * any random-access device (a file, or a QBuffer over the data in memory).
+ * The device is opened and positioned at the begin of the data by the caller.
+ * Path-based and memory-based methods are thin wrappers over them.
  */
 class FmBankFormatBase
 {
@@ -35,14 +43,78 @@ public:
     FmBankFormatBase();
     virtual ~FmBankFormatBase();
 
-    virtual bool detect(const QString &filePath, char* magic);
-    virtual bool detectInst(const QString &filePath, char* magic);
+    /*!
+     * \brief Check is the data of this format
+     * \param filePath Path or name of the file, used by formats which are detected by the extension, may be empty
+     * \param file Device with the data
+     * \param magic First 32 bytes of the data, zero-padded
+     * \return true if the data can be loaded by this format
+     */
+    virtual bool detectDevice(const QString &filePath, QIODevice &file, char *magic);
+    virtual bool detectInstDevice(const QString &filePath, QIODevice &file, char *magic);
+
+    virtual FfmtErrCode loadDevice(QIODevice &file, FmBank &bank);
+    virtual FfmtErrCode saveDevice(QIODevice &file, FmBank &bank);
+
+    /*!
+     * \brief Load the bank and tell the exact format of the data
+     * \param format [out] Receives the format of the data, formatId() by default
+     *
+     * Readers of several format variants are giving the variant here instead of
+     * keeping it, so one reader may load data on several threads at once.
+     */
+    virtual FfmtErrCode loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format);
+
+    virtual FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = 0);
+    virtual FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false);
+
+    /*!
+     * \brief Size of the data which saveDevice() will write
+     * \param bank Bank to save
+     * \return size in bytes, or -1 if it's not known before saving
+     */
+    virtual qint64 saveSize(const FmBank &bank) const;
+    virtual qint64 saveInstSize(const FmBank::Instrument &inst, bool isDrum = false) const;
+
+    /* Wrappers which are working with files.
+     * The data is serialized into the memory first, and then written at once
+     * into the temporary file which replaces the destination on success only. */
+    bool detect(const QString &filePath, char* magic);
+    bool detectInst(const QString &filePath, char* magic);
 
-    virtual FfmtErrCode loadFile(QString filePath, FmBank &bank);
-    virtual FfmtErrCode saveFile(QString filePath, FmBank &bank);
+    FfmtErrCode loadFile(QString filePath, FmBank &bank);
+    FfmtErrCode saveFile(QString filePath, FmBank &bank);
 
-    virtual FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0);
-    virtual FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false);
+    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0);
+    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false);
+
+    /* Wrappers which are working with the data in memory */
+
+    /*!
+     * \brief Check is the data of this format
+     * \param data Whole data, use QByteArray::fromRawData() to avoid copying
+     * \param fileName Name of the file, may be empty
+     */
+    bool detectData(const QByteArray &data, const QString &fileName = QString());
+    bool detectInstData(const QByteArray &data, const QString &fileName = QString());
+
+    FfmtErrCode loadData(const QByteArray &data, FmBank &bank);
+    /*!
+     * \brief Save the bank into the memory
+     * \param [out] data Receives the whole file data
+     * \param bank Bank to save
+     */
+    FfmtErrCode saveData(QByteArray &data, FmBank &bank);
+
+    /*!
+     * \brief Load the instrument from the memory
+     * \param data Whole data
+     * \param inst Destination instrument
+     * \param isDrum [out] Receives the percussion flag if format has it
+     * \param fileName Name of the file, used by formats which are naming the instrument by the file
+     */
+    FfmtErrCode loadInstData(const QByteArray &data, FmBank::Instrument &inst, bool *isDrum = 0, const QString &fileName = QString());
+    FfmtErrCode saveInstData(QByteArray &data, FmBank::Instrument &inst, bool isDrum = false);
 
     virtual int         formatCaps() const;
     virtual QString     formatName() const;
@@ -57,6 +129,28 @@ public:
     virtual QString     formatInstExtensionMask() const;
     virtual QString     formatInstDefaultExtension() const;
     virtual InstFormats formatInstId() const;
+
+    /*!
+     * \brief Get the magic bytes of the data
+     * \param data Source data
+     * \param [out] magic 32 bytes, zero-padded if data is shorter
+     */
+    static void dataMagic(const QByteArray &data, char *magic);
+
+    /*!
+     * \brief Get the name of the file behind the device
+     * \param file Device
+     * \return path of the file, or the object name of other devices (may be empty)
+     */
+    static QString deviceFileName(const QIODevice &file);
+
+    /*!
+     * \brief Replace the file with the data atomically
+     * \param filePath Destination file
+     * \param data Whole file data
+     * \return ERR_NOFILE if file can't be written, the old file is kept untouched then
+     */
+    static FfmtErrCode writeFileData(const QString &filePath, const QByteArray &data);
 };
 
 #endif // FMBANKFORMATBASE_H
@@ -21,10 +21,13 @@
 
 #include <memory>
 #include <list>
+#include <QFile>
+#include <QBuffer>
 
 #include "../common.h"
 
 #include "ffmt_factory.h"
+#include "ffmt_archive.h"
 
 #include "format_adlib_bnk.h"
 #include "format_adlib_tim.h"
@@ -338,51 +341,107 @@ QString FmBankFormatFactory::formatName(BankFormats format)
 
 
 
-FfmtErrCode FmBankFormatFactory::OpenBankFile(QString filePath, FmBank &bank, BankFormats *recent)
+static FfmtErrCode readFileData(const QString &filePath, QByteArray &data)
+{
+    // The file may be inside of the ZIP archive
+    return FmBankArchive::readFile(filePath, data);
+}
+
+static FfmtErrCode loadBankData(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats *recent, FormatCaps caps)
 {
+    // The gzip-wrapped file of any format, only one level of wrapping is unpacked
+    QByteArray input = data;
+    QString inputName = fileName;
+    if(data.size() >= 2 && FmBankArchive::isGzip(data.constData()))
+    {
+        FfmtErrCode err = FmBankArchive::gunzipData(data, fileName, input, inputName);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            if(recent)
+                *recent = BankFormats::FORMAT_UNKNOWN;
+            return err;
+        }
+    }
+
     char magic[32];
-    getMagic(filePath, magic, 32);
+    FmBankFormatBase::dataMagic(input, magic);
 
     FfmtErrCode err = FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
     BankFormats fmt = BankFormats::FORMAT_UNKNOWN;
 
+    // Every format is checking the same buffer, the data is read only once
+    QBuffer buffer;
+    buffer.setObjectName(inputName);
+    buffer.setData(input);
+    buffer.open(QIODevice::ReadOnly);
+
     for(FmBankFormatBase_uptr &p : g_formats)
     {
         Q_ASSERT(p.get());//It must be non-null!
-        if((p->formatCaps() & (int)FormatCaps::FORMAT_CAPS_OPEN) && p->detect(filePath, magic))
+        if((p->formatCaps() & (int)caps) == 0)
+            continue;
+        buffer.seek(0);
+        if(p->detectDevice(inputName, buffer, magic))
         {
-            err = p->loadFile(filePath, bank);
-            fmt = p->formatId();
+            buffer.seek(0);
+            err = p->loadDeviceFormat(buffer, bank, fmt);
             break;
         }
     }
+
     if(recent)
         *recent = fmt;
-
     return err;
 }
 
+FfmtErrCode FmBankFormatFactory::OpenBankFile(QString filePath, FmBank &bank, BankFormats *recent)
+{
+    QByteArray data;
+    FfmtErrCode err = readFileData(filePath, data);
+    if(err != FfmtErrCode::ERR_OK)
+    {
+        if(recent)
+            *recent = BankFormats::FORMAT_UNKNOWN;
+        return err;
+    }
+    return loadBankData(data, filePath, bank, recent, FormatCaps::FORMAT_CAPS_OPEN);
+}
+
 FfmtErrCode FmBankFormatFactory::ImportBankFile(QString filePath, FmBank &bank, BankFormats *recent)
 {
-    char magic[32];
-    getMagic(filePath, magic, 32);
+    QByteArray data;
+    FfmtErrCode err = readFileData(filePath, data);
+    if(err != FfmtErrCode::ERR_OK)
+    {
+        if(recent)
+            *recent = BankFormats::FORMAT_UNKNOWN;
+        return err;
+    }
+    return loadBankData(data, filePath, bank, recent, FormatCaps::FORMAT_CAPS_IMPORT);
+}
 
-    FfmtErrCode err = FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
-    BankFormats fmt = BankFormats::FORMAT_UNKNOWN;
+FfmtErrCode FmBankFormatFactory::OpenBankData(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats *recent)
+{
+    return loadBankData(data, fileName, bank, recent, FormatCaps::FORMAT_CAPS_OPEN);
+}
+
+FfmtErrCode FmBankFormatFactory::ImportBankData(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats *recent)
+{
+    return loadBankData(data, fileName, bank, recent, FormatCaps::FORMAT_CAPS_IMPORT);
+}
 
+FfmtErrCode FmBankFormatFactory::SaveBankData(QByteArray &data, FmBank &bank, BankFormats dest)
+{
+    FfmtErrCode err = FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
     for(FmBankFormatBase_uptr &p : g_formats)
     {
         Q_ASSERT(p.get());//It must be non-null!
-        if((p->formatCaps() & (int)FormatCaps::FORMAT_CAPS_IMPORT) && p->detect(filePath, magic))
+        if((p->formatCaps() & (int)FormatCaps::FORMAT_CAPS_SAVE) && (p->formatId() == dest))
         {
-            err = p->loadFile(filePath, bank);
-            fmt = p->formatId();
+            err = p->saveData(data, bank);
             break;
         }
     }
-
-    if(recent)
-        *recent = fmt;
     return err;
 }
 
@@ -411,20 +470,62 @@ FfmtErrCode FmBankFormatFactory::OpenInstrumentFile(QString filePath,
                                          bool *isDrum,
                                          bool import)
 {
+    QByteArray data;
+    FfmtErrCode err = readFileData(filePath, data);
+    if(err != FfmtErrCode::ERR_OK)
+    {
+        if(recent)
+            *recent = InstFormats::FORMAT_INST_UNKNOWN;
+        return err;
+    }
+    return OpenInstrumentData(data, filePath, ins, recent, isDrum, import);
+}
+
+FfmtErrCode FmBankFormatFactory::OpenInstrumentData(const QByteArray &data,
+                                         const QString &fileName,
+                                         FmBank::Instrument &ins,
+                                         InstFormats *recent,
+                                         bool *isDrum,
+                                         bool import)
+{
+    // Only one level of the gzip wrapping is unpacked
+    QByteArray input = data;
+    QString inputName = fileName;
+    if(data.size() >= 2 && FmBankArchive::isGzip(data.constData()))
+    {
+        FfmtErrCode err = FmBankArchive::gunzipData(data, fileName, input, inputName);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            if(recent)
+                *recent = InstFormats::FORMAT_INST_UNKNOWN;
+            return err;
+        }
+    }
+
     char magic[32];
-    getMagic(filePath, magic, 32);
+    FmBankFormatBase::dataMagic(input, magic);
 
     FfmtErrCode err = FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
     InstFormats fmt = InstFormats::FORMAT_INST_UNKNOWN;
     FormatCaps dst = import ?
                 FormatCaps::FORMAT_CAPS_IMPORT :
                 FormatCaps::FORMAT_CAPS_OPEN;
+
+    QBuffer buffer;
+    buffer.setObjectName(inputName);
+    buffer.setData(input);
+    buffer.open(QIODevice::ReadOnly);
+
     for(FmBankFormatBase_uptr &p : g_formatsInstr)
     {
         Q_ASSERT(p.get());//It must be non-null!
-        if((p->formatInstCaps() & (int)dst) && p->detectInst(filePath, magic))
+        if((p->formatInstCaps() & (int)dst) == 0)
+            continue;
+        buffer.seek(0);
+        if(p->detectInstDevice(inputName, buffer, magic))
         {
-            err = p->loadFileInst(filePath, ins, isDrum);
+            buffer.seek(0);
+            err = p->loadInstDevice(buffer, ins, isDrum);
             fmt = p->formatInstId();
             break;
         }
@@ -453,3 +554,18 @@ FfmtErrCode FmBankFormatFactory::SaveInstrumentFile(QString &filePath, FmBank::I
     }
     return err;
 }
+
+FfmtErrCode FmBankFormatFactory::SaveInstrumentData(QByteArray &data, FmBank::Instrument &ins, InstFormats dest, bool isDrum)
+{
+    FfmtErrCode err = FfmtErrCode::ERR_UNSUPPORTED_FORMAT;
+    for(FmBankFormatBase_uptr &p : g_formatsInstr)
+    {
+        Q_ASSERT(p.get());//It must be non-null!
+        if((p->formatInstCaps() & (int)FormatCaps::FORMAT_CAPS_SAVE) && (p->formatInstId() == dest))
+        {
+            err = p->saveInstData(data, ins, isDrum);
+            break;
+        }
+    }
+    return err;
+}
@@ -53,11 +53,35 @@ public:
     static bool isImportOnly(BankFormats format);
     static bool hasCaps(BankFormats format, int capsQuery);
     static QString formatName(BankFormats format);
+    /* File paths may continue into ZIP archives ("patches.zip/ibk/drums.ibk"), gzip-wrapped files are unpacked */
     static FfmtErrCode OpenBankFile(QString filePath, FmBank &bank, BankFormats *recent = nullptr);
     static FfmtErrCode ImportBankFile(QString filePath, FmBank &bank, BankFormats *recent = nullptr);
     static FfmtErrCode SaveBankFile(QString &filePath, FmBank &bank, BankFormats dest);
     static FfmtErrCode OpenInstrumentFile(QString filePath, FmBank::Instrument &ins, InstFormats *recent=0, bool *isDrum = 0, bool import = false);
     static FfmtErrCode SaveInstrumentFile(QString &filePath, FmBank::Instrument &ins, InstFormats format, bool isDrum);
+
+    /* In-memory variants: the data is detected and loaded without touching the file system */
+
+    /**
+     * @brief Detect the format and load the bank from the memory
+     * @param data Whole file data, may be gzip-wrapped, use QByteArray::fromRawData() to avoid copying of external buffers
+     * @param fileName Name of the file, used by formats which are detected by the extension, may be empty
+     * @param bank Destination bank
+     * @param recent Receives the detected format
+     * @return error code
+     */
+    static FfmtErrCode OpenBankData(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats *recent = nullptr);
+    static FfmtErrCode ImportBankData(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats *recent = nullptr);
+    /**
+     * @brief Save the bank into the memory
+     * @param [out] data Receives the whole file data
+     * @param bank Bank to save
+     * @param dest Destination format
+     * @return error code
+     */
+    static FfmtErrCode SaveBankData(QByteArray &data, FmBank &bank, BankFormats dest);
+    static FfmtErrCode OpenInstrumentData(const QByteArray &data, const QString &fileName, FmBank::Instrument &ins, InstFormats *recent = 0, bool *isDrum = 0, bool import = false);
+    static FfmtErrCode SaveInstrumentData(QByteArray &data, FmBank::Instrument &ins, InstFormats format, bool isDrum);
 };
 
 #endif // FFMT_FACTORY_H
@@ -0,0 +1,670 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ffmt_library.h"
+#include "ffmt_factory.h"
+#include "ffmt_archive.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDirIterator>
+#include <QDateTime>
+#include <QHash>
+#include <QCryptographicHash>
+#include <functional>
+#include <cstring>
+
+static const char   library_magic[8] = {'O', 'P', 'L', '3', 'L', 'I', 'B', '\0'};
+static const uint32_t library_version = 1;
+static const uint32_t library_byte_order = 0x01020304;
+
+struct LibraryHeader
+{
+    char     magic[8];
+    uint32_t version;
+    //! Written in the byte order of the host, which made the store
+    uint32_t byteOrder;
+    uint32_t filesCount;
+    uint32_t instrumentsCount;
+    uint32_t filesOffset;
+    uint32_t instrumentsOffset;
+    uint32_t stringsOffset;
+    uint32_t stringsSize;
+    uint32_t reserved[6];
+};
+
+static_assert(sizeof(LibraryHeader) == 64, "Library header must be 64 bytes");
+static_assert(sizeof(FmBankLibrary::FileRecord) == 48, "File record must be 48 bytes");
+static_assert(sizeof(FmBankLibrary::InstrumentRecord) == 80, "Instrument record must be 80 bytes");
+
+FmBankLibrary::FmBankLibrary()
+{}
+
+FmBankLibrary::~FmBankLibrary()
+{
+    close();
+}
+
+QString FmBankLibrary::defaultStoreName()
+{
+    return ".opl3-library";
+}
+
+bool FmBankLibrary::open(const QString &rootDir, const QString &storePath)
+{
+    close();
+    m_rootDir = QDir(rootDir).absolutePath();
+    m_storePath = storePath.isEmpty() ? QDir(m_rootDir).filePath(defaultStoreName()) : storePath;
+    return mapStore();
+}
+
+void FmBankLibrary::close()
+{
+    m_files = nullptr;
+    m_instruments = nullptr;
+    m_filesCount = 0;
+    m_count = 0;
+    // The data must be released before its memory is unmapped
+    m_data.clear();
+
+    if(m_mapped)
+    {
+        m_mapped->close();
+        delete m_mapped;
+        m_mapped = nullptr;
+    }
+}
+
+bool FmBankLibrary::mapStore()
+{
+    QFile *file = new QFile(m_storePath);
+    if(!file->open(QIODevice::ReadOnly))
+    {
+        delete file;
+        return false;
+    }
+
+    uchar *mem = (file->size() > 0) ? file->map(0, file->size()) : nullptr;
+    if(mem)
+    {
+        m_mapped = file;
+        m_data = QByteArray::fromRawData(reinterpret_cast<const char *>(mem), int(file->size()));
+    }
+    else
+    {
+        m_data = file->readAll();
+        delete file;
+    }
+
+    return attachData();
+}
+
+bool FmBankLibrary::attachData()
+{
+    const quint64 size = quint64(m_data.size());
+    LibraryHeader head;
+    bool valid = size >= sizeof(LibraryHeader);
+    if(valid)
+    {
+        memcpy(&head, m_data.constData(), sizeof(LibraryHeader));
+        valid = memcmp(head.magic, library_magic, 8) == 0 &&
+                head.version == library_version &&
+                head.byteOrder == library_byte_order &&
+                (head.filesOffset % 8) == 0 && (head.instrumentsOffset % 8) == 0 &&
+                head.filesOffset >= sizeof(LibraryHeader) &&
+                head.filesOffset + quint64(head.filesCount) * sizeof(FileRecord) <= size &&
+                head.instrumentsOffset + quint64(head.instrumentsCount) * sizeof(InstrumentRecord) <= size &&
+                head.stringsOffset + quint64(head.stringsSize) <= size;
+    }
+
+    if(valid)
+    {
+        m_files = reinterpret_cast<const FileRecord *>(m_data.constData() + head.filesOffset);
+        m_instruments = reinterpret_cast<const InstrumentRecord *>(m_data.constData() + head.instrumentsOffset);
+        m_filesCount = int(head.filesCount);
+        m_count = int(head.instrumentsCount);
+
+        for(int i = 0; i < m_filesCount && valid; i++)
+        {
+            const FileRecord &f = m_files[i];
+            valid = quint64(f.pathOffset) + f.pathSize <= head.stringsSize &&
+                    quint64(f.firstInstrument) + f.instrumentsCount <= head.instrumentsCount;
+        }
+        for(int i = 0; i < m_count && valid; i++)
+            valid = m_instruments[i].file < head.filesCount;
+    }
+
+    if(!valid)
+    {
+        QString root = m_rootDir, store = m_storePath;
+        close();
+        m_rootDir = root;
+        m_storePath = store;
+        return false;
+    }
+
+    return true;
+}
+
+const char *FmBankLibrary::strings() const
+{
+    LibraryHeader head;
+    memcpy(&head, m_data.constData(), sizeof(LibraryHeader));
+    return m_data.constData() + head.stringsOffset;
+}
+
+int FmBankLibrary::filesCount() const
+{
+    return m_filesCount;
+}
+
+const FmBankLibrary::FileRecord &FmBankLibrary::file(int i) const
+{
+    return m_files[i];
+}
+
+QString FmBankLibrary::filePath(int i) const
+{
+    const FileRecord &f = m_files[i];
+    return QString::fromUtf8(strings() + f.pathOffset, int(f.pathSize));
+}
+
+int FmBankLibrary::count() const
+{
+    return m_count;
+}
+
+const FmBankLibrary::InstrumentRecord &FmBankLibrary::record(int i) const
+{
+    return m_instruments[i];
+}
+
+QString FmBankLibrary::name(int i) const
+{
+    const InstrumentRecord &r = m_instruments[i];
+    return QString::fromUtf8(r.name, int(strnlen(r.name, NameSize)));
+}
+
+/* ******** Records ******** */
+
+static void fillRecords(const FmBank &bank, bool isDrum, uint32_t fileIndex, QVector<FmBankLibrary::InstrumentRecord> &out)
+{
+    const FmBank::InsStorage &box = isDrum ? bank.Ins_Percussion_box : bank.Ins_Melodic_box;
+    const QVector<FmBank::MidiBank> &banks = isDrum ? bank.Banks_Percussion : bank.Banks_Melodic;
+
+    FmBankPacked packed(box);
+    QVector<uint32_t> hashes;
+    packed.hashes(hashes);
+
+    const uint8_t *flags = packed.flags();
+    for(int i = 0; i < packed.size(); i++)
+    {
+        if(flags[i] & (FmBankPacked::FLAG_BLANK | FmBankPacked::FLAG_NULL))
+            continue;
+
+        const FmBank::Instrument &ins = box.at(i);
+        FmBankLibrary::InstrumentRecord r;
+        memset(&r, 0, sizeof(r));
+        memcpy(r.name, ins.name, FmBankLibrary::NameSize);
+        for(int c = 0; c < FmBankPacked::RegsCount; c++)
+            r.regs[c] = packed.column(c)[i];
+        r.flags = flags[i] | (isDrum ? uint8_t(FmBankLibrary::INS_PERCUSSION) : 0);
+        r.percNoteNum = ins.percNoteNum;
+        r.fineTune = ins.fine_tune;
+        r.velocityOffset = ins.velocity_offset;
+        r.drumType = ins.rhythm_drum_type;
+        r.program = uint8_t(i % 128);
+        if(i / 128 < banks.size())
+        {
+            r.bankMsb = banks[i / 128].msb;
+            r.bankLsb = banks[i / 128].lsb;
+        }
+        r.noteOffset1 = ins.note_offset1;
+        r.noteOffset2 = ins.note_offset2;
+        r.msSoundKon = ins.ms_sound_kon;
+        r.msSoundKoff = ins.ms_sound_koff;
+        r.file = fileIndex;
+        r.hash = hashes[i];
+        out.push_back(r);
+    }
+}
+
+/**
+ * @brief Load the file by any bank or instrument format
+ * @return false if no format can load it
+ */
+static bool parseFile(const QByteArray &data, const QString &path, FmBank &bank, FmBankLibrary::FileRecord &rec)
+{
+    BankFormats format = BankFormats::FORMAT_UNKNOWN;
+    FfmtErrCode err = FmBankFormatFactory::OpenBankData(data, path, bank, &format);
+    if(err == FfmtErrCode::ERR_UNSUPPORTED_FORMAT)
+        err = FmBankFormatFactory::ImportBankData(data, path, bank, &format);
+    if(err == FfmtErrCode::ERR_OK)
+    {
+        rec.format = int32_t(format);
+        return true;
+    }
+
+    FmBank::Instrument ins = FmBank::emptyInst();
+    InstFormats instFormat = InstFormats::FORMAT_INST_UNKNOWN;
+    bool isDrum = false;
+    err = FmBankFormatFactory::OpenInstrumentData(data, path, ins, &instFormat, &isDrum, false);
+    if(err == FfmtErrCode::ERR_UNSUPPORTED_FORMAT)
+        err = FmBankFormatFactory::OpenInstrumentData(data, path, ins, &instFormat, &isDrum, true);
+    if(err != FfmtErrCode::ERR_OK)
+        return false;
+
+    bank.reset();
+    bank.Ins_Melodic_box.clear();
+    bank.Ins_Percussion_box.clear();
+    if(isDrum)
+        bank.Ins_Percussion_box.push_back(ins);
+    else
+        bank.Ins_Melodic_box.push_back(ins);
+    rec.format = int32_t(instFormat);
+    rec.flags |= FmBankLibrary::FILE_INSTRUMENT;
+    return true;
+}
+
+static uint64_t contentHash(const QByteArray &data)
+{
+    QByteArray sum = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+    uint64_t h = 0;
+    memcpy(&h, sum.constData(), sizeof(h));
+    return h;
+}
+
+static QStringList libraryMasks()
+{
+    QStringList masks;
+    const int caps = int(FormatCaps::FORMAT_CAPS_OPEN) | int(FormatCaps::FORMAT_CAPS_IMPORT);
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allBankFormats())
+    {
+        if((f->formatCaps() & caps) == 0)
+            continue;
+        for(const QString &mask : f->formatExtensionMask().split(' '))
+        {
+            if(!mask.isEmpty() && !masks.contains(mask, Qt::CaseInsensitive))
+                masks.push_back(mask);
+        }
+    }
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allInstrumentFormats())
+    {
+        if((f->formatInstCaps() & caps) == 0)
+            continue;
+        for(const QString &mask : f->formatInstExtensionMask().split(' '))
+        {
+            if(!mask.isEmpty() && !masks.contains(mask, Qt::CaseInsensitive))
+                masks.push_back(mask);
+        }
+    }
+    return masks;
+}
+
+static QStringList archiveMasks()
+{
+    // The gzip-wrapped banks are unpacked by the factory
+    return QStringList() << "*.zip" << "*.gz";
+}
+
+FfmtErrCode FmBankLibrary::update(UpdateStats *stats)
+{
+    return replaceStore(scan(stats));
+}
+
+QByteArray FmBankLibrary::scan(UpdateStats *stats) const
+{
+    UpdateStats st;
+    QDir root(m_rootDir);
+
+    const QStringList masks = libraryMasks();
+    QStringList found;
+    QDirIterator it(m_rootDir, masks + archiveMasks(), QDir::Files, QDirIterator::Subdirectories);
+    const QString storeAbs = QFileInfo(m_storePath).absoluteFilePath();
+    while(it.hasNext())
+    {
+        QString path = it.next();
+        if(QFileInfo(path).absoluteFilePath() != storeAbs)
+            found.push_back(root.relativeFilePath(path));
+    }
+    found.sort();
+
+    QHash<QString, int> oldFiles;
+    for(int i = 0; i < m_filesCount; i++)
+        oldFiles.insert(filePath(i), i);
+
+    QVector<FileRecord> files;
+    QVector<InstrumentRecord> instruments;
+    QByteArray strings;
+    files.reserve(found.size());
+    instruments.reserve(m_count);
+
+    /*
+     * Record one file. The data is read by the loader only when the file
+     * can't be taken from the current store. Known hash allows to check the
+     * content without reading the file.
+     */
+    auto addFile = [&](const QString &rel, const QString &fileName, qint64 size, qint64 mtime,
+                       uint64_t knownHash, const std::function<bool(QByteArray &)> &load)
+    {
+        QByteArray relUtf8 = rel.toUtf8();
+
+        FileRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.pathOffset = uint32_t(strings.size());
+        rec.pathSize = uint32_t(relUtf8.size());
+        rec.size = size;
+        rec.mtime = mtime;
+        rec.firstInstrument = uint32_t(instruments.size());
+
+        const uint32_t fileIndex = uint32_t(files.size());
+        auto old = oldFiles.find(rel);
+        const FileRecord *prev = (old != oldFiles.end()) ? &m_files[old.value()] : nullptr;
+        bool reuse = prev && prev->size == rec.size && prev->mtime == rec.mtime;
+
+        QByteArray data;
+        if(reuse)
+        {
+            rec.contentHash = prev->contentHash;
+            st.unchanged++;
+        }
+        else if(knownHash != 0)
+        {
+            rec.contentHash = knownHash;
+            reuse = prev && prev->size == rec.size && prev->contentHash == rec.contentHash;
+            if(reuse)
+                st.sameContent++;
+            else if(!load(data))
+                return;
+        }
+        else
+        {
+            if(!load(data))
+                return;
+            rec.contentHash = contentHash(data);
+            reuse = prev && prev->size == rec.size && prev->contentHash == rec.contentHash;
+            if(reuse)
+                st.sameContent++;
+        }
+
+        if(reuse)
+        {
+            rec.format = prev->format;
+            rec.flags = prev->flags;
+            for(uint32_t i = 0; i < prev->instrumentsCount; i++)
+            {
+                InstrumentRecord r = m_instruments[prev->firstInstrument + i];
+                r.file = fileIndex;
+                instruments.push_back(r);
+            }
+        }
+        else
+        {
+            FmBank bank;
+            if(parseFile(data, fileName, bank, rec))
+            {
+                fillRecords(bank, false, fileIndex, instruments);
+                fillRecords(bank, true, fileIndex, instruments);
+                st.parsed++;
+            }
+            else
+            {
+                rec.format = -1;
+                rec.flags |= FILE_FAILED;
+                st.failed++;
+            }
+        }
+
+        rec.instrumentsCount = uint32_t(instruments.size()) - rec.firstInstrument;
+        strings.append(relUtf8);
+        files.push_back(rec);
+        oldFiles.remove(rel);
+    };
+
+    for(const QString &rel : found)
+    {
+        QFileInfo info(root.filePath(rel));
+        const QString path = info.absoluteFilePath();
+
+        if(FmBankArchive::isZipFile(path))
+        {
+            // Only the central directory is read, entries are inflated when they have to be parsed
+            FmBankArchive archive;
+            if(archive.open(path) != FfmtErrCode::ERR_OK)
+                continue;
+
+            const QVector<FmBankArchive::Entry> &entries = archive.entries();
+            for(int i = 0; i < entries.size(); i++)
+            {
+                const FmBankArchive::Entry &e = entries[i];
+                if(e.isDir() || !QDir::match(masks, QFileInfo(e.name).fileName()))
+                    continue;
+                // CRC-32 of the entry is used as the content hash, the marker bit keeps it non-zero
+                addFile(rel + '/' + e.name, e.name, e.size, e.mtime, uint64_t(e.crc32) | (uint64_t(1) << 32),
+                        [&archive, i](QByteArray &data)
+                        {
+                            return archive.read(i, data) == FfmtErrCode::ERR_OK;
+                        });
+            }
+            continue;
+        }
+
+        addFile(rel, path, info.size(), info.lastModified().toMSecsSinceEpoch(), 0,
+                [&path](QByteArray &data)
+                {
+                    QFile f(path);
+                    if(!f.open(QIODevice::ReadOnly))
+                        return false;
+                    data = f.readAll();
+                    return true;
+                });
+    }
+
+    st.files = files.size();
+    st.removed = oldFiles.size();
+    st.instruments = instruments.size();
+
+    LibraryHeader head;
+    memset(&head, 0, sizeof(head));
+    memcpy(head.magic, library_magic, 8);
+    head.version = library_version;
+    head.byteOrder = library_byte_order;
+    head.filesCount = uint32_t(files.size());
+    head.instrumentsCount = uint32_t(instruments.size());
+    head.filesOffset = sizeof(LibraryHeader);
+    head.instrumentsOffset = head.filesOffset + uint32_t(files.size() * sizeof(FileRecord));
+    head.stringsOffset = head.instrumentsOffset + uint32_t(instruments.size() * sizeof(InstrumentRecord));
+    head.stringsSize = uint32_t(strings.size());
+
+    QByteArray out;
+    out.reserve(int(head.stringsOffset + head.stringsSize));
+    out.append(reinterpret_cast<const char *>(&head), sizeof(head));
+    out.append(reinterpret_cast<const char *>(files.constData()), int(files.size() * sizeof(FileRecord)));
+    out.append(reinterpret_cast<const char *>(instruments.constData()), int(instruments.size() * sizeof(InstrumentRecord)));
+    out.append(strings);
+
+    if(stats)
+        *stats = st;
+    return out;
+}
+
+FfmtErrCode FmBankLibrary::replaceStore(const QByteArray &data)
+{
+    // Mapped file can't be replaced on some systems
+    QString rootDir = m_rootDir, storePath = m_storePath;
+    close();
+    m_rootDir = rootDir;
+    m_storePath = storePath;
+
+    FfmtErrCode err = FmBankFormatBase::writeFileData(m_storePath, data);
+    if(err != FfmtErrCode::ERR_OK || !mapStore())
+    {
+        // Keep the catalog usable from the memory
+        m_data = data;
+        if(!attachData())
+            return FfmtErrCode::ERR_BADFORMAT;
+    }
+
+    return err;
+}
+
+/* ******** Access ******** */
+
+FmBank::Instrument FmBankLibrary::instrument(int i) const
+{
+    const InstrumentRecord &r = m_instruments[i];
+    FmBank::Instrument ins = FmBank::emptyInst();
+
+    memcpy(ins.name, r.name, NameSize);
+    for(int op = 0; op < 4; op++)
+    {
+        ins.setAVEKM(op,    r.regs[FmBankPacked::opReg(op, FmBankPacked::REG_AVEKM)]);
+        ins.setKSLL(op,     r.regs[FmBankPacked::opReg(op, FmBankPacked::REG_KSLL)]);
+        ins.setAtDec(op,    r.regs[FmBankPacked::opReg(op, FmBankPacked::REG_ATDEC)]);
+        ins.setSusRel(op,   r.regs[FmBankPacked::opReg(op, FmBankPacked::REG_SUSREL)]);
+        ins.setWaveForm(op, r.regs[FmBankPacked::opReg(op, FmBankPacked::REG_WAVE)]);
+    }
+    ins.setFBConn1(r.regs[FmBankPacked::REG_FBCONN1]);
+    ins.setFBConn2(r.regs[FmBankPacked::REG_FBCONN2]);
+
+    ins.en_4op = (r.flags & FmBankPacked::FLAG_4OP) != 0;
+    ins.en_pseudo4op = (r.flags & FmBankPacked::FLAG_PSEUDO4OP) != 0;
+    ins.is_fixed_note = (r.flags & FmBankPacked::FLAG_FIXED_NOTE) != 0;
+    ins.percNoteNum = r.percNoteNum;
+    ins.fine_tune = r.fineTune;
+    ins.velocity_offset = r.velocityOffset;
+    ins.rhythm_drum_type = r.drumType;
+    ins.note_offset1 = r.noteOffset1;
+    ins.note_offset2 = r.noteOffset2;
+    ins.ms_sound_kon = r.msSoundKon;
+    ins.ms_sound_koff = r.msSoundKoff;
+    return ins;
+}
+
+static inline char asciiLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+/**
+ * @brief ASCII case-insensitive search of the lowered needle in the text
+ */
+static bool containsLowered(const char *text, int textSize, const QByteArray &needle)
+{
+    const int n = needle.size();
+    const char *nd = needle.constData();
+    for(int i = 0; i + n <= textSize; i++)
+    {
+        if(asciiLower(text[i]) != nd[0])
+            continue;
+        int j = 1;
+        while(j < n && asciiLower(text[i + j]) == nd[j])
+            j++;
+        if(j == n)
+            return true;
+    }
+    return false;
+}
+
+QVector<int> FmBankLibrary::search(const QString &text, int limit) const
+{
+    QVector<int> out;
+    QByteArray needle = text.toUtf8();
+    for(int i = 0; i < needle.size(); i++)
+        needle[i] = asciiLower(needle[i]);
+
+    if(needle.isEmpty())
+    {
+        int n = (limit >= 0) ? qMin(limit, m_count) : m_count;
+        out.reserve(n);
+        for(int i = 0; i < n; i++)
+            out.push_back(i);
+        return out;
+    }
+
+    const char *str = strings();
+    for(int f = 0; f < m_filesCount; f++)
+    {
+        const FileRecord &file = m_files[f];
+        bool fileMatch = containsLowered(str + file.pathOffset, int(file.pathSize), needle);
+
+        for(uint32_t k = 0; k < file.instrumentsCount; k++)
+        {
+            int i = int(file.firstInstrument + k);
+            const InstrumentRecord &r = m_instruments[i];
+            if(fileMatch || containsLowered(r.name, int(strnlen(r.name, NameSize)), needle))
+            {
+                out.push_back(i);
+                if(limit >= 0 && out.size() >= limit)
+                    return out;
+            }
+        }
+    }
+
+    return out;
+}
+
+QVector<int> FmBankLibrary::findSound(const FmBank::Instrument &ins) const
+{
+    QVector<int> out;
+
+    FmBank::InsStorage one;
+    one.push_back(ins);
+    FmBankPacked packed(one);
+    QVector<uint32_t> hashes;
+    packed.hashes(hashes);
+
+    const uint8_t modeMask = FmBankPacked::FLAG_4OP | FmBankPacked::FLAG_PSEUDO4OP;
+    for(int i = 0; i < m_count; i++)
+    {
+        const InstrumentRecord &r = m_instruments[i];
+        if(r.hash != hashes[0])
+            continue;
+
+        // Verify the match, hashes may collide
+        bool same = (r.flags & modeMask) == (packed.flags()[0] & modeMask) &&
+                    r.percNoteNum == ins.percNoteNum &&
+                    r.fineTune == ins.fine_tune &&
+                    r.noteOffset1 == ins.note_offset1 &&
+                    r.noteOffset2 == ins.note_offset2 &&
+                    r.velocityOffset == ins.velocity_offset;
+        for(int c = 0; c < FmBankPacked::RegsCount && same; c++)
+            same = r.regs[c] == packed.column(c)[0];
+        if(same)
+            out.push_back(i);
+    }
+
+    return out;
+}
+
+void FmBankLibrary::toBank(const QVector<int> &indices, FmBank &bank) const
+{
+    bank.reset();
+    bank.Ins_Melodic_box.clear();
+    bank.Ins_Percussion_box.clear();
+
+    for(int i : indices)
+    {
+        if(i < 0 || i >= m_count)
+            continue;
+        if(isDrum(i))
+            bank.Ins_Percussion_box.push_back(instrument(i));
+        else
+            bank.Ins_Melodic_box.push_back(instrument(i));
+    }
+}
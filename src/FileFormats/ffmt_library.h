@@ -0,0 +1,225 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FFMT_LIBRARY_H
+#define FFMT_LIBRARY_H
+
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+#include "../bank.h"
+#include "../bank_packed.h"
+#include "ffmt_enums.h"
+
+class QFile;
+
+/**
+ * @brief Catalog of all instruments of banks and instrument files in the directory
+ *
+ * The catalog is kept in the store file, which is mapped into the memory and
+ * used right as is: instruments are fixed-size records with raw register
+ * bytes, names, MIDI identifiers, measured delays and hashes of the sound.
+ * The store is a local cache in the byte order of the host, a store which
+ * can't be used is simply rebuilt.
+ *
+ * The update re-scans the directory and parses only new and changed files,
+ * records of other files are copied from the current store. Files with the
+ * same size and modification time are assumed unchanged, and files with a
+ * different time but the same content hash are not parsed again.
+ *
+ * Banks in ZIP archives are recorded entry by entry, as "archive.zip/entry"
+ * paths. CRC-32 of entries is their content hash, so unchanged entries are
+ * not even unpacked.
+ */
+class FmBankLibrary
+{
+public:
+    enum { NameSize = 32 };
+
+    enum FileFlags
+    {
+        //! File is a single instrument
+        FILE_INSTRUMENT = 0x01,
+        //! File can't be loaded by any format, it's kept to not parse it again
+        FILE_FAILED     = 0x02
+    };
+
+    enum InstrumentFlags
+    {
+        //! Instrument is in the percussion bank (FmBankPacked::Flags are in lower bits)
+        INS_PERCUSSION  = 0x80
+    };
+
+    struct FileRecord
+    {
+        //! Path relative to the root directory, UTF-8 in the strings area
+        uint32_t pathOffset;
+        uint32_t pathSize;
+        int64_t  size;
+        //! Modification time, milliseconds since epoch
+        int64_t  mtime;
+        uint64_t contentHash;
+        //! BankFormats or InstFormats value, depending on flags
+        int32_t  format;
+        uint32_t flags;
+        uint32_t firstInstrument;
+        uint32_t instrumentsCount;
+    };
+
+    struct InstrumentRecord
+    {
+        //! Name, not terminated when it takes all bytes
+        char     name[NameSize];
+        //! Register bytes, indexed like columns of FmBankPacked
+        uint8_t  regs[FmBankPacked::RegsCount];
+        uint8_t  flags;
+        uint8_t  percNoteNum;
+        int8_t   fineTune;
+        int8_t   velocityOffset;
+        uint8_t  drumType;
+        //! MIDI program, and the bank which has the instrument
+        uint8_t  program;
+        uint8_t  bankMsb;
+        uint8_t  bankLsb;
+        uint8_t  reserved[2];
+        int16_t  noteOffset1;
+        int16_t  noteOffset2;
+        uint16_t msSoundKon;
+        uint16_t msSoundKoff;
+        uint32_t file;
+        //! Hash of the sound, see FmBankPacked::hashes()
+        uint32_t hash;
+    };
+
+    struct UpdateStats
+    {
+        int files = 0;
+        //! Files which were taken from the store without reading
+        int unchanged = 0;
+        //! Files which were read, but had the same content
+        int sameContent = 0;
+        int parsed = 0;
+        int failed = 0;
+        int removed = 0;
+        int instruments = 0;
+    };
+
+    FmBankLibrary();
+    ~FmBankLibrary();
+
+    /**
+     * @brief Default name of the store file in the root directory
+     */
+    static QString defaultStoreName();
+
+    /**
+     * @brief Open the catalog of the directory
+     * @param rootDir Directory with banks
+     * @param storePath Path to the store, in the root directory by default
+     * @return false if the store is missing or can't be used, the catalog is empty then until update()
+     */
+    bool open(const QString &rootDir, const QString &storePath = QString());
+    void close();
+
+    inline QString rootDir() const   { return m_rootDir; }
+    inline QString storePath() const { return m_storePath; }
+
+    /**
+     * @brief Scan the root directory and update the store
+     * @param stats unless null, receives counts of processed files
+     * @return ERR_NOFILE if the store can't be written
+     */
+    FfmtErrCode update(UpdateStats *stats = nullptr);
+
+    /**
+     * @brief Scan the root directory and make the data of the new store
+     *
+     * The catalog itself is not changed, so the scan may run in another
+     * thread while the catalog is searched. The result is put in use by
+     * replaceStore(), which must not be called while the scan is running.
+     *
+     * @param stats unless null, receives counts of processed files
+     * @return data of the store
+     */
+    QByteArray scan(UpdateStats *stats = nullptr) const;
+
+    /**
+     * @brief Write the store data and use it
+     * @param data Data of the store made by scan()
+     * @return ERR_NOFILE if the store can't be written, the catalog is kept in the memory then,
+     *         ERR_BADFORMAT if data is not a valid store
+     */
+    FfmtErrCode replaceStore(const QByteArray &data);
+
+    int filesCount() const;
+    const FileRecord &file(int i) const;
+    //! Path to the file, relative to the root directory
+    QString filePath(int i) const;
+
+    int count() const;
+    const InstrumentRecord &record(int i) const;
+    QString name(int i) const;
+    inline bool isDrum(int i) const { return (record(i).flags & INS_PERCUSSION) != 0; }
+
+    /**
+     * @brief Make the full instrument from the record
+     * @param i Index of the instrument
+     */
+    FmBank::Instrument instrument(int i) const;
+
+    /**
+     * @brief Find instruments by the text
+     * @param text Case-insensitive text to find in names of instruments or in paths of their files
+     * @param limit Maximal count of results, -1 for no limit
+     * @return indices of found instruments
+     */
+    QVector<int> search(const QString &text, int limit = -1) const;
+
+    /**
+     * @brief Find instruments which are producing the same sound as given one
+     * @param ins Instrument to find
+     * @return indices of instruments with equal registers, mode flags and note parameters
+     */
+    QVector<int> findSound(const FmBank::Instrument &ins) const;
+
+    /**
+     * @brief Put instruments into the bank, melodic and percussion ones are kept apart
+     * @param indices Indices of instruments
+     * @param bank Destination bank
+     */
+    void toBank(const QVector<int> &indices, FmBank &bank) const;
+
+private:
+    bool mapStore();
+    //! Check the store data and point records into it
+    bool attachData();
+    const char *strings() const;
+
+    QString     m_rootDir;
+    QString     m_storePath;
+    //! Store data, refers to the mapped memory when the store file is mapped
+    QByteArray  m_data;
+    QFile      *m_mapped = nullptr;
+
+    const FileRecord        *m_files = nullptr;
+    const InstrumentRecord  *m_instruments = nullptr;
+    int m_filesCount = 0;
+    int m_count = 0;
+};
+
+#endif // FFMT_LIBRARY_H
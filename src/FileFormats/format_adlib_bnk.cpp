@@ -61,9 +61,11 @@ public:
         BNK_HMI
     };
     static bool detectBank(char *magic);
-    static bool detectInst(QString filePath);
-    static FfmtErrCode loadBankFile(QString filePath, FmBank &bank, BankFormats &format);
-    static FfmtErrCode saveBankFile(QString filePath, FmBank &bank, BnkType type, bool hmiIsDrum);
+    static bool detectInst(const QString &filePath, QIODevice &file);
+    static FfmtErrCode loadBankFile(QIODevice &file, FmBank &bank, BankFormats &format);
+    static FfmtErrCode saveBankFile(QIODevice &file, FmBank &bank, BnkType type, bool hmiIsDrum);
+    static uint16_t savedInstruments(const FmBank &bank, BnkType type, bool hmiIsDrum);
+    static qint64 saveBankSize(const FmBank &bank, BnkType type, bool hmiIsDrum);
 };
 
 bool AdLibBnk_impl::detectBank(char *magic)
@@ -75,13 +77,9 @@ bool AdLibBnk_impl::detectBank(char *magic)
     return ret;
 }
 
-bool AdLibBnk_impl::detectInst(QString filePath)
+bool AdLibBnk_impl::detectInst(const QString &filePath, QIODevice &file)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
+    qint64 fileSize = file.size();
     /*
      * Need to check both conditions, because some other files with "ins" extension are been used
      * Unfortunately, AdLib INS files has no magic number
@@ -91,18 +89,13 @@ bool AdLibBnk_impl::detectInst(QString filePath)
     return hasExt(filePath, ".ins") && ((fileSize == 80) || (fileSize == 54));
 }
 
-FfmtErrCode AdLibBnk_impl::loadBankFile(QString filePath, FmBank &bank, BankFormats &format)
+FfmtErrCode AdLibBnk_impl::loadBankFile(QIODevice &file, FmBank &bank, BankFormats &format)
 {
     char magic[8];
     memset(magic, 0, 8);
     format = BankFormats::FORMAT_ADLIB_BKN1;
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     QByteArray fileData  = file.readAll();
-    file.close();
 
     bool        isHMI = false;
 
@@ -201,14 +194,12 @@ FfmtErrCode AdLibBnk_impl::loadBankFile(QString filePath, FmBank &bank, BankForm
                 FmBank::Instrument ins = FmBank::emptyInst();
                 bank.Ins_Melodic_box.push_back(ins);
                 ins_m = &bank.Ins_Melodic_box.last();
-                bank.Ins_Melodic = bank.Ins_Melodic_box.data();
             }
             else
             {
                 FmBank::Instrument ins = FmBank::emptyInst();
                 bank.Ins_Percussion_box.push_back(ins);
                 ins_m = &bank.Ins_Percussion_box.last();
-                bank.Ins_Percussion = bank.Ins_Percussion_box.data();
             }
         }
         else
@@ -217,8 +208,6 @@ FfmtErrCode AdLibBnk_impl::loadBankFile(QString filePath, FmBank &bank, BankForm
             FmBank::Instrument ins = FmBank::emptyInst();
             bank.Ins_Melodic_box.push_back(ins);
             bank.Ins_Percussion_box.push_back(ins);
-            bank.Ins_Melodic    = bank.Ins_Melodic_box.data();
-            bank.Ins_Percussion = bank.Ins_Percussion_box.data();
             ins_m = &bank.Ins_Melodic_box.last();
             ins_p = &bank.Ins_Percussion_box.last();
         }
@@ -321,12 +310,23 @@ FfmtErrCode AdLibBnk_impl::loadBankFile(QString filePath, FmBank &bank, BankForm
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode AdLibBnk_impl::saveBankFile(QString filePath, FmBank &bank, BnkType type, bool hmiIsDrum)
+uint16_t AdLibBnk_impl::savedInstruments(const FmBank &bank, BnkType type, bool hmiIsDrum)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
+    bool isHMI = (type == BNK_HMI);
+    uint16_t instMax = isHMI ? 128 : 65515;
+    uint32_t insts   = isHMI ?
+                        uint32_t(hmiIsDrum ? bank.Ins_Percussion_box.size() : bank.Ins_Melodic_box.size()) :
+                        uint32_t(bank.Ins_Melodic_box.size() + bank.Ins_Percussion_box.size());
+    return insts > instMax ? instMax : uint16_t(insts);
+}
 
+qint64 AdLibBnk_impl::saveBankSize(const FmBank &bank, BnkType type, bool hmiIsDrum)
+{
+    return 28 + qint64(SIZEOF_NAME + SIZEOF_INST) * savedInstruments(bank, type, hmiIsDrum);
+}
+
+FfmtErrCode AdLibBnk_impl::saveBankFile(QIODevice &file, FmBank &bank, BnkType type, bool hmiIsDrum)
+{
     uint8_t ver[2] = { 1, 0 };
 
     bool isHMI = false;
@@ -352,11 +352,7 @@ FfmtErrCode AdLibBnk_impl::saveBankFile(QString filePath, FmBank &bank, BnkType
     //    char  magic[6];
     file.write(char_p(bnk_magic), 6);   //2..7
 
-    uint16_t instMax = isHMI ? 128 : 65515;
-    uint32_t insts   = isHMI ?
-                        uint32_t(hmiIsDrum ? bank.Ins_Percussion_box.size() : bank.Ins_Melodic_box.size()) :
-                        uint32_t(bank.Ins_Melodic_box.size() + bank.Ins_Percussion_box.size());
-    uint16_t instsU = insts > instMax ? instMax : uint16_t(insts);
+    uint16_t instsU = savedInstruments(bank, type, hmiIsDrum);
     uint16_t instsS = instsU;
     uint32_t nameAddress = 28;
     uint32_t dataAddress = 28 + SIZEOF_NAME * instsS;
@@ -399,9 +395,9 @@ FfmtErrCode AdLibBnk_impl::saveBankFile(QString filePath, FmBank &bank, BnkType
     {
         InstrName inst;
         bool isDrum = isHMI ? hmiIsDrum : (bank.Ins_Melodic_box.size() <= ins);
-        FmBank::Instrument &Ins = isDrum ?
-                                  bank.Ins_Percussion_box[ isHMI ? ins : (ins - bank.Ins_Melodic_box.size()) ] :
-                                  bank.Ins_Melodic_box[ ins ];
+        const FmBank::Instrument &Ins = isDrum ?
+                                  bank.Ins_Percussion_box.at( isHMI ? ins : (ins - bank.Ins_Melodic_box.size()) ) :
+                                  bank.Ins_Melodic_box.at( ins );
         strncpy(inst.name, Ins.name, 8);
         if(inst.name[0] == '\0')
         {
@@ -461,9 +457,9 @@ FfmtErrCode AdLibBnk_impl::saveBankFile(QString filePath, FmBank &bank, BnkType
     for(uint16_t ins = 0; ins < instsS; ins++)
     {
         bool isDrum = isHMI ? hmiIsDrum : (bank.Ins_Melodic_box.size() <= ins);
-        FmBank::Instrument &Ins = isDrum ?
-                                  bank.Ins_Percussion_box[ isHMI ? ins : (ins - bank.Ins_Melodic_box.size()) ] :
-                                  bank.Ins_Melodic_box[ ins ];
+        const FmBank::Instrument &Ins = isDrum ?
+                                  bank.Ins_Percussion_box.at( isHMI ? ins : (ins - bank.Ins_Melodic_box.size()) ) :
+                                  bank.Ins_Melodic_box.at( ins );
 
         //struct BNK_OPLRegs
         //{
@@ -596,22 +592,25 @@ FfmtErrCode AdLibBnk_impl::saveBankFile(QString filePath, FmBank &bank, BnkType
         //} __attribute__((__packed__));
     }
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
 
 
-bool AdLibAndHmiBnk_reader::detect(const QString &, char *magic)
+bool AdLibAndHmiBnk_reader::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return AdLibBnk_impl::detectBank(magic);
 }
 
-FfmtErrCode AdLibAndHmiBnk_reader::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode AdLibAndHmiBnk_reader::loadDevice(QIODevice &file, FmBank &bank)
+{
+    BankFormats format;
+    return AdLibBnk_impl::loadBankFile(file, bank, format);
+}
+
+FfmtErrCode AdLibAndHmiBnk_reader::loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format)
 {
-    m_recentFormat = BankFormats::FORMAT_UNKNOWN;
-    return AdLibBnk_impl::loadBankFile(filePath, bank, m_recentFormat);
+    return AdLibBnk_impl::loadBankFile(file, bank, format);
 }
 
 int AdLibAndHmiBnk_reader::formatCaps() const
@@ -636,14 +635,15 @@ QString AdLibAndHmiBnk_reader::formatExtensionMask() const
 
 BankFormats AdLibAndHmiBnk_reader::formatId() const
 {
-    return m_recentFormat;
+    // Variant of the loaded data is given by loadDeviceFormat()
+    return BankFormats::FORMAT_UNKNOWN;
 }
 
 
 
-bool AdLibAndHmiBnk_reader::detectInst(const QString &filePath, char *)
+bool AdLibAndHmiBnk_reader::detectInstDevice(const QString &filePath, QIODevice &file, char *)
 {
-    return AdLibBnk_impl::detectInst(filePath);
+    return AdLibBnk_impl::detectInst(filePath, file);
 }
 
 /**
@@ -698,16 +698,12 @@ void adlib_ins_opToRawIns(const FmBank::Instrument &inst, const int opType, uint
         odata[24] = (!inst.connection1) & 0x01;
 }
 
-FfmtErrCode AdLibAndHmiBnk_reader::loadFileInst(QString filePath, FmBank::Instrument &inst, bool *)
+FfmtErrCode AdLibAndHmiBnk_reader::loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *)
 {
     memset(&inst, 0, sizeof(FmBank::Instrument));
-    QFile file(filePath);
     uint8_t idata[80];
     memset(&idata, 0, 80);
 
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     qint64 fileSize = file.bytesAvailable();
     if((fileSize == 80) && file.read(char_p(idata), 80) != 80)
         return FfmtErrCode::ERR_BADFORMAT;
@@ -753,20 +749,17 @@ FfmtErrCode AdLibAndHmiBnk_reader::loadFileInst(QString filePath, FmBank::Instru
 
     if(inst.name[0] == '\0')
     {
-        QFileInfo i(filePath);
+        QFileInfo i(deviceFileName(file));
         strncpy(inst.name, i.baseName().toUtf8().data(), 32);
     }
 
     //bytes 78 and 79 can be ignored
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode AdLibAndHmiBnk_reader::saveFileInst(QString filePath, FmBank::Instrument &inst, bool)
+FfmtErrCode AdLibAndHmiBnk_reader::saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool)
 {
-    QFile file(filePath);
-
     uint8_t odata[80];
     memset(&odata, 0, 80);
 
@@ -785,11 +778,8 @@ FfmtErrCode AdLibAndHmiBnk_reader::saveFileInst(QString filePath, FmBank::Instru
     strncpy(char_p(odata + 58), inst.name, 19);
     #endif
 
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
     if(file.write(char_p(&odata), 80) != 80)
         return FfmtErrCode::ERR_BADFORMAT;
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -828,9 +818,14 @@ InstFormats AdLibAndHmiBnk_reader::formatInstId() const
 
 
 
-FfmtErrCode AdLibBnk_writer::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode AdLibBnk_writer::saveDevice(QIODevice &file, FmBank &bank)
 {
-    return AdLibBnk_impl::saveBankFile(filePath, bank, AdLibBnk_impl::BNK_ADLIB, false);
+    return AdLibBnk_impl::saveBankFile(file, bank, AdLibBnk_impl::BNK_ADLIB, false);
+}
+
+qint64 AdLibBnk_writer::saveSize(const FmBank &bank) const
+{
+    return AdLibBnk_impl::saveBankSize(bank, AdLibBnk_impl::BNK_ADLIB, false);
 }
 
 int AdLibBnk_writer::formatCaps() const
@@ -867,9 +862,14 @@ BankFormats AdLibBnk_writer::formatId() const
 
 
 
-FfmtErrCode HmiBnk_writer::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode HmiBnk_writer::saveDevice(QIODevice &file, FmBank &bank)
+{
+    return AdLibBnk_impl::saveBankFile(file, bank, AdLibBnk_impl::BNK_HMI, false);
+}
+
+qint64 HmiBnk_writer::saveSize(const FmBank &bank) const
 {
-    return AdLibBnk_impl::saveBankFile(filePath, bank, AdLibBnk_impl::BNK_HMI, false);
+    return AdLibBnk_impl::saveBankSize(bank, AdLibBnk_impl::BNK_HMI, false);
 }
 
 int HmiBnk_writer::formatCaps() const
@@ -906,9 +906,14 @@ BankFormats HmiBnk_writer::formatId() const
 
 
 
-FfmtErrCode HmiBnk_Drums_writer::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode HmiBnk_Drums_writer::saveDevice(QIODevice &file, FmBank &bank)
+{
+    return AdLibBnk_impl::saveBankFile(file, bank, AdLibBnk_impl::BNK_HMI, true);
+}
+
+qint64 HmiBnk_Drums_writer::saveSize(const FmBank &bank) const
 {
-    return AdLibBnk_impl::saveBankFile(filePath, bank, AdLibBnk_impl::BNK_HMI, true);
+    return AdLibBnk_impl::saveBankSize(bank, AdLibBnk_impl::BNK_HMI, true);
 }
 
 int HmiBnk_Drums_writer::formatCaps() const
@@ -23,19 +23,19 @@
 
 class AdLibAndHmiBnk_reader final : public FmBankFormatBase
 {
-    BankFormats m_recentFormat = BankFormats::FORMAT_UNKNOWN;
 public:
-    bool detect(const QString &filePath, char* magic) override;
-    FfmtErrCode  loadFile(QString filePath, FmBank &bank) override;
+    bool detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode  loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode  loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format) override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
     QString formatExtensionMask() const override;
     BankFormats formatId() const override;
 
-    bool        detectInst(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0) override;
-    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = 0) override;
+    FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false) override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstModuleName() const override;
@@ -47,7 +47,8 @@ public:
 class AdLibBnk_writer final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -59,7 +60,8 @@ public:
 class HmiBnk_writer final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode  saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode  saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -71,7 +73,8 @@ public:
 class HmiBnk_Drums_writer final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode  saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode  saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -20,7 +20,7 @@
 #include "../common.h"
 
 
-bool AdLibTimbre::detect(const QString &filePath, char *magic)
+bool AdLibTimbre::detectDevice(const QString &filePath, QIODevice &file, char *magic)
 {
     if(hasExt(filePath, ".tim") || hasExt(filePath, ".snd"))
         return true;
@@ -29,12 +29,7 @@ bool AdLibTimbre::detect(const QString &filePath, char *magic)
     uint16_t instruments_count = 0;
     uint16_t instruments_offset = 0;
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-
-    uint64_t fileSize = uint64_t(file.bytesAvailable());
-    file.close();
+    uint64_t fileSize = uint64_t(file.size());
 
     uint8_t *head = reinterpret_cast<uint8_t*>(magic);
     if((head[0] != 1) || (head[1] != 0))
@@ -72,12 +67,8 @@ extern bool adlib_ins_insRawToOp(FmBank::Instrument &inst, const int opType, con
 extern void adlib_ins_opToRawIns(const FmBank::Instrument &inst, const int opType, uint8_t *odata);
 //In the format_adlib_bnk
 
-FfmtErrCode AdLibTimbre::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode AdLibTimbre::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     uint64_t fileSize = uint64_t(file.bytesAvailable());
 
     bank.reset();
@@ -122,15 +113,13 @@ FfmtErrCode AdLibTimbre::loadFile(QString filePath, FmBank &bank)
         return FfmtErrCode::ERR_BADFORMAT;
 
     bank.Ins_Percussion_box.clear();
-    bank.Ins_Percussion = bank.Ins_Percussion_box.data();
 
     bank.Ins_Melodic_box.resize(instruments_count);
-    bank.Ins_Melodic = bank.Ins_Melodic_box.data();
 
     uint8_t idata[56];
     for(uint16_t i = 0; i < instruments_count; i++)
     {
-        FmBank::Instrument &ins = bank.Ins_Melodic[i];
+        FmBank::Instrument &ins = bank.Ins_Melodic_box[i];
         if(file.read(char_p(idata), 56) != 56)
         {
             bank.reset();
@@ -150,7 +139,6 @@ FfmtErrCode AdLibTimbre::loadFile(QString filePath, FmBank &bank)
         ins.setWaveForm(CARRIER1,      idata[54]);
         strncpy(ins.name, instrument_names + (9 * i), 8);
     }
-    file.close();
 
     //Automatically create missing banks
     bank.autocreateMissingBanks();
@@ -158,12 +146,8 @@ FfmtErrCode AdLibTimbre::loadFile(QString filePath, FmBank &bank)
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode AdLibTimbre::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode AdLibTimbre::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     uint8_t head[6];
     memset(head, 0, 6);
     head[0] = 1;
@@ -179,7 +163,7 @@ FfmtErrCode AdLibTimbre::saveFile(QString filePath, FmBank &bank)
     char ins_name[9];
     for(uint16_t i = 0; i < ins_count; i++)
     {
-        FmBank::Instrument &ins = bank.Ins_Melodic[i];
+        const FmBank::Instrument &ins = bank.Ins_Melodic_box.at(i);
         memset(ins_name, 0, 9);
         strncpy(ins_name, ins.name, 8);
         if(file.write(ins_name, 9) != 9)
@@ -189,7 +173,7 @@ FfmtErrCode AdLibTimbre::saveFile(QString filePath, FmBank &bank)
     uint8_t odata[56];
     for(uint16_t i = 0; i < ins_count; i++)
     {
-        FmBank::Instrument &ins = bank.Ins_Melodic[i];
+        const FmBank::Instrument &ins = bank.Ins_Melodic_box.at(i);
         memset(odata, 0, 56);
         adlib_ins_opToRawIns(ins, MODULATOR1, odata + 0);
         adlib_ins_opToRawIns(ins, CARRIER1, odata + 26);
@@ -200,11 +184,16 @@ FfmtErrCode AdLibTimbre::saveFile(QString filePath, FmBank &bank)
             return FfmtErrCode::ERR_BADFORMAT;
     }
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
+qint64 AdLibTimbre::saveSize(const FmBank &bank) const
+{
+    qint64 ins_count = qMin(bank.Ins_Melodic_box.count(), 65535);
+    // Header, 9-byte names, and 56-byte instruments
+    return 6 + ins_count * (9 + 56);
+}
+
 int AdLibTimbre::formatCaps() const
 {
     return (int)FormatCaps::FORMAT_CAPS_EVERYTHING;
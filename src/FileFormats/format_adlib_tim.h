@@ -27,9 +27,10 @@
 class AdLibTimbre final : public FmBankFormatBase
 {
 public:
-    bool detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
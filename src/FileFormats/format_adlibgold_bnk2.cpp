@@ -23,7 +23,7 @@
 
 static const char *AdLibGoldBnk2_magic = "Accomp. Bank, (C) AdLib Inc";
 
-bool AdLibGoldBnk2_reader::detect(const QString &, char *magic)
+bool AdLibGoldBnk2_reader::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return !std::memcmp(magic, AdLibGoldBnk2_magic, 28);
 }
@@ -83,14 +83,9 @@ static void convertInstrument(
     }
 }
 
-FfmtErrCode AdLibGoldBnk2_reader::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode AdLibGoldBnk2_reader::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     QByteArray fileData  = file.readAll();
-    file.close();
     unsigned fileSize = fileData.size();
 
     if(fileSize < 42 || std::memcmp(fileData.data(), AdLibGoldBnk2_magic, 28))
@@ -179,12 +174,12 @@ FfmtErrCode AdLibGoldBnk2_reader::loadFile(QString filePath, FmBank &bank)
     // mark everything as blank
     for (unsigned b_i = 0; b_i < melo_banks; ++b_i)
     {
-        FmBank::Instrument *instruments = &bank.Ins_Melodic[128 * b_i];
+        FmBank::Instrument *instruments = bank.Ins_Melodic_box.block(int(b_i));
         for (unsigned p_i = 0; p_i < 128; ++p_i)
             instruments[p_i].is_blank = true;
     }
     for (unsigned p_i = 0; p_i < 128; ++p_i)
-        bank.Ins_Percussion[p_i].is_blank = true;
+        bank.Ins_Percussion_box[p_i].is_blank = true;
 
     // populate the entries of banks
     unsigned nth_bank = 0;
@@ -217,7 +212,7 @@ FfmtErrCode AdLibGoldBnk2_reader::loadFile(QString filePath, FmBank &bank)
             if(&insdata[28] >= (const uint8_t *)fileData.end())
                 return FfmtErrCode::ERR_BADFORMAT;
 
-            FmBank::Instrument &dst = bank.Ins_Melodic[nth_bank * 128 + nth_inst];
+            FmBank::Instrument &dst = bank.Ins_Melodic_box[nth_bank * 128 + nth_inst];
             convertInstrument(insdata, dst, ins_name.c_str());
         }
         ++nth_bank;
@@ -244,7 +239,7 @@ FfmtErrCode AdLibGoldBnk2_reader::loadFile(QString filePath, FmBank &bank)
         if(&insdata[28] >= (const uint8_t *)fileData.end())
             return FfmtErrCode::ERR_BADFORMAT;
 
-        FmBank::Instrument &dst = bank.Ins_Melodic[nth_bank * 128 + nth_inst];
+        FmBank::Instrument &dst = bank.Ins_Melodic_box[nth_bank * 128 + nth_inst];
         convertInstrument(insdata, dst, ins_name.c_str());
     }
 
@@ -19,7 +19,7 @@
 #include "format_ail2_gtl.h"
 #include "../common.h"
 
-bool AIL_GTL::detect(const QString &filePath, char *)
+bool AIL_GTL::detectDevice(const QString &filePath, QIODevice &, char *)
 {
     if(hasExt(filePath, ".opl"))
         return true;
@@ -97,12 +97,8 @@ struct GTL_Head // GTL file header entry structure
     uint32_t offset = 0;
 };
 
-FfmtErrCode AIL_GTL::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode AIL_GTL::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     GTL_Head head;
     QVector<GTL_Head> heads;
     uint8_t   hdata[6];
@@ -155,7 +151,7 @@ FfmtErrCode AIL_GTL::loadFile(QString filePath, FmBank &bank)
         GTL_Head &h = heads[int(i)];
         bool isPerc = (h.bank == 0x7F);
         int gmPatchId = isPerc ? h.patch : (h.patch + (h.bank * 128));
-        FmBank::Instrument &ins = isPerc ? bank.Ins_Percussion[gmPatchId] : bank.Ins_Melodic[gmPatchId];
+        FmBank::Instrument &ins = isPerc ? bank.Ins_Percussion_box[gmPatchId] : bank.Ins_Melodic_box[gmPatchId];
 
         if(!file.seek(h.offset))
         {
@@ -237,12 +233,11 @@ FfmtErrCode AIL_GTL::loadFile(QString filePath, FmBank &bank)
         if(file.atEnd())
             break;//Nothing to read!
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode AIL_GTL::saveDevice(QIODevice &file, FmBank &bank)
 {
     FmBank::Instrument null;
     memset(&null, 0, sizeof(FmBank::Instrument));
@@ -256,9 +251,9 @@ FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
     //1) Count non-empty instruments
     for(int i = 0; i < bank.countMelodic(); i++)
     {
-        if(memcmp(&bank.Ins_Melodic[i], &null, sizeof(FmBank::Instrument)) != 0)
+        const FmBank::Instrument &ins = bank.Ins_Melodic_box.at(i);
+        if(memcmp(&ins, &null, sizeof(FmBank::Instrument)) != 0)
         {
-            FmBank::Instrument &ins = bank.Ins_Melodic[i];
             head.patch = i % 128;
             head.bank  = uint8_t(i / 128);
             heads.push_back(head);
@@ -268,9 +263,9 @@ FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
 
     for(int i = 0; i < bank.countDrums(); i++)
     {
-        if(memcmp(&bank.Ins_Percussion[i], &null, sizeof(FmBank::Instrument)) != 0)
+        const FmBank::Instrument &ins = bank.Ins_Percussion_box.at(i);
+        if(memcmp(&ins, &null, sizeof(FmBank::Instrument)) != 0)
         {
-            FmBank::Instrument &ins = bank.Ins_Percussion[i];
             head.patch = i % 128;
             head.bank  = 0x7F;
             heads.push_back(head);
@@ -287,11 +282,6 @@ FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
     // Calculate the global offset
     uint32_t ins_offset = uint32_t((heads.size() * 6) - 4);
 
-    // Open the file
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     //2) Build the header
     for(GTL_Head &h : heads)
     {
@@ -308,9 +298,9 @@ FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
     for(int i = 0; i < heads.size() - 1; i++)
     {
         GTL_Head &h = heads[i];
-        FmBank::Instrument &ins = (h.bank != 0x7F) ?
-                                bank.Ins_Melodic[h.patch + (h.bank * 128)] :
-                                bank.Ins_Percussion[h.patch];
+        const FmBank::Instrument &ins = (h.bank != 0x7F) ?
+                                bank.Ins_Melodic_box.at(h.patch + (h.bank * 128)) :
+                                bank.Ins_Percussion_box.at(h.patch);
         bool is4op = (ins.en_4op && !ins.en_pseudo4op);
         uint16_t ins_len = is4op ? 25 : 14;
 
@@ -361,7 +351,6 @@ FfmtErrCode AIL_GTL::saveFile(QString filePath, FmBank &bank)
         if(file.write(char_p(odata), ins_len) != ins_len)
             return FfmtErrCode::ERR_BADFORMAT;
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -27,9 +27,9 @@
 class AIL_GTL final : public FmBankFormatBase
 {
 public:
-    bool detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatExtensionMask() const override;
@@ -19,25 +19,16 @@
 #include "format_apogeetmb.h"
 #include "../common.h"
 
-bool ApogeeTMB::detect(const QString &filePath, char* /*magic*/)
+bool ApogeeTMB::detectDevice(const QString &filePath, QIODevice &file, char */*magic*/)
 {
     if(hasExt(filePath, ".tmb"))
         return true;
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
+    qint64 fileSize = file.size();
     return (fileSize == (256 * 13));
 }
 
-FfmtErrCode ApogeeTMB::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode ApogeeTMB::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset();
 
     bank.deep_tremolo = false;
@@ -47,8 +38,8 @@ FfmtErrCode ApogeeTMB::loadFile(QString filePath, FmBank &bank)
     for(uint16_t i = 0; i < 256; i++)
     {
         FmBank::Instrument &ins = (i < 128) ?
-                                  bank.Ins_Melodic[i] :
-                                  bank.Ins_Percussion[(i - 128)];
+                                  bank.Ins_Melodic_box[i] :
+                                  bank.Ins_Percussion_box[(i - 128)];
         uint8_t   idata[13];
 
         if(file.read(char_p(idata), 13) != 13)
@@ -77,24 +68,18 @@ FfmtErrCode ApogeeTMB::loadFile(QString filePath, FmBank &bank)
         ins.velocity_offset = char_p(idata)[12];
     }
 
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode ApogeeTMB::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode ApogeeTMB::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
 
     for(uint16_t i = 0; i < 256; i++)
     {
-        FmBank::Instrument &ins = (i < 128) ?
+        const FmBank::Instrument &ins = (i < 128) ?
                                   tmp.insMelodic[i] :
                                   tmp.insPercussion[(i - 128)];
         uint8_t   odata[13];
@@ -123,10 +108,14 @@ FfmtErrCode ApogeeTMB::saveFile(QString filePath, FmBank &bank)
             return FfmtErrCode::ERR_BADFORMAT;
     }
 
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
+qint64 ApogeeTMB::saveSize(const FmBank &) const
+{
+    return 256 * 13;
+}
+
 int ApogeeTMB::formatCaps() const
 {
     return (int)FormatCaps::FORMAT_CAPS_EVERYTHING_GM;
@@ -19,23 +19,16 @@
 #include "format_bisqwit.h"
 #include "../common.h"
 
-bool BisqwitBank::detect(const QString &filePath, char *)
+bool BisqwitBank::detectDevice(const QString &filePath, QIODevice &file, char *)
 {
     if(hasExt(filePath, ".adlraw"))
         return true;
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
+    qint64 fileSize = file.size();
     return (fileSize == 6400);
 }
 
-FfmtErrCode BisqwitBank::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode BisqwitBank::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
     bank.reset();
 
     bank.deep_tremolo = true;
@@ -47,8 +40,8 @@ FfmtErrCode BisqwitBank::loadFile(QString filePath, FmBank &bank)
         bool isDrum = (i >= 128);
         uint8_t key = isDrum ? uint8_t(i - 128) : uint8_t(i);
         FmBank::Instrument &ins = isDrum ?
-                                  bank.Ins_Percussion[key] :
-                                  bank.Ins_Melodic[key];
+                                  bank.Ins_Percussion_box[key] :
+                                  bank.Ins_Melodic_box[key];
         uint8_t idata[25];
         uint8_t *op1 = idata + 2;
         uint8_t *op2 = idata + 14;
@@ -90,13 +83,8 @@ FfmtErrCode BisqwitBank::loadFile(QString filePath, FmBank &bank)
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode BisqwitBank::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode BisqwitBank::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
@@ -104,7 +92,7 @@ FfmtErrCode BisqwitBank::saveFile(QString filePath, FmBank &bank)
     {
         bool isDrum = (i >= 128);
         uint8_t key = isDrum ? uint8_t(i - 128) : uint8_t(i);
-        FmBank::Instrument &ins = isDrum ?
+        const FmBank::Instrument &ins = isDrum ?
                                   tmp.insPercussion[key] :
                                   tmp.insMelodic[key];
         uint8_t odata[25];
@@ -21,12 +21,12 @@
 
 static const char *cmf_magic = "CTMF";
 
-bool CMF_Importer::detect(const QString &, char *magic)
+bool CMF_Importer::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, cmf_magic, 4) == 0);
 }
 
-FfmtErrCode CMF_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode CMF_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
     char        magic[4];
     uint8_t     version[2];
@@ -35,12 +35,8 @@ FfmtErrCode CMF_Importer::loadFile(QString filePath, FmBank &bank)
     uint8_t     insCount_a[2];
     FmBank::Instrument ins = FmBank::emptyInst();
 
-    QFile file(filePath);
     memset(magic, 0, 4);
 
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset();
 
     if(file.read(magic, 4) != 4)
@@ -113,10 +109,6 @@ FfmtErrCode CMF_Importer::loadFile(QString filePath, FmBank &bank)
                 which instruments are percussion (AdLib rythm mode)
     */
 
-    file.close();
-    bank.Ins_Percussion = bank.Ins_Percussion_box.data();
-    bank.Ins_Melodic    = bank.Ins_Melodic_box.data();
-
     return FfmtErrCode::ERR_OK;
 }
 
@@ -27,8 +27,8 @@
 class CMF_Importer : public FmBankFormatBase
 {
 public:
-    bool        detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
+    bool        detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
     int         formatCaps() const override;
     QString     formatName() const override;
     QString     formatModuleName() const override;
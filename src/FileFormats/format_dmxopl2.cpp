@@ -21,20 +21,16 @@
 
 static const char *dmx_magic = "#OPL_II#";
 
-bool DmxOPL2::detect(const QString &, char *magic)
+bool DmxOPL2::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, dmx_magic, 8) == 0);
 }
 
-FfmtErrCode DmxOPL2::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode DmxOPL2::loadDevice(QIODevice &file, FmBank &bank)
 {
     char magic[8];
     memset(magic, 0, 8);
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset();
 
     bank.deep_tremolo = false;
@@ -52,8 +48,8 @@ FfmtErrCode DmxOPL2::loadFile(QString filePath, FmBank &bank)
     {
         bool isDrum = (i >= 128);
         FmBank::Instrument &ins = isDrum ?
-                                  bank.Ins_Percussion[(i - 128) + 35] :
-                                  bank.Ins_Melodic[i];
+                                  bank.Ins_Percussion_box[(i - 128) + 35] :
+                                  bank.Ins_Melodic_box[i];
         uint16_t  flags       = 0;
         uint8_t   fine_tuning = 0;
         uint8_t   note_number = 0;
@@ -125,8 +121,8 @@ FfmtErrCode DmxOPL2::loadFile(QString filePath, FmBank &bank)
     for(uint16_t i = 0; i < 175; i++)
     {
         FmBank::Instrument &ins = (i < 128) ?
-                                  bank.Ins_Melodic[i] :
-                                  bank.Ins_Percussion[(i - 128) + 35];
+                                  bank.Ins_Melodic_box[i] :
+                                  bank.Ins_Percussion_box[(i - 128) + 35];
         if(file.read(ins.name, 32) != 32)
         {
             bank.reset();
@@ -134,17 +130,11 @@ FfmtErrCode DmxOPL2::loadFile(QString filePath, FmBank &bank)
         }
     }
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode DmxOPL2::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode DmxOPL2::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
@@ -155,9 +145,9 @@ FfmtErrCode DmxOPL2::saveFile(QString filePath, FmBank &bank)
     for(uint16_t i = 0; i < 175; i++)
     {
         bool isDrum = (i >= 128);
-        FmBank::Instrument &ins = isDrum ?
-                                  bank.Ins_Percussion[(i - 128) + 35] :
-                                  bank.Ins_Melodic[i];
+        const FmBank::Instrument &ins = isDrum ?
+                                  tmp.insPercussion[(i - 128) + 35] :
+                                  tmp.insMelodic[i];
         uint16_t    flags       = 0;
         uint8_t     fine_tuning = 0;
         uint8_t     note_number = 0;
@@ -232,17 +222,22 @@ FfmtErrCode DmxOPL2::saveFile(QString filePath, FmBank &bank)
     //Instrument names
     for(uint16_t i = 0; i < 175; i++)
     {
-        FmBank::Instrument &ins = (i < 128) ?
+        const FmBank::Instrument &ins = (i < 128) ?
                                   tmp.insMelodic[i] :
                                   tmp.insPercussion[(i - 128) + 35];
         if(file.write(ins.name, 32) != 32)
             bank.reset();
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
+qint64 DmxOPL2::saveSize(const FmBank &) const
+{
+    // Header, 175 instruments of 36 bytes, and their 32-byte names
+    return 8 + 175 * 36 + 175 * 32;
+}
+
 int DmxOPL2::formatCaps() const
 {
     return (int)FormatCaps::FORMAT_CAPS_EVERYTHING_GM;
@@ -33,9 +33,10 @@ public:
         Dmx_DelayedVib  = 0x0002,
         Dmx_DoubleVoice = 0x0004
     };
-    bool detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatExtensionMask() const override;
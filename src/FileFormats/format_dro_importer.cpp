@@ -33,18 +33,13 @@ static bool readUIntLE(QIODevice &in, T *p)
     return true;
 }
 
-bool DRO_Importer::detect(const QString &filePath, char* magic)
+bool DRO_Importer::detectDevice(const QString &, QIODevice &, char *magic)
 {
-    Q_UNUSED(filePath);
     return !memcmp(magic, "DBRAWOPL", 8);
 }
 
-FfmtErrCode DRO_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode DRO_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     char magic[8];
     if(file.read(magic, 8) != 8 || memcmp(magic, "DBRAWOPL", 8) != 0)
         return FfmtErrCode::ERR_BADFORMAT;
@@ -102,7 +97,7 @@ enum OplModeV2
     DRO2_OplMode3
 };
 
-FfmtErrCode DRO_Importer::loadFileV1(QFile &file, FmBank &bank)
+FfmtErrCode DRO_Importer::loadFileV1(QIODevice &file, FmBank &bank)
 {
     uint32_t lengthMs;
     uint32_t lengthBytes;
@@ -186,12 +181,11 @@ FfmtErrCode DRO_Importer::loadFileV1(QFile &file, FmBank &bank)
     bank.Ins_Melodic_box.clear();
     for(const FmBank::Instrument &ins : chip[0].caughtInstruments())
         bank.Ins_Melodic_box.push_back(ins);
-    bank.Ins_Melodic = bank.Ins_Melodic_box.data();
 
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode DRO_Importer::loadFileV2(QFile &file, FmBank &bank)
+FfmtErrCode DRO_Importer::loadFileV2(QIODevice &file, FmBank &bank)
 {
     uint32_t lengthPairs;
     uint32_t lengthMs;
@@ -267,7 +261,6 @@ FfmtErrCode DRO_Importer::loadFileV2(QFile &file, FmBank &bank)
     bank.Ins_Melodic_box.clear();
     for(const FmBank::Instrument &ins : chip[0].caughtInstruments())
         bank.Ins_Melodic_box.push_back(ins);
-    bank.Ins_Melodic = bank.Ins_Melodic_box.data();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -28,8 +28,8 @@ class QFile;
 class DRO_Importer : public FmBankFormatBase
 {
 public:
-    bool        detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
+    bool        detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
     int         formatCaps() const override;
     QString     formatName() const override;
     QString     formatModuleName() const override;
@@ -37,8 +37,8 @@ public:
     BankFormats formatId() const override;
 
 private:
-    FfmtErrCode loadFileV1(QFile &file, FmBank &bank);
-    FfmtErrCode loadFileV2(QFile &file, FmBank &bank);
+    FfmtErrCode loadFileV1(QIODevice &file, FmBank &bank);
+    FfmtErrCode loadFileV2(QIODevice &file, FmBank &bank);
 };
 
 #endif // FORMAT_DRO_IMPORTER_H
@@ -19,176 +19,69 @@
 #include "format_flatbuffer_opl3.h"
 #include "../common.h"
 #include "Opl3Bank_generated.h"
+#include <algorithm>
+#include <cstring>
 
 #define INTERNAL_VERSION 1
 
-bool FlatbufferOpl3::detect(const QString& filePath, char*)
+bool FlatbufferOpl3::detectDevice(const QString &, QIODevice &, char *magic)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-
-    QByteArray blob = file.readAll();
-    file.close();
-
-    return Opl3BankBufferHasIdentifier(blob.constData());
+    // The identifier is stored right after the root table offset
+    return Opl3BankBufferHasIdentifier(magic);
 }
 
-FfmtErrCode FlatbufferOpl3::loadFile(QString filePath, FmBank& bank)
+static void readOperator(FmBank::Instrument &ins, int OpID, const Operator *op)
 {
-    uint16_t count_melodic_banks     = 0;
-    uint16_t count_percusive_banks   = 0;
-
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
-    QByteArray blob = file.readAll();
-    file.close();
-
-    // Get a pointer to the root object inside the buffer.
-    auto opl3Bank = GetOpl3Bank(blob.constData());
-    auto banks = opl3Bank->banks();
+    if(!op)
+        return;
+    ins.setAVEKM(OpID,    op->AVEKM());
+    ins.setAtDec(OpID,    op->AtDec());
+    ins.setSusRel(OpID,   op->SusRel());
+    ins.setWaveForm(OpID, op->WaveForm());
+    ins.setKSLL(OpID,     op->KSLL());
+}
 
-    // count banks types
-    for(uint8_t i = 0; i < banks->Length(); i++)
+static void readInstrument(FmBank::Instrument &ins, const Instrument *instrument)
+{
+    int mode = instrument->mode();
+    ins.en_pseudo4op = (mode == Mode_Pseudo);
+    ins.en_4op = (mode == Mode_Pseudo) || (mode == Mode_FourOp);
+    ins.percNoteNum = instrument->percussionKey();
+    ins.velocity_offset = instrument->velocityOffset();
+    ins.is_blank = false;
+    ins.ms_sound_kon = instrument->konMs();
+    ins.ms_sound_koff = instrument->koffMs();
+    if(instrument->name())
+        strncpy(ins.name, instrument->name()->c_str(), 32);
+
+    ins.note_offset1 = instrument->keyOffset1();
+    ins.setFBConn1(instrument->fb_conn1());
+    readOperator(ins, MODULATOR1, instrument->modulator1());
+    readOperator(ins, CARRIER1, instrument->carrier1());
+
+    if(mode != Mode_TwoOp)
     {
-        auto bnk = banks->Get(i);
-
-        switch(bnk->type())
-        {
-        case BankType_Melodic:
-            count_melodic_banks++;
-            break;
-
-        case BankType_Percussion:
-            count_percusive_banks++;
-            break;
-
-        default:
-            return FfmtErrCode::ERR_BADFORMAT;
-        }
+        ins.fine_tune = instrument->secondVoiceTuning();
+        ins.note_offset2 = instrument->keyOffset2();
+        ins.setFBConn2(instrument->fb_conn2());
+        readOperator(ins, MODULATOR2, instrument->modulator2());
+        readOperator(ins, CARRIER2, instrument->carrier2());
     }
+}
 
-    bank.reset(count_melodic_banks, count_percusive_banks);
-
-    bank.deep_vibrato = ((opl3Bank->oplTV() >> 0) & 0x01);
-    bank.deep_tremolo = ((opl3Bank->oplTV() >> 1) & 0x01);
-    bank.volume_model = opl3Bank->volumeModel() <= VolumeModel_MAX ? opl3Bank->volumeModel() : 0;
-
-    uint16_t current_melodic_bank     = 0;
-    uint16_t current_percusive_bank   = 0;
-    FmBank::MidiBank* bankMeta = nullptr;
-
-    for(uint8_t i = 0; i < banks->Length(); i++)
-    {
-        auto bnk = banks->Get(i);
-        auto bankType = bnk->type();
-
-        switch(bankType)
-        {
-        case BankType_Melodic:
-            bankMeta = &bank.Banks_Melodic[current_melodic_bank];
-            break;
-
-        case BankType_Percussion:
-            bankMeta = &bank.Banks_Percussion[current_percusive_bank];
-            break;
-        }
-
-        bankMeta->lsb = bnk->bankLSB();
-        bankMeta->msb = bnk->bankMSB();
-        strncpy(bankMeta->name, bnk->name()->c_str(), 32);
-
-        auto instruments = bnk->instruments();
-        uint8_t instrumentCount = (uint8_t)instruments->Length();
-
-        for(uint8_t j = 0; j < instrumentCount; j++)
-        {
-            auto instrument = instruments->Get(j);
-
-            FmBank::Instrument* ins = nullptr;
-
-            switch(bankType)
-            {
-            case BankType_Melodic:
-                ins = &bank.Ins_Melodic[current_melodic_bank * 128 + instrument->program()];
-                break;
-
-            case BankType_Percussion:
-                ins = &bank.Ins_Percussion[current_percusive_bank * 128 + instrument->program()];
-                break;
-            }
-
-            int mode = instrument->mode();
-            ins->en_pseudo4op = (mode == Mode_Pseudo);
-            ins->en_4op = (mode == Mode_Pseudo) || (mode == Mode_FourOp);
-            ins->percNoteNum = instrument->percussionKey();
-            ins->velocity_offset = instrument->velocityOffset();
-            ins->is_blank = false;
-            ins->ms_sound_kon = instrument->konMs();
-            ins->ms_sound_koff = instrument->koffMs();
-            strncpy(ins->name, instrument->name()->c_str(), 32);
-
-            ins->note_offset1 = instrument->keyOffset1();
-            ins->setFBConn1(instrument->fb_conn1());
-
-            ins->setAVEKM(MODULATOR1,    instrument->modulator1()->AVEKM());
-            ins->setAtDec(MODULATOR1,    instrument->modulator1()->AtDec());
-            ins->setSusRel(MODULATOR1,   instrument->modulator1()->SusRel());
-            ins->setWaveForm(MODULATOR1, instrument->modulator1()->WaveForm());
-            ins->setKSLL(MODULATOR1,     instrument->modulator1()->KSLL());
-
-            ins->setAVEKM(CARRIER1,    instrument->carrier1()->AVEKM());
-            ins->setAtDec(CARRIER1,    instrument->carrier1()->AtDec());
-            ins->setSusRel(CARRIER1,   instrument->carrier1()->SusRel());
-            ins->setWaveForm(CARRIER1, instrument->carrier1()->WaveForm());
-            ins->setKSLL(CARRIER1,     instrument->carrier1()->KSLL());
-
-            if(mode != Mode_TwoOp)
-            {
-                ins->fine_tune = instrument->secondVoiceTuning();
-                ins->note_offset2 = instrument->keyOffset2();
-                ins->setFBConn2(instrument->fb_conn2());
-
-                ins->setAVEKM(MODULATOR2,    instrument->modulator2()->AVEKM());
-                ins->setAtDec(MODULATOR2,    instrument->modulator2()->AtDec());
-                ins->setSusRel(MODULATOR2,   instrument->modulator2()->SusRel());
-                ins->setWaveForm(MODULATOR2, instrument->modulator2()->WaveForm());
-                ins->setKSLL(MODULATOR2,     instrument->modulator2()->KSLL());
-
-                ins->setAVEKM(CARRIER2,    instrument->carrier2()->AVEKM());
-                ins->setAtDec(CARRIER2,    instrument->carrier2()->AtDec());
-                ins->setSusRel(CARRIER2,   instrument->carrier2()->SusRel());
-                ins->setWaveForm(CARRIER2, instrument->carrier2()->WaveForm());
-                ins->setKSLL(CARRIER2,     instrument->carrier2()->KSLL());
-            }
-        }
-
-        switch(bankType)
-        {
-        case BankType_Melodic:
-            current_melodic_bank++;
-            break;
-
-        case BankType_Percussion:
-            current_percusive_bank++;
-            break;
-        }
-    }
+FfmtErrCode FlatbufferOpl3::loadDevice(QIODevice &file, FmBank &bank)
+{
+    FlatbufferOpl3Loader loader;
+    FfmtErrCode err = loader.openData(file.readAll());
+    if(err != FfmtErrCode::ERR_OK)
+        return err;
 
+    loader.toBank(bank);
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode FlatbufferOpl3::saveFile(QString filePath, FmBank& bank)
+FfmtErrCode FlatbufferOpl3::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     flatbuffers::FlatBufferBuilder builder(1024);
 
     std::vector<flatbuffers::Offset<Bank>> banks_vector;
@@ -199,11 +92,11 @@ FfmtErrCode FlatbufferOpl3::saveFile(QString filePath, FmBank& bank)
         const FmBank::MidiBank& bankMeta = bank.Banks_Melodic[i];
 
         std::vector<flatbuffers::Offset<Instrument>> instruments_vector;
-        FmBank::Instrument* insts = &bank.Ins_Melodic[i * 128];
+        const FmBank::InsStorage &insts = bank.Ins_Melodic_box;
 
-        for(int j = 0; j < 128; j++)
+        for(int j = 0; j < 128 && (i * 128 + j) < insts.size(); j++)
         {
-            FmBank::Instrument& ins = insts[j];
+            const FmBank::Instrument& ins = insts[i * 128 + j];
 
             if(!ins.is_blank)
             {
@@ -255,11 +148,11 @@ FfmtErrCode FlatbufferOpl3::saveFile(QString filePath, FmBank& bank)
         const FmBank::MidiBank& bankMeta = bank.Banks_Percussion[i];
 
         std::vector<flatbuffers::Offset<Instrument>> instruments_vector;
-        FmBank::Instrument* insts = &bank.Ins_Percussion[i * 128];
+        const FmBank::InsStorage &insts = bank.Ins_Percussion_box;
 
-        for(int j = 0; j < 128; j++)
+        for(int j = 0; j < 128 && (i * 128 + j) < insts.size(); j++)
         {
-            FmBank::Instrument& ins = insts[j];
+            const FmBank::Instrument& ins = insts[i * 128 + j];
 
             if(!ins.is_blank)
             {
@@ -314,7 +207,6 @@ FfmtErrCode FlatbufferOpl3::saveFile(QString filePath, FmBank& bank)
     int size = (int)builder.GetSize();
 
     file.write(char_p(buf), size);
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -343,3 +235,171 @@ BankFormats FlatbufferOpl3::formatId() const
 {
     return BankFormats::FORMAT_FLATBUFFER_OPL3;
 }
+
+/* ******** Verified loader ******** */
+
+FlatbufferOpl3Loader::FlatbufferOpl3Loader()
+{}
+
+FlatbufferOpl3Loader::~FlatbufferOpl3Loader()
+{
+    close();
+}
+
+FfmtErrCode FlatbufferOpl3Loader::openData(const QByteArray &data)
+{
+    close();
+    m_data = data;
+    return buildIndex();
+}
+
+void FlatbufferOpl3Loader::close()
+{
+    m_root = nullptr;
+    m_melodicBanks.clear();
+    m_percussionBanks.clear();
+    m_melodic.clear();
+    m_percussion.clear();
+    m_data.clear();
+}
+
+FfmtErrCode FlatbufferOpl3Loader::buildIndex()
+{
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(m_data.constData());
+    size_t size = size_t(m_data.size());
+
+    // Every instrument is a table, so limit of tables is given by the size
+    flatbuffers::Verifier verifier(base, size, 64, flatbuffers::uoffset_t(qMax<size_t>(1000000, size / 4)));
+    if(size < 8 || !VerifyOpl3BankBuffer(verifier))
+    {
+        close();
+        return FfmtErrCode::ERR_BADFORMAT;
+    }
+
+    const Opl3Bank *opl3Bank = GetOpl3Bank(base);
+    auto banks = opl3Bank->banks();
+    uint32_t banksCount = banks ? banks->size() : 0;
+
+    for(uint32_t i = 0; i < banksCount; i++)
+    {
+        auto bnk = banks->Get(i);
+        quint32 offset = quint32(reinterpret_cast<const uint8_t *>(bnk) - base);
+
+        QVector<quint32> *entries;
+        switch(bnk->type())
+        {
+        case BankType_Melodic:
+            m_melodicBanks.push_back(offset);
+            entries = &m_melodic;
+            break;
+
+        case BankType_Percussion:
+            m_percussionBanks.push_back(offset);
+            entries = &m_percussion;
+            break;
+
+        default:
+            close();
+            return FfmtErrCode::ERR_BADFORMAT;
+        }
+
+        int first = entries->size();
+        entries->resize(first + 128);
+        std::fill(entries->begin() + first, entries->end(), 0u);
+
+        auto instruments = bnk->instruments();
+        uint32_t count = instruments ? instruments->size() : 0;
+        for(uint32_t j = 0; j < count; j++)
+        {
+            auto instrument = instruments->Get(j);
+            if(instrument->program() >= 128)
+            {
+                close();
+                return FfmtErrCode::ERR_BADFORMAT;
+            }
+            (*entries)[first + instrument->program()] = quint32(reinterpret_cast<const uint8_t *>(instrument) - base);
+        }
+    }
+
+    m_root = opl3Bank;
+    return FfmtErrCode::ERR_OK;
+}
+
+bool FlatbufferOpl3Loader::deepVibrato() const
+{
+    return m_root && ((static_cast<const Opl3Bank *>(m_root)->oplTV() >> 0) & 0x01);
+}
+
+bool FlatbufferOpl3Loader::deepTremolo() const
+{
+    return m_root && ((static_cast<const Opl3Bank *>(m_root)->oplTV() >> 1) & 0x01);
+}
+
+uint8_t FlatbufferOpl3Loader::volumeModel() const
+{
+    if(!m_root)
+        return 0;
+    uint8_t model = static_cast<const Opl3Bank *>(m_root)->volumeModel();
+    return model <= VolumeModel_MAX ? model : 0;
+}
+
+FmBank::MidiBank FlatbufferOpl3Loader::bankMeta(quint32 offset) const
+{
+    FmBank::MidiBank meta;
+    memset(&meta, 0, sizeof(FmBank::MidiBank));
+
+    auto bnk = reinterpret_cast<const Bank *>(m_data.constData() + offset);
+    meta.lsb = bnk->bankLSB();
+    meta.msb = bnk->bankMSB();
+    if(bnk->name())
+        strncpy(meta.name, bnk->name()->c_str(), 32);
+    return meta;
+}
+
+FmBank::MidiBank FlatbufferOpl3Loader::melodicBank(int bank) const
+{
+    return bankMeta(m_melodicBanks[bank]);
+}
+
+FmBank::MidiBank FlatbufferOpl3Loader::percussionBank(int bank) const
+{
+    return bankMeta(m_percussionBanks[bank]);
+}
+
+FmBank::Instrument FlatbufferOpl3Loader::instrument(int index, bool isDrum) const
+{
+    FmBank::Instrument ins = FmBank::emptyInst();
+    ins.is_fixed_note = isDrum;
+
+    const QVector<quint32> &entries = isDrum ? m_percussion : m_melodic;
+    if(index >= 0 && index < entries.size() && entries[index] != 0)
+        readInstrument(ins, reinterpret_cast<const Instrument *>(m_data.constData() + entries[index]));
+
+    return ins;
+}
+
+void FlatbufferOpl3Loader::toBank(FmBank &bank) const
+{
+    bank.reset(uint16_t(m_melodicBanks.size()), uint16_t(m_percussionBanks.size()));
+
+    bank.deep_vibrato = deepVibrato();
+    bank.deep_tremolo = deepTremolo();
+    bank.volume_model = volumeModel();
+
+    for(int i = 0; i < m_melodicBanks.size(); i++)
+        bank.Banks_Melodic[i] = melodicBank(i);
+    for(int i = 0; i < m_percussionBanks.size(); i++)
+        bank.Banks_Percussion[i] = percussionBank(i);
+
+    // Slots without data are already the same as instrument() gives for them
+    for(int i = 0; i < m_melodic.size(); i++)
+    {
+        if(m_melodic[i] != 0)
+            bank.Ins_Melodic_box[i] = instrument(i, false);
+    }
+    for(int i = 0; i < m_percussion.size(); i++)
+    {
+        if(m_percussion[i] != 0)
+            bank.Ins_Percussion_box[i] = instrument(i, true);
+    }
+}
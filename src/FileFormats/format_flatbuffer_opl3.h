@@ -20,6 +20,7 @@
 #define FLATBUFFER_OPL3_H
 
 #include "ffmt_base.h"
+#include <QVector>
 
 /**
  * @brief Reader and Writer of the Flatbuffer OPL3 Bank format
@@ -27,9 +28,9 @@
 class FlatbufferOpl3 final : public FmBankFormatBase
 {
 public:
-    bool detect(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
     int  formatCaps() const override;
     QString formatName() const override;
     QString formatExtensionMask() const override;
@@ -37,4 +38,70 @@ public:
     BankFormats formatId() const override;
 };
 
+/**
+ * @brief Loader of the Flatbuffer OPL3 bank with verification of its data
+ *
+ * The whole data is verified once on opening, and the index of instrument
+ * tables is built, so untrusted files never get read out of bounds.
+ * The loader holds the data while it's open, instruments are converted
+ * into FmBank::Instrument by instrument() or all at once by toBank().
+ * Missing instruments are the same as in the bank after FmBank::reset():
+ * null, and with the fixed note for percussion.
+ */
+class FlatbufferOpl3Loader
+{
+public:
+    FlatbufferOpl3Loader();
+    ~FlatbufferOpl3Loader();
+
+    /**
+     * @brief Open the bank data
+     * @param data Whole file data, it's held until close()
+     * @return ERR_BADFORMAT if data is not a valid bank
+     */
+    FfmtErrCode openData(const QByteArray &data);
+
+    void close();
+    inline bool isOpen() const { return m_root != nullptr; }
+
+    bool    deepVibrato() const;
+    bool    deepTremolo() const;
+    uint8_t volumeModel() const;
+
+    inline int countMelodicBanks() const    { return m_melodicBanks.size(); }
+    inline int countPercussionBanks() const { return m_percussionBanks.size(); }
+    FmBank::MidiBank melodicBank(int bank) const;
+    FmBank::MidiBank percussionBank(int bank) const;
+
+    //! Count of instrument slots, 128 per bank
+    inline int countMelodic() const { return m_melodic.size(); }
+    inline int countDrums() const   { return m_percussion.size(); }
+
+    /**
+     * @brief Get the instrument converted from the data
+     * @param index Index of the instrument slot
+     * @param isDrum Is a percussion instrument
+     */
+    FmBank::Instrument instrument(int index, bool isDrum) const;
+
+    /**
+     * @brief Convert the whole bank
+     * @param bank Destination bank
+     */
+    void toBank(FmBank &bank) const;
+
+private:
+    FfmtErrCode buildIndex();
+    FmBank::MidiBank bankMeta(quint32 offset) const;
+
+    QByteArray  m_data;
+    const void *m_root = nullptr;
+
+    //! Offsets of the tables in the data, zero for missing ones
+    QVector<quint32> m_melodicBanks;
+    QVector<quint32> m_percussionBanks;
+    QVector<quint32> m_melodic;
+    QVector<quint32> m_percussion;
+};
+
 #endif // FLATBUFFER_OPL3_H
@@ -49,14 +49,14 @@ static const uint16_t Operators[NUM_OF_CHANNELS * 2] =
     0x011, 0xFFF
 }; // operator 13
 
-bool IMF_Importer::detect(const QString &filePath, char *)
+bool IMF_Importer::detectDevice(const QString &filePath, QIODevice &, char *)
 {
     if(hasExt(filePath, ".imf"))
         return true;
     return false;
 }
 
-FfmtErrCode IMF_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode IMF_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
     uint8_t ymram[0x100];
     bool    keys[9];
@@ -65,10 +65,6 @@ FfmtErrCode IMF_Importer::loadFile(QString filePath, FmBank &bank)
 
     QSet<QByteArray> cache;
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset();
 
     uint32_t imfLen = 0;
@@ -158,15 +154,12 @@ FfmtErrCode IMF_Importer::loadFile(QString filePath, FmBank &bank)
                 {
                     snprintf(ins.name, 32, "Ins-%03d, channel %d", insCount++, (int)(ch));
                     bank.Ins_Melodic_box.push_back(ins);
-                    bank.Ins_Melodic = bank.Ins_Melodic_box.data();
                     cache.insert(insRaw);
                 }
             }
         }
     }
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
@@ -21,12 +21,12 @@
 
 static const char *jv_magic = "Junglevision Patch File\x1A\0\0\0\0\0\0\0\0";
 
-bool JunleVizion::detect(const QString &, char *magic)
+bool JunleVizion::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, jv_magic, 32) == 0);
 }
 
-FfmtErrCode JunleVizion::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode JunleVizion::loadDevice(QIODevice &file, FmBank &bank)
 {
     uint16_t count_melodic     = 0;
     uint16_t count_percusive   = 0;
@@ -35,10 +35,6 @@ FfmtErrCode JunleVizion::loadFile(QString filePath, FmBank &bank)
     char magic[32];
     memset(magic, 0, 32);
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset();
 
     bank.deep_tremolo = true;
@@ -72,7 +68,7 @@ FfmtErrCode JunleVizion::loadFile(QString filePath, FmBank &bank)
     uint16_t total = count_melodic + count_percusive;
     for(uint16_t i = 0; i < total; i++)
     {
-        FmBank::Instrument &ins = (i < count_melodic) ? bank.Ins_Melodic[i + startAt_melodic] : bank.Ins_Percussion[(i - count_melodic) + startAt_percusive];
+        FmBank::Instrument &ins = (i < count_melodic) ? bank.Ins_Melodic_box[i + startAt_melodic] : bank.Ins_Percussion_box[(i - count_melodic) + startAt_percusive];
         uint8_t idata[24];
         if(file.read(char_p(idata), 24) != 24)
         {
@@ -114,12 +110,11 @@ FfmtErrCode JunleVizion::loadFile(QString filePath, FmBank &bank)
         ins.setSusRel(CARRIER2, idata[22]);
         ins.setWaveForm(CARRIER2, idata[23]);
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode JunleVizion::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode JunleVizion::saveDevice(QIODevice &file, FmBank &bank)
 {
     FmBank::Instrument null;
     memset(&null, 0, sizeof(FmBank::Instrument));
@@ -157,10 +152,6 @@ FfmtErrCode JunleVizion::saveFile(QString filePath, FmBank &bank)
     else
         startAt_percusive = 0;
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     //Write header
     file.write(char_p(jv_magic), 32);
 
@@ -173,7 +164,7 @@ FfmtErrCode JunleVizion::saveFile(QString filePath, FmBank &bank)
     bool had4op = false;
     for(uint16_t i = 0; i < total; i++)
     {
-        FmBank::Instrument &ins = (i < count_melodic) ?
+        const FmBank::Instrument &ins = (i < count_melodic) ?
                                     tmp.insMelodic[i + startAt_melodic] :
                                     tmp.insPercussion[(i - count_melodic) + startAt_percusive];
         uint8_t odata[24];
@@ -217,7 +208,6 @@ FfmtErrCode JunleVizion::saveFile(QString filePath, FmBank &bank)
         if(file.write(char_p(odata), 24) != 24)
             return FfmtErrCode::ERR_BADFORMAT;
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -22,19 +22,14 @@
 
 static const char* CIF_magic = "<CUD-FM-Instrument>\x1a";
 
-bool Misc_CIF::detectInst(const QString& filePath, char* magic)
+bool Misc_CIF::detectInstDevice(const QString &, QIODevice &, char *magic)
 {
-    Q_UNUSED(filePath);
     return memcmp(magic, CIF_magic, 20) == 0;
 }
 
-FfmtErrCode Misc_CIF::loadFileInst(QString filePath, FmBank::Instrument& inst, bool* isDrum)
+FfmtErrCode Misc_CIF::loadInstDevice(QIODevice &file, FmBank::Instrument& inst, bool* isDrum)
 {
     Q_UNUSED(isDrum);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     char magic[20];
 
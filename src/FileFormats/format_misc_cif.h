@@ -27,8 +27,8 @@
 class Misc_CIF final : public FmBankFormatBase
 {
 public:
-    bool        detectInst(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = nullptr) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = nullptr) override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstExtensionMask() const override;
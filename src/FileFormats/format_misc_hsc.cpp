@@ -18,21 +18,16 @@
 
 #include "format_misc_hsc.h"
 #include "../common.h"
-#include <QFileInfo>
 
-bool Misc_HSC::detectInst(const QString& filePath, char*)
+bool Misc_HSC::detectInstDevice(const QString &filePath, QIODevice &file, char *)
 {
     return filePath.endsWith(".ins", Qt::CaseInsensitive) &&
-           QFileInfo(filePath).size() == 12;
+           file.size() == 12;
 }
 
-FfmtErrCode Misc_HSC::loadFileInst(QString filePath, FmBank::Instrument& inst, bool* isDrum)
+FfmtErrCode Misc_HSC::loadInstDevice(QIODevice &file, FmBank::Instrument& inst, bool* isDrum)
 {
     Q_UNUSED(isDrum);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     uint8_t idata[12];
 
@@ -53,13 +48,9 @@ FfmtErrCode Misc_HSC::loadFileInst(QString filePath, FmBank::Instrument& inst, b
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode Misc_HSC::saveFileInst(QString filePath, FmBank::Instrument& inst, bool isDrum)
+FfmtErrCode Misc_HSC::saveInstDevice(QIODevice &file, FmBank::Instrument& inst, bool isDrum)
 {
     Q_UNUSED(isDrum);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     uint8_t idata[12];
 
@@ -74,7 +65,7 @@ FfmtErrCode Misc_HSC::saveFileInst(QString filePath, FmBank::Instrument& inst, b
 
     idata[8] = inst.getFBConn1();
 
-    if(file.write((char*)idata, 12) != 12 || !file.flush())
+    if(file.write((char*)idata, 12) != 12)
         return FfmtErrCode::ERR_BADFORMAT;
 
     return FfmtErrCode::ERR_OK;
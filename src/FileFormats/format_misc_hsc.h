@@ -27,9 +27,9 @@
 class Misc_HSC final : public FmBankFormatBase
 {
 public:
-    bool        detectInst(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = nullptr) override;
-    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = nullptr) override;
+    FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false) override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstExtensionMask() const override;
@@ -20,7 +20,7 @@
 #include "../common.h"
 #include <QFileInfo>
 
-bool Misc_SGI::detectInst(const QString& filePath, char* magic)
+bool Misc_SGI::detectInstDevice(const QString &filePath, QIODevice &file, char *magic)
 {
     (void)magic;
 
@@ -29,8 +29,7 @@ bool Misc_SGI::detectInst(const QString& filePath, char* magic)
         return true;
 
     //By file size :-P
-    QFileInfo f(filePath);
-    uint64_t size = f.size();
+    qint64 size = file.size();
 
     if(size == 26)
         return true;
@@ -38,13 +37,9 @@ bool Misc_SGI::detectInst(const QString& filePath, char* magic)
     return false;
 }
 
-FfmtErrCode Misc_SGI::loadFileInst(QString filePath, FmBank::Instrument& inst, bool* isDrum)
+FfmtErrCode Misc_SGI::loadInstDevice(QIODevice &file, FmBank::Instrument& inst, bool* isDrum)
 {
     Q_UNUSED(isDrum);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     uint8_t idata[26];
 
@@ -66,7 +61,7 @@ FfmtErrCode Misc_SGI::loadFileInst(QString filePath, FmBank::Instrument& inst, b
 
     inst.setFBConn1((idata[25] & 1) | ((idata[24] & 7) << 1));
 
-    std::string name = QFileInfo(filePath).baseName().toStdString();
+    std::string name = QFileInfo(deviceFileName(file)).baseName().toStdString();
     size_t namelen = name.size();
     namelen = (namelen < 32) ? namelen : 32;
     memcpy(inst.name, name.data(), namelen);
@@ -56,7 +56,7 @@ struct Fm4Inst
 }; // 28 bytes
 
 
-bool PatchFm4::detect(const QString& filePath, char* magic)
+bool PatchFm4::detectDevice(const QString &, QIODevice &file, char *magic)
 {
     uint32_t size = toUint32LE(reinterpret_cast<uint8_t*>(magic) + 4);
 
@@ -69,28 +69,19 @@ bool PatchFm4::detect(const QString& filePath, char* magic)
     if(std::memcmp(magic + 12, RIFF_FM4_MAGIC, 4) != 0)
         return false;
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
+    qint64 fileSize = file.size();
 
     return (fileSize == (qint64)(size + 8));
 }
 
-FfmtErrCode PatchFm4::loadFile(QString filePath, FmBank& bank)
+FfmtErrCode PatchFm4::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
     uint8_t magic[20];
     Fm4Inst inst;
     uint8_t block;
 
     static_assert(sizeof(Fm4Inst) == INSTRUMENT_SIZE, "Size of Fm4Inst must be 28 bytes !");
 
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     qint64 fileSize = file.bytesAvailable();
 
     bank.reset();
@@ -126,8 +117,8 @@ FfmtErrCode PatchFm4::loadFile(QString filePath, FmBank& bank)
     for(uint16_t i = 0; i < 256; i++)
     {
         FmBank::Instrument &ins = (i < 128) ?
-                                    bank.Ins_Melodic[i] :
-                                    bank.Ins_Percussion[(i - 128)];
+                                    bank.Ins_Melodic_box[i] :
+                                    bank.Ins_Percussion_box[(i - 128)];
 
         if(file.read(char_p(&inst), INSTRUMENT_SIZE) != INSTRUMENT_SIZE)
         {
@@ -169,17 +160,13 @@ FfmtErrCode PatchFm4::loadFile(QString filePath, FmBank& bank)
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode PatchFm4::saveFile(QString filePath, FmBank& bank)
+FfmtErrCode PatchFm4::saveDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
     Fm4Inst inst;
     int16_t noteOff1, noteOff2;
     uint32_t sizeRiff = 12;
     uint32_t sizeData = 0;
 
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
@@ -201,7 +188,7 @@ FfmtErrCode PatchFm4::saveFile(QString filePath, FmBank& bank)
 
     for(uint16_t i = 0; i < 256; i++)
     {
-        FmBank::Instrument &ins = (i < 128) ?
+        const FmBank::Instrument &ins = (i < 128) ?
                                     tmp.insMelodic[i] :
                                     tmp.insPercussion[(i - 128)];
 
@@ -279,10 +266,15 @@ FfmtErrCode PatchFm4::saveFile(QString filePath, FmBank& bank)
     if(writeLE(file, sizeData) != 4)
         return FfmtErrCode::ERR_BADFORMAT;
 
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
+qint64 PatchFm4::saveSize(const FmBank &) const
+{
+    // RIFF header, data chunk header, and 256 instruments
+    return 12 + 8 + 256 * INSTRUMENT_SIZE;
+}
+
 int PatchFm4::formatCaps() const
 {
     return (int)FormatCaps::FORMAT_CAPS_EVERYTHING_GM;
@@ -21,24 +21,20 @@
 
 static const char *rad_magic = "RAD by REALiTY!!";
 
-bool RAD_Importer::detect(const QString &, char *magic)
+bool RAD_Importer::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, rad_magic, 16) == 0);
 }
 
-FfmtErrCode RAD_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode RAD_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
     char        magic[16];
     uint8_t     head[2];
     bool        has_description = false;
     FmBank::Instrument ins = FmBank::emptyInst();
 
-    QFile file(filePath);
     memset(magic, 0, 16);
 
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     // ========== HEADER ==========
     // Offset  00..0F:"RAD by REALiTY!!"
     if(file.read(magic, 16) != 16)
@@ -115,10 +111,7 @@ FfmtErrCode RAD_Importer::loadFile(QString filePath, FmBank &bank)
     // ....
     // We have found all necessary to us instruments, therefore just stop reading the file
     // ....
-    file.close();
 
-    bank.Ins_Percussion = bank.Ins_Percussion_box.data();
-    bank.Ins_Melodic    = bank.Ins_Melodic_box.data();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -29,16 +29,16 @@ public:
     static bool detectIBK(const char *magic);
     static bool detectSBI(const char *magic);
     static bool detectSBI4OP(const char *magic);
-    static bool detectUNIXO2(QString filePath, BankFormats &format);
-    static bool detectUNIXO3(QString filePath, BankFormats &format);
+    static bool detectUNIXO2(const QString &filePath, QIODevice &file);
+    static bool detectUNIXO3(const QString &filePath, QIODevice &file);
     // IBK/SBI for DOS
-    static FfmtErrCode loadFileIBK(QString filePath, FmBank &bank);
-    static FfmtErrCode saveFileIBK(QString filePath, FmBank &bank);
-    static FfmtErrCode loadFileSBI(QString filePath, FmBank::Instrument &inst, bool *isDrum = nullptr);
-    static FfmtErrCode saveFileSBI(QString filePath, FmBank::Instrument &inst, bool isDrum = false);
+    static FfmtErrCode loadFileIBK(QIODevice &file, FmBank &bank);
+    static FfmtErrCode saveFileIBK(QIODevice &file, FmBank &bank);
+    static FfmtErrCode loadFileSBI(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = nullptr);
+    static FfmtErrCode saveFileSBI(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false);
     // SB/O3 for UNIX
-    static FfmtErrCode loadFileSBOP(QString filePath, FmBank &bank, BankFormats &format);
-    static FfmtErrCode saveFileSBOP(QString filePath, FmBank &bank, bool fourOp = false, bool isDrum = false);
+    static FfmtErrCode loadFileSBOP(QIODevice &file, FmBank &bank, BankFormats &format);
+    static FfmtErrCode saveFileSBOP(QIODevice &file, FmBank &bank, bool fourOp = false, bool isDrum = false);
 };
 
 // DOS SBK and SBI
@@ -71,35 +71,21 @@ bool SbIBK_impl::detectSBI4OP(const char *magic)
 }
 
 
-bool SbIBK_impl::detectUNIXO2(QString filePath, BankFormats &format)
+bool SbIBK_impl::detectUNIXO2(const QString &filePath, QIODevice &file)
 {
     if(hasExt(filePath, ".sb"))
         return true;
 
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
-    format = BankFormats::FORMAT_SB2OP;
+    qint64 fileSize = file.size();
     return (fileSize == 6656);
 }
 
-bool SbIBK_impl::detectUNIXO3(QString filePath, BankFormats &format)
+bool SbIBK_impl::detectUNIXO3(const QString &filePath, QIODevice &file)
 {
     if(hasExt(filePath, ".o3"))
         return true;
 
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return false;
-
-    qint64 fileSize = file.bytesAvailable();
-    file.close();
-    format = BankFormats::FORMAT_SB4OP;
+    qint64 fileSize = file.size();
     return (fileSize == 7680);
 }
 
@@ -151,7 +137,7 @@ static void raw2sbi(FmBank::Instrument &ins, uint8_t *idata, bool fourOp = false
     //            } SBTIMBRE;
 }
 
-static void sbi2raw(uint8_t *odata, FmBank::Instrument &ins, bool fourOp = false)
+static void sbi2raw(uint8_t *odata, const FmBank::Instrument &ins, bool fourOp = false)
 {
     int MODULATOR   = fourOp ? MODULATOR2  : MODULATOR1;
     int CARRIER     = fourOp ? CARRIER2    : CARRIER1;
@@ -186,14 +172,10 @@ static void sbi2raw(uint8_t *odata, FmBank::Instrument &ins, bool fourOp = false
 }
 
 
-FfmtErrCode SbIBK_impl::loadFileIBK(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_impl::loadFileIBK(QIODevice &file, FmBank &bank)
 {
     char magic[4];
     memset(magic, 0, 4);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     bank.reset();
 
@@ -221,9 +203,9 @@ FfmtErrCode SbIBK_impl::loadFileIBK(QString filePath, FmBank &bank)
 
         char tempName[10];
         sprintf(tempName, "NONAME%03d", i);
-        strncpy(bank.Ins_Melodic[i].name, tempName, 9);
-        strncpy(bank.Ins_Percussion[i].name, tempName, 9);
-        FmBank::Instrument &ins = (idata[11] == 0x00) ? bank.Ins_Melodic[i] : bank.Ins_Percussion[i];
+        strncpy(bank.Ins_Melodic_box[i].name, tempName, 9);
+        strncpy(bank.Ins_Percussion_box[i].name, tempName, 9);
+        FmBank::Instrument &ins = (idata[11] == 0x00) ? bank.Ins_Melodic_box[i] : bank.Ins_Percussion_box[i];
         drumFlags[i] = (idata[11] != 0x00);
         raw2sbi(ins, idata, false);
     }
@@ -232,8 +214,8 @@ FfmtErrCode SbIBK_impl::loadFileIBK(QString filePath, FmBank &bank)
     for(uint16_t i = 0; i < 128; i++)
     {
         FmBank::Instrument &ins = drumFlags[i] ?
-                                  bank.Ins_Percussion[i] :
-                                  bank.Ins_Melodic[i];
+                                  bank.Ins_Percussion_box[i] :
+                                  bank.Ins_Melodic_box[i];
         if(file.read(ins.name, 9) != 9)
         {
             bank.reset();
@@ -241,7 +223,6 @@ FfmtErrCode SbIBK_impl::loadFileIBK(QString filePath, FmBank &bank)
         }
     }
 
-    file.close();
     //    typedef struct {                     /* 3204 Bytes (0x0C83) */
     //            char     sig[4];             /* signature: "IBK\x1A"  */
     //            SBTIMBRE snd[128];           /* Instrument block */
@@ -250,13 +231,8 @@ FfmtErrCode SbIBK_impl::loadFileIBK(QString filePath, FmBank &bank)
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode SbIBK_impl::saveFileIBK(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_impl::saveFileIBK(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
@@ -269,7 +245,7 @@ FfmtErrCode SbIBK_impl::saveFileIBK(QString filePath, FmBank &bank)
     for(uint16_t i = 0; i < 128; i++)
     {
         drumFlags[i] = (tmp.insPercussion[i].rhythm_drum_type != 0);
-        FmBank::Instrument &ins = drumFlags[i] ?
+        const FmBank::Instrument &ins = drumFlags[i] ?
                                   tmp.insPercussion[i] :
                                   tmp.insMelodic[i];
         uint8_t odata[16];
@@ -282,29 +258,26 @@ FfmtErrCode SbIBK_impl::saveFileIBK(QString filePath, FmBank &bank)
     //store bank names
     for(uint16_t i = 0; i < 128; i++)
     {
-        FmBank::Instrument &ins = drumFlags[i] ?
+        const FmBank::Instrument &ins = drumFlags[i] ?
                                   tmp.insPercussion[i] :
                                   tmp.insMelodic[i];
-        ins.name[8] = '\0';
+        char name[9];
+        memcpy(name, ins.name, 8);
+        name[8] = '\0';
 
-        if(file.write(ins.name, 9) != 9)
+        if(file.write(name, 9) != 9)
             return FfmtErrCode::ERR_BADFORMAT;
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
 
-FfmtErrCode SbIBK_impl::loadFileSBI(QString filePath, FmBank::Instrument &inst, bool *isDrum)
+FfmtErrCode SbIBK_impl::loadFileSBI(QIODevice &file, FmBank::Instrument &inst, bool *isDrum)
 {
     char magic[4];
     memset(magic, 0, 4);
     memset(&inst, 0, sizeof(FmBank::Instrument));
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     bool isExtended = file.bytesAvailable() > 52;
     Q_UNUSED(isExtended);
@@ -351,27 +324,21 @@ FfmtErrCode SbIBK_impl::loadFileSBI(QString filePath, FmBank::Instrument &inst,
     if(isVstiMagic && strncmp(inst.name, vsti_inst_name, 32) == 0)
     {
         // it's the hardcoded JuceOPLVSTi name, replace with filename
-        QString nameFromPath = QFileInfo(filePath).baseName();
+        QString nameFromPath = QFileInfo(deviceFileName(file)).baseName();
         strncpy(inst.name, nameFromPath.toUtf8().data(), 32);
     }
 
     if(inst.name[0] == '\0')
     {
-        QFileInfo i(filePath);
+        QFileInfo i(deviceFileName(file));
         strncpy(inst.name, i.baseName().toUtf8().data(), 32);
     }
 
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode SbIBK_impl::saveFileSBI(QString filePath, FmBank::Instrument &inst, bool)
+FfmtErrCode SbIBK_impl::saveFileSBI(QIODevice &file, FmBank::Instrument &inst, bool)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     if(file.write(char_p(sbi_magic), 4) != 4)
         return FfmtErrCode::ERR_BADFORMAT;
     if(file.write(inst.name, 32) != 32)
@@ -383,24 +350,18 @@ FfmtErrCode SbIBK_impl::saveFileSBI(QString filePath, FmBank::Instrument &inst,
     if(file.write(char_p(&odata), 16) != 16)
         return FfmtErrCode::ERR_BADFORMAT;
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
 
 
 
-FfmtErrCode SbIBK_impl::loadFileSBOP(QString filePath, FmBank &bank, BankFormats &format)
+FfmtErrCode SbIBK_impl::loadFileSBOP(QIODevice &file, FmBank &bank, BankFormats &format)
 {
     char magic[4];
     bool valid = false;
     bool is4op = false;
     memset(magic, 0, 4);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     bank.reset();
 
@@ -461,7 +422,7 @@ FfmtErrCode SbIBK_impl::loadFileSBOP(QString filePath, FmBank &bank, BankFormats
             return FfmtErrCode::ERR_BADFORMAT;
         }
 
-        FmBank::Instrument &ins = fileIsPercussion ? bank.Ins_Percussion[i] : bank.Ins_Melodic[i];
+        FmBank::Instrument &ins = fileIsPercussion ? bank.Ins_Percussion_box[i] : bank.Ins_Melodic_box[i];
         strncpy(ins.name, tempName, 30);
         /*
          0-15: voice name
@@ -483,25 +444,19 @@ FfmtErrCode SbIBK_impl::loadFileSBOP(QString filePath, FmBank &bank, BankFormats
         //ins.note_offset1 = fileIsPercussion ? 0 :tempName[28];
         ins.percNoteNum = uint8_t(tempName[31]);
     }
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode SbIBK_impl::saveFileSBOP(QString filePath, FmBank &bank, bool fourOp, bool isDrum)
+FfmtErrCode SbIBK_impl::saveFileSBOP(QIODevice &file, FmBank &bank, bool fourOp, bool isDrum)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     /* Temporary bank to prevent crash if current bank has less than 128 instruments
      * (for example, imported from some small BNK file) */
     TmpBank tmp(bank, 128, 128);
 
-    FmBank::Instrument *insts = isDrum ? tmp.insPercussion : tmp.insMelodic;
+    const FmBank::InsStorage &insts = isDrum ? tmp.insPercussion : tmp.insMelodic;
     for(uint16_t i = 0; i < 128; i++)
     {
-        FmBank::Instrument &ins = insts[i];
+        const FmBank::Instrument &ins = insts[i];
         const char *magic = (isDrum && (i == 0)) ? zero_magic : (ins.en_4op ? fop_magic : top_magic);
         if(file.write(char_p(magic), 4) != 4)
             return FfmtErrCode::ERR_BADFORMAT;
@@ -532,26 +487,31 @@ FfmtErrCode SbIBK_impl::saveFileSBOP(QString filePath, FmBank &bank, bool fourOp
                 return FfmtErrCode::ERR_BADFORMAT;
         }
     }
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
 
 
-bool SbIBK_DOS::detect(const QString &, char *magic)
+bool SbIBK_DOS::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return SbIBK_impl::detectIBK(magic);
 }
 
-FfmtErrCode SbIBK_DOS::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_DOS::loadDevice(QIODevice &file, FmBank &bank)
 {
-    return SbIBK_impl::loadFileIBK(filePath, bank);
+    return SbIBK_impl::loadFileIBK(file, bank);
 }
 
-FfmtErrCode SbIBK_DOS::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_DOS::saveDevice(QIODevice &file, FmBank &bank)
 {
-    return SbIBK_impl::saveFileIBK(filePath, bank);
+    return SbIBK_impl::saveFileIBK(file, bank);
+}
+
+qint64 SbIBK_DOS::saveSize(const FmBank &) const
+{
+    // Header, 128 instruments of 16 bytes, and their 9-byte names
+    return 4 + 128 * 16 + 128 * 9;
 }
 
 int SbIBK_DOS::formatCaps() const
@@ -579,19 +539,24 @@ BankFormats SbIBK_DOS::formatId() const
     return BankFormats::FORMAT_IBK;
 }
 
-bool SbIBK_DOS::detectInst(const QString &, char *magic)
+bool SbIBK_DOS::detectInstDevice(const QString &, QIODevice &, char *magic)
 {
     return SbIBK_impl::detectSBI(magic);
 }
 
-FfmtErrCode SbIBK_DOS::loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum)
+FfmtErrCode SbIBK_DOS::loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum)
+{
+    return SbIBK_impl::loadFileSBI(file, inst, isDrum);
+}
+
+FfmtErrCode SbIBK_DOS::saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum)
 {
-    return SbIBK_impl::loadFileSBI(filePath, inst, isDrum);
+    return SbIBK_impl::saveFileSBI(file, inst, isDrum);
 }
 
-FfmtErrCode SbIBK_DOS::saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum)
+qint64 SbIBK_DOS::saveInstSize(const FmBank::Instrument &, bool) const
 {
-    return SbIBK_impl::saveFileSBI(filePath, inst, isDrum);
+    return 4 + 32 + 16;
 }
 
 int SbIBK_DOS::formatInstCaps() const
@@ -627,18 +592,24 @@ InstFormats SbIBK_DOS::formatInstId() const
 
 
 
-bool SbIBK_UNIX_READ::detect(const QString &filePath, char *)
+bool SbIBK_UNIX_READ::detectDevice(const QString &filePath, QIODevice &file, char *)
 {
     bool ret = false;
-    ret = SbIBK_impl::detectUNIXO2(filePath, m_recentFormat);
+    ret = SbIBK_impl::detectUNIXO2(filePath, file);
     if(!ret)
-        ret = SbIBK_impl::detectUNIXO3(filePath, m_recentFormat);
+        ret = SbIBK_impl::detectUNIXO3(filePath, file);
     return ret;
 }
 
-FfmtErrCode SbIBK_UNIX_READ::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_UNIX_READ::loadDevice(QIODevice &file, FmBank &bank)
 {
-    return SbIBK_impl::loadFileSBOP(filePath, bank, m_recentFormat);
+    BankFormats format;
+    return SbIBK_impl::loadFileSBOP(file, bank, format);
+}
+
+FfmtErrCode SbIBK_UNIX_READ::loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format)
+{
+    return SbIBK_impl::loadFileSBOP(file, bank, format);
 }
 
 int SbIBK_UNIX_READ::formatCaps() const
@@ -663,24 +634,21 @@ QString SbIBK_UNIX_READ::formatExtensionMask() const
 
 BankFormats SbIBK_UNIX_READ::formatId() const
 {
-    return m_recentFormat;
+    // Variant of the loaded data is given by loadDeviceFormat()
+    return BankFormats::FORMAT_UNKNOWN;
 }
 
-bool SbIBK_UNIX_READ::detectInst(const QString &, char *magic)
+bool SbIBK_UNIX_READ::detectInstDevice(const QString &, QIODevice &, char *magic)
 {
     return SbIBK_impl::detectSBI4OP(magic);
 }
 
-FfmtErrCode SbIBK_UNIX_READ::loadFileInst(QString filePath, FmBank::Instrument &inst, bool *)
+FfmtErrCode SbIBK_UNIX_READ::loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *)
 {
     char    magic[4];
     char    tempName[32];
     memset(magic, 0, 4);
     memset(&inst, 0, sizeof(FmBank::Instrument));
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
 
     if(file.read(magic, 4) != 4)
         return FfmtErrCode::ERR_BADFORMAT;
@@ -723,21 +691,15 @@ FfmtErrCode SbIBK_UNIX_READ::loadFileInst(QString filePath, FmBank::Instrument &
 
     if(inst.name[0] == '\0')
     {
-        QFileInfo i(filePath);
+        QFileInfo i(deviceFileName(file));
         strncpy(inst.name, i.baseName().toUtf8().data(), 32);
     }
 
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode SbIBK_UNIX_READ::saveFileInst(QString filePath, FmBank::Instrument &inst, bool)
+FfmtErrCode SbIBK_UNIX_READ::saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool)
 {
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     if(file.write(char_p(fop_magic), 4) != 4)
         return FfmtErrCode::ERR_BADFORMAT;
 
@@ -763,11 +725,14 @@ FfmtErrCode SbIBK_UNIX_READ::saveFileInst(QString filePath, FmBank::Instrument &
     if(file.write(char_p(&odata), 13) != 13)
         return FfmtErrCode::ERR_BADFORMAT;
 
-    file.close();
-
     return FfmtErrCode::ERR_OK;
 }
 
+qint64 SbIBK_UNIX_READ::saveInstSize(const FmBank::Instrument &, bool) const
+{
+    return 4 + 32 + 11 + 13;
+}
+
 int SbIBK_UNIX_READ::formatInstCaps() const
 {
     return int(FormatCaps::FORMAT_CAPS_EVERYTHING);
@@ -801,9 +766,14 @@ InstFormats SbIBK_UNIX_READ::formatInstId() const
 
 
 
-FfmtErrCode SbIBK_UNIX2OP_SAVE::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_UNIX2OP_SAVE::saveDevice(QIODevice &file, FmBank &bank)
+{
+    return SbIBK_impl::saveFileSBOP(file, bank, false, false);
+}
+
+qint64 SbIBK_UNIX2OP_SAVE::saveSize(const FmBank &) const
 {
-    return SbIBK_impl::saveFileSBOP(filePath, bank, false, false);
+    return 128 * 52;
 }
 
 int SbIBK_UNIX2OP_SAVE::formatCaps() const
@@ -840,9 +810,14 @@ BankFormats SbIBK_UNIX2OP_SAVE::formatId() const
 
 
 
-FfmtErrCode SbIBK_UNIX2OP_DRUMS_SAVE::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_UNIX2OP_DRUMS_SAVE::saveDevice(QIODevice &file, FmBank &bank)
+{
+    return SbIBK_impl::saveFileSBOP(file, bank, false, true);
+}
+
+qint64 SbIBK_UNIX2OP_DRUMS_SAVE::saveSize(const FmBank &) const
 {
-    return SbIBK_impl::saveFileSBOP(filePath, bank, false, true);
+    return 128 * 52;
 }
 
 int SbIBK_UNIX2OP_DRUMS_SAVE::formatCaps() const
@@ -880,9 +855,14 @@ BankFormats SbIBK_UNIX2OP_DRUMS_SAVE::formatId() const
 
 
 
-FfmtErrCode SbIBK_UNIX4OP_SAVE::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_UNIX4OP_SAVE::saveDevice(QIODevice &file, FmBank &bank)
 {
-    return SbIBK_impl::saveFileSBOP(filePath, bank, true, false);
+    return SbIBK_impl::saveFileSBOP(file, bank, true, false);
+}
+
+qint64 SbIBK_UNIX4OP_SAVE::saveSize(const FmBank &) const
+{
+    return 128 * 60;
 }
 
 int SbIBK_UNIX4OP_SAVE::formatCaps() const
@@ -918,9 +898,14 @@ BankFormats SbIBK_UNIX4OP_SAVE::formatId() const
 }
 
 
-FfmtErrCode SbIBK_UNIX4OP_DRUMS_SAVE::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode SbIBK_UNIX4OP_DRUMS_SAVE::saveDevice(QIODevice &file, FmBank &bank)
+{
+    return SbIBK_impl::saveFileSBOP(file, bank, true, true);
+}
+
+qint64 SbIBK_UNIX4OP_DRUMS_SAVE::saveSize(const FmBank &) const
 {
-    return SbIBK_impl::saveFileSBOP(filePath, bank, true, true);
+    return 128 * 60;
 }
 
 int SbIBK_UNIX4OP_DRUMS_SAVE::formatCaps() const
@@ -24,18 +24,20 @@
 class SbIBK_DOS final : public FmBankFormatBase
 {
 public:
-    bool    detect(const QString &filePath, char *magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool    detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatExtensionMask() const override;
     QString formatDefaultExtension() const override;
     BankFormats formatId() const override;
 
-    bool        detectInst(const QString &filePath, char *magic) override;
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0) override;
-    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = 0) override;
+    FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false) override;
+    qint64      saveInstSize(const FmBank::Instrument &inst, bool isDrum = false) const override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstModuleName() const override;
@@ -46,19 +48,20 @@ public:
 
 class SbIBK_UNIX_READ final : public FmBankFormatBase
 {
-    BankFormats m_recentFormat = BankFormats::FORMAT_UNKNOWN;
 public:
-    bool    detect(const QString &filePath, char *magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
+    bool    detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode loadDeviceFormat(QIODevice &file, FmBank &bank, BankFormats &format) override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
     QString formatExtensionMask() const override;
     BankFormats formatId() const override;
 
-    bool        detectInst(const QString &filePath, char *magic) override;
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0) override;
-    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = 0) override;
+    FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false) override;
+    qint64      saveInstSize(const FmBank::Instrument &inst, bool isDrum = false) const override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstModuleName() const override;
@@ -71,7 +74,8 @@ public:
 class SbIBK_UNIX2OP_SAVE final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -83,7 +87,8 @@ public:
 class SbIBK_UNIX2OP_DRUMS_SAVE final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -95,7 +100,8 @@ public:
 class SbIBK_UNIX4OP_SAVE final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -107,7 +113,8 @@ public:
 class SbIBK_UNIX4OP_DRUMS_SAVE final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
+    qint64  saveSize(const FmBank &bank) const override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
@@ -238,22 +238,18 @@ static bool s_readInstrumentMA2(uint8_t *pBuf, FmBank::Instrument &inst)
 
 
 
-bool SMAF_Importer::detect(const QString &, char *magic)
+bool SMAF_Importer::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, s_mmf_magic, 4) == 0);
 }
 
-FfmtErrCode SMAF_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode SMAF_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
     char        magic[4];
     uint8_t     read_buffer[4096];
 
-    QFile file(filePath);
     memset(magic, 0, 4);
 
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     bank.reset(1, 1);
 
     if(file.read(magic, 4) != 4)
@@ -345,10 +341,6 @@ FfmtErrCode SMAF_Importer::loadFile(QString filePath, FmBank &bank)
         index += (pBuf[index + 2] + 3);
     }
 
-    file.close();
-    bank.Ins_Percussion = bank.Ins_Percussion_box.data();
-    bank.Ins_Melodic    = bank.Ins_Melodic_box.data();
-
     return FfmtErrCode::ERR_OK;
 }
 
@@ -19,21 +19,20 @@
 #include "format_vgm_import.h"
 #include "ymf262_to_wopi.h"
 #include "../common.h"
+#include "ffmt_archive.h"
 
 #include <QSet>
 #include <QByteArray>
 #include <QBuffer>
-#include <zlib.h>
 #include <algorithm>
 #include <cstring>
 
 static void make_size_table(uint8_t *table, unsigned version);
-static gzFile gzopen_q(const QString &path, const char *mode);
 
 const char magic_vgm[4] = {0x56, 0x67, 0x6D, 0x20};
 const unsigned char magic_gzip[2] = {0x1F, 0x8B};
 
-bool VGM_Importer::detect(const QString &filePath, char *magic)
+bool VGM_Importer::detectDevice(const QString &, QIODevice &file, char *magic)
 {
     if(memcmp(magic_vgm, magic, 4) == 0)
         return true;
@@ -41,26 +40,18 @@ bool VGM_Importer::detect(const QString &filePath, char *magic)
     //Try as compressed VGM file
     if(memcmp(magic_gzip, magic, 2) == 0)
     {
-        gzFile vgz = gzopen_q(filePath, "rb");
-        if(!vgz)
-            return false;
-
-        char compMagic[4];
-        int count = (int)gzread(vgz, compMagic, 4);
-        gzclose(vgz);
-        if(count == 4 && memcmp(compMagic, magic_vgm, 4) == 0)
+        QBuffer head;
+        head.open(QBuffer::ReadWrite);
+        FmBankArchive::gunzip(file, head, 4);
+        if(head.size() == 4 && memcmp(head.data().constData(), magic_vgm, 4) == 0)
             return true;
     }
 
     return false;
 }
 
-FfmtErrCode VGM_Importer::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode VGM_Importer::loadDevice(QIODevice &file, FmBank &bank)
 {
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     char magic[4];
     if(file.read(magic, 4) != 4)
         return FfmtErrCode::ERR_BADFORMAT;
@@ -71,27 +62,17 @@ FfmtErrCode VGM_Importer::loadFile(QString filePath, FmBank &bank)
         return load(file, bank);
     }
 
-    file.close();
-
     //Try as compressed VGM file
     if(memcmp(magic_gzip, magic, 2) == 0)
     {
-        gzFile vgz = gzopen_q(filePath, "rb");
-        if(!vgz)
-            return FfmtErrCode::ERR_NOFILE;
-
         QBuffer buffer;
         buffer.open(QBuffer::ReadWrite);
 
-        int n;
-        char buf[1024];
-        while((n = (int)gzread(vgz, buf, sizeof(buf))) > 0)
-            buffer.write(buf, n);
-        if(n == -1)
+        file.seek(0);
+        if(!FmBankArchive::gunzip(file, buffer))
             return FfmtErrCode::ERR_BADFORMAT;
-        gzclose(vgz);
 
-        buffer.open(QIODevice::ReadOnly);
+        buffer.seek(0);
         return load(buffer, bank);
     }
 
@@ -217,7 +198,6 @@ FfmtErrCode VGM_Importer::load(QIODevice &file, FmBank &bank)
     bank.Ins_Melodic_box.reserve(insts.size());
     for(const FmBank::Instrument &inst : insts)
         bank.Ins_Melodic_box.push_back(inst);
-    bank.Ins_Melodic = bank.Ins_Melodic_box.data();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -342,12 +322,3 @@ static void make_size_table(uint8_t *table, unsigned version)
     for(unsigned a = 0xE2; a <= 0xFF; ++a)
         table[a] = 4;  // three operands, reserved for future use
 }
-
-static gzFile gzopen_q(const QString &path, const char *mode)
-{
-#ifndef _WIN32
-    return gzopen(path.toStdString().c_str(), mode);
-#else
-    return gzopen_w(path.toStdWString().c_str(), mode);
-#endif
-}
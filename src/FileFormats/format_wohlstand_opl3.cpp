@@ -38,17 +38,17 @@ V. 3
     * Added sounding delay fields into every isntrument for ADLMIDI's channel manager
 */
 
-bool WohlstandOPL3::detect(const QString &, char *magic)
+bool WohlstandOPL3::detectDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, wopl3_magic, 11) == 0);
 }
 
-bool WohlstandOPL3::detectInst(const QString &, char *magic)
+bool WohlstandOPL3::detectInstDevice(const QString &, QIODevice &, char *magic)
 {
     return (strncmp(magic, wopli_magic, 11) == 0);
 }
 
-static bool readInstrument(QFile &file, FmBank::Instrument &ins, uint16_t &version, bool hasSoundKoefficients = true)
+static bool readInstrument(QIODevice &file, FmBank::Instrument &ins, uint16_t &version, bool hasSoundKoefficients = true)
 {
     uint8_t idata[WOPL_INST_SIZE_V3];
     memset(idata, 0, WOPL_INST_SIZE_V3);
@@ -168,7 +168,7 @@ static void cvt_WOPLI_to_FMIns(FmBank::Instrument &out, WOPLInstrument &in)
     }
 }
 
-static void cvt_FMIns_to_WOPLI(FmBank::Instrument &in, WOPLInstrument &out, bool isDrum = false)
+static void cvt_FMIns_to_WOPLI(const FmBank::Instrument &in, WOPLInstrument &out, bool isDrum = false)
 {
     strncpy(out.inst_name, in.name, 32);
     out.note_offset1 = in.note_offset1;
@@ -215,7 +215,7 @@ static void cvt_FMIns_to_WOPLI(FmBank::Instrument &in, WOPLInstrument &out, bool
     }
 }
 
-static bool writeInstrument(QFile &file, FmBank::Instrument &ins, bool hasSoundKoefficients = true)
+static bool writeInstrument(QIODevice &file, FmBank::Instrument &ins, bool hasSoundKoefficients = true)
 {
     uint8_t odata[WOPL_INST_SIZE_V3];
     memset(odata, 0, WOPL_INST_SIZE_V3);
@@ -271,15 +271,11 @@ static bool writeInstrument(QFile &file, FmBank::Instrument &ins, bool hasSoundK
         return (file.write(char_p(odata), WOPL_INST_SIZE_V2) == WOPL_INST_SIZE_V2);
 }
 
-FfmtErrCode WohlstandOPL3::loadFile(QString filePath, FmBank &bank)
+FfmtErrCode WohlstandOPL3::loadDevice(QIODevice &file, FmBank &bank)
 {
     int err = 0;
     WOPLFile *wopl = nullptr;
-    QFile file(filePath);
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
     QByteArray fileData = file.readAll();
-    file.close();
 
     wopl = WOPL_LoadBankFromMem((void*)fileData.data(), (size_t)fileData.size(), &err);
     if(!wopl)
@@ -304,7 +300,7 @@ FfmtErrCode WohlstandOPL3::loadFile(QString filePath, FmBank &bank)
     bank.deep_vibrato = (wopl->opl_flags & WOPL_FLAG_DEEP_VIBRATO) != 0;
     bank.volume_model = wopl->volume_model;
 
-    FmBank::Instrument *slots_ins[2] = {bank.Ins_Melodic, bank.Ins_Percussion};
+    FmBank::InsStorage *slots_ins[2] = {&bank.Ins_Melodic_box, &bank.Ins_Percussion_box};
     FmBank::MidiBank * slots_banks[2] =  {bank.Banks_Melodic.data(), bank.Banks_Percussion.data()};
     uint16_t slots_counts[2] = {wopl->banks_count_melodic, wopl->banks_count_percussion};
     WOPLBank *slots_src_ins[2] = { wopl->banks_melodic, wopl->banks_percussive };
@@ -319,7 +315,7 @@ FfmtErrCode WohlstandOPL3::loadFile(QString filePath, FmBank &bank)
             slots_banks[ss][i].msb = slots_src_ins[ss][i].bank_midi_msb;
             for(int j = 0; j < 128; j++)
             {
-                FmBank::Instrument &ins = slots_ins[ss][(size_t(i) * 128) + size_t(j)];
+                FmBank::Instrument &ins = (*slots_ins[ss])[(i * 128) + j];
                 WOPLInstrument &inIns = slots_src_ins[ss][i].ins[j];
                 cvt_WOPLI_to_FMIns(ins, inIns);
                 ins.is_fixed_note |= isDrum;
@@ -331,7 +327,7 @@ FfmtErrCode WohlstandOPL3::loadFile(QString filePath, FmBank &bank)
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode WohlstandOPL3::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode WohlstandOPL3::saveDevice(QIODevice &file, FmBank &bank)
 {
     FmBank::Instrument null;
     memset(&null, 0, sizeof(FmBank::Instrument));
@@ -347,7 +343,7 @@ FfmtErrCode WohlstandOPL3::saveFile(QString filePath, FmBank &bank)
                       ((uint8_t(bank.deep_vibrato) << 1) & WOPL_FLAG_DEEP_VIBRATO);
     wopl->volume_model = bank.volume_model;
 
-    FmBank::Instrument *slots_src_ins[2] = {bank.Ins_Melodic, bank.Ins_Percussion};
+    const FmBank::InsStorage *slots_src_ins[2] = {&bank.Ins_Melodic_box, &bank.Ins_Percussion_box};
     size_t slots_src_ins_counts[2] = {(size_t)bank.countMelodic(), (size_t)bank.countDrums()};
     FmBank::MidiBank * slots_src_banks[2] =  {bank.Banks_Melodic.data(), bank.Banks_Percussion.data()};
     uint16_t slots_counts[2] = {wopl->banks_count_melodic, wopl->banks_count_percussion};
@@ -364,9 +360,9 @@ FfmtErrCode WohlstandOPL3::saveFile(QString filePath, FmBank &bank)
             for(int j = 0; j < 128; j++)
             {
                 size_t ins_index = (size_t(i) * 128) + size_t(j);
-                if(slots_src_ins_counts[ss] < ins_index)
+                if(slots_src_ins_counts[ss] <= ins_index)
                     break;
-                FmBank::Instrument &ins = slots_src_ins[ss][ins_index];
+                const FmBank::Instrument &ins = (*slots_src_ins[ss])[int(ins_index)];
                 WOPLInstrument &inIns = slots_dst_ins[ss][i].ins[j];
                 cvt_FMIns_to_WOPLI(ins, inIns, isDrum);
             }
@@ -382,12 +378,7 @@ FfmtErrCode WohlstandOPL3::saveFile(QString filePath, FmBank &bank)
     }
     WOPL_Free(wopl);
 
-    QFile file(filePath);
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
-
     file.write(outFile);
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
@@ -417,16 +408,12 @@ BankFormats WohlstandOPL3::formatId() const
     return BankFormats::FORMAT_WOHLSTAND_OPL3;
 }
 
-FfmtErrCode WohlstandOPL3::loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum)
+FfmtErrCode WohlstandOPL3::loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum)
 {
     char magic[32];
     memset(magic, 0, 32);
     uint16_t version = 0;
     uint8_t isDrumFlag = 0;
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::ReadOnly))
-        return FfmtErrCode::ERR_NOFILE;
     if(file.read(magic, 11) != 11)
         return FfmtErrCode::ERR_BADFORMAT;
     if(strncmp(magic, wopli_magic, 11) != 0)
@@ -441,18 +428,13 @@ FfmtErrCode WohlstandOPL3::loadFileInst(QString filePath, FmBank::Instrument &in
         *isDrum = bool(isDrumFlag);
     if(!readInstrument(file, inst, version, false))
         return FfmtErrCode::ERR_BADFORMAT;
-    file.close();
 
     return FfmtErrCode::ERR_OK;
 }
 
-FfmtErrCode WohlstandOPL3::saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum)
+FfmtErrCode WohlstandOPL3::saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum)
 {
     uint8_t isDrumFlag = uint8_t(isDrum);
-    QFile file(filePath);
-
-    if(!file.open(QIODevice::WriteOnly))
-        return FfmtErrCode::ERR_NOFILE;
     if(file.write(char_p(wopli_magic), 11) != 11)
         return FfmtErrCode::ERR_BADFORMAT;
     if(writeLE(file, latest_version) != 2)
@@ -461,7 +443,6 @@ FfmtErrCode WohlstandOPL3::saveFileInst(QString filePath, FmBank::Instrument &in
         return FfmtErrCode::ERR_BADFORMAT;
     if(!writeInstrument(file, inst, false))
         return FfmtErrCode::ERR_BADFORMAT;
-    file.close();
     return FfmtErrCode::ERR_OK;
 }
 
@@ -493,19 +474,15 @@ InstFormats WohlstandOPL3::formatInstId() const
 
 
 
-FfmtErrCode WohlstandOPL3_GM::saveFile(QString filePath, FmBank &bank)
+FfmtErrCode WohlstandOPL3_GM::saveDevice(QIODevice &file, FmBank &bank)
 {
     FmBank gm_bank = bank;
-    gm_bank.Ins_Melodic_box.erase(gm_bank.Ins_Melodic_box.begin() + 128,
-                                  gm_bank.Ins_Melodic_box.end());
-    gm_bank.Ins_Melodic = gm_bank.Ins_Melodic_box.data();
-    gm_bank.Ins_Percussion_box.erase(gm_bank.Ins_Percussion_box.begin() + 128,
-                                     gm_bank.Ins_Percussion_box.end());
-    gm_bank.Ins_Percussion = gm_bank.Ins_Percussion_box.data();
+    gm_bank.Ins_Melodic_box.resize(128);
+    gm_bank.Ins_Percussion_box.resize(128);
     gm_bank.Banks_Melodic.resize(1);
     gm_bank.Banks_Percussion.resize(1);
     WohlstandOPL3 writer;
-    return writer.saveFile(filePath, gm_bank);
+    return writer.saveDevice(file, gm_bank);
 }
 
 int WohlstandOPL3_GM::formatCaps() const
@@ -27,18 +27,18 @@
 class WohlstandOPL3 final : public FmBankFormatBase
 {
 public:
-    bool        detect(const QString &filePath, char* magic) override;
-    bool        detectInst(const QString &filePath, char* magic) override;
-    FfmtErrCode loadFile(QString filePath, FmBank &bank) override;
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    bool        detectDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    bool        detectInstDevice(const QString &filePath, QIODevice &file, char *magic) override;
+    FfmtErrCode loadDevice(QIODevice &file, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
     int         formatCaps() const override;
     QString     formatName() const override;
     QString     formatExtensionMask() const override;
     QString     formatDefaultExtension() const override;
     BankFormats formatId() const override;
 
-    FfmtErrCode loadFileInst(QString filePath, FmBank::Instrument &inst, bool *isDrum = 0) override;
-    FfmtErrCode saveFileInst(QString filePath, FmBank::Instrument &inst, bool isDrum = false) override;
+    FfmtErrCode loadInstDevice(QIODevice &file, FmBank::Instrument &inst, bool *isDrum = 0) override;
+    FfmtErrCode saveInstDevice(QIODevice &file, FmBank::Instrument &inst, bool isDrum = false) override;
     int         formatInstCaps() const override;
     QString     formatInstName() const override;
     QString     formatInstExtensionMask() const override;
@@ -52,7 +52,7 @@ public:
 class WohlstandOPL3_GM final : public FmBankFormatBase
 {
 public:
-    FfmtErrCode saveFile(QString filePath, FmBank &bank) override;
+    FfmtErrCode saveDevice(QIODevice &file, FmBank &bank) override;
     int     formatCaps() const override;
     QString formatName() const override;
     QString formatModuleName() const override;
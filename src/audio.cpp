@@ -32,7 +32,7 @@ void BankEditor::initAudio()
     qDebug() << "Init audioOut...";
     m_audioOut = new AudioOutDefault(m_audioLatency * 1e-3, m_audioDevice.toStdString(), m_audioDriver.toStdString(), this);
     qDebug() << "Init Generator...";
-    std::shared_ptr<Generator> generator(new Generator(uint32_t(m_audioOut->sampleRate()), m_currentChip));
+    std::shared_ptr<Generator> generator(new Generator(uint32_t(m_audioOut->sampleRate()), m_currentChip, unsigned(m_chipsCount)));
     qDebug() << "Init Rt-Generator...";
     RealtimeGenerator *rtgenerator = new RealtimeGenerator(generator, this);
     qDebug() << "Seting pointer of RT Generator...";
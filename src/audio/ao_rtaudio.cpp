@@ -109,7 +109,7 @@ AudioOutRt::AudioOutRt(double latency, const std::string& device_name, const std
     qDebug() << "Buffer size" << bufferSize;
 
     audioOut->openStream(
-        &streamParam, nullptr, RTAUDIO_SINT16, sampleRate, &bufferSize,
+        &streamParam, nullptr, RTAUDIO_FLOAT32, sampleRate, &bufferSize,
         &process, this, &streamOpts, &errorCallback);
 }
 
@@ -168,7 +168,8 @@ int AudioOutRt::process(void* outputbuffer, void*, unsigned nframes, double, RtA
 {
     AudioOutRt* self = (AudioOutRt*)userdata;
     IRealtimeProcess& rt = *self->m_rt;
-    rt.rt_generate((int16_t*)outputbuffer, nframes);
+    // RtAudio converts samples into the device format when it is not a float
+    rt.rt_generate((float*)outputbuffer, nframes);
     return 0;
 }
 
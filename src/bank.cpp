@@ -29,15 +29,13 @@ FmBank::FmBank()
 
 FmBank::FmBank(const FmBank &fb)
 {
-    reset();
     Ins_Melodic_box     = fb.Ins_Melodic_box;
     Ins_Percussion_box  = fb.Ins_Percussion_box;
-    Ins_Melodic         = Ins_Melodic_box.data();
-    Ins_Percussion      = Ins_Percussion_box.data();
     Banks_Melodic       = fb.Banks_Melodic;
     Banks_Percussion    = fb.Banks_Percussion;
     deep_vibrato        = fb.deep_vibrato;
     deep_tremolo        = fb.deep_tremolo;
+    volume_model        = fb.volume_model;
 }
 
 FmBank &FmBank::operator=(const FmBank &fb)
@@ -45,15 +43,13 @@ FmBank &FmBank::operator=(const FmBank &fb)
     if(this == &fb)
         return *this;
 
-    reset();
     Ins_Melodic_box     = fb.Ins_Melodic_box;
     Ins_Percussion_box  = fb.Ins_Percussion_box;
-    Ins_Melodic         = Ins_Melodic_box.data();
-    Ins_Percussion      = Ins_Percussion_box.data();
     Banks_Melodic       = fb.Banks_Melodic;
     Banks_Percussion    = fb.Banks_Percussion;
     deep_vibrato        = fb.deep_vibrato;
     deep_tremolo        = fb.deep_tremolo;
+    volume_model        = fb.volume_model;
     return *this;
 }
 
@@ -62,20 +58,16 @@ bool FmBank::operator==(const FmBank &fb)
     bool res = true;
     res &= (deep_vibrato == fb.deep_vibrato);
     res &= (deep_tremolo == fb.deep_tremolo);
-    res &= (Ins_Melodic_box.size() == fb.Ins_Melodic_box.size());
-    res &= (Ins_Percussion_box.size() == fb.Ins_Percussion_box.size());
     res &= (Banks_Melodic.size() == fb.Banks_Melodic.size());
     res &= (Banks_Percussion.size() == fb.Banks_Percussion.size());
     if(res)
     {
-        int size = Ins_Melodic_box.size() * static_cast<int>(sizeof(Instrument));
-        res &= (memcmp(Ins_Melodic,      fb.Ins_Melodic,    static_cast<size_t>(size)) == 0);
-        size = Ins_Percussion_box.size() * static_cast<int>(sizeof(Instrument));
-        res &= (memcmp(Ins_Percussion,   fb.Ins_Percussion, static_cast<size_t>(size)) == 0);
-        size = Banks_Melodic.size() * static_cast<int>(sizeof(MidiBank));
-        res &= (memcmp(Banks_Melodic.data(),   fb.Banks_Melodic.data(), static_cast<size_t>(size)) == 0);
+        res &= (Ins_Melodic_box == fb.Ins_Melodic_box);
+        res &= (Ins_Percussion_box == fb.Ins_Percussion_box);
+        int size = Banks_Melodic.size() * static_cast<int>(sizeof(MidiBank));
+        res &= (memcmp(Banks_Melodic.constData(),   fb.Banks_Melodic.constData(), static_cast<size_t>(size)) == 0);
         size = Banks_Percussion.size() * static_cast<int>(sizeof(MidiBank));
-        res &= (memcmp(Banks_Percussion.data(),   fb.Banks_Percussion.data(), static_cast<size_t>(size)) == 0);
+        res &= (memcmp(Banks_Percussion.constData(),   fb.Banks_Percussion.constData(), static_cast<size_t>(size)) == 0);
     }
     return res;
 }
@@ -87,45 +79,24 @@ bool FmBank::operator!=(const FmBank &fb)
 
 void FmBank::reset()
 {
-    // FIXME: Remove this and call reset(1, 1) instead of this damned duplicate
-    size_t insnum = 128;
-    size_t banksnum = insnum / 128;
-    size_t size = sizeof(Instrument) * insnum;
-    Ins_Melodic_box.resize(static_cast<int>(insnum));
-    Ins_Percussion_box.resize(static_cast<int>(insnum));
-    Ins_Melodic     = Ins_Melodic_box.data();
-    Ins_Percussion  = Ins_Percussion_box.data();
-    Banks_Melodic.resize(static_cast<int>(banksnum));
-    Banks_Percussion.resize(static_cast<int>(banksnum));
-    memset(Ins_Melodic,    0, size);
-    memset(Ins_Percussion, 0, size);
-    size = sizeof(MidiBank) * banksnum;
-    memset(Banks_Melodic.data(), 0, size);
-    memset(Banks_Percussion.data(), 0, size);
-    for(auto &i : Ins_Percussion_box)
-        i.is_fixed_note = true;
-    deep_vibrato = false;
-    deep_tremolo = false;
+    reset(1, 1);
 }
 
 void FmBank::reset(uint16_t melodic_banks, uint16_t percussion_banks)
 {
     size_t insnum = 128;
-    size_t size = sizeof(Instrument) * insnum;
+    Ins_Melodic_box.clear();
+    Ins_Percussion_box.clear();
     Ins_Melodic_box.resize(static_cast<int>(insnum * melodic_banks));
     Ins_Percussion_box.resize(static_cast<int>(insnum * percussion_banks));
-    Ins_Melodic     = Ins_Melodic_box.data();
-    Ins_Percussion  = Ins_Percussion_box.data();
     Banks_Melodic.resize(static_cast<int>(melodic_banks));
     Banks_Percussion.resize(static_cast<int>(percussion_banks));
-    memset(Ins_Melodic,    0, size * melodic_banks);
-    memset(Ins_Percussion, 0, size * percussion_banks);
-    size = sizeof(MidiBank) * melodic_banks;
+    size_t size = sizeof(MidiBank) * melodic_banks;
     memset(Banks_Melodic.data(), 0, size);
     size = sizeof(MidiBank) * percussion_banks;
     memset(Banks_Percussion.data(), 0, size);
-    for(auto &i : Ins_Percussion_box)
-        i.is_fixed_note = true;
+    for(int i = 0; i < Ins_Percussion_box.size(); i++)
+        Ins_Percussion_box[i].is_fixed_note = true;
     deep_vibrato = false;
     deep_tremolo = false;
 }
@@ -191,11 +162,10 @@ FmBank::MidiBank FmBank::emptyBank(uint16_t index)
 bool FmBank::getBank(uint8_t msb, uint8_t lsb, bool percussive,
                      MidiBank **pBank, Instrument **pIns)
 {
-    Instrument *Ins = percussive ? Ins_Percussion : Ins_Melodic;
-    // QVector<Instrument> &Ins_Box = percussive ? Ins_Percussion_box : Ins_Melodic_box;
+    InsStorage &Ins_Box = percussive ? Ins_Percussion_box : Ins_Melodic_box;
     QVector<MidiBank> &Banks = percussive ? Banks_Percussion : Banks_Melodic;
 
-    for(size_t index = 0, count = Banks.size(); index < count; ++index)
+    for(int index = 0, count = Banks.size(); index < count; ++index)
     {
         MidiBank &midiBank = Banks[index];
         if(midiBank.msb == msb && midiBank.lsb == lsb)
@@ -203,7 +173,7 @@ bool FmBank::getBank(uint8_t msb, uint8_t lsb, bool percussive,
             if(pBank)
                 *pBank = &midiBank;
             if(pIns)
-                *pIns = &Ins[128 * index];
+                *pIns = (index < Ins_Box.blocksCount()) ? Ins_Box.block(index) : nullptr;
             return true;
         }
     }
@@ -222,24 +192,125 @@ bool FmBank::createBank(uint8_t msb, uint8_t lsb, bool percussive,
     if(getBank(msb, lsb, percussive, pBank, pIns))
         return false;
 
-    Instrument *&Ins = percussive ? Ins_Percussion : Ins_Melodic;
-    QVector<Instrument> &Ins_Box = percussive ? Ins_Percussion_box : Ins_Melodic_box;
+    InsStorage &Ins_Box = percussive ? Ins_Percussion_box : Ins_Melodic_box;
     QVector<MidiBank> &Banks = percussive ? Banks_Percussion : Banks_Melodic;
 
-    size_t index = Banks.size();
+    int index = Banks.size();
     Banks.push_back(MidiBank());
     MidiBank &midiBank = Banks.back();
     memset(midiBank.name, 0, sizeof(midiBank.name));
     midiBank.msb = msb;
     midiBank.lsb = lsb;
 
-    Ins_Box.insert(Ins_Box.end(), 128, blankInst());
-    Ins = Ins_Box.data();
+    int oldSize = Ins_Box.size();
+    Ins_Box.resize(oldSize + 128);
+    Ins_Box.fill(blankInst(), oldSize, 128);
 
     if(pBank)
         *pBank = &midiBank;
     if(pIns)
-        *pIns = &Ins[128 * index];
+        *pIns = Ins_Box.block(index);
+
+    return true;
+}
+
+
+FmBank::InsStorage::Block::Block()
+{
+    memset(ins, 0, sizeof(ins));
+}
+
+FmBank::InsStorage::InsStorage() :
+    m_size(0)
+{}
+
+void FmBank::InsStorage::cloneBlock(int dstBlock, int srcBlock)
+{
+    if(dstBlock == srcBlock)
+        return;
+    m_blocks[dstBlock] = m_blocks[srcBlock];
+}
+
+void FmBank::InsStorage::resize(int size)
+{
+    if(size < 0)
+        size = 0;
+
+    int oldBlocks = m_blocks.size();
+    int newBlocks = (size + BlockSize - 1) / BlockSize;
+
+    if(size < m_size)
+    {
+        // Keep unused tail of the last block null-filled
+        int tailEnd = qMin(m_size, newBlocks * BlockSize);
+        for(int i = size; i < tailEnd; i++)
+            memset(&operator[](i), 0, sizeof(Instrument));
+    }
+
+    m_blocks.resize(newBlocks);
+    for(int b = oldBlocks; b < newBlocks; b++)
+        m_blocks[b] = new Block;
+
+    m_size = size;
+}
+
+void FmBank::InsStorage::clear()
+{
+    m_blocks.clear();
+    m_size = 0;
+}
+
+void FmBank::InsStorage::push_back(const Instrument &ins)
+{
+    resize(m_size + 1);
+    operator[](m_size - 1) = ins;
+}
+
+void FmBank::InsStorage::fill(const Instrument &ins, int from, int count)
+{
+    int end = (count < 0) ? m_size : qMin(m_size, from + count);
+    for(int i = from; i < end; i++)
+        operator[](i) = ins;
+}
+
+void FmBank::InsStorage::remove(int i)
+{
+    remove(i, 1);
+}
+
+void FmBank::InsStorage::remove(int i, int count)
+{
+    if(i < 0 || count <= 0 || i >= m_size)
+        return;
+    if(i + count > m_size)
+        count = m_size - i;
+
+    if((i % BlockSize == 0) && (count % BlockSize == 0))
+    {
+        // Whole blocks are removed, just drop them without touching of remaining instruments
+        m_blocks.remove(i / BlockSize, count / BlockSize);
+        m_size -= count;
+        return;
+    }
+
+    for(int j = i + count; j < m_size; j++)
+        operator[](j - count) = at(j);
+    resize(m_size - count);
+}
+
+bool FmBank::InsStorage::operator==(const InsStorage &other) const
+{
+    if(m_size != other.m_size)
+        return false;
+
+    for(int b = 0, n = m_blocks.size(); b < n; b++)
+    {
+        if(isSameBlock(other, b))
+            continue;
+        int insCount = qMin(int(BlockSize), m_size - (b * BlockSize));
+        if(memcmp(constBlock(b), other.constBlock(b), sizeof(Instrument) * size_t(insCount)) != 0)
+            return false;
+    }
 
     return true;
 }
@@ -395,37 +466,39 @@ uint32_t FmBank::Instrument::getDataE862(int OpID) const
 }
 
 
-TmpBank::TmpBank(FmBank &bank, int minMelodic, int minPercusive)
+bool FmBank::Instrument::isOutputOperator(int OpID) const
 {
-    insMelodic = bank.Ins_Melodic;
-    insPercussion = bank.Ins_Percussion;
-    if(bank.Ins_Melodic_box.size() < minMelodic)
-    {
-        tmpMelodic = bank.Ins_Melodic_box;
-        tmpMelodic.reserve(128 - tmpMelodic.size());
-        while(tmpMelodic.size() < 128)
-            tmpMelodic.push_back(FmBank::emptyInst());
-        insMelodic = tmpMelodic.data();
-    }
-    if(bank.Ins_Melodic_box.size() > minMelodic)
+    if(!en_4op || en_pseudo4op)
     {
-        tmpMelodic = bank.Ins_Melodic_box;
-        tmpMelodic.resize(minMelodic);
-        insMelodic = tmpMelodic.data();
+        // One or two independent 2-operator voices
+        bool am = (OpID == CARRIER1 || OpID == MODULATOR1) ? connection1 : connection2;
+        return (OpID == CARRIER1 || OpID == CARRIER2) || am;
     }
 
-    if(bank.Ins_Percussion_box.size() < minPercusive)
+    // Real 4-operator mode, operators are chained as MODULATOR1, CARRIER1, MODULATOR2, CARRIER2
+    switch(OpID)
     {
-        tmpPercussion = bank.Ins_Percussion_box;
-        tmpPercussion.reserve(128 - tmpPercussion.size());
-        while(tmpPercussion.size() < 128)
-            tmpPercussion.push_back(FmBank::emptyInst());
-        insPercussion = tmpPercussion.data();
-    }
-    if(bank.Ins_Percussion_box.size() > minPercusive)
-    {
-        tmpPercussion = bank.Ins_Percussion_box;
-        tmpPercussion.resize(minPercusive);
-        insPercussion = tmpPercussion.data();
+    case MODULATOR1:
+        return connection1;
+    case CARRIER1:
+        return !connection1 && connection2;
+    case MODULATOR2:
+        return connection1 && connection2;
+    case CARRIER2:
+    default:
+        return true;
     }
 }
+
+static FmBank::InsStorage makeSize(const FmBank::InsStorage &src, int count)
+{
+    FmBank::InsStorage out = src;
+    if(out.size() != count)
+        out.resize(count);
+    return out;
+}
+
+TmpBank::TmpBank(const FmBank &bank, int minMelodic, int minPercusive) :
+    insMelodic(makeSize(bank.Ins_Melodic_box, minMelodic)),
+    insPercussion(makeSize(bank.Ins_Percussion_box, minPercusive))
+{}
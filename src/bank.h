@@ -20,6 +20,8 @@
 #define BANK_H
 
 #include <QVector>
+#include <QSharedData>
+#include <QSharedDataPointer>
 
 /* *********** FM Operator indexes *********** */
 #define CARRIER1    0
@@ -294,6 +296,13 @@ public:
          */
         void setFBConn2(uint8_t in);
 
+        /*!
+         * \brief Is the operator producing the output sound with current connections
+         * \param OpID Operator type (CARRIER1, MODULATOR1, CARRIER2, MODULATOR2)
+         * \return true if the operator is a carrier of the output signal
+         */
+        bool isOutputOperator(int OpID) const;
+
         /*!
          * \brief Merge operator data to send into 0xE862 register
          * \param OpID Operator type (CARRIER1, MODULATOR1, CARRIER2, MODULATOR2)
@@ -303,6 +312,106 @@ public:
 
     };
 
+    /**
+     * @brief Copy-on-write instruments storage splitted into 128-instrument blocks (one block per MIDI bank)
+     *
+     * Copying of the storage only shares blocks between copies, and every block
+     * gets duplicated on the first non-const access after copying. Therefore,
+     * references and pointers received from non-const access are staying valid
+     * until the storage will be copied, resized, or instruments will be removed.
+     */
+    class InsStorage
+    {
+    public:
+        enum { BlockSize = 128 };
+
+        InsStorage();
+
+        inline int size() const     { return m_size; }
+        inline int count() const    { return m_size; }
+        inline bool isEmpty() const { return m_size == 0; }
+
+        //! Count of 128-instrument blocks
+        inline int blocksCount() const { return m_blocks.size(); }
+
+        inline const Instrument &operator[](int i) const
+        { return m_blocks[i / BlockSize]->ins[i % BlockSize]; }
+        inline Instrument &operator[](int i)
+        { return m_blocks[i / BlockSize]->ins[i % BlockSize]; }
+        inline const Instrument &at(int i) const
+        { return m_blocks[i / BlockSize]->ins[i % BlockSize]; }
+
+        inline const Instrument &last() const { return operator[](m_size - 1); }
+        inline Instrument &last()             { return operator[](m_size - 1); }
+
+        /**
+         * @brief Get the array of 128 instruments of the block (read-only access, no detaching)
+         * @param b Index of the block
+         * @return pointer to first instrument of the block
+         */
+        inline const Instrument *constBlock(int b) const { return m_blocks[b]->ins; }
+
+        /**
+         * @brief Get the array of 128 instruments of the block (detaches the block when it's shared)
+         * @param b Index of the block
+         * @return pointer to first instrument of the block
+         */
+        inline Instrument *block(int b) { return m_blocks[b]->ins; }
+
+        /**
+         * @brief Is the block physically shared with the same block of another storage
+         * @param other Another storage
+         * @param b Index of the block
+         * @return true if both storages are referring the same block data
+         */
+        inline bool isSameBlock(const InsStorage &other, int b) const
+        { return m_blocks[b].constData() == other.m_blocks[b].constData(); }
+
+        /**
+         * @brief Share the content of one block with another block of this storage (no copying)
+         * @param dstBlock Index of destination block
+         * @param srcBlock Index of source block
+         */
+        void cloneBlock(int dstBlock, int srcBlock);
+
+        /**
+         * @brief Change count of instruments, new instruments are null-filled
+         * @param size New count of instruments
+         */
+        void resize(int size);
+        void clear();
+        /**
+         * @brief Preallocate the list of blocks for the given count of instruments
+         * @param size Expected count of instruments
+         */
+        inline void reserve(int size) { m_blocks.reserve((size + BlockSize - 1) / BlockSize); }
+        void push_back(const Instrument &ins);
+        inline void append(const Instrument &ins) { push_back(ins); }
+
+        /**
+         * @brief Fill range of instruments with the given value
+         * @param ins Value to fill
+         * @param from First instrument index
+         * @param count Count of instruments to fill, or -1 to fill until end
+         */
+        void fill(const Instrument &ins, int from = 0, int count = -1);
+
+        void remove(int i);
+        void remove(int i, int count);
+
+        bool operator==(const InsStorage &other) const;
+        inline bool operator!=(const InsStorage &other) const { return !operator==(other); }
+
+    private:
+        struct Block : public QSharedData
+        {
+            Block();
+            Instrument ins[BlockSize];
+        };
+        QVector<QSharedDataPointer<Block> > m_blocks;
+        int m_size;
+    };
+
     struct MidiBank
     {
         //! Custom bank name
@@ -358,7 +467,7 @@ public:
      * @brief lsb MIDI bank LSB index
      * @brief percussive true iff it's a drum bank
      * @brief pBank unless null, receives a pointer to the MIDI bank instance
-     * @brief pIns unless null, receives a pointer to the first instrument
+     * @brief pIns unless null, receives a pointer to the first instrument (128 instruments block)
      * @return true if the bank exists, false if it doesn't
      */
     bool getBank(uint8_t msb, uint8_t lsb, bool percussive,
@@ -370,39 +479,37 @@ public:
      * @brief lsb MIDI bank LSB index
      * @brief percussive true iff it's a drum bank
      * @brief pBank unless null, receives a pointer to the MIDI bank instance
-     * @brief pIns unless null, receives a pointer to the first instrument
+     * @brief pIns unless null, receives a pointer to the first instrument (128 instruments block)
      * @return true if the bank is created, false if it already exists
      */
     bool createBank(uint8_t msb, uint8_t lsb, bool percussive,
                     MidiBank **pBank, Instrument **pIns);
 
-    //! Pointer to array of melodic instruments
-    Instrument* Ins_Melodic;
-    //! Pointer to array of percussion instruments
-    Instrument* Ins_Percussion;
     //! Array of melodic instruments
-    QVector<Instrument> Ins_Melodic_box;
+    InsStorage          Ins_Melodic_box;
     //! Array of percussion instruments
-    QVector<Instrument> Ins_Percussion_box;
+    InsStorage          Ins_Percussion_box;
     //! Array of melodic MIDI bank meta-data per every index
     QVector<MidiBank>   Banks_Melodic;
     //! Array of percussion MIDI bank meta-data per every index
     QVector<MidiBank>   Banks_Percussion;
 };
 
+/**
+ * @brief Read-only view of the bank with exact count of melodic and percussion instruments
+ *
+ * Missing instruments are null-filled, extra instruments are cut, existing instruments
+ * are shared with the source bank without copying.
+ */
 class TmpBank
 {
 public:
-    TmpBank(FmBank &bank, int minMelodic, int minPercusive);
+    TmpBank(const FmBank &bank, int minMelodic, int minPercusive);
 
-    //! Pointer to array of melodic instruments
-    FmBank::Instrument* insMelodic;
-    //! Pointer to array of percussion instruments
-    FmBank::Instrument* insPercussion;
     //! Array of melodic instruments
-    QVector<FmBank::Instrument> tmpMelodic;
+    const FmBank::InsStorage insMelodic;
     //! Array of percussion instruments
-    QVector<FmBank::Instrument> tmpPercussion;
+    const FmBank::InsStorage insPercussion;
 };
 
 #endif // BANK_H
@@ -93,22 +93,25 @@ std::set<uint32_t> BankCompareDialog::collectIds(const FmBank &fmb)
 {
     std::set<uint32_t> ids;
 
-    unsigned melo = fmb.Banks_Melodic.size();
-    unsigned drum = fmb.Banks_Percussion.size();
-
-    for(unsigned i = 0, n = melo + drum; i < n; ++i)
+    for(int perc = 0; perc < 2; ++perc)
     {
-        const FmBank::MidiBank &mb = (i < melo) ?
-            fmb.Banks_Melodic[i] : fmb.Banks_Percussion[i - melo];
-        const FmBank::Instrument *ins = (i < melo) ?
-            &fmb.Ins_Melodic[i * 128] : &fmb.Ins_Percussion[(i - melo) * 128];
+        const QVector<FmBank::MidiBank> &banks = perc ? fmb.Banks_Percussion : fmb.Banks_Melodic;
+        const FmBank::InsStorage &box = perc ? fmb.Ins_Percussion_box : fmb.Ins_Melodic_box;
 
-        for(unsigned j = 0; j < 128; ++j)
+        for(int b = 0; b < banks.size() && b < box.blocksCount(); ++b)
         {
-            if(!ins[j].is_blank)
+            const FmBank::MidiBank &mb = banks[b];
+            // Read the block directly, the blankness is the only needed thing
+            const FmBank::Instrument *ins = box.constBlock(b);
+            int count = qMin(int(FmBank::InsStorage::BlockSize), box.size() - b * FmBank::InsStorage::BlockSize);
+
+            for(int j = 0; j < count; ++j)
             {
-                uint32_t id = ((i >= melo) << 24) | (mb.msb << 16) | (mb.lsb << 8) | j;
-                ids.insert(id);
+                if(!ins[j].is_blank)
+                {
+                    uint32_t id = (uint32_t(perc) << 24) | (mb.msb << 16) | (mb.lsb << 8) | uint32_t(j);
+                    ids.insert(id);
+                }
             }
         }
     }
@@ -346,11 +349,7 @@ QString BankCompareDialog::nameOfInstrument(unsigned spec, const FmBank::Instrum
     MidiProgramId pr = MidiProgramId((id >> 24) != 0, (id >> 16) & 127, (id >> 8) & 127, id & 127);
 
     unsigned specObtained = kMidiSpecXG;
-    const MidiProgram *p = getMidiProgram(pr, spec, &specObtained);
-    if(isFallback)
-        *isFallback = (p == nullptr);
-
-    p = p ? p : getFallbackProgram(pr, spec, &specObtained);
+    const MidiProgram *p = findMidiProgram(pr, spec, &specObtained, isFallback);
     return p ? p->patchName : tr("<Reserved %1>").arg(id & 127);
 }
 
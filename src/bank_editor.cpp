@@ -26,6 +26,7 @@
 #include <QClipboard>
 #include <QActionGroup>
 #include <QtDebug>
+#include <algorithm>
 
 #include "importer.h"
 #include "formats_sup.h"
@@ -33,6 +34,7 @@
 #include "ui_bank_editor.h"
 #include "operator_editor.h"
 #include "bank_comparison.h"
+#include "bank_transform_dialog.h"
 #include "audio_config.h"
 #include "hardware.h"
 #include "ins_names.h"
@@ -51,22 +53,12 @@
 #include "FileFormats/ffmt_enums.h"
 
 #include "opl/measurer.h"
+#include "opl/register_log.h"
+#include "instruments_model.h"
 
 #include "common.h"
 #include "version.h"
 
-#define INS_INDEX   (Qt::UserRole)
-#define INS_BANK_ID (Qt::UserRole + 1)
-#define INS_INS_ID  (Qt::UserRole + 2)
-
-static void setInstrumentMetaInfo(QListWidgetItem *item, int index)
-{
-    item->setData(INS_INDEX, index);
-    item->setData(INS_BANK_ID, index / 128);
-    item->setData(INS_INS_ID, index % 128);
-    item->setToolTip(QObject::tr("Bank %1, ID: %2").arg(index / 128).arg(index % 128));
-}
-
 static QIcon makeWindowIcon()
 {
     QIcon icon;
@@ -81,8 +73,9 @@ BankEditor::BankEditor(QWidget *parent) :
     ui(new Ui::BankEditor)
 {
     FmBankFormatFactory::registerAllFormats();
-    m_curInst = nullptr;
-    m_curInstBackup = nullptr;
+    m_curInstBank = nullptr;
+    m_curInstNum = -1;
+    m_curInstPerc = false;
     m_lock = false;
     m_recentFormat = BankFormats::FORMATS_DEFAULT_FORMAT;
     m_currentFileFormat = BankFormats::FORMAT_UNKNOWN;
@@ -112,6 +105,12 @@ BankEditor::BankEditor(QWidget *parent) :
     connect(actionGroupStandard, SIGNAL(triggered(QAction *)),
             this, SLOT(reloadBankNames()));
 
+    m_instrumentsModel = new InstrumentsModel(this);
+    m_instrumentsModel->setBank(&m_bank);
+    ui->instruments->setModel(m_instrumentsModel);
+    connect(ui->instruments->selectionModel(), SIGNAL(currentChanged(QModelIndex,QModelIndex)),
+            this, SLOT(onInstrumentCurrentChanged(QModelIndex,QModelIndex)));
+
     setMelodic();
     connect(ui->melodic,    SIGNAL(clicked(bool)),  this,   SLOT(setMelodic()));
     connect(ui->percussion, SIGNAL(clicked(bool)),  this,   SLOT(setDrums()));
@@ -125,6 +124,7 @@ BankEditor::BankEditor(QWidget *parent) :
 #endif
     m_importer = new Importer(this);
     m_measurer = new Measurer(this);
+    connect(m_measurer, SIGNAL(instrumentMeasured(bool,int)), this, SLOT(onInstrumentMeasured(bool,int)));
     connect(ui->actionImport, SIGNAL(triggered()), m_importer, SLOT(show()));
     connect(ui->actionEmulatorNuked, SIGNAL(triggered()), this, SLOT(toggleEmulator()));
     connect(ui->actionEmulatorDosBox, SIGNAL(triggered()), this, SLOT(toggleEmulator()));
@@ -135,6 +135,20 @@ BankEditor::BankEditor(QWidget *parent) :
     connect(ui->actionWin9xOPLProxy, SIGNAL(triggered()), this, SLOT(toggleEmulator()));
     connect(ui->actionSerialPortOPL, SIGNAL(triggered()), this, SLOT(toggleEmulator()));
 
+    m_actionGroupChips = new QActionGroup(this);
+    ui->actionChips1->setData(1);
+    ui->actionChips2->setData(2);
+    ui->actionChips4->setData(4);
+    ui->actionChips8->setData(8);
+    m_actionGroupChips->addAction(ui->actionChips1);
+    m_actionGroupChips->addAction(ui->actionChips2);
+    m_actionGroupChips->addAction(ui->actionChips4);
+    m_actionGroupChips->addAction(ui->actionChips8);
+    m_actionGroupChips->setExclusive(true);
+    ui->actionChips1->setChecked(true);
+    connect(m_actionGroupChips, SIGNAL(triggered(QAction *)),
+            this, SLOT(toggleChipsCount(QAction *)));
+
 #ifdef ENABLE_HW_OPL_PROXY
     m_proxyOpl = &Generator::oplProxy();
 #else
@@ -240,10 +254,12 @@ void BankEditor::loadSettings()
             chipEmulator = Generator::CHIP_BEGIN;
         m_currentChip = static_cast<Generator::OPL_Chips>(chipEmulator);
     }
+    m_chipsCount = setup.value("chips-count", 1).toInt();
     m_language = setup.value("language").toString();
     m_audioLatency = setup.value("audio-latency", audioDefaultLatency).toDouble();
     m_audioDevice = setup.value("audio-device", QString()).toString();
     m_audioDriver = setup.value("audio-driver", QString()).toString();
+    ui->actionTieredMeasurement->setChecked(setup.value("measure-tiered", false).toBool());
 
 #ifdef ENABLE_HW_OPL_PROXY
     m_proxyOplAddress = setup.value("hw-opl-address", 0x388).toUInt();
@@ -308,6 +324,13 @@ void BankEditor::loadSettings()
         break;
     }
 
+    for(QAction *action : m_actionGroupChips->actions())
+    {
+        if(action->data().toInt() == m_chipsCount)
+            action->setChecked(true);
+    }
+    m_chipsCount = m_actionGroupChips->checkedAction()->data().toInt();
+
     switch(preferredMidiStandard)
     {
     case 0: // GM
@@ -334,10 +357,12 @@ void BankEditor::saveSettings()
     setup.setValue("deep-vibrato", ui->deepVibrato->isChecked());
     setup.setValue("recent-path", m_recentPath);
     setup.setValue("chip-emulator", (int)m_currentChip);
+    setup.setValue("chips-count", m_chipsCount);
     setup.setValue("language", m_language);
     setup.setValue("audio-latency", m_audioLatency);
     setup.setValue("audio-device", m_audioDevice);
     setup.setValue("audio-driver", m_audioDriver);
+    setup.setValue("measure-tiered", ui->actionTieredMeasurement->isChecked());
 
 #ifdef ENABLE_HW_OPL_PROXY
     setup.setValue("hw-opl-address", m_proxyOplAddress);
@@ -454,31 +479,22 @@ void BankEditor::onLanguageChanged()
 
 void BankEditor::initFileData(QString &filePath)
 {
+    m_measurer->cancelScheduledMeasurements();
     m_recentPath = QFileInfo(filePath).absoluteDir().absolutePath();
     m_recentBankFilePath = filePath;
 
-    if(!ui->instruments->selectedItems().isEmpty())
+    QModelIndexList selected = ui->instruments->selectionModel()->selectedIndexes();
+    if(!selected.isEmpty())
     {
-        int idOfSelected = ui->instruments->selectedItems().first()->data(Qt::UserRole).toInt();
+        int idOfSelected = m_instrumentsModel->instrumentIndex(selected.first());
         if(ui->melodic->isChecked())
             setMelodic();
         else
             setDrums();
-        ui->instruments->clearSelection();
-        QList<QListWidgetItem *> items = ui->instruments->findItems("*", Qt::MatchWildcard);
-        for(int i = 0; i < items.size(); i++)
-        {
-            if(items[i]->data(Qt::UserRole).toInt() == idOfSelected)
-            {
-                items[i]->setSelected(true);
-                break;
-            }
-        }
-        if(!ui->instruments->selectedItems().isEmpty())
-            on_instruments_currentItemChanged(ui->instruments->selectedItems().first(), NULL);
+        selectInstrument(idOfSelected);
     }
     else
-        on_instruments_currentItemChanged(NULL, NULL);
+        onInstrumentCurrentChanged(QModelIndex(), QModelIndex());
 
     ui->currentFile->setText(filePath);
     m_currentFilePath = filePath;
@@ -641,8 +657,9 @@ bool BankEditor::saveBankFile(QString filePath, BankFormats format)
 
 bool BankEditor::saveInstrumentFile(QString filePath, InstFormats format)
 {
-    Q_ASSERT(m_curInst);
-    FfmtErrCode err = FmBankFormatFactory::SaveInstrumentFile(filePath, *m_curInst, format, ui->percussion->isChecked());
+    const FmBank::Instrument *inst = curInstConst();
+    Q_ASSERT(inst);
+    FfmtErrCode err = FmBankFormatFactory::SaveInstrumentFile(filePath, *inst, format, ui->percussion->isChecked());
     if(err != FfmtErrCode::ERR_OK)
     {
         QString errText;
@@ -714,7 +731,7 @@ bool BankEditor::saveFileAs(const QString &optionalFilePath)
 
 bool BankEditor::saveInstFileAs()
 {
-    if(!m_curInst)
+    if(!curInstConst())
     {
         QMessageBox::information(this,
                                  tr("Nothing to save"),
@@ -748,26 +765,6 @@ bool BankEditor::askForSaving()
     return true;
 }
 
-QString BankEditor::getInstrumentName(int instrument, bool isAuto, bool isPerc) const
-{
-    int index = ui->bank_no->currentIndex();
-    QString name = tr("<Unknown>");
-    if(index >= 0)
-    {
-        if(isAuto)
-            isPerc = isDrumsMode();
-        int lsb = ui->bank_lsb->value();
-        int msb = ui->bank_msb->value();
-        MidiProgramId pr = MidiProgramId(isPerc, msb, lsb, instrument % 128);
-        unsigned spec = getSelectedMidiSpec();
-        unsigned specObtained = kMidiSpecXG;
-        const MidiProgram *p = getMidiProgram(pr, spec, &specObtained);
-        p = p ? p : getFallbackProgram(pr, spec, &specObtained);
-        name = p ? p->patchName : tr("<Reserved %1>").arg(instrument % 128);
-    }
-    return name;
-}
-
 QString BankEditor::getBankName(int bank, bool isAuto, bool isPerc)
 {
     QString name;
@@ -800,33 +797,22 @@ unsigned BankEditor::getSelectedMidiSpec() const
 void BankEditor::flushInstrument()
 {
     loadInstrument();
-    if(m_curInst && ui->percussion->isChecked())
-        ui->noteToTest->setValue(m_curInst->percNoteNum);
+    const FmBank::Instrument *inst = curInstConst();
+    if(inst && ui->percussion->isChecked())
+        ui->noteToTest->setValue(inst->percNoteNum);
     sendPatch();
 }
 
 void BankEditor::syncInstrumentName()
 {
-    QListWidgetItem *curInstr = ui->instruments->currentItem();
-    if(m_curInst && curInstr)
-    {
-        curInstr->setText(
-            m_curInst->name[0] != '\0' ?
-                    QString::fromUtf8(m_curInst->name) :
-                    getInstrumentName(m_recentNum)
-        );
-    }
     syncInstrumentBlankness();
 }
 
 void BankEditor::syncInstrumentBlankness()
 {
-    QListWidgetItem *curInstr = ui->instruments->currentItem();
-    if(m_curInst && curInstr)
-    {
-        curInstr->setForeground(m_curInst->is_blank ?
-                                Qt::gray : Qt::black);
-    }
+    // The list takes the name and the state from the bank itself
+    if(curInstConst() && (m_curInstBank == &m_bank) && (m_curInstPerc == m_instrumentsModel->isPercussion()))
+        m_instrumentsModel->instrumentChanged(m_curInstNum);
 }
 
 void BankEditor::on_actionNew_triggered()
@@ -838,11 +824,12 @@ void BankEditor::on_actionNew_triggered()
     m_currentFilePath.clear();
     m_currentFileFormat = BankFormats::FORMAT_UNKNOWN;
     ui->instruments->clearSelection();
+    m_measurer->cancelScheduledMeasurements();
     m_bank.reset();
     m_bank.Ins_Melodic_box.fill(FmBank::blankInst());
     m_bank.Ins_Percussion_box.fill(FmBank::blankInst(true));
     m_bankBackup.reset();
-    on_instruments_currentItemChanged(NULL, NULL);
+    onInstrumentCurrentChanged(QModelIndex(), QModelIndex());
     reloadInstrumentNames();
     reloadBanks();
 }
@@ -883,8 +870,9 @@ void BankEditor::on_actionExit_triggered()
 
 void BankEditor::on_actionCopy_triggered()
 {
-    if(!m_curInst) return;
-    QByteArray data((char *)m_curInst, sizeof(FmBank::Instrument));
+    const FmBank::Instrument *inst = curInstConst();
+    if(!inst) return;
+    QByteArray data((const char *)inst, sizeof(FmBank::Instrument));
     QMimeData *md = new QMimeData;
     md->setData("application/x-vnd.wohlstand.opl3-fm-instrument", data);
     QApplication::clipboard()->setMimeData(md);
@@ -902,82 +890,91 @@ static bool instrumentFromClipboard(FmBank::Instrument &inst)
 
 void BankEditor::on_actionPaste_triggered()
 {
-    if(!m_curInst || !instrumentFromClipboard(*m_curInst)) return;
+    FmBank::Instrument clipboardInst;
+    if(!curInstConst() || !instrumentFromClipboard(clipboardInst)) return;
+    *curInst() = clipboardInst;
     flushInstrument();
     syncInstrumentName();
 }
 
 void BankEditor::on_actionPasteVoice11_triggered()
 {
-    if(!m_curInst) return;
+    if(!curInstConst()) return;
     FmBank::Instrument clipboardInst;
     if(!instrumentFromClipboard(clipboardInst)) return;
+    FmBank::Instrument *inst = curInst();
     size_t buffSize = sizeof(FmBank::Operator) * 2;
-    m_curInst->feedback1 = clipboardInst.feedback1;
-    m_curInst->connection1 = clipboardInst.connection1;
-    m_curInst->note_offset1 = clipboardInst.note_offset1;
-    memcpy(m_curInst->OP, clipboardInst.OP, buffSize);
+    inst->feedback1 = clipboardInst.feedback1;
+    inst->connection1 = clipboardInst.connection1;
+    inst->note_offset1 = clipboardInst.note_offset1;
+    memcpy(inst->OP, clipboardInst.OP, buffSize);
     flushInstrument();
 }
 
 void BankEditor::on_actionPasteVoice12_triggered()
 {
-    if(!m_curInst) return;
+    if(!curInstConst()) return;
     FmBank::Instrument clipboardInst;
     if(!instrumentFromClipboard(clipboardInst)) return;
+    FmBank::Instrument *inst = curInst();
     size_t buffSize = sizeof(FmBank::Operator) * 2;
-    m_curInst->feedback2 = clipboardInst.feedback1;
-    m_curInst->connection2 = clipboardInst.connection1;
-    m_curInst->note_offset2 = clipboardInst.note_offset1;
-    memcpy(m_curInst->OP + 2, clipboardInst.OP, buffSize);
+    inst->feedback2 = clipboardInst.feedback1;
+    inst->connection2 = clipboardInst.connection1;
+    inst->note_offset2 = clipboardInst.note_offset1;
+    memcpy(inst->OP + 2, clipboardInst.OP, buffSize);
     flushInstrument();
 }
 
 void BankEditor::on_actionPasteVoice21_triggered()
 {
-    if(!m_curInst) return;
+    if(!curInstConst()) return;
     FmBank::Instrument clipboardInst;
     if(!instrumentFromClipboard(clipboardInst)) return;
+    FmBank::Instrument *inst = curInst();
     size_t buffSize = sizeof(FmBank::Operator) * 2;
-    m_curInst->feedback1 = clipboardInst.feedback2;
-    m_curInst->connection1 = clipboardInst.connection2;
-    m_curInst->note_offset1 = clipboardInst.note_offset2;
-    memcpy(m_curInst->OP, clipboardInst.OP + 2, buffSize);
+    inst->feedback1 = clipboardInst.feedback2;
+    inst->connection1 = clipboardInst.connection2;
+    inst->note_offset1 = clipboardInst.note_offset2;
+    memcpy(inst->OP, clipboardInst.OP + 2, buffSize);
     flushInstrument();
 }
 
 void BankEditor::on_actionPasteVoice22_triggered()
 {
-    if(!m_curInst) return;
+    if(!curInstConst()) return;
     FmBank::Instrument clipboardInst;
     if(!instrumentFromClipboard(clipboardInst)) return;
+    FmBank::Instrument *inst = curInst();
     size_t buffSize = sizeof(FmBank::Operator) * 2;
-    m_curInst->feedback2 = clipboardInst.feedback2;
-    m_curInst->connection2 = clipboardInst.connection2;
-    m_curInst->note_offset2 = clipboardInst.note_offset2;
-    memcpy(m_curInst->OP + 2, clipboardInst.OP + 2, buffSize);
+    inst->feedback2 = clipboardInst.feedback2;
+    inst->connection2 = clipboardInst.connection2;
+    inst->note_offset2 = clipboardInst.note_offset2;
+    memcpy(inst->OP + 2, clipboardInst.OP + 2, buffSize);
     flushInstrument();
 }
 
 void BankEditor::on_actionSwapVoices_triggered()
 {
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     size_t buffSize = sizeof(FmBank::Operator) * 2;
     FmBank::Operator buffer[2];
-    std::swap(m_curInst->feedback1, m_curInst->feedback2);
-    std::swap(m_curInst->connection1, m_curInst->connection2);
-    std::swap(m_curInst->note_offset1, m_curInst->note_offset2);
-    memcpy(buffer, m_curInst->OP, buffSize);
-    memcpy(m_curInst->OP, m_curInst->OP + 2, buffSize);
-    memcpy(m_curInst->OP + 2, buffer, buffSize);
+    std::swap(inst->feedback1, inst->feedback2);
+    std::swap(inst->connection1, inst->connection2);
+    std::swap(inst->note_offset1, inst->note_offset2);
+    memcpy(buffer, inst->OP, buffSize);
+    memcpy(inst->OP, inst->OP + 2, buffSize);
+    memcpy(inst->OP + 2, buffer, buffSize);
     flushInstrument();
 }
 
 void BankEditor::on_actionReset_current_instrument_triggered()
 {
-    if(!m_curInstBackup || !m_curInst)
+    const FmBank::Instrument *inst = curInstConst();
+    const FmBank::Instrument *instBackup = curInstBackup();
+    if(!instBackup || !inst)
         return; //Some pointer is Null!!!
-    if(memcmp(m_curInst, m_curInstBackup, sizeof(FmBank::Instrument)) == 0)
+    if(memcmp(inst, instBackup, sizeof(FmBank::Instrument)) == 0)
         return; //Nothing to do
     if(QMessageBox::Yes == QMessageBox::question(this,
             tr("Reset instrument to initial state"),
@@ -986,7 +983,8 @@ void BankEditor::on_actionReset_current_instrument_triggered()
                "Do you wish to continue?"),
             QMessageBox::Yes | QMessageBox::No))
     {
-        memcpy(m_curInst, m_curInstBackup, sizeof(FmBank::Instrument));
+        FmBank::Instrument backup = *instBackup;
+        *curInst() = backup;
         flushInstrument();
         syncInstrumentName();
     }
@@ -1003,7 +1001,15 @@ void BankEditor::on_actionReMeasure_triggered()
     if(reply == QMessageBox::Yes)
     {
         if(m_measurer->doMeasurement(m_bank, m_bankBackup, true))
-            statusBar()->showMessage(tr("Sounding delays calculation has been completed!"), 5000);
+        {
+            const Measurer::MeasureReport &report = m_measurer->lastReport();
+            if(m_measurer->measureMode() == Measurer::MEASURE_TIERED)
+                statusBar()->showMessage(tr("Sounding delays calculation has been completed! "
+                                            "%1 of %2 instruments were confirmed by Nuked OPL3, %3 of them were corrected.")
+                                         .arg(report.confirmed).arg(report.measured).arg(report.corrected), 10000);
+            else
+                statusBar()->showMessage(tr("Sounding delays calculation has been completed!"), 5000);
+        }
         else
             statusBar()->showMessage(tr("Sounding delays calculation was canceled!"), 5000);
     }
@@ -1011,8 +1017,7 @@ void BankEditor::on_actionReMeasure_triggered()
 
 void BankEditor::on_actionReMeasureOne_triggered()
 {
-    FmBank::Instrument *inst = m_curInst;
-    FmBank::Instrument *instBackup = m_curInstBackup;
+    const FmBank::Instrument *inst = curInstConst();
     if(!inst)
     {
         QMessageBox::information(this,
@@ -1030,25 +1035,29 @@ void BankEditor::on_actionReMeasureOne_triggered()
 
     if(m_measurer->doMeasurement(workInst))
     {
-        *instBackup = *inst;
-        *inst = workInst;
+        if(curInstBackup())
+        {
+            FmBank::InsStorage &backupBox = m_curInstPerc ? m_bankBackup.Ins_Percussion_box : m_bankBackup.Ins_Melodic_box;
+            backupBox[m_curInstNum] = *inst;
+        }
+        *curInst() = workInst;
         loadInstrument();
     }
 }
 
 void BankEditor::on_actionChipsBenchmark_triggered()
 {
-    if(m_curInst)
+    if(const FmBank::Instrument *inst = curInstConst())
     {
         QVector<Measurer::BenchmarkResult> res;
-        m_measurer->runBenchmark(*m_curInst, res);
+        m_measurer->runBenchmark(*inst, res);
         QString resStr;
         for(Measurer::BenchmarkResult &r : res)
             resStr += tr("%1 passed in %2 milliseconds.\n").arg(r.name).arg(r.elapsed);
         QMessageBox::information(this,
                                  tr("Benchmark result"),
                                  tr("Result of emulators benchmark based on '%1' instrument:\n\n%2")
-                                 .arg(QString::fromUtf8(m_curInst->name))
+                                 .arg(QString::fromUtf8(inst->name))
                                  .arg(resStr)
                                  );
     }
@@ -1084,10 +1093,155 @@ void BankEditor::on_actionCompareWith_triggered()
     dlg.exec();
 }
 
+void BankEditor::on_actionBulkTransform_triggered()
+{
+    BankTransformDialog dlg(this);
+    if(dlg.exec() != QDialog::Accepted)
+        return;
+
+    BankTransform transform;
+    if(!transform.addOperation(dlg.operation()))
+    {
+        QMessageBox::warning(this,
+                             tr("Bulk transform"),
+                             tr("Unknown instrument parameter is selected."));
+        return;
+    }
+
+    bool isPerc = isDrumsMode();
+    FmBank::InsStorage &box = isPerc ? m_bank.Ins_Percussion_box : m_bank.Ins_Melodic_box;
+    QVector<int> changed, changedOther;
+
+    switch(dlg.scope())
+    {
+    case BankTransformDialog::SCOPE_INSTRUMENT:
+        if(!curInstConst() || m_recentNum < 0)
+        {
+            QMessageBox::information(this,
+                                     tr("Instrument is not selected"),
+                                     tr("Please select an instrument first!"));
+            return;
+        }
+        transform.apply(box, QVector<int>() << m_recentNum, &changed);
+        break;
+    case BankTransformDialog::SCOPE_BANK:
+        transform.apply(box, BankTransform::bankIndices(box, ui->bank_no->currentIndex()), &changed);
+        break;
+    case BankTransformDialog::SCOPE_FILE:
+    {
+        FmBank::InsStorage &other = isPerc ? m_bank.Ins_Melodic_box : m_bank.Ins_Percussion_box;
+        transform.apply(box, BankTransform::allIndices(box), &changed);
+        transform.apply(other, BankTransform::allIndices(other), &changedOther);
+        break;
+    }
+    }
+
+    // Refresh the list and the patch of the edited instrument
+    reloadInstrumentNames();
+    flushInstrument();
+
+    // Only changed instruments are going to be re-measured
+    if(dlg.remeasure() && transform.affectsSound())
+    {
+        FmBank::InsStorage &other = isPerc ? m_bank.Ins_Melodic_box : m_bank.Ins_Percussion_box;
+        if(!m_measurer->doMeasurement(box, changed) ||
+           !m_measurer->doMeasurement(other, changedOther))
+        {
+            statusBar()->showMessage(tr("Sounding delays calculation was canceled!"), 5000);
+            return;
+        }
+        displayDebugDelaysInfo();
+    }
+
+    statusBar()->showMessage(tr("%1 instruments have been changed.")
+                             .arg(changed.size() + changedOther.size()), 5000);
+}
+
+static double loudnessSpread(const QVector<Measurer::LoudnessInfo> &info, double *median)
+{
+    QVector<double> values;
+    for(const Measurer::LoudnessInfo &li : info)
+    {
+        if(li.valid && !li.nosound)
+            values.push_back(li.rms_db);
+    }
+
+    if(values.isEmpty())
+        return 0.0;
+
+    std::sort(values.begin(), values.end());
+    if(median)
+        *median = values[values.size() / 2];
+    return values.back() - values.front();
+}
+
+void BankEditor::on_actionNormalizeLoudness_triggered()
+{
+    // Every melodic instrument of every MIDI bank, whatever is shown in the list now
+    FmBank::InsStorage &box = m_bank.Ins_Melodic_box;
+    QVector<int> indices = BankTransform::allIndices(box);
+
+    QVector<Measurer::LoudnessInfo> before;
+    if(!m_measurer->doLoudnessAnalysis(box, indices, before))
+    {
+        statusBar()->showMessage(tr("Loudness analysis was canceled!"), 5000);
+        return;
+    }
+
+    double median = -120.0;
+    double spreadBefore = loudnessSpread(before, &median);
+    if(median <= -120.0)
+    {
+        QMessageBox::information(this,
+                                 tr("Nothing to normalize"),
+                                 tr("The bank has no sounding melodic instruments."));
+        return;
+    }
+
+    bool ok = false;
+    double target = QInputDialog::getDouble(this,
+                                            tr("Normalize loudness"),
+                                            tr("Target RMS loudness, dBFS:"),
+                                            median, -96.0, 0.0, 1, &ok);
+    if(!ok)
+        return;
+
+    QVector<int> changed;
+    if(!m_measurer->normalizeLoudness(box, indices, target, 0.75, &changed))
+    {
+        statusBar()->showMessage(tr("Loudness normalization was canceled!"), 5000);
+        loadInstrument();
+        return;
+    }
+
+    loadInstrument();
+
+    // Levels are affecting the sounding time, so changed instruments are re-measured
+    if(!changed.isEmpty())
+    {
+        if(!m_measurer->doMeasurement(box, changed))
+            statusBar()->showMessage(tr("Sounding delays calculation was canceled!"), 5000);
+        else
+            displayDebugDelaysInfo();
+    }
+
+    QVector<Measurer::LoudnessInfo> after;
+    m_measurer->doLoudnessAnalysis(box, indices, after);
+    double spreadAfter = loudnessSpread(after, nullptr);
+
+    QMessageBox::information(this,
+                             tr("Normalize loudness"),
+                             tr("%1 instruments have been changed.\n"
+                                "Loudness spread: %2 dB before, %3 dB after.")
+                             .arg(changed.size())
+                             .arg(spreadBefore, 0, 'f', 1)
+                             .arg(spreadAfter, 0, 'f', 1));
+}
+
 #if defined(ENABLE_PLOTS)
 void BankEditor::on_actionDelayAnalysis_triggered()
 {
-    FmBank::Instrument *inst = m_curInst;
+    const FmBank::Instrument *inst = curInstConst();
     if(!inst)
     {
         QMessageBox::information(this,
@@ -1131,23 +1285,59 @@ void BankEditor::on_actionAbout_triggered()
                        .arg("https://github.com/Wohlstand/OPL3BankEditor"));
 }
 
-void BankEditor::on_instruments_currentItemChanged(QListWidgetItem *current, QListWidgetItem *)
+void BankEditor::onInstrumentCurrentChanged(const QModelIndex &current, const QModelIndex &)
 {
-    if(!current)
+    if(m_instrumentSelectionLock)
+        return;
+
+    if(!current.isValid())
     {
         //ui->curInsInfo->setText("<Not Selected>");
-        m_curInst = nullptr;
-        m_curInstBackup = nullptr;
+        setEditedInstrument(nullptr, -1, false);
     }
     else
     {
-        //ui->curInsInfo->setText(QString("%1 - %2").arg(current->data(Qt::UserRole).toInt()).arg(current->text()));
-        setCurrentInstrument(current->data(Qt::UserRole).toInt(), ui->percussion->isChecked());
+        //ui->curInsInfo->setText(QString("%1 - %2").arg(m_instrumentsModel->instrumentIndex(current)).arg(current.data().toString()));
+        setCurrentInstrument(m_instrumentsModel->instrumentIndex(current), ui->percussion->isChecked());
     }
 
     flushInstrument();
 }
 
+bool BankEditor::selectInstrument(int index)
+{
+    QModelIndex mi = m_instrumentsModel->indexOfInstrument(index);
+    if(!mi.isValid())
+        return false;
+
+    QItemSelectionModel *sel = ui->instruments->selectionModel();
+    if(sel->currentIndex() == mi)
+    {
+        sel->select(mi, QItemSelectionModel::ClearAndSelect);
+        onInstrumentCurrentChanged(mi, QModelIndex());
+    }
+    else
+        sel->setCurrentIndex(mi, QItemSelectionModel::ClearAndSelect);
+    ui->instruments->scrollTo(mi);
+    return true;
+}
+
+void BankEditor::showCurrentInstrument()
+{
+    // Skip the instrument of the importer which is being tested
+    if(!curInstConst() || (m_curInstBank != &m_bank) || (m_curInstPerc != m_instrumentsModel->isPercussion()))
+        return;
+
+    QModelIndex mi = m_instrumentsModel->indexOfInstrument(m_recentNum);
+    if(!mi.isValid())
+        return;
+
+    m_instrumentSelectionLock = true;
+    ui->instruments->selectionModel()->setCurrentIndex(mi, QItemSelectionModel::ClearAndSelect);
+    m_instrumentSelectionLock = false;
+    ui->instruments->scrollTo(mi);
+}
+
 void BankEditor::toggleEmulator()
 {
     QObject *menuItem = sender();
@@ -1217,30 +1407,61 @@ void BankEditor::toggleEmulator()
     }
 }
 
+void BankEditor::toggleChipsCount(QAction *action)
+{
+    m_chipsCount = action->data().toInt();
+    m_generator->ctl_setChipsCount(m_chipsCount);
+}
+
 
 void BankEditor::setCurrentInstrument(int num, bool isPerc)
 {
     m_recentNum = num;
     m_recentPerc = isPerc;
 
-    if(num >= 0)
-    {
-        m_curInst = isPerc ? &m_bank.Ins_Percussion[num] : &m_bank.Ins_Melodic[num];
-        m_curInstBackup = isPerc ?
-                          (num < m_bankBackup.countDrums() ? &m_bankBackup.Ins_Percussion[num] : nullptr) :
-                          (num < m_bankBackup.countMelodic() ? &m_bankBackup.Ins_Melodic[num] : nullptr);
-    }
-    else
-    {
-        m_curInst = nullptr;
-        m_curInstBackup = nullptr;
-    }
+    setEditedInstrument(num >= 0 ? &m_bank : nullptr, num, isPerc);
+}
+
+void BankEditor::setEditedInstrument(FmBank *bank, int num, bool isPerc)
+{
+    m_curInstBank = bank;
+    m_curInstNum = bank ? num : -1;
+    m_curInstPerc = isPerc;
+}
+
+FmBank::Instrument *BankEditor::curInst()
+{
+    if(!curInstConst())
+        return nullptr;
+    FmBank::InsStorage &box = m_curInstPerc ? m_curInstBank->Ins_Percussion_box : m_curInstBank->Ins_Melodic_box;
+    return &box[m_curInstNum];
+}
+
+const FmBank::Instrument *BankEditor::curInstConst() const
+{
+    if(!m_curInstBank || (m_curInstNum < 0))
+        return nullptr;
+    const FmBank::InsStorage &box = m_curInstPerc ? m_curInstBank->Ins_Percussion_box : m_curInstBank->Ins_Melodic_box;
+    if(m_curInstNum >= box.size())
+        return nullptr;
+    return &box.at(m_curInstNum);
+}
+
+const FmBank::Instrument *BankEditor::curInstBackup() const
+{
+    // The instrument of the importer has no backup
+    if(!curInstConst() || (m_curInstBank != &m_bank))
+        return nullptr;
+    const FmBank::InsStorage &box = m_curInstPerc ? m_bankBackup.Ins_Percussion_box : m_bankBackup.Ins_Melodic_box;
+    if(m_curInstNum >= box.size())
+        return nullptr;
+    return &box.at(m_curInstNum);
 }
 
 void BankEditor::loadInstrument()
 {
     displayDebugDelaysInfo();
-    if(!m_curInst)
+    if(!curInstConst())
     {
         ui->editzone->setEnabled(false);
         ui->editzone2->setEnabled(false);
@@ -1255,57 +1476,80 @@ void BankEditor::loadInstrument()
 
     if(ui->melodic->isChecked())
     {
-        // m_curInst->is_fixed_note = false;
-        // m_curInst->percNoteNum = 0; // Don't pass drum-specific data to melodic
-        m_curInst->rhythm_drum_type = 0;
+        // curInst()->is_fixed_note = false;
+        // curInst()->percNoteNum = 0; // Don't pass drum-specific data to melodic
+        if(curInstConst()->rhythm_drum_type != 0)
+            curInst()->rhythm_drum_type = 0;
     }
 
+    const FmBank::Instrument *inst = curInstConst();
+
     ui->editzone->setEnabled(true);
     ui->editzone2->setEnabled(true);
     ui->testNoteBox->setEnabled(true);
     ui->piano->setEnabled(ui->melodic->isChecked());
     ui->insName->setEnabled(true);
     m_lock = true;
-    ui->insName->setText(QString::fromUtf8(m_curInst->name));
-    ui->fixedNote->setChecked(m_curInst->is_fixed_note);
-    ui->perc_noteNum->setValue(m_curInst->percNoteNum);
-    ui->percMode->setCurrentIndex(m_curInst->rhythm_drum_type > 0 ? (m_curInst->rhythm_drum_type - 5) : 0);
-    ui->op4mode->setChecked(m_curInst->en_4op);
-    ui->doubleVoice->setEnabled(m_curInst->en_4op);
-    ui->doubleVoice->setChecked(m_curInst->en_pseudo4op);
-    ui->carrier2->setEnabled(m_curInst->en_4op);
-    ui->modulator2->setEnabled(m_curInst->en_4op);
-    ui->feedback2->setEnabled(m_curInst->en_4op);
-    ui->connect2->setEnabled(m_curInst->en_4op);
-    ui->feedback2label->setEnabled(m_curInst->en_4op);
-    ui->feedback1->setValue(m_curInst->feedback1);
-    ui->feedback2->setValue(m_curInst->feedback2);
-    ui->secVoiceFineTune->setValue(m_curInst->fine_tune);
-    ui->noteOffset1->setValue(m_curInst->note_offset1);
-    ui->noteOffset2->setValue(m_curInst->note_offset2);
-    ui->velocityOffset->setValue(m_curInst->velocity_offset);
-    ui->am1->setChecked(m_curInst->connection1 == FmBank::Instrument::AM);
-    ui->fm1->setChecked(m_curInst->connection1 == FmBank::Instrument::FM);
-    ui->am2->setChecked(m_curInst->connection2 == FmBank::Instrument::AM);
-    ui->fm2->setChecked(m_curInst->connection2 == FmBank::Instrument::FM);
+    ui->insName->setText(QString::fromUtf8(inst->name));
+    ui->fixedNote->setChecked(inst->is_fixed_note);
+    ui->perc_noteNum->setValue(inst->percNoteNum);
+    ui->percMode->setCurrentIndex(inst->rhythm_drum_type > 0 ? (inst->rhythm_drum_type - 5) : 0);
+    ui->op4mode->setChecked(inst->en_4op);
+    ui->doubleVoice->setEnabled(inst->en_4op);
+    ui->doubleVoice->setChecked(inst->en_pseudo4op);
+    ui->carrier2->setEnabled(inst->en_4op);
+    ui->modulator2->setEnabled(inst->en_4op);
+    ui->feedback2->setEnabled(inst->en_4op);
+    ui->connect2->setEnabled(inst->en_4op);
+    ui->feedback2label->setEnabled(inst->en_4op);
+    ui->feedback1->setValue(inst->feedback1);
+    ui->feedback2->setValue(inst->feedback2);
+    ui->secVoiceFineTune->setValue(inst->fine_tune);
+    ui->noteOffset1->setValue(inst->note_offset1);
+    ui->noteOffset2->setValue(inst->note_offset2);
+    ui->velocityOffset->setValue(inst->velocity_offset);
+    ui->am1->setChecked(inst->connection1 == FmBank::Instrument::AM);
+    ui->fm1->setChecked(inst->connection1 == FmBank::Instrument::FM);
+    ui->am2->setChecked(inst->connection2 == FmBank::Instrument::AM);
+    ui->fm2->setChecked(inst->connection2 == FmBank::Instrument::FM);
 
     OperatorEditor *op_editors[4] = {ui->c1edit, ui->m1edit, ui->c2edit, ui->m2edit};
     for(unsigned i = 0; i < 4; ++i)
-        op_editors[i]->loadDataFromInst(*m_curInst);
+        op_editors[i]->loadDataFromInst(*inst);
 
     m_lock = false;
 }
 
 void BankEditor::displayDebugDelaysInfo()
 {
-    if(!m_curInst)
+    const FmBank::Instrument *inst = curInstConst();
+    if(!inst)
     {
         ui->debugDelaysInfo->setText(tr("Delays on: %1, off: %2").arg("--").arg("--"));
         return;
     }
     ui->debugDelaysInfo->setText(tr("Delays on: %1, off: %2")
-                                 .arg(m_curInst->ms_sound_kon)
-                                 .arg(m_curInst->ms_sound_koff));
+                                 .arg(inst->ms_sound_kon)
+                                 .arg(inst->ms_sound_koff));
+}
+
+void BankEditor::onInstrumentMeasured(bool percussion, int index)
+{
+    FmBank::InsStorage &box = percussion ? m_bank.Ins_Percussion_box : m_bank.Ins_Melodic_box;
+    if(index < 0 || index >= box.size())
+        return;
+
+    // The instrument may be changed again since it was scheduled, the sound key must match
+    FmBank::Instrument ins = box.at(index);
+    // Blankness is updated on saving only, to don't hide the instrument being edited
+    if(!m_measurer->applyCachedDurations(ins, false))
+        return;
+    if(memcmp(&ins, &box.at(index), sizeof(FmBank::Instrument)) == 0)
+        return;
+
+    box[index] = ins;
+    if((m_curInstBank == &m_bank) && (percussion == m_curInstPerc) && (index == m_curInstNum))
+        displayDebugDelaysInfo();
 }
 
 void BankEditor::initChip()
@@ -1316,9 +1560,18 @@ void BankEditor::initChip()
 
 void BankEditor::sendPatch()
 {
-    if(!m_curInst) return;
+    const FmBank::Instrument *inst = curInstConst();
+    if(!inst) return;
     if(!m_generator) return;
-    m_generator->ctl_changePatch(*m_curInst, ui->percussion->isChecked());
+    m_generator->ctl_changePatch(*inst, ui->percussion->isChecked());
+}
+
+void BankEditor::sendPatchChanges()
+{
+    const FmBank::Instrument *inst = curInstConst();
+    if(!inst) return;
+    if(!m_generator) return;
+    m_generator->ctl_updatePatch(*inst, ui->percussion->isChecked());
 }
 
 void BankEditor::setDrumMode(bool dmode)
@@ -1442,9 +1695,14 @@ void BankEditor::on_actionAdLibBnkMode_triggered(bool checked)
         on_bank_no_currentIndexChanged(ui->bank_no->currentIndex());
     else
     {
-        QList<QListWidgetItem *> selected = ui->instruments->selectedItems();
+        QModelIndexList selected = ui->instruments->selectionModel()->selectedIndexes();
+        int bank = ui->bank_no->currentIndex();
         if(!selected.isEmpty())
-            ui->bank_no->setCurrentIndex(selected.front()->data(INS_BANK_ID).toInt());
+            bank = selected.front().data(InstrumentsModel::BankIdRole).toInt();
+        if(bank != ui->bank_no->currentIndex())
+            ui->bank_no->setCurrentIndex(bank);
+        else
+            on_bank_no_currentIndexChanged(bank);
     }
 }
 
@@ -1520,6 +1778,79 @@ void BankEditor::on_actionHardware_OPL_triggered()
 }
 #endif
 
+void BankEditor::on_actionRecordRegisters_toggled(bool checked)
+{
+    if(!m_generator)
+    {
+        // Nothing to record without the audio output
+        if(checked)
+            ui->actionRecordRegisters->setChecked(false);
+        return;
+    }
+
+    if(checked)
+    {
+        m_registerCapture.reset(new OPLRegisterCapture);
+        m_generator->ctl_startCapture(m_registerCapture.get());
+        if(!m_registerCaptureTimer)
+        {
+            m_registerCaptureTimer = new QTimer(this);
+            m_registerCaptureTimer->setInterval(100);
+            connect(m_registerCaptureTimer, SIGNAL(timeout()), this, SLOT(drainRegisterCapture()));
+        }
+        m_registerCaptureTimer->start();
+        statusBar()->showMessage(tr("Recording of register writes..."));
+        return;
+    }
+
+    if(!m_registerCapture)
+        return;
+
+    m_registerCaptureTimer->stop();
+    m_generator->ctl_stopCapture();
+    std::unique_ptr<OPLRegisterCapture> capture(std::move(m_registerCapture));
+    statusBar()->clearMessage();
+
+    if(capture->lost() > 0)
+        QMessageBox::warning(this, tr("Register writes are lost"),
+                             tr("%1 register writes were not recorded, the log is incomplete.")
+                             .arg(capture->lost()));
+
+    QString selectedFilter;
+    QString filters = tr("OPL register log (*.oplr)") + ";;" +
+                      tr("VGM music file (*.vgm)") + ";;" +
+                      tr("DOSBox Raw OPL (*.dro)");
+    QString fileToSave = QFileDialog::getSaveFileName(this, tr("Save register writes"),
+                                                      m_recentPath, filters, &selectedFilter,
+                                                      FILE_OPEN_DIALOG_OPTIONS);
+    if(fileToSave.isEmpty())
+        return;
+
+    const OPLRegisterLog *log = &capture->log();
+    bool ok;
+    if(fileToSave.endsWith(".vgm", Qt::CaseInsensitive) || selectedFilter.contains("*.vgm"))
+        ok = log->saveVGM(fileToSave);
+    else if(fileToSave.endsWith(".dro", Qt::CaseInsensitive) || selectedFilter.contains("*.dro"))
+        ok = log->saveDRO(fileToSave);
+    else
+        ok = log->saveLog(fileToSave);
+
+    if(!ok)
+        QMessageBox::warning(this, tr("Can't save file"),
+                             tr("Can't save register writes into the file %1").arg(fileToSave));
+}
+
+void BankEditor::drainRegisterCapture()
+{
+    if(m_registerCapture)
+        m_registerCapture->drain();
+}
+
+void BankEditor::on_actionTieredMeasurement_toggled(bool checked)
+{
+    m_measurer->setMeasureMode(checked ? Measurer::MEASURE_TIERED : Measurer::MEASURE_FAST);
+}
+
 void BankEditor::onActionLanguageTriggered()
 {
     QAction *act = static_cast<QAction *>(sender());
@@ -1570,13 +1901,9 @@ void BankEditor::on_bank_no_currentIndexChanged(int index)
         }
         this->m_lock = false;
     }
-    QList<QListWidgetItem *> items = ui->instruments->findItems("*", Qt::MatchWildcard);
-    for(QListWidgetItem *it : items)
-        it->setHidden(!ui->actionAdLibBnkMode->isChecked() && (it->data(INS_BANK_ID) != index));
-    QList<QListWidgetItem *> selected = ui->instruments->selectedItems();
-    if(!selected.isEmpty())
-        ui->instruments->scrollToItem(selected.front());
-    QMetaObject::invokeMethod(this, "reloadInstrumentNames", Qt::QueuedConnection);
+    m_instrumentsModel->setMidiSpec(getSelectedMidiSpec());
+    m_instrumentsModel->setFilter(isDrumsMode(), index, ui->actionAdLibBnkMode->isChecked());
+    showCurrentInstrument();
 }
 
 void BankEditor::on_bank_msb_valueChanged(int value)
@@ -1618,18 +1945,6 @@ void BankEditor::setMelodic()
 {
     setDrumMode(false);
     reloadBanks();
-    ui->instruments->clear();
-    for(int i = 0; i < m_bank.countMelodic(); i++)
-    {
-        QListWidgetItem *item = new QListWidgetItem();
-        item->setText(m_bank.Ins_Melodic[i].name[0] != '\0' ?
-                      QString::fromUtf8(m_bank.Ins_Melodic[i].name) : getInstrumentName(i, false, false));
-        setInstrumentMetaInfo(item, i);
-        item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
-        item->setForeground(m_bank.Ins_Melodic[i].is_blank ?
-                            Qt::gray : Qt::black);
-        ui->instruments->addItem(item);
-    }
     on_bank_no_currentIndexChanged(ui->bank_no->currentIndex());
 }
 
@@ -1637,61 +1952,26 @@ void BankEditor::setDrums()
 {
     setDrumMode(true);
     reloadBanks();
-    ui->instruments->clear();
-    for(int i = 0; i < m_bank.countDrums(); i++)
-    {
-        QListWidgetItem *item = new QListWidgetItem();
-        item->setText(m_bank.Ins_Percussion[i].name[0] != '\0' ?
-                      QString::fromUtf8(m_bank.Ins_Percussion[i].name) : getInstrumentName(i, false, true));
-        setInstrumentMetaInfo(item, i);
-        item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
-        item->setForeground(m_bank.Ins_Percussion[i].is_blank ?
-                            Qt::gray : Qt::black);
-        ui->instruments->addItem(item);
-    }
     on_bank_no_currentIndexChanged(ui->bank_no->currentIndex());
 }
 
 void BankEditor::reloadInstrumentNames()
 {
-    if(ui->percussion->isChecked())
-    {
-        if(ui->instruments->count() != m_bank.Ins_Percussion_box.size())
-            setDrums();//Completely rebuild an instruments list
-        else
-        {
-            //Change instrument names of existing entries
-            for(int i = 0; i < ui->instruments->count(); i++)
-            {
-                auto *it = ui->instruments->item(i);
-                int index = it->data(Qt::UserRole).toInt();
-                it->setText(m_bank.Ins_Percussion[index].name[0] != '\0' ?
-                            QString::fromUtf8(m_bank.Ins_Percussion[index].name) :
-                            getInstrumentName(index, false, true));
-                it->setForeground(m_bank.Ins_Percussion[i].is_blank ?
-                                  Qt::gray : Qt::black);
-            }
-        }
-    }
-    else
+    int banksCount = ((isDrumsMode() ? m_bank.countDrums() : m_bank.countMelodic()) - 1) / 128 + 1;
+    if(ui->bank_no->count() != banksCount)
     {
-        if(ui->instruments->count() != m_bank.Ins_Melodic_box.size())
-            setMelodic();//Completely rebuild an instruments list
+        // Completely rebuild an instruments list
+        if(isDrumsMode())
+            setDrums();
         else
-        {
-            //Change instrument names of existing entries
-            for(int i = 0; i < ui->instruments->count(); i++)
-            {
-                auto *it = ui->instruments->item(i);
-                int index = it->data(Qt::UserRole).toInt();
-                it->setText(m_bank.Ins_Melodic[index].name[0] != '\0' ?
-                            QString::fromUtf8(m_bank.Ins_Melodic[index].name) :
-                            getInstrumentName(index, false, false));
-                it->setForeground(m_bank.Ins_Melodic[i].is_blank ?
-                                  Qt::gray : Qt::black);
-            }
-        }
+            setMelodic();
+        return;
     }
+
+    // Names are taken from the bank when entries are shown
+    m_instrumentsModel->setMidiSpec(getSelectedMidiSpec());
+    m_instrumentsModel->reload();
+    showCurrentInstrument();
 }
 
 void BankEditor::reloadBankNames()
@@ -1710,28 +1990,18 @@ void BankEditor::on_actionAddInst_triggered()
 {
     FmBank::Instrument ins = FmBank::emptyInst();
     int id = 0;
-    QListWidgetItem *item = new QListWidgetItem();
 
     if(ui->melodic->isChecked())
     {
         m_bank.Ins_Melodic_box.push_back(ins);
-        m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
-        ins = m_bank.Ins_Melodic_box.last();
         id = m_bank.countMelodic() - 1;
-        item->setText(ins.name[0] != '\0' ? QString::fromUtf8(ins.name) : getInstrumentName(id, false, false));
     }
     else
     {
         m_bank.Ins_Percussion_box.push_back(ins);
-        m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
-        ins = m_bank.Ins_Percussion_box.last();
         id = m_bank.countDrums() - 1;
-        item->setText(ins.name[0] != '\0' ? QString::fromUtf8(ins.name) : getInstrumentName(id, false, true));
     }
 
-    setInstrumentMetaInfo(item, id);
-    item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
-    ui->instruments->addItem(item);
     int oldCount = ui->bank_no->count();
     reloadBanks();
     if(oldCount < ui->bank_no->count())
@@ -1742,15 +2012,13 @@ void BankEditor::on_actionAddInst_triggered()
             m_bank.Banks_Melodic.push_back(FmBank::emptyBank(uint16_t(m_bank.Banks_Melodic.count())));
     }
     ui->bank_no->setCurrentIndex(ui->bank_no->count() - 1);
-    ui->instruments->scrollToItem(item);
-    item->setSelected(true);
-    on_instruments_currentItemChanged(item, nullptr);
+    m_instrumentsModel->reload();
+    selectInstrument(id);
 }
 
 void BankEditor::on_actionClearInstrument_triggered()
 {
-    QList<QListWidgetItem *> selected = ui->instruments->selectedItems();
-    if(!m_curInst || selected.isEmpty())
+    if(!curInstConst() || !ui->instruments->selectionModel()->hasSelection())
     {
         QMessageBox::warning(this,
                              tr("Instrument is not selected"),
@@ -1758,15 +2026,15 @@ void BankEditor::on_actionClearInstrument_triggered()
         return;
     }
 
-    *m_curInst = FmBank::blankInst();
+    *curInst() = FmBank::blankInst();
     loadInstrument();
     syncInstrumentName();
 }
 
 void BankEditor::on_actionDelInst_triggered()
 {
-    QList<QListWidgetItem *> selected = ui->instruments->selectedItems();
-    if(!m_curInst || selected.isEmpty())
+    QModelIndexList selected = ui->instruments->selectionModel()->selectedIndexes();
+    if(!curInstConst() || selected.isEmpty())
     {
         QMessageBox::warning(this,
                              tr("Instrument is not selected"),
@@ -1782,29 +2050,20 @@ void BankEditor::on_actionDelInst_triggered()
 
     if(reply == QMessageBox::Yes)
     {
-        QListWidgetItem *tokill = selected.first();
+        int tokill = m_instrumentsModel->instrumentIndex(selected.first());
+        selected.clear();
 
         if(ui->melodic->isChecked())
         {
-            m_bank.Ins_Melodic_box.remove(tokill->data(INS_INDEX).toInt());
-            m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
+            m_bank.Ins_Melodic_box.remove(tokill);
         }
         else
         {
-            m_bank.Ins_Percussion_box.remove(tokill->data(INS_INDEX).toInt());
-            m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
+            m_bank.Ins_Percussion_box.remove(tokill);
         }
 
-        m_curInst = nullptr;
-        ui->instruments->removeItemWidget(tokill);
-        selected.clear();
-        delete tokill;
-
-        // Recount indeces
-        QList<QListWidgetItem *> leftItems = ui->instruments->findItems("*", Qt::MatchWildcard);
-        int counter = 0;
-        for(QListWidgetItem *it : leftItems)
-            setInstrumentMetaInfo(it, counter++);
+        setEditedInstrument(nullptr, -1, false);
+        ui->instruments->clearSelection();
         reloadInstrumentNames();
         int oldBank = ui->bank_no->currentIndex();
         reloadBanks();
@@ -1838,9 +2097,8 @@ void BankEditor::on_actionAddBank_triggered()
         int oldSize = m_bank.Ins_Percussion_box.size();
         int addSize = 128 + ((oldSize % 128 == 0) ? 0 : (128 - (oldSize % 128)));
         m_bank.Ins_Percussion_box.resize(oldSize + addSize);
-        m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
         m_bank.Banks_Percussion.push_back(FmBank::emptyBank(uint16_t(m_bank.Banks_Percussion.count())));
-        std::fill(m_bank.Ins_Percussion_box.end() - addSize, m_bank.Ins_Percussion_box.end(), FmBank::blankInst());
+        m_bank.Ins_Percussion_box.fill(FmBank::blankInst(), oldSize, addSize);
         setDrums();
     }
     else
@@ -1848,9 +2106,8 @@ void BankEditor::on_actionAddBank_triggered()
         int oldSize = m_bank.Ins_Melodic_box.size();
         int addSize = 128 + ((oldSize % 128 == 0) ? 0 : (128 - (oldSize % 128)));
         m_bank.Ins_Melodic_box.resize(oldSize + int(addSize));
-        m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
         m_bank.Banks_Melodic.push_back(FmBank::emptyBank(uint16_t(m_bank.Banks_Melodic.count())));
-        std::fill(m_bank.Ins_Melodic_box.end() - addSize, m_bank.Ins_Melodic_box.end(), FmBank::blankInst());
+        m_bank.Ins_Melodic_box.fill(FmBank::blankInst(), oldSize, addSize);
         setMelodic();
     }
 
@@ -1877,11 +2134,8 @@ void BankEditor::on_actionCloneBank_triggered()
         int oldSize = m_bank.Ins_Percussion_box.size();
         int addSize = 128 + ((oldSize % 128 == 0) ? 0 : (128 - (oldSize % 128)));
         m_bank.Ins_Percussion_box.resize(oldSize + addSize);
-        m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
-        std::fill(m_bank.Ins_Percussion_box.end() - addSize, m_bank.Ins_Percussion_box.end(), FmBank::blankInst());
-        memcpy(m_bank.Ins_Percussion + (newBank * 128),
-               m_bank.Ins_Percussion + (curBank * 128),
-               sizeof(FmBank::Instrument) * 128);
+        m_bank.Ins_Percussion_box.fill(FmBank::blankInst(), oldSize, addSize);
+        m_bank.Ins_Percussion_box.cloneBlock(newBank, curBank);
         m_bank.Banks_Percussion.push_back(FmBank::emptyBank(uint16_t(m_bank.Banks_Percussion.count())));
         setDrums();
     }
@@ -1890,11 +2144,8 @@ void BankEditor::on_actionCloneBank_triggered()
         int oldSize = m_bank.Ins_Melodic_box.size();
         int addSize = 128 + ((oldSize % 128 == 0) ? 0 : (128 - (oldSize % 128)));
         m_bank.Ins_Melodic_box.resize(oldSize + addSize);
-        m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
-        std::fill(m_bank.Ins_Melodic_box.end() - addSize, m_bank.Ins_Melodic_box.end(), FmBank::blankInst());
-        memcpy(m_bank.Ins_Melodic + (newBank * 128),
-               m_bank.Ins_Melodic + (curBank * 128),
-               sizeof(FmBank::Instrument) * 128);
+        m_bank.Ins_Melodic_box.fill(FmBank::blankInst(), oldSize, addSize);
+        m_bank.Ins_Melodic_box.cloneBlock(newBank, curBank);
         m_bank.Banks_Melodic.push_back(FmBank::emptyBank(uint16_t(m_bank.Banks_Melodic.count())));
         setMelodic();
     }
@@ -1928,17 +2179,15 @@ void BankEditor::on_actionClearBank_triggered()
         {
             if(needToShoot_end >= m_bank.Ins_Percussion_box.size())
                 needToShoot_end = m_bank.Ins_Percussion_box.size();
-            std::fill(m_bank.Ins_Percussion + needToShoot_begin,
-                      m_bank.Ins_Percussion + needToShoot_end,
-                      FmBank::blankInst());
+            m_bank.Ins_Percussion_box.fill(FmBank::blankInst(), needToShoot_begin,
+                                      needToShoot_end - needToShoot_begin);
         }
         else
         {
             if(needToShoot_end >= m_bank.Ins_Melodic_box.size())
                 needToShoot_end = m_bank.Ins_Melodic_box.size();
-            std::fill(m_bank.Ins_Melodic + needToShoot_begin,
-                      m_bank.Ins_Melodic + needToShoot_end,
-                      FmBank::blankInst());
+            m_bank.Ins_Melodic_box.fill(FmBank::blankInst(), needToShoot_begin,
+                                      needToShoot_end - needToShoot_begin);
         }
         reloadInstrumentNames();
         loadInstrument();
@@ -1981,7 +2230,6 @@ void BankEditor::on_actionDeleteBank_triggered()
             if(needToShoot_end >= m_bank.Ins_Percussion_box.size())
                 needToShoot_end = m_bank.Ins_Percussion_box.size();
             m_bank.Ins_Percussion_box.remove(needToShoot_begin, needToShoot_end - needToShoot_begin);
-            m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
             m_bank.Banks_Percussion.remove(curBank);
             setDrums();
         }
@@ -1990,7 +2238,6 @@ void BankEditor::on_actionDeleteBank_triggered()
             if(needToShoot_end >= m_bank.Ins_Melodic_box.size())
                 needToShoot_end = m_bank.Ins_Melodic_box.size();
             m_bank.Ins_Melodic_box.remove(needToShoot_begin, needToShoot_end - needToShoot_begin);
-            m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
             m_bank.Banks_Melodic.remove(curBank);
             setMelodic();
         }
@@ -22,7 +22,7 @@
 #include <QTimer>
 #include <QMainWindow>
 #include <QList>
-#include <QListWidgetItem>
+#include <QModelIndex>
 #include "bank.h"
 #include "opl/generator.h"
 #include "opl/generator_realtime.h"
@@ -44,6 +44,7 @@ namespace Ui
 }
 
 class Importer;
+class InstrumentsModel;
 class TextFormat;
 class QActionGroup;
 
@@ -68,6 +69,10 @@ private:
     QString             m_language;
     //! Currently using chip
     Generator::OPL_Chips m_currentChip;
+    //! Count of emulated chips
+    int m_chipsCount = 1;
+    //! Action group of counts of emulated chips
+    QActionGroup       *m_actionGroupChips;
     //! Audio latency (ms)
     double m_audioLatency;
     //! Name of the audio device
@@ -93,10 +98,12 @@ private:
     //! Backup for melodic note while percusive mode is enabled
     int                 m_recentMelodicNote;
 
-    //! Currently selected instrument
-    FmBank::Instrument *m_curInst;
-    //! Currently selected instrument
-    FmBank::Instrument *m_curInstBackup;
+    //! Bank of currently edited instrument: the own bank or the bank of the importer
+    FmBank *m_curInstBank;
+    //! Index of currently edited instrument in the bank, -1 if nothing is selected
+    int m_curInstNum;
+    //! Currently edited instrument is percussion
+    bool m_curInstPerc;
 
     //! Recent index of instrument
     int m_recentNum;
@@ -109,9 +116,19 @@ private:
     //! OPL chip emulator frontent
     IRealtimeControl *m_generator = nullptr;
 
+    //! Register writes being recorded, null unless recording
+    std::unique_ptr<OPLRegisterCapture> m_registerCapture;
+    //! Drains recorded register writes into the log
+    QTimer          *m_registerCaptureTimer = nullptr;
+
     //! Sound length measurer
     Measurer        *m_measurer;
 
+    //! Instruments of the current MIDI bank shown in the list
+    InstrumentsModel *m_instrumentsModel;
+    //! Don't reload the instrument when its entry is selected in the list
+    bool            m_instrumentSelectionLock = false;
+
     //! Recent bank file format which was been used
     BankFormats     m_recentFormat;
 
@@ -180,6 +197,35 @@ private:
      */
     void reInitFileDataAfterSave(QString &filePath);
 
+    /*!
+     * \brief Select the instrument to edit
+     * \param bank Bank which holds the instrument, nullptr to deselect
+     * \param num Index of the instrument in the bank
+     * \param isPerc Is a percussion instrument
+     */
+    void setEditedInstrument(FmBank *bank, int num, bool isPerc);
+
+    /*!
+     * \brief Currently edited instrument to modify
+     * \return Instrument in the storage of its bank, or nullptr if nothing is selected
+     *
+     * Instruments of the bank are copy-on-write, so the returned pointer
+     * must not be kept: any write into the bank may move the instrument.
+     */
+    FmBank::Instrument *curInst();
+
+    /*!
+     * \brief Currently edited instrument to read
+     * \return Instrument in the storage of its bank, or nullptr if nothing is selected
+     */
+    const FmBank::Instrument *curInstConst() const;
+
+    /*!
+     * \brief State of currently edited instrument since the file was loaded or saved
+     * \return Instrument of the bank backup, or nullptr if there is no such instrument
+     */
+    const FmBank::Instrument *curInstBackup() const;
+
 public:
     /*!
      * \brief Open file
@@ -229,12 +275,6 @@ public:
     bool askForSaving();
 
     /* ************** Helpful functions ************** */
-    /**
-     * @brief Get the instrument name by index from off the current bank state
-     * @param instrument id
-     * @return The title of instrument
-     */
-    QString getInstrumentName(int instrument, bool isAuto = true, bool isPerc = false) const;
     /**
      * @brief Get the bank name by index from off the current bank state
      * @param bank id
@@ -249,6 +289,16 @@ public:
      * @brief Loads current instrument into GUI controlls and sends it to generator
      */
     void flushInstrument();
+    /**
+     * @brief Select the instrument in the list and begin its editing
+     * @param index Index of the instrument in the storage of current mode
+     * @return false if the instrument is not in the list
+     */
+    bool selectInstrument(int index);
+    /**
+     * @brief Highlight the currently edited instrument in the list, if it's shown
+     */
+    void showCurrentInstrument();
     /**
      * @brief Synchronize instrument name in the list widget with actual instrument name in the data store
      */
@@ -281,6 +331,11 @@ public:
      */
     void sendPatch();
 
+    /**
+     * @brief Send changes of current instrument to OPL chip emulator, playing notes are kept
+     */
+    void sendPatchChanges();
+
     /**
      * @brief Disable/Enable melodic specific GUI controlls which are useless while editing of percussion instrument
      * @param dmode if true, most of melodic specific controlls (such as piano, note selector and chords) are will be disabled
@@ -333,16 +388,29 @@ private slots:
     /* ***************** Common slots ***************** */
     /**
      * @brief When instrument list entry is selected
-     * @param current Selected item from the instruments list, if NULL, turn into "unselected" mode and lock GUI
-     * @param previous Unused, just pass NULL
+     * @param current Selected entry of the instruments list, if invalid, turn into "unselected" mode and lock GUI
+     * @param previous Unused, just pass an invalid index
      */
-    void on_instruments_currentItemChanged(QListWidgetItem *current, QListWidgetItem *);
+    void onInstrumentCurrentChanged(const QModelIndex &current, const QModelIndex &);
 
     /**
      * @brief Toggle the chip emulator
      */
     void toggleEmulator();
 
+    /**
+     * @brief Change the count of emulated chips
+     * @param action Checked action of the chips count menu
+     */
+    void toggleChipsCount(QAction *action);
+
+    /**
+     * @brief Take sounding delays measured in background
+     * @param percussion Instrument belongs to the percussion storage
+     * @param index Index of the instrument in its storage
+     */
+    void onInstrumentMeasured(bool percussion, int index);
+
     /**
      * @brief Clear all buffers and begin a new bank
      */
@@ -420,6 +488,16 @@ private slots:
      */
     void on_actionCompareWith_triggered();
 
+    /**
+     * @brief Apply a parametric operation to many instruments at once
+     */
+    void on_actionBulkTransform_triggered();
+
+    /**
+     * @brief Equalize the loudness of instruments of the current bank
+     */
+    void on_actionNormalizeLoudness_triggered();
+
 #if defined(ENABLE_PLOTS)
     /**
      * @brief Run the delay analysis of the current instrument
@@ -502,6 +580,20 @@ private slots:
      */
     void on_actionHardware_OPL_triggered();
 #endif
+    /**
+     * @brief Start or stop recording of register writes sent to the chip
+     * @param checked Recording is turned on
+     */
+    void on_actionRecordRegisters_toggled(bool checked);
+    /**
+     * @brief Move register writes recorded by the audio thread into the log
+     */
+    void drainRegisterCapture();
+    /**
+     * @brief Confirm uncertain sounding delays by the accurate emulator
+     * @param checked Tiered measurement is turned on
+     */
+    void on_actionTieredMeasurement_toggled(bool checked);
     /**
      * @brief Changes the current language
      */
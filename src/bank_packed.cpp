@@ -0,0 +1,207 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bank_packed.h"
+#include <memory.h>
+
+static const uint32_t fnv_offset = 2166136261u;
+static const uint32_t fnv_prime  = 16777619u;
+
+template<class T>
+static void hashColumn(uint32_t *h, const T *col, int count)
+{
+    for(int i = 0; i < count; i++)
+    {
+        uint32_t v = uint32_t(col[i]);
+        for(size_t b = 0; b < sizeof(T); b++)
+            h[i] = (h[i] ^ ((v >> (b * 8)) & 0xFF)) * fnv_prime;
+    }
+}
+
+static FmBank::Instrument makeNullInstrument()
+{
+    FmBank::Instrument null;
+    memset(&null, 0, sizeof(FmBank::Instrument));
+    return null;
+}
+
+static uint8_t makeFlags(const FmBank::Instrument &ins)
+{
+    static const FmBank::Instrument null = makeNullInstrument();
+
+    uint8_t f = 0;
+    if(ins.en_4op)
+        f |= FmBankPacked::FLAG_4OP;
+    if(ins.en_pseudo4op)
+        f |= FmBankPacked::FLAG_PSEUDO4OP;
+    if(ins.is_blank)
+        f |= FmBankPacked::FLAG_BLANK;
+    if(ins.is_fixed_note)
+        f |= FmBankPacked::FLAG_FIXED_NOTE;
+    if(memcmp(&ins, &null, sizeof(FmBank::Instrument)) == 0)
+        f |= FmBankPacked::FLAG_NULL;
+    return f;
+}
+
+static uint8_t getReg(const FmBank::Instrument &ins, int col)
+{
+    if(col == FmBankPacked::REG_FBCONN1)
+        return ins.getFBConn1();
+    if(col == FmBankPacked::REG_FBCONN2)
+        return ins.getFBConn2();
+
+    int op = col / FmBankPacked::OpRegsCount;
+    switch(col % FmBankPacked::OpRegsCount)
+    {
+    default:
+    case FmBankPacked::REG_AVEKM:
+        return ins.getAVEKM(op);
+    case FmBankPacked::REG_KSLL:
+        return ins.getKSLL(op);
+    case FmBankPacked::REG_ATDEC:
+        return ins.getAtDec(op);
+    case FmBankPacked::REG_SUSREL:
+        return ins.getSusRel(op);
+    case FmBankPacked::REG_WAVE:
+        return ins.getWaveForm(op);
+    }
+}
+
+FmBankPacked::FmBankPacked() :
+    m_count(0)
+{}
+
+FmBankPacked::FmBankPacked(const FmBank::InsStorage &src) :
+    m_count(0)
+{
+    pack(src);
+}
+
+void FmBankPacked::pack(const FmBank::InsStorage &src)
+{
+    m_count = src.size();
+    m_regs.resize(RegsCount * m_count);
+    m_flags.resize(m_count);
+    m_percNoteNum.resize(m_count);
+    m_fineTune.resize(m_count);
+    m_noteOffset1.resize(m_count);
+    m_noteOffset2.resize(m_count);
+    m_velocityOffset.resize(m_count);
+    m_drumType.resize(m_count);
+    m_msSoundKon.resize(m_count);
+    m_msSoundKoff.resize(m_count);
+    m_names.resize(NameSize * m_count);
+
+    for(int i = 0; i < m_count; i++)
+        storeInstrument(i, src.at(i));
+}
+
+void FmBankPacked::storeInstrument(int i, const FmBank::Instrument &ins)
+{
+    uint8_t *regs = m_regs.data();
+    for(int c = 0; c < RegsCount; c++)
+        regs[c * m_count + i] = getReg(ins, c);
+
+    m_flags[i]          = makeFlags(ins);
+    m_percNoteNum[i]    = ins.percNoteNum;
+    m_fineTune[i]       = ins.fine_tune;
+    m_noteOffset1[i]    = ins.note_offset1;
+    m_noteOffset2[i]    = ins.note_offset2;
+    m_velocityOffset[i] = ins.velocity_offset;
+    m_drumType[i]       = ins.rhythm_drum_type;
+    m_msSoundKon[i]     = ins.ms_sound_kon;
+    m_msSoundKoff[i]    = ins.ms_sound_koff;
+    memcpy(m_names.data() + i * NameSize, ins.name, NameSize);
+}
+
+FmBank::Instrument FmBankPacked::instrument(int i) const
+{
+    FmBank::Instrument ins;
+    memset(&ins, 0, sizeof(FmBank::Instrument));
+
+    const uint8_t f = m_flags[i];
+    if(f & FLAG_NULL)
+        return ins;
+
+    const uint8_t *regs = m_regs.constData();
+    for(int op = 0; op < 4; op++)
+    {
+        ins.setAVEKM(op,    regs[opReg(op, REG_AVEKM) * m_count + i]);
+        ins.setKSLL(op,     regs[opReg(op, REG_KSLL) * m_count + i]);
+        ins.setAtDec(op,    regs[opReg(op, REG_ATDEC) * m_count + i]);
+        ins.setSusRel(op,   regs[opReg(op, REG_SUSREL) * m_count + i]);
+        ins.setWaveForm(op, regs[opReg(op, REG_WAVE) * m_count + i]);
+    }
+    ins.setFBConn1(regs[REG_FBCONN1 * m_count + i]);
+    ins.setFBConn2(regs[REG_FBCONN2 * m_count + i]);
+
+    ins.en_4op          = (f & FLAG_4OP) != 0;
+    ins.en_pseudo4op    = (f & FLAG_PSEUDO4OP) != 0;
+    ins.is_blank        = (f & FLAG_BLANK) != 0;
+    ins.is_fixed_note   = (f & FLAG_FIXED_NOTE) != 0;
+    ins.percNoteNum     = m_percNoteNum[i];
+    ins.fine_tune       = m_fineTune[i];
+    ins.note_offset1    = m_noteOffset1[i];
+    ins.note_offset2    = m_noteOffset2[i];
+    ins.velocity_offset = m_velocityOffset[i];
+    ins.rhythm_drum_type = m_drumType[i];
+    ins.ms_sound_kon    = m_msSoundKon[i];
+    ins.ms_sound_koff   = m_msSoundKoff[i];
+    memcpy(ins.name, m_names.constData() + i * NameSize, NameSize);
+
+    return ins;
+}
+
+void FmBankPacked::hashes(QVector<uint32_t> &out, unsigned options) const
+{
+    out.resize(m_count);
+    uint32_t *h = out.data();
+
+    for(int i = 0; i < m_count; i++)
+        h[i] = fnv_offset;
+
+    // Column after column, so every pass is a plain linear scan
+    const uint8_t *regs = m_regs.constData();
+    for(int c = 0; c < RegsCount; c++)
+        hashColumn(h, regs + c * m_count, m_count);
+
+    hashColumn(h, m_flags.constData(), m_count);
+    hashColumn(h, m_percNoteNum.constData(), m_count);
+    hashColumn(h, m_fineTune.constData(), m_count);
+    hashColumn(h, m_noteOffset1.constData(), m_count);
+    hashColumn(h, m_noteOffset2.constData(), m_count);
+    hashColumn(h, m_velocityOffset.constData(), m_count);
+    hashColumn(h, m_drumType.constData(), m_count);
+
+    if(options & HASH_MEASURE)
+    {
+        hashColumn(h, m_msSoundKon.constData(), m_count);
+        hashColumn(h, m_msSoundKoff.constData(), m_count);
+    }
+
+    if(options & HASH_NAME)
+    {
+        const char *names = m_names.constData();
+        for(int i = 0; i < m_count; i++)
+        {
+            const char *n = names + i * NameSize;
+            for(int j = 0; j < NameSize && n[j] != '\0'; j++)
+                h[i] = (h[i] ^ uint8_t(n[j])) * fnv_prime;
+        }
+    }
+}
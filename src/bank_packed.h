@@ -0,0 +1,157 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BANK_PACKED_H
+#define BANK_PACKED_H
+
+#include "bank.h"
+
+/**
+ * @brief Packed structure-of-arrays image of instruments for bulk hashing and indexing
+ *
+ * Every instrument is represented by 22 raw OPL register bytes (11 per operator
+ * pair), a flags byte and a few non-register parameters. Every value is stored
+ * in its own contiguous column, names are kept apart, so bank-wide scans are
+ * touching only the data they actually need.
+ */
+class FmBankPacked
+{
+public:
+    /**
+     * @brief Per-operator register columns
+     */
+    enum OpRegister
+    {
+        //! AM/VIB/EG/KSR/Multiple bits (0x20 register)
+        REG_AVEKM = 0,
+        //! KSL/attenuation (0x40 register)
+        REG_KSLL,
+        //! Attack/decay rates (0x60 register)
+        REG_ATDEC,
+        //! Sustain/release rates (0x80 register)
+        REG_SUSREL,
+        //! Wave select (0xE0 register)
+        REG_WAVE,
+        //! Count of registers per operator
+        OpRegsCount
+    };
+
+    enum
+    {
+        //! Feedback/connection of the first operator pair (0xC0 register)
+        REG_FBCONN1 = 4 * OpRegsCount,
+        //! Feedback/connection of the second operator pair (0xC0 register)
+        REG_FBCONN2,
+        //! Total count of register columns
+        RegsCount
+    };
+
+    /**
+     * @brief Instrument flags
+     */
+    enum Flags
+    {
+        FLAG_4OP        = 0x01,
+        FLAG_PSEUDO4OP  = 0x02,
+        FLAG_BLANK      = 0x04,
+        FLAG_FIXED_NOTE = 0x08,
+        //! Every byte of the instrument is zero
+        FLAG_NULL       = 0x10
+    };
+
+    /**
+     * @brief Options of the hash computing
+     */
+    enum HashOptions
+    {
+        //! Include instrument names
+        HASH_NAME       = 0x01,
+        //! Include measured sounding durations
+        HASH_MEASURE    = 0x02
+    };
+
+    /**
+     * @brief Index of the register column of the operator
+     * @param OpID Operator type (CARRIER1, MODULATOR1, CARRIER2, MODULATOR2)
+     * @param reg Register type
+     * @return index of the column
+     */
+    static inline int opReg(int OpID, int reg)
+    { return OpID * OpRegsCount + reg; }
+
+    FmBankPacked();
+    explicit FmBankPacked(const FmBank::InsStorage &src);
+
+    /**
+     * @brief Build packed image of all instruments of the storage
+     * @param src Source instruments storage
+     */
+    void pack(const FmBank::InsStorage &src);
+
+    /**
+     * @brief Count of packed instruments
+     */
+    inline int size() const { return m_count; }
+
+    /**
+     * @brief Restore the instrument
+     * @param i Index of instrument
+     * @return instrument data
+     */
+    FmBank::Instrument instrument(int i) const;
+
+    /**
+     * @brief Contiguous array of register bytes of all instruments
+     * @param col Column index (use opReg(), REG_FBCONN1 or REG_FBCONN2)
+     * @return pointer to the first byte of the column
+     */
+    inline const uint8_t *column(int col) const
+    { return m_regs.constData() + col * m_count; }
+
+    inline const uint8_t *flags() const { return m_flags.constData(); }
+    inline const char *name(int i) const { return m_names.constData() + i * NameSize; }
+
+    /**
+     * @brief Compute hashes of every instrument
+     * @param out Array of hashes, one per instrument
+     * @param options Combination of HashOptions
+     */
+    void hashes(QVector<uint32_t> &out, unsigned options = 0) const;
+
+private:
+    enum { NameSize = sizeof(FmBank::Instrument::name) };
+
+    void storeInstrument(int i, const FmBank::Instrument &ins);
+
+    int                 m_count;
+    //! Register columns, RegsCount of m_count-sized arrays
+    QVector<uint8_t>    m_regs;
+    QVector<uint8_t>    m_flags;
+    QVector<uint8_t>    m_percNoteNum;
+    QVector<int8_t>     m_fineTune;
+    QVector<int16_t>    m_noteOffset1;
+    QVector<int16_t>    m_noteOffset2;
+    QVector<int8_t>     m_velocityOffset;
+    QVector<uint8_t>    m_drumType;
+    QVector<uint16_t>   m_msSoundKon;
+    QVector<uint16_t>   m_msSoundKoff;
+    //! Names, NameSize bytes per instrument
+    QVector<char>       m_names;
+};
+
+#endif // BANK_PACKED_H
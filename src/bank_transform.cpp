@@ -0,0 +1,232 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bank_transform.h"
+#include "metaparameter.h"
+#include <QtConcurrent/QtConcurrent>
+#include <cmath>
+#include <cstring>
+
+bool BankTransform::addOperation(const Operation &op)
+{
+    if(isParametric(op.type) && !isKnownParameter(op.param))
+        return false;
+    m_ops.push_back(op);
+    return true;
+}
+
+void BankTransform::clear()
+{
+    m_ops.clear();
+}
+
+bool BankTransform::affectsSound() const
+{
+    for(const Operation &op : m_ops)
+    {
+        if(!isParametric(op.type))
+            return true;
+
+        for(const MetaParameter &mp : MP_instrument)
+        {
+            if(op.param == QLatin1String(mp.name) && (mp.flags & MP_Measure) == 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool BankTransform::isKnownParameter(const QString &name)
+{
+    for(const MetaParameter &mp : MP_instrument)
+    {
+        if(name == QLatin1String(mp.name))
+            return true;
+    }
+    return false;
+}
+
+bool BankTransform::isParametric(Operation::Type type)
+{
+    switch(type)
+    {
+    case Operation::OP_SET:
+    case Operation::OP_ADD:
+    case Operation::OP_SCALE:
+    case Operation::OP_CLAMP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+int BankTransform::operatorOfParameter(const MetaParameter &mp)
+{
+    switch(mp.flags & MP_OperatorMask)
+    {
+    case MP_Operator1:
+        return MODULATOR1;
+    case MP_Operator2:
+        return CARRIER1;
+    case MP_Operator3:
+        return MODULATOR2;
+    case MP_Operator4:
+        return CARRIER2;
+    default:
+        return -1;
+    }
+}
+
+void BankTransform::applyOne(const Operation &op, FmBank::Instrument &ins) const
+{
+    switch(op.type)
+    {
+    case Operation::OP_PSEUDO4OP_TO_2OP:
+        if(ins.en_4op && ins.en_pseudo4op)
+        {
+            ins.en_4op = false;
+            ins.en_pseudo4op = false;
+        }
+        return;
+
+    case Operation::OP_CUSTOM:
+        if(op.custom)
+            op.custom(ins);
+        return;
+
+    default:
+        break;
+    }
+
+    for(const MetaParameter &mp : MP_instrument)
+    {
+        if(op.param != QLatin1String(mp.name))
+            continue;
+
+        // Parameters which are not in use by current mode are kept as is
+        if(!ins.en_4op && (mp.flags & MP_4OpOnly) != 0)
+            continue;
+        if(ins.en_4op && !ins.en_pseudo4op && (mp.flags & MP_Pseudo4OpOnly) == MP_Pseudo4OpOnly)
+            continue;
+
+        int opId = operatorOfParameter(mp);
+        if(opId >= 0 && op.ops != OPS_ALL)
+        {
+            bool out = ins.isOutputOperator(opId);
+            if((op.ops == OPS_CARRIERS) != out)
+                continue;
+        }
+
+        int v = mp.get(ins);
+        switch(op.type)
+        {
+        case Operation::OP_SET:
+            v = int(std::lround(op.value));
+            break;
+        case Operation::OP_ADD:
+            v += int(std::lround(op.value));
+            break;
+        case Operation::OP_SCALE:
+            v = int(std::lround(double(v) * op.value));
+            break;
+        case Operation::OP_CLAMP:
+            v = (v < op.min) ? op.min : ((v > op.max) ? op.max : v);
+            break;
+        default:
+            break;
+        }
+
+        mp.setClamped(ins, v);
+    }
+}
+
+bool BankTransform::apply(FmBank::Instrument &ins) const
+{
+    if(ins.is_blank)
+        return false;
+
+    FmBank::Instrument orig = ins;
+    for(const Operation &op : m_ops)
+        applyOne(op, ins);
+
+    return memcmp(&orig, &ins, sizeof(FmBank::Instrument)) != 0;
+}
+
+struct TransformJob
+{
+    int                 index;
+    FmBank::Instrument  ins;
+    bool                changed;
+};
+
+int BankTransform::apply(FmBank::InsStorage &box, const QVector<int> &indices, QVector<int> *changed) const
+{
+    // Work on copies: reading of the storage is safe from many threads,
+    // and only instruments which were really changed will be written back
+    QVector<TransformJob> jobs;
+    jobs.reserve(indices.size());
+
+    for(int i : indices)
+    {
+        if(i < 0 || i >= box.size())
+            continue;
+        const FmBank::Instrument &src = box.at(i);
+        if(src.is_blank)
+            continue;
+        TransformJob job;
+        job.index = i;
+        job.ins = src;
+        job.changed = false;
+        jobs.push_back(job);
+    }
+
+    QtConcurrent::blockingMap(jobs, [this](TransformJob &job)
+    {
+        job.changed = apply(job.ins);
+    });
+
+    int count = 0;
+    for(const TransformJob &job : jobs)
+    {
+        if(!job.changed)
+            continue;
+        box[job.index] = job.ins;
+        if(changed)
+            changed->push_back(job.index);
+        ++count;
+    }
+
+    return count;
+}
+
+QVector<int> BankTransform::allIndices(const FmBank::InsStorage &box)
+{
+    QVector<int> out;
+    out.reserve(box.size());
+    for(int i = 0; i < box.size(); i++)
+        out.push_back(i);
+    return out;
+}
+
+QVector<int> BankTransform::bankIndices(const FmBank::InsStorage &box, int bank)
+{
+    QVector<int> out;
+    for(int i = bank * 128, e = qMin(box.size(), (bank + 1) * 128); i < e; i++)
+        out.push_back(i);
+    return out;
+}
@@ -0,0 +1,151 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BANK_TRANSFORM_H
+#define BANK_TRANSFORM_H
+
+#include "bank.h"
+#include <QString>
+#include <QVector>
+#include <functional>
+
+struct MetaParameter;
+
+/**
+ * @brief Parametric batch editing of many instruments at once
+ *
+ * Operations are expressed over MetaParameter fields (by their short names,
+ * like "tl" or "ar") and applied in the given order to every non-blank
+ * instrument of the selection. Instruments are processed in parallel.
+ */
+class BankTransform
+{
+public:
+    /**
+     * @brief Which operators are affected by per-operator parameters
+     */
+    enum OperatorSelect
+    {
+        //! Every operator
+        OPS_ALL = 0,
+        //! Operators which are producing the output sound
+        OPS_CARRIERS,
+        //! Operators which are modulating other operators
+        OPS_MODULATORS
+    };
+
+    struct Operation
+    {
+        enum Type
+        {
+            //! Replace the value
+            OP_SET = 0,
+            //! Add a value
+            OP_ADD,
+            //! Multiply by a value
+            OP_SCALE,
+            //! Keep the value in the [min, max] range
+            OP_CLAMP,
+            //! Turn pseudo-4-operators instrument into 2-operators one (first voice is kept)
+            OP_PSEUDO4OP_TO_2OP,
+            //! Run a custom function
+            OP_CUSTOM
+        };
+
+        Type            type = OP_SET;
+        //! Short name of the MetaParameter
+        QString         param;
+        OperatorSelect  ops = OPS_ALL;
+        double          value = 0.0;
+        int             min = 0;
+        int             max = 0;
+        std::function<void(FmBank::Instrument &)> custom;
+    };
+
+    /**
+     * @brief Append the operation
+     * @param op Operation to append
+     * @return false if the operation refers an unknown parameter, such operation is not appended
+     */
+    bool addOperation(const Operation &op);
+    void clear();
+    inline bool isEmpty() const { return m_ops.isEmpty(); }
+    inline const QVector<Operation> &operations() const { return m_ops; }
+
+    /**
+     * @brief Are operations changing anything except of measured sounding delays
+     * @return true if affected instruments should be re-measured
+     */
+    bool affectsSound() const;
+
+    /**
+     * @brief Apply all operations to the single instrument
+     * @param ins Instrument to modify
+     * @return true if the instrument has been changed
+     */
+    bool apply(FmBank::Instrument &ins) const;
+
+    /**
+     * @brief Apply all operations to the set of instruments in parallel
+     * @param box Instruments storage
+     * @param indices Indices of instruments to process, blank instruments are skipped
+     * @param changed unless null, receives indices of actually changed instruments
+     * @return count of changed instruments
+     *
+     * Only changed instruments are written back into the storage.
+     */
+    int apply(FmBank::InsStorage &box, const QVector<int> &indices, QVector<int> *changed = nullptr) const;
+
+    /**
+     * @brief Indices of every instrument of the storage
+     */
+    static QVector<int> allIndices(const FmBank::InsStorage &box);
+
+    /**
+     * @brief Indices of instruments of the MIDI bank
+     * @param box Instruments storage
+     * @param bank Index of the MIDI bank
+     */
+    static QVector<int> bankIndices(const FmBank::InsStorage &box, int bank);
+
+    /**
+     * @brief Is there a MetaParameter with the given short name
+     * @param name Short name of the parameter
+     */
+    static bool isKnownParameter(const QString &name);
+
+    /**
+     * @brief Does the operation type work over a MetaParameter value
+     * @param type Operation type
+     */
+    static bool isParametric(Operation::Type type);
+
+    /**
+     * @brief Operator which is described by the parameter
+     * @param mp Meta-parameter
+     * @return operator type or -1 if parameter is not a part of an operator
+     */
+    static int operatorOfParameter(const MetaParameter &mp);
+
+private:
+    void applyOne(const Operation &op, FmBank::Instrument &ins) const;
+
+    QVector<Operation> m_ops;
+};
+
+#endif // BANK_TRANSFORM_H
@@ -0,0 +1,74 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bank_transform_dialog.h"
+#include "ui_bank_transform_dialog.h"
+#include "metaparameter.h"
+
+BankTransformDialog::BankTransformDialog(QWidget *parent)
+    : QDialog(parent), m_ui(new Ui::BankTransformDialog)
+{
+    m_ui->setupUi(this);
+
+    // Per-operator parameters are repeated for every operator, list every name once
+    for(const MetaParameter &mp : MP_instrument)
+    {
+        QString name = QString::fromLatin1(mp.name);
+        if(m_ui->parameter->findData(name) < 0)
+            m_ui->parameter->addItem(name, name);
+    }
+
+    on_operation_currentIndexChanged(m_ui->operation->currentIndex());
+}
+
+BankTransformDialog::~BankTransformDialog()
+{
+}
+
+BankTransform::Operation BankTransformDialog::operation() const
+{
+    BankTransform::Operation op;
+    op.type = BankTransform::Operation::Type(m_ui->operation->currentIndex());
+    op.param = m_ui->parameter->itemData(m_ui->parameter->currentIndex()).toString();
+    op.ops = BankTransform::OperatorSelect(m_ui->operators->currentIndex());
+    op.value = m_ui->value->value();
+    op.min = m_ui->rangeMin->value();
+    op.max = m_ui->rangeMax->value();
+    return op;
+}
+
+BankTransformDialog::Scope BankTransformDialog::scope() const
+{
+    return Scope(m_ui->scope->currentIndex());
+}
+
+bool BankTransformDialog::remeasure() const
+{
+    return m_ui->remeasure->isChecked();
+}
+
+void BankTransformDialog::on_operation_currentIndexChanged(int index)
+{
+    bool isParametric = (index != BankTransform::Operation::OP_PSEUDO4OP_TO_2OP);
+    bool isClamp = (index == BankTransform::Operation::OP_CLAMP);
+    m_ui->parameter->setEnabled(isParametric);
+    m_ui->operators->setEnabled(isParametric);
+    m_ui->value->setEnabled(isParametric && !isClamp);
+    m_ui->rangeMin->setEnabled(isClamp);
+    m_ui->rangeMax->setEnabled(isClamp);
+}
@@ -0,0 +1,57 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BANK_TRANSFORM_DIALOG_H
+#define BANK_TRANSFORM_DIALOG_H
+
+#include "bank_transform.h"
+#include <QDialog>
+#include <memory>
+
+namespace Ui { class BankTransformDialog; }
+
+class BankTransformDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Instruments to process
+     */
+    enum Scope
+    {
+        SCOPE_INSTRUMENT = 0,
+        SCOPE_BANK,
+        SCOPE_FILE
+    };
+
+    explicit BankTransformDialog(QWidget *parent = nullptr);
+    ~BankTransformDialog();
+
+    BankTransform::Operation operation() const;
+    Scope scope() const;
+    bool remeasure() const;
+
+private slots:
+    void on_operation_currentIndexChanged(int index);
+
+private:
+    std::unique_ptr<Ui::BankTransformDialog> m_ui;
+};
+
+#endif // BANK_TRANSFORM_DIALOG_H
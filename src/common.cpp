@@ -25,7 +25,7 @@
 #include <QMessageBox>
 #endif
 
-qint64 readLE(QFile &file, uint16_t &out)
+qint64 readLE(QIODevice &file, uint16_t &out)
 {
     uint8_t bytes[2] = {0, 0};
     qint64 len = file.read(char_p(bytes), 2);
@@ -35,7 +35,7 @@ qint64 readLE(QFile &file, uint16_t &out)
 }
 
 
-qint64 readLE(QFile &file, uint32_t &out)
+qint64 readLE(QIODevice &file, uint32_t &out)
 {
     uint8_t bytes[4] = {0, 0, 0, 0};
     qint64 len = file.read(char_p(bytes), 4);
@@ -46,7 +46,7 @@ qint64 readLE(QFile &file, uint32_t &out)
     return len;
 }
 
-qint64 writeLE(QFile &file, const uint16_t &in)
+qint64 writeLE(QIODevice &file, const uint16_t &in)
 {
     uint8_t bytes[2] = {uint8_t(in & 0x00FF), uint8_t((in >> 8) & 0x00FF) };
     qint64 len = file.write(char_p(bytes), 2);
@@ -54,7 +54,7 @@ qint64 writeLE(QFile &file, const uint16_t &in)
 }
 
 
-qint64 writeLE(QFile &file, const uint32_t &in)
+qint64 writeLE(QIODevice &file, const uint32_t &in)
 {
     uint8_t bytes[4] = { uint8_t(in & 0x000000FF),
                          uint8_t((in >> 8) & 0x000000FF),
@@ -66,7 +66,7 @@ qint64 writeLE(QFile &file, const uint32_t &in)
 }
 
 
-qint64 readBE(QFile &file, uint16_t &out)
+qint64 readBE(QIODevice &file, uint16_t &out)
 {
     uint8_t bytes[2] = {0, 0};
     qint64 len = file.read(char_p(bytes), 2);
@@ -75,7 +75,7 @@ qint64 readBE(QFile &file, uint16_t &out)
     return len;
 }
 
-qint64 writeBE(QFile &file, const uint16_t &in)
+qint64 writeBE(QIODevice &file, const uint16_t &in)
 {
     uint8_t bytes[2] = {uint8_t((in >> 8) & 0x00FF), uint8_t(in & 0x00FF)};
     qint64 len = file.write(char_p(bytes), 2);
@@ -33,7 +33,7 @@ typedef char*         char_p;
  * \param out Target reference
  * \return number of readed bytes
  */
-qint64 readLE(QFile &file, uint16_t &out);
+qint64 readLE(QIODevice &file, uint16_t &out);
 
 /*!
  * \brief Read little-endian unsigned int from a file
@@ -41,7 +41,7 @@ qint64 readLE(QFile &file, uint16_t &out);
  * \param out Target reference
  * \return number of readed bytes
  */
-qint64 readLE(QFile &file, uint32_t &out);
+qint64 readLE(QIODevice &file, uint32_t &out);
 
 /*!
  * \brief Write little-endian unsigned short into the file
@@ -49,7 +49,7 @@ qint64 readLE(QFile &file, uint32_t &out);
  * \param in Source reference
  * \return number of written bytes
  */
-qint64 writeLE(QFile &file, const uint16_t &in);
+qint64 writeLE(QIODevice &file, const uint16_t &in);
 
 /*!
  * \brief Write little-endian unsigned int into the file
@@ -57,7 +57,7 @@ qint64 writeLE(QFile &file, const uint16_t &in);
  * \param in Source reference
  * \return number of written bytes
  */
-qint64 writeLE(QFile &file, const uint32_t &in);
+qint64 writeLE(QIODevice &file, const uint32_t &in);
 
 /*!
  * \brief Read big-endian unsigned short from a file
@@ -65,7 +65,7 @@ qint64 writeLE(QFile &file, const uint32_t &in);
  * \param out Target reference
  * \return number of readed bytes
  */
-qint64 readBE(QFile &file, uint16_t &out);
+qint64 readBE(QIODevice &file, uint16_t &out);
 
 /*!
  * \brief Write big-endian unsigned short into the file
@@ -73,7 +73,7 @@ qint64 readBE(QFile &file, uint16_t &out);
  * \param in Source reference
  * \return number of written bytes
  */
-qint64 writeBE(QFile &file, const uint16_t &in);
+qint64 writeBE(QIODevice &file, const uint16_t &in);
 
 /*!
  * \brief Convers array of little endian bytes into short
@@ -24,16 +24,18 @@
 void BankEditor::on_insName_textChanged(const QString &arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    strncpy(m_curInst->name, arg1.toUtf8().data(), 32);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    strncpy(inst->name, arg1.toUtf8().data(), 32);
 }
 
 void BankEditor::on_insName_editingFinished()
 {
     if(m_lock) return;
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     QString arg1 = ui->insName->text();
-    strncpy(m_curInst->name, arg1.toUtf8().data(), 32);
+    strncpy(inst->name, arg1.toUtf8().data(), 32);
     reloadInstrumentNames();
 }
 
@@ -63,26 +65,29 @@ void BankEditor::on_volumeSlider_valueChanged(int value)
 void BankEditor::on_feedback1_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->feedback1 = uint8_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->feedback1 = uint8_t(arg1);
     afterChangeControlValue();
 }
 
 void BankEditor::on_am1_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     if(checked)
-        m_curInst->connection1 = FmBank::Instrument::AM;
+        inst->connection1 = FmBank::Instrument::AM;
     afterChangeControlValue();
 }
 
 void BankEditor::on_fm1_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     if(checked)
-        m_curInst->connection1 = FmBank::Instrument::FM;
+        inst->connection1 = FmBank::Instrument::FM;
     afterChangeControlValue();
 }
 
@@ -93,27 +98,29 @@ void BankEditor::on_percMode_currentIndexChanged(int index)
 
     ui->op4mode->setEnabled(ui->melodic->isChecked() || index == 0);
 
-    if(m_lock || !m_curInst)
+    if(m_lock || !curInstConst())
         return;
 
+    FmBank::Instrument *inst = curInst();
+
     // Remove 4op flag when switching the rhythm mode!
     m_lock = true;
     if(ui->op4mode->isChecked() && ui->percussion->isChecked() && index > 0)
     {
         ui->op4mode->setChecked(false);
         ui->doubleVoice->setChecked(false);
-        m_curInst->en_4op = false;
-        m_curInst->en_pseudo4op = false;
+        inst->en_4op = false;
+        inst->en_pseudo4op = false;
     }
     m_lock = false;
 
     switch(index)
     {
     case 0:
-        m_curInst->rhythm_drum_type = 0;
+        inst->rhythm_drum_type = 0;
         break;
     default:
-        m_curInst->rhythm_drum_type = uint8_t(5 + index);
+        inst->rhythm_drum_type = uint8_t(5 + index);
         break;
     }
     afterChangeControlValue();
@@ -122,8 +129,9 @@ void BankEditor::on_percMode_currentIndexChanged(int index)
 void BankEditor::on_perc_noteNum_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->percNoteNum = uint8_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->percNoteNum = uint8_t(arg1);
     if(ui->percussion->isChecked())
         ui->noteToTest->setValue(arg1);
     afterChangeControlValue();
@@ -132,42 +140,47 @@ void BankEditor::on_perc_noteNum_valueChanged(int arg1)
 void BankEditor::on_fixedNote_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->is_fixed_note = checked;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->is_fixed_note = checked;
     afterChangeControlValue();
 }
 
 void BankEditor::on_feedback2_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->feedback2 = uint8_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->feedback2 = uint8_t(arg1);
     afterChangeControlValue();
 }
 
 void BankEditor::on_am2_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     if(checked)
-        m_curInst->connection2 = FmBank::Instrument::AM;
+        inst->connection2 = FmBank::Instrument::AM;
     afterChangeControlValue();
 }
 
 void BankEditor::on_fm2_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
     if(checked)
-        m_curInst->connection2 = FmBank::Instrument::FM;
+        inst->connection2 = FmBank::Instrument::FM;
     afterChangeControlValue();
 }
 
 void BankEditor::on_op4mode_clicked(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->en_4op = checked;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->en_4op = checked;
     if(!checked)
         ui->doubleVoice->setChecked(false);
     afterChangeControlValue();
@@ -176,8 +189,9 @@ void BankEditor::on_op4mode_clicked(bool checked)
 void BankEditor::on_doubleVoice_toggled(bool checked)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->en_pseudo4op = checked;
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->en_pseudo4op = checked;
     afterChangeControlValue();
 }
 
@@ -185,16 +199,18 @@ void BankEditor::on_doubleVoice_toggled(bool checked)
 void BankEditor::on_secVoiceFineTune_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->fine_tune = int8_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->fine_tune = int8_t(arg1);
     afterChangeControlValue();
 }
 
 void BankEditor::on_noteOffset1_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->note_offset1 = int16_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->note_offset1 = int16_t(arg1);
     afterChangeControlValue();
 }
 
@@ -202,16 +218,18 @@ void BankEditor::on_noteOffset1_valueChanged(int arg1)
 void BankEditor::on_noteOffset2_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->note_offset2 = int16_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->note_offset2 = int16_t(arg1);
     afterChangeControlValue();
 }
 
 void BankEditor::on_velocityOffset_valueChanged(int arg1)
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    m_curInst->velocity_offset = int8_t(arg1);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    inst->velocity_offset = int8_t(arg1);
     afterChangeControlValue();
 }
 
@@ -234,8 +252,9 @@ void BankEditor::on_holdButton_toggled(bool checked)
 void BankEditor::onOperatorChanged()
 {
     if(m_lock) return;
-    if(!m_curInst) return;
-    static_cast<OperatorEditor *>(sender())->writeDataToInst(*m_curInst);
+    FmBank::Instrument *inst = curInst();
+    if(!inst) return;
+    static_cast<OperatorEditor *>(sender())->writeDataToInst(*inst);
     afterChangeControlValue();
 }
 
@@ -243,11 +262,15 @@ void BankEditor::onOperatorChanged()
 
 void BankEditor::afterChangeControlValue()
 {
-    Q_ASSERT(m_curInst);
-    if(m_curInst->is_blank)
+    FmBank::Instrument *inst = curInst();
+    Q_ASSERT(inst);
+    if(inst->is_blank)
     {
-        m_curInst->is_blank = false;
+        inst->is_blank = false;
         syncInstrumentBlankness();
     }
-    sendPatch();
+    sendPatchChanges();
+    // The instrument of the importer is not a part of the edited bank
+    if(m_curInstBank == &m_bank)
+        m_measurer->scheduleMeasurement(m_curInstPerc, m_curInstNum, *inst);
 }
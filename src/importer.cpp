@@ -27,16 +27,25 @@
 #include <QDropEvent>
 #include <QUrl>
 #include <QMimeData>
+#include <QApplication>
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QMessageBox>
 #include <QStatusBar>
+#include <QDir>
+#include <QtConcurrent/QtConcurrent>
 
 #include "ins_names.h"
 
 #include "FileFormats/ffmt_factory.h"
+#include "FileFormats/ffmt_archive.h"
+#include "FileFormats/ffmt_library.h"
 
 #include "common.h"
 
+//! Maximal count of found instruments to list from the library
+static const int libraryMaxFound = 4096;
+
 Importer::Importer(QWidget *parent) :
     QDialog(parent),
     m_main(qobject_cast<BankEditor * >(parent)),
@@ -45,6 +54,7 @@ Importer::Importer(QWidget *parent) :
     ui->setupUi(this);
     setMelodic();
     connect(ui->melodic,    SIGNAL(clicked(bool)),  this,   SLOT(setMelodic()));
+    connect(&m_libraryScan, SIGNAL(finished()), this, SLOT(libraryScanFinished()));
     connect(ui->percussion, SIGNAL(clicked(bool)),  this,   SLOT(setDrums()));
     connect(ui->clear, SIGNAL(clicked()), ui->instruments, SLOT(clearSelection()));
     connect(ui->selectAll, SIGNAL(clicked()), ui->instruments, SLOT(selectAll()));
@@ -57,6 +67,8 @@ Importer::Importer(QWidget *parent) :
 
 Importer::~Importer()
 {
+    // The scan is reading the catalog
+    m_libraryScan.waitForFinished();
     delete ui;
 }
 
@@ -64,6 +76,37 @@ bool Importer::openFile(QString filePath, bool isBank, FfmtErrCode *errp)
 {
     FfmtErrCode err = FfmtErrCode::ERR_UNKNOWN;
     BankFormats format = BankFormats::FORMAT_UNKNOWN;
+
+    if(FmBankArchive::isZipFile(filePath))
+    {
+        FmBankArchive archive;
+        err = archive.open(filePath);
+        QStringList names;
+        for(const FmBankArchive::Entry &e : archive.entries())
+        {
+            if(!e.isDir())
+                names.push_back(e.name);
+        }
+        if(err == FfmtErrCode::ERR_OK && names.isEmpty())
+            err = FfmtErrCode::ERR_NOFILE;
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            if(!errp)
+                ErrMessageO(this, FileFormats::getErrorText(err), isBank);
+            else
+                *errp = err;
+            return false;
+        }
+
+        bool ok = false;
+        QString entry = QInputDialog::getItem(this, "Open archive",
+                                              isBank ? "Bank file in the archive:" : "Instrument file in the archive:",
+                                              names, 0, false, &ok);
+        if(!ok || entry.isEmpty())
+            return false;
+        filePath = QString("%1/%2").arg(filePath).arg(entry);
+    }
+
     ui->importAssoc->setEnabled(true);
     ui->importReplace->setEnabled(true);
     ui->melodic->setEnabled(true);
@@ -89,7 +132,6 @@ bool Importer::openFile(QString filePath, bool isBank, FfmtErrCode *errp)
             if(isDrum)
             {
                 m_bank.Ins_Percussion_box.push_back(ins);
-                m_bank.Ins_Percussion = m_bank.Ins_Percussion_box.data();
                 ui->percussion->setDisabled(false);
                 setDrums();
                 ui->melodic->setDisabled(true);
@@ -97,7 +139,6 @@ bool Importer::openFile(QString filePath, bool isBank, FfmtErrCode *errp)
             else
             {
                 m_bank.Ins_Melodic_box.push_back(ins);
-                m_bank.Ins_Melodic = m_bank.Ins_Melodic_box.data();
                 ui->melodic->setDisabled(false);
                 setMelodic();
                 ui->percussion->setDisabled(true);
@@ -133,9 +174,10 @@ void Importer::setMelodic()
     ui->instruments->clear();
     for(int i = 0; i < m_bank.countMelodic(); i++)
     {
+        const FmBank::Instrument &ins = m_bank.Ins_Melodic_box.at(i);
         QListWidgetItem *item = new QListWidgetItem();
-        item->setText(m_bank.Ins_Melodic[i].name[0] != '\0' ?
-                      QString::fromUtf8(m_bank.Ins_Melodic[i].name) : getInstrumentName(i, false, false));
+        item->setText(ins.name[0] != '\0' ?
+                      QString::fromUtf8(ins.name) : getInstrumentName(i, false, false));
         item->setData(Qt::UserRole, i);
         item->setToolTip(QString("ID: %1").arg(i));
         item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
@@ -149,9 +191,10 @@ void Importer::setDrums()
     ui->instruments->clear();
     for(int i = 0; i < m_bank.countDrums(); i++)
     {
+        const FmBank::Instrument &ins = m_bank.Ins_Percussion_box.at(i);
         QListWidgetItem *item = new QListWidgetItem();
-        item->setText(m_bank.Ins_Percussion[i].name[0] != '\0' ?
-                      QString::fromUtf8(m_bank.Ins_Percussion[i].name) : getInstrumentName(i, false, true));
+        item->setText(ins.name[0] != '\0' ?
+                      QString::fromUtf8(ins.name) : getInstrumentName(i, false, true));
         item->setData(Qt::UserRole, i);
         item->setToolTip(QString("ID: %1").arg(i));
         item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
@@ -161,7 +204,11 @@ void Importer::setDrums()
 
 void Importer::initFileData(QString &filePath)
 {
-    m_recentPath = QFileInfo(filePath).absoluteDir().absolutePath();
+    QString archivePath, entryName;
+    if(FmBankArchive::splitPath(filePath, archivePath, entryName))
+        m_recentPath = QFileInfo(archivePath).absoluteDir().absolutePath();
+    else
+        m_recentPath = QFileInfo(filePath).absoluteDir().absolutePath();
     ui->doImport->setEnabled(true);
 
     if(ui->melodic->isChecked())
@@ -187,6 +234,7 @@ void Importer::initFileData(QString &filePath)
 void Importer::on_openBank_clicked()
 {
     QString filters = FmBankFormatFactory::getOpenFiltersList(true);
+    filters.append(";;Archives (*.zip *.gz)");
     QString fileToOpen;
     fileToOpen = QFileDialog::getOpenFileName(this, "Open bank file",
                                               m_recentPath, filters, nullptr,
@@ -199,6 +247,7 @@ void Importer::on_openBank_clicked()
 void Importer::on_openInst_clicked()
 {
     QString filters = FmBankFormatFactory::getInstOpenFiltersList(true);
+    filters.append(";;Archives (*.zip *.gz)");
     QString fileToOpen;
     fileToOpen = QFileDialog::getOpenFileName(this, "Open instrument file",
                                               m_recentPath, filters, nullptr,
@@ -208,6 +257,125 @@ void Importer::on_openInst_clicked()
     openFile(fileToOpen, false);
 }
 
+void Importer::on_openLibrary_clicked()
+{
+    QString dirToOpen;
+    dirToOpen = QFileDialog::getExistingDirectory(this, "Open directory with banks",
+                                                  m_recentPath, FILE_OPEN_DIALOG_OPTIONS);
+    if(dirToOpen.isEmpty())
+        return;
+
+    bool ok = false;
+    QString text = QInputDialog::getText(this, "Search library",
+                                         "Name of instrument or file (empty to take all):",
+                                         QLineEdit::Normal, QString(), &ok);
+    if(!ok)
+        return;
+
+    m_recentPath = dirToOpen;
+    if(QDir(dirToOpen).absolutePath() != m_library.rootDir())
+    {
+        // The running scan is reading the catalog which is going to be closed
+        m_libraryScan.waitForFinished();
+        if(m_librarySearchPending)
+        {
+            m_librarySearchPending = false;
+            QApplication::restoreOverrideCursor();
+        }
+        m_library.open(dirToOpen);
+    }
+
+    // Changes are found in the background, the current catalog is searched right now
+    if(!m_libraryScan.isRunning())
+        startLibraryScan();
+
+    if(m_library.count() == 0)
+    {
+        // Nothing to search until the first scan is done
+        m_librarySearch = text;
+        if(!m_librarySearchPending)
+        {
+            m_librarySearchPending = true;
+            QApplication::setOverrideCursor(Qt::BusyCursor);
+        }
+        return;
+    }
+
+    showLibrarySearch(text);
+}
+
+void Importer::startLibraryScan()
+{
+    const FmBankLibrary *library = &m_library;
+    m_libraryScanRoot = m_library.rootDir();
+    m_libraryScan.setFuture(QtConcurrent::run([library]()
+    {
+        return library->scan();
+    }));
+}
+
+void Importer::libraryScanFinished()
+{
+    // The catalog of another directory was opened meanwhile
+    if(m_libraryScanRoot != m_library.rootDir())
+        return;
+
+    FfmtErrCode err = m_library.replaceStore(m_libraryScan.result());
+    if(!m_librarySearchPending)
+        return;
+
+    m_librarySearchPending = false;
+    QApplication::restoreOverrideCursor();
+    // The catalog is usable even if the store can't be written
+    if(err != FfmtErrCode::ERR_OK && m_library.count() == 0)
+    {
+        ErrMessageO(this, FileFormats::getErrorText(err), true);
+        return;
+    }
+
+    showLibrarySearch(m_librarySearch);
+}
+
+void Importer::showLibrarySearch(const QString &text)
+{
+    const QString dir = QDir::toNativeSeparators(m_library.rootDir());
+
+    // One more is taken to know that not all found instruments are listed
+    QVector<int> found = m_library.search(text, libraryMaxFound + 1);
+    bool isPartial = found.size() > libraryMaxFound;
+    if(isPartial)
+        found.resize(libraryMaxFound);
+
+    if(found.isEmpty())
+    {
+        QMessageBox::information(this, "Search library",
+                                 tr("No instruments were found in %1").arg(dir));
+        return;
+    }
+
+    ui->importAssoc->setEnabled(true);
+    ui->importReplace->setEnabled(true);
+    ui->melodic->setEnabled(true);
+    ui->percussion->setEnabled(true);
+    ui->instruments->clearSelection();
+    ui->instruments->setCurrentItem(NULL);
+
+    m_library.toBank(found, m_bank);
+    ui->importReplace->click();
+    ui->importAssoc->setEnabled(false);
+    if(m_bank.countMelodic() == 0)
+        ui->percussion->setChecked(true);
+    else if(m_bank.countDrums() == 0)
+        ui->melodic->setChecked(true);
+
+    QString label = text.isEmpty() ? dir : QString("%1: %2").arg(dir).arg(text);
+    initFileData(label);
+    if(isPartial)
+        ui->openedBank->setToolTip(tr("First %1 found instruments are listed, refine the search to see others").arg(found.size()));
+    else
+        ui->openedBank->setToolTip(tr("%1 instruments found").arg(found.size()));
+}
+
 void Importer::dragEnterEvent(QDragEnterEvent *e)
 {
     if(e->mimeData()->hasUrls())
@@ -453,7 +621,7 @@ void Importer::on_instruments_currentItemChanged(QListWidgetItem *current, QList
     if(!current)
     {
         //ui->curInsInfo->setText("<Not Selected>");
-        m_main->m_curInst = NULL;
+        m_main->setEditedInstrument(nullptr, -1, false);
     }
     else
     {
@@ -466,7 +634,7 @@ void Importer::on_instruments_currentItemChanged(QListWidgetItem *current, QList
 
 void Importer::setCurrentInstrument(int num, bool isPerc)
 {
-    m_main->m_curInst = isPerc ? &m_bank.Ins_Percussion[num] : &m_bank.Ins_Melodic[num];
+    m_main->setEditedInstrument(&m_bank, num, isPerc);
 }
 
 QString Importer::getInstrumentName(int instrument, bool isAuto, bool isPerc)
@@ -480,8 +648,7 @@ QString Importer::getInstrumentName(int instrument, bool isAuto, bool isPerc)
         MidiProgramId pr = MidiProgramId(isAuto ? ui->percussion->isChecked() : isPerc, msb, lsb, instrument);
         unsigned spec = kMidiSpecXG|kMidiSpecGM1; // TODO importer: getSelectedMidiSpec();
         unsigned specObtained = kMidiSpecXG;
-        const MidiProgram *p = getMidiProgram(pr, spec, &specObtained);
-        p = p ? p : getFallbackProgram(pr, spec, &specObtained);
+        const MidiProgram *p = findMidiProgram(pr, spec, &specObtained);
         name = p ? p->patchName : tr("<Reserved %1>").arg(instrument % 128);
     }
     return name;
@@ -496,8 +663,9 @@ void Importer::reloadInstrumentNames()
         for(int i = 0; i < items.size(); i++)
         {
             int index = items[i]->data(Qt::UserRole).toInt();
-            items[i]->setText(m_bank.Ins_Percussion[index].name[0] != '\0' ?
-                              QString::fromUtf8(m_bank.Ins_Percussion[index].name) :
+            const FmBank::Instrument &ins = m_bank.Ins_Percussion_box.at(index);
+            items[i]->setText(ins.name[0] != '\0' ?
+                              QString::fromUtf8(ins.name) :
                               getInstrumentName(index, false, true));
         }
     }
@@ -506,8 +674,9 @@ void Importer::reloadInstrumentNames()
         for(int i = 0; i < items.size(); i++)
         {
             int index = items[i]->data(Qt::UserRole).toInt();
-            items[i]->setText(m_bank.Ins_Melodic[index].name[0] != '\0' ?
-                              QString::fromUtf8(m_bank.Ins_Melodic[index].name) :
+            const FmBank::Instrument &ins = m_bank.Ins_Melodic_box.at(index);
+            items[i]->setText(ins.name[0] != '\0' ?
+                              QString::fromUtf8(ins.name) :
                               getInstrumentName(index, false, false));
         }
     }
@@ -558,8 +727,8 @@ void Importer::on_doImport_clicked()
             FmBank::MidiBank *srcMidiBank = &
                 (srcPercussive ? srcFmBank.Banks_Percussion : srcFmBank.Banks_Melodic)
                 [id / 128];
-            FmBank::Instrument *srcIns = srcPercussive ?
-                srcFmBank.Ins_Percussion : srcFmBank.Ins_Melodic;
+            const FmBank::InsStorage &srcIns = srcPercussive ?
+                srcFmBank.Ins_Percussion_box : srcFmBank.Ins_Melodic_box;
 
             FmBank::MidiBank *dstMidiBank;
             FmBank::Instrument *dstIns;
@@ -577,10 +746,10 @@ void Importer::on_doImport_clicked()
         {
             int srcId = selected[0]->data(Qt::UserRole).toInt();
 
-            FmBank::Instrument *srcIns = srcPercussive ?
-                srcFmBank.Ins_Percussion : srcFmBank.Ins_Melodic;
-            FmBank::Instrument *dstIns = dstPercussive ?
-                dstFmBank.Ins_Percussion : dstFmBank.Ins_Melodic;
+            const FmBank::InsStorage &srcIns = srcPercussive ?
+                srcFmBank.Ins_Percussion_box : srcFmBank.Ins_Melodic_box;
+            FmBank::InsStorage &dstIns = dstPercussive ?
+                dstFmBank.Ins_Percussion_box : dstFmBank.Ins_Melodic_box;
 
             dstIns[dstId] = srcIns[srcId];
 
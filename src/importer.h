@@ -25,8 +25,10 @@
 #include <QDialog>
 #include <QListWidget>
 #include <QListWidgetItem>
+#include <QFutureWatcher>
 #include "bank.h"
 #include "FileFormats/ffmt_enums.h"
+#include "FileFormats/ffmt_library.h"
 
 namespace Ui {
 class Importer;
@@ -57,6 +59,8 @@ public slots:
 private slots:
     void on_openBank_clicked();
     void on_openInst_clicked();
+    void on_openLibrary_clicked();
+    void libraryScanFinished();
     void on_instruments_currentItemChanged(QListWidgetItem *current, QListWidgetItem *);
 
     void on_importAssoc_clicked();
@@ -76,6 +80,17 @@ private:
      */
     void onLanguageChanged();
 
+    /**
+     * @brief Update the catalog of the library in the background
+     */
+    void startLibraryScan();
+
+    /**
+     * @brief Search the catalog of the library and list found instruments
+     * @param text Text to find, empty to take all
+     */
+    void showLibrarySearch(const QString &text);
+
 private:
     //! Currently selected instrument
     FmBank::Instrument* m_curInst;
@@ -84,6 +99,15 @@ private:
     FmBank  m_bank;
     Ui::Importer *ui;
     QString m_recentPath;
+
+    //! Catalog of the recently opened library, it's searched while being updated
+    FmBankLibrary m_library;
+    QFutureWatcher<QByteArray> m_libraryScan;
+    //! Root directory of the running scan
+    QString m_libraryScanRoot;
+    //! Search which waits for the first scan of the library
+    QString m_librarySearch;
+    bool    m_librarySearchPending = false;
 };
 
 #endif // IMPORTER_H
@@ -21,73 +21,67 @@
 
 #include "ins_names.h"
 #include "ins_names_data.h"
-#include <QHash>
 #include <QObject>
+#include <algorithm>
 
-static bool mapsInitialized = false;
-typedef QHash<uint32_t, const MidiProgram *> InstrumentMap;
-static InstrumentMap XgMap, GsMap, ScMap, Gm2Map, Gm1Map;
-
-static void fillInstMap(InstrumentMap &map, const MidiProgram *pgms, unsigned size)
+struct MidiProgramIndex
 {
-    map.clear();
+    //! Key of the program, see MidiProgramId::key()
+    uint32_t key;
+    //! Index of the program in every set of the same order as s_programSets, -1 if absent
+    int16_t program[5];
+};
 
-    for(unsigned i = 0; i < size; ++i)
-    {
-        MidiProgramId id;
-        id.percussive = pgms[i].kind == 'P';
-        id.bankMsb = pgms[i].bankMsb;
-        id.bankLsb = pgms[i].bankLsb;
-        id.program = pgms[i].program;
-        map[id.identifier] = &pgms[i];
-        // insert pseudo-entry for bank (reserved = 1, program = 0)
-        id.reserved = 1;
-        id.program = 0;
-        if(!map.contains(id.identifier))
-            map[id.identifier] = &pgms[i];
-    }
+#include "ins_names_index.h"
+
+struct MidiProgramSet
+{
+    MidiSpec spec;
+    const MidiProgram *programs;
+};
 
-    map.squeeze();
+static const MidiProgramSet s_programSets[] =
+{
+    {kMidiSpecXG, XgSet},
+    {kMidiSpecGS, GsSet},
+    {kMidiSpecSC, ScSet},
+    {kMidiSpecGM2, Gm2Set},
+    {kMidiSpecGM1, Gm1Set},
+};
+
+#define CHECK_SET_SIZE(x) \
+    static_assert(sizeof(x) / sizeof(*x) <= INT16_MAX + 1, #x " is too large for MidiProgramIndex")
+CHECK_SET_SIZE(XgSet);
+CHECK_SET_SIZE(GsSet);
+CHECK_SET_SIZE(ScSet);
+CHECK_SET_SIZE(Gm2Set);
+CHECK_SET_SIZE(Gm1Set);
+#undef CHECK_SET_SIZE
+
+static const MidiProgramIndex *findIndex(uint32_t key)
+{
+    const MidiProgramIndex *begin = g_midiProgramIndex;
+    const MidiProgramIndex *end = begin + sizeof(g_midiProgramIndex) / sizeof(*g_midiProgramIndex);
+    const MidiProgramIndex *it = std::lower_bound(begin, end, key,
+                                                  [](const MidiProgramIndex &e, uint32_t k)
+                                                  { return e.key < k; });
+    return (it != end && it->key == key) ? it : nullptr;
 }
 
 const MidiProgram *getMidiProgram(MidiProgramId id, unsigned spec, unsigned *specObtained)
 {
-    if(!mapsInitialized)
-    {
-        fillInstMap(XgMap, XgSet, sizeof(XgSet) / sizeof(*XgSet));
-        fillInstMap(GsMap, GsSet, sizeof(GsSet) / sizeof(*GsSet));
-        fillInstMap(ScMap, ScSet, sizeof(ScSet) / sizeof(*ScSet));
-        fillInstMap(Gm2Map, Gm2Set, sizeof(Gm2Set) / sizeof(*Gm2Set));
-        fillInstMap(Gm1Map, Gm1Set, sizeof(Gm1Set) / sizeof(*Gm1Set));
-        mapsInitialized = true;
-    }
-
-    struct MidiSpecToInstrumentMap
-    {
-        MidiSpec spec;
-        const InstrumentMap *map;
-    };
-
-    const MidiSpecToInstrumentMap imaps[] =
-    {
-        {kMidiSpecXG, &XgMap},
-        {kMidiSpecGS, &GsMap},
-        {kMidiSpecSC, &ScMap},
-        {kMidiSpecGM2, &Gm2Map},
-        {kMidiSpecGM1, &Gm1Map},
-    };
-
     const MidiProgram *pgm = nullptr;
     unsigned pgmspec = kMidiSpecNone;
 
-    for(const MidiSpecToInstrumentMap &imap : imaps)
+    if(const MidiProgramIndex *e = findIndex(id.key()))
     {
-        if(!(spec & imap.spec))
-            continue;
-        pgm = imap.map->value(id.identifier);
-        if(pgm)
+        for(unsigned i = 0; i < sizeof(s_programSets) / sizeof(*s_programSets); ++i)
         {
-            pgmspec = imap.spec;
+            const MidiProgramSet &set = s_programSets[i];
+            if(!(spec & set.spec) || e->program[i] < 0)
+                continue;
+            pgm = &set.programs[e->program[i]];
+            pgmspec = set.spec;
             break;
         }
     }
@@ -119,6 +113,14 @@ const MidiProgram *getMidiBank(MidiProgramId id, unsigned spec, unsigned *specOb
     return getMidiProgram(id, spec, specObtained);
 }
 
+const MidiProgram *findMidiProgram(MidiProgramId id, unsigned spec, unsigned *specObtained, bool *isFallback)
+{
+    const MidiProgram *pgm = getMidiProgram(id, spec, specObtained);
+    if(isFallback)
+        *isFallback = (pgm == nullptr);
+    return pgm ? pgm : getFallbackProgram(id, spec, specObtained);
+}
+
 /// Deprecated
 
 static QString getMidiInsName(bool percussive, unsigned index)
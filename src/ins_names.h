@@ -75,6 +75,17 @@ struct MidiProgramId
         program = p;
     }
 
+    /**
+     * @brief Key of the program in the index of names
+     *
+     * Same as the identifier with little-endian bit fields, but not depending on the layout.
+     */
+    uint32_t key() const
+    {
+        return uint32_t(percussive) | (uint32_t(bankMsb) << 1) | (uint32_t(bankLsb) << 8) |
+               (uint32_t(program) << 15) | (uint32_t(reserved) << 22);
+    }
+
     union
     {
         uint32_t identifier;
@@ -93,6 +104,19 @@ const MidiProgram *getMidiProgram(MidiProgramId id, unsigned spec, unsigned *spe
 const MidiProgram *getFallbackProgram(MidiProgramId id, unsigned spec, unsigned *specObtained = nullptr);
 const MidiProgram *getMidiBank(MidiProgramId id, unsigned spec, unsigned *specObtained = nullptr);
 
+/**
+ * @brief Find the program of the best matching specification, or the fallback program
+ * @param id Program identifier
+ * @param spec Combination of allowed MIDI specifications
+ * @param specObtained unless null, receives the specification of the found program
+ * @param isFallback unless null, receives true if fallback program was given
+ * @return found program or null
+ *
+ * Functions are using static tables only, so they are safe to call from any thread.
+ */
+const MidiProgram *findMidiProgram(MidiProgramId id, unsigned spec,
+                                   unsigned *specObtained = nullptr, bool *isFallback = nullptr);
+
 Q_DECL_DEPRECATED QString getMidiInsNameM(unsigned index);
 Q_DECL_DEPRECATED QString getMidiInsNameP(unsigned index);
 
@@ -0,0 +1,14055 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Generated by utils/ins_names_index from ins_names_data.h, do not edit */
+
+static constexpr MidiProgramIndex g_midiProgramIndex[] =
+{
+    {0x000000, {   -1,    -1,    -1,    -1,     0}},
+    {0x000002, {   -1,    -1,   512,    -1,    -1}},
+    {0x000004, {   -1,    -1,   848,    -1,    -1}},
+    {0x000007, {   -1,    -1,  6963,    -1,    -1}},
+    {0x000009, {   -1,    -1,  8387,    -1,    -1}},
+    {0x000010, {   -1,    40,  1647,    -1,    -1}},
+    {0x000012, {   -1,    -1,  2062,    -1,    -1}},
+    {0x000020, {   -1,    80,  2610,    -1,    -1}},
+    {0x000030, {   -1,    -1,  3194,    -1,    -1}},
+    {0x000032, {   -1,    -1,  3328,    -1,    -1}},
+    {0x000034, {   -1,    -1,  3390,    -1,    -1}},
+    {0x000036, {   -1,    -1,  3434,    -1,    -1}},
+    {0x000060, { 1161,    -1,    -1,    -1,    -1}},
+    {0x000080, { 1262,    -1,    -1,    -1,    -1}},
+    {0x0000F2, {   -1,    -1,    -1,     0,    -1}},
+    {0x000100, {    0,    -1,     0,    -1,    -1}},
+    {0x000101, {   -1,    -1,  4006,    -1,    -1}},
+    {0x000109, {   -1,    -1,  8509,    -1,    -1}},
+    {0x000110, {   -1,    -1,  1755,    -1,    -1}},
+    {0x000120, {   -1,    -1,  2678,    -1,    -1}},
+    {0x0001F2, {   -1,    -1,    -1,   128,    -1}},
+    {0x0001FC, {   -1,    -1,  3814,    -1,    -1}},
+    {0x0001FE, {   -1,    -1,  3878,    -1,    -1}},
+    {0x000200, {   -1,    -1,   128,    -1,    -1}},
+    {0x000210, {   -1,    -1,  1792,    -1,    -1}},
+    {0x000220, {   -1,    -1,  2690,    -1,    -1}},
+    {0x0002F2, {   -1,    -1,    -1,   192,    -1}},
+    {0x000300, {   -1,    -1,   256,    -1,    -1}},
+    {0x000310, {   -1,    -1,  1855,    -1,    -1}},
+    {0x000320, {   -1,    -1,  2719,    -1,    -1}},
+    {0x000330, {   -1,    -1,  3253,    -1,    -1}},
+    {0x000400, {   -1,    -1,   384,    -1,    -1}},
+    {0x000402, {   -1,    -1,   755,    -1,    -1}},
+    {0x000404, {   -1,    -1,  1000,    -1,    -1}},
+    {0x000410, {   -1,    -1,  1954,    -1,    -1}},
+    {0x000412, {   -1,    -1,  2201,    -1,    -1}},
+    {0x000420, {   -1,    -1,  2779,    -1,    -1}},
+    {0x000430, {   -1,    -1,  3284,    -1,    -1}},
+    {0x000432, {   -1,    -1,  3367,    -1,    -1}},
+    {0x000434, {   -1,    -1,  3415,    -1,    -1}},
+    {0x000436, {   -1,    -1,  3450,    -1,    -1}},
+    {0x000860, { 1163,    -1,    -1,    -1,    -1}},
+    {0x000901, {   -1,    -1,  4244,    -1,    -1}},
+    {0x000907, {   -1,    -1,  7161,    -1,    -1}},
+    {0x000909, {   -1,    -1,  8747,    -1,    -1}},
+    {0x001060, { 1185,    -1,    -1,    -1,    -1}},
+    {0x001200, {   51,    -1,    -1,    -1,    -1}},
+    {0x001462, { 1257,    -1,    -1,    -1,    -1}},
+    {0x001801, {   -1,    -1,  4592,    -1,    -1}},
+    {0x001809, {   -1,    -1,  9095,    -1,    -1}},
+    {0x001860, { 1199,    -1,    -1,    -1,    -1}},
+    {0x002001, {   -1,    -1,  4905,    -1,    -1}},
+    {0x002007, {   -1,    -1,  7665,    -1,    -1}},
+    {0x002009, {   -1,    -1,  9408,    -1,    -1}},
+    {0x002800, {  172,    -1,    -1,    -1,    -1}},
+    {0x002801, {   -1,    -1,  5075,    -1,    -1}},
+    {0x002809, {   -1,    -1,  9578,    -1,    -1}},
+    {0x002900, {  220,    -1,    -1,    -1,    -1}},
+    {0x003001, {   -1,    -1,  5271,    -1,    -1}},
+    {0x003007, {   -1,    -1,  7807,    -1,    -1}},
+    {0x003009, {   -1,    -1,  9774,    -1,    -1}},
+    {0x003860, { 1209,    -1,    -1,    -1,    -1}},
+    {0x004000, {  276,    -1,    -1,    -1,    -1}},
+    {0x004060, { 1211,    -1,    -1,    -1,    -1}},
+    {0x004100, {  372,    -1,    -1,    -1,    -1}},
+    {0x004200, {  452,    -1,    -1,    -1,    -1}},
+    {0x004300, {  521,    -1,    -1,    -1,    -1}},
+    {0x004400, {  577,    -1,    -1,    -1,    -1}},
+    {0x004500, {  614,    -1,    -1,    -1,    -1}},
+    {0x004860, { 1215,    -1,    -1,    -1,    -1}},
+    {0x005060, { 1234,    -1,    -1,    -1,    -1}},
+    {0x005860, { 1235,    -1,    -1,    -1,    -1}},
+    {0x006060, { 1244,    -1,    -1,    -1,    -1}},
+    {0x006860, { 1249,    -1,    -1,    -1,    -1}},
+    {0x007860, { 1256,    -1,    -1,    -1,    -1}},
+    {0x007E00, {  905,    -1,    -1,    -1,    -1}},
+    {0x007F00, { 1033,    -1,    -1,    -1,    -1}},
+    {0x008000, {   -1,    -1,    -1,    -1,     1}},
+    {0x008002, {   -1,    -1,   513,    -1,    -1}},
+    {0x008004, {   -1,    -1,   849,    -1,    -1}},
+    {0x008007, {   -1,    -1,  6964,    -1,    -1}},
+    {0x008009, {   -1,    -1,  8388,    -1,    -1}},
+    {0x008010, {   -1,    41,  1648,    -1,    -1}},
+    {0x008012, {   -1,    -1,  2063,    -1,    -1}},
+    {0x008020, {   -1,    -1,  2611,    -1,    -1}},
+    {0x008060, { 1162,    -1,    -1,    -1,    -1}},
+    {0x008080, { 1263,    -1,    -1,    -1,    -1}},
+    {0x0080F2, {   -1,    -1,    -1,     1,    -1}},
+    {0x008100, {    1,    -1,     1,    -1,    -1}},
+    {0x008101, {   -1,    -1,  4007,    -1,    -1}},
+    {0x008109, {   -1,    -1,  8510,    -1,    -1}},
+    {0x008110, {   -1,    -1,  1756,    -1,    -1}},
+    {0x0081F2, {   -1,    -1,    -1,   129,    -1}},
+    {0x0081FC, {   -1,    -1,  3815,    -1,    -1}},
+    {0x0081FE, {   -1,    -1,  3879,    -1,    -1}},
+    {0x008200, {   -1,    -1,   129,    -1,    -1}},
+    {0x008210, {   -1,    -1,  1793,    -1,    -1}},
+    {0x008300, {   10,    -1,   257,    -1,    -1}},
+    {0x008310, {   -1,    -1,  1856,    -1,    -1}},
+    {0x008320, {   -1,    -1,  2720,    -1,    -1}},
+    {0x008400, {   -1,    -1,   385,    -1,    -1}},
+    {0x008402, {   -1,    -1,   756,    -1,    -1}},
+    {0x008404, {   -1,    -1,  1001,    -1,    -1}},
+    {0x008410, {   -1,    -1,  1955,    -1,    -1}},
+    {0x008412, {   -1,    -1,  2202,    -1,    -1}},
+    {0x008420, {   -1,    -1,  2780,    -1,    -1}},
+    {0x008860, { 1164,    -1,    -1,    -1,    -1}},
+    {0x008901, {   -1,    -1,  4245,    -1,    -1}},
+    {0x008907, {   -1,    -1,  7162,    -1,    -1}},
+    {0x008909, {   -1,    -1,  8748,    -1,    -1}},
+    {0x009060, { 1186,    -1,    -1,    -1,    -1}},
+    {0x009400, {   71,    -1,    -1,    -1,    -1}},
+    {0x009462, { 1258,    -1,    -1,    -1,    -1}},
+    {0x009801, {   -1,    -1,  4593,    -1,    -1}},
+    {0x009809, {   -1,    -1,  9096,    -1,    -1}},
+    {0x009860, { 1200,    -1,    -1,    -1,    -1}},
+    {0x00A000, {  106,    -1,    -1,    -1,    -1}},
+    {0x00A001, {   -1,    -1,  4906,    -1,    -1}},
+    {0x00A007, {   -1,    -1,  7666,    -1,    -1}},
+    {0x00A009, {   -1,    -1,  9409,    -1,    -1}},
+    {0x00A800, {  173,    -1,    -1,    -1,    -1}},
+    {0x00A801, {   -1,    -1,  5076,    -1,    -1}},
+    {0x00A809, {   -1,    -1,  9579,    -1,    -1}},
+    {0x00B001, {   -1,    -1,  5272,    -1,    -1}},
+    {0x00B007, {   -1,    -1,  7808,    -1,    -1}},
+    {0x00B009, {   -1,    -1,  9775,    -1,    -1}},
+    {0x00B860, { 1210,    -1,    -1,    -1,    -1}},
+    {0x00C000, {  277,    -1,    -1,    -1,    -1}},
+    {0x00C060, { 1212,    -1,    -1,    -1,    -1}},
+    {0x00C100, {  373,    -1,    -1,    -1,    -1}},
+    {0x00C200, {  453,    -1,    -1,    -1,    -1}},
+    {0x00C300, {  522,    -1,    -1,    -1,    -1}},
+    {0x00C400, {  578,    -1,    -1,    -1,    -1}},
+    {0x00C860, { 1216,    -1,    -1,    -1,    -1}},
+    {0x00D860, { 1236,    -1,    -1,    -1,    -1}},
+    {0x00E060, { 1245,    -1,    -1,    -1,    -1}},
+    {0x00E860, { 1250,    -1,    -1,    -1,    -1}},
+    {0x00FE00, {  906,    -1,    -1,    -1,    -1}},
+    {0x00FF00, { 1034,    -1,    -1,    -1,    -1}},
+    {0x010000, {   -1,    -1,    -1,    -1,     2}},
+    {0x010002, {   -1,    -1,   514,    -1,    -1}},
+    {0x010004, {   -1,    -1,   850,    -1,    -1}},
+    {0x010007, {   -1,    -1,  6965,    -1,    -1}},
+    {0x010009, {   -1,    -1,  8389,    -1,    -1}},
+    {0x010010, {   -1,    42,  1649,    -1,    -1}},
+    {0x010080, { 1264,    -1,    -1,    -1,    -1}},
+    {0x0100F2, {   -1,    -1,    -1,     2,    -1}},
+    {0x010100, {    2,    -1,     2,    -1,    -1}},
+    {0x010101, {   -1,    -1,  4008,    -1,    -1}},
+    {0x010109, {   -1,    -1,  8511,    -1,    -1}},
+    {0x010110, {   -1,    -1,  1757,    -1,    -1}},
+    {0x0101F2, {   -1,    -1,    -1,   130,    -1}},
+    {0x0101FC, {   -1,    -1,  3816,    -1,    -1}},
+    {0x0101FE, {   -1,    -1,  3880,    -1,    -1}},
+    {0x010200, {   -1,    -1,   130,    -1,    -1}},
+    {0x010202, {   -1,    -1,   621,    -1,    -1}},
+    {0x010204, {   -1,    -1,   925,    -1,    -1}},
+    {0x010210, {   -1,    -1,  1794,    -1,    -1}},
+    {0x010300, {   -1,    -1,   258,    -1,    -1}},
+    {0x010302, {   -1,    -1,   675,    -1,    -1}},
+    {0x010304, {   -1,    -1,   950,    -1,    -1}},
+    {0x010310, {   -1,    -1,  1857,    -1,    -1}},
+    {0x010400, {   -1,    -1,   386,    -1,    -1}},
+    {0x010402, {   -1,    -1,   757,    -1,    -1}},
+    {0x010404, {   -1,    -1,  1002,    -1,    -1}},
+    {0x010410, {   -1,    -1,  1956,    -1,    -1}},
+    {0x010860, { 1165,    -1,    -1,    -1,    -1}},
+    {0x010901, {   -1,    -1,  4246,    -1,    -1}},
+    {0x010907, {   -1,    -1,  7163,    -1,    -1}},
+    {0x010909, {   -1,    -1,  8749,    -1,    -1}},
+    {0x011060, { 1187,    -1,    -1,    -1,    -1}},
+    {0x011462, { 1259,    -1,    -1,    -1,    -1}},
+    {0x011801, {   -1,    -1,  4594,    -1,    -1}},
+    {0x011809, {   -1,    -1,  9097,    -1,    -1}},
+    {0x011860, { 1201,    -1,    -1,    -1,    -1}},
+    {0x012000, {  107,    -1,    -1,    -1,    -1}},
+    {0x012001, {   -1,    -1,  4907,    -1,    -1}},
+    {0x012007, {   -1,    -1,  7667,    -1,    -1}},
+    {0x012009, {   -1,    -1,  9410,    -1,    -1}},
+    {0x012300, {  140,    -1,    -1,    -1,    -1}},
+    {0x012800, {  174,    -1,    -1,    -1,    -1}},
+    {0x012801, {   -1,    -1,  5077,    -1,    -1}},
+    {0x012809, {   -1,    -1,  9580,    -1,    -1}},
+    {0x012900, {  221,    -1,    -1,    -1,    -1}},
+    {0x013001, {   -1,    -1,  5273,    -1,    -1}},
+    {0x013007, {   -1,    -1,  7809,    -1,    -1}},
+    {0x013009, {   -1,    -1,  9776,    -1,    -1}},
+    {0x014060, { 1213,    -1,    -1,    -1,    -1}},
+    {0x014860, { 1217,    -1,    -1,    -1,    -1}},
+    {0x015860, { 1237,    -1,    -1,    -1,    -1}},
+    {0x016060, { 1246,    -1,    -1,    -1,    -1}},
+    {0x016860, { 1251,    -1,    -1,    -1,    -1}},
+    {0x017E00, {  907,    -1,    -1,    -1,    -1}},
+    {0x017F00, { 1035,    -1,    -1,    -1,    -1}},
+    {0x018000, {   -1,    -1,    -1,    -1,     3}},
+    {0x018007, {   -1,    -1,  6966,    -1,    -1}},
+    {0x018009, {   -1,    -1,  8390,    -1,    -1}},
+    {0x018010, {   -1,    43,  1650,    -1,    -1}},
+    {0x018080, { 1265,    -1,    -1,    -1,    -1}},
+    {0x0180F2, {   -1,    -1,    -1,     3,    -1}},
+    {0x018100, {    3,    -1,     3,    -1,    -1}},
+    {0x018101, {   -1,    -1,  4009,    -1,    -1}},
+    {0x018109, {   -1,    -1,  8512,    -1,    -1}},
+    {0x018110, {   -1,    -1,  1758,    -1,    -1}},
+    {0x0181F2, {   -1,    -1,    -1,   131,    -1}},
+    {0x0181FC, {   -1,    -1,  3817,    -1,    -1}},
+    {0x0181FE, {   -1,    -1,  3881,    -1,    -1}},
+    {0x018200, {   -1,    -1,   131,    -1,    -1}},
+    {0x018210, {   -1,    -1,  1795,    -1,    -1}},
+    {0x018300, {   -1,    -1,   259,    -1,    -1}},
+    {0x018310, {   -1,    -1,  1858,    -1,    -1}},
+    {0x018400, {   -1,    -1,   387,    -1,    -1}},
+    {0x018410, {   -1,    -1,  1957,    -1,    -1}},
+    {0x018860, { 1166,    -1,    -1,    -1,    -1}},
+    {0x018901, {   -1,    -1,  4247,    -1,    -1}},
+    {0x018907, {   -1,    -1,  7164,    -1,    -1}},
+    {0x018909, {   -1,    -1,  8750,    -1,    -1}},
+    {0x019060, { 1188,    -1,    -1,    -1,    -1}},
+    {0x019462, { 1260,    -1,    -1,    -1,    -1}},
+    {0x019801, {   -1,    -1,  4595,    -1,    -1}},
+    {0x019809, {   -1,    -1,  9098,    -1,    -1}},
+    {0x019860, { 1202,    -1,    -1,    -1,    -1}},
+    {0x01A001, {   -1,    -1,  4908,    -1,    -1}},
+    {0x01A007, {   -1,    -1,  7668,    -1,    -1}},
+    {0x01A009, {   -1,    -1,  9411,    -1,    -1}},
+    {0x01A801, {   -1,    -1,  5078,    -1,    -1}},
+    {0x01A809, {   -1,    -1,  9581,    -1,    -1}},
+    {0x01B001, {   -1,    -1,  5274,    -1,    -1}},
+    {0x01B007, {   -1,    -1,  7810,    -1,    -1}},
+    {0x01B009, {   -1,    -1,  9777,    -1,    -1}},
+    {0x01C060, { 1214,    -1,    -1,    -1,    -1}},
+    {0x01C860, { 1218,    -1,    -1,    -1,    -1}},
+    {0x01D860, { 1238,    -1,    -1,    -1,    -1}},
+    {0x01E060, { 1247,    -1,    -1,    -1,    -1}},
+    {0x01E860, { 1252,    -1,    -1,    -1,    -1}},
+    {0x01FE00, {  908,    -1,    -1,    -1,    -1}},
+    {0x01FF00, { 1036,    -1,    -1,    -1,    -1}},
+    {0x020000, {   -1,    -1,    -1,    -1,     4}},
+    {0x020007, {   -1,    -1,  6967,    -1,    -1}},
+    {0x020009, {   -1,    -1,  8391,    -1,    -1}},
+    {0x020010, {   -1,    44,  1651,    -1,    -1}},
+    {0x020012, {   -1,    -1,  2064,    -1,    -1}},
+    {0x020014, {   -1,    -1,  2268,    -1,    -1}},
+    {0x020020, {   -1,    81,  2612,    -1,    -1}},
+    {0x020022, {   -1,    -1,  2847,    -1,    -1}},
+    {0x020030, {   -1,    92,  3195,    -1,    -1}},
+    {0x020032, {   -1,    -1,  3329,    -1,    -1}},
+    {0x020034, {   -1,    -1,  3391,    -1,    -1}},
+    {0x020080, { 1266,    -1,    -1,    -1,    -1}},
+    {0x0200F2, {   -1,    -1,    -1,     4,    -1}},
+    {0x020100, {    4,    -1,     4,    -1,    -1}},
+    {0x020101, {   -1,    -1,  4010,    -1,    -1}},
+    {0x020109, {   -1,    -1,  8513,    -1,    -1}},
+    {0x020110, {   -1,    -1,  1759,    -1,    -1}},
+    {0x020120, {   -1,    -1,  2679,    -1,    -1}},
+    {0x020130, {   -1,    -1,  3238,    -1,    -1}},
+    {0x0201F2, {   -1,    -1,    -1,   132,    -1}},
+    {0x0201FC, {   -1,    -1,  3818,    -1,    -1}},
+    {0x0201FE, {   -1,    -1,  3882,    -1,    -1}},
+    {0x020200, {   -1,    -1,   132,    -1,    -1}},
+    {0x020210, {   -1,    -1,  1796,    -1,    -1}},
+    {0x020220, {   -1,    -1,  2691,    -1,    -1}},
+    {0x020230, {   -1,    -1,  3240,    -1,    -1}},
+    {0x020232, {   -1,    -1,  3351,    -1,    -1}},
+    {0x020234, {   -1,    -1,  3409,    -1,    -1}},
+    {0x0202F2, {   -1,    -1,    -1,   193,    -1}},
+    {0x020300, {   -1,    -1,   260,    -1,    -1}},
+    {0x020310, {   -1,    -1,  1859,    -1,    -1}},
+    {0x020312, {   -1,    -1,  2151,    -1,    -1}},
+    {0x020314, {   -1,    -1,  2317,    -1,    -1}},
+    {0x020320, {   -1,    -1,  2721,    -1,    -1}},
+    {0x020322, {   -1,    -1,  2894,    -1,    -1}},
+    {0x020330, {   -1,    -1,  3254,    -1,    -1}},
+    {0x020332, {   -1,    -1,  3355,    -1,    -1}},
+    {0x020334, {   -1,    -1,  3410,    -1,    -1}},
+    {0x0203F2, {   -1,    -1,    -1,   223,    -1}},
+    {0x020400, {   -1,    -1,   388,    -1,    -1}},
+    {0x020410, {   -1,    -1,  1958,    -1,    -1}},
+    {0x020412, {   -1,    -1,  2203,    -1,    -1}},
+    {0x020414, {   -1,    -1,  2338,    -1,    -1}},
+    {0x020420, {   -1,    -1,  2781,    -1,    -1}},
+    {0x020422, {   -1,    -1,  2922,    -1,    -1}},
+    {0x020430, {   -1,    -1,  3285,    -1,    -1}},
+    {0x020432, {   -1,    -1,  3368,    -1,    -1}},
+    {0x020434, {   -1,    -1,  3416,    -1,    -1}},
+    {0x020860, { 1167,    -1,    -1,    -1,    -1}},
+    {0x020901, {   -1,    -1,  4248,    -1,    -1}},
+    {0x020907, {   -1,    -1,  7165,    -1,    -1}},
+    {0x020909, {   -1,    -1,  8751,    -1,    -1}},
+    {0x021060, { 1189,    -1,    -1,    -1,    -1}},
+    {0x021200, {   52,    -1,    -1,    -1,    -1}},
+    {0x021462, { 1261,    -1,    -1,    -1,    -1}},
+    {0x021801, {   -1,    -1,  4596,    -1,    -1}},
+    {0x021809, {   -1,    -1,  9099,    -1,    -1}},
+    {0x021860, { 1203,    -1,    -1,    -1,    -1}},
+    {0x022000, {  108,    -1,    -1,    -1,    -1}},
+    {0x022001, {   -1,    -1,  4909,    -1,    -1}},
+    {0x022007, {   -1,    -1,  7669,    -1,    -1}},
+    {0x022009, {   -1,    -1,  9412,    -1,    -1}},
+    {0x022800, {  175,    -1,    -1,    -1,    -1}},
+    {0x022801, {   -1,    -1,  5079,    -1,    -1}},
+    {0x022809, {   -1,    -1,  9582,    -1,    -1}},
+    {0x022D00, {  258,    -1,    -1,    -1,    -1}},
+    {0x023001, {   -1,    -1,  5275,    -1,    -1}},
+    {0x023007, {   -1,    -1,  7811,    -1,    -1}},
+    {0x023009, {   -1,    -1,  9778,    -1,    -1}},
+    {0x024000, {  278,    -1,    -1,    -1,    -1}},
+    {0x024100, {  374,    -1,    -1,    -1,    -1}},
+    {0x024200, {  454,    -1,    -1,    -1,    -1}},
+    {0x024300, {  523,    -1,    -1,    -1,    -1}},
+    {0x024400, {  579,    -1,    -1,    -1,    -1}},
+    {0x024500, {  615,    -1,    -1,    -1,    -1}},
+    {0x024600, {  645,    -1,    -1,    -1,    -1}},
+    {0x024700, {  674,    -1,    -1,    -1,    -1}},
+    {0x024800, {  698,    -1,    -1,    -1,    -1}},
+    {0x024860, { 1219,    -1,    -1,    -1,    -1}},
+    {0x024900, {  718,    -1,    -1,    -1,    -1}},
+    {0x024A00, {  736,    -1,    -1,    -1,    -1}},
+    {0x024B00, {  752,    -1,    -1,    -1,    -1}},
+    {0x024C00, {  766,    -1,    -1,    -1,    -1}},
+    {0x024D00, {  778,    -1,    -1,    -1,    -1}},
+    {0x024E00, {  788,    -1,    -1,    -1,    -1}},
+    {0x024F00, {  797,    -1,    -1,    -1,    -1}},
+    {0x025000, {  803,    -1,    -1,    -1,    -1}},
+    {0x025100, {  808,    -1,    -1,    -1,    -1}},
+    {0x025860, { 1239,    -1,    -1,    -1,    -1}},
+    {0x026060, { 1248,    -1,    -1,    -1,    -1}},
+    {0x026860, { 1253,    -1,    -1,    -1,    -1}},
+    {0x027E00, {  909,    -1,    -1,    -1,    -1}},
+    {0x027F00, { 1037,    -1,    -1,    -1,    -1}},
+    {0x028000, {   -1,    -1,    -1,    -1,     5}},
+    {0x028002, {   -1,    -1,   515,    -1,    -1}},
+    {0x028007, {   -1,    -1,  6968,    -1,    -1}},
+    {0x028009, {   -1,    -1,  8392,    -1,    -1}},
+    {0x028010, {   -1,    45,  1652,    -1,    -1}},
+    {0x028012, {   -1,    -1,  2065,    -1,    -1}},
+    {0x028014, {   -1,    -1,  2269,    -1,    -1}},
+    {0x028020, {   -1,    82,  2613,    -1,    -1}},
+    {0x028030, {   -1,    -1,  3196,    -1,    -1}},
+    {0x028040, {   -1,    -1,  3530,    -1,    -1}},
+    {0x028080, { 1267,    -1,    -1,    -1,    -1}},
+    {0x0280F2, {   -1,    -1,    -1,     5,    -1}},
+    {0x028100, {    5,    -1,     5,    -1,    -1}},
+    {0x028101, {   -1,    -1,  4011,    -1,    -1}},
+    {0x028109, {   -1,    -1,  8514,    -1,    -1}},
+    {0x028110, {   -1,    -1,  1760,    -1,    -1}},
+    {0x028120, {   -1,    -1,  2680,    -1,    -1}},
+    {0x0281F2, {   -1,    -1,    -1,   133,    -1}},
+    {0x0281FC, {   -1,    -1,  3819,    -1,    -1}},
+    {0x0281FE, {   -1,    -1,  3883,    -1,    -1}},
+    {0x028200, {   -1,    -1,   133,    -1,    -1}},
+    {0x028210, {   -1,    -1,  1797,    -1,    -1}},
+    {0x028220, {   -1,    -1,  2692,    -1,    -1}},
+    {0x028230, {   -1,    -1,  3241,    -1,    -1}},
+    {0x0282F2, {   -1,    -1,    -1,   194,    -1}},
+    {0x028300, {   -1,    -1,   261,    -1,    -1}},
+    {0x028310, {   -1,    -1,  1860,    -1,    -1}},
+    {0x028320, {   -1,    -1,  2722,    -1,    -1}},
+    {0x028330, {   -1,    -1,  3255,    -1,    -1}},
+    {0x0283F2, {   -1,    -1,    -1,   224,    -1}},
+    {0x028400, {   -1,    -1,   389,    -1,    -1}},
+    {0x028402, {   -1,    -1,   758,    -1,    -1}},
+    {0x028410, {   -1,    -1,  1959,    -1,    -1}},
+    {0x028412, {   -1,    -1,  2204,    -1,    -1}},
+    {0x028414, {   -1,    -1,  2339,    -1,    -1}},
+    {0x028420, {   -1,    -1,  2782,    -1,    -1}},
+    {0x028430, {   -1,    -1,  3286,    -1,    -1}},
+    {0x028440, {   -1,    -1,  3579,    -1,    -1}},
+    {0x0284F2, {   -1,    -1,    -1,   241,    -1}},
+    {0x028860, { 1168,    -1,    -1,    -1,    -1}},
+    {0x028901, {   -1,    -1,  4249,    -1,    -1}},
+    {0x028907, {   -1,    -1,  7166,    -1,    -1}},
+    {0x028909, {   -1,    -1,  8752,    -1,    -1}},
+    {0x028C00, {   31,    -1,    -1,    -1,    -1}},
+    {0x029060, { 1190,    -1,    -1,    -1,    -1}},
+    {0x029801, {   -1,    -1,  4597,    -1,    -1}},
+    {0x029809, {   -1,    -1,  9100,    -1,    -1}},
+    {0x029860, { 1204,    -1,    -1,    -1,    -1}},
+    {0x02A000, {  109,    -1,    -1,    -1,    -1}},
+    {0x02A001, {   -1,    -1,  4910,    -1,    -1}},
+    {0x02A007, {   -1,    -1,  7670,    -1,    -1}},
+    {0x02A009, {   -1,    -1,  9413,    -1,    -1}},
+    {0x02A100, {  132,    -1,    -1,    -1,    -1}},
+    {0x02A200, {  137,    -1,    -1,    -1,    -1}},
+    {0x02A800, {  176,    -1,    -1,    -1,    -1}},
+    {0x02A801, {   -1,    -1,  5080,    -1,    -1}},
+    {0x02A809, {   -1,    -1,  9583,    -1,    -1}},
+    {0x02A900, {  222,    -1,    -1,    -1,    -1}},
+    {0x02AA00, {  240,    -1,    -1,    -1,    -1}},
+    {0x02AD00, {  259,    -1,    -1,    -1,    -1}},
+    {0x02B000, {  270,    -1,    -1,    -1,    -1}},
+    {0x02B001, {   -1,    -1,  5276,    -1,    -1}},
+    {0x02B007, {   -1,    -1,  7812,    -1,    -1}},
+    {0x02B009, {   -1,    -1,  9779,    -1,    -1}},
+    {0x02B400, {  271,    -1,    -1,    -1,    -1}},
+    {0x02C000, {  279,    -1,    -1,    -1,    -1}},
+    {0x02C100, {  375,    -1,    -1,    -1,    -1}},
+    {0x02C200, {  455,    -1,    -1,    -1,    -1}},
+    {0x02C300, {  524,    -1,    -1,    -1,    -1}},
+    {0x02C400, {  580,    -1,    -1,    -1,    -1}},
+    {0x02C500, {  616,    -1,    -1,    -1,    -1}},
+    {0x02C600, {  646,    -1,    -1,    -1,    -1}},
+    {0x02C700, {  675,    -1,    -1,    -1,    -1}},
+    {0x02C800, {  699,    -1,    -1,    -1,    -1}},
+    {0x02C860, { 1220,    -1,    -1,    -1,    -1}},
+    {0x02C900, {  719,    -1,    -1,    -1,    -1}},
+    {0x02CA00, {  737,    -1,    -1,    -1,    -1}},
+    {0x02CB00, {  753,    -1,    -1,    -1,    -1}},
+    {0x02CC00, {  767,    -1,    -1,    -1,    -1}},
+    {0x02CD00, {  779,    -1,    -1,    -1,    -1}},
+    {0x02CE00, {  789,    -1,    -1,    -1,    -1}},
+    {0x02CF00, {  798,    -1,    -1,    -1,    -1}},
+    {0x02D000, {  804,    -1,    -1,    -1,    -1}},
+    {0x02D100, {  809,    -1,    -1,    -1,    -1}},
+    {0x02D200, {  812,    -1,    -1,    -1,    -1}},
+    {0x02D300, {  815,    -1,    -1,    -1,    -1}},
+    {0x02D400, {  818,    -1,    -1,    -1,    -1}},
+    {0x02D500, {  821,    -1,    -1,    -1,    -1}},
+    {0x02D860, { 1240,    -1,    -1,    -1,    -1}},
+    {0x02E860, { 1254,    -1,    -1,    -1,    -1}},
+    {0x02FE00, {  910,    -1,    -1,    -1,    -1}},
+    {0x02FF00, { 1038,    -1,    -1,    -1,    -1}},
+    {0x030000, {   -1,    -1,    -1,    -1,     6}},
+    {0x030002, {   -1,    -1,   516,    -1,    -1}},
+    {0x030004, {   -1,    -1,   851,    -1,    -1}},
+    {0x030007, {   -1,    -1,  6969,    -1,    -1}},
+    {0x030009, {   -1,    -1,  8393,    -1,    -1}},
+    {0x030010, {   -1,    46,  1653,    -1,    -1}},
+    {0x030020, {   -1,    83,  2614,    -1,    -1}},
+    {0x030030, {   -1,    93,  3197,    -1,    -1}},
+    {0x030040, {   -1,    -1,  3531,    -1,    -1}},
+    {0x0300F2, {   -1,    -1,    -1,     6,    -1}},
+    {0x030100, {    6,    -1,     6,    -1,    -1}},
+    {0x030101, {   -1,    -1,  4012,    -1,    -1}},
+    {0x030109, {   -1,    -1,  8515,    -1,    -1}},
+    {0x030110, {   -1,    -1,  1761,    -1,    -1}},
+    {0x030120, {   -1,    -1,  2681,    -1,    -1}},
+    {0x030130, {   -1,    -1,  3239,    -1,    -1}},
+    {0x0301F2, {   -1,    -1,    -1,   134,    -1}},
+    {0x0301FC, {   -1,    -1,  3820,    -1,    -1}},
+    {0x0301FE, {   -1,    -1,  3884,    -1,    -1}},
+    {0x030200, {   -1,    -1,   134,    -1,    -1}},
+    {0x030210, {   -1,    -1,  1798,    -1,    -1}},
+    {0x030220, {   -1,    -1,  2693,    -1,    -1}},
+    {0x030230, {   -1,    -1,  3242,    -1,    -1}},
+    {0x0302F2, {   -1,    -1,    -1,   195,    -1}},
+    {0x030300, {   -1,    -1,   262,    -1,    -1}},
+    {0x030302, {   -1,    -1,   676,    -1,    -1}},
+    {0x030310, {   -1,    -1,  1861,    -1,    -1}},
+    {0x030320, {   -1,    -1,  2723,    -1,    -1}},
+    {0x030330, {   -1,    -1,  3256,    -1,    -1}},
+    {0x030340, {   -1,    -1,  3565,    -1,    -1}},
+    {0x0303F2, {   -1,    -1,    -1,   225,    -1}},
+    {0x030400, {   -1,    -1,   390,    -1,    -1}},
+    {0x030402, {   -1,    -1,   759,    -1,    -1}},
+    {0x030404, {   -1,    -1,  1003,    -1,    -1}},
+    {0x030410, {   -1,    -1,  1960,    -1,    -1}},
+    {0x030420, {   -1,    -1,  2783,    -1,    -1}},
+    {0x030430, {   -1,    -1,  3287,    -1,    -1}},
+    {0x030440, {   -1,    -1,  3580,    -1,    -1}},
+    {0x030860, { 1169,    -1,    -1,    -1,    -1}},
+    {0x030901, {   -1,    -1,  4250,    -1,    -1}},
+    {0x030907, {   -1,    -1,  7167,    -1,    -1}},
+    {0x030909, {   -1,    -1,  8753,    -1,    -1}},
+    {0x031060, { 1191,    -1,    -1,    -1,    -1}},
+    {0x031801, {   -1,    -1,  4598,    -1,    -1}},
+    {0x031809, {   -1,    -1,  9101,    -1,    -1}},
+    {0x031860, { 1205,    -1,    -1,    -1,    -1}},
+    {0x031900, {   88,    -1,    -1,    -1,    -1}},
+    {0x032000, {  110,    -1,    -1,    -1,    -1}},
+    {0x032001, {   -1,    -1,  4911,    -1,    -1}},
+    {0x032007, {   -1,    -1,  7671,    -1,    -1}},
+    {0x032009, {   -1,    -1,  9414,    -1,    -1}},
+    {0x032300, {  141,    -1,    -1,    -1,    -1}},
+    {0x032800, {  177,    -1,    -1,    -1,    -1}},
+    {0x032801, {   -1,    -1,  5081,    -1,    -1}},
+    {0x032809, {   -1,    -1,  9584,    -1,    -1}},
+    {0x033001, {   -1,    -1,  5277,    -1,    -1}},
+    {0x033007, {   -1,    -1,  7813,    -1,    -1}},
+    {0x033009, {   -1,    -1,  9780,    -1,    -1}},
+    {0x034000, {  280,    -1,    -1,    -1,    -1}},
+    {0x034860, { 1221,    -1,    -1,    -1,    -1}},
+    {0x035860, { 1241,    -1,    -1,    -1,    -1}},
+    {0x036860, { 1255,    -1,    -1,    -1,    -1}},
+    {0x037E00, {  911,    -1,    -1,    -1,    -1}},
+    {0x037F00, { 1039,    -1,    -1,    -1,    -1}},
+    {0x038000, {   -1,    -1,    -1,    -1,     7}},
+    {0x038002, {   -1,    -1,   517,    -1,    -1}},
+    {0x038004, {   -1,    -1,   852,    -1,    -1}},
+    {0x038006, {   -1,    -1,  1069,    -1,    -1}},
+    {0x038007, {   -1,    -1,  6970,    -1,    -1}},
+    {0x038009, {   -1,    -1,  8394,    -1,    -1}},
+    {0x038010, {   -1,    -1,  1654,    -1,    -1}},
+    {0x038020, {   -1,    -1,  2615,    -1,    -1}},
+    {0x038022, {   -1,    -1,  2848,    -1,    -1}},
+    {0x038030, {   -1,    -1,  3198,    -1,    -1}},
+    {0x038040, {   -1,    -1,  3532,    -1,    -1}},
+    {0x038042, {   -1,    -1,  3604,    -1,    -1}},
+    {0x038046, {   -1,    -1,  3657,    -1,    -1}},
+    {0x038048, {   -1,    -1,  3677,    -1,    -1}},
+    {0x03804A, {   -1,    -1,  3691,    -1,    -1}},
+    {0x03804C, {   -1,    -1,  3701,    -1,    -1}},
+    {0x03804E, {   -1,    -1,  3709,    -1,    -1}},
+    {0x0380F2, {   -1,    -1,    -1,     7,    -1}},
+    {0x038100, {    7,    -1,     7,    -1,    -1}},
+    {0x038101, {   -1,    -1,  4013,    -1,    -1}},
+    {0x038109, {   -1,    -1,  8516,    -1,    -1}},
+    {0x0381F2, {   -1,    -1,    -1,   135,    -1}},
+    {0x0381FC, {   -1,    -1,  3821,    -1,    -1}},
+    {0x0381FE, {   -1,    -1,  3885,    -1,    -1}},
+    {0x038200, {   -1,    -1,   135,    -1,    -1}},
+    {0x038300, {   -1,    -1,   263,    -1,    -1}},
+    {0x038310, {   -1,    -1,  1862,    -1,    -1}},
+    {0x038320, {   -1,    -1,  2724,    -1,    -1}},
+    {0x038330, {   -1,    -1,  3257,    -1,    -1}},
+    {0x038340, {   -1,    -1,  3566,    -1,    -1}},
+    {0x038342, {   -1,    -1,  3619,    -1,    -1}},
+    {0x038346, {   -1,    -1,  3666,    -1,    -1}},
+    {0x038400, {   -1,    -1,   391,    -1,    -1}},
+    {0x038402, {   -1,    -1,   760,    -1,    -1}},
+    {0x038404, {   -1,    -1,  1004,    -1,    -1}},
+    {0x038406, {   -1,    -1,  1183,    -1,    -1}},
+    {0x038410, {   -1,    -1,  1961,    -1,    -1}},
+    {0x038420, {   -1,    -1,  2784,    -1,    -1}},
+    {0x038422, {   -1,    -1,  2923,    -1,    -1}},
+    {0x038430, {   -1,    -1,  3288,    -1,    -1}},
+    {0x038440, {   -1,    -1,  3581,    -1,    -1}},
+    {0x038442, {   -1,    -1,  3626,    -1,    -1}},
+    {0x038446, {   -1,    -1,  3668,    -1,    -1}},
+    {0x038448, {   -1,    -1,  3684,    -1,    -1}},
+    {0x03844A, {   -1,    -1,  3696,    -1,    -1}},
+    {0x03844C, {   -1,    -1,  3705,    -1,    -1}},
+    {0x03844E, {   -1,    -1,  3712,    -1,    -1}},
+    {0x038860, { 1170,    -1,    -1,    -1,    -1}},
+    {0x038901, {   -1,    -1,  4251,    -1,    -1}},
+    {0x038907, {   -1,    -1,  7168,    -1,    -1}},
+    {0x038909, {   -1,    -1,  8754,    -1,    -1}},
+    {0x039060, { 1192,    -1,    -1,    -1,    -1}},
+    {0x039801, {   -1,    -1,  4599,    -1,    -1}},
+    {0x039809, {   -1,    -1,  9102,    -1,    -1}},
+    {0x039860, { 1206,    -1,    -1,    -1,    -1}},
+    {0x039B00, {   92,    -1,    -1,    -1,    -1}},
+    {0x03A001, {   -1,    -1,  4912,    -1,    -1}},
+    {0x03A007, {   -1,    -1,  7672,    -1,    -1}},
+    {0x03A009, {   -1,    -1,  9415,    -1,    -1}},
+    {0x03A800, {  178,    -1,    -1,    -1,    -1}},
+    {0x03A801, {   -1,    -1,  5082,    -1,    -1}},
+    {0x03A809, {   -1,    -1,  9585,    -1,    -1}},
+    {0x03B001, {   -1,    -1,  5278,    -1,    -1}},
+    {0x03B007, {   -1,    -1,  7814,    -1,    -1}},
+    {0x03B009, {   -1,    -1,  9781,    -1,    -1}},
+    {0x03C000, {  281,    -1,    -1,    -1,    -1}},
+    {0x03C100, {  376,    -1,    -1,    -1,    -1}},
+    {0x03C200, {  456,    -1,    -1,    -1,    -1}},
+    {0x03C300, {  525,    -1,    -1,    -1,    -1}},
+    {0x03C400, {  581,    -1,    -1,    -1,    -1}},
+    {0x03C500, {  617,    -1,    -1,    -1,    -1}},
+    {0x03C600, {  647,    -1,    -1,    -1,    -1}},
+    {0x03C700, {  676,    -1,    -1,    -1,    -1}},
+    {0x03C800, {  700,    -1,    -1,    -1,    -1}},
+    {0x03C860, { 1222,    -1,    -1,    -1,    -1}},
+    {0x03C900, {  720,    -1,    -1,    -1,    -1}},
+    {0x03CA00, {  738,    -1,    -1,    -1,    -1}},
+    {0x03D860, { 1242,    -1,    -1,    -1,    -1}},
+    {0x03FE00, {  912,    -1,    -1,    -1,    -1}},
+    {0x03FF00, { 1040,    -1,    -1,    -1,    -1}},
+    {0x040000, {   -1,    -1,    -1,    -1,     8}},
+    {0x040002, {   -1,    -1,   518,    -1,    -1}},
+    {0x040007, {   -1,    -1,  6971,    -1,    -1}},
+    {0x040009, {   -1,    -1,  8395,    -1,    -1}},
+    {0x0400F2, {   -1,    -1,    -1,     8,    -1}},
+    {0x040100, {   -1,    -1,     8,    -1,    -1}},
+    {0x040101, {   -1,    -1,  4014,    -1,    -1}},
+    {0x040109, {   -1,    -1,  8517,    -1,    -1}},
+    {0x0401FC, {   -1,    -1,  3822,    -1,    -1}},
+    {0x0401FE, {   -1,    -1,  3886,    -1,    -1}},
+    {0x040200, {   -1,    -1,   136,    -1,    -1}},
+    {0x040300, {   -1,    -1,   264,    -1,    -1}},
+    {0x040302, {   -1,    -1,   677,    -1,    -1}},
+    {0x040400, {   -1,    -1,   392,    -1,    -1}},
+    {0x040402, {   -1,    -1,   761,    -1,    -1}},
+    {0x040860, { 1171,    -1,    -1,    -1,    -1}},
+    {0x040901, {   -1,    -1,  4252,    -1,    -1}},
+    {0x040907, {   -1,    -1,  7169,    -1,    -1}},
+    {0x040909, {   -1,    -1,  8755,    -1,    -1}},
+    {0x041060, { 1193,    -1,    -1,    -1,    -1}},
+    {0x041801, {   -1,    -1,  4600,    -1,    -1}},
+    {0x041809, {   -1,    -1,  9103,    -1,    -1}},
+    {0x041860, { 1207,    -1,    -1,    -1,    -1}},
+    {0x042001, {   -1,    -1,  4913,    -1,    -1}},
+    {0x042007, {   -1,    -1,  7673,    -1,    -1}},
+    {0x042009, {   -1,    -1,  9416,    -1,    -1}},
+    {0x042801, {   -1,    -1,  5083,    -1,    -1}},
+    {0x042809, {   -1,    -1,  9586,    -1,    -1}},
+    {0x043001, {   -1,    -1,  5279,    -1,    -1}},
+    {0x043007, {   -1,    -1,  7815,    -1,    -1}},
+    {0x043009, {   -1,    -1,  9782,    -1,    -1}},
+    {0x044000, {  282,    -1,    -1,    -1,    -1}},
+    {0x044860, { 1223,    -1,    -1,    -1,    -1}},
+    {0x045860, { 1243,    -1,    -1,    -1,    -1}},
+    {0x047E00, {  913,    -1,    -1,    -1,    -1}},
+    {0x047F00, { 1041,    -1,    -1,    -1,    -1}},
+    {0x048000, {   -1,    -1,    -1,    -1,     9}},
+    {0x048007, {   -1,    -1,  6972,    -1,    -1}},
+    {0x048009, {   -1,    -1,  8396,    -1,    -1}},
+    {0x0480F2, {   -1,    -1,    -1,     9,    -1}},
+    {0x048100, {   -1,    -1,     9,    -1,    -1}},
+    {0x048101, {   -1,    -1,  4015,    -1,    -1}},
+    {0x048109, {   -1,    -1,  8518,    -1,    -1}},
+    {0x0481FC, {   -1,    -1,  3823,    -1,    -1}},
+    {0x0481FE, {   -1,    -1,  3887,    -1,    -1}},
+    {0x048200, {   -1,    -1,   137,    -1,    -1}},
+    {0x048300, {   -1,    -1,   265,    -1,    -1}},
+    {0x048400, {   -1,    -1,   393,    -1,    -1}},
+    {0x048860, { 1172,    -1,    -1,    -1,    -1}},
+    {0x048901, {   -1,    -1,  4253,    -1,    -1}},
+    {0x048907, {   -1,    -1,  7170,    -1,    -1}},
+    {0x048909, {   -1,    -1,  8756,    -1,    -1}},
+    {0x049060, { 1194,    -1,    -1,    -1,    -1}},
+    {0x049801, {   -1,    -1,  4601,    -1,    -1}},
+    {0x049809, {   -1,    -1,  9104,    -1,    -1}},
+    {0x049860, { 1208,    -1,    -1,    -1,    -1}},
+    {0x04A001, {   -1,    -1,  4914,    -1,    -1}},
+    {0x04A007, {   -1,    -1,  7674,    -1,    -1}},
+    {0x04A009, {   -1,    -1,  9417,    -1,    -1}},
+    {0x04A801, {   -1,    -1,  5084,    -1,    -1}},
+    {0x04A809, {   -1,    -1,  9587,    -1,    -1}},
+    {0x04B001, {   -1,    -1,  5280,    -1,    -1}},
+    {0x04B007, {   -1,    -1,  7816,    -1,    -1}},
+    {0x04B009, {   -1,    -1,  9783,    -1,    -1}},
+    {0x04C860, { 1224,    -1,    -1,    -1,    -1}},
+    {0x04FE00, {  914,    -1,    -1,    -1,    -1}},
+    {0x04FF00, { 1042,    -1,    -1,    -1,    -1}},
+    {0x050000, {   -1,    -1,    -1,    -1,    10}},
+    {0x050002, {   -1,    -1,   519,    -1,    -1}},
+    {0x050007, {   -1,    -1,  6973,    -1,    -1}},
+    {0x050009, {   -1,    -1,  8397,    -1,    -1}},
+    {0x050010, {   -1,    -1,  1655,    -1,    -1}},
+    {0x0500F2, {   -1,    -1,    -1,    10,    -1}},
+    {0x050100, {   -1,    -1,    10,    -1,    -1}},
+    {0x050101, {   -1,    -1,  4016,    -1,    -1}},
+    {0x050109, {   -1,    -1,  8519,    -1,    -1}},
+    {0x0501FC, {   -1,    -1,  3824,    -1,    -1}},
+    {0x0501FE, {   -1,    -1,  3888,    -1,    -1}},
+    {0x050200, {   -1,    -1,   138,    -1,    -1}},
+    {0x050300, {   -1,    -1,   266,    -1,    -1}},
+    {0x050400, {   -1,    -1,   394,    -1,    -1}},
+    {0x050402, {   -1,    -1,   762,    -1,    -1}},
+    {0x050410, {   -1,    -1,  1962,    -1,    -1}},
+    {0x050860, { 1173,    -1,    -1,    -1,    -1}},
+    {0x050901, {   -1,    -1,  4254,    -1,    -1}},
+    {0x050907, {   -1,    -1,  7171,    -1,    -1}},
+    {0x050909, {   -1,    -1,  8757,    -1,    -1}},
+    {0x051060, { 1195,    -1,    -1,    -1,    -1}},
+    {0x051801, {   -1,    -1,  4602,    -1,    -1}},
+    {0x051809, {   -1,    -1,  9105,    -1,    -1}},
+    {0x052001, {   -1,    -1,  4915,    -1,    -1}},
+    {0x052007, {   -1,    -1,  7675,    -1,    -1}},
+    {0x052009, {   -1,    -1,  9418,    -1,    -1}},
+    {0x052801, {   -1,    -1,  5085,    -1,    -1}},
+    {0x052809, {   -1,    -1,  9588,    -1,    -1}},
+    {0x053001, {   -1,    -1,  5281,    -1,    -1}},
+    {0x053007, {   -1,    -1,  7817,    -1,    -1}},
+    {0x053009, {   -1,    -1,  9784,    -1,    -1}},
+    {0x054000, {  283,    -1,    -1,    -1,    -1}},
+    {0x054100, {  377,    -1,    -1,    -1,    -1}},
+    {0x054860, { 1225,    -1,    -1,    -1,    -1}},
+    {0x057E00, {  915,    -1,    -1,    -1,    -1}},
+    {0x057F00, { 1043,    -1,    -1,    -1,    -1}},
+    {0x058000, {   -1,    -1,    -1,    -1,    11}},
+    {0x058002, {   -1,    -1,   520,    -1,    -1}},
+    {0x058007, {   -1,    -1,  6974,    -1,    -1}},
+    {0x058009, {   -1,    -1,  8398,    -1,    -1}},
+    {0x058010, {   -1,    47,  1656,    -1,    -1}},
+    {0x058012, {   -1,    -1,  2066,    -1,    -1}},
+    {0x0580F2, {   -1,    -1,    -1,    11,    -1}},
+    {0x058100, {    8,    -1,    11,    -1,    -1}},
+    {0x058101, {   -1,    -1,  4017,    -1,    -1}},
+    {0x058109, {   -1,    -1,  8520,    -1,    -1}},
+    {0x058110, {   -1,    -1,  1762,    -1,    -1}},
+    {0x0581F2, {   -1,    -1,    -1,   136,    -1}},
+    {0x0581FC, {   -1,    -1,  3825,    -1,    -1}},
+    {0x0581FE, {   -1,    -1,  3889,    -1,    -1}},
+    {0x058200, {   -1,    -1,   139,    -1,    -1}},
+    {0x058202, {   -1,    -1,   622,    -1,    -1}},
+    {0x058210, {   -1,    -1,  1799,    -1,    -1}},
+    {0x058300, {   -1,    -1,   267,    -1,    -1}},
+    {0x058302, {   -1,    -1,   678,    -1,    -1}},
+    {0x058310, {   -1,    -1,  1863,    -1,    -1}},
+    {0x058312, {   -1,    -1,  2152,    -1,    -1}},
+    {0x058400, {   -1,    -1,   395,    -1,    -1}},
+    {0x058402, {   -1,    -1,   763,    -1,    -1}},
+    {0x058410, {   -1,    -1,  1963,    -1,    -1}},
+    {0x058412, {   -1,    -1,  2205,    -1,    -1}},
+    {0x058860, { 1174,    -1,    -1,    -1,    -1}},
+    {0x058901, {   -1,    -1,  4255,    -1,    -1}},
+    {0x058907, {   -1,    -1,  7172,    -1,    -1}},
+    {0x058909, {   -1,    -1,  8758,    -1,    -1}},
+    {0x059060, { 1196,    -1,    -1,    -1,    -1}},
+    {0x059801, {   -1,    -1,  4603,    -1,    -1}},
+    {0x059809, {   -1,    -1,  9106,    -1,    -1}},
+    {0x05A001, {   -1,    -1,  4916,    -1,    -1}},
+    {0x05A007, {   -1,    -1,  7676,    -1,    -1}},
+    {0x05A009, {   -1,    -1,  9419,    -1,    -1}},
+    {0x05A801, {   -1,    -1,  5086,    -1,    -1}},
+    {0x05A809, {   -1,    -1,  9589,    -1,    -1}},
+    {0x05AD00, {  260,    -1,    -1,    -1,    -1}},
+    {0x05B001, {   -1,    -1,  5282,    -1,    -1}},
+    {0x05B007, {   -1,    -1,  7818,    -1,    -1}},
+    {0x05B009, {   -1,    -1,  9785,    -1,    -1}},
+    {0x05C860, { 1226,    -1,    -1,    -1,    -1}},
+    {0x05FE00, {  916,    -1,    -1,    -1,    -1}},
+    {0x05FF00, { 1044,    -1,    -1,    -1,    -1}},
+    {0x060000, {   -1,    -1,    -1,    -1,    12}},
+    {0x060007, {   -1,    -1,  6975,    -1,    -1}},
+    {0x060009, {   -1,    -1,  8399,    -1,    -1}},
+    {0x060010, {   -1,    48,  1657,    -1,    -1}},
+    {0x060020, {   -1,    -1,  2616,    -1,    -1}},
+    {0x060022, {   -1,    -1,  2849,    -1,    -1}},
+    {0x060030, {   -1,    -1,  3199,    -1,    -1}},
+    {0x0600F2, {   -1,    -1,    -1,    12,    -1}},
+    {0x060100, {    9,    -1,    12,    -1,    -1}},
+    {0x060101, {   -1,    -1,  4018,    -1,    -1}},
+    {0x060109, {   -1,    -1,  8521,    -1,    -1}},
+    {0x060110, {   -1,    -1,  1763,    -1,    -1}},
+    {0x0601F2, {   -1,    -1,    -1,   137,    -1}},
+    {0x0601FC, {   -1,    -1,  3826,    -1,    -1}},
+    {0x0601FE, {   -1,    -1,  3890,    -1,    -1}},
+    {0x060200, {   -1,    -1,   140,    -1,    -1}},
+    {0x060210, {   -1,    -1,  1800,    -1,    -1}},
+    {0x060220, {   -1,    -1,  2694,    -1,    -1}},
+    {0x060222, {   -1,    -1,  2887,    -1,    -1}},
+    {0x060230, {   -1,    -1,  3243,    -1,    -1}},
+    {0x060300, {   -1,    -1,   268,    -1,    -1}},
+    {0x060310, {   -1,    -1,  1864,    -1,    -1}},
+    {0x060320, {   -1,    -1,  2725,    -1,    -1}},
+    {0x060322, {   -1,    -1,  2895,    -1,    -1}},
+    {0x060330, {   -1,    -1,  3258,    -1,    -1}},
+    {0x060400, {   -1,    -1,   396,    -1,    -1}},
+    {0x060410, {   -1,    -1,  1964,    -1,    -1}},
+    {0x060420, {   -1,    -1,  2785,    -1,    -1}},
+    {0x060422, {   -1,    -1,  2924,    -1,    -1}},
+    {0x060430, {   -1,    -1,  3289,    -1,    -1}},
+    {0x060860, { 1175,    -1,    -1,    -1,    -1}},
+    {0x060901, {   -1,    -1,  4256,    -1,    -1}},
+    {0x060907, {   -1,    -1,  7173,    -1,    -1}},
+    {0x060909, {   -1,    -1,  8759,    -1,    -1}},
+    {0x061060, { 1197,    -1,    -1,    -1,    -1}},
+    {0x061801, {   -1,    -1,  4604,    -1,    -1}},
+    {0x061809, {   -1,    -1,  9107,    -1,    -1}},
+    {0x062001, {   -1,    -1,  4917,    -1,    -1}},
+    {0x062007, {   -1,    -1,  7677,    -1,    -1}},
+    {0x062009, {   -1,    -1,  9420,    -1,    -1}},
+    {0x062801, {   -1,    -1,  5087,    -1,    -1}},
+    {0x062809, {   -1,    -1,  9590,    -1,    -1}},
+    {0x063001, {   -1,    -1,  5283,    -1,    -1}},
+    {0x063007, {   -1,    -1,  7819,    -1,    -1}},
+    {0x063009, {   -1,    -1,  9786,    -1,    -1}},
+    {0x064000, {  284,    -1,    -1,    -1,    -1}},
+    {0x064860, { 1227,    -1,    -1,    -1,    -1}},
+    {0x066000, {  839,    -1,    -1,    -1,    -1}},
+    {0x066100, {  872,    -1,    -1,    -1,    -1}},
+    {0x066200, {  889,    -1,    -1,    -1,    -1}},
+    {0x067E00, {  917,    -1,    -1,    -1,    -1}},
+    {0x067F00, { 1045,    -1,    -1,    -1,    -1}},
+    {0x068000, {   -1,    -1,    -1,    -1,    13}},
+    {0x068007, {   -1,    -1,  6976,    -1,    -1}},
+    {0x068009, {   -1,    -1,  8400,    -1,    -1}},
+    {0x068010, {   -1,    -1,  1658,    -1,    -1}},
+    {0x0680F2, {   -1,    -1,    -1,    13,    -1}},
+    {0x068100, {   -1,    -1,    13,    -1,    -1}},
+    {0x068101, {   -1,    -1,  4019,    -1,    -1}},
+    {0x068109, {   -1,    -1,  8522,    -1,    -1}},
+    {0x0681FC, {   -1,    -1,  3827,    -1,    -1}},
+    {0x0681FE, {   -1,    -1,  3891,    -1,    -1}},
+    {0x068200, {   -1,    -1,   141,    -1,    -1}},
+    {0x068201, { 1567,    -1,    -1,    -1,    -1}},
+    {0x068300, {   -1,    -1,   269,    -1,    -1}},
+    {0x068301, { 1607,    -1,    -1,    -1,    -1}},
+    {0x068400, {   -1,    -1,   397,    -1,    -1}},
+    {0x068401, { 1679,    -1,    -1,    -1,    -1}},
+    {0x068410, {   -1,    -1,  1965,    -1,    -1}},
+    {0x068501, { 1728,    -1,    -1,    -1,    -1}},
+    {0x068601, { 1776,    -1,    -1,    -1,    -1}},
+    {0x068701, { 1822,    -1,    -1,    -1,    -1}},
+    {0x068860, { 1176,    -1,    -1,    -1,    -1}},
+    {0x068901, { 1878,    -1,  4257,    -1,    -1}},
+    {0x068907, {   -1,    -1,  7174,    -1,    -1}},
+    {0x068909, {   -1,    -1,  8760,    -1,    -1}},
+    {0x069060, { 1198,    -1,    -1,    -1,    -1}},
+    {0x069101, { 1928,    -1,    -1,    -1,    -1}},
+    {0x069801, {   -1,    -1,  4605,    -1,    -1}},
+    {0x069809, {   -1,    -1,  9108,    -1,    -1}},
+    {0x069A01, { 2011,    -1,    -1,    -1,    -1}},
+    {0x069C01, { 2086,    -1,    -1,    -1,    -1}},
+    {0x069D01, { 2129,    -1,    -1,    -1,    -1}},
+    {0x069E01, { 2173,    -1,    -1,    -1,    -1}},
+    {0x069F01, { 2220,    -1,    -1,    -1,    -1}},
+    {0x06A001, {   -1,    -1,  4918,    -1,    -1}},
+    {0x06A007, {   -1,    -1,  7678,    -1,    -1}},
+    {0x06A009, {   -1,    -1,  9421,    -1,    -1}},
+    {0x06A101, { 2276,    -1,    -1,    -1,    -1}},
+    {0x06A801, {   -1,    -1,  5088,    -1,    -1}},
+    {0x06A809, {   -1,    -1,  9591,    -1,    -1}},
+    {0x06B001, {   -1,    -1,  5284,    -1,    -1}},
+    {0x06B007, {   -1,    -1,  7820,    -1,    -1}},
+    {0x06B009, {   -1,    -1,  9787,    -1,    -1}},
+    {0x06C101, { 2476,    -1,    -1,    -1,    -1}},
+    {0x06C201, { 2524,    -1,    -1,    -1,    -1}},
+    {0x06C860, { 1228,    -1,    -1,    -1,    -1}},
+    {0x06FE00, {  918,    -1,    -1,    -1,    -1}},
+    {0x06FF00, { 1046,    -1,    -1,    -1,    -1}},
+    {0x06FF01, { 2591,    -1,    -1,    -1,    -1}},
+    {0x070000, {   -1,    -1,    -1,    -1,    14}},
+    {0x070007, {   -1,    -1,  6977,    -1,    -1}},
+    {0x070009, {   -1,    -1,  8401,    -1,    -1}},
+    {0x070010, {   -1,    49,  1659,    -1,    -1}},
+    {0x070012, {   -1,    77,  2067,    -1,    -1}},
+    {0x070014, {   -1,    -1,  2270,    -1,    -1}},
+    {0x070020, {   -1,    -1,  2617,    -1,    -1}},
+    {0x0700F2, {   -1,    -1,    -1,    14,    -1}},
+    {0x070100, {   -1,    -1,    14,    -1,    -1}},
+    {0x070101, {   -1,    -1,  4020,    -1,    -1}},
+    {0x070109, {   -1,    -1,  8523,    -1,    -1}},
+    {0x070110, {   -1,    -1,  1764,    -1,    -1}},
+    {0x070112, {   -1,    -1,  2129,    -1,    -1}},
+    {0x0701F2, {   -1,    -1,    -1,   138,    -1}},
+    {0x0701FC, {   -1,    -1,  3828,    -1,    -1}},
+    {0x0701FE, {   -1,    -1,  3892,    -1,    -1}},
+    {0x070200, {   -1,    -1,   142,    -1,    -1}},
+    {0x070201, { 1568,    -1,    -1,    -1,    -1}},
+    {0x070210, {   -1,    -1,  1801,    -1,    -1}},
+    {0x070212, {   -1,    -1,  2132,    -1,    -1}},
+    {0x0702F2, {   -1,    -1,    -1,   196,    -1}},
+    {0x070300, {   -1,    -1,   270,    -1,    -1}},
+    {0x070301, { 1608,    -1,    -1,    -1,    -1}},
+    {0x070310, {   -1,    -1,  1865,    -1,    -1}},
+    {0x070312, {   -1,    -1,  2153,    -1,    -1}},
+    {0x070400, {   -1,    -1,   398,    -1,    -1}},
+    {0x070401, { 1680,    -1,    -1,    -1,    -1}},
+    {0x070410, {   -1,    -1,  1966,    -1,    -1}},
+    {0x070412, {   -1,    -1,  2206,    -1,    -1}},
+    {0x070414, {   -1,    -1,  2340,    -1,    -1}},
+    {0x070420, {   -1,    -1,  2786,    -1,    -1}},
+    {0x070501, { 1729,    -1,    -1,    -1,    -1}},
+    {0x070601, { 1777,    -1,    -1,    -1,    -1}},
+    {0x070701, { 1823,    -1,    -1,    -1,    -1}},
+    {0x070860, { 1177,    -1,    -1,    -1,    -1}},
+    {0x070901, { 1879,    -1,  4258,    -1,    -1}},
+    {0x070907, {   -1,    -1,  7175,    -1,    -1}},
+    {0x070909, {   -1,    -1,  8761,    -1,    -1}},
+    {0x071101, { 1929,    -1,    -1,    -1,    -1}},
+    {0x071801, {   -1,    -1,  4606,    -1,    -1}},
+    {0x071809, {   -1,    -1,  9109,    -1,    -1}},
+    {0x071A01, { 2012,    -1,    -1,    -1,    -1}},
+    {0x071C01, { 2087,    -1,    -1,    -1,    -1}},
+    {0x071D01, { 2130,    -1,    -1,    -1,    -1}},
+    {0x071E01, { 2174,    -1,    -1,    -1,    -1}},
+    {0x071F01, { 2221,    -1,    -1,    -1,    -1}},
+    {0x072001, {   -1,    -1,  4919,    -1,    -1}},
+    {0x072007, {   -1,    -1,  7679,    -1,    -1}},
+    {0x072009, {   -1,    -1,  9422,    -1,    -1}},
+    {0x072101, { 2277,    -1,    -1,    -1,    -1}},
+    {0x072801, {   -1,    -1,  5089,    -1,    -1}},
+    {0x072809, {   -1,    -1,  9592,    -1,    -1}},
+    {0x073001, {   -1,    -1,  5285,    -1,    -1}},
+    {0x073007, {   -1,    -1,  7821,    -1,    -1}},
+    {0x073009, {   -1,    -1,  9788,    -1,    -1}},
+    {0x074101, { 2477,    -1,    -1,    -1,    -1}},
+    {0x074201, { 2525,    -1,    -1,    -1,    -1}},
+    {0x074860, { 1229,    -1,    -1,    -1,    -1}},
+    {0x076000, {  840,    -1,    -1,    -1,    -1}},
+    {0x076100, {  873,    -1,    -1,    -1,    -1}},
+    {0x077E00, {  919,    -1,    -1,    -1,    -1}},
+    {0x077F00, { 1047,    -1,    -1,    -1,    -1}},
+    {0x077F01, { 2592,    -1,    -1,    -1,    -1}},
+    {0x078000, {   -1,    -1,    -1,    -1,    15}},
+    {0x078002, {   -1,    -1,   521,    -1,    -1}},
+    {0x078004, {   -1,    -1,   853,    -1,    -1}},
+    {0x078007, {   -1,    -1,  6978,    -1,    -1}},
+    {0x078009, {   -1,    -1,  8402,    -1,    -1}},
+    {0x078010, {   -1,    -1,  1660,    -1,    -1}},
+    {0x078020, {   -1,    -1,  2618,    -1,    -1}},
+    {0x078022, {   -1,    -1,  2850,    -1,    -1}},
+    {0x078030, {   -1,    -1,  3200,    -1,    -1}},
+    {0x0780F2, {   -1,    -1,    -1,    15,    -1}},
+    {0x078100, {   -1,    -1,    15,    -1,    -1}},
+    {0x078101, {   -1,    -1,  4021,    -1,    -1}},
+    {0x078109, {   -1,    -1,  8524,    -1,    -1}},
+    {0x0781FC, {   -1,    -1,  3829,    -1,    -1}},
+    {0x0781FE, {   -1,    -1,  3893,    -1,    -1}},
+    {0x078200, {   -1,    -1,   143,    -1,    -1}},
+    {0x078202, {   -1,    -1,   623,    -1,    -1}},
+    {0x078210, {   -1,    -1,  1802,    -1,    -1}},
+    {0x078300, {   -1,    -1,   271,    -1,    -1}},
+    {0x078301, { 1609,    -1,    -1,    -1,    -1}},
+    {0x078302, {   -1,    -1,   679,    -1,    -1}},
+    {0x078310, {   -1,    -1,  1866,    -1,    -1}},
+    {0x078320, {   -1,    -1,  2726,    -1,    -1}},
+    {0x078322, {   -1,    -1,  2896,    -1,    -1}},
+    {0x078330, {   -1,    -1,  3259,    -1,    -1}},
+    {0x078400, {   -1,    -1,   399,    -1,    -1}},
+    {0x078402, {   -1,    -1,   764,    -1,    -1}},
+    {0x078404, {   -1,    -1,  1005,    -1,    -1}},
+    {0x078410, {   -1,    -1,  1967,    -1,    -1}},
+    {0x078420, {   -1,    -1,  2787,    -1,    -1}},
+    {0x078422, {   -1,    -1,  2925,    -1,    -1}},
+    {0x078430, {   -1,    -1,  3290,    -1,    -1}},
+    {0x078860, { 1178,    -1,    -1,    -1,    -1}},
+    {0x078901, {   -1,    -1,  4259,    -1,    -1}},
+    {0x078907, {   -1,    -1,  7176,    -1,    -1}},
+    {0x078909, {   -1,    -1,  8762,    -1,    -1}},
+    {0x079801, {   -1,    -1,  4607,    -1,    -1}},
+    {0x079809, {   -1,    -1,  9110,    -1,    -1}},
+    {0x07A001, {   -1,    -1,  4920,    -1,    -1}},
+    {0x07A007, {   -1,    -1,  7680,    -1,    -1}},
+    {0x07A009, {   -1,    -1,  9423,    -1,    -1}},
+    {0x07A300, {  142,    -1,    -1,    -1,    -1}},
+    {0x07A801, {   -1,    -1,  5090,    -1,    -1}},
+    {0x07A809, {   -1,    -1,  9593,    -1,    -1}},
+    {0x07B001, {   -1,    -1,  5286,    -1,    -1}},
+    {0x07B007, {   -1,    -1,  7822,    -1,    -1}},
+    {0x07B009, {   -1,    -1,  9789,    -1,    -1}},
+    {0x07C860, { 1230,    -1,    -1,    -1,    -1}},
+    {0x07E000, {  841,    -1,    -1,    -1,    -1}},
+    {0x07E100, {  874,    -1,    -1,    -1,    -1}},
+    {0x07E200, {  890,    -1,    -1,    -1,    -1}},
+    {0x07FE00, {  920,    -1,    -1,    -1,    -1}},
+    {0x07FF00, { 1048,    -1,    -1,    -1,    -1}},
+    {0x07FF01, { 2593,    -1,    -1,    -1,    -1}},
+    {0x080000, {   -1,    -1,    -1,    -1,    16}},
+    {0x080002, {   -1,    -1,   522,    -1,    -1}},
+    {0x080004, {   -1,    -1,   854,    -1,    -1}},
+    {0x080006, {   -1,    -1,  1070,    -1,    -1}},
+    {0x080007, {   -1,    -1,  6979,    -1,    -1}},
+    {0x080008, {   -1,    -1,  1240,    -1,    -1}},
+    {0x080009, {   -1,    -1,  8403,    -1,    -1}},
+    {0x08000A, {   -1,    -1,  1381,    -1,    -1}},
+    {0x08000C, {   -1,    -1,  1500,    -1,    -1}},
+    {0x08000E, {   -1,    -1,  1586,    -1,    -1}},
+    {0x080010, {   -1,    50,  1661,    -1,    -1}},
+    {0x080012, {   -1,    -1,  2068,    -1,    -1}},
+    {0x080014, {   -1,    -1,  2271,    -1,    -1}},
+    {0x080016, {   -1,    -1,  2381,    -1,    -1}},
+    {0x080018, {   -1,    -1,  2460,    -1,    -1}},
+    {0x080020, {   -1,    84,  2619,    -1,    -1}},
+    {0x080022, {   -1,    -1,  2851,    -1,    -1}},
+    {0x080024, {   -1,    -1,  2962,    -1,    -1}},
+    {0x080026, {   -1,    -1,  3030,    -1,    -1}},
+    {0x080030, {   -1,    -1,  3201,    -1,    -1}},
+    {0x080032, {   -1,    -1,  3330,    -1,    -1}},
+    {0x080034, {   -1,    -1,  3392,    -1,    -1}},
+    {0x080036, {   -1,    -1,  3435,    -1,    -1}},
+    {0x080038, {   -1,    -1,  3462,    -1,    -1}},
+    {0x08003A, {   -1,    -1,  3484,    -1,    -1}},
+    {0x08003C, {   -1,    -1,  3500,    -1,    -1}},
+    {0x08003E, {   -1,    -1,  3515,    -1,    -1}},
+    {0x080040, {   -1,    94,  3533,    -1,    -1}},
+    {0x080042, {   -1,    -1,  3605,    -1,    -1}},
+    {0x080050, {   -1,    -1,  3715,    -1,    -1}},
+    {0x080060, {   -1,    -1,  3811,    -1,    -1}},
+    {0x080080, { 1268,    -1,    -1,    -1,    -1}},
+    {0x0800F2, {   -1,    -1,    -1,    16,    -1}},
+    {0x080100, {   -1,    -1,    16,    -1,    -1}},
+    {0x080101, {   -1,    -1,  4022,    -1,    -1}},
+    {0x080109, {   -1,    -1,  8525,    -1,    -1}},
+    {0x080110, {   -1,    -1,  1765,    -1,    -1}},
+    {0x080120, {   -1,    -1,  2682,    -1,    -1}},
+    {0x080140, {   -1,    -1,  3555,    -1,    -1}},
+    {0x0801F2, {   -1,    -1,    -1,   139,    -1}},
+    {0x0801FC, {   -1,    -1,  3830,    -1,    -1}},
+    {0x0801FE, {   -1,    -1,  3894,    -1,    -1}},
+    {0x080200, {   -1,    -1,   144,    -1,    -1}},
+    {0x080202, {   -1,    -1,   624,    -1,    -1}},
+    {0x080210, {   -1,    -1,  1803,    -1,    -1}},
+    {0x080212, {   -1,    -1,  2133,    -1,    -1}},
+    {0x080220, {   -1,    -1,  2695,    -1,    -1}},
+    {0x080222, {   -1,    -1,  2888,    -1,    -1}},
+    {0x080224, {   -1,    -1,  2986,    -1,    -1}},
+    {0x080230, {   -1,    -1,  3244,    -1,    -1}},
+    {0x080240, {   -1,    -1,  3559,    -1,    -1}},
+    {0x080242, {   -1,    -1,  3618,    -1,    -1}},
+    {0x080250, {   -1,    -1,  3728,    -1,    -1}},
+    {0x0802F2, {   -1,    -1,    -1,   197,    -1}},
+    {0x080300, {   11,    -1,   272,    -1,    -1}},
+    {0x080301, { 1610,    -1,    -1,    -1,    -1}},
+    {0x080302, {   -1,    -1,   680,    -1,    -1}},
+    {0x080310, {   -1,    -1,  1867,    -1,    -1}},
+    {0x080312, {   -1,    -1,  2154,    -1,    -1}},
+    {0x080320, {   -1,    -1,  2727,    -1,    -1}},
+    {0x080322, {   -1,    -1,  2897,    -1,    -1}},
+    {0x080324, {   -1,    -1,  2990,    -1,    -1}},
+    {0x080326, {   -1,    -1,  3052,    -1,    -1}},
+    {0x080330, {   -1,    -1,  3260,    -1,    -1}},
+    {0x080332, {   -1,    -1,  3356,    -1,    -1}},
+    {0x080334, {   -1,    -1,  3411,    -1,    -1}},
+    {0x080336, {   -1,    -1,  3446,    -1,    -1}},
+    {0x080338, {   -1,    -1,  3471,    -1,    -1}},
+    {0x08033A, {   -1,    -1,  3491,    -1,    -1}},
+    {0x080340, {   -1,    -1,  3567,    -1,    -1}},
+    {0x080342, {   -1,    -1,  3620,    -1,    -1}},
+    {0x080350, {   -1,    -1,  3730,    -1,    -1}},
+    {0x080360, {   -1,    -1,  3812,    -1,    -1}},
+    {0x0803F2, {   -1,    -1,    -1,   226,    -1}},
+    {0x080400, {   -1,    -1,   400,    -1,    -1}},
+    {0x080402, {   -1,    -1,   765,    -1,    -1}},
+    {0x080404, {   -1,    -1,  1006,    -1,    -1}},
+    {0x080406, {   -1,    -1,  1184,    -1,    -1}},
+    {0x080408, {   -1,    -1,  1331,    -1,    -1}},
+    {0x08040A, {   -1,    -1,  1457,    -1,    -1}},
+    {0x08040C, {   -1,    -1,  1554,    -1,    -1}},
+    {0x08040E, {   -1,    -1,  1623,    -1,    -1}},
+    {0x080410, {   -1,    -1,  1968,    -1,    -1}},
+    {0x080412, {   -1,    -1,  2207,    -1,    -1}},
+    {0x080414, {   -1,    -1,  2341,    -1,    -1}},
+    {0x080416, {   -1,    -1,  2429,    -1,    -1}},
+    {0x080418, {   -1,    -1,  2494,    -1,    -1}},
+    {0x080420, {   -1,    -1,  2788,    -1,    -1}},
+    {0x080422, {   -1,    -1,  2926,    -1,    -1}},
+    {0x080424, {   -1,    -1,  3006,    -1,    -1}},
+    {0x080426, {   -1,    -1,  3061,    -1,    -1}},
+    {0x080430, {   -1,    -1,  3291,    -1,    -1}},
+    {0x080432, {   -1,    -1,  3369,    -1,    -1}},
+    {0x080434, {   -1,    -1,  3417,    -1,    -1}},
+    {0x080436, {   -1,    -1,  3451,    -1,    -1}},
+    {0x080438, {   -1,    -1,  3475,    -1,    -1}},
+    {0x08043A, {   -1,    -1,  3493,    -1,    -1}},
+    {0x08043C, {   -1,    -1,  3508,    -1,    -1}},
+    {0x08043E, {   -1,    -1,  3523,    -1,    -1}},
+    {0x080440, {   -1,    -1,  3582,    -1,    -1}},
+    {0x080442, {   -1,    -1,  3627,    -1,    -1}},
+    {0x080450, {   -1,    -1,  3733,    -1,    -1}},
+    {0x080460, {   -1,    -1,  3813,    -1,    -1}},
+    {0x080860, { 1179,    -1,    -1,    -1,    -1}},
+    {0x080901, {   -1,    -1,  4260,    -1,    -1}},
+    {0x080907, {   -1,    -1,  7177,    -1,    -1}},
+    {0x080909, {   -1,    -1,  8763,    -1,    -1}},
+    {0x081801, {   -1,    -1,  4608,    -1,    -1}},
+    {0x081809, {   -1,    -1,  9111,    -1,    -1}},
+    {0x082000, {  111,    -1,    -1,    -1,    -1}},
+    {0x082001, {   -1,    -1,  4921,    -1,    -1}},
+    {0x082007, {   -1,    -1,  7681,    -1,    -1}},
+    {0x082009, {   -1,    -1,  9424,    -1,    -1}},
+    {0x082100, {  133,    -1,    -1,    -1,    -1}},
+    {0x082200, {  138,    -1,    -1,    -1,    -1}},
+    {0x082300, {  143,    -1,    -1,    -1,    -1}},
+    {0x082400, {  158,    -1,    -1,    -1,    -1}},
+    {0x082500, {  162,    -1,    -1,    -1,    -1}},
+    {0x082600, {  166,    -1,    -1,    -1,    -1}},
+    {0x082800, {  179,    -1,    -1,    -1,    -1}},
+    {0x082801, {   -1,    -1,  5091,    -1,    -1}},
+    {0x082809, {   -1,    -1,  9594,    -1,    -1}},
+    {0x083001, {   -1,    -1,  5287,    -1,    -1}},
+    {0x083007, {   -1,    -1,  7823,    -1,    -1}},
+    {0x083009, {   -1,    -1,  9790,    -1,    -1}},
+    {0x084000, {  285,    -1,    -1,    -1,    -1}},
+    {0x084100, {  378,    -1,    -1,    -1,    -1}},
+    {0x084200, {  457,    -1,    -1,    -1,    -1}},
+    {0x084300, {  526,    -1,    -1,    -1,    -1}},
+    {0x084400, {  582,    -1,    -1,    -1,    -1}},
+    {0x084500, {  618,    -1,    -1,    -1,    -1}},
+    {0x084600, {  648,    -1,    -1,    -1,    -1}},
+    {0x084700, {  677,    -1,    -1,    -1,    -1}},
+    {0x084800, {  701,    -1,    -1,    -1,    -1}},
+    {0x084860, { 1231,    -1,    -1,    -1,    -1}},
+    {0x084900, {  721,    -1,    -1,    -1,    -1}},
+    {0x084A00, {  739,    -1,    -1,    -1,    -1}},
+    {0x084B00, {  754,    -1,    -1,    -1,    -1}},
+    {0x084C00, {  768,    -1,    -1,    -1,    -1}},
+    {0x084D00, {  780,    -1,    -1,    -1,    -1}},
+    {0x084E00, {  790,    -1,    -1,    -1,    -1}},
+    {0x084F00, {  799,    -1,    -1,    -1,    -1}},
+    {0x087E00, {  921,    -1,    -1,    -1,    -1}},
+    {0x087F00, { 1049,    -1,    -1,    -1,    -1}},
+    {0x087F01, { 2594,    -1,    -1,    -1,    -1}},
+    {0x088000, {   -1,    -1,    -1,    -1,    17}},
+    {0x088002, {   -1,    -1,   523,    -1,    -1}},
+    {0x088004, {   -1,    -1,   855,    -1,    -1}},
+    {0x088006, {   -1,    -1,  1071,    -1,    -1}},
+    {0x088007, {   -1,    -1,  6980,    -1,    -1}},
+    {0x088008, {   -1,    -1,  1241,    -1,    -1}},
+    {0x088009, {   -1,    -1,  8404,    -1,    -1}},
+    {0x08800A, {   -1,    -1,  1382,    -1,    -1}},
+    {0x08800C, {   -1,    -1,  1501,    -1,    -1}},
+    {0x08800E, {   -1,    -1,  1587,    -1,    -1}},
+    {0x088010, {   -1,    51,  1662,    -1,    -1}},
+    {0x088012, {   -1,    -1,  2069,    -1,    -1}},
+    {0x088040, {   -1,    95,  3534,    -1,    -1}},
+    {0x088042, {   -1,    -1,  3606,    -1,    -1}},
+    {0x088044, {   -1,    -1,  3640,    -1,    -1}},
+    {0x088046, {   -1,    -1,  3658,    -1,    -1}},
+    {0x0880F2, {   -1,    -1,    -1,    17,    -1}},
+    {0x088100, {   -1,    -1,    17,    -1,    -1}},
+    {0x088101, {   -1,    -1,  4023,    -1,    -1}},
+    {0x088109, {   -1,    -1,  8526,    -1,    -1}},
+    {0x088110, {   -1,    -1,  1766,    -1,    -1}},
+    {0x088140, {   -1,    -1,  3556,    -1,    -1}},
+    {0x0881F2, {   -1,    -1,    -1,   140,    -1}},
+    {0x0881FC, {   -1,    -1,  3831,    -1,    -1}},
+    {0x0881FE, {   -1,    -1,  3895,    -1,    -1}},
+    {0x088200, {   -1,    -1,   145,    -1,    -1}},
+    {0x088201, {   -1,    -1,  4124,    -1,    -1}},
+    {0x088202, {   -1,    -1,   625,    -1,    -1}},
+    {0x088209, {   -1,    -1,  8627,    -1,    -1}},
+    {0x088210, {   -1,    -1,  1804,    -1,    -1}},
+    {0x088240, {   -1,    -1,  3560,    -1,    -1}},
+    {0x0882F2, {   -1,    -1,    -1,   198,    -1}},
+    {0x088300, {   -1,    -1,   273,    -1,    -1}},
+    {0x088301, { 1611,    -1,    -1,    -1,    -1}},
+    {0x088302, {   -1,    -1,   681,    -1,    -1}},
+    {0x088304, {   -1,    -1,   951,    -1,    -1}},
+    {0x088310, {   -1,    -1,  1868,    -1,    -1}},
+    {0x088312, {   -1,    -1,  2155,    -1,    -1}},
+    {0x088340, {   -1,    -1,  3568,    -1,    -1}},
+    {0x088400, {   -1,    -1,   401,    -1,    -1}},
+    {0x088402, {   -1,    -1,   766,    -1,    -1}},
+    {0x088404, {   -1,    -1,  1007,    -1,    -1}},
+    {0x088406, {   -1,    -1,  1185,    -1,    -1}},
+    {0x088408, {   -1,    -1,  1332,    -1,    -1}},
+    {0x08840A, {   -1,    -1,  1458,    -1,    -1}},
+    {0x08840C, {   -1,    -1,  1555,    -1,    -1}},
+    {0x08840E, {   -1,    -1,  1624,    -1,    -1}},
+    {0x088410, {   -1,    -1,  1969,    -1,    -1}},
+    {0x088412, {   -1,    -1,  2208,    -1,    -1}},
+    {0x088440, {   -1,    -1,  3583,    -1,    -1}},
+    {0x088442, {   -1,    -1,  3628,    -1,    -1}},
+    {0x088444, {   -1,    -1,  3649,    -1,    -1}},
+    {0x088446, {   -1,    -1,  3669,    -1,    -1}},
+    {0x088860, { 1180,    -1,    -1,    -1,    -1}},
+    {0x088901, {   -1,    -1,  4261,    -1,    -1}},
+    {0x088907, {   -1,    -1,  7178,    -1,    -1}},
+    {0x088909, {   -1,    -1,  8764,    -1,    -1}},
+    {0x089800, {   81,    -1,    -1,    -1,    -1}},
+    {0x08A000, {  112,    -1,    -1,    -1,    -1}},
+    {0x08A001, {   -1,    -1,  4922,    -1,    -1}},
+    {0x08A007, {   -1,    -1,  7682,    -1,    -1}},
+    {0x08A009, {   -1,    -1,  9425,    -1,    -1}},
+    {0x08A100, {  134,    -1,    -1,    -1,    -1}},
+    {0x08A500, {  163,    -1,    -1,    -1,    -1}},
+    {0x08A801, {   -1,    -1,  5092,    -1,    -1}},
+    {0x08A809, {   -1,    -1,  9595,    -1,    -1}},
+    {0x08B001, {   -1,    -1,  5288,    -1,    -1}},
+    {0x08B007, {   -1,    -1,  7824,    -1,    -1}},
+    {0x08B009, {   -1,    -1,  9791,    -1,    -1}},
+    {0x08BB01, {   -1,    -1,  5993,    -1,    -1}},
+    {0x08BB09, {   -1,    -1, 10496,    -1,    -1}},
+    {0x08C000, {  286,    -1,    -1,    -1,    -1}},
+    {0x08C100, {  379,    -1,    -1,    -1,    -1}},
+    {0x08C200, {  458,    -1,    -1,    -1,    -1}},
+    {0x08C300, {  527,    -1,    -1,    -1,    -1}},
+    {0x08C400, {  583,    -1,    -1,    -1,    -1}},
+    {0x08C500, {  619,    -1,    -1,    -1,    -1}},
+    {0x08C600, {  649,    -1,    -1,    -1,    -1}},
+    {0x08C700, {  678,    -1,    -1,    -1,    -1}},
+    {0x08C800, {  702,    -1,    -1,    -1,    -1}},
+    {0x08C860, { 1232,    -1,    -1,    -1,    -1}},
+    {0x08C900, {  722,    -1,    -1,    -1,    -1}},
+    {0x08CA00, {  740,    -1,    -1,    -1,    -1}},
+    {0x08CB00, {  755,    -1,    -1,    -1,    -1}},
+    {0x08CC00, {  769,    -1,    -1,    -1,    -1}},
+    {0x08CD00, {  781,    -1,    -1,    -1,    -1}},
+    {0x08FE00, {  922,    -1,    -1,    -1,    -1}},
+    {0x08FF00, { 1050,    -1,    -1,    -1,    -1}},
+    {0x08FF01, { 2595,    -1,    -1,    -1,    -1}},
+    {0x090000, {   -1,    -1,    -1,    -1,    18}},
+    {0x090007, {   -1,    -1,  6981,    -1,    -1}},
+    {0x090009, {   -1,    -1,  8405,    -1,    -1}},
+    {0x090010, {   -1,    -1,  1663,    -1,    -1}},
+    {0x090020, {   -1,    -1,  2620,    -1,    -1}},
+    {0x090022, {   -1,    -1,  2852,    -1,    -1}},
+    {0x090024, {   -1,    -1,  2963,    -1,    -1}},
+    {0x090030, {   -1,    -1,  3202,    -1,    -1}},
+    {0x0900F2, {   -1,    -1,    -1,    18,    -1}},
+    {0x090100, {   -1,    -1,    18,    -1,    -1}},
+    {0x090101, {   -1,    -1,  4024,    -1,    -1}},
+    {0x090109, {   -1,    -1,  8527,    -1,    -1}},
+    {0x0901FC, {   -1,    -1,  3832,    -1,    -1}},
+    {0x0901FE, {   -1,    -1,  3896,    -1,    -1}},
+    {0x090200, {   -1,    -1,   146,    -1,    -1}},
+    {0x090201, {   -1,    -1,  4125,    -1,    -1}},
+    {0x090209, {   -1,    -1,  8628,    -1,    -1}},
+    {0x090210, {   -1,    -1,  1805,    -1,    -1}},
+    {0x090220, {   -1,    -1,  2696,    -1,    -1}},
+    {0x090230, {   -1,    -1,  3245,    -1,    -1}},
+    {0x090300, {   -1,    -1,   274,    -1,    -1}},
+    {0x090301, { 1612,    -1,    -1,    -1,    -1}},
+    {0x090310, {   -1,    -1,  1869,    -1,    -1}},
+    {0x090320, {   -1,    -1,  2728,    -1,    -1}},
+    {0x090322, {   -1,    -1,  2898,    -1,    -1}},
+    {0x090324, {   -1,    -1,  2991,    -1,    -1}},
+    {0x090330, {   -1,    -1,  3261,    -1,    -1}},
+    {0x090400, {   -1,    -1,   402,    -1,    -1}},
+    {0x090410, {   -1,    -1,  1970,    -1,    -1}},
+    {0x090420, {   -1,    -1,  2789,    -1,    -1}},
+    {0x090422, {   -1,    -1,  2927,    -1,    -1}},
+    {0x090424, {   -1,    -1,  3007,    -1,    -1}},
+    {0x090430, {   -1,    -1,  3292,    -1,    -1}},
+    {0x090860, { 1181,    -1,    -1,    -1,    -1}},
+    {0x090901, {   -1,    -1,  4262,    -1,    -1}},
+    {0x090907, {   -1,    -1,  7179,    -1,    -1}},
+    {0x090909, {   -1,    -1,  8765,    -1,    -1}},
+    {0x092001, {   -1,    -1,  4923,    -1,    -1}},
+    {0x092007, {   -1,    -1,  7683,    -1,    -1}},
+    {0x092009, {   -1,    -1,  9426,    -1,    -1}},
+    {0x092801, {   -1,    -1,  5093,    -1,    -1}},
+    {0x092809, {   -1,    -1,  9596,    -1,    -1}},
+    {0x093001, {   -1,    -1,  5289,    -1,    -1}},
+    {0x093007, {   -1,    -1,  7825,    -1,    -1}},
+    {0x093009, {   -1,    -1,  9792,    -1,    -1}},
+    {0x093B01, {   -1,    -1,  5994,    -1,    -1}},
+    {0x093B09, {   -1,    -1, 10497,    -1,    -1}},
+    {0x094000, {  287,    -1,    -1,    -1,    -1}},
+    {0x094100, {  380,    -1,    -1,    -1,    -1}},
+    {0x094200, {  459,    -1,    -1,    -1,    -1}},
+    {0x094300, {  528,    -1,    -1,    -1,    -1}},
+    {0x094860, { 1233,    -1,    -1,    -1,    -1}},
+    {0x097E00, {  923,    -1,    -1,    -1,    -1}},
+    {0x097F00, { 1051,    -1,    -1,    -1,    -1}},
+    {0x097F01, { 2596,    -1,    -1,    -1,    -1}},
+    {0x098000, {   -1,    -1,    -1,    -1,    19}},
+    {0x098007, {   -1,    -1,  6982,    -1,    -1}},
+    {0x098009, {   -1,    -1,  8406,    -1,    -1}},
+    {0x098010, {   -1,    52,  1664,    -1,    -1}},
+    {0x098020, {   -1,    85,  2621,    -1,    -1}},
+    {0x098030, {   -1,    -1,  3203,    -1,    -1}},
+    {0x098040, {   -1,    -1,  3535,    -1,    -1}},
+    {0x098042, {   -1,    -1,  3607,    -1,    -1}},
+    {0x0980F2, {   -1,    -1,    -1,    19,    -1}},
+    {0x098100, {   -1,    -1,    19,    -1,    -1}},
+    {0x098101, {   -1,    -1,  4025,    -1,    -1}},
+    {0x098109, {   -1,    -1,  8528,    -1,    -1}},
+    {0x098110, {   -1,    -1,  1767,    -1,    -1}},
+    {0x098120, {   -1,    -1,  2683,    -1,    -1}},
+    {0x0981F2, {   -1,    -1,    -1,   141,    -1}},
+    {0x0981FC, {   -1,    -1,  3833,    -1,    -1}},
+    {0x0981FE, {   -1,    -1,  3897,    -1,    -1}},
+    {0x098200, {   -1,    -1,   147,    -1,    -1}},
+    {0x098201, {   -1,    -1,  4126,    -1,    -1}},
+    {0x098209, {   -1,    -1,  8629,    -1,    -1}},
+    {0x098210, {   -1,    -1,  1806,    -1,    -1}},
+    {0x098220, {   -1,    -1,  2697,    -1,    -1}},
+    {0x098230, {   -1,    -1,  3246,    -1,    -1}},
+    {0x098240, {   -1,    -1,  3561,    -1,    -1}},
+    {0x0982F2, {   -1,    -1,    -1,   199,    -1}},
+    {0x098300, {   -1,    -1,   275,    -1,    -1}},
+    {0x098301, { 1613,    -1,    -1,    -1,    -1}},
+    {0x098310, {   -1,    -1,  1870,    -1,    -1}},
+    {0x098320, {   -1,    -1,  2729,    -1,    -1}},
+    {0x098330, {   -1,    -1,  3262,    -1,    -1}},
+    {0x098340, {   -1,    -1,  3569,    -1,    -1}},
+    {0x098342, {   -1,    -1,  3621,    -1,    -1}},
+    {0x098400, {   -1,    -1,   403,    -1,    -1}},
+    {0x098410, {   -1,    -1,  1971,    -1,    -1}},
+    {0x098420, {   -1,    -1,  2790,    -1,    -1}},
+    {0x098430, {   -1,    -1,  3293,    -1,    -1}},
+    {0x098440, {   -1,    -1,  3584,    -1,    -1}},
+    {0x098442, {   -1,    -1,  3629,    -1,    -1}},
+    {0x098860, { 1182,    -1,    -1,    -1,    -1}},
+    {0x098901, {   -1,    -1,  4263,    -1,    -1}},
+    {0x098907, {   -1,    -1,  7180,    -1,    -1}},
+    {0x098909, {   -1,    -1,  8766,    -1,    -1}},
+    {0x09A000, {  113,    -1,    -1,    -1,    -1}},
+    {0x09A001, {   -1,    -1,  4924,    -1,    -1}},
+    {0x09A007, {   -1,    -1,  7684,    -1,    -1}},
+    {0x09A009, {   -1,    -1,  9427,    -1,    -1}},
+    {0x09A300, {  144,    -1,    -1,    -1,    -1}},
+    {0x09A800, {  180,    -1,    -1,    -1,    -1}},
+    {0x09A801, {   -1,    -1,  5094,    -1,    -1}},
+    {0x09A809, {   -1,    -1,  9597,    -1,    -1}},
+    {0x09B001, {   -1,    -1,  5290,    -1,    -1}},
+    {0x09B007, {   -1,    -1,  7826,    -1,    -1}},
+    {0x09B009, {   -1,    -1,  9793,    -1,    -1}},
+    {0x09BB01, {   -1,    -1,  5995,    -1,    -1}},
+    {0x09BB09, {   -1,    -1, 10498,    -1,    -1}},
+    {0x09C000, {  288,    -1,    -1,    -1,    -1}},
+    {0x09C100, {  381,    -1,    -1,    -1,    -1}},
+    {0x09FE00, {  924,    -1,    -1,    -1,    -1}},
+    {0x09FF00, { 1052,    -1,    -1,    -1,    -1}},
+    {0x09FF01, { 2597,    -1,    -1,    -1,    -1}},
+    {0x0A0000, {   -1,    -1,    -1,    -1,    20}},
+    {0x0A0009, {   -1,    -1,  8407,    -1,    -1}},
+    {0x0A0010, {   -1,    -1,  1665,    -1,    -1}},
+    {0x0A0020, {   -1,    -1,  2622,    -1,    -1}},
+    {0x0A00F2, {   -1,    -1,    -1,    20,    -1}},
+    {0x0A0100, {   -1,    -1,    20,    -1,    -1}},
+    {0x0A01F2, {   -1,    -1,    -1,   142,    -1}},
+    {0x0A01FC, {   -1,    -1,  3834,    -1,    -1}},
+    {0x0A01FE, {   -1,    -1,  3898,    -1,    -1}},
+    {0x0A0200, {   -1,    -1,   148,    -1,    -1}},
+    {0x0A0300, {   -1,    -1,   276,    -1,    -1}},
+    {0x0A0301, { 1614,    -1,    -1,    -1,    -1}},
+    {0x0A0310, {   -1,    -1,  1871,    -1,    -1}},
+    {0x0A0400, {   -1,    -1,   404,    -1,    -1}},
+    {0x0A0410, {   -1,    -1,  1972,    -1,    -1}},
+    {0x0A0420, {   -1,    -1,  2791,    -1,    -1}},
+    {0x0A0801, {   -1,    -1,  4218,    -1,    -1}},
+    {0x0A0809, {   -1,    -1,  8721,    -1,    -1}},
+    {0x0A0860, { 1183,    -1,    -1,    -1,    -1}},
+    {0x0A0901, {   -1,    -1,  4264,    -1,    -1}},
+    {0x0A0909, {   -1,    -1,  8767,    -1,    -1}},
+    {0x0A0A01, {   -1,    -1,  4372,    -1,    -1}},
+    {0x0A0A09, {   -1,    -1,  8875,    -1,    -1}},
+    {0x0A0B01, {   -1,    -1,  4415,    -1,    -1}},
+    {0x0A0B09, {   -1,    -1,  8918,    -1,    -1}},
+    {0x0A0D01, {   -1,    -1,  4515,    -1,    -1}},
+    {0x0A0D09, {   -1,    -1,  9018,    -1,    -1}},
+    {0x0A1A01, {   -1,    -1,  4703,    -1,    -1}},
+    {0x0A1A09, {   -1,    -1,  9206,    -1,    -1}},
+    {0x0A2000, {  114,    -1,    -1,    -1,    -1}},
+    {0x0A2001, {   -1,    -1,  4925,    -1,    -1}},
+    {0x0A2009, {   -1,    -1,  9428,    -1,    -1}},
+    {0x0A2800, {  181,    -1,    -1,    -1,    -1}},
+    {0x0A2901, {   -1,    -1,  5190,    -1,    -1}},
+    {0x0A2909, {   -1,    -1,  9693,    -1,    -1}},
+    {0x0A3B01, {   -1,    -1,  5996,    -1,    -1}},
+    {0x0A3B09, {   -1,    -1, 10499,    -1,    -1}},
+    {0x0A4000, {  289,    -1,    -1,    -1,    -1}},
+    {0x0A7E00, {  925,    -1,    -1,    -1,    -1}},
+    {0x0A7F00, { 1053,    -1,    -1,    -1,    -1}},
+    {0x0A7F01, { 2598,    -1,    -1,    -1,    -1}},
+    {0x0A8000, {   -1,    -1,    -1,    -1,    21}},
+    {0x0A8009, {   -1,    -1,  8408,    -1,    -1}},
+    {0x0A8010, {   -1,    53,  1666,    -1,    -1}},
+    {0x0A8012, {   -1,    -1,  2070,    -1,    -1}},
+    {0x0A8020, {   -1,    -1,  2623,    -1,    -1}},
+    {0x0A8030, {   -1,    -1,  3204,    -1,    -1}},
+    {0x0A8032, {   -1,    -1,  3331,    -1,    -1}},
+    {0x0A80F2, {   -1,    -1,    -1,    21,    -1}},
+    {0x0A8100, {   -1,    -1,    21,    -1,    -1}},
+    {0x0A8110, {   -1,    -1,  1768,    -1,    -1}},
+    {0x0A81F2, {   -1,    -1,    -1,   143,    -1}},
+    {0x0A81FC, {   -1,    -1,  3835,    -1,    -1}},
+    {0x0A81FE, {   -1,    -1,  3899,    -1,    -1}},
+    {0x0A8200, {   -1,    -1,   149,    -1,    -1}},
+    {0x0A8210, {   -1,    -1,  1807,    -1,    -1}},
+    {0x0A8300, {   -1,    -1,   277,    -1,    -1}},
+    {0x0A8301, { 1615,    -1,    -1,    -1,    -1}},
+    {0x0A8310, {   -1,    -1,  1872,    -1,    -1}},
+    {0x0A8312, {   -1,    -1,  2156,    -1,    -1}},
+    {0x0A8320, {   -1,    -1,  2730,    -1,    -1}},
+    {0x0A8330, {   -1,    -1,  3263,    -1,    -1}},
+    {0x0A8332, {   -1,    -1,  3357,    -1,    -1}},
+    {0x0A8400, {   -1,    -1,   405,    -1,    -1}},
+    {0x0A8410, {   -1,    -1,  1973,    -1,    -1}},
+    {0x0A8412, {   -1,    -1,  2209,    -1,    -1}},
+    {0x0A8420, {   -1,    -1,  2792,    -1,    -1}},
+    {0x0A8430, {   -1,    -1,  3294,    -1,    -1}},
+    {0x0A8432, {   -1,    -1,  3370,    -1,    -1}},
+    {0x0A8801, {   -1,    -1,  4219,    -1,    -1}},
+    {0x0A8809, {   -1,    -1,  8722,    -1,    -1}},
+    {0x0A8860, { 1184,    -1,    -1,    -1,    -1}},
+    {0x0A8901, {   -1,    -1,  4265,    -1,    -1}},
+    {0x0A8909, {   -1,    -1,  8768,    -1,    -1}},
+    {0x0A8A01, {   -1,    -1,  4373,    -1,    -1}},
+    {0x0A8A09, {   -1,    -1,  8876,    -1,    -1}},
+    {0x0A8B01, {   -1,    -1,  4416,    -1,    -1}},
+    {0x0A8B09, {   -1,    -1,  8919,    -1,    -1}},
+    {0x0A8D01, {   -1,    -1,  4516,    -1,    -1}},
+    {0x0A8D09, {   -1,    -1,  9019,    -1,    -1}},
+    {0x0A9A01, {   -1,    -1,  4704,    -1,    -1}},
+    {0x0A9A09, {   -1,    -1,  9207,    -1,    -1}},
+    {0x0AA000, {  115,    -1,    -1,    -1,    -1}},
+    {0x0AA001, {   -1,    -1,  4926,    -1,    -1}},
+    {0x0AA009, {   -1,    -1,  9429,    -1,    -1}},
+    {0x0AA901, {   -1,    -1,  5191,    -1,    -1}},
+    {0x0AA909, {   -1,    -1,  9694,    -1,    -1}},
+    {0x0AB801, {   -1,    -1,  5808,    -1,    -1}},
+    {0x0AB807, {   -1,    -1,  8202,    -1,    -1}},
+    {0x0AB809, {   -1,    -1, 10311,    -1,    -1}},
+    {0x0ABB01, {   -1,    -1,  5997,    -1,    -1}},
+    {0x0ABB09, {   -1,    -1, 10500,    -1,    -1}},
+    {0x0AFE00, {  926,    -1,    -1,    -1,    -1}},
+    {0x0AFF00, { 1054,    -1,    -1,    -1,    -1}},
+    {0x0AFF01, { 2599,    -1,    -1,    -1,    -1}},
+    {0x0B0000, {   -1,    -1,    -1,    -1,    22}},
+    {0x0B0002, {   -1,    -1,   524,    -1,    -1}},
+    {0x0B0007, {   -1,    -1,  6983,    -1,    -1}},
+    {0x0B0009, {   -1,    -1,  8409,    -1,    -1}},
+    {0x0B0010, {   -1,    -1,  1667,    -1,    -1}},
+    {0x0B0012, {   -1,    -1,  2071,    -1,    -1}},
+    {0x0B00F2, {   -1,    -1,    -1,    22,    -1}},
+    {0x0B0100, {   -1,    -1,    22,    -1,    -1}},
+    {0x0B0101, {   -1,    -1,  4026,    -1,    -1}},
+    {0x0B0109, {   -1,    -1,  8529,    -1,    -1}},
+    {0x0B01FC, {   -1,    -1,  3836,    -1,    -1}},
+    {0x0B01FE, {   -1,    -1,  3900,    -1,    -1}},
+    {0x0B0200, {   -1,    -1,   150,    -1,    -1}},
+    {0x0B0201, {   -1,    -1,  4127,    -1,    -1}},
+    {0x0B0202, {   -1,    -1,   626,    -1,    -1}},
+    {0x0B0209, {   -1,    -1,  8630,    -1,    -1}},
+    {0x0B0300, {   -1,    -1,   278,    -1,    -1}},
+    {0x0B0301, { 1616,    -1,    -1,    -1,    -1}},
+    {0x0B0302, {   -1,    -1,   682,    -1,    -1}},
+    {0x0B0400, {   -1,    -1,   406,    -1,    -1}},
+    {0x0B0402, {   -1,    -1,   767,    -1,    -1}},
+    {0x0B0410, {   -1,    -1,  1974,    -1,    -1}},
+    {0x0B0412, {   -1,    -1,  2210,    -1,    -1}},
+    {0x0B0901, {   -1,    -1,  4266,    -1,    -1}},
+    {0x0B0907, {   -1,    -1,  7181,    -1,    -1}},
+    {0x0B0909, {   -1,    -1,  8769,    -1,    -1}},
+    {0x0B2000, {  116,    -1,    -1,    -1,    -1}},
+    {0x0B2001, {   -1,    -1,  4927,    -1,    -1}},
+    {0x0B2007, {   -1,    -1,  7685,    -1,    -1}},
+    {0x0B2009, {   -1,    -1,  9430,    -1,    -1}},
+    {0x0B2801, {   -1,    -1,  5095,    -1,    -1}},
+    {0x0B2809, {   -1,    -1,  9598,    -1,    -1}},
+    {0x0B3001, {   -1,    -1,  5291,    -1,    -1}},
+    {0x0B3007, {   -1,    -1,  7827,    -1,    -1}},
+    {0x0B3009, {   -1,    -1,  9794,    -1,    -1}},
+    {0x0B3801, {   -1,    -1,  5809,    -1,    -1}},
+    {0x0B3807, {   -1,    -1,  8203,    -1,    -1}},
+    {0x0B3809, {   -1,    -1, 10312,    -1,    -1}},
+    {0x0B3B01, {   -1,    -1,  5998,    -1,    -1}},
+    {0x0B3B09, {   -1,    -1, 10501,    -1,    -1}},
+    {0x0B7E00, {  927,    -1,    -1,    -1,    -1}},
+    {0x0B7F00, { 1055,    -1,    -1,    -1,    -1}},
+    {0x0B7F01, { 2600,    -1,    -1,    -1,    -1}},
+    {0x0B8000, {   -1,    -1,    -1,    -1,    23}},
+    {0x0B8007, {   -1,    -1,  6984,    -1,    -1}},
+    {0x0B8009, {   -1,    -1,  8410,    -1,    -1}},
+    {0x0B8010, {   -1,    -1,  1668,    -1,    -1}},
+    {0x0B8020, {   -1,    -1,  2624,    -1,    -1}},
+    {0x0B80F2, {   -1,    -1,    -1,    23,    -1}},
+    {0x0B8100, {   -1,    -1,    23,    -1,    -1}},
+    {0x0B8101, {   -1,    -1,  4027,    -1,    -1}},
+    {0x0B8109, {   -1,    -1,  8530,    -1,    -1}},
+    {0x0B81FC, {   -1,    -1,  3837,    -1,    -1}},
+    {0x0B81FE, {   -1,    -1,  3901,    -1,    -1}},
+    {0x0B8200, {   -1,    -1,   151,    -1,    -1}},
+    {0x0B8201, {   -1,    -1,  4128,    -1,    -1}},
+    {0x0B8209, {   -1,    -1,  8631,    -1,    -1}},
+    {0x0B8300, {   -1,    -1,   279,    -1,    -1}},
+    {0x0B8301, { 1617,    -1,    -1,    -1,    -1}},
+    {0x0B8310, {   -1,    -1,  1873,    -1,    -1}},
+    {0x0B8320, {   -1,    -1,  2731,    -1,    -1}},
+    {0x0B8400, {   -1,    -1,   407,    -1,    -1}},
+    {0x0B8410, {   -1,    -1,  1975,    -1,    -1}},
+    {0x0B8420, {   -1,    -1,  2793,    -1,    -1}},
+    {0x0B8901, {   -1,    -1,  4267,    -1,    -1}},
+    {0x0B8907, {   -1,    -1,  7182,    -1,    -1}},
+    {0x0B8909, {   -1,    -1,  8770,    -1,    -1}},
+    {0x0BA001, {   -1,    -1,  4928,    -1,    -1}},
+    {0x0BA007, {   -1,    -1,  7686,    -1,    -1}},
+    {0x0BA009, {   -1,    -1,  9431,    -1,    -1}},
+    {0x0BA801, {   -1,    -1,  5096,    -1,    -1}},
+    {0x0BA809, {   -1,    -1,  9599,    -1,    -1}},
+    {0x0BB001, {   -1,    -1,  5292,    -1,    -1}},
+    {0x0BB007, {   -1,    -1,  7828,    -1,    -1}},
+    {0x0BB009, {   -1,    -1,  9795,    -1,    -1}},
+    {0x0BB801, {   -1,    -1,  5810,    -1,    -1}},
+    {0x0BB807, {   -1,    -1,  8204,    -1,    -1}},
+    {0x0BB809, {   -1,    -1, 10313,    -1,    -1}},
+    {0x0BBB01, {   -1,    -1,  5999,    -1,    -1}},
+    {0x0BBB09, {   -1,    -1, 10502,    -1,    -1}},
+    {0x0BC000, {  290,    -1,    -1,    -1,    -1}},
+    {0x0BC100, {  382,    -1,    -1,    -1,    -1}},
+    {0x0BC200, {  460,    -1,    -1,    -1,    -1}},
+    {0x0BFE00, {  928,    -1,    -1,    -1,    -1}},
+    {0x0BFF00, { 1056,    -1,    -1,    -1,    -1}},
+    {0x0BFF01, { 2601,    -1,    -1,    -1,    -1}},
+    {0x0C0000, {   -1,    -1,    -1,    -1,    24}},
+    {0x0C0007, {   -1,    -1,  6985,    -1,    -1}},
+    {0x0C0009, {   -1,    -1,  8411,    -1,    -1}},
+    {0x0C0010, {   -1,    54,  1669,    -1,    -1}},
+    {0x0C0020, {   -1,    86,  2625,    -1,    -1}},
+    {0x0C0030, {   -1,    -1,  3205,    -1,    -1}},
+    {0x0C0040, {   -1,    96,  3536,    -1,    -1}},
+    {0x0C0050, {   -1,    -1,  3716,    -1,    -1}},
+    {0x0C00F2, {   -1,    -1,    -1,    24,    -1}},
+    {0x0C0100, {   -1,    -1,    24,    -1,    -1}},
+    {0x0C0101, {   -1,    -1,  4028,    -1,    -1}},
+    {0x0C0109, {   -1,    -1,  8531,    -1,    -1}},
+    {0x0C0110, {   -1,    -1,  1769,    -1,    -1}},
+    {0x0C0120, {   -1,    -1,  2684,    -1,    -1}},
+    {0x0C0140, {   -1,    -1,  3557,    -1,    -1}},
+    {0x0C01F2, {   -1,    -1,    -1,   144,    -1}},
+    {0x0C01FC, {   -1,    -1,  3838,    -1,    -1}},
+    {0x0C01FE, {   -1,    -1,  3902,    -1,    -1}},
+    {0x0C0200, {   -1,    -1,   152,    -1,    -1}},
+    {0x0C0201, {   -1,    -1,  4129,    -1,    -1}},
+    {0x0C0209, {   -1,    -1,  8632,    -1,    -1}},
+    {0x0C0210, {   -1,    -1,  1808,    -1,    -1}},
+    {0x0C0220, {   -1,    -1,  2698,    -1,    -1}},
+    {0x0C0230, {   -1,    -1,  3247,    -1,    -1}},
+    {0x0C0240, {   -1,    -1,  3562,    -1,    -1}},
+    {0x0C0250, {   -1,    -1,  3729,    -1,    -1}},
+    {0x0C02F2, {   -1,    -1,    -1,   200,    -1}},
+    {0x0C0300, {   -1,    -1,   280,    -1,    -1}},
+    {0x0C0301, { 1618,    -1,    -1,    -1,    -1}},
+    {0x0C0310, {   -1,    -1,  1874,    -1,    -1}},
+    {0x0C0320, {   -1,    -1,  2732,    -1,    -1}},
+    {0x0C0330, {   -1,    -1,  3264,    -1,    -1}},
+    {0x0C0340, {   -1,    -1,  3570,    -1,    -1}},
+    {0x0C0350, {   -1,    -1,  3731,    -1,    -1}},
+    {0x0C03F2, {   -1,    -1,    -1,   227,    -1}},
+    {0x0C0400, {   -1,    -1,   408,    -1,    -1}},
+    {0x0C0410, {   -1,    -1,  1976,    -1,    -1}},
+    {0x0C0420, {   -1,    -1,  2794,    -1,    -1}},
+    {0x0C0430, {   -1,    -1,  3295,    -1,    -1}},
+    {0x0C0440, {   -1,    -1,  3585,    -1,    -1}},
+    {0x0C0450, {   -1,    -1,  3734,    -1,    -1}},
+    {0x0C0901, {   -1,    -1,  4268,    -1,    -1}},
+    {0x0C0907, {   -1,    -1,  7183,    -1,    -1}},
+    {0x0C0909, {   -1,    -1,  8771,    -1,    -1}},
+    {0x0C1000, {   41,    -1,    -1,    -1,    -1}},
+    {0x0C1900, {   89,    -1,    -1,    -1,    -1}},
+    {0x0C1D01, { 2131,    -1,    -1,    -1,    -1}},
+    {0x0C2000, {  117,    -1,    -1,    -1,    -1}},
+    {0x0C2001, {   -1,    -1,  4929,    -1,    -1}},
+    {0x0C2007, {   -1,    -1,  7687,    -1,    -1}},
+    {0x0C2009, {   -1,    -1,  9432,    -1,    -1}},
+    {0x0C2800, {  182,    -1,    -1,    -1,    -1}},
+    {0x0C2801, {   -1,    -1,  5097,    -1,    -1}},
+    {0x0C2809, {   -1,    -1,  9600,    -1,    -1}},
+    {0x0C2B00, {  249,    -1,    -1,    -1,    -1}},
+    {0x0C3001, {   -1,    -1,  5293,    -1,    -1}},
+    {0x0C3007, {   -1,    -1,  7829,    -1,    -1}},
+    {0x0C3009, {   -1,    -1,  9796,    -1,    -1}},
+    {0x0C3801, {   -1,    -1,  5811,    -1,    -1}},
+    {0x0C3807, {   -1,    -1,  8205,    -1,    -1}},
+    {0x0C3809, {   -1,    -1, 10314,    -1,    -1}},
+    {0x0C3B01, {   -1,    -1,  6000,    -1,    -1}},
+    {0x0C3B09, {   -1,    -1, 10503,    -1,    -1}},
+    {0x0C4000, {  291,    -1,    -1,    -1,    -1}},
+    {0x0C4100, {  383,    -1,    -1,    -1,    -1}},
+    {0x0C4200, {  461,    -1,    -1,    -1,    -1}},
+    {0x0C4300, {  529,    -1,    -1,    -1,    -1}},
+    {0x0C6000, {  842,    -1,    -1,    -1,    -1}},
+    {0x0C7E00, {  929,    -1,    -1,    -1,    -1}},
+    {0x0C7F00, { 1057,    -1,    -1,    -1,    -1}},
+    {0x0C7F01, { 2602,    -1,    -1,    -1,    -1}},
+    {0x0C8000, {   -1,    -1,    -1,    -1,    25}},
+    {0x0C8005, {   -1,    -1,  6523,    -1,    -1}},
+    {0x0C8007, {   -1,    -1,  6986,    -1,    -1}},
+    {0x0C8009, {   -1,    -1,  8412,    -1,    -1}},
+    {0x0C8010, {   -1,    55,  1670,    -1,    -1}},
+    {0x0C8012, {   -1,    -1,  2072,    -1,    -1}},
+    {0x0C8014, {   -1,    -1,  2272,    -1,    -1}},
+    {0x0C8020, {   -1,    87,  2626,    -1,    -1}},
+    {0x0C8022, {   -1,    -1,  2853,    -1,    -1}},
+    {0x0C8024, {   -1,    -1,  2964,    -1,    -1}},
+    {0x0C8040, {   -1,    -1,  3537,    -1,    -1}},
+    {0x0C8042, {   -1,    -1,  3608,    -1,    -1}},
+    {0x0C80F2, {   -1,    -1,    -1,    25,    -1}},
+    {0x0C8100, {   -1,    -1,    25,    -1,    -1}},
+    {0x0C8101, {   -1,    -1,  4029,    -1,    -1}},
+    {0x0C8109, {   -1,    -1,  8532,    -1,    -1}},
+    {0x0C8110, {   -1,    -1,  1770,    -1,    -1}},
+    {0x0C8120, {   -1,    -1,  2685,    -1,    -1}},
+    {0x0C81F2, {   -1,    -1,    -1,   145,    -1}},
+    {0x0C81FC, {   -1,    -1,  3839,    -1,    -1}},
+    {0x0C81FE, {   -1,    -1,  3903,    -1,    -1}},
+    {0x0C8200, {   -1,    -1,   153,    -1,    -1}},
+    {0x0C8201, { 1569,    -1,  4130,    -1,    -1}},
+    {0x0C8209, {   -1,    -1,  8633,    -1,    -1}},
+    {0x0C8210, {   -1,    -1,  1809,    -1,    -1}},
+    {0x0C8212, {   -1,    -1,  2134,    -1,    -1}},
+    {0x0C8220, {   -1,    -1,  2699,    -1,    -1}},
+    {0x0C8240, {   -1,    -1,  3563,    -1,    -1}},
+    {0x0C82F2, {   -1,    -1,    -1,   201,    -1}},
+    {0x0C8300, {   -1,    -1,   281,    -1,    -1}},
+    {0x0C8301, { 1619,    -1,    -1,    -1,    -1}},
+    {0x0C8310, {   -1,    -1,  1875,    -1,    -1}},
+    {0x0C8312, {   -1,    -1,  2157,    -1,    -1}},
+    {0x0C8320, {   -1,    -1,  2733,    -1,    -1}},
+    {0x0C8322, {   -1,    -1,  2899,    -1,    -1}},
+    {0x0C8324, {   -1,    -1,  2992,    -1,    -1}},
+    {0x0C8340, {   -1,    -1,  3571,    -1,    -1}},
+    {0x0C83F2, {   -1,    -1,    -1,   228,    -1}},
+    {0x0C8400, {   -1,    -1,   409,    -1,    -1}},
+    {0x0C8401, { 1681,    -1,    -1,    -1,    -1}},
+    {0x0C8410, {   -1,    -1,  1977,    -1,    -1}},
+    {0x0C8412, {   -1,    -1,  2211,    -1,    -1}},
+    {0x0C8414, {   -1,    -1,  2342,    -1,    -1}},
+    {0x0C8420, {   -1,    -1,  2795,    -1,    -1}},
+    {0x0C8422, {   -1,    -1,  2928,    -1,    -1}},
+    {0x0C8424, {   -1,    -1,  3008,    -1,    -1}},
+    {0x0C8440, {   -1,    -1,  3586,    -1,    -1}},
+    {0x0C8442, {   -1,    -1,  3630,    -1,    -1}},
+    {0x0C8501, { 1730,    -1,    -1,    -1,    -1}},
+    {0x0C8601, { 1778,    -1,    -1,    -1,    -1}},
+    {0x0C8701, { 1824,    -1,    -1,    -1,    -1}},
+    {0x0C8901, { 1880,    -1,  4269,    -1,    -1}},
+    {0x0C8907, {   -1,    -1,  7184,    -1,    -1}},
+    {0x0C8909, {   -1,    -1,  8772,    -1,    -1}},
+    {0x0C9000, {   42,    -1,    -1,    -1,    -1}},
+    {0x0C9101, { 1930,    -1,    -1,    -1,    -1}},
+    {0x0C9A01, { 2013,    -1,    -1,    -1,    -1}},
+    {0x0C9C01, { 2088,    -1,    -1,    -1,    -1}},
+    {0x0C9D01, { 2132,    -1,    -1,    -1,    -1}},
+    {0x0C9E01, { 2175,    -1,    -1,    -1,    -1}},
+    {0x0C9F01, { 2222,    -1,    -1,    -1,    -1}},
+    {0x0CA000, {  118,    -1,    -1,    -1,    -1}},
+    {0x0CA001, {   -1,    -1,  4930,    -1,    -1}},
+    {0x0CA007, {   -1,    -1,  7688,    -1,    -1}},
+    {0x0CA009, {   -1,    -1,  9433,    -1,    -1}},
+    {0x0CA101, { 2278,    -1,    -1,    -1,    -1}},
+    {0x0CA300, {  145,    -1,    -1,    -1,    -1}},
+    {0x0CA800, {  183,    -1,    -1,    -1,    -1}},
+    {0x0CA801, {   -1,    -1,  5098,    -1,    -1}},
+    {0x0CA809, {   -1,    -1,  9601,    -1,    -1}},
+    {0x0CA900, {  223,    -1,    -1,    -1,    -1}},
+    {0x0CB001, {   -1,    -1,  5294,    -1,    -1}},
+    {0x0CB007, {   -1,    -1,  7830,    -1,    -1}},
+    {0x0CB009, {   -1,    -1,  9797,    -1,    -1}},
+    {0x0CB101, {   -1,    -1,  5375,    -1,    -1}},
+    {0x0CB105, {   -1,    -1,  6723,    -1,    -1}},
+    {0x0CB107, {   -1,    -1,  7911,    -1,    -1}},
+    {0x0CB109, {   -1,    -1,  9878,    -1,    -1}},
+    {0x0CB201, {   -1,    -1,  5450,    -1,    -1}},
+    {0x0CB207, {   -1,    -1,  7986,    -1,    -1}},
+    {0x0CB209, {   -1,    -1,  9953,    -1,    -1}},
+    {0x0CB301, {   -1,    -1,  5537,    -1,    -1}},
+    {0x0CB309, {   -1,    -1, 10040,    -1,    -1}},
+    {0x0CB401, {   -1,    -1,  5624,    -1,    -1}},
+    {0x0CB407, {   -1,    -1,  8073,    -1,    -1}},
+    {0x0CB409, {   -1,    -1, 10127,    -1,    -1}},
+    {0x0CB801, { 2370,    -1,  5812,    -1,    -1}},
+    {0x0CB807, {   -1,    -1,  8206,    -1,    -1}},
+    {0x0CB809, {   -1,    -1, 10315,    -1,    -1}},
+    {0x0CB901, { 2399,    -1,    -1,    -1,    -1}},
+    {0x0CBB01, {   -1,    -1,  6001,    -1,    -1}},
+    {0x0CBB09, {   -1,    -1, 10504,    -1,    -1}},
+    {0x0CC000, {  292,    -1,    -1,    -1,    -1}},
+    {0x0CC001, { 2428,    -1,    -1,    -1,    -1}},
+    {0x0CC100, {  384,    -1,    -1,    -1,    -1}},
+    {0x0CC101, { 2478,    -1,    -1,    -1,    -1}},
+    {0x0CC200, {  462,    -1,    -1,    -1,    -1}},
+    {0x0CC201, { 2526,    -1,    -1,    -1,    -1}},
+    {0x0CC300, {  530,    -1,    -1,    -1,    -1}},
+    {0x0CE000, {  843,    -1,    -1,    -1,    -1}},
+    {0x0CE100, {  875,    -1,    -1,    -1,    -1}},
+    {0x0CFE00, {  930,    -1,    -1,    -1,    -1}},
+    {0x0CFF00, { 1058,    -1,    -1,    -1,    -1}},
+    {0x0CFF01, { 2603,    -1,    -1,    -1,    -1}},
+    {0x0D0000, {   -1,    -1,    -1,    -1,    26}},
+    {0x0D0002, {   -1,    -1,   525,    -1,    -1}},
+    {0x0D0005, {   -1,    -1,  6524,    -1,    -1}},
+    {0x0D0007, {   -1,    -1,  6987,    -1,    -1}},
+    {0x0D0009, {   -1,    -1,  8413,    -1,    -1}},
+    {0x0D0010, {   -1,    56,  1671,    -1,    -1}},
+    {0x0D00F2, {   -1,    -1,    -1,    26,    -1}},
+    {0x0D0100, {   -1,    -1,    26,    -1,    -1}},
+    {0x0D0101, {   -1,    -1,  4030,    -1,    -1}},
+    {0x0D0107, {   -1,    -1,  7081,    -1,    -1}},
+    {0x0D0109, {   -1,    -1,  8533,    -1,    -1}},
+    {0x0D0110, {   -1,    -1,  1771,    -1,    -1}},
+    {0x0D01F2, {   -1,    -1,    -1,   146,    -1}},
+    {0x0D01FC, {   -1,    -1,  3840,    -1,    -1}},
+    {0x0D01FE, {   -1,    -1,  3904,    -1,    -1}},
+    {0x0D0200, {   -1,    -1,   154,    -1,    -1}},
+    {0x0D0201, { 1570,    -1,  4131,    -1,    -1}},
+    {0x0D0202, {   -1,    -1,   627,    -1,    -1}},
+    {0x0D0207, {   -1,    -1,  7108,    -1,    -1}},
+    {0x0D0209, {   -1,    -1,  8634,    -1,    -1}},
+    {0x0D0210, {   -1,    -1,  1810,    -1,    -1}},
+    {0x0D0300, {   -1,    -1,   282,    -1,    -1}},
+    {0x0D0301, { 1620,    -1,    -1,    -1,    -1}},
+    {0x0D0302, {   -1,    -1,   683,    -1,    -1}},
+    {0x0D0310, {   -1,    -1,  1876,    -1,    -1}},
+    {0x0D0400, {   -1,    -1,   410,    -1,    -1}},
+    {0x0D0401, { 1682,    -1,    -1,    -1,    -1}},
+    {0x0D0402, {   -1,    -1,   768,    -1,    -1}},
+    {0x0D0410, {   -1,    -1,  1978,    -1,    -1}},
+    {0x0D0501, { 1731,    -1,    -1,    -1,    -1}},
+    {0x0D0601, { 1779,    -1,    -1,    -1,    -1}},
+    {0x0D0701, { 1825,    -1,    -1,    -1,    -1}},
+    {0x0D0801, {   -1,    -1,  4220,    -1,    -1}},
+    {0x0D0807, {   -1,    -1,  7135,    -1,    -1}},
+    {0x0D0809, {   -1,    -1,  8723,    -1,    -1}},
+    {0x0D0901, { 1881,    -1,  4270,    -1,    -1}},
+    {0x0D0907, {   -1,    -1,  7185,    -1,    -1}},
+    {0x0D0909, {   -1,    -1,  8773,    -1,    -1}},
+    {0x0D0A01, {   -1,    -1,  4374,    -1,    -1}},
+    {0x0D0A07, {   -1,    -1,  7279,    -1,    -1}},
+    {0x0D0A09, {   -1,    -1,  8877,    -1,    -1}},
+    {0x0D0B01, {   -1,    -1,  4417,    -1,    -1}},
+    {0x0D0B07, {   -1,    -1,  7313,    -1,    -1}},
+    {0x0D0B09, {   -1,    -1,  8920,    -1,    -1}},
+    {0x0D0C01, {   -1,    -1,  4465,    -1,    -1}},
+    {0x0D0C09, {   -1,    -1,  8968,    -1,    -1}},
+    {0x0D0D01, {   -1,    -1,  4517,    -1,    -1}},
+    {0x0D0D09, {   -1,    -1,  9020,    -1,    -1}},
+    {0x0D1001, {   -1,    -1,  4565,    -1,    -1}},
+    {0x0D1007, {   -1,    -1,  7353,    -1,    -1}},
+    {0x0D1009, {   -1,    -1,  9068,    -1,    -1}},
+    {0x0D1101, { 1931,    -1,    -1,    -1,    -1}},
+    {0x0D1200, {   53,    -1,    -1,    -1,    -1}},
+    {0x0D1801, {   -1,    -1,  4609,    -1,    -1}},
+    {0x0D1807, {   -1,    -1,  7379,    -1,    -1}},
+    {0x0D1809, {   -1,    -1,  9112,    -1,    -1}},
+    {0x0D1901, {   -1,    -1,  4662,    -1,    -1}},
+    {0x0D1907, {   -1,    -1,  7419,    -1,    -1}},
+    {0x0D1909, {   -1,    -1,  9165,    -1,    -1}},
+    {0x0D1A01, { 2014,    -1,  4705,    -1,    -1}},
+    {0x0D1A07, {   -1,    -1,  7460,    -1,    -1}},
+    {0x0D1A09, {   -1,    -1,  9208,    -1,    -1}},
+    {0x0D1B01, {   -1,    -1,  4747,    -1,    -1}},
+    {0x0D1B07, {   -1,    -1,  7501,    -1,    -1}},
+    {0x0D1B09, {   -1,    -1,  9250,    -1,    -1}},
+    {0x0D1C01, { 2089,    -1,  4788,    -1,    -1}},
+    {0x0D1C07, {   -1,    -1,  7542,    -1,    -1}},
+    {0x0D1C09, {   -1,    -1,  9291,    -1,    -1}},
+    {0x0D1D01, { 2133,    -1,  4829,    -1,    -1}},
+    {0x0D1D07, {   -1,    -1,  7583,    -1,    -1}},
+    {0x0D1D09, {   -1,    -1,  9332,    -1,    -1}},
+    {0x0D1E01, { 2176,    -1,  4870,    -1,    -1}},
+    {0x0D1E07, {   -1,    -1,  7624,    -1,    -1}},
+    {0x0D1E09, {   -1,    -1,  9373,    -1,    -1}},
+    {0x0D1F01, { 2223,    -1,    -1,    -1,    -1}},
+    {0x0D2000, {  119,    -1,    -1,    -1,    -1}},
+    {0x0D2001, {   -1,    -1,  4931,    -1,    -1}},
+    {0x0D2007, {   -1,    -1,  7689,    -1,    -1}},
+    {0x0D2009, {   -1,    -1,  9434,    -1,    -1}},
+    {0x0D2101, { 2279,    -1,  5024,    -1,    -1}},
+    {0x0D2109, {   -1,    -1,  9527,    -1,    -1}},
+    {0x0D2800, {  184,    -1,    -1,    -1,    -1}},
+    {0x0D2801, {   -1,    -1,  5099,    -1,    -1}},
+    {0x0D2807, {   -1,    -1,  7780,    -1,    -1}},
+    {0x0D2809, {   -1,    -1,  9602,    -1,    -1}},
+    {0x0D2900, {  224,    -1,    -1,    -1,    -1}},
+    {0x0D2901, {   -1,    -1,  5192,    -1,    -1}},
+    {0x0D2909, {   -1,    -1,  9695,    -1,    -1}},
+    {0x0D2A01, {   -1,    -1,  5221,    -1,    -1}},
+    {0x0D2A09, {   -1,    -1,  9724,    -1,    -1}},
+    {0x0D3001, {   -1,    -1,  5295,    -1,    -1}},
+    {0x0D3007, {   -1,    -1,  7831,    -1,    -1}},
+    {0x0D3009, {   -1,    -1,  9798,    -1,    -1}},
+    {0x0D3101, {   -1,    -1,  5376,    -1,    -1}},
+    {0x0D3105, {   -1,    -1,  6724,    -1,    -1}},
+    {0x0D3107, {   -1,    -1,  7912,    -1,    -1}},
+    {0x0D3109, {   -1,    -1,  9879,    -1,    -1}},
+    {0x0D3201, {   -1,    -1,  5451,    -1,    -1}},
+    {0x0D3207, {   -1,    -1,  7987,    -1,    -1}},
+    {0x0D3209, {   -1,    -1,  9954,    -1,    -1}},
+    {0x0D3301, {   -1,    -1,  5538,    -1,    -1}},
+    {0x0D3309, {   -1,    -1, 10041,    -1,    -1}},
+    {0x0D3401, {   -1,    -1,  5625,    -1,    -1}},
+    {0x0D3407, {   -1,    -1,  8074,    -1,    -1}},
+    {0x0D3409, {   -1,    -1, 10128,    -1,    -1}},
+    {0x0D3801, { 2371,    -1,  5813,    -1,    -1}},
+    {0x0D3807, {   -1,    -1,  8207,    -1,    -1}},
+    {0x0D3809, {   -1,    -1, 10316,    -1,    -1}},
+    {0x0D3901, { 2400,    -1,    -1,    -1,    -1}},
+    {0x0D3B01, {   -1,    -1,  6002,    -1,    -1}},
+    {0x0D3B09, {   -1,    -1, 10505,    -1,    -1}},
+    {0x0D4000, {  293,    -1,    -1,    -1,    -1}},
+    {0x0D4001, { 2429,    -1,    -1,    -1,    -1}},
+    {0x0D4100, {  385,    -1,    -1,    -1,    -1}},
+    {0x0D4101, { 2479,    -1,    -1,    -1,    -1}},
+    {0x0D4200, {  463,    -1,    -1,    -1,    -1}},
+    {0x0D4201, { 2527,    -1,    -1,    -1,    -1}},
+    {0x0D4300, {  531,    -1,    -1,    -1,    -1}},
+    {0x0D4400, {  584,    -1,    -1,    -1,    -1}},
+    {0x0D4500, {  620,    -1,    -1,    -1,    -1}},
+    {0x0D4600, {  650,    -1,    -1,    -1,    -1}},
+    {0x0D4700, {  679,    -1,    -1,    -1,    -1}},
+    {0x0D4800, {  703,    -1,    -1,    -1,    -1}},
+    {0x0D6000, {  844,    -1,    -1,    -1,    -1}},
+    {0x0D7E00, {  931,    -1,    -1,    -1,    -1}},
+    {0x0D7F00, { 1059,    -1,    -1,    -1,    -1}},
+    {0x0D7F01, { 2604,    -1,    -1,    -1,    -1}},
+    {0x0D8000, {   -1,    -1,    -1,    -1,    27}},
+    {0x0D8001, {   -1,    -1,    -1,    -1,   175}},
+    {0x0D8002, {   -1,    -1,   526,    -1,    -1}},
+    {0x0D8003, {   -1,    -1,  6274,    -1,    -1}},
+    {0x0D8004, {   -1,    -1,   856,    -1,    -1}},
+    {0x0D8005, {   -1,    -1,  6525,    -1,    -1}},
+    {0x0D8006, {   -1,    -1,  1072,    -1,    -1}},
+    {0x0D8007, {   -1,    -1,  6988,    -1,    -1}},
+    {0x0D8008, {   -1,    -1,  1242,    -1,    -1}},
+    {0x0D8009, {   -1,    -1,  8414,    -1,    -1}},
+    {0x0D800A, {   -1,    -1,  1383,    -1,    -1}},
+    {0x0D8010, {   -1,    57,  1672,    -1,    -1}},
+    {0x0D8012, {   -1,    -1,  2073,    -1,    -1}},
+    {0x0D8020, {   -1,    -1,  2627,    -1,    -1}},
+    {0x0D8022, {   -1,    -1,  2854,    -1,    -1}},
+    {0x0D8024, {   -1,    -1,  2965,    -1,    -1}},
+    {0x0D8026, {   -1,    -1,  3031,    -1,    -1}},
+    {0x0D8028, {   -1,    -1,  3081,    -1,    -1}},
+    {0x0D802A, {   -1,    -1,  3114,    -1,    -1}},
+    {0x0D802C, {   -1,    -1,  3140,    -1,    -1}},
+    {0x0D802E, {   -1,    -1,  3168,    -1,    -1}},
+    {0x0D8030, {   -1,    -1,  3206,    -1,    -1}},
+    {0x0D8032, {   -1,    -1,  3332,    -1,    -1}},
+    {0x0D80F1, {   -1,    -1,    -1,   256,    -1}},
+    {0x0D80F2, {   -1,    -1,    -1,    27,    -1}},
+    {0x0D8100, {   -1,    -1,    27,    -1,    -1}},
+    {0x0D8101, {   -1,    -1,  4031,    -1,    -1}},
+    {0x0D8109, {   -1,    -1,  8534,    -1,    -1}},
+    {0x0D8110, {   -1,    -1,  1772,    -1,    -1}},
+    {0x0D81F2, {   -1,    -1,    -1,   147,    -1}},
+    {0x0D81FC, {   -1,    -1,  3841,    -1,    -1}},
+    {0x0D81FE, {   -1,    -1,  3905,    -1,    -1}},
+    {0x0D8200, {   -1,    -1,   155,    -1,    -1}},
+    {0x0D8201, { 1571,    -1,  4132,    -1,    -1}},
+    {0x0D8209, {   -1,    -1,  8635,    -1,    -1}},
+    {0x0D8210, {   -1,    -1,  1811,    -1,    -1}},
+    {0x0D82F2, {   -1,    -1,    -1,   202,    -1}},
+    {0x0D8300, {   -1,    -1,   283,    -1,    -1}},
+    {0x0D8301, { 1621,    -1,    -1,    -1,    -1}},
+    {0x0D8302, {   -1,    -1,   684,    -1,    -1}},
+    {0x0D8304, {   -1,    -1,   952,    -1,    -1}},
+    {0x0D8306, {   -1,    -1,  1147,    -1,    -1}},
+    {0x0D8308, {   -1,    -1,  1307,    -1,    -1}},
+    {0x0D8310, {   -1,    -1,  1877,    -1,    -1}},
+    {0x0D8312, {   -1,    -1,  2158,    -1,    -1}},
+    {0x0D8320, {   -1,    -1,  2734,    -1,    -1}},
+    {0x0D8322, {   -1,    -1,  2900,    -1,    -1}},
+    {0x0D8324, {   -1,    -1,  2993,    -1,    -1}},
+    {0x0D8326, {   -1,    -1,  3053,    -1,    -1}},
+    {0x0D8400, {   -1,    -1,   411,    -1,    -1}},
+    {0x0D8401, { 1683,    -1,    -1,    -1,    -1}},
+    {0x0D8402, {   -1,    -1,   769,    -1,    -1}},
+    {0x0D8404, {   -1,    -1,  1008,    -1,    -1}},
+    {0x0D8406, {   -1,    -1,  1186,    -1,    -1}},
+    {0x0D8408, {   -1,    -1,  1333,    -1,    -1}},
+    {0x0D840A, {   -1,    -1,  1459,    -1,    -1}},
+    {0x0D8410, {   -1,    -1,  1979,    -1,    -1}},
+    {0x0D8412, {   -1,    -1,  2212,    -1,    -1}},
+    {0x0D8420, {   -1,    -1,  2796,    -1,    -1}},
+    {0x0D8422, {   -1,    -1,  2929,    -1,    -1}},
+    {0x0D8424, {   -1,    -1,  3009,    -1,    -1}},
+    {0x0D8426, {   -1,    -1,  3062,    -1,    -1}},
+    {0x0D8428, {   -1,    -1,  3100,    -1,    -1}},
+    {0x0D842A, {   -1,    -1,  3128,    -1,    -1}},
+    {0x0D842C, {   -1,    -1,  3155,    -1,    -1}},
+    {0x0D842E, {   -1,    -1,  3182,    -1,    -1}},
+    {0x0D8430, {   -1,    -1,  3296,    -1,    -1}},
+    {0x0D8432, {   -1,    -1,  3371,    -1,    -1}},
+    {0x0D8501, { 1732,    -1,    -1,    -1,    -1}},
+    {0x0D8601, { 1780,    -1,    -1,    -1,    -1}},
+    {0x0D8701, { 1826,    -1,    -1,    -1,    -1}},
+    {0x0D8901, { 1882,    -1,  4271,    -1,    -1}},
+    {0x0D8907, {   -1,    -1,  7186,    -1,    -1}},
+    {0x0D8909, {   -1,    -1,  8774,    -1,    -1}},
+    {0x0D9101, { 1932,    -1,    -1,    -1,    -1}},
+    {0x0D9A01, { 2015,    -1,    -1,    -1,    -1}},
+    {0x0D9C01, { 2090,    -1,    -1,    -1,    -1}},
+    {0x0D9D01, { 2134,    -1,    -1,    -1,    -1}},
+    {0x0D9E01, { 2177,    -1,    -1,    -1,    -1}},
+    {0x0D9F01, { 2224,    -1,    -1,    -1,    -1}},
+    {0x0DA000, {  120,    -1,    -1,    -1,    -1}},
+    {0x0DA001, {   -1,    -1,  4932,    -1,    -1}},
+    {0x0DA007, {   -1,    -1,  7690,    -1,    -1}},
+    {0x0DA009, {   -1,    -1,  9435,    -1,    -1}},
+    {0x0DA100, {  135,    -1,    -1,    -1,    -1}},
+    {0x0DA101, { 2280,    -1,    -1,    -1,    -1}},
+    {0x0DA801, {   -1,    -1,  5100,    -1,    -1}},
+    {0x0DA809, {   -1,    -1,  9603,    -1,    -1}},
+    {0x0DB001, {   -1,   148,  5296,    -1,    -1}},
+    {0x0DB003, {   -1,    -1,  6385,    -1,    -1}},
+    {0x0DB005, {   -1,    -1,  6698,    -1,    -1}},
+    {0x0DB007, {   -1,    -1,  7832,    -1,    -1}},
+    {0x0DB009, {   -1,    -1,  9799,    -1,    -1}},
+    {0x0DB0F1, {   -1,    -1,    -1,   367,    -1}},
+    {0x0DB101, {   -1,    -1,  5377,    -1,    -1}},
+    {0x0DB105, {   -1,    -1,  6725,    -1,    -1}},
+    {0x0DB107, {   -1,    -1,  7913,    -1,    -1}},
+    {0x0DB109, {   -1,    -1,  9880,    -1,    -1}},
+    {0x0DB201, {   -1,    -1,  5452,    -1,    -1}},
+    {0x0DB207, {   -1,    -1,  7988,    -1,    -1}},
+    {0x0DB209, {   -1,    -1,  9955,    -1,    -1}},
+    {0x0DB301, {   -1,    -1,  5539,    -1,    -1}},
+    {0x0DB309, {   -1,    -1, 10042,    -1,    -1}},
+    {0x0DB401, {   -1,    -1,  5626,    -1,    -1}},
+    {0x0DB407, {   -1,    -1,  8075,    -1,    -1}},
+    {0x0DB409, {   -1,    -1, 10129,    -1,    -1}},
+    {0x0DB801, { 2372,    -1,  5814,    -1,    -1}},
+    {0x0DB807, {   -1,    -1,  8208,    -1,    -1}},
+    {0x0DB809, {   -1,    -1, 10317,    -1,    -1}},
+    {0x0DB901, { 2401,    -1,    -1,    -1,    -1}},
+    {0x0DBB01, {   -1,    -1,  6003,    -1,    -1}},
+    {0x0DBB09, {   -1,    -1, 10506,    -1,    -1}},
+    {0x0DC000, {  294,    -1,    -1,    -1,    -1}},
+    {0x0DC001, { 2430,    -1,    -1,    -1,    -1}},
+    {0x0DC100, {  386,    -1,    -1,    -1,    -1}},
+    {0x0DC101, { 2480,    -1,    -1,    -1,    -1}},
+    {0x0DC200, {  464,    -1,    -1,    -1,    -1}},
+    {0x0DC201, { 2528,    -1,    -1,    -1,    -1}},
+    {0x0DC300, {  532,    -1,    -1,    -1,    -1}},
+    {0x0DC400, {  585,    -1,    -1,    -1,    -1}},
+    {0x0DC500, {  621,    -1,    -1,    -1,    -1}},
+    {0x0DC600, {  651,    -1,    -1,    -1,    -1}},
+    {0x0DC700, {  680,    -1,    -1,    -1,    -1}},
+    {0x0DC800, {  704,    -1,    -1,    -1,    -1}},
+    {0x0DC900, {  723,    -1,    -1,    -1,    -1}},
+    {0x0DCA00, {  741,    -1,    -1,    -1,    -1}},
+    {0x0DCB00, {  756,    -1,    -1,    -1,    -1}},
+    {0x0DCC00, {  770,    -1,    -1,    -1,    -1}},
+    {0x0DFE00, {  932,    -1,    -1,    -1,    -1}},
+    {0x0DFF00, { 1060,    -1,    -1,    -1,    -1}},
+    {0x0DFF01, { 2605,    -1,    -1,    -1,    -1}},
+    {0x0E0000, {   -1,    -1,    -1,    -1,    28}},
+    {0x0E0001, {   -1,    -1,    -1,    -1,   176}},
+    {0x0E0002, {   -1,    -1,   527,    -1,    -1}},
+    {0x0E0003, { 1320,    -1,  6275,    -1,    -1}},
+    {0x0E0004, {   -1,    -1,   857,    -1,    -1}},
+    {0x0E0005, {   -1,    -1,  6526,    -1,    -1}},
+    {0x0E0007, {   -1,    -1,  6989,    -1,    -1}},
+    {0x0E0009, {   -1,    -1,  8415,    -1,    -1}},
+    {0x0E0010, {   -1,    58,  1673,    -1,    -1}},
+    {0x0E0020, {   -1,    88,  2628,    -1,    -1}},
+    {0x0E0030, {   -1,    -1,  3207,    -1,    -1}},
+    {0x0E00F1, {   -1,    -1,    -1,   257,    -1}},
+    {0x0E00F2, {   -1,    -1,    -1,    28,    -1}},
+    {0x0E0100, {   -1,    -1,    28,    -1,    -1}},
+    {0x0E0101, {   -1,    -1,  4032,    -1,    -1}},
+    {0x0E0109, {   -1,    -1,  8535,    -1,    -1}},
+    {0x0E0110, {   -1,    -1,  1773,    -1,    -1}},
+    {0x0E0120, {   -1,    -1,  2686,    -1,    -1}},
+    {0x0E01F2, {   -1,    -1,    -1,   148,    -1}},
+    {0x0E01FC, {   -1,    -1,  3842,    -1,    -1}},
+    {0x0E01FE, {   -1,    -1,  3906,    -1,    -1}},
+    {0x0E0200, {   -1,    -1,   156,    -1,    -1}},
+    {0x0E0201, { 1572,    -1,  4133,    -1,    -1}},
+    {0x0E0202, {   -1,    -1,   628,    -1,    -1}},
+    {0x0E0209, {   -1,    -1,  8636,    -1,    -1}},
+    {0x0E0210, {   -1,    -1,  1812,    -1,    -1}},
+    {0x0E0220, {   -1,    -1,  2700,    -1,    -1}},
+    {0x0E02F2, {   -1,    -1,    -1,   203,    -1}},
+    {0x0E0300, {   -1,    -1,   284,    -1,    -1}},
+    {0x0E0301, { 1622,    -1,    -1,    -1,    -1}},
+    {0x0E0302, {   -1,    -1,   685,    -1,    -1}},
+    {0x0E0304, {   -1,    -1,   953,    -1,    -1}},
+    {0x0E0310, {   -1,    -1,  1878,    -1,    -1}},
+    {0x0E0320, {   -1,    -1,  2735,    -1,    -1}},
+    {0x0E03F2, {   -1,    -1,    -1,   229,    -1}},
+    {0x0E0400, {   -1,    -1,   412,    -1,    -1}},
+    {0x0E0401, { 1684,    -1,    -1,    -1,    -1}},
+    {0x0E0402, {   -1,    -1,   770,    -1,    -1}},
+    {0x0E0404, {   -1,    -1,  1009,    -1,    -1}},
+    {0x0E0410, {   -1,    -1,  1980,    -1,    -1}},
+    {0x0E0420, {   -1,    -1,  2797,    -1,    -1}},
+    {0x0E0430, {   -1,    -1,  3297,    -1,    -1}},
+    {0x0E0501, { 1733,    -1,    -1,    -1,    -1}},
+    {0x0E0601, { 1781,    -1,    -1,    -1,    -1}},
+    {0x0E0701, { 1827,    -1,    -1,    -1,    -1}},
+    {0x0E0901, { 1883,    -1,  4272,    -1,    -1}},
+    {0x0E0907, {   -1,    -1,  7187,    -1,    -1}},
+    {0x0E0909, {   -1,    -1,  8775,    -1,    -1}},
+    {0x0E1101, { 1933,    -1,    -1,    -1,    -1}},
+    {0x0E1801, { 1968,    -1,    -1,    -1,    -1}},
+    {0x0E1901, { 1984,    -1,    -1,    -1,    -1}},
+    {0x0E1A01, { 2016,    -1,    -1,    -1,    -1}},
+    {0x0E1B01, { 2058,    -1,    -1,    -1,    -1}},
+    {0x0E1C01, { 2091,    -1,    -1,    -1,    -1}},
+    {0x0E1D01, { 2135,    -1,    -1,    -1,    -1}},
+    {0x0E1E01, { 2178,    -1,    -1,    -1,    -1}},
+    {0x0E1F01, { 2225,    -1,    -1,    -1,    -1}},
+    {0x0E2001, {   -1,    -1,  4933,    -1,    -1}},
+    {0x0E2007, {   -1,    -1,  7691,    -1,    -1}},
+    {0x0E2009, {   -1,    -1,  9436,    -1,    -1}},
+    {0x0E2101, { 2281,    -1,    -1,    -1,    -1}},
+    {0x0E2800, {  185,    -1,    -1,    -1,    -1}},
+    {0x0E2801, {   -1,    -1,  5101,    -1,    -1}},
+    {0x0E2809, {   -1,    -1,  9604,    -1,    -1}},
+    {0x0E2900, {  225,    -1,    -1,    -1,    -1}},
+    {0x0E2901, { 2324,    -1,    -1,    -1,    -1}},
+    {0x0E2B00, {  250,    -1,    -1,    -1,    -1}},
+    {0x0E2D00, {  261,    -1,    -1,    -1,    -1}},
+    {0x0E3001, {   -1,   149,  5297,    -1,    -1}},
+    {0x0E3003, {   -1,    -1,  6386,    -1,    -1}},
+    {0x0E3005, {   -1,    -1,  6699,    -1,    -1}},
+    {0x0E3007, {   -1,    -1,  7833,    -1,    -1}},
+    {0x0E3009, {   -1,    -1,  9800,    -1,    -1}},
+    {0x0E30F1, {   -1,    -1,    -1,   368,    -1}},
+    {0x0E3101, {   -1,    -1,  5378,    -1,    -1}},
+    {0x0E3105, {   -1,    -1,  6726,    -1,    -1}},
+    {0x0E3107, {   -1,    -1,  7914,    -1,    -1}},
+    {0x0E3109, {   -1,    -1,  9881,    -1,    -1}},
+    {0x0E3201, {   -1,    -1,  5453,    -1,    -1}},
+    {0x0E3207, {   -1,    -1,  7989,    -1,    -1}},
+    {0x0E3209, {   -1,    -1,  9956,    -1,    -1}},
+    {0x0E3301, {   -1,    -1,  5540,    -1,    -1}},
+    {0x0E3309, {   -1,    -1, 10043,    -1,    -1}},
+    {0x0E3401, {   -1,    -1,  5627,    -1,    -1}},
+    {0x0E3407, {   -1,    -1,  8076,    -1,    -1}},
+    {0x0E3409, {   -1,    -1, 10130,    -1,    -1}},
+    {0x0E3801, { 2373,    -1,  5815,    -1,    -1}},
+    {0x0E3807, {   -1,    -1,  8209,    -1,    -1}},
+    {0x0E3809, {   -1,    -1, 10318,    -1,    -1}},
+    {0x0E3901, { 2402,    -1,    -1,    -1,    -1}},
+    {0x0E3B01, {   -1,    -1,  6004,    -1,    -1}},
+    {0x0E3B09, {   -1,    -1, 10507,    -1,    -1}},
+    {0x0E4000, {  295,    -1,    -1,    -1,    -1}},
+    {0x0E4001, { 2431,    -1,    -1,    -1,    -1}},
+    {0x0E4100, {  387,    -1,    -1,    -1,    -1}},
+    {0x0E4101, { 2481,    -1,    -1,    -1,    -1}},
+    {0x0E4200, {  465,    -1,    -1,    -1,    -1}},
+    {0x0E4201, { 2529,    -1,    -1,    -1,    -1}},
+    {0x0E4300, {  533,    -1,    -1,    -1,    -1}},
+    {0x0E4400, {  586,    -1,    -1,    -1,    -1}},
+    {0x0E6000, {  845,    -1,    -1,    -1,    -1}},
+    {0x0E7E00, {  933,    -1,    -1,    -1,    -1}},
+    {0x0E7F00, { 1061,    -1,    -1,    -1,    -1}},
+    {0x0E7F01, { 2606,    -1,    -1,    -1,    -1}},
+    {0x0E8000, {   -1,    -1,    -1,    -1,    29}},
+    {0x0E8001, {   -1,    -1,    -1,    -1,   177}},
+    {0x0E8002, {   -1,    -1,   528,    -1,    -1}},
+    {0x0E8003, { 1321,    -1,  6276,    -1,    -1}},
+    {0x0E8004, {   -1,    -1,   858,    -1,    -1}},
+    {0x0E8005, {   -1,    -1,  6527,    -1,    -1}},
+    {0x0E8006, {   -1,    -1,  1073,    -1,    -1}},
+    {0x0E8007, {   -1,    -1,  6990,    -1,    -1}},
+    {0x0E8008, {   -1,    -1,  1243,    -1,    -1}},
+    {0x0E8009, {   -1,    -1,  8416,    -1,    -1}},
+    {0x0E800A, {   -1,    -1,  1384,    -1,    -1}},
+    {0x0E8010, {   -1,    -1,  1674,    -1,    -1}},
+    {0x0E8012, {   -1,    -1,  2074,    -1,    -1}},
+    {0x0E8014, {   -1,    -1,  2273,    -1,    -1}},
+    {0x0E8016, {   -1,    -1,  2382,    -1,    -1}},
+    {0x0E8018, {   -1,    -1,  2461,    -1,    -1}},
+    {0x0E80F1, {   -1,    -1,    -1,   258,    -1}},
+    {0x0E80F2, {   -1,    -1,    -1,    29,    -1}},
+    {0x0E8100, {   -1,    -1,    29,    -1,    -1}},
+    {0x0E8101, { 1560,    -1,  4033,    -1,    -1}},
+    {0x0E8107, {   -1,    -1,  7082,    -1,    -1}},
+    {0x0E8109, {   -1,    -1,  8536,    -1,    -1}},
+    {0x0E81F2, {   -1,    -1,    -1,   149,    -1}},
+    {0x0E81FC, {   -1,    -1,  3843,    -1,    -1}},
+    {0x0E81FE, {   -1,    -1,  3907,    -1,    -1}},
+    {0x0E8200, {   -1,    -1,   157,    -1,    -1}},
+    {0x0E8201, { 1573,    -1,  4134,    -1,    -1}},
+    {0x0E8207, {   -1,    -1,  7109,    -1,    -1}},
+    {0x0E8209, {   -1,    -1,  8637,    -1,    -1}},
+    {0x0E8300, {   -1,    -1,   285,    -1,    -1}},
+    {0x0E8301, { 1623,    -1,    -1,    -1,    -1}},
+    {0x0E8302, {   -1,    -1,   686,    -1,    -1}},
+    {0x0E8304, {   -1,    -1,   954,    -1,    -1}},
+    {0x0E8306, {   -1,    -1,  1148,    -1,    -1}},
+    {0x0E8310, {   -1,    -1,  1879,    -1,    -1}},
+    {0x0E8312, {   -1,    -1,  2159,    -1,    -1}},
+    {0x0E8400, {   -1,    -1,   413,    -1,    -1}},
+    {0x0E8401, { 1685,    -1,    -1,    -1,    -1}},
+    {0x0E8402, {   -1,    -1,   771,    -1,    -1}},
+    {0x0E8404, {   -1,    -1,  1010,    -1,    -1}},
+    {0x0E8406, {   -1,    -1,  1187,    -1,    -1}},
+    {0x0E8408, {   -1,    -1,  1334,    -1,    -1}},
+    {0x0E840A, {   -1,    -1,  1460,    -1,    -1}},
+    {0x0E8410, {   -1,    -1,  1981,    -1,    -1}},
+    {0x0E8412, {   -1,    -1,  2213,    -1,    -1}},
+    {0x0E8414, {   -1,    -1,  2343,    -1,    -1}},
+    {0x0E8416, {   -1,    -1,  2430,    -1,    -1}},
+    {0x0E8418, {   -1,    -1,  2495,    -1,    -1}},
+    {0x0E8501, { 1734,    -1,    -1,    -1,    -1}},
+    {0x0E8601, { 1782,    -1,    -1,    -1,    -1}},
+    {0x0E8701, { 1828,    -1,    -1,    -1,    -1}},
+    {0x0E8801, {   -1,    -1,  4221,    -1,    -1}},
+    {0x0E8807, {   -1,    -1,  7136,    -1,    -1}},
+    {0x0E8809, {   -1,    -1,  8724,    -1,    -1}},
+    {0x0E8901, { 1884,    -1,  4273,    -1,    -1}},
+    {0x0E8907, {   -1,    -1,  7188,    -1,    -1}},
+    {0x0E8909, {   -1,    -1,  8776,    -1,    -1}},
+    {0x0E8A01, {   -1,    -1,  4375,    -1,    -1}},
+    {0x0E8A07, {   -1,    -1,  7280,    -1,    -1}},
+    {0x0E8A09, {   -1,    -1,  8878,    -1,    -1}},
+    {0x0E8B01, {   -1,    -1,  4418,    -1,    -1}},
+    {0x0E8B07, {   -1,    -1,  7314,    -1,    -1}},
+    {0x0E8B09, {   -1,    -1,  8921,    -1,    -1}},
+    {0x0E8C01, {   -1,    -1,  4466,    -1,    -1}},
+    {0x0E8C09, {   -1,    -1,  8969,    -1,    -1}},
+    {0x0E8D01, {   -1,    -1,  4518,    -1,    -1}},
+    {0x0E8D09, {   -1,    -1,  9021,    -1,    -1}},
+    {0x0E9001, {   -1,    -1,  4566,    -1,    -1}},
+    {0x0E9007, {   -1,    -1,  7354,    -1,    -1}},
+    {0x0E9009, {   -1,    -1,  9069,    -1,    -1}},
+    {0x0E9101, { 1934,    -1,    -1,    -1,    -1}},
+    {0x0E9801, {   -1,    -1,  4610,    -1,    -1}},
+    {0x0E9805, {   -1,    -1,  6617,    -1,    -1}},
+    {0x0E9807, {   -1,    -1,  7380,    -1,    -1}},
+    {0x0E9809, {   -1,    -1,  9113,    -1,    -1}},
+    {0x0E9901, {   -1,    -1,  4663,    -1,    -1}},
+    {0x0E9905, {   -1,    -1,  6632,    -1,    -1}},
+    {0x0E9907, {   -1,    -1,  7420,    -1,    -1}},
+    {0x0E9909, {   -1,    -1,  9166,    -1,    -1}},
+    {0x0E9A01, { 2017,    -1,  4706,    -1,    -1}},
+    {0x0E9A05, {   -1,    -1,  6655,    -1,    -1}},
+    {0x0E9A07, {   -1,    -1,  7461,    -1,    -1}},
+    {0x0E9A09, {   -1,    -1,  9209,    -1,    -1}},
+    {0x0E9B01, {   -1,    -1,  4748,    -1,    -1}},
+    {0x0E9B07, {   -1,    -1,  7502,    -1,    -1}},
+    {0x0E9B09, {   -1,    -1,  9251,    -1,    -1}},
+    {0x0E9C01, { 2092,    -1,  4789,    -1,    -1}},
+    {0x0E9C07, {   -1,    -1,  7543,    -1,    -1}},
+    {0x0E9C09, {   -1,    -1,  9292,    -1,    -1}},
+    {0x0E9D01, { 2136,    -1,  4830,    -1,    -1}},
+    {0x0E9D07, {   -1,    -1,  7584,    -1,    -1}},
+    {0x0E9D09, {   -1,    -1,  9333,    -1,    -1}},
+    {0x0E9E01, {   -1,    -1,  4871,    -1,    -1}},
+    {0x0E9E07, {   -1,    -1,  7625,    -1,    -1}},
+    {0x0E9E09, {   -1,    -1,  9374,    -1,    -1}},
+    {0x0EA000, {  121,    -1,    -1,    -1,    -1}},
+    {0x0EA001, {   -1,    -1,  4934,    -1,    -1}},
+    {0x0EA007, {   -1,    -1,  7692,    -1,    -1}},
+    {0x0EA009, {   -1,    -1,  9437,    -1,    -1}},
+    {0x0EA101, { 2282,    -1,  5025,    -1,    -1}},
+    {0x0EA109, {   -1,    -1,  9528,    -1,    -1}},
+    {0x0EA800, {  186,    -1,    -1,    -1,    -1}},
+    {0x0EA801, {   -1,    -1,  5102,    -1,    -1}},
+    {0x0EA807, {   -1,    -1,  7781,    -1,    -1}},
+    {0x0EA809, {   -1,    -1,  9605,    -1,    -1}},
+    {0x0EA901, { 2325,    -1,  5193,    -1,    -1}},
+    {0x0EA909, {   -1,    -1,  9696,    -1,    -1}},
+    {0x0EAA01, {   -1,    -1,  5222,    -1,    -1}},
+    {0x0EAA09, {   -1,    -1,  9725,    -1,    -1}},
+    {0x0EAB00, {  251,    -1,    -1,    -1,    -1}},
+    {0x0EB001, {   -1,   150,  5298,    -1,    -1}},
+    {0x0EB003, {   -1,    -1,  6387,    -1,    -1}},
+    {0x0EB005, {   -1,    -1,  6700,    -1,    -1}},
+    {0x0EB007, {   -1,    -1,  7834,    -1,    -1}},
+    {0x0EB009, {   -1,    -1,  9801,    -1,    -1}},
+    {0x0EB0F1, {   -1,    -1,    -1,   369,    -1}},
+    {0x0EB101, {   -1,    -1,  5379,    -1,    -1}},
+    {0x0EB105, {   -1,    -1,  6727,    -1,    -1}},
+    {0x0EB107, {   -1,    -1,  7915,    -1,    -1}},
+    {0x0EB109, {   -1,    -1,  9882,    -1,    -1}},
+    {0x0EB201, {   -1,    -1,  5454,    -1,    -1}},
+    {0x0EB207, {   -1,    -1,  7990,    -1,    -1}},
+    {0x0EB209, {   -1,    -1,  9957,    -1,    -1}},
+    {0x0EB301, {   -1,    -1,  5541,    -1,    -1}},
+    {0x0EB309, {   -1,    -1, 10044,    -1,    -1}},
+    {0x0EB401, {   -1,    -1,  5628,    -1,    -1}},
+    {0x0EB407, {   -1,    -1,  8077,    -1,    -1}},
+    {0x0EB409, {   -1,    -1, 10131,    -1,    -1}},
+    {0x0EB801, { 2374,    -1,  5816,    -1,    -1}},
+    {0x0EB807, {   -1,    -1,  8210,    -1,    -1}},
+    {0x0EB809, {   -1,    -1, 10319,    -1,    -1}},
+    {0x0EB901, { 2403,    -1,    -1,    -1,    -1}},
+    {0x0EBB01, {   -1,    -1,  6005,    -1,    -1}},
+    {0x0EBB09, {   -1,    -1, 10508,    -1,    -1}},
+    {0x0EC000, {  296,    -1,    -1,    -1,    -1}},
+    {0x0EC001, { 2432,    -1,    -1,    -1,    -1}},
+    {0x0EC100, {  388,    -1,    -1,    -1,    -1}},
+    {0x0EC101, { 2482,    -1,    -1,    -1,    -1}},
+    {0x0EC200, {  466,    -1,    -1,    -1,    -1}},
+    {0x0EC201, { 2530,    -1,    -1,    -1,    -1}},
+    {0x0EC300, {  534,    -1,    -1,    -1,    -1}},
+    {0x0EFE00, {  934,    -1,    -1,    -1,    -1}},
+    {0x0EFF00, { 1062,    -1,    -1,    -1,    -1}},
+    {0x0EFF01, { 2607,    -1,    -1,    -1,    -1}},
+    {0x0F0000, {   -1,    -1,    -1,    -1,    30}},
+    {0x0F0001, { 1541,    -1,    -1,    -1,   178}},
+    {0x0F0002, {   -1,    -1,   529,    -1,    -1}},
+    {0x0F0003, {   -1,    -1,  6277,    -1,    -1}},
+    {0x0F0004, {   -1,    -1,   859,    -1,    -1}},
+    {0x0F0005, {   -1,    -1,  6528,    -1,    -1}},
+    {0x0F0006, {   -1,    -1,  1074,    -1,    -1}},
+    {0x0F0007, {   -1,    -1,  6991,    -1,    -1}},
+    {0x0F0008, {   -1,    -1,  1244,    -1,    -1}},
+    {0x0F0009, {   -1,    -1,  8417,    -1,    -1}},
+    {0x0F000A, {   -1,    -1,  1385,    -1,    -1}},
+    {0x0F0010, {   -1,    59,  1675,    -1,    -1}},
+    {0x0F0012, {   -1,    -1,  2075,    -1,    -1}},
+    {0x0F0020, {   -1,    -1,  2629,    -1,    -1}},
+    {0x0F0022, {   -1,    -1,  2855,    -1,    -1}},
+    {0x0F0024, {   -1,    -1,  2966,    -1,    -1}},
+    {0x0F0030, {   -1,    -1,  3208,    -1,    -1}},
+    {0x0F0032, {   -1,    -1,  3333,    -1,    -1}},
+    {0x0F0034, {   -1,    -1,  3393,    -1,    -1}},
+    {0x0F00F1, {   -1,    -1,    -1,   259,    -1}},
+    {0x0F00F2, {   -1,    -1,    -1,    30,    -1}},
+    {0x0F0100, {   -1,    -1,    30,    -1,    -1}},
+    {0x0F0101, {   -1,    -1,  4034,    -1,    -1}},
+    {0x0F0107, {   -1,    -1,  7083,    -1,    -1}},
+    {0x0F0109, {   -1,    -1,  8537,    -1,    -1}},
+    {0x0F0110, {   -1,    -1,  1774,    -1,    -1}},
+    {0x0F01F2, {   -1,    -1,    -1,   150,    -1}},
+    {0x0F01FC, {   -1,    -1,  3844,    -1,    -1}},
+    {0x0F01FE, {   -1,    -1,  3908,    -1,    -1}},
+    {0x0F0200, {   -1,    -1,   158,    -1,    -1}},
+    {0x0F0201, {   -1,    -1,  4135,    -1,    -1}},
+    {0x0F0202, {   -1,    -1,   629,    -1,    -1}},
+    {0x0F0204, {   -1,    -1,   926,    -1,    -1}},
+    {0x0F0207, {   -1,    -1,  7110,    -1,    -1}},
+    {0x0F0209, {   -1,    -1,  8638,    -1,    -1}},
+    {0x0F0210, {   -1,    -1,  1813,    -1,    -1}},
+    {0x0F0212, {   -1,    -1,  2135,    -1,    -1}},
+    {0x0F0220, {   -1,    -1,  2701,    -1,    -1}},
+    {0x0F0222, {   -1,    -1,  2889,    -1,    -1}},
+    {0x0F0224, {   -1,    -1,  2987,    -1,    -1}},
+    {0x0F0230, {   -1,    -1,  3248,    -1,    -1}},
+    {0x0F0232, {   -1,    -1,  3352,    -1,    -1}},
+    {0x0F02F2, {   -1,    -1,    -1,   204,    -1}},
+    {0x0F0300, {   -1,    -1,   286,    -1,    -1}},
+    {0x0F0301, { 1624,    -1,    -1,    -1,    -1}},
+    {0x0F0302, {   -1,    -1,   687,    -1,    -1}},
+    {0x0F0304, {   -1,    -1,   955,    -1,    -1}},
+    {0x0F0306, {   -1,    -1,  1149,    -1,    -1}},
+    {0x0F0308, {   -1,    -1,  1308,    -1,    -1}},
+    {0x0F0310, {   -1,    -1,  1880,    -1,    -1}},
+    {0x0F0312, {   -1,    -1,  2160,    -1,    -1}},
+    {0x0F0320, {   -1,    -1,  2736,    -1,    -1}},
+    {0x0F0322, {   -1,    -1,  2901,    -1,    -1}},
+    {0x0F0324, {   -1,    -1,  2994,    -1,    -1}},
+    {0x0F0330, {   -1,    -1,  3265,    -1,    -1}},
+    {0x0F0332, {   -1,    -1,  3358,    -1,    -1}},
+    {0x0F0400, {   -1,    -1,   414,    -1,    -1}},
+    {0x0F0401, { 1686,    -1,    -1,    -1,    -1}},
+    {0x0F0402, {   -1,    -1,   772,    -1,    -1}},
+    {0x0F0404, {   -1,    -1,  1011,    -1,    -1}},
+    {0x0F0406, {   -1,    -1,  1188,    -1,    -1}},
+    {0x0F0408, {   -1,    -1,  1335,    -1,    -1}},
+    {0x0F040A, {   -1,    -1,  1461,    -1,    -1}},
+    {0x0F0410, {   -1,    -1,  1982,    -1,    -1}},
+    {0x0F0412, {   -1,    -1,  2214,    -1,    -1}},
+    {0x0F0420, {   -1,    -1,  2798,    -1,    -1}},
+    {0x0F0422, {   -1,    -1,  2930,    -1,    -1}},
+    {0x0F0424, {   -1,    -1,  3010,    -1,    -1}},
+    {0x0F0430, {   -1,    -1,  3298,    -1,    -1}},
+    {0x0F0432, {   -1,    -1,  3372,    -1,    -1}},
+    {0x0F0434, {   -1,    -1,  3418,    -1,    -1}},
+    {0x0F0501, { 1735,    -1,    -1,    -1,    -1}},
+    {0x0F0601, { 1783,    -1,    -1,    -1,    -1}},
+    {0x0F0701, { 1829,    -1,    -1,    -1,    -1}},
+    {0x0F0801, {   -1,    -1,  4222,    -1,    -1}},
+    {0x0F0807, {   -1,    -1,  7137,    -1,    -1}},
+    {0x0F0809, {   -1,    -1,  8725,    -1,    -1}},
+    {0x0F0901, {   -1,    -1,  4274,    -1,    -1}},
+    {0x0F0907, {   -1,    -1,  7189,    -1,    -1}},
+    {0x0F0909, {   -1,    -1,  8777,    -1,    -1}},
+    {0x0F0A01, {   -1,    -1,  4376,    -1,    -1}},
+    {0x0F0A07, {   -1,    -1,  7281,    -1,    -1}},
+    {0x0F0A09, {   -1,    -1,  8879,    -1,    -1}},
+    {0x0F0B01, {   -1,    -1,  4419,    -1,    -1}},
+    {0x0F0B07, {   -1,    -1,  7315,    -1,    -1}},
+    {0x0F0B09, {   -1,    -1,  8922,    -1,    -1}},
+    {0x0F0C00, {   32,    -1,    -1,    -1,    -1}},
+    {0x0F0C01, {   -1,    -1,  4467,    -1,    -1}},
+    {0x0F0C09, {   -1,    -1,  8970,    -1,    -1}},
+    {0x0F0D01, {   -1,    -1,  4519,    -1,    -1}},
+    {0x0F0D09, {   -1,    -1,  9022,    -1,    -1}},
+    {0x0F1001, {   -1,    -1,  4567,    -1,    -1}},
+    {0x0F1007, {   -1,    -1,  7355,    -1,    -1}},
+    {0x0F1009, {   -1,    -1,  9070,    -1,    -1}},
+    {0x0F1800, {   82,    -1,    -1,    -1,    -1}},
+    {0x0F1801, { 1969,    -1,  4611,    -1,    -1}},
+    {0x0F1805, {   -1,    -1,  6618,    -1,    -1}},
+    {0x0F1807, {   -1,    -1,  7381,    -1,    -1}},
+    {0x0F1809, {   -1,    -1,  9114,    -1,    -1}},
+    {0x0F1901, { 1985,    -1,  4664,    -1,    -1}},
+    {0x0F1905, {   -1,    -1,  6633,    -1,    -1}},
+    {0x0F1907, {   -1,    -1,  7421,    -1,    -1}},
+    {0x0F1909, {   -1,    -1,  9167,    -1,    -1}},
+    {0x0F1A01, { 2018,    -1,  4707,    -1,    -1}},
+    {0x0F1A05, {   -1,    -1,  6656,    -1,    -1}},
+    {0x0F1A07, {   -1,    -1,  7462,    -1,    -1}},
+    {0x0F1A09, {   -1,    -1,  9210,    -1,    -1}},
+    {0x0F1B01, { 2059,    -1,  4749,    -1,    -1}},
+    {0x0F1B07, {   -1,    -1,  7503,    -1,    -1}},
+    {0x0F1B09, {   -1,    -1,  9252,    -1,    -1}},
+    {0x0F1C01, {   -1,    -1,  4790,    -1,    -1}},
+    {0x0F1C07, {   -1,    -1,  7544,    -1,    -1}},
+    {0x0F1C09, {   -1,    -1,  9293,    -1,    -1}},
+    {0x0F1D01, {   -1,    -1,  4831,    -1,    -1}},
+    {0x0F1D07, {   -1,    -1,  7585,    -1,    -1}},
+    {0x0F1D09, {   -1,    -1,  9334,    -1,    -1}},
+    {0x0F1E01, { 2179,    -1,  4872,    -1,    -1}},
+    {0x0F1E07, {   -1,    -1,  7626,    -1,    -1}},
+    {0x0F1E09, {   -1,    -1,  9375,    -1,    -1}},
+    {0x0F1F01, { 2226,    -1,    -1,    -1,    -1}},
+    {0x0F2001, {   -1,    -1,  4935,    -1,    -1}},
+    {0x0F2007, {   -1,    -1,  7693,    -1,    -1}},
+    {0x0F2009, {   -1,    -1,  9438,    -1,    -1}},
+    {0x0F2101, {   -1,    -1,  5026,    -1,    -1}},
+    {0x0F2109, {   -1,    -1,  9529,    -1,    -1}},
+    {0x0F2300, {  146,    -1,    -1,    -1,    -1}},
+    {0x0F2400, {  159,    -1,    -1,    -1,    -1}},
+    {0x0F2500, {  164,    -1,    -1,    -1,    -1}},
+    {0x0F2600, {  167,    -1,    -1,    -1,    -1}},
+    {0x0F2800, {  187,    -1,    -1,    -1,    -1}},
+    {0x0F2801, {   -1,    -1,  5103,    -1,    -1}},
+    {0x0F2807, {   -1,    -1,  7782,    -1,    -1}},
+    {0x0F2809, {   -1,    -1,  9606,    -1,    -1}},
+    {0x0F2900, {  226,    -1,    -1,    -1,    -1}},
+    {0x0F2901, { 2326,    -1,  5194,    -1,    -1}},
+    {0x0F2909, {   -1,    -1,  9697,    -1,    -1}},
+    {0x0F2A00, {  241,    -1,    -1,    -1,    -1}},
+    {0x0F2A01, {   -1,    -1,  5223,    -1,    -1}},
+    {0x0F2A09, {   -1,    -1,  9726,    -1,    -1}},
+    {0x0F2B00, {  252,    -1,    -1,    -1,    -1}},
+    {0x0F2D00, {  262,    -1,    -1,    -1,    -1}},
+    {0x0F3001, {   -1,   151,  5299,    -1,    -1}},
+    {0x0F3003, {   -1,    -1,  6388,    -1,    -1}},
+    {0x0F3005, {   -1,    -1,  6701,    -1,    -1}},
+    {0x0F3007, {   -1,    -1,  7835,    -1,    -1}},
+    {0x0F3009, {   -1,    -1,  9802,    -1,    -1}},
+    {0x0F30F1, {   -1,    -1,    -1,   370,    -1}},
+    {0x0F3101, {   -1,    -1,  5380,    -1,    -1}},
+    {0x0F3105, {   -1,    -1,  6728,    -1,    -1}},
+    {0x0F3107, {   -1,    -1,  7916,    -1,    -1}},
+    {0x0F3109, {   -1,    -1,  9883,    -1,    -1}},
+    {0x0F3201, {   -1,    -1,  5455,    -1,    -1}},
+    {0x0F3207, {   -1,    -1,  7991,    -1,    -1}},
+    {0x0F3209, {   -1,    -1,  9958,    -1,    -1}},
+    {0x0F3301, {   -1,    -1,  5542,    -1,    -1}},
+    {0x0F3309, {   -1,    -1, 10045,    -1,    -1}},
+    {0x0F3401, {   -1,    -1,  5629,    -1,    -1}},
+    {0x0F3407, {   -1,    -1,  8078,    -1,    -1}},
+    {0x0F3409, {   -1,    -1, 10132,    -1,    -1}},
+    {0x0F3801, {   -1,    -1,  5817,    -1,    -1}},
+    {0x0F3807, {   -1,    -1,  8211,    -1,    -1}},
+    {0x0F3809, {   -1,    -1, 10320,    -1,    -1}},
+    {0x0F3B01, {   -1,    -1,  6006,    -1,    -1}},
+    {0x0F3B09, {   -1,    -1, 10509,    -1,    -1}},
+    {0x0F4000, {  297,    -1,    -1,    -1,    -1}},
+    {0x0F4001, { 2433,    -1,    -1,    -1,    -1}},
+    {0x0F4100, {  389,    -1,    -1,    -1,    -1}},
+    {0x0F4200, {  467,    -1,    -1,    -1,    -1}},
+    {0x0F4300, {  535,    -1,    -1,    -1,    -1}},
+    {0x0F4400, {  587,    -1,    -1,    -1,    -1}},
+    {0x0F4500, {  622,    -1,    -1,    -1,    -1}},
+    {0x0F4600, {  652,    -1,    -1,    -1,    -1}},
+    {0x0F4700, {  681,    -1,    -1,    -1,    -1}},
+    {0x0F7E00, {  935,    -1,    -1,    -1,    -1}},
+    {0x0F7E01, { 2572,    -1,    -1,    -1,    -1}},
+    {0x0F7F00, { 1063,    -1,    -1,    -1,    -1}},
+    {0x0F7F01, { 2608,    -1,    -1,    -1,    -1}},
+    {0x0F8000, {   -1,    -1,    -1,    -1,    31}},
+    {0x0F8001, { 1542,    -1,    -1,    -1,   179}},
+    {0x0F8003, {   -1,    -1,  6278,    -1,    -1}},
+    {0x0F8005, {   -1,    -1,  6529,    -1,    -1}},
+    {0x0F8007, {   -1,    -1,  6992,    -1,    -1}},
+    {0x0F8009, {   -1,    -1,  8418,    -1,    -1}},
+    {0x0F8010, {   -1,    60,  1676,    -1,    -1}},
+    {0x0F8012, {   -1,    -1,  2076,    -1,    -1}},
+    {0x0F8020, {   -1,    -1,  2630,    -1,    -1}},
+    {0x0F8030, {   -1,    -1,  3209,    -1,    -1}},
+    {0x0F80F1, {   -1,    -1,    -1,   260,    -1}},
+    {0x0F80F2, {   -1,    -1,    -1,    31,    -1}},
+    {0x0F8100, {   -1,    -1,    31,    -1,    -1}},
+    {0x0F8101, { 1561,    -1,  4035,    -1,    -1}},
+    {0x0F8109, {   -1,    -1,  8538,    -1,    -1}},
+    {0x0F8110, {   -1,    -1,  1775,    -1,    -1}},
+    {0x0F81F2, {   -1,    -1,    -1,   151,    -1}},
+    {0x0F81FC, {   -1,    -1,  3845,    -1,    -1}},
+    {0x0F81FE, {   -1,    -1,  3909,    -1,    -1}},
+    {0x0F8200, {   -1,    -1,   159,    -1,    -1}},
+    {0x0F8201, { 1574,    -1,  4136,    -1,    -1}},
+    {0x0F8209, {   -1,    -1,  8639,    -1,    -1}},
+    {0x0F8210, {   -1,    -1,  1814,    -1,    -1}},
+    {0x0F8220, {   -1,    -1,  2702,    -1,    -1}},
+    {0x0F8300, {   -1,    -1,   287,    -1,    -1}},
+    {0x0F8301, { 1625,    -1,    -1,    -1,    -1}},
+    {0x0F8310, {   -1,    -1,  1881,    -1,    -1}},
+    {0x0F8312, {   -1,    -1,  2161,    -1,    -1}},
+    {0x0F8320, {   -1,    -1,  2737,    -1,    -1}},
+    {0x0F8330, {   -1,    -1,  3266,    -1,    -1}},
+    {0x0F8400, {   -1,    -1,   415,    -1,    -1}},
+    {0x0F8401, { 1687,    -1,    -1,    -1,    -1}},
+    {0x0F8410, {   -1,    -1,  1983,    -1,    -1}},
+    {0x0F8412, {   -1,    -1,  2215,    -1,    -1}},
+    {0x0F8420, {   -1,    -1,  2799,    -1,    -1}},
+    {0x0F8430, {   -1,    -1,  3299,    -1,    -1}},
+    {0x0F8501, { 1736,    -1,    -1,    -1,    -1}},
+    {0x0F8601, { 1784,    -1,    -1,    -1,    -1}},
+    {0x0F8701, { 1830,    -1,    -1,    -1,    -1}},
+    {0x0F8901, {   -1,    -1,  4275,    -1,    -1}},
+    {0x0F8907, {   -1,    -1,  7190,    -1,    -1}},
+    {0x0F8909, {   -1,    -1,  8778,    -1,    -1}},
+    {0x0F9001, { 1916,    -1,    -1,    -1,    -1}},
+    {0x0F9101, { 1935,    -1,    -1,    -1,    -1}},
+    {0x0F9801, { 1970,    -1,    -1,    -1,    -1}},
+    {0x0F9901, { 1986,    -1,    -1,    -1,    -1}},
+    {0x0F9A01, { 2019,    -1,    -1,    -1,    -1}},
+    {0x0F9B01, { 2060,    -1,    -1,    -1,    -1}},
+    {0x0F9C01, { 2093,    -1,    -1,    -1,    -1}},
+    {0x0F9D01, { 2137,    -1,    -1,    -1,    -1}},
+    {0x0F9E01, { 2180,    -1,    -1,    -1,    -1}},
+    {0x0F9F01, { 2227,    -1,    -1,    -1,    -1}},
+    {0x0FA001, {   -1,    -1,  4936,    -1,    -1}},
+    {0x0FA007, {   -1,    -1,  7694,    -1,    -1}},
+    {0x0FA009, {   -1,    -1,  9439,    -1,    -1}},
+    {0x0FA801, { 2314,    -1,  5104,    -1,    -1}},
+    {0x0FA809, {   -1,    -1,  9607,    -1,    -1}},
+    {0x0FA901, { 2327,    -1,    -1,    -1,    -1}},
+    {0x0FB001, {   -1,    -1,  5300,    -1,    -1}},
+    {0x0FB007, {   -1,    -1,  7836,    -1,    -1}},
+    {0x0FB009, {   -1,    -1,  9803,    -1,    -1}},
+    {0x0FB101, {   -1,    -1,  5381,    -1,    -1}},
+    {0x0FB105, {   -1,    -1,  6729,    -1,    -1}},
+    {0x0FB107, {   -1,    -1,  7917,    -1,    -1}},
+    {0x0FB109, {   -1,    -1,  9884,    -1,    -1}},
+    {0x0FB201, {   -1,    -1,  5456,    -1,    -1}},
+    {0x0FB207, {   -1,    -1,  7992,    -1,    -1}},
+    {0x0FB209, {   -1,    -1,  9959,    -1,    -1}},
+    {0x0FB301, {   -1,    -1,  5543,    -1,    -1}},
+    {0x0FB309, {   -1,    -1, 10046,    -1,    -1}},
+    {0x0FB401, {   -1,    -1,  5630,    -1,    -1}},
+    {0x0FB407, {   -1,    -1,  8079,    -1,    -1}},
+    {0x0FB409, {   -1,    -1, 10133,    -1,    -1}},
+    {0x0FB801, { 2375,    -1,  5818,    -1,    -1}},
+    {0x0FB805, {   -1,    -1,  6850,    -1,    -1}},
+    {0x0FB807, {   -1,    -1,  8212,    -1,    -1}},
+    {0x0FB809, {   -1,    -1, 10321,    -1,    -1}},
+    {0x0FB901, { 2404,    -1,    -1,    -1,    -1}},
+    {0x0FBB01, {   -1,    -1,  6007,    -1,    -1}},
+    {0x0FBB09, {   -1,    -1, 10510,    -1,    -1}},
+    {0x0FBC01, {   -1,    -1,  6096,    -1,    -1}},
+    {0x0FBC09, {   -1,    -1, 10599,    -1,    -1}},
+    {0x0FC000, {  298,    -1,    -1,    -1,    -1}},
+    {0x0FC001, { 2434,    -1,    -1,    -1,    -1}},
+    {0x0FC100, {  390,    -1,    -1,    -1,    -1}},
+    {0x0FC101, { 2483,    -1,    -1,    -1,    -1}},
+    {0x0FC200, {  468,    -1,    -1,    -1,    -1}},
+    {0x0FC201, { 2531,    -1,    -1,    -1,    -1}},
+    {0x0FC300, {  536,    -1,    -1,    -1,    -1}},
+    {0x0FFE00, {  936,    -1,    -1,    -1,    -1}},
+    {0x0FFE01, { 2573,    -1,    -1,    -1,    -1}},
+    {0x0FFF00, { 1064,    -1,    -1,    -1,    -1}},
+    {0x0FFF01, { 2609,    -1,    -1,    -1,    -1}},
+    {0x100000, {   -1,    -1,    -1,    -1,    32}},
+    {0x100001, {   -1,    -1,    -1,    -1,   180}},
+    {0x100002, {   -1,    -1,   530,    -1,    -1}},
+    {0x100003, {   -1,    -1,  6279,    -1,    -1}},
+    {0x100005, {   -1,    -1,  6530,    -1,    -1}},
+    {0x100007, {   -1,    -1,  6993,    -1,    -1}},
+    {0x100009, {   -1,    -1,  8419,    -1,    -1}},
+    {0x100010, {   -1,    -1,  1677,    -1,    -1}},
+    {0x100012, {   -1,    -1,  2077,    -1,    -1}},
+    {0x100020, {   -1,    -1,  2631,    -1,    -1}},
+    {0x100080, { 1269,    -1,    -1,    -1,    -1}},
+    {0x1000F1, {   -1,    -1,    -1,   261,    -1}},
+    {0x1000F2, {   -1,    -1,    -1,    32,    -1}},
+    {0x100100, {   -1,    -1,    32,    -1,    -1}},
+    {0x100101, {   -1,    -1,  4036,    -1,    -1}},
+    {0x100109, {   -1,    -1,  8539,    -1,    -1}},
+    {0x1001FC, {   -1,    -1,  3846,    -1,    -1}},
+    {0x1001FE, {   -1,    -1,  3910,    -1,    -1}},
+    {0x100200, {   -1,    -1,   160,    -1,    -1}},
+    {0x100201, {   -1,    -1,  4137,    -1,    -1}},
+    {0x100209, {   -1,    -1,  8640,    -1,    -1}},
+    {0x100300, {   -1,    -1,   288,    -1,    -1}},
+    {0x100301, { 1626,    -1,    -1,    -1,    -1}},
+    {0x100302, {   -1,    -1,   688,    -1,    -1}},
+    {0x100310, {   -1,    -1,  1882,    -1,    -1}},
+    {0x100320, {   -1,    -1,  2738,    -1,    -1}},
+    {0x100400, {   -1,    -1,   416,    -1,    -1}},
+    {0x100402, {   -1,    -1,   773,    -1,    -1}},
+    {0x100410, {   -1,    -1,  1984,    -1,    -1}},
+    {0x100412, {   -1,    -1,  2216,    -1,    -1}},
+    {0x100420, {   -1,    -1,  2800,    -1,    -1}},
+    {0x100501, { 1737,    -1,    -1,    -1,    -1}},
+    {0x100901, {   -1,    -1,  4276,    -1,    -1}},
+    {0x100907, {   -1,    -1,  7191,    -1,    -1}},
+    {0x100909, {   -1,    -1,  8779,    -1,    -1}},
+    {0x102001, {   -1,    -1,  4937,    -1,    -1}},
+    {0x102007, {   -1,    -1,  7695,    -1,    -1}},
+    {0x102009, {   -1,    -1,  9440,    -1,    -1}},
+    {0x102800, {  188,    -1,    -1,    -1,    -1}},
+    {0x102801, {   -1,    -1,  5105,    -1,    -1}},
+    {0x102809, {   -1,    -1,  9608,    -1,    -1}},
+    {0x102900, {  227,    -1,    -1,    -1,    -1}},
+    {0x102B00, {  253,    -1,    -1,    -1,    -1}},
+    {0x102D00, {  263,    -1,    -1,    -1,    -1}},
+    {0x103001, {   -1,    -1,  5301,    -1,    -1}},
+    {0x103007, {   -1,    -1,  7837,    -1,    -1}},
+    {0x103009, {   -1,    -1,  9804,    -1,    -1}},
+    {0x103101, {   -1,    -1,  5382,    -1,    -1}},
+    {0x103105, {   -1,    -1,  6730,    -1,    -1}},
+    {0x103107, {   -1,    -1,  7918,    -1,    -1}},
+    {0x103109, {   -1,    -1,  9885,    -1,    -1}},
+    {0x103201, {   -1,    -1,  5457,    -1,    -1}},
+    {0x103207, {   -1,    -1,  7993,    -1,    -1}},
+    {0x103209, {   -1,    -1,  9960,    -1,    -1}},
+    {0x103301, {   -1,    -1,  5544,    -1,    -1}},
+    {0x103309, {   -1,    -1, 10047,    -1,    -1}},
+    {0x103401, {   -1,    -1,  5631,    -1,    -1}},
+    {0x103407, {   -1,    -1,  8080,    -1,    -1}},
+    {0x103409, {   -1,    -1, 10134,    -1,    -1}},
+    {0x103501, {   -1,    -1,  5690,    -1,    -1}},
+    {0x103507, {   -1,    -1,  8137,    -1,    -1}},
+    {0x103509, {   -1,    -1, 10193,    -1,    -1}},
+    {0x103801, {   -1,    -1,  5819,    -1,    -1}},
+    {0x103805, {   -1,    -1,  6851,    -1,    -1}},
+    {0x103807, {   -1,    -1,  8213,    -1,    -1}},
+    {0x103809, {   -1,    -1, 10322,    -1,    -1}},
+    {0x103B01, {   -1,    -1,  6008,    -1,    -1}},
+    {0x103B09, {   -1,    -1, 10511,    -1,    -1}},
+    {0x103C01, {   -1,    -1,  6097,    -1,    -1}},
+    {0x103C09, {   -1,    -1, 10600,    -1,    -1}},
+    {0x103E01, {   -1,    -1,  6209,    -1,    -1}},
+    {0x103E09, {   -1,    -1, 10712,    -1,    -1}},
+    {0x104000, {  299,    -1,    -1,    -1,    -1}},
+    {0x104001, { 2435,    -1,    -1,    -1,    -1}},
+    {0x104100, {  391,    -1,    -1,    -1,    -1}},
+    {0x104101, { 2484,    -1,    -1,    -1,    -1}},
+    {0x104200, {  469,    -1,    -1,    -1,    -1}},
+    {0x104201, { 2532,    -1,    -1,    -1,    -1}},
+    {0x104300, {  537,    -1,    -1,    -1,    -1}},
+    {0x106000, {  846,    -1,    -1,    -1,    -1}},
+    {0x106100, {  876,    -1,    -1,    -1,    -1}},
+    {0x107E00, {  937,    -1,    -1,    -1,    -1}},
+    {0x107F00, { 1065,    -1,    -1,    -1,    -1}},
+    {0x107F01, { 2610,    -1,    -1,    -1,    -1}},
+    {0x108000, {   -1,    -1,    -1,    -1,    33}},
+    {0x108001, {   -1,    -1,    -1,    -1,   181}},
+    {0x108002, {   -1,    -1,   531,    -1,    -1}},
+    {0x108003, {   -1,    -1,  6280,    -1,    -1}},
+    {0x108004, {   -1,    -1,   860,    -1,    -1}},
+    {0x108005, {   -1,    -1,  6531,    -1,    -1}},
+    {0x108006, {   -1,    -1,  1075,    -1,    -1}},
+    {0x108007, {   -1,    -1,  6994,    -1,    -1}},
+    {0x108008, {   -1,    -1,  1245,    -1,    -1}},
+    {0x108009, {   -1,    -1,  8420,    -1,    -1}},
+    {0x10800A, {   -1,    -1,  1386,    -1,    -1}},
+    {0x10800C, {   -1,    -1,  1502,    -1,    -1}},
+    {0x10800E, {   -1,    -1,  1588,    -1,    -1}},
+    {0x108010, {   -1,    -1,  1678,    -1,    -1}},
+    {0x108020, {   -1,    -1,  2632,    -1,    -1}},
+    {0x108080, { 1270,    -1,    -1,    -1,    -1}},
+    {0x1080F1, {   -1,    -1,    -1,   262,    -1}},
+    {0x1080F2, {   -1,    -1,    -1,    33,    -1}},
+    {0x108100, {   -1,    -1,    33,    -1,    -1}},
+    {0x108101, {   -1,    -1,  4037,    -1,    -1}},
+    {0x108109, {   -1,    -1,  8540,    -1,    -1}},
+    {0x1081F2, {   -1,    -1,    -1,   152,    -1}},
+    {0x1081FC, {   -1,    -1,  3847,    -1,    -1}},
+    {0x1081FE, {   -1,    -1,  3911,    -1,    -1}},
+    {0x108200, {   -1,    -1,   161,    -1,    -1}},
+    {0x108201, { 1575,    -1,  4138,    -1,    -1}},
+    {0x108202, {   -1,    -1,   630,    -1,    -1}},
+    {0x108204, {   -1,    -1,   927,    -1,    -1}},
+    {0x108209, {   -1,    -1,  8641,    -1,    -1}},
+    {0x108300, {   -1,    -1,   289,    -1,    -1}},
+    {0x108301, { 1627,    -1,    -1,    -1,    -1}},
+    {0x108302, {   -1,    -1,   689,    -1,    -1}},
+    {0x108304, {   -1,    -1,   956,    -1,    -1}},
+    {0x108306, {   -1,    -1,  1150,    -1,    -1}},
+    {0x108308, {   -1,    -1,  1309,    -1,    -1}},
+    {0x108310, {   -1,    -1,  1883,    -1,    -1}},
+    {0x108320, {   -1,    -1,  2739,    -1,    -1}},
+    {0x108400, {   -1,    -1,   417,    -1,    -1}},
+    {0x108401, { 1688,    -1,    -1,    -1,    -1}},
+    {0x108402, {   -1,    -1,   774,    -1,    -1}},
+    {0x108404, {   -1,    -1,  1012,    -1,    -1}},
+    {0x108406, {   -1,    -1,  1189,    -1,    -1}},
+    {0x108408, {   -1,    -1,  1336,    -1,    -1}},
+    {0x10840A, {   -1,    -1,  1462,    -1,    -1}},
+    {0x10840C, {   -1,    -1,  1556,    -1,    -1}},
+    {0x10840E, {   -1,    -1,  1625,    -1,    -1}},
+    {0x108410, {   -1,    -1,  1985,    -1,    -1}},
+    {0x108420, {   -1,    -1,  2801,    -1,    -1}},
+    {0x108501, { 1738,    -1,    -1,    -1,    -1}},
+    {0x108601, { 1785,    -1,    -1,    -1,    -1}},
+    {0x108701, { 1831,    -1,    -1,    -1,    -1}},
+    {0x108901, {   -1,    -1,  4277,    -1,    -1}},
+    {0x108907, {   -1,    -1,  7192,    -1,    -1}},
+    {0x108909, {   -1,    -1,  8780,    -1,    -1}},
+    {0x109001, { 1917,    -1,    -1,    -1,    -1}},
+    {0x109101, { 1936,    -1,    -1,    -1,    -1}},
+    {0x109200, {   54,    -1,    -1,    -1,    -1}},
+    {0x109801, { 1971,    -1,    -1,    -1,    -1}},
+    {0x109901, { 1987,    -1,    -1,    -1,    -1}},
+    {0x109A01, { 2020,    -1,    -1,    -1,    -1}},
+    {0x109B00, {   93,    -1,    -1,    -1,    -1}},
+    {0x109B01, { 2061,    -1,    -1,    -1,    -1}},
+    {0x109C01, { 2094,    -1,    -1,    -1,    -1}},
+    {0x109D01, { 2138,    -1,    -1,    -1,    -1}},
+    {0x109E01, { 2181,    -1,    -1,    -1,    -1}},
+    {0x109F01, { 2228,    -1,    -1,    -1,    -1}},
+    {0x10A000, {  122,    -1,    -1,    -1,    -1}},
+    {0x10A001, {   -1,    -1,  4938,    -1,    -1}},
+    {0x10A007, {   -1,    -1,  7696,    -1,    -1}},
+    {0x10A009, {   -1,    -1,  9441,    -1,    -1}},
+    {0x10A800, {  189,    -1,    -1,    -1,    -1}},
+    {0x10A801, {   -1,    -1,  5106,    -1,    -1}},
+    {0x10A809, {   -1,    -1,  9609,    -1,    -1}},
+    {0x10A901, { 2328,    -1,    -1,    -1,    -1}},
+    {0x10AB00, {  254,    -1,    -1,    -1,    -1}},
+    {0x10AD00, {  264,    -1,    -1,    -1,    -1}},
+    {0x10B001, { 2355,    -1,  5302,    -1,    -1}},
+    {0x10B007, {   -1,    -1,  7838,    -1,    -1}},
+    {0x10B009, {   -1,    -1,  9805,    -1,    -1}},
+    {0x10B101, {   -1,    -1,  5383,    -1,    -1}},
+    {0x10B105, {   -1,    -1,  6731,    -1,    -1}},
+    {0x10B107, {   -1,    -1,  7919,    -1,    -1}},
+    {0x10B109, {   -1,    -1,  9886,    -1,    -1}},
+    {0x10B201, {   -1,    -1,  5458,    -1,    -1}},
+    {0x10B207, {   -1,    -1,  7994,    -1,    -1}},
+    {0x10B209, {   -1,    -1,  9961,    -1,    -1}},
+    {0x10B301, {   -1,    -1,  5545,    -1,    -1}},
+    {0x10B309, {   -1,    -1, 10048,    -1,    -1}},
+    {0x10B401, {   -1,    -1,  5632,    -1,    -1}},
+    {0x10B407, {   -1,    -1,  8081,    -1,    -1}},
+    {0x10B409, {   -1,    -1, 10135,    -1,    -1}},
+    {0x10B501, {   -1,    -1,  5691,    -1,    -1}},
+    {0x10B507, {   -1,    -1,  8138,    -1,    -1}},
+    {0x10B509, {   -1,    -1, 10194,    -1,    -1}},
+    {0x10B801, { 2376,    -1,  5820,    -1,    -1}},
+    {0x10B805, {   -1,    -1,  6852,    -1,    -1}},
+    {0x10B807, {   -1,    -1,  8214,    -1,    -1}},
+    {0x10B809, {   -1,    -1, 10323,    -1,    -1}},
+    {0x10B901, { 2405,    -1,    -1,    -1,    -1}},
+    {0x10BB01, {   -1,    -1,  6009,    -1,    -1}},
+    {0x10BB09, {   -1,    -1, 10512,    -1,    -1}},
+    {0x10BC01, {   -1,    -1,  6098,    -1,    -1}},
+    {0x10BC09, {   -1,    -1, 10601,    -1,    -1}},
+    {0x10BE01, {   -1,    -1,  6210,    -1,    -1}},
+    {0x10BE09, {   -1,    -1, 10713,    -1,    -1}},
+    {0x10C000, {  300,    -1,    -1,    -1,    -1}},
+    {0x10C001, { 2436,    -1,    -1,    -1,    -1}},
+    {0x10C100, {  392,    -1,    -1,    -1,    -1}},
+    {0x10C101, { 2485,    -1,    -1,    -1,    -1}},
+    {0x10C200, {  470,    -1,    -1,    -1,    -1}},
+    {0x10C201, { 2533,    -1,    -1,    -1,    -1}},
+    {0x10C300, {  538,    -1,    -1,    -1,    -1}},
+    {0x10C400, {  588,    -1,    -1,    -1,    -1}},
+    {0x10C500, {  623,    -1,    -1,    -1,    -1}},
+    {0x10C600, {  653,    -1,    -1,    -1,    -1}},
+    {0x10FE00, {  938,    -1,    -1,    -1,    -1}},
+    {0x10FF00, { 1066,    -1,    -1,    -1,    -1}},
+    {0x10FF01, { 2611,    -1,    -1,    -1,    -1}},
+    {0x110000, {   -1,    -1,    -1,    -1,    34}},
+    {0x110001, { 1543,    -1,    -1,    -1,   182}},
+    {0x110002, {   -1,    -1,   532,    -1,    -1}},
+    {0x110003, {   -1,    -1,  6281,    -1,    -1}},
+    {0x110004, {   -1,    -1,   861,    -1,    -1}},
+    {0x110005, {   -1,    -1,  6532,    -1,    -1}},
+    {0x110006, {   -1,    -1,  1076,    -1,    -1}},
+    {0x110007, {   -1,    -1,  6995,    -1,    -1}},
+    {0x110008, {   -1,    -1,  1246,    -1,    -1}},
+    {0x110009, {   -1,    -1,  8421,    -1,    -1}},
+    {0x110010, {   -1,    -1,  1679,    -1,    -1}},
+    {0x110020, {   -1,    -1,  2633,    -1,    -1}},
+    {0x110080, { 1271,    -1,    -1,    -1,    -1}},
+    {0x1100F1, {   -1,    -1,    -1,   263,    -1}},
+    {0x1100F2, {   -1,    -1,    -1,    34,    -1}},
+    {0x110100, {   -1,    -1,    34,    -1,    -1}},
+    {0x110101, { 1562,    -1,  4038,    -1,    -1}},
+    {0x110109, {   -1,    -1,  8541,    -1,    -1}},
+    {0x1101FC, {   -1,    -1,  3848,    -1,    -1}},
+    {0x1101FE, {   -1,    -1,  3912,    -1,    -1}},
+    {0x110200, {   -1,    -1,   162,    -1,    -1}},
+    {0x110201, { 1576,    -1,  4139,    -1,    -1}},
+    {0x110209, {   -1,    -1,  8642,    -1,    -1}},
+    {0x110210, {   -1,    -1,  1815,    -1,    -1}},
+    {0x110300, {   -1,    -1,   290,    -1,    -1}},
+    {0x110301, { 1628,    -1,    -1,    -1,    -1}},
+    {0x110302, {   -1,    -1,   690,    -1,    -1}},
+    {0x110304, {   -1,    -1,   957,    -1,    -1}},
+    {0x110306, {   -1,    -1,  1151,    -1,    -1}},
+    {0x110310, {   -1,    -1,  1884,    -1,    -1}},
+    {0x110320, {   -1,    -1,  2740,    -1,    -1}},
+    {0x110400, {   -1,    -1,   418,    -1,    -1}},
+    {0x110401, { 1689,    -1,    -1,    -1,    -1}},
+    {0x110402, {   -1,    -1,   775,    -1,    -1}},
+    {0x110404, {   -1,    -1,  1013,    -1,    -1}},
+    {0x110406, {   -1,    -1,  1190,    -1,    -1}},
+    {0x110408, {   -1,    -1,  1337,    -1,    -1}},
+    {0x110410, {   -1,    -1,  1986,    -1,    -1}},
+    {0x110420, {   -1,    -1,  2802,    -1,    -1}},
+    {0x110501, { 1739,    -1,    -1,    -1,    -1}},
+    {0x110600, {   16,    -1,    -1,    -1,    -1}},
+    {0x110601, { 1786,    -1,    -1,    -1,    -1}},
+    {0x110701, { 1832,    -1,    -1,    -1,    -1}},
+    {0x110901, {   -1,    -1,  4278,    -1,    -1}},
+    {0x110907, {   -1,    -1,  7193,    -1,    -1}},
+    {0x110909, {   -1,    -1,  8781,    -1,    -1}},
+    {0x111A01, { 2021,    -1,    -1,    -1,    -1}},
+    {0x111B01, { 2062,    -1,    -1,    -1,    -1}},
+    {0x111C00, {  101,    -1,    -1,    -1,    -1}},
+    {0x111C01, { 2095,    -1,    -1,    -1,    -1}},
+    {0x111D01, { 2139,    -1,    -1,    -1,    -1}},
+    {0x111E01, { 2182,    -1,    -1,    -1,    -1}},
+    {0x111F01, { 2229,    -1,    -1,    -1,    -1}},
+    {0x112001, {   -1,    -1,  4939,    -1,    -1}},
+    {0x112007, {   -1,    -1,  7697,    -1,    -1}},
+    {0x112009, {   -1,    -1,  9442,    -1,    -1}},
+    {0x112800, {  190,    -1,    -1,    -1,    -1}},
+    {0x112801, {   -1,    -1,  5107,    -1,    -1}},
+    {0x112809, {   -1,    -1,  9610,    -1,    -1}},
+    {0x112901, { 2329,    -1,    -1,    -1,    -1}},
+    {0x113001, {   -1,    -1,  5303,    -1,    -1}},
+    {0x113007, {   -1,    -1,  7839,    -1,    -1}},
+    {0x113009, {   -1,    -1,  9806,    -1,    -1}},
+    {0x113101, {   -1,    -1,  5384,    -1,    -1}},
+    {0x113105, {   -1,    -1,  6732,    -1,    -1}},
+    {0x113107, {   -1,    -1,  7920,    -1,    -1}},
+    {0x113109, {   -1,    -1,  9887,    -1,    -1}},
+    {0x113201, {   -1,    -1,  5459,    -1,    -1}},
+    {0x113207, {   -1,    -1,  7995,    -1,    -1}},
+    {0x113209, {   -1,    -1,  9962,    -1,    -1}},
+    {0x113301, {   -1,    -1,  5546,    -1,    -1}},
+    {0x113309, {   -1,    -1, 10049,    -1,    -1}},
+    {0x113401, {   -1,    -1,  5633,    -1,    -1}},
+    {0x113407, {   -1,    -1,  8082,    -1,    -1}},
+    {0x113409, {   -1,    -1, 10136,    -1,    -1}},
+    {0x113501, {   -1,    -1,  5692,    -1,    -1}},
+    {0x113507, {   -1,    -1,  8139,    -1,    -1}},
+    {0x113509, {   -1,    -1, 10195,    -1,    -1}},
+    {0x113801, { 2377,    -1,  5821,    -1,    -1}},
+    {0x113805, {   -1,    -1,  6853,    -1,    -1}},
+    {0x113807, {   -1,    -1,  8215,    -1,    -1}},
+    {0x113809, {   -1,    -1, 10324,    -1,    -1}},
+    {0x113901, { 2406,    -1,    -1,    -1,    -1}},
+    {0x113B01, {   -1,    -1,  6010,    -1,    -1}},
+    {0x113B09, {   -1,    -1, 10513,    -1,    -1}},
+    {0x113C01, {   -1,    -1,  6099,    -1,    -1}},
+    {0x113C09, {   -1,    -1, 10602,    -1,    -1}},
+    {0x113E01, {   -1,    -1,  6211,    -1,    -1}},
+    {0x113E09, {   -1,    -1, 10714,    -1,    -1}},
+    {0x114000, {  301,    -1,    -1,    -1,    -1}},
+    {0x114001, { 2437,    -1,    -1,    -1,    -1}},
+    {0x114100, {  393,    -1,    -1,    -1,    -1}},
+    {0x114101, { 2486,    -1,    -1,    -1,    -1}},
+    {0x114200, {  471,    -1,    -1,    -1,    -1}},
+    {0x114201, { 2534,    -1,    -1,    -1,    -1}},
+    {0x114300, {  539,    -1,    -1,    -1,    -1}},
+    {0x117E00, {  939,    -1,    -1,    -1,    -1}},
+    {0x117E01, { 2574,    -1,    -1,    -1,    -1}},
+    {0x117F00, { 1067,    -1,    -1,    -1,    -1}},
+    {0x117F01, { 2612,    -1,    -1,    -1,    -1}},
+    {0x118000, {   -1,    -1,    -1,    -1,    35}},
+    {0x118001, {   -1,    -1,    -1,    -1,   128}},
+    {0x118002, {   -1,    -1,   533,    -1,    -1}},
+    {0x118003, {   -1,    -1,  6282,    -1,    -1}},
+    {0x118004, {   -1,    -1,   862,    -1,    -1}},
+    {0x118005, {   -1,    -1,  6533,    -1,    -1}},
+    {0x118006, {   -1,    -1,  1077,    -1,    -1}},
+    {0x118007, {   -1,    -1,  6996,    -1,    -1}},
+    {0x118008, {   -1,    -1,  1247,    -1,    -1}},
+    {0x118009, {   -1,    -1,  8422,    -1,    -1}},
+    {0x11800A, {   -1,    -1,  1387,    -1,    -1}},
+    {0x118010, {   -1,    -1,  1680,    -1,    -1}},
+    {0x118080, { 1272,    -1,    -1,    -1,    -1}},
+    {0x1180F1, {   -1,    -1,    -1,   264,    -1}},
+    {0x1180F2, {   -1,    -1,    -1,    35,    -1}},
+    {0x118100, {   -1,    -1,    35,    -1,    -1}},
+    {0x118101, { 1563,    -1,  4039,    -1,    -1}},
+    {0x118105, {   -1,    -1,  6586,    -1,    -1}},
+    {0x118107, {   -1,    -1,  7084,    -1,    -1}},
+    {0x118109, {   -1,    -1,  8542,    -1,    -1}},
+    {0x1181FC, {   -1,    -1,  3849,    -1,    -1}},
+    {0x1181FE, {   -1,    -1,  3913,    -1,    -1}},
+    {0x118200, {   -1,    -1,   163,    -1,    -1}},
+    {0x118201, { 1577,    -1,  4140,    -1,    -1}},
+    {0x118202, {   -1,    -1,   631,    -1,    -1}},
+    {0x118204, {   -1,    -1,   928,    -1,    -1}},
+    {0x118206, {   -1,    -1,  1132,    -1,    -1}},
+    {0x118207, {   -1,    -1,  7111,    -1,    -1}},
+    {0x118208, {   -1,    -1,  1294,    -1,    -1}},
+    {0x118209, {   -1,    -1,  8643,    -1,    -1}},
+    {0x11820A, {   -1,    -1,  1428,    -1,    -1}},
+    {0x118300, {   -1,    -1,   291,    -1,    -1}},
+    {0x118301, { 1629,    -1,    -1,    -1,    -1}},
+    {0x118302, {   -1,    -1,   691,    -1,    -1}},
+    {0x118304, {   -1,    -1,   958,    -1,    -1}},
+    {0x118306, {   -1,    -1,  1152,    -1,    -1}},
+    {0x118308, {   -1,    -1,  1310,    -1,    -1}},
+    {0x11830A, {   -1,    -1,  1440,    -1,    -1}},
+    {0x118310, {   -1,    -1,  1885,    -1,    -1}},
+    {0x118400, {   -1,    -1,   419,    -1,    -1}},
+    {0x118401, { 1690,    -1,    -1,    -1,    -1}},
+    {0x118402, {   -1,    -1,   776,    -1,    -1}},
+    {0x118404, {   -1,    -1,  1014,    -1,    -1}},
+    {0x118406, {   -1,    -1,  1191,    -1,    -1}},
+    {0x118408, {   -1,    -1,  1338,    -1,    -1}},
+    {0x11840A, {   -1,    -1,  1463,    -1,    -1}},
+    {0x118410, {   -1,    -1,  1987,    -1,    -1}},
+    {0x118501, { 1740,    -1,    -1,    -1,    -1}},
+    {0x118601, { 1787,    -1,    -1,    -1,    -1}},
+    {0x118701, { 1833,    -1,    -1,    -1,    -1}},
+    {0x118801, {   -1,    -1,  4223,    -1,    -1}},
+    {0x118805, {   -1,    -1,  6593,    -1,    -1}},
+    {0x118807, {   -1,    -1,  7138,    -1,    -1}},
+    {0x118809, {   -1,    -1,  8726,    -1,    -1}},
+    {0x118901, { 1885,    -1,  4279,    -1,    -1}},
+    {0x118907, {   -1,    -1,  7194,    -1,    -1}},
+    {0x118909, {   -1,    -1,  8782,    -1,    -1}},
+    {0x118A01, {   -1,    -1,  4377,    -1,    -1}},
+    {0x118A07, {   -1,    -1,  7282,    -1,    -1}},
+    {0x118A09, {   -1,    -1,  8880,    -1,    -1}},
+    {0x118B01, {   -1,    -1,  4420,    -1,    -1}},
+    {0x118B07, {   -1,    -1,  7316,    -1,    -1}},
+    {0x118B09, {   -1,    -1,  8923,    -1,    -1}},
+    {0x118C01, {   -1,    -1,  4468,    -1,    -1}},
+    {0x118C09, {   -1,    -1,  8971,    -1,    -1}},
+    {0x118D01, {   -1,    -1,  4520,    -1,    -1}},
+    {0x118D09, {   -1,    -1,  9023,    -1,    -1}},
+    {0x119001, { 1918,    -1,  4568,    -1,    -1}},
+    {0x119005, {   -1,    -1,  6605,    -1,    -1}},
+    {0x119007, {   -1,    -1,  7356,    -1,    -1}},
+    {0x119009, {   -1,    -1,  9071,    -1,    -1}},
+    {0x119101, { 1937,    -1,    -1,    -1,    -1}},
+    {0x119801, { 1972,    -1,  4612,    -1,    -1}},
+    {0x119805, {   -1,    -1,  6619,    -1,    -1}},
+    {0x119807, {   -1,    -1,  7382,    -1,    -1}},
+    {0x119809, {   -1,    -1,  9115,    -1,    -1}},
+    {0x119901, { 1988,    -1,  4665,    -1,    -1}},
+    {0x119905, {   -1,    -1,  6634,    -1,    -1}},
+    {0x119907, {   -1,    -1,  7422,    -1,    -1}},
+    {0x119909, {   -1,    -1,  9168,    -1,    -1}},
+    {0x119A01, { 2022,    -1,  4708,    -1,    -1}},
+    {0x119A05, {   -1,    -1,  6657,    -1,    -1}},
+    {0x119A07, {   -1,    -1,  7463,    -1,    -1}},
+    {0x119A09, {   -1,    -1,  9211,    -1,    -1}},
+    {0x119B01, { 2063,    -1,  4750,    -1,    -1}},
+    {0x119B07, {   -1,    -1,  7504,    -1,    -1}},
+    {0x119B09, {   -1,    -1,  9253,    -1,    -1}},
+    {0x119C01, { 2096,    -1,  4791,    -1,    -1}},
+    {0x119C07, {   -1,    -1,  7545,    -1,    -1}},
+    {0x119C09, {   -1,    -1,  9294,    -1,    -1}},
+    {0x119D01, { 2140,    -1,  4832,    -1,    -1}},
+    {0x119D07, {   -1,    -1,  7586,    -1,    -1}},
+    {0x119D09, {   -1,    -1,  9335,    -1,    -1}},
+    {0x119E01, { 2183,    -1,  4873,    -1,    -1}},
+    {0x119E07, {   -1,    -1,  7627,    -1,    -1}},
+    {0x119E09, {   -1,    -1,  9376,    -1,    -1}},
+    {0x119F01, { 2230,    -1,    -1,    -1,    -1}},
+    {0x11A000, {  123,    -1,    -1,    -1,    -1}},
+    {0x11A001, {   -1,   141,  4940,    -1,    -1}},
+    {0x11A003, {   -1,    -1,  6378,    -1,    -1}},
+    {0x11A005, {   -1,    -1,  6675,    -1,    -1}},
+    {0x11A007, {   -1,    -1,  7698,    -1,    -1}},
+    {0x11A009, {   -1,    -1,  9443,    -1,    -1}},
+    {0x11A0F1, {   -1,    -1,    -1,   360,    -1}},
+    {0x11A100, {  136,    -1,    -1,    -1,    -1}},
+    {0x11A101, {   -1,    -1,  5027,    -1,    -1}},
+    {0x11A109, {   -1,    -1,  9530,    -1,    -1}},
+    {0x11A200, {  139,    -1,    -1,    -1,    -1}},
+    {0x11A801, {   -1,   143,  5108,    -1,    -1}},
+    {0x11A803, {   -1,    -1,  6380,    -1,    -1}},
+    {0x11A805, {   -1,    -1,  6682,    -1,    -1}},
+    {0x11A807, {   -1,    -1,  7783,    -1,    -1}},
+    {0x11A809, {   -1,    -1,  9611,    -1,    -1}},
+    {0x11A8F1, {   -1,    -1,    -1,   362,    -1}},
+    {0x11A901, { 2330,    -1,  5195,    -1,    -1}},
+    {0x11A909, {   -1,    -1,  9698,    -1,    -1}},
+    {0x11AA01, {   -1,    -1,  5224,    -1,    -1}},
+    {0x11AA09, {   -1,    -1,  9727,    -1,    -1}},
+    {0x11B001, { 2356,   152,  5304,    -1,    -1}},
+    {0x11B003, {   -1,    -1,  6389,    -1,    -1}},
+    {0x11B005, {   -1,    -1,  6702,    -1,    -1}},
+    {0x11B007, {   -1,    -1,  7840,    -1,    -1}},
+    {0x11B009, {   -1,    -1,  9807,    -1,    -1}},
+    {0x11B0F1, {   -1,    -1,    -1,   371,    -1}},
+    {0x11B101, {   -1,    -1,  5385,    -1,    -1}},
+    {0x11B105, {   -1,    -1,  6733,    -1,    -1}},
+    {0x11B107, {   -1,    -1,  7921,    -1,    -1}},
+    {0x11B109, {   -1,    -1,  9888,    -1,    -1}},
+    {0x11B201, {   -1,    -1,  5460,    -1,    -1}},
+    {0x11B207, {   -1,    -1,  7996,    -1,    -1}},
+    {0x11B209, {   -1,    -1,  9963,    -1,    -1}},
+    {0x11B301, {   -1,    -1,  5547,    -1,    -1}},
+    {0x11B309, {   -1,    -1, 10050,    -1,    -1}},
+    {0x11B401, {   -1,    -1,  5634,    -1,    -1}},
+    {0x11B407, {   -1,    -1,  8083,    -1,    -1}},
+    {0x11B409, {   -1,    -1, 10137,    -1,    -1}},
+    {0x11B501, {   -1,    -1,  5693,    -1,    -1}},
+    {0x11B507, {   -1,    -1,  8140,    -1,    -1}},
+    {0x11B509, {   -1,    -1, 10196,    -1,    -1}},
+    {0x11B801, { 2378,    -1,  5822,    -1,    -1}},
+    {0x11B805, {   -1,    -1,  6854,    -1,    -1}},
+    {0x11B807, {   -1,    -1,  8216,    -1,    -1}},
+    {0x11B809, {   -1,    -1, 10325,    -1,    -1}},
+    {0x11B901, { 2407,    -1,    -1,    -1,    -1}},
+    {0x11BB01, {   -1,    -1,  6011,    -1,    -1}},
+    {0x11BB09, {   -1,    -1, 10514,    -1,    -1}},
+    {0x11BC01, {   -1,    -1,  6100,    -1,    -1}},
+    {0x11BC09, {   -1,    -1, 10603,    -1,    -1}},
+    {0x11BE01, {   -1,    -1,  6212,    -1,    -1}},
+    {0x11BE09, {   -1,    -1, 10715,    -1,    -1}},
+    {0x11C000, {  302,    -1,    -1,    -1,    -1}},
+    {0x11C001, { 2438,    -1,    -1,    -1,    -1}},
+    {0x11C100, {  394,    -1,    -1,    -1,    -1}},
+    {0x11C101, { 2487,    -1,    -1,    -1,    -1}},
+    {0x11C200, {  472,    -1,    -1,    -1,    -1}},
+    {0x11C201, { 2535,    -1,    -1,    -1,    -1}},
+    {0x11C300, {  540,    -1,    -1,    -1,    -1}},
+    {0x11E000, {  847,    -1,    -1,    -1,    -1}},
+    {0x11E100, {  877,    -1,    -1,    -1,    -1}},
+    {0x11FE00, {  940,    -1,    -1,    -1,    -1}},
+    {0x11FF00, { 1068,    -1,    -1,    -1,    -1}},
+    {0x11FF01, { 2613,    -1,    -1,    -1,    -1}},
+    {0x11FF03, {   -1,    -1,  6456,    -1,    -1}},
+    {0x120000, {   -1,    -1,    -1,    -1,    36}},
+    {0x120001, {   -1,    -1,    -1,    -1,   129}},
+    {0x120002, {   -1,    -1,   534,    -1,    -1}},
+    {0x120003, { 1322,    -1,  6283,    -1,    -1}},
+    {0x120005, {   -1,    -1,  6534,    -1,    -1}},
+    {0x120007, {   -1,    -1,  6997,    -1,    -1}},
+    {0x120009, {   -1,    -1,  8423,    -1,    -1}},
+    {0x120010, {   -1,    -1,  1681,    -1,    -1}},
+    {0x120012, {   -1,    -1,  2078,    -1,    -1}},
+    {0x120080, { 1273,    -1,    -1,    -1,    -1}},
+    {0x1200F1, {   -1,    -1,    -1,   265,    -1}},
+    {0x1200F2, {   -1,    -1,    -1,    36,    -1}},
+    {0x120100, {   -1,    -1,    36,    -1,    -1}},
+    {0x120101, { 1564,    -1,  4040,    -1,    -1}},
+    {0x120103, { 1344,    -1,    -1,    -1,    -1}},
+    {0x120105, {   -1,    -1,  6587,    -1,    -1}},
+    {0x120107, {   -1,    -1,  7085,    -1,    -1}},
+    {0x120109, {   -1,    -1,  8543,    -1,    -1}},
+    {0x1201FC, {   -1,    -1,  3850,    -1,    -1}},
+    {0x1201FE, {   -1,    -1,  3914,    -1,    -1}},
+    {0x120200, {   -1,    -1,   164,    -1,    -1}},
+    {0x120201, { 1578,    -1,  4141,    -1,    -1}},
+    {0x120207, {   -1,    -1,  7112,    -1,    -1}},
+    {0x120209, {   -1,    -1,  8644,    -1,    -1}},
+    {0x120210, {   -1,    -1,  1816,    -1,    -1}},
+    {0x120300, {   -1,    -1,   292,    -1,    -1}},
+    {0x120301, { 1630,    -1,    -1,    -1,    -1}},
+    {0x120302, {   -1,    -1,   692,    -1,    -1}},
+    {0x120310, {   -1,    -1,  1886,    -1,    -1}},
+    {0x120312, {   -1,    -1,  2162,    -1,    -1}},
+    {0x120400, {   -1,    -1,   420,    -1,    -1}},
+    {0x120401, { 1691,    -1,    -1,    -1,    -1}},
+    {0x120402, {   -1,    -1,   777,    -1,    -1}},
+    {0x120410, {   -1,    -1,  1988,    -1,    -1}},
+    {0x120412, {   -1,    -1,  2217,    -1,    -1}},
+    {0x120501, { 1741,    -1,    -1,    -1,    -1}},
+    {0x120601, { 1788,    -1,    -1,    -1,    -1}},
+    {0x120701, { 1834,    -1,    -1,    -1,    -1}},
+    {0x120801, { 1869,    -1,  4224,    -1,    -1}},
+    {0x120805, {   -1,    -1,  6594,    -1,    -1}},
+    {0x120807, {   -1,    -1,  7139,    -1,    -1}},
+    {0x120809, {   -1,    -1,  8727,    -1,    -1}},
+    {0x120901, { 1886,    -1,  4280,    -1,    -1}},
+    {0x120907, {   -1,    -1,  7195,    -1,    -1}},
+    {0x120909, {   -1,    -1,  8783,    -1,    -1}},
+    {0x120A01, {   -1,    -1,  4378,    -1,    -1}},
+    {0x120A07, {   -1,    -1,  7283,    -1,    -1}},
+    {0x120A09, {   -1,    -1,  8881,    -1,    -1}},
+    {0x120B01, {   -1,    -1,  4421,    -1,    -1}},
+    {0x120B07, {   -1,    -1,  7317,    -1,    -1}},
+    {0x120B09, {   -1,    -1,  8924,    -1,    -1}},
+    {0x120C01, {   -1,    -1,  4469,    -1,    -1}},
+    {0x120C09, {   -1,    -1,  8972,    -1,    -1}},
+    {0x120D01, {   -1,    -1,  4521,    -1,    -1}},
+    {0x120D09, {   -1,    -1,  9024,    -1,    -1}},
+    {0x121001, { 1919,   104,  4569,    -1,    -1}},
+    {0x121003, { 1378,    -1,  6341,    -1,    -1}},
+    {0x121005, {   -1,    -1,  6606,    -1,    -1}},
+    {0x121007, {   -1,    -1,  7357,    -1,    -1}},
+    {0x121009, {   -1,    -1,  9072,    -1,    -1}},
+    {0x1210F1, {   -1,    -1,    -1,   323,    -1}},
+    {0x121101, { 1938,    -1,    -1,    -1,    -1}},
+    {0x121103, { 1398,    -1,    -1,    -1,    -1}},
+    {0x121203, { 1437,    -1,    -1,    -1,    -1}},
+    {0x121500, {   76,    -1,    -1,    -1,    -1}},
+    {0x121801, { 1973,   112,  4613,    -1,    -1}},
+    {0x121803, {   -1,    -1,  6349,    -1,    -1}},
+    {0x121805, {   -1,    -1,  6620,    -1,    -1}},
+    {0x121807, {   -1,    -1,  7383,    -1,    -1}},
+    {0x121809, {   -1,    -1,  9116,    -1,    -1}},
+    {0x1218F1, {   -1,    -1,    -1,   331,    -1}},
+    {0x121901, { 1989,   122,  4666,    -1,    -1}},
+    {0x121903, {   -1,    -1,  6359,    -1,    -1}},
+    {0x121905, {   -1,    -1,  6635,    -1,    -1}},
+    {0x121907, {   -1,    -1,  7423,    -1,    -1}},
+    {0x121909, {   -1,    -1,  9169,    -1,    -1}},
+    {0x1219F1, {   -1,    -1,    -1,   341,    -1}},
+    {0x121A01, { 2023,    -1,  4709,    -1,    -1}},
+    {0x121A05, {   -1,    -1,  6658,    -1,    -1}},
+    {0x121A07, {   -1,    -1,  7464,    -1,    -1}},
+    {0x121A09, {   -1,    -1,  9212,    -1,    -1}},
+    {0x121B00, {   94,    -1,    -1,    -1,    -1}},
+    {0x121B01, { 2064,    -1,  4751,    -1,    -1}},
+    {0x121B07, {   -1,    -1,  7505,    -1,    -1}},
+    {0x121B09, {   -1,    -1,  9254,    -1,    -1}},
+    {0x121C01, { 2097,    -1,  4792,    -1,    -1}},
+    {0x121C07, {   -1,    -1,  7546,    -1,    -1}},
+    {0x121C09, {   -1,    -1,  9295,    -1,    -1}},
+    {0x121D01, { 2141,    -1,  4833,    -1,    -1}},
+    {0x121D07, {   -1,    -1,  7587,    -1,    -1}},
+    {0x121D09, {   -1,    -1,  9336,    -1,    -1}},
+    {0x121E01, { 2184,    -1,  4874,    -1,    -1}},
+    {0x121E07, {   -1,    -1,  7628,    -1,    -1}},
+    {0x121E09, {   -1,    -1,  9377,    -1,    -1}},
+    {0x121F01, { 2231,    -1,    -1,    -1,    -1}},
+    {0x122000, {  124,    -1,    -1,    -1,    -1}},
+    {0x122001, { 2269,   142,  4941,    -1,    -1}},
+    {0x122003, { 1476,    -1,  6379,    -1,    -1}},
+    {0x122005, {   -1,    -1,  6676,    -1,    -1}},
+    {0x122007, {   -1,    -1,  7699,    -1,    -1}},
+    {0x122009, {   -1,    -1,  9444,    -1,    -1}},
+    {0x1220F1, {   -1,    -1,    -1,   361,    -1}},
+    {0x122101, { 2283,    -1,  5028,    -1,    -1}},
+    {0x122103, { 1499,    -1,    -1,    -1,    -1}},
+    {0x122109, {   -1,    -1,  9531,    -1,    -1}},
+    {0x122203, { 1522,    -1,    -1,    -1,    -1}},
+    {0x122801, { 2315,   144,  5109,    -1,    -1}},
+    {0x122803, {   -1,    -1,  6381,    -1,    -1}},
+    {0x122805, {   -1,    -1,  6683,    -1,    -1}},
+    {0x122807, {   -1,    -1,  7784,    -1,    -1}},
+    {0x122809, {   -1,    -1,  9612,    -1,    -1}},
+    {0x1228F1, {   -1,    -1,    -1,   363,    -1}},
+    {0x122901, { 2331,    -1,  5196,    -1,    -1}},
+    {0x122909, {   -1,    -1,  9699,    -1,    -1}},
+    {0x122A01, {   -1,    -1,  5225,    -1,    -1}},
+    {0x122A09, {   -1,    -1,  9728,    -1,    -1}},
+    {0x123001, { 2357,   153,  5305,    -1,    -1}},
+    {0x123003, {   -1,    -1,  6390,    -1,    -1}},
+    {0x123005, {   -1,    -1,  6703,    -1,    -1}},
+    {0x123007, {   -1,    -1,  7841,    -1,    -1}},
+    {0x123009, {   -1,    -1,  9808,    -1,    -1}},
+    {0x1230F1, {   -1,    -1,    -1,   372,    -1}},
+    {0x123101, {   -1,    -1,  5386,    -1,    -1}},
+    {0x123105, {   -1,    -1,  6734,    -1,    -1}},
+    {0x123107, {   -1,    -1,  7922,    -1,    -1}},
+    {0x123109, {   -1,    -1,  9889,    -1,    -1}},
+    {0x123201, {   -1,    -1,  5461,    -1,    -1}},
+    {0x123207, {   -1,    -1,  7997,    -1,    -1}},
+    {0x123209, {   -1,    -1,  9964,    -1,    -1}},
+    {0x123301, {   -1,    -1,  5548,    -1,    -1}},
+    {0x123309, {   -1,    -1, 10051,    -1,    -1}},
+    {0x123401, {   -1,    -1,  5635,    -1,    -1}},
+    {0x123407, {   -1,    -1,  8084,    -1,    -1}},
+    {0x123409, {   -1,    -1, 10138,    -1,    -1}},
+    {0x123501, {   -1,    -1,  5694,    -1,    -1}},
+    {0x123507, {   -1,    -1,  8141,    -1,    -1}},
+    {0x123509, {   -1,    -1, 10197,    -1,    -1}},
+    {0x123601, {   -1,    -1,  5755,    -1,    -1}},
+    {0x123609, {   -1,    -1, 10258,    -1,    -1}},
+    {0x123801, { 2379,    -1,  5823,    -1,    -1}},
+    {0x123805, {   -1,    -1,  6855,    -1,    -1}},
+    {0x123807, {   -1,    -1,  8217,    -1,    -1}},
+    {0x123809, {   -1,    -1, 10326,    -1,    -1}},
+    {0x123901, { 2408,    -1,  5884,    -1,    -1}},
+    {0x123905, {   -1,    -1,  6910,    -1,    -1}},
+    {0x123907, {   -1,    -1,  8278,    -1,    -1}},
+    {0x123909, {   -1,    -1, 10387,    -1,    -1}},
+    {0x123A01, {   -1,    -1,  5937,    -1,    -1}},
+    {0x123A07, {   -1,    -1,  8331,    -1,    -1}},
+    {0x123A09, {   -1,    -1, 10440,    -1,    -1}},
+    {0x123B01, {   -1,    -1,  6012,    -1,    -1}},
+    {0x123B09, {   -1,    -1, 10515,    -1,    -1}},
+    {0x123C01, {   -1,    -1,  6101,    -1,    -1}},
+    {0x123C09, {   -1,    -1, 10604,    -1,    -1}},
+    {0x123D01, {   -1,    -1,  6156,    -1,    -1}},
+    {0x123D09, {   -1,    -1, 10659,    -1,    -1}},
+    {0x123E01, {   -1,    -1,  6213,    -1,    -1}},
+    {0x123E09, {   -1,    -1, 10716,    -1,    -1}},
+    {0x124000, {  303,    -1,    -1,    -1,    -1}},
+    {0x124001, { 2439,    -1,    -1,    -1,    -1}},
+    {0x124100, {  395,    -1,    -1,    -1,    -1}},
+    {0x124101, { 2488,    -1,    -1,    -1,    -1}},
+    {0x124200, {  473,    -1,    -1,    -1,    -1}},
+    {0x124201, { 2536,    -1,    -1,    -1,    -1}},
+    {0x124300, {  541,    -1,    -1,    -1,    -1}},
+    {0x124400, {  589,    -1,    -1,    -1,    -1}},
+    {0x127E00, {  941,    -1,    -1,    -1,    -1}},
+    {0x127F00, { 1069,    -1,    -1,    -1,    -1}},
+    {0x127F01, { 2614,    -1,    -1,    -1,    -1}},
+    {0x127F03, {   -1,    -1,  6457,    -1,    -1}},
+    {0x128000, {   -1,    -1,    -1,    -1,    37}},
+    {0x128001, { 1544,    -1,    -1,    -1,   130}},
+    {0x128002, {   -1,    -1,   535,    -1,    -1}},
+    {0x128003, { 1323,    -1,  6284,    -1,    -1}},
+    {0x128005, {   -1,    -1,  6535,    -1,    -1}},
+    {0x128007, {   -1,    -1,  6998,    -1,    -1}},
+    {0x128009, {   -1,    -1,  8424,    -1,    -1}},
+    {0x128010, {   -1,    -1,  1682,    -1,    -1}},
+    {0x128080, { 1274,    -1,    -1,    -1,    -1}},
+    {0x1280F1, {   -1,    -1,    -1,   266,    -1}},
+    {0x1280F2, {   -1,    -1,    -1,    37,    -1}},
+    {0x128100, {   -1,    -1,    37,    -1,    -1}},
+    {0x128101, {   -1,    -1,  4041,    -1,    -1}},
+    {0x128103, { 1345,    -1,    -1,    -1,    -1}},
+    {0x128107, {   -1,    -1,  7086,    -1,    -1}},
+    {0x128109, {   -1,    -1,  8544,    -1,    -1}},
+    {0x1281FC, {   -1,    -1,  3851,    -1,    -1}},
+    {0x1281FE, {   -1,    -1,  3915,    -1,    -1}},
+    {0x128200, {   -1,    -1,   165,    -1,    -1}},
+    {0x128201, { 1579,    -1,  4142,    -1,    -1}},
+    {0x128207, {   -1,    -1,  7113,    -1,    -1}},
+    {0x128209, {   -1,    -1,  8645,    -1,    -1}},
+    {0x128300, {   -1,    -1,   293,    -1,    -1}},
+    {0x128301, { 1631,    -1,    -1,    -1,    -1}},
+    {0x128310, {   -1,    -1,  1887,    -1,    -1}},
+    {0x128400, {   -1,    -1,   421,    -1,    -1}},
+    {0x128401, { 1692,    -1,    -1,    -1,    -1}},
+    {0x128402, {   -1,    -1,   778,    -1,    -1}},
+    {0x128410, {   -1,    -1,  1989,    -1,    -1}},
+    {0x128501, { 1742,    -1,    -1,    -1,    -1}},
+    {0x128601, { 1789,    -1,    -1,    -1,    -1}},
+    {0x128701, { 1835,    -1,    -1,    -1,    -1}},
+    {0x128801, {   -1,    -1,  4225,    -1,    -1}},
+    {0x128807, {   -1,    -1,  7140,    -1,    -1}},
+    {0x128809, {   -1,    -1,  8728,    -1,    -1}},
+    {0x128901, {   -1,    -1,  4281,    -1,    -1}},
+    {0x128907, {   -1,    -1,  7196,    -1,    -1}},
+    {0x128909, {   -1,    -1,  8784,    -1,    -1}},
+    {0x128A01, {   -1,    -1,  4379,    -1,    -1}},
+    {0x128A07, {   -1,    -1,  7284,    -1,    -1}},
+    {0x128A09, {   -1,    -1,  8882,    -1,    -1}},
+    {0x128B01, {   -1,    -1,  4422,    -1,    -1}},
+    {0x128B07, {   -1,    -1,  7318,    -1,    -1}},
+    {0x128B09, {   -1,    -1,  8925,    -1,    -1}},
+    {0x128C01, {   -1,    -1,  4470,    -1,    -1}},
+    {0x128C09, {   -1,    -1,  8973,    -1,    -1}},
+    {0x128D01, {   -1,    -1,  4522,    -1,    -1}},
+    {0x128D09, {   -1,    -1,  9025,    -1,    -1}},
+    {0x129000, {   43,    -1,    -1,    -1,    -1}},
+    {0x129001, {   -1,    -1,  4570,    -1,    -1}},
+    {0x129003, { 1379,    -1,    -1,    -1,    -1}},
+    {0x129007, {   -1,    -1,  7358,    -1,    -1}},
+    {0x129009, {   -1,    -1,  9073,    -1,    -1}},
+    {0x129103, { 1399,    -1,    -1,    -1,    -1}},
+    {0x129203, { 1438,    -1,    -1,    -1,    -1}},
+    {0x129600, {   79,    -1,    -1,    -1,    -1}},
+    {0x129801, {   -1,    -1,  4614,    -1,    -1}},
+    {0x129807, {   -1,    -1,  7384,    -1,    -1}},
+    {0x129809, {   -1,    -1,  9117,    -1,    -1}},
+    {0x129901, { 1990,   123,  4667,    -1,    -1}},
+    {0x129903, {   -1,    -1,  6360,    -1,    -1}},
+    {0x129905, {   -1,    -1,  6636,    -1,    -1}},
+    {0x129907, {   -1,    -1,  7424,    -1,    -1}},
+    {0x129909, {   -1,    -1,  9170,    -1,    -1}},
+    {0x1299F1, {   -1,    -1,    -1,   342,    -1}},
+    {0x129A01, { 2024,    -1,  4710,    -1,    -1}},
+    {0x129A07, {   -1,    -1,  7465,    -1,    -1}},
+    {0x129A09, {   -1,    -1,  9213,    -1,    -1}},
+    {0x129B01, { 2065,    -1,  4752,    -1,    -1}},
+    {0x129B07, {   -1,    -1,  7506,    -1,    -1}},
+    {0x129B09, {   -1,    -1,  9255,    -1,    -1}},
+    {0x129C01, { 2098,    -1,  4793,    -1,    -1}},
+    {0x129C07, {   -1,    -1,  7547,    -1,    -1}},
+    {0x129C09, {   -1,    -1,  9296,    -1,    -1}},
+    {0x129D01, { 2142,    -1,  4834,    -1,    -1}},
+    {0x129D07, {   -1,    -1,  7588,    -1,    -1}},
+    {0x129D09, {   -1,    -1,  9337,    -1,    -1}},
+    {0x129E01, { 2185,    -1,  4875,    -1,    -1}},
+    {0x129E07, {   -1,    -1,  7629,    -1,    -1}},
+    {0x129E09, {   -1,    -1,  9378,    -1,    -1}},
+    {0x129F01, { 2232,    -1,    -1,    -1,    -1}},
+    {0x12A001, {   -1,    -1,  4942,    -1,    -1}},
+    {0x12A003, { 1477,    -1,    -1,    -1,    -1}},
+    {0x12A007, {   -1,    -1,  7700,    -1,    -1}},
+    {0x12A009, {   -1,    -1,  9445,    -1,    -1}},
+    {0x12A101, {   -1,    -1,  5029,    -1,    -1}},
+    {0x12A103, { 1500,    -1,    -1,    -1,    -1}},
+    {0x12A109, {   -1,    -1,  9532,    -1,    -1}},
+    {0x12A203, { 1523,    -1,    -1,    -1,    -1}},
+    {0x12A801, {   -1,    -1,  5110,    -1,    -1}},
+    {0x12A807, {   -1,    -1,  7785,    -1,    -1}},
+    {0x12A809, {   -1,    -1,  9613,    -1,    -1}},
+    {0x12A901, { 2332,    -1,  5197,    -1,    -1}},
+    {0x12A909, {   -1,    -1,  9700,    -1,    -1}},
+    {0x12AB00, {  255,    -1,    -1,    -1,    -1}},
+    {0x12B001, {   -1,    -1,  5306,    -1,    -1}},
+    {0x12B007, {   -1,    -1,  7842,    -1,    -1}},
+    {0x12B009, {   -1,    -1,  9809,    -1,    -1}},
+    {0x12B101, {   -1,    -1,  5387,    -1,    -1}},
+    {0x12B105, {   -1,    -1,  6735,    -1,    -1}},
+    {0x12B107, {   -1,    -1,  7923,    -1,    -1}},
+    {0x12B109, {   -1,    -1,  9890,    -1,    -1}},
+    {0x12B201, {   -1,    -1,  5462,    -1,    -1}},
+    {0x12B207, {   -1,    -1,  7998,    -1,    -1}},
+    {0x12B209, {   -1,    -1,  9965,    -1,    -1}},
+    {0x12B301, {   -1,    -1,  5549,    -1,    -1}},
+    {0x12B309, {   -1,    -1, 10052,    -1,    -1}},
+    {0x12B401, {   -1,    -1,  5636,    -1,    -1}},
+    {0x12B407, {   -1,    -1,  8085,    -1,    -1}},
+    {0x12B409, {   -1,    -1, 10139,    -1,    -1}},
+    {0x12B501, {   -1,    -1,  5695,    -1,    -1}},
+    {0x12B507, {   -1,    -1,  8142,    -1,    -1}},
+    {0x12B509, {   -1,    -1, 10198,    -1,    -1}},
+    {0x12B601, {   -1,    -1,  5756,    -1,    -1}},
+    {0x12B609, {   -1,    -1, 10259,    -1,    -1}},
+    {0x12B801, { 2380,    -1,  5824,    -1,    -1}},
+    {0x12B805, {   -1,    -1,  6856,    -1,    -1}},
+    {0x12B807, {   -1,    -1,  8218,    -1,    -1}},
+    {0x12B809, {   -1,    -1, 10327,    -1,    -1}},
+    {0x12B901, { 2409,    -1,  5885,    -1,    -1}},
+    {0x12B905, {   -1,    -1,  6911,    -1,    -1}},
+    {0x12B907, {   -1,    -1,  8279,    -1,    -1}},
+    {0x12B909, {   -1,    -1, 10388,    -1,    -1}},
+    {0x12BA01, {   -1,    -1,  5938,    -1,    -1}},
+    {0x12BA07, {   -1,    -1,  8332,    -1,    -1}},
+    {0x12BA09, {   -1,    -1, 10441,    -1,    -1}},
+    {0x12BB01, {   -1,    -1,  6013,    -1,    -1}},
+    {0x12BB09, {   -1,    -1, 10516,    -1,    -1}},
+    {0x12BC01, {   -1,    -1,  6102,    -1,    -1}},
+    {0x12BC09, {   -1,    -1, 10605,    -1,    -1}},
+    {0x12BD01, {   -1,    -1,  6157,    -1,    -1}},
+    {0x12BD09, {   -1,    -1, 10660,    -1,    -1}},
+    {0x12BE01, {   -1,    -1,  6214,    -1,    -1}},
+    {0x12BE09, {   -1,    -1, 10717,    -1,    -1}},
+    {0x12C001, { 2440,    -1,    -1,    -1,    -1}},
+    {0x12C101, { 2489,    -1,    -1,    -1,    -1}},
+    {0x12C201, { 2537,    -1,    -1,    -1,    -1}},
+    {0x12FE00, {  942,    -1,    -1,    -1,    -1}},
+    {0x12FE01, { 2575,    -1,    -1,    -1,    -1}},
+    {0x12FF00, { 1070,    -1,    -1,    -1,    -1}},
+    {0x12FF01, { 2615,    -1,    -1,    -1,    -1}},
+    {0x12FF03, {   -1,    -1,  6458,    -1,    -1}},
+    {0x130000, {   -1,    -1,    -1,    -1,    38}},
+    {0x130001, { 1545,    -1,    -1,    -1,   131}},
+    {0x130002, {   -1,     0,   536,    -1,    -1}},
+    {0x130003, { 1324,    -1,  6285,    -1,    -1}},
+    {0x130004, {   -1,    -1,   863,    -1,    -1}},
+    {0x130005, {   -1,    -1,  6536,    -1,    -1}},
+    {0x130006, {   -1,    -1,  1078,    -1,    -1}},
+    {0x130007, {   -1,    -1,  6999,    -1,    -1}},
+    {0x130008, {   -1,    -1,  1248,    -1,    -1}},
+    {0x130009, {   -1,    -1,  8425,    -1,    -1}},
+    {0x13000A, {   -1,    -1,  1388,    -1,    -1}},
+    {0x13000C, {   -1,    -1,  1503,    -1,    -1}},
+    {0x130010, {   -1,    61,  1683,    -1,    -1}},
+    {0x130012, {   -1,    -1,  2079,    -1,    -1}},
+    {0x130014, {   -1,    -1,  2274,    -1,    -1}},
+    {0x130016, {   -1,    -1,  2383,    -1,    -1}},
+    {0x130018, {   -1,    -1,  2462,    -1,    -1}},
+    {0x13001A, {   -1,    -1,  2520,    -1,    -1}},
+    {0x13001C, {   -1,    -1,  2558,    -1,    -1}},
+    {0x13001E, {   -1,    -1,  2586,    -1,    -1}},
+    {0x130020, {   -1,    -1,  2634,    -1,    -1}},
+    {0x130022, {   -1,    -1,  2856,    -1,    -1}},
+    {0x130024, {   -1,    -1,  2967,    -1,    -1}},
+    {0x130026, {   -1,    -1,  3032,    -1,    -1}},
+    {0x130028, {   -1,    -1,  3082,    -1,    -1}},
+    {0x13002A, {   -1,    -1,  3115,    -1,    -1}},
+    {0x13002C, {   -1,    -1,  3141,    -1,    -1}},
+    {0x13002E, {   -1,    -1,  3169,    -1,    -1}},
+    {0x130030, {   -1,    -1,  3210,    -1,    -1}},
+    {0x130040, {   -1,    -1,  3538,    -1,    -1}},
+    {0x130042, {   -1,    -1,  3609,    -1,    -1}},
+    {0x130044, {   -1,    -1,  3641,    -1,    -1}},
+    {0x130046, {   -1,    -1,  3659,    -1,    -1}},
+    {0x130048, {   -1,    -1,  3678,    -1,    -1}},
+    {0x130050, {   -1,    -1,  3717,    -1,    -1}},
+    {0x130052, {   -1,    -1,  3746,    -1,    -1}},
+    {0x130054, {   -1,    -1,  3763,    -1,    -1}},
+    {0x130056, {   -1,    -1,  3780,    -1,    -1}},
+    {0x130058, {   -1,    -1,  3791,    -1,    -1}},
+    {0x130080, { 1275,    -1,    -1,    -1,    -1}},
+    {0x1300F1, {   -1,    -1,    -1,   267,    -1}},
+    {0x1300F2, {   -1,    -1,    -1,    38,    -1}},
+    {0x130100, {   -1,    -1,    38,    -1,    -1}},
+    {0x130101, { 1565,    -1,  4042,    -1,    -1}},
+    {0x130102, {   -1,    -1,   605,    -1,    -1}},
+    {0x130103, { 1346,    -1,    -1,    -1,    -1}},
+    {0x130105, {   -1,    -1,  6588,    -1,    -1}},
+    {0x130107, {   -1,    -1,  7087,    -1,    -1}},
+    {0x130109, {   -1,    -1,  8545,    -1,    -1}},
+    {0x130110, {   -1,    -1,  1776,    -1,    -1}},
+    {0x1301F2, {   -1,    -1,    -1,   153,    -1}},
+    {0x1301FC, {   -1,    -1,  3852,    -1,    -1}},
+    {0x1301FE, {   -1,    -1,  3916,    -1,    -1}},
+    {0x130200, {   -1,    -1,   166,    -1,    -1}},
+    {0x130201, { 1580,    -1,  4143,    -1,    -1}},
+    {0x130202, {   -1,    -1,   632,    -1,    -1}},
+    {0x130207, {   -1,    -1,  7114,    -1,    -1}},
+    {0x130209, {   -1,    -1,  8646,    -1,    -1}},
+    {0x130210, {   -1,    -1,  1817,    -1,    -1}},
+    {0x130212, {   -1,    -1,  2136,    -1,    -1}},
+    {0x130214, {   -1,    -1,  2311,    -1,    -1}},
+    {0x130220, {   -1,    -1,  2703,    -1,    -1}},
+    {0x1302F2, {   -1,    -1,    -1,   205,    -1}},
+    {0x130300, {   -1,    -1,   294,    -1,    -1}},
+    {0x130301, { 1632,    -1,    -1,    -1,    -1}},
+    {0x130302, {   -1,    -1,   693,    -1,    -1}},
+    {0x130304, {   -1,    -1,   959,    -1,    -1}},
+    {0x130306, {   -1,    -1,  1153,    -1,    -1}},
+    {0x130308, {   -1,    -1,  1311,    -1,    -1}},
+    {0x13030A, {   -1,    -1,  1441,    -1,    -1}},
+    {0x13030C, {   -1,    -1,  1541,    -1,    -1}},
+    {0x130310, {   -1,    -1,  1888,    -1,    -1}},
+    {0x130312, {   -1,    -1,  2163,    -1,    -1}},
+    {0x130314, {   -1,    -1,  2318,    -1,    -1}},
+    {0x130316, {   -1,    -1,  2414,    -1,    -1}},
+    {0x130318, {   -1,    -1,  2486,    -1,    -1}},
+    {0x13031A, {   -1,    -1,  2537,    -1,    -1}},
+    {0x13031C, {   -1,    -1,  2571,    -1,    -1}},
+    {0x13031E, {   -1,    -1,  2597,    -1,    -1}},
+    {0x130320, {   -1,    -1,  2741,    -1,    -1}},
+    {0x130322, {   -1,    -1,  2902,    -1,    -1}},
+    {0x130324, {   -1,    -1,  2995,    -1,    -1}},
+    {0x130330, {   -1,    -1,  3267,    -1,    -1}},
+    {0x1303F2, {   -1,    -1,    -1,   230,    -1}},
+    {0x130400, {   -1,    -1,   422,    -1,    -1}},
+    {0x130401, { 1693,    -1,    -1,    -1,    -1}},
+    {0x130402, {   -1,    -1,   779,    -1,    -1}},
+    {0x130404, {   -1,    -1,  1015,    -1,    -1}},
+    {0x130406, {   -1,    -1,  1192,    -1,    -1}},
+    {0x130408, {   -1,    -1,  1339,    -1,    -1}},
+    {0x13040A, {   -1,    -1,  1464,    -1,    -1}},
+    {0x13040C, {   -1,    -1,  1557,    -1,    -1}},
+    {0x130410, {   -1,    -1,  1990,    -1,    -1}},
+    {0x130412, {   -1,    -1,  2218,    -1,    -1}},
+    {0x130414, {   -1,    -1,  2344,    -1,    -1}},
+    {0x130416, {   -1,    -1,  2431,    -1,    -1}},
+    {0x130418, {   -1,    -1,  2496,    -1,    -1}},
+    {0x13041A, {   -1,    -1,  2541,    -1,    -1}},
+    {0x13041C, {   -1,    -1,  2573,    -1,    -1}},
+    {0x13041E, {   -1,    -1,  2599,    -1,    -1}},
+    {0x130420, {   -1,    -1,  2803,    -1,    -1}},
+    {0x130422, {   -1,    -1,  2931,    -1,    -1}},
+    {0x130424, {   -1,    -1,  3011,    -1,    -1}},
+    {0x130426, {   -1,    -1,  3063,    -1,    -1}},
+    {0x130428, {   -1,    -1,  3101,    -1,    -1}},
+    {0x13042A, {   -1,    -1,  3129,    -1,    -1}},
+    {0x13042C, {   -1,    -1,  3156,    -1,    -1}},
+    {0x13042E, {   -1,    -1,  3183,    -1,    -1}},
+    {0x130430, {   -1,    -1,  3300,    -1,    -1}},
+    {0x130440, {   -1,    -1,  3587,    -1,    -1}},
+    {0x130442, {   -1,    -1,  3631,    -1,    -1}},
+    {0x130444, {   -1,    -1,  3650,    -1,    -1}},
+    {0x130446, {   -1,    -1,  3670,    -1,    -1}},
+    {0x130448, {   -1,    -1,  3685,    -1,    -1}},
+    {0x130450, {   -1,    -1,  3735,    -1,    -1}},
+    {0x130452, {   -1,    -1,  3755,    -1,    -1}},
+    {0x130454, {   -1,    -1,  3772,    -1,    -1}},
+    {0x130456, {   -1,    -1,  3786,    -1,    -1}},
+    {0x130458, {   -1,    -1,  3796,    -1,    -1}},
+    {0x1304F2, {   -1,    -1,    -1,   242,    -1}},
+    {0x130501, { 1743,    -1,    -1,    -1,    -1}},
+    {0x130601, { 1790,    -1,    -1,    -1,    -1}},
+    {0x130701, { 1836,    -1,    -1,    -1,    -1}},
+    {0x130801, { 1870,    -1,  4226,    -1,    -1}},
+    {0x130805, {   -1,    -1,  6595,    -1,    -1}},
+    {0x130807, {   -1,    -1,  7141,    -1,    -1}},
+    {0x130809, {   -1,    -1,  8729,    -1,    -1}},
+    {0x130901, { 1887,    -1,  4282,    -1,    -1}},
+    {0x130907, {   -1,    -1,  7197,    -1,    -1}},
+    {0x130909, {   -1,    -1,  8785,    -1,    -1}},
+    {0x130A01, {   -1,    -1,  4380,    -1,    -1}},
+    {0x130A07, {   -1,    -1,  7285,    -1,    -1}},
+    {0x130A09, {   -1,    -1,  8883,    -1,    -1}},
+    {0x130B01, {   -1,    -1,  4423,    -1,    -1}},
+    {0x130B07, {   -1,    -1,  7319,    -1,    -1}},
+    {0x130B09, {   -1,    -1,  8926,    -1,    -1}},
+    {0x130C01, {   -1,    -1,  4471,    -1,    -1}},
+    {0x130C09, {   -1,    -1,  8974,    -1,    -1}},
+    {0x130D01, {   -1,    -1,  4523,    -1,    -1}},
+    {0x130D09, {   -1,    -1,  9026,    -1,    -1}},
+    {0x131001, { 1920,   105,  4571,    -1,    -1}},
+    {0x131003, { 1380,    -1,  6342,    -1,    -1}},
+    {0x131005, {   -1,    -1,  6607,    -1,    -1}},
+    {0x131007, {   -1,    -1,  7359,    -1,    -1}},
+    {0x131009, {   -1,    -1,  9074,    -1,    -1}},
+    {0x1310F1, {   -1,    -1,    -1,   324,    -1}},
+    {0x131101, { 1939,    -1,    -1,    -1,    -1}},
+    {0x131103, { 1400,    -1,    -1,    -1,    -1}},
+    {0x131200, {   55,    -1,    -1,    -1,    -1}},
+    {0x131203, { 1439,    -1,    -1,    -1,    -1}},
+    {0x131400, {   72,    -1,    -1,    -1,    -1}},
+    {0x131500, {   77,    -1,    -1,    -1,    -1}},
+    {0x131800, {   83,    -1,    -1,    -1,    -1}},
+    {0x131801, { 1974,   113,  4615,    -1,    -1}},
+    {0x131803, {   -1,    -1,  6350,    -1,    -1}},
+    {0x131805, {   -1,    -1,  6621,    -1,    -1}},
+    {0x131807, {   -1,    -1,  7385,    -1,    -1}},
+    {0x131809, {   -1,    -1,  9118,    -1,    -1}},
+    {0x1318F1, {   -1,    -1,    -1,   332,    -1}},
+    {0x131901, { 1991,   124,  4668,    -1,    -1}},
+    {0x131903, {   -1,    -1,  6361,    -1,    -1}},
+    {0x131905, {   -1,    -1,  6637,    -1,    -1}},
+    {0x131907, {   -1,    -1,  7425,    -1,    -1}},
+    {0x131909, {   -1,    -1,  9171,    -1,    -1}},
+    {0x1319F1, {   -1,    -1,    -1,   343,    -1}},
+    {0x131A01, { 2025,    -1,  4711,    -1,    -1}},
+    {0x131A05, {   -1,    -1,  6659,    -1,    -1}},
+    {0x131A07, {   -1,    -1,  7466,    -1,    -1}},
+    {0x131A09, {   -1,    -1,  9214,    -1,    -1}},
+    {0x131B00, {   95,    -1,    -1,    -1,    -1}},
+    {0x131B01, { 2066,    -1,  4753,    -1,    -1}},
+    {0x131B07, {   -1,    -1,  7507,    -1,    -1}},
+    {0x131B09, {   -1,    -1,  9256,    -1,    -1}},
+    {0x131C00, {  102,    -1,    -1,    -1,    -1}},
+    {0x131C01, { 2099,    -1,  4794,    -1,    -1}},
+    {0x131C07, {   -1,    -1,  7548,    -1,    -1}},
+    {0x131C09, {   -1,    -1,  9297,    -1,    -1}},
+    {0x131D00, {  104,    -1,    -1,    -1,    -1}},
+    {0x131D01, { 2143,    -1,  4835,    -1,    -1}},
+    {0x131D07, {   -1,    -1,  7589,    -1,    -1}},
+    {0x131D09, {   -1,    -1,  9338,    -1,    -1}},
+    {0x131E01, { 2186,    -1,  4876,    -1,    -1}},
+    {0x131E07, {   -1,    -1,  7630,    -1,    -1}},
+    {0x131E09, {   -1,    -1,  9379,    -1,    -1}},
+    {0x131F01, { 2233,    -1,    -1,    -1,    -1}},
+    {0x132001, {   -1,    -1,  4943,    -1,    -1}},
+    {0x132003, { 1478,    -1,    -1,    -1,    -1}},
+    {0x132005, {   -1,    -1,  6677,    -1,    -1}},
+    {0x132007, {   -1,    -1,  7701,    -1,    -1}},
+    {0x132009, {   -1,    -1,  9446,    -1,    -1}},
+    {0x132101, { 2284,    -1,  5030,    -1,    -1}},
+    {0x132103, { 1501,    -1,    -1,    -1,    -1}},
+    {0x132109, {   -1,    -1,  9533,    -1,    -1}},
+    {0x132203, { 1524,    -1,    -1,    -1,    -1}},
+    {0x132300, {  147,    -1,    -1,    -1,    -1}},
+    {0x132800, {  191,    -1,    -1,    -1,    -1}},
+    {0x132801, { 2316,   145,  5111,    -1,    -1}},
+    {0x132803, {   -1,    -1,  6382,    -1,    -1}},
+    {0x132805, {   -1,    -1,  6684,    -1,    -1}},
+    {0x132807, {   -1,    -1,  7786,    -1,    -1}},
+    {0x132809, {   -1,    -1,  9614,    -1,    -1}},
+    {0x1328F1, {   -1,    -1,    -1,   364,    -1}},
+    {0x132900, {  228,    -1,    -1,    -1,    -1}},
+    {0x132901, { 2333,    -1,  5198,    -1,    -1}},
+    {0x132909, {   -1,    -1,  9701,    -1,    -1}},
+    {0x132A00, {  242,    -1,    -1,    -1,    -1}},
+    {0x132A01, {   -1,    -1,  5226,    -1,    -1}},
+    {0x132A09, {   -1,    -1,  9729,    -1,    -1}},
+    {0x133001, { 2358,   154,  5307,    -1,    -1}},
+    {0x133003, {   -1,    -1,  6391,    -1,    -1}},
+    {0x133005, {   -1,    -1,  6704,    -1,    -1}},
+    {0x133007, {   -1,    -1,  7843,    -1,    -1}},
+    {0x133009, {   -1,    -1,  9810,    -1,    -1}},
+    {0x1330F1, {   -1,    -1,    -1,   373,    -1}},
+    {0x133101, {   -1,    -1,  5388,    -1,    -1}},
+    {0x133105, {   -1,    -1,  6736,    -1,    -1}},
+    {0x133107, {   -1,    -1,  7924,    -1,    -1}},
+    {0x133109, {   -1,    -1,  9891,    -1,    -1}},
+    {0x133201, {   -1,    -1,  5463,    -1,    -1}},
+    {0x133207, {   -1,    -1,  7999,    -1,    -1}},
+    {0x133209, {   -1,    -1,  9966,    -1,    -1}},
+    {0x133301, {   -1,    -1,  5550,    -1,    -1}},
+    {0x133309, {   -1,    -1, 10053,    -1,    -1}},
+    {0x133401, {   -1,    -1,  5637,    -1,    -1}},
+    {0x133407, {   -1,    -1,  8086,    -1,    -1}},
+    {0x133409, {   -1,    -1, 10140,    -1,    -1}},
+    {0x133501, {   -1,    -1,  5696,    -1,    -1}},
+    {0x133507, {   -1,    -1,  8143,    -1,    -1}},
+    {0x133509, {   -1,    -1, 10199,    -1,    -1}},
+    {0x133601, {   -1,    -1,  5757,    -1,    -1}},
+    {0x133609, {   -1,    -1, 10260,    -1,    -1}},
+    {0x133801, { 2381,    -1,  5825,    -1,    -1}},
+    {0x133805, {   -1,    -1,  6857,    -1,    -1}},
+    {0x133807, {   -1,    -1,  8219,    -1,    -1}},
+    {0x133809, {   -1,    -1, 10328,    -1,    -1}},
+    {0x133901, { 2410,    -1,  5886,    -1,    -1}},
+    {0x133905, {   -1,    -1,  6912,    -1,    -1}},
+    {0x133907, {   -1,    -1,  8280,    -1,    -1}},
+    {0x133909, {   -1,    -1, 10389,    -1,    -1}},
+    {0x133A01, {   -1,    -1,  5939,    -1,    -1}},
+    {0x133A07, {   -1,    -1,  8333,    -1,    -1}},
+    {0x133A09, {   -1,    -1, 10442,    -1,    -1}},
+    {0x133B01, {   -1,    -1,  6014,    -1,    -1}},
+    {0x133B09, {   -1,    -1, 10517,    -1,    -1}},
+    {0x133C01, {   -1,    -1,  6103,    -1,    -1}},
+    {0x133C09, {   -1,    -1, 10606,    -1,    -1}},
+    {0x133D01, {   -1,    -1,  6158,    -1,    -1}},
+    {0x133D09, {   -1,    -1, 10661,    -1,    -1}},
+    {0x133E01, {   -1,    -1,  6215,    -1,    -1}},
+    {0x133E09, {   -1,    -1, 10718,    -1,    -1}},
+    {0x134000, {  304,    -1,    -1,    -1,    -1}},
+    {0x134001, { 2441,    -1,    -1,    -1,    -1}},
+    {0x134100, {  396,    -1,    -1,    -1,    -1}},
+    {0x134101, { 2490,    -1,    -1,    -1,    -1}},
+    {0x134200, {  474,    -1,    -1,    -1,    -1}},
+    {0x134201, { 2538,    -1,    -1,    -1,    -1}},
+    {0x134300, {  542,    -1,    -1,    -1,    -1}},
+    {0x134400, {  590,    -1,    -1,    -1,    -1}},
+    {0x134500, {  624,    -1,    -1,    -1,    -1}},
+    {0x134600, {  654,    -1,    -1,    -1,    -1}},
+    {0x134700, {  682,    -1,    -1,    -1,    -1}},
+    {0x134800, {  705,    -1,    -1,    -1,    -1}},
+    {0x134900, {  724,    -1,    -1,    -1,    -1}},
+    {0x134A00, {  742,    -1,    -1,    -1,    -1}},
+    {0x134B00, {  757,    -1,    -1,    -1,    -1}},
+    {0x134C00, {  771,    -1,    -1,    -1,    -1}},
+    {0x134D00, {  782,    -1,    -1,    -1,    -1}},
+    {0x134E00, {  791,    -1,    -1,    -1,    -1}},
+    {0x134F00, {  800,    -1,    -1,    -1,    -1}},
+    {0x135000, {  805,    -1,    -1,    -1,    -1}},
+    {0x135100, {  810,    -1,    -1,    -1,    -1}},
+    {0x135200, {  813,    -1,    -1,    -1,    -1}},
+    {0x135300, {  816,    -1,    -1,    -1,    -1}},
+    {0x135400, {  819,    -1,    -1,    -1,    -1}},
+    {0x135500, {  822,    -1,    -1,    -1,    -1}},
+    {0x135600, {  824,    -1,    -1,    -1,    -1}},
+    {0x135700, {  826,    -1,    -1,    -1,    -1}},
+    {0x135800, {  828,    -1,    -1,    -1,    -1}},
+    {0x135900, {  830,    -1,    -1,    -1,    -1}},
+    {0x135A00, {  832,    -1,    -1,    -1,    -1}},
+    {0x135B00, {  834,    -1,    -1,    -1,    -1}},
+    {0x135C00, {  836,    -1,    -1,    -1,    -1}},
+    {0x135D00, {  837,    -1,    -1,    -1,    -1}},
+    {0x135E00, {  838,    -1,    -1,    -1,    -1}},
+    {0x136000, {  848,    -1,    -1,    -1,    -1}},
+    {0x137E00, {  943,    -1,    -1,    -1,    -1}},
+    {0x137E01, { 2576,    -1,    -1,    -1,    -1}},
+    {0x137F00, { 1071,    -1,    -1,    -1,    -1}},
+    {0x137F01, { 2616,    -1,    -1,    -1,    -1}},
+    {0x137F03, {   -1,    -1,  6459,    -1,    -1}},
+    {0x138000, {   -1,    -1,    -1,    -1,    39}},
+    {0x138001, {   -1,    -1,    -1,    -1,   132}},
+    {0x138002, {   -1,    -1,   537,    -1,    -1}},
+    {0x138003, { 1325,    -1,  6286,    -1,    -1}},
+    {0x138004, {   -1,    -1,   864,    -1,    -1}},
+    {0x138005, {   -1,    -1,  6537,    -1,    -1}},
+    {0x138006, {   -1,    -1,  1079,    -1,    -1}},
+    {0x138007, {   -1,    -1,  7000,    -1,    -1}},
+    {0x138008, {   -1,    -1,  1249,    -1,    -1}},
+    {0x138009, {   -1,    -1,  8426,    -1,    -1}},
+    {0x13800A, {   -1,    -1,  1389,    -1,    -1}},
+    {0x13800C, {   -1,    -1,  1504,    -1,    -1}},
+    {0x13800E, {   -1,    -1,  1589,    -1,    -1}},
+    {0x138010, {   -1,    62,  1684,    -1,    -1}},
+    {0x138012, {   -1,    -1,  2080,    -1,    -1}},
+    {0x138014, {   -1,    -1,  2275,    -1,    -1}},
+    {0x138016, {   -1,    -1,  2384,    -1,    -1}},
+    {0x138018, {   -1,    -1,  2463,    -1,    -1}},
+    {0x13801A, {   -1,    -1,  2521,    -1,    -1}},
+    {0x13801C, {   -1,    -1,  2559,    -1,    -1}},
+    {0x13801E, {   -1,    -1,  2587,    -1,    -1}},
+    {0x138020, {   -1,    89,  2635,    -1,    -1}},
+    {0x138022, {   -1,    -1,  2857,    -1,    -1}},
+    {0x138024, {   -1,    -1,  2968,    -1,    -1}},
+    {0x138026, {   -1,    -1,  3033,    -1,    -1}},
+    {0x138028, {   -1,    -1,  3083,    -1,    -1}},
+    {0x13802A, {   -1,    -1,  3116,    -1,    -1}},
+    {0x13802C, {   -1,    -1,  3142,    -1,    -1}},
+    {0x13802E, {   -1,    -1,  3170,    -1,    -1}},
+    {0x138030, {   -1,    -1,  3211,    -1,    -1}},
+    {0x138032, {   -1,    -1,  3334,    -1,    -1}},
+    {0x138034, {   -1,    -1,  3394,    -1,    -1}},
+    {0x138036, {   -1,    -1,  3436,    -1,    -1}},
+    {0x138038, {   -1,    -1,  3463,    -1,    -1}},
+    {0x13803A, {   -1,    -1,  3485,    -1,    -1}},
+    {0x13803C, {   -1,    -1,  3501,    -1,    -1}},
+    {0x13803E, {   -1,    -1,  3516,    -1,    -1}},
+    {0x138040, {   -1,    -1,  3539,    -1,    -1}},
+    {0x138042, {   -1,    -1,  3610,    -1,    -1}},
+    {0x138044, {   -1,    -1,  3642,    -1,    -1}},
+    {0x138046, {   -1,    -1,  3660,    -1,    -1}},
+    {0x138048, {   -1,    -1,  3679,    -1,    -1}},
+    {0x13804A, {   -1,    -1,  3692,    -1,    -1}},
+    {0x13804C, {   -1,    -1,  3702,    -1,    -1}},
+    {0x13804E, {   -1,    -1,  3710,    -1,    -1}},
+    {0x138050, {   -1,    -1,  3718,    -1,    -1}},
+    {0x138052, {   -1,    -1,  3747,    -1,    -1}},
+    {0x138054, {   -1,    -1,  3764,    -1,    -1}},
+    {0x1380F1, {   -1,    -1,    -1,   268,    -1}},
+    {0x1380F2, {   -1,    -1,    -1,    39,    -1}},
+    {0x138100, {   -1,    -1,    39,    -1,    -1}},
+    {0x138101, {   -1,    -1,  4043,    -1,    -1}},
+    {0x138103, { 1347,    -1,    -1,    -1,    -1}},
+    {0x138107, {   -1,    -1,  7088,    -1,    -1}},
+    {0x138109, {   -1,    -1,  8546,    -1,    -1}},
+    {0x138110, {   -1,    -1,  1777,    -1,    -1}},
+    {0x138120, {   -1,    -1,  2687,    -1,    -1}},
+    {0x1381F2, {   -1,    -1,    -1,   154,    -1}},
+    {0x1381FC, {   -1,    -1,  3853,    -1,    -1}},
+    {0x1381FE, {   -1,    -1,  3917,    -1,    -1}},
+    {0x138200, {   -1,    -1,   167,    -1,    -1}},
+    {0x138201, {   -1,    -1,  4144,    -1,    -1}},
+    {0x138202, {   -1,    -1,   633,    -1,    -1}},
+    {0x138204, {   -1,    -1,   929,    -1,    -1}},
+    {0x138206, {   -1,    -1,  1133,    -1,    -1}},
+    {0x138207, {   -1,    -1,  7115,    -1,    -1}},
+    {0x138209, {   -1,    -1,  8647,    -1,    -1}},
+    {0x138210, {   -1,    -1,  1818,    -1,    -1}},
+    {0x138212, {   -1,    -1,  2137,    -1,    -1}},
+    {0x138220, {   -1,    -1,  2704,    -1,    -1}},
+    {0x138222, {   -1,    -1,  2890,    -1,    -1}},
+    {0x138224, {   -1,    -1,  2988,    -1,    -1}},
+    {0x138226, {   -1,    -1,  3050,    -1,    -1}},
+    {0x1382F2, {   -1,    -1,    -1,   206,    -1}},
+    {0x138300, {   -1,    -1,   295,    -1,    -1}},
+    {0x138301, { 1633,    -1,    -1,    -1,    -1}},
+    {0x138302, {   -1,    -1,   694,    -1,    -1}},
+    {0x138304, {   -1,    -1,   960,    -1,    -1}},
+    {0x138306, {   -1,    -1,  1154,    -1,    -1}},
+    {0x138308, {   -1,    -1,  1312,    -1,    -1}},
+    {0x13830A, {   -1,    -1,  1442,    -1,    -1}},
+    {0x13830C, {   -1,    -1,  1542,    -1,    -1}},
+    {0x13830E, {   -1,    -1,  1615,    -1,    -1}},
+    {0x138310, {   -1,    -1,  1889,    -1,    -1}},
+    {0x138312, {   -1,    -1,  2164,    -1,    -1}},
+    {0x138314, {   -1,    -1,  2319,    -1,    -1}},
+    {0x138316, {   -1,    -1,  2415,    -1,    -1}},
+    {0x138318, {   -1,    -1,  2487,    -1,    -1}},
+    {0x13831A, {   -1,    -1,  2538,    -1,    -1}},
+    {0x138320, {   -1,    -1,  2742,    -1,    -1}},
+    {0x138322, {   -1,    -1,  2903,    -1,    -1}},
+    {0x138324, {   -1,    -1,  2996,    -1,    -1}},
+    {0x138326, {   -1,    -1,  3054,    -1,    -1}},
+    {0x138328, {   -1,    -1,  3095,    -1,    -1}},
+    {0x13832A, {   -1,    -1,  3126,    -1,    -1}},
+    {0x13832C, {   -1,    -1,  3153,    -1,    -1}},
+    {0x13832E, {   -1,    -1,  3180,    -1,    -1}},
+    {0x138330, {   -1,    -1,  3268,    -1,    -1}},
+    {0x138332, {   -1,    -1,  3359,    -1,    -1}},
+    {0x138334, {   -1,    -1,  3412,    -1,    -1}},
+    {0x138336, {   -1,    -1,  3447,    -1,    -1}},
+    {0x138338, {   -1,    -1,  3472,    -1,    -1}},
+    {0x1383F2, {   -1,    -1,    -1,   231,    -1}},
+    {0x138400, {   -1,    -1,   423,    -1,    -1}},
+    {0x138401, { 1694,    -1,    -1,    -1,    -1}},
+    {0x138402, {   -1,    -1,   780,    -1,    -1}},
+    {0x138404, {   -1,    -1,  1016,    -1,    -1}},
+    {0x138406, {   -1,    -1,  1193,    -1,    -1}},
+    {0x138408, {   -1,    -1,  1340,    -1,    -1}},
+    {0x13840A, {   -1,    -1,  1465,    -1,    -1}},
+    {0x13840C, {   -1,    -1,  1558,    -1,    -1}},
+    {0x13840E, {   -1,    -1,  1626,    -1,    -1}},
+    {0x138410, {   -1,    -1,  1991,    -1,    -1}},
+    {0x138412, {   -1,    -1,  2219,    -1,    -1}},
+    {0x138414, {   -1,    -1,  2345,    -1,    -1}},
+    {0x138416, {   -1,    -1,  2432,    -1,    -1}},
+    {0x138418, {   -1,    -1,  2497,    -1,    -1}},
+    {0x13841A, {   -1,    -1,  2542,    -1,    -1}},
+    {0x13841C, {   -1,    -1,  2574,    -1,    -1}},
+    {0x13841E, {   -1,    -1,  2600,    -1,    -1}},
+    {0x138420, {   -1,    -1,  2804,    -1,    -1}},
+    {0x138422, {   -1,    -1,  2932,    -1,    -1}},
+    {0x138424, {   -1,    -1,  3012,    -1,    -1}},
+    {0x138426, {   -1,    -1,  3064,    -1,    -1}},
+    {0x138428, {   -1,    -1,  3102,    -1,    -1}},
+    {0x13842A, {   -1,    -1,  3130,    -1,    -1}},
+    {0x13842C, {   -1,    -1,  3157,    -1,    -1}},
+    {0x13842E, {   -1,    -1,  3184,    -1,    -1}},
+    {0x138430, {   -1,    -1,  3301,    -1,    -1}},
+    {0x138432, {   -1,    -1,  3373,    -1,    -1}},
+    {0x138434, {   -1,    -1,  3419,    -1,    -1}},
+    {0x138436, {   -1,    -1,  3452,    -1,    -1}},
+    {0x138438, {   -1,    -1,  3476,    -1,    -1}},
+    {0x13843A, {   -1,    -1,  3494,    -1,    -1}},
+    {0x13843C, {   -1,    -1,  3509,    -1,    -1}},
+    {0x13843E, {   -1,    -1,  3524,    -1,    -1}},
+    {0x138440, {   -1,    -1,  3588,    -1,    -1}},
+    {0x138442, {   -1,    -1,  3632,    -1,    -1}},
+    {0x138444, {   -1,    -1,  3651,    -1,    -1}},
+    {0x138446, {   -1,    -1,  3671,    -1,    -1}},
+    {0x138448, {   -1,    -1,  3686,    -1,    -1}},
+    {0x13844A, {   -1,    -1,  3697,    -1,    -1}},
+    {0x13844C, {   -1,    -1,  3706,    -1,    -1}},
+    {0x13844E, {   -1,    -1,  3713,    -1,    -1}},
+    {0x138450, {   -1,    -1,  3736,    -1,    -1}},
+    {0x138452, {   -1,    -1,  3756,    -1,    -1}},
+    {0x138454, {   -1,    -1,  3773,    -1,    -1}},
+    {0x138501, { 1744,    -1,    -1,    -1,    -1}},
+    {0x138600, {   17,    -1,    -1,    -1,    -1}},
+    {0x138801, {   -1,    -1,  4227,    -1,    -1}},
+    {0x138807, {   -1,    -1,  7142,    -1,    -1}},
+    {0x138809, {   -1,    -1,  8730,    -1,    -1}},
+    {0x138901, {   -1,    -1,  4283,    -1,    -1}},
+    {0x138907, {   -1,    -1,  7198,    -1,    -1}},
+    {0x138909, {   -1,    -1,  8786,    -1,    -1}},
+    {0x138A01, {   -1,    -1,  4381,    -1,    -1}},
+    {0x138A07, {   -1,    -1,  7286,    -1,    -1}},
+    {0x138A09, {   -1,    -1,  8884,    -1,    -1}},
+    {0x138B01, {   -1,    -1,  4424,    -1,    -1}},
+    {0x138B07, {   -1,    -1,  7320,    -1,    -1}},
+    {0x138B09, {   -1,    -1,  8927,    -1,    -1}},
+    {0x138C00, {   33,    -1,    -1,    -1,    -1}},
+    {0x138C01, {   -1,    -1,  4472,    -1,    -1}},
+    {0x138C09, {   -1,    -1,  8975,    -1,    -1}},
+    {0x138D01, {   -1,    -1,  4524,    -1,    -1}},
+    {0x138D09, {   -1,    -1,  9027,    -1,    -1}},
+    {0x139001, {   -1,    -1,  4572,    -1,    -1}},
+    {0x139003, { 1381,    -1,    -1,    -1,    -1}},
+    {0x139007, {   -1,    -1,  7360,    -1,    -1}},
+    {0x139009, {   -1,    -1,  9075,    -1,    -1}},
+    {0x139103, { 1401,    -1,    -1,    -1,    -1}},
+    {0x139200, {   56,    -1,    -1,    -1,    -1}},
+    {0x139203, { 1440,    -1,    -1,    -1,    -1}},
+    {0x139300, {   67,    -1,    -1,    -1,    -1}},
+    {0x139600, {   80,    -1,    -1,    -1,    -1}},
+    {0x139801, {   -1,    -1,  4616,    -1,    -1}},
+    {0x139807, {   -1,    -1,  7386,    -1,    -1}},
+    {0x139809, {   -1,    -1,  9119,    -1,    -1}},
+    {0x139901, {   -1,    -1,  4669,    -1,    -1}},
+    {0x139907, {   -1,    -1,  7426,    -1,    -1}},
+    {0x139909, {   -1,    -1,  9172,    -1,    -1}},
+    {0x139A01, {   -1,    -1,  4712,    -1,    -1}},
+    {0x139A07, {   -1,    -1,  7467,    -1,    -1}},
+    {0x139A09, {   -1,    -1,  9215,    -1,    -1}},
+    {0x139B01, {   -1,    -1,  4754,    -1,    -1}},
+    {0x139B07, {   -1,    -1,  7508,    -1,    -1}},
+    {0x139B09, {   -1,    -1,  9257,    -1,    -1}},
+    {0x139C01, {   -1,    -1,  4795,    -1,    -1}},
+    {0x139C07, {   -1,    -1,  7549,    -1,    -1}},
+    {0x139C09, {   -1,    -1,  9298,    -1,    -1}},
+    {0x139D01, {   -1,    -1,  4836,    -1,    -1}},
+    {0x139D07, {   -1,    -1,  7590,    -1,    -1}},
+    {0x139D09, {   -1,    -1,  9339,    -1,    -1}},
+    {0x139E01, { 2187,    -1,  4877,    -1,    -1}},
+    {0x139E07, {   -1,    -1,  7631,    -1,    -1}},
+    {0x139E09, {   -1,    -1,  9380,    -1,    -1}},
+    {0x139F01, { 2234,    -1,    -1,    -1,    -1}},
+    {0x13A000, {  125,    -1,    -1,    -1,    -1}},
+    {0x13A001, {   -1,    -1,  4944,    -1,    -1}},
+    {0x13A003, { 1479,    -1,    -1,    -1,    -1}},
+    {0x13A005, {   -1,    -1,  6678,    -1,    -1}},
+    {0x13A007, {   -1,    -1,  7702,    -1,    -1}},
+    {0x13A009, {   -1,    -1,  9447,    -1,    -1}},
+    {0x13A101, {   -1,    -1,  5031,    -1,    -1}},
+    {0x13A103, { 1502,    -1,    -1,    -1,    -1}},
+    {0x13A109, {   -1,    -1,  9534,    -1,    -1}},
+    {0x13A203, { 1525,    -1,    -1,    -1,    -1}},
+    {0x13A800, {  192,    -1,    -1,    -1,    -1}},
+    {0x13A801, {   -1,   146,  5112,    -1,    -1}},
+    {0x13A803, {   -1,    -1,  6383,    -1,    -1}},
+    {0x13A805, {   -1,    -1,  6685,    -1,    -1}},
+    {0x13A807, {   -1,    -1,  7787,    -1,    -1}},
+    {0x13A809, {   -1,    -1,  9615,    -1,    -1}},
+    {0x13A8F1, {   -1,    -1,    -1,   365,    -1}},
+    {0x13A900, {  229,    -1,    -1,    -1,    -1}},
+    {0x13A901, {   -1,    -1,  5199,    -1,    -1}},
+    {0x13A909, {   -1,    -1,  9702,    -1,    -1}},
+    {0x13AA00, {  243,    -1,    -1,    -1,    -1}},
+    {0x13AA01, {   -1,    -1,  5227,    -1,    -1}},
+    {0x13AA09, {   -1,    -1,  9730,    -1,    -1}},
+    {0x13B001, {   -1,   155,  5308,    -1,    -1}},
+    {0x13B003, {   -1,    -1,  6392,    -1,    -1}},
+    {0x13B005, {   -1,    -1,  6705,    -1,    -1}},
+    {0x13B007, {   -1,    -1,  7844,    -1,    -1}},
+    {0x13B009, {   -1,    -1,  9811,    -1,    -1}},
+    {0x13B0F1, {   -1,    -1,    -1,   374,    -1}},
+    {0x13B101, {   -1,    -1,  5389,    -1,    -1}},
+    {0x13B105, {   -1,    -1,  6737,    -1,    -1}},
+    {0x13B107, {   -1,    -1,  7925,    -1,    -1}},
+    {0x13B109, {   -1,    -1,  9892,    -1,    -1}},
+    {0x13B201, {   -1,    -1,  5464,    -1,    -1}},
+    {0x13B207, {   -1,    -1,  8000,    -1,    -1}},
+    {0x13B209, {   -1,    -1,  9967,    -1,    -1}},
+    {0x13B301, {   -1,    -1,  5551,    -1,    -1}},
+    {0x13B309, {   -1,    -1, 10054,    -1,    -1}},
+    {0x13B401, {   -1,    -1,  5638,    -1,    -1}},
+    {0x13B407, {   -1,    -1,  8087,    -1,    -1}},
+    {0x13B409, {   -1,    -1, 10141,    -1,    -1}},
+    {0x13B501, {   -1,    -1,  5697,    -1,    -1}},
+    {0x13B507, {   -1,    -1,  8144,    -1,    -1}},
+    {0x13B509, {   -1,    -1, 10200,    -1,    -1}},
+    {0x13B601, {   -1,    -1,  5758,    -1,    -1}},
+    {0x13B609, {   -1,    -1, 10261,    -1,    -1}},
+    {0x13B801, {   -1,   173,  5826,    -1,    -1}},
+    {0x13B803, {   -1,    -1,  6410,    -1,    -1}},
+    {0x13B805, {   -1,    -1,  6858,    -1,    -1}},
+    {0x13B807, {   -1,    -1,  8220,    -1,    -1}},
+    {0x13B809, {   -1,    -1, 10329,    -1,    -1}},
+    {0x13B8F1, {   -1,    -1,    -1,   392,    -1}},
+    {0x13B901, {   -1,    -1,  5887,    -1,    -1}},
+    {0x13B905, {   -1,    -1,  6913,    -1,    -1}},
+    {0x13B907, {   -1,    -1,  8281,    -1,    -1}},
+    {0x13B909, {   -1,    -1, 10390,    -1,    -1}},
+    {0x13BA01, {   -1,    -1,  5940,    -1,    -1}},
+    {0x13BA07, {   -1,    -1,  8334,    -1,    -1}},
+    {0x13BA09, {   -1,    -1, 10443,    -1,    -1}},
+    {0x13BB01, {   -1,    -1,  6015,    -1,    -1}},
+    {0x13BB09, {   -1,    -1, 10518,    -1,    -1}},
+    {0x13BC01, {   -1,    -1,  6104,    -1,    -1}},
+    {0x13BC09, {   -1,    -1, 10607,    -1,    -1}},
+    {0x13BD01, {   -1,    -1,  6159,    -1,    -1}},
+    {0x13BD09, {   -1,    -1, 10662,    -1,    -1}},
+    {0x13BE01, {   -1,    -1,  6216,    -1,    -1}},
+    {0x13BE09, {   -1,    -1, 10719,    -1,    -1}},
+    {0x13C000, {  305,    -1,    -1,    -1,    -1}},
+    {0x13C001, { 2442,    -1,    -1,    -1,    -1}},
+    {0x13C100, {  397,    -1,    -1,    -1,    -1}},
+    {0x13C101, { 2491,    -1,    -1,    -1,    -1}},
+    {0x13C200, {  475,    -1,    -1,    -1,    -1}},
+    {0x13C201, { 2539,    -1,    -1,    -1,    -1}},
+    {0x13C300, {  543,    -1,    -1,    -1,    -1}},
+    {0x13C400, {  591,    -1,    -1,    -1,    -1}},
+    {0x13C500, {  625,    -1,    -1,    -1,    -1}},
+    {0x13C600, {  655,    -1,    -1,    -1,    -1}},
+    {0x13C700, {  683,    -1,    -1,    -1,    -1}},
+    {0x13C800, {  706,    -1,    -1,    -1,    -1}},
+    {0x13C900, {  725,    -1,    -1,    -1,    -1}},
+    {0x13CA00, {  743,    -1,    -1,    -1,    -1}},
+    {0x13CB00, {  758,    -1,    -1,    -1,    -1}},
+    {0x13CC00, {  772,    -1,    -1,    -1,    -1}},
+    {0x13CD00, {  783,    -1,    -1,    -1,    -1}},
+    {0x13CE00, {  792,    -1,    -1,    -1,    -1}},
+    {0x13FE00, {  944,    -1,    -1,    -1,    -1}},
+    {0x13FF00, { 1072,    -1,    -1,    -1,    -1}},
+    {0x13FF01, { 2617,    -1,    -1,    -1,    -1}},
+    {0x13FF03, {   -1,    -1,  6460,    -1,    -1}},
+    {0x140000, {   -1,    -1,    -1,    -1,    40}},
+    {0x140001, { 1546,    -1,    -1,    -1,   133}},
+    {0x140002, {   -1,    -1,   538,    -1,    -1}},
+    {0x140003, { 1326,    -1,  6287,    -1,    -1}},
+    {0x140005, {   -1,    -1,  6538,    -1,    -1}},
+    {0x140007, {   -1,    -1,  7001,    -1,    -1}},
+    {0x140009, {   -1,    -1,  8427,    -1,    -1}},
+    {0x140010, {   -1,    63,  1685,    -1,    -1}},
+    {0x1400F1, {   -1,    -1,    -1,   269,    -1}},
+    {0x1400F2, {   -1,    -1,    -1,    40,    -1}},
+    {0x140100, {   -1,    -1,    40,    -1,    -1}},
+    {0x140101, { 1566,    -1,  4044,    -1,    -1}},
+    {0x140103, { 1348,    -1,    -1,    -1,    -1}},
+    {0x140105, {   -1,    -1,  6589,    -1,    -1}},
+    {0x140107, {   -1,    -1,  7089,    -1,    -1}},
+    {0x140109, {   -1,    -1,  8547,    -1,    -1}},
+    {0x140110, {   -1,    -1,  1778,    -1,    -1}},
+    {0x1401F2, {   -1,    -1,    -1,   155,    -1}},
+    {0x1401FC, {   -1,    -1,  3854,    -1,    -1}},
+    {0x1401FE, {   -1,    -1,  3918,    -1,    -1}},
+    {0x140200, {   -1,    -1,   168,    -1,    -1}},
+    {0x140201, { 1581,    -1,  4145,    -1,    -1}},
+    {0x140207, {   -1,    -1,  7116,    -1,    -1}},
+    {0x140209, {   -1,    -1,  8648,    -1,    -1}},
+    {0x140210, {   -1,    -1,  1819,    -1,    -1}},
+    {0x140300, {   -1,    -1,   296,    -1,    -1}},
+    {0x140301, { 1634,    -1,    -1,    -1,    -1}},
+    {0x140302, {   -1,    -1,   695,    -1,    -1}},
+    {0x140310, {   -1,    -1,  1890,    -1,    -1}},
+    {0x140400, {   -1,    -1,   424,    -1,    -1}},
+    {0x140401, { 1695,    -1,    -1,    -1,    -1}},
+    {0x140402, {   -1,    -1,   781,    -1,    -1}},
+    {0x140410, {   -1,    -1,  1992,    -1,    -1}},
+    {0x140501, { 1745,    -1,    -1,    -1,    -1}},
+    {0x140601, { 1791,    -1,    -1,    -1,    -1}},
+    {0x140701, { 1837,    -1,    -1,    -1,    -1}},
+    {0x140800, {   21,    -1,    -1,    -1,    -1}},
+    {0x140801, { 1871,    -1,  4228,    -1,    -1}},
+    {0x140805, {   -1,    -1,  6596,    -1,    -1}},
+    {0x140807, {   -1,    -1,  7143,    -1,    -1}},
+    {0x140809, {   -1,    -1,  8731,    -1,    -1}},
+    {0x140901, { 1888,    -1,  4284,    -1,    -1}},
+    {0x140907, {   -1,    -1,  7199,    -1,    -1}},
+    {0x140909, {   -1,    -1,  8787,    -1,    -1}},
+    {0x140A01, {   -1,    -1,  4382,    -1,    -1}},
+    {0x140A07, {   -1,    -1,  7287,    -1,    -1}},
+    {0x140A09, {   -1,    -1,  8885,    -1,    -1}},
+    {0x140B01, {   -1,    -1,  4425,    -1,    -1}},
+    {0x140B07, {   -1,    -1,  7321,    -1,    -1}},
+    {0x140B09, {   -1,    -1,  8928,    -1,    -1}},
+    {0x140C01, {   -1,    -1,  4473,    -1,    -1}},
+    {0x140C09, {   -1,    -1,  8976,    -1,    -1}},
+    {0x140D01, {   -1,    -1,  4525,    -1,    -1}},
+    {0x140D09, {   -1,    -1,  9028,    -1,    -1}},
+    {0x141001, { 1921,    -1,  4573,    -1,    -1}},
+    {0x141003, { 1382,    -1,    -1,    -1,    -1}},
+    {0x141005, {   -1,    -1,  6608,    -1,    -1}},
+    {0x141007, {   -1,    -1,  7361,    -1,    -1}},
+    {0x141009, {   -1,    -1,  9076,    -1,    -1}},
+    {0x141101, { 1940,    -1,    -1,    -1,    -1}},
+    {0x141103, { 1402,    -1,    -1,    -1,    -1}},
+    {0x141203, { 1441,    -1,    -1,    -1,    -1}},
+    {0x141801, { 1975,   114,  4617,    -1,    -1}},
+    {0x141803, {   -1,    -1,  6351,    -1,    -1}},
+    {0x141805, {   -1,    -1,  6622,    -1,    -1}},
+    {0x141807, {   -1,    -1,  7387,    -1,    -1}},
+    {0x141809, {   -1,    -1,  9120,    -1,    -1}},
+    {0x1418F1, {   -1,    -1,    -1,   333,    -1}},
+    {0x141901, { 1992,    -1,  4670,    -1,    -1}},
+    {0x141905, {   -1,    -1,  6638,    -1,    -1}},
+    {0x141907, {   -1,    -1,  7427,    -1,    -1}},
+    {0x141909, {   -1,    -1,  9173,    -1,    -1}},
+    {0x141A01, { 2026,    -1,  4713,    -1,    -1}},
+    {0x141A05, {   -1,    -1,  6660,    -1,    -1}},
+    {0x141A07, {   -1,    -1,  7468,    -1,    -1}},
+    {0x141A09, {   -1,    -1,  9216,    -1,    -1}},
+    {0x141B01, { 2067,    -1,  4755,    -1,    -1}},
+    {0x141B07, {   -1,    -1,  7509,    -1,    -1}},
+    {0x141B09, {   -1,    -1,  9258,    -1,    -1}},
+    {0x141C01, { 2100,    -1,  4796,    -1,    -1}},
+    {0x141C07, {   -1,    -1,  7550,    -1,    -1}},
+    {0x141C09, {   -1,    -1,  9299,    -1,    -1}},
+    {0x141D01, { 2144,    -1,  4837,    -1,    -1}},
+    {0x141D07, {   -1,    -1,  7591,    -1,    -1}},
+    {0x141D09, {   -1,    -1,  9340,    -1,    -1}},
+    {0x141E01, { 2188,    -1,  4878,    -1,    -1}},
+    {0x141E07, {   -1,    -1,  7632,    -1,    -1}},
+    {0x141E09, {   -1,    -1,  9381,    -1,    -1}},
+    {0x141F01, { 2235,    -1,    -1,    -1,    -1}},
+    {0x142001, {   -1,    -1,  4945,    -1,    -1}},
+    {0x142003, { 1480,    -1,    -1,    -1,    -1}},
+    {0x142005, {   -1,    -1,  6679,    -1,    -1}},
+    {0x142007, {   -1,    -1,  7703,    -1,    -1}},
+    {0x142009, {   -1,    -1,  9448,    -1,    -1}},
+    {0x142101, { 2285,    -1,  5032,    -1,    -1}},
+    {0x142103, { 1503,    -1,    -1,    -1,    -1}},
+    {0x142109, {   -1,    -1,  9535,    -1,    -1}},
+    {0x142203, { 1526,    -1,    -1,    -1,    -1}},
+    {0x142800, {  193,    -1,    -1,    -1,    -1}},
+    {0x142801, { 2317,   147,  5113,    -1,    -1}},
+    {0x142803, {   -1,    -1,  6384,    -1,    -1}},
+    {0x142805, {   -1,    -1,  6686,    -1,    -1}},
+    {0x142807, {   -1,    -1,  7788,    -1,    -1}},
+    {0x142809, {   -1,    -1,  9616,    -1,    -1}},
+    {0x1428F1, {   -1,    -1,    -1,   366,    -1}},
+    {0x142901, { 2334,    -1,  5200,    -1,    -1}},
+    {0x142909, {   -1,    -1,  9703,    -1,    -1}},
+    {0x142A01, {   -1,    -1,  5228,    -1,    -1}},
+    {0x142A09, {   -1,    -1,  9731,    -1,    -1}},
+    {0x143001, { 2359,   156,  5309,    -1,    -1}},
+    {0x143003, {   -1,    -1,  6393,    -1,    -1}},
+    {0x143005, {   -1,    -1,  6706,    -1,    -1}},
+    {0x143007, {   -1,    -1,  7845,    -1,    -1}},
+    {0x143009, {   -1,    -1,  9812,    -1,    -1}},
+    {0x1430F1, {   -1,    -1,    -1,   375,    -1}},
+    {0x143101, {   -1,    -1,  5390,    -1,    -1}},
+    {0x143105, {   -1,    -1,  6738,    -1,    -1}},
+    {0x143107, {   -1,    -1,  7926,    -1,    -1}},
+    {0x143109, {   -1,    -1,  9893,    -1,    -1}},
+    {0x143201, {   -1,    -1,  5465,    -1,    -1}},
+    {0x143205, {   -1,    -1,  6798,    -1,    -1}},
+    {0x143207, {   -1,    -1,  8001,    -1,    -1}},
+    {0x143209, {   -1,    -1,  9968,    -1,    -1}},
+    {0x143301, {   -1,    -1,  5552,    -1,    -1}},
+    {0x143309, {   -1,    -1, 10055,    -1,    -1}},
+    {0x143401, {   -1,    -1,  5639,    -1,    -1}},
+    {0x143407, {   -1,    -1,  8088,    -1,    -1}},
+    {0x143409, {   -1,    -1, 10142,    -1,    -1}},
+    {0x143501, {   -1,    -1,  5698,    -1,    -1}},
+    {0x143507, {   -1,    -1,  8145,    -1,    -1}},
+    {0x143509, {   -1,    -1, 10201,    -1,    -1}},
+    {0x143601, {   -1,    -1,  5759,    -1,    -1}},
+    {0x143609, {   -1,    -1, 10262,    -1,    -1}},
+    {0x143801, { 2382,   174,  5827,    -1,    -1}},
+    {0x143803, {   -1,    -1,  6411,    -1,    -1}},
+    {0x143805, {   -1,    -1,  6859,    -1,    -1}},
+    {0x143807, {   -1,    -1,  8221,    -1,    -1}},
+    {0x143809, {   -1,    -1, 10330,    -1,    -1}},
+    {0x1438F1, {   -1,    -1,    -1,   393,    -1}},
+    {0x143901, { 2411,    -1,  5888,    -1,    -1}},
+    {0x143905, {   -1,    -1,  6914,    -1,    -1}},
+    {0x143907, {   -1,    -1,  8282,    -1,    -1}},
+    {0x143909, {   -1,    -1, 10391,    -1,    -1}},
+    {0x143A01, {   -1,    -1,  5941,    -1,    -1}},
+    {0x143A07, {   -1,    -1,  8335,    -1,    -1}},
+    {0x143A09, {   -1,    -1, 10444,    -1,    -1}},
+    {0x143B01, {   -1,    -1,  6016,    -1,    -1}},
+    {0x143B09, {   -1,    -1, 10519,    -1,    -1}},
+    {0x143C01, {   -1,    -1,  6105,    -1,    -1}},
+    {0x143C09, {   -1,    -1, 10608,    -1,    -1}},
+    {0x143D01, {   -1,    -1,  6160,    -1,    -1}},
+    {0x143D09, {   -1,    -1, 10663,    -1,    -1}},
+    {0x143E01, {   -1,    -1,  6217,    -1,    -1}},
+    {0x143E09, {   -1,    -1, 10720,    -1,    -1}},
+    {0x144000, {  306,    -1,    -1,    -1,    -1}},
+    {0x144001, { 2443,    -1,    -1,    -1,    -1}},
+    {0x144100, {  398,    -1,    -1,    -1,    -1}},
+    {0x144101, { 2492,    -1,    -1,    -1,    -1}},
+    {0x144200, {  476,    -1,    -1,    -1,    -1}},
+    {0x144201, { 2540,    -1,    -1,    -1,    -1}},
+    {0x144300, {  544,    -1,    -1,    -1,    -1}},
+    {0x144400, {  592,    -1,    -1,    -1,    -1}},
+    {0x147E00, {  945,    -1,    -1,    -1,    -1}},
+    {0x147E01, { 2577,    -1,    -1,    -1,    -1}},
+    {0x147F00, { 1073,    -1,    -1,    -1,    -1}},
+    {0x147F01, { 2618,    -1,    -1,    -1,    -1}},
+    {0x147F03, {   -1,    -1,  6461,    -1,    -1}},
+    {0x148000, {   -1,    -1,    -1,    -1,    41}},
+    {0x148001, {   -1,    -1,    -1,    -1,   134}},
+    {0x148002, {   -1,    -1,   539,    -1,    -1}},
+    {0x148003, { 1327,    -1,  6288,    -1,    -1}},
+    {0x148005, {   -1,    -1,  6539,    -1,    -1}},
+    {0x148007, {   -1,    -1,  7002,    -1,    -1}},
+    {0x148009, {   -1,    -1,  8428,    -1,    -1}},
+    {0x1480F1, {   -1,    -1,    -1,   270,    -1}},
+    {0x1480F2, {   -1,    -1,    -1,    41,    -1}},
+    {0x148100, {   -1,    -1,    41,    -1,    -1}},
+    {0x148101, {   -1,    -1,  4045,    -1,    -1}},
+    {0x148103, { 1349,    -1,    -1,    -1,    -1}},
+    {0x148107, {   -1,    -1,  7090,    -1,    -1}},
+    {0x148109, {   -1,    -1,  8548,    -1,    -1}},
+    {0x1481FC, {   -1,    -1,  3855,    -1,    -1}},
+    {0x1481FE, {   -1,    -1,  3919,    -1,    -1}},
+    {0x148200, {   -1,    -1,   169,    -1,    -1}},
+    {0x148201, { 1582,    -1,  4146,    -1,    -1}},
+    {0x148207, {   -1,    -1,  7117,    -1,    -1}},
+    {0x148209, {   -1,    -1,  8649,    -1,    -1}},
+    {0x148300, {   -1,    -1,   297,    -1,    -1}},
+    {0x148301, { 1635,    -1,    -1,    -1,    -1}},
+    {0x148302, {   -1,    -1,   696,    -1,    -1}},
+    {0x148400, {   -1,    -1,   425,    -1,    -1}},
+    {0x148401, { 1696,    -1,    -1,    -1,    -1}},
+    {0x148402, {   -1,    -1,   782,    -1,    -1}},
+    {0x148501, { 1746,    -1,    -1,    -1,    -1}},
+    {0x148601, { 1792,    -1,    -1,    -1,    -1}},
+    {0x148701, { 1838,    -1,    -1,    -1,    -1}},
+    {0x148801, { 1872,    98,  4229,    -1,    -1}},
+    {0x148803, {   -1,    -1,  6335,    -1,    -1}},
+    {0x148805, {   -1,    -1,  6597,    -1,    -1}},
+    {0x148807, {   -1,    -1,  7144,    -1,    -1}},
+    {0x148809, {   -1,    -1,  8732,    -1,    -1}},
+    {0x1488F1, {   -1,    -1,    -1,   317,    -1}},
+    {0x148901, { 1889,    -1,  4285,    -1,    -1}},
+    {0x148907, {   -1,    -1,  7200,    -1,    -1}},
+    {0x148909, {   -1,    -1,  8788,    -1,    -1}},
+    {0x148A01, {   -1,    -1,  4383,    -1,    -1}},
+    {0x148A07, {   -1,    -1,  7288,    -1,    -1}},
+    {0x148A09, {   -1,    -1,  8886,    -1,    -1}},
+    {0x148B01, {   -1,    -1,  4426,    -1,    -1}},
+    {0x148B07, {   -1,    -1,  7322,    -1,    -1}},
+    {0x148B09, {   -1,    -1,  8929,    -1,    -1}},
+    {0x148C01, {   -1,    -1,  4474,    -1,    -1}},
+    {0x148C09, {   -1,    -1,  8977,    -1,    -1}},
+    {0x148D01, {   -1,    -1,  4526,    -1,    -1}},
+    {0x148D09, {   -1,    -1,  9029,    -1,    -1}},
+    {0x149001, { 1922,   106,  4574,    -1,    -1}},
+    {0x149003, { 1383,    -1,  6343,    -1,    -1}},
+    {0x149005, {   -1,    -1,  6609,    -1,    -1}},
+    {0x149007, {   -1,    -1,  7362,    -1,    -1}},
+    {0x149009, {   -1,    -1,  9077,    -1,    -1}},
+    {0x1490F1, {   -1,    -1,    -1,   325,    -1}},
+    {0x149101, { 1941,    -1,    -1,    -1,    -1}},
+    {0x149103, { 1403,    -1,    -1,    -1,    -1}},
+    {0x149203, { 1442,    -1,    -1,    -1,    -1}},
+    {0x149801, { 1976,   115,  4618,    -1,    -1}},
+    {0x149803, {   -1,    -1,  6352,    -1,    -1}},
+    {0x149805, {   -1,    -1,  6623,    -1,    -1}},
+    {0x149807, {   -1,    -1,  7388,    -1,    -1}},
+    {0x149809, {   -1,    -1,  9121,    -1,    -1}},
+    {0x1498F1, {   -1,    -1,    -1,   334,    -1}},
+    {0x149901, { 1993,   125,  4671,    -1,    -1}},
+    {0x149903, {   -1,    -1,  6362,    -1,    -1}},
+    {0x149905, {   -1,    -1,  6639,    -1,    -1}},
+    {0x149907, {   -1,    -1,  7428,    -1,    -1}},
+    {0x149909, {   -1,    -1,  9174,    -1,    -1}},
+    {0x1499F1, {   -1,    -1,    -1,   344,    -1}},
+    {0x149A01, { 2027,    -1,  4714,    -1,    -1}},
+    {0x149A05, {   -1,    -1,  6661,    -1,    -1}},
+    {0x149A07, {   -1,    -1,  7469,    -1,    -1}},
+    {0x149A09, {   -1,    -1,  9217,    -1,    -1}},
+    {0x149B01, { 2068,    -1,  4756,    -1,    -1}},
+    {0x149B07, {   -1,    -1,  7510,    -1,    -1}},
+    {0x149B09, {   -1,    -1,  9259,    -1,    -1}},
+    {0x149C01, { 2101,    -1,  4797,    -1,    -1}},
+    {0x149C07, {   -1,    -1,  7551,    -1,    -1}},
+    {0x149C09, {   -1,    -1,  9300,    -1,    -1}},
+    {0x149D01, { 2145,    -1,  4838,    -1,    -1}},
+    {0x149D07, {   -1,    -1,  7592,    -1,    -1}},
+    {0x149D09, {   -1,    -1,  9341,    -1,    -1}},
+    {0x149E01, { 2189,    -1,  4879,    -1,    -1}},
+    {0x149E07, {   -1,    -1,  7633,    -1,    -1}},
+    {0x149E09, {   -1,    -1,  9382,    -1,    -1}},
+    {0x149F01, { 2236,    -1,    -1,    -1,    -1}},
+    {0x14A001, { 2270,    -1,  4946,    -1,    -1}},
+    {0x14A003, { 1481,    -1,    -1,    -1,    -1}},
+    {0x14A007, {   -1,    -1,  7704,    -1,    -1}},
+    {0x14A009, {   -1,    -1,  9449,    -1,    -1}},
+    {0x14A101, { 2286,    -1,  5033,    -1,    -1}},
+    {0x14A103, { 1504,    -1,    -1,    -1,    -1}},
+    {0x14A109, {   -1,    -1,  9536,    -1,    -1}},
+    {0x14A203, { 1527,    -1,    -1,    -1,    -1}},
+    {0x14A800, {  194,    -1,    -1,    -1,    -1}},
+    {0x14A801, { 2318,    -1,  5114,    -1,    -1}},
+    {0x14A805, {   -1,    -1,  6687,    -1,    -1}},
+    {0x14A807, {   -1,    -1,  7789,    -1,    -1}},
+    {0x14A809, {   -1,    -1,  9617,    -1,    -1}},
+    {0x14A901, { 2335,    -1,  5201,    -1,    -1}},
+    {0x14A909, {   -1,    -1,  9704,    -1,    -1}},
+    {0x14AA01, {   -1,    -1,  5229,    -1,    -1}},
+    {0x14AA09, {   -1,    -1,  9732,    -1,    -1}},
+    {0x14B001, { 2360,   157,  5310,    -1,    -1}},
+    {0x14B003, {   -1,    -1,  6394,    -1,    -1}},
+    {0x14B005, {   -1,    -1,  6707,    -1,    -1}},
+    {0x14B007, {   -1,    -1,  7846,    -1,    -1}},
+    {0x14B009, {   -1,    -1,  9813,    -1,    -1}},
+    {0x14B0F1, {   -1,    -1,    -1,   376,    -1}},
+    {0x14B101, {   -1,    -1,  5391,    -1,    -1}},
+    {0x14B105, {   -1,    -1,  6739,    -1,    -1}},
+    {0x14B107, {   -1,    -1,  7927,    -1,    -1}},
+    {0x14B109, {   -1,    -1,  9894,    -1,    -1}},
+    {0x14B201, {   -1,    -1,  5466,    -1,    -1}},
+    {0x14B205, {   -1,    -1,  6799,    -1,    -1}},
+    {0x14B207, {   -1,    -1,  8002,    -1,    -1}},
+    {0x14B209, {   -1,    -1,  9969,    -1,    -1}},
+    {0x14B301, {   -1,    -1,  5553,    -1,    -1}},
+    {0x14B309, {   -1,    -1, 10056,    -1,    -1}},
+    {0x14B401, {   -1,    -1,  5640,    -1,    -1}},
+    {0x14B407, {   -1,    -1,  8089,    -1,    -1}},
+    {0x14B409, {   -1,    -1, 10143,    -1,    -1}},
+    {0x14B501, {   -1,    -1,  5699,    -1,    -1}},
+    {0x14B507, {   -1,    -1,  8146,    -1,    -1}},
+    {0x14B509, {   -1,    -1, 10202,    -1,    -1}},
+    {0x14B601, {   -1,    -1,  5760,    -1,    -1}},
+    {0x14B609, {   -1,    -1, 10263,    -1,    -1}},
+    {0x14B801, { 2383,   175,  5828,    -1,    -1}},
+    {0x14B803, {   -1,    -1,  6412,    -1,    -1}},
+    {0x14B805, {   -1,    -1,  6860,    -1,    -1}},
+    {0x14B807, {   -1,    -1,  8222,    -1,    -1}},
+    {0x14B809, {   -1,    -1, 10331,    -1,    -1}},
+    {0x14B8F1, {   -1,    -1,    -1,   394,    -1}},
+    {0x14B901, { 2412,    -1,  5889,    -1,    -1}},
+    {0x14B905, {   -1,    -1,  6915,    -1,    -1}},
+    {0x14B907, {   -1,    -1,  8283,    -1,    -1}},
+    {0x14B909, {   -1,    -1, 10392,    -1,    -1}},
+    {0x14BA01, {   -1,    -1,  5942,    -1,    -1}},
+    {0x14BA07, {   -1,    -1,  8336,    -1,    -1}},
+    {0x14BA09, {   -1,    -1, 10445,    -1,    -1}},
+    {0x14BB01, {   -1,    -1,  6017,    -1,    -1}},
+    {0x14BB09, {   -1,    -1, 10520,    -1,    -1}},
+    {0x14BC01, {   -1,    -1,  6106,    -1,    -1}},
+    {0x14BC09, {   -1,    -1, 10609,    -1,    -1}},
+    {0x14BD01, {   -1,    -1,  6161,    -1,    -1}},
+    {0x14BD09, {   -1,    -1, 10664,    -1,    -1}},
+    {0x14BE01, {   -1,    -1,  6218,    -1,    -1}},
+    {0x14BE09, {   -1,    -1, 10721,    -1,    -1}},
+    {0x14C000, {  307,    -1,    -1,    -1,    -1}},
+    {0x14C001, { 2444,    -1,    -1,    -1,    -1}},
+    {0x14C100, {  399,    -1,    -1,    -1,    -1}},
+    {0x14C101, { 2493,    -1,    -1,    -1,    -1}},
+    {0x14C200, {  477,    -1,    -1,    -1,    -1}},
+    {0x14C201, { 2541,    -1,    -1,    -1,    -1}},
+    {0x14C300, {  545,    -1,    -1,    -1,    -1}},
+    {0x14FE00, {  946,    -1,    -1,    -1,    -1}},
+    {0x14FF00, { 1074,    -1,    -1,    -1,    -1}},
+    {0x14FF01, { 2619,    -1,    -1,    -1,    -1}},
+    {0x14FF03, {   -1,    -1,  6462,    -1,    -1}},
+    {0x150000, {   -1,    -1,    -1,    -1,    42}},
+    {0x150001, { 1547,    -1,    -1,    -1,   135}},
+    {0x150002, {   -1,    -1,   540,    -1,    -1}},
+    {0x150003, {   -1,    -1,  6289,    -1,    -1}},
+    {0x150005, {   -1,    -1,  6540,    -1,    -1}},
+    {0x150007, {   -1,    -1,  7003,    -1,    -1}},
+    {0x150009, {   -1,    -1,  8429,    -1,    -1}},
+    {0x1500F1, {   -1,    -1,    -1,   271,    -1}},
+    {0x1500F2, {   -1,    -1,    -1,    42,    -1}},
+    {0x150100, {   -1,    -1,    42,    -1,    -1}},
+    {0x150101, {   -1,    -1,  4046,    -1,    -1}},
+    {0x150103, { 1350,    -1,    -1,    -1,    -1}},
+    {0x150105, {   -1,    -1,  6590,    -1,    -1}},
+    {0x150107, {   -1,    -1,  7091,    -1,    -1}},
+    {0x150109, {   -1,    -1,  8549,    -1,    -1}},
+    {0x1501FC, {   -1,    -1,  3856,    -1,    -1}},
+    {0x1501FE, {   -1,    -1,  3920,    -1,    -1}},
+    {0x150200, {   -1,    -1,   170,    -1,    -1}},
+    {0x150201, {   -1,    -1,  4147,    -1,    -1}},
+    {0x150207, {   -1,    -1,  7118,    -1,    -1}},
+    {0x150209, {   -1,    -1,  8650,    -1,    -1}},
+    {0x150300, {   -1,    -1,   298,    -1,    -1}},
+    {0x150301, { 1636,    -1,    -1,    -1,    -1}},
+    {0x150302, {   -1,    -1,   697,    -1,    -1}},
+    {0x150400, {   -1,    -1,   426,    -1,    -1}},
+    {0x150401, { 1697,    -1,    -1,    -1,    -1}},
+    {0x150402, {   -1,    -1,   783,    -1,    -1}},
+    {0x150501, { 1747,    -1,    -1,    -1,    -1}},
+    {0x150601, { 1793,    -1,    -1,    -1,    -1}},
+    {0x150701, { 1839,    -1,    -1,    -1,    -1}},
+    {0x150801, {   -1,    -1,  4230,    -1,    -1}},
+    {0x150805, {   -1,    -1,  6598,    -1,    -1}},
+    {0x150807, {   -1,    -1,  7145,    -1,    -1}},
+    {0x150809, {   -1,    -1,  8733,    -1,    -1}},
+    {0x150901, { 1890,    -1,  4286,    -1,    -1}},
+    {0x150907, {   -1,    -1,  7201,    -1,    -1}},
+    {0x150909, {   -1,    -1,  8789,    -1,    -1}},
+    {0x150A01, {   -1,    -1,  4384,    -1,    -1}},
+    {0x150A07, {   -1,    -1,  7289,    -1,    -1}},
+    {0x150A09, {   -1,    -1,  8887,    -1,    -1}},
+    {0x150B01, {   -1,    -1,  4427,    -1,    -1}},
+    {0x150B07, {   -1,    -1,  7323,    -1,    -1}},
+    {0x150B09, {   -1,    -1,  8930,    -1,    -1}},
+    {0x150C01, {   -1,    -1,  4475,    -1,    -1}},
+    {0x150C09, {   -1,    -1,  8978,    -1,    -1}},
+    {0x150D01, {   -1,    -1,  4527,    -1,    -1}},
+    {0x150D09, {   -1,    -1,  9030,    -1,    -1}},
+    {0x151001, {   -1,    -1,  4575,    -1,    -1}},
+    {0x151003, { 1384,    -1,    -1,    -1,    -1}},
+    {0x151005, {   -1,    -1,  6610,    -1,    -1}},
+    {0x151007, {   -1,    -1,  7363,    -1,    -1}},
+    {0x151009, {   -1,    -1,  9078,    -1,    -1}},
+    {0x151101, { 1942,    -1,    -1,    -1,    -1}},
+    {0x151103, { 1404,    -1,    -1,    -1,    -1}},
+    {0x151203, { 1443,    -1,    -1,    -1,    -1}},
+    {0x151801, {   -1,    -1,  4619,    -1,    -1}},
+    {0x151805, {   -1,    -1,  6624,    -1,    -1}},
+    {0x151807, {   -1,    -1,  7389,    -1,    -1}},
+    {0x151809, {   -1,    -1,  9122,    -1,    -1}},
+    {0x151901, { 1994,   126,  4672,    -1,    -1}},
+    {0x151903, {   -1,    -1,  6363,    -1,    -1}},
+    {0x151905, {   -1,    -1,  6640,    -1,    -1}},
+    {0x151907, {   -1,    -1,  7429,    -1,    -1}},
+    {0x151909, {   -1,    -1,  9175,    -1,    -1}},
+    {0x1519F1, {   -1,    -1,    -1,   345,    -1}},
+    {0x151A01, { 2028,    -1,  4715,    -1,    -1}},
+    {0x151A05, {   -1,    -1,  6662,    -1,    -1}},
+    {0x151A07, {   -1,    -1,  7470,    -1,    -1}},
+    {0x151A09, {   -1,    -1,  9218,    -1,    -1}},
+    {0x151B01, { 2069,    -1,  4757,    -1,    -1}},
+    {0x151B07, {   -1,    -1,  7511,    -1,    -1}},
+    {0x151B09, {   -1,    -1,  9260,    -1,    -1}},
+    {0x151C01, { 2102,    -1,  4798,    -1,    -1}},
+    {0x151C07, {   -1,    -1,  7552,    -1,    -1}},
+    {0x151C09, {   -1,    -1,  9301,    -1,    -1}},
+    {0x151D01, { 2146,    -1,  4839,    -1,    -1}},
+    {0x151D07, {   -1,    -1,  7593,    -1,    -1}},
+    {0x151D09, {   -1,    -1,  9342,    -1,    -1}},
+    {0x151E01, { 2190,    -1,  4880,    -1,    -1}},
+    {0x151E07, {   -1,    -1,  7634,    -1,    -1}},
+    {0x151E09, {   -1,    -1,  9383,    -1,    -1}},
+    {0x151F01, { 2237,    -1,    -1,    -1,    -1}},
+    {0x152001, {   -1,    -1,  4947,    -1,    -1}},
+    {0x152003, { 1482,    -1,    -1,    -1,    -1}},
+    {0x152005, {   -1,    -1,  6680,    -1,    -1}},
+    {0x152007, {   -1,    -1,  7705,    -1,    -1}},
+    {0x152009, {   -1,    -1,  9450,    -1,    -1}},
+    {0x152101, { 2287,    -1,  5034,    -1,    -1}},
+    {0x152103, { 1505,    -1,    -1,    -1,    -1}},
+    {0x152109, {   -1,    -1,  9537,    -1,    -1}},
+    {0x152801, {   -1,    -1,  5115,    -1,    -1}},
+    {0x152805, {   -1,    -1,  6688,    -1,    -1}},
+    {0x152807, {   -1,    -1,  7790,    -1,    -1}},
+    {0x152809, {   -1,    -1,  9618,    -1,    -1}},
+    {0x152901, { 2336,    -1,  5202,    -1,    -1}},
+    {0x152909, {   -1,    -1,  9705,    -1,    -1}},
+    {0x152A01, {   -1,    -1,  5230,    -1,    -1}},
+    {0x152A09, {   -1,    -1,  9733,    -1,    -1}},
+    {0x153001, {   -1,   158,  5311,    -1,    -1}},
+    {0x153003, {   -1,    -1,  6395,    -1,    -1}},
+    {0x153005, {   -1,    -1,  6708,    -1,    -1}},
+    {0x153007, {   -1,    -1,  7847,    -1,    -1}},
+    {0x153009, {   -1,    -1,  9814,    -1,    -1}},
+    {0x1530F1, {   -1,    -1,    -1,   377,    -1}},
+    {0x153101, {   -1,    -1,  5392,    -1,    -1}},
+    {0x153105, {   -1,    -1,  6740,    -1,    -1}},
+    {0x153107, {   -1,    -1,  7928,    -1,    -1}},
+    {0x153109, {   -1,    -1,  9895,    -1,    -1}},
+    {0x153201, {   -1,    -1,  5467,    -1,    -1}},
+    {0x153205, {   -1,    -1,  6800,    -1,    -1}},
+    {0x153207, {   -1,    -1,  8003,    -1,    -1}},
+    {0x153209, {   -1,    -1,  9970,    -1,    -1}},
+    {0x153301, {   -1,    -1,  5554,    -1,    -1}},
+    {0x153309, {   -1,    -1, 10057,    -1,    -1}},
+    {0x153401, {   -1,    -1,  5641,    -1,    -1}},
+    {0x153407, {   -1,    -1,  8090,    -1,    -1}},
+    {0x153409, {   -1,    -1, 10144,    -1,    -1}},
+    {0x153501, {   -1,    -1,  5700,    -1,    -1}},
+    {0x153507, {   -1,    -1,  8147,    -1,    -1}},
+    {0x153509, {   -1,    -1, 10203,    -1,    -1}},
+    {0x153601, {   -1,    -1,  5761,    -1,    -1}},
+    {0x153609, {   -1,    -1, 10264,    -1,    -1}},
+    {0x153801, { 2384,   176,  5829,    -1,    -1}},
+    {0x153803, {   -1,    -1,  6413,    -1,    -1}},
+    {0x153805, {   -1,    -1,  6861,    -1,    -1}},
+    {0x153807, {   -1,    -1,  8223,    -1,    -1}},
+    {0x153809, {   -1,    -1, 10332,    -1,    -1}},
+    {0x1538F1, {   -1,    -1,    -1,   395,    -1}},
+    {0x153901, { 2413,    -1,  5890,    -1,    -1}},
+    {0x153905, {   -1,    -1,  6916,    -1,    -1}},
+    {0x153907, {   -1,    -1,  8284,    -1,    -1}},
+    {0x153909, {   -1,    -1, 10393,    -1,    -1}},
+    {0x153A01, {   -1,    -1,  5943,    -1,    -1}},
+    {0x153A07, {   -1,    -1,  8337,    -1,    -1}},
+    {0x153A09, {   -1,    -1, 10446,    -1,    -1}},
+    {0x153B01, {   -1,    -1,  6018,    -1,    -1}},
+    {0x153B09, {   -1,    -1, 10521,    -1,    -1}},
+    {0x153C01, {   -1,    -1,  6107,    -1,    -1}},
+    {0x153C09, {   -1,    -1, 10610,    -1,    -1}},
+    {0x153D01, {   -1,    -1,  6162,    -1,    -1}},
+    {0x153D09, {   -1,    -1, 10665,    -1,    -1}},
+    {0x153E01, {   -1,    -1,  6219,    -1,    -1}},
+    {0x153E09, {   -1,    -1, 10722,    -1,    -1}},
+    {0x154000, {  308,    -1,    -1,    -1,    -1}},
+    {0x154001, { 2445,    -1,    -1,    -1,    -1}},
+    {0x154100, {  400,    -1,    -1,    -1,    -1}},
+    {0x154101, { 2494,    -1,    -1,    -1,    -1}},
+    {0x154200, {  478,    -1,    -1,    -1,    -1}},
+    {0x154201, { 2542,    -1,    -1,    -1,    -1}},
+    {0x157E00, {  947,    -1,    -1,    -1,    -1}},
+    {0x157E01, { 2578,    -1,    -1,    -1,    -1}},
+    {0x157F00, { 1075,    -1,    -1,    -1,    -1}},
+    {0x157F01, { 2620,    -1,    -1,    -1,    -1}},
+    {0x157F03, {   -1,    -1,  6463,    -1,    -1}},
+    {0x158000, {   -1,    -1,    -1,    -1,    43}},
+    {0x158001, {   -1,    -1,    -1,    -1,   136}},
+    {0x158003, {   -1,    -1,  6290,    -1,    -1}},
+    {0x158005, {   -1,    -1,  6541,    -1,    -1}},
+    {0x158007, {   -1,    -1,  7004,    -1,    -1}},
+    {0x158009, {   -1,    -1,  8430,    -1,    -1}},
+    {0x1580F1, {   -1,    -1,    -1,   272,    -1}},
+    {0x1580F2, {   -1,    -1,    -1,    43,    -1}},
+    {0x158100, {   -1,    -1,    43,    -1,    -1}},
+    {0x158101, {   -1,    -1,  4047,    -1,    -1}},
+    {0x158103, { 1351,    -1,    -1,    -1,    -1}},
+    {0x158107, {   -1,    -1,  7092,    -1,    -1}},
+    {0x158109, {   -1,    -1,  8550,    -1,    -1}},
+    {0x1581FC, {   -1,    -1,  3857,    -1,    -1}},
+    {0x1581FE, {   -1,    -1,  3921,    -1,    -1}},
+    {0x158200, {   -1,    -1,   171,    -1,    -1}},
+    {0x158201, { 1583,    -1,  4148,    -1,    -1}},
+    {0x158207, {   -1,    -1,  7119,    -1,    -1}},
+    {0x158209, {   -1,    -1,  8651,    -1,    -1}},
+    {0x158300, {   -1,    -1,   299,    -1,    -1}},
+    {0x158301, { 1637,    -1,    -1,    -1,    -1}},
+    {0x158400, {   -1,    -1,   427,    -1,    -1}},
+    {0x158401, { 1698,    -1,    -1,    -1,    -1}},
+    {0x158501, { 1748,    -1,    -1,    -1,    -1}},
+    {0x158601, { 1794,    -1,    -1,    -1,    -1}},
+    {0x158701, { 1840,    -1,    -1,    -1,    -1}},
+    {0x158801, { 1873,    99,  4231,    -1,    -1}},
+    {0x158803, {   -1,    -1,  6336,    -1,    -1}},
+    {0x158805, {   -1,    -1,  6599,    -1,    -1}},
+    {0x158807, {   -1,    -1,  7146,    -1,    -1}},
+    {0x158809, {   -1,    -1,  8734,    -1,    -1}},
+    {0x1588F1, {   -1,    -1,    -1,   318,    -1}},
+    {0x158901, { 1891,    -1,  4287,    -1,    -1}},
+    {0x158907, {   -1,    -1,  7202,    -1,    -1}},
+    {0x158909, {   -1,    -1,  8790,    -1,    -1}},
+    {0x158A01, {   -1,    -1,  4385,    -1,    -1}},
+    {0x158A07, {   -1,    -1,  7290,    -1,    -1}},
+    {0x158A09, {   -1,    -1,  8888,    -1,    -1}},
+    {0x158B01, {   -1,    -1,  4428,    -1,    -1}},
+    {0x158B07, {   -1,    -1,  7324,    -1,    -1}},
+    {0x158B09, {   -1,    -1,  8931,    -1,    -1}},
+    {0x158C01, {   -1,    -1,  4476,    -1,    -1}},
+    {0x158C09, {   -1,    -1,  8979,    -1,    -1}},
+    {0x158D01, {   -1,    -1,  4528,    -1,    -1}},
+    {0x158D09, {   -1,    -1,  9031,    -1,    -1}},
+    {0x159001, { 1923,   107,  4576,    -1,    -1}},
+    {0x159003, { 1385,    -1,  6344,    -1,    -1}},
+    {0x159005, {   -1,    -1,  6611,    -1,    -1}},
+    {0x159007, {   -1,    -1,  7364,    -1,    -1}},
+    {0x159009, {   -1,    -1,  9079,    -1,    -1}},
+    {0x1590F1, {   -1,    -1,    -1,   326,    -1}},
+    {0x159101, { 1943,    -1,    -1,    -1,    -1}},
+    {0x159103, { 1405,    -1,    -1,    -1,    -1}},
+    {0x159203, { 1444,    -1,    -1,    -1,    -1}},
+    {0x159801, { 1977,   116,  4620,    -1,    -1}},
+    {0x159803, {   -1,    -1,  6353,    -1,    -1}},
+    {0x159805, {   -1,    -1,  6625,    -1,    -1}},
+    {0x159807, {   -1,    -1,  7390,    -1,    -1}},
+    {0x159809, {   -1,    -1,  9123,    -1,    -1}},
+    {0x1598F1, {   -1,    -1,    -1,   335,    -1}},
+    {0x159901, { 1995,   127,  4673,    -1,    -1}},
+    {0x159903, {   -1,    -1,  6364,    -1,    -1}},
+    {0x159905, {   -1,    -1,  6641,    -1,    -1}},
+    {0x159907, {   -1,    -1,  7430,    -1,    -1}},
+    {0x159909, {   -1,    -1,  9176,    -1,    -1}},
+    {0x1599F1, {   -1,    -1,    -1,   346,    -1}},
+    {0x159A01, { 2029,    -1,  4716,    -1,    -1}},
+    {0x159A05, {   -1,    -1,  6663,    -1,    -1}},
+    {0x159A07, {   -1,    -1,  7471,    -1,    -1}},
+    {0x159A09, {   -1,    -1,  9219,    -1,    -1}},
+    {0x159B01, { 2070,    -1,  4758,    -1,    -1}},
+    {0x159B07, {   -1,    -1,  7512,    -1,    -1}},
+    {0x159B09, {   -1,    -1,  9261,    -1,    -1}},
+    {0x159C01, { 2103,    -1,  4799,    -1,    -1}},
+    {0x159C07, {   -1,    -1,  7553,    -1,    -1}},
+    {0x159C09, {   -1,    -1,  9302,    -1,    -1}},
+    {0x159D01, { 2147,    -1,  4840,    -1,    -1}},
+    {0x159D07, {   -1,    -1,  7594,    -1,    -1}},
+    {0x159D09, {   -1,    -1,  9343,    -1,    -1}},
+    {0x159E01, { 2191,    -1,  4881,    -1,    -1}},
+    {0x159E07, {   -1,    -1,  7635,    -1,    -1}},
+    {0x159E09, {   -1,    -1,  9384,    -1,    -1}},
+    {0x159F01, { 2238,    -1,    -1,    -1,    -1}},
+    {0x15A001, { 2271,    -1,  4948,    -1,    -1}},
+    {0x15A003, { 1483,    -1,    -1,    -1,    -1}},
+    {0x15A007, {   -1,    -1,  7706,    -1,    -1}},
+    {0x15A009, {   -1,    -1,  9451,    -1,    -1}},
+    {0x15A101, { 2288,    -1,  5035,    -1,    -1}},
+    {0x15A103, { 1506,    -1,    -1,    -1,    -1}},
+    {0x15A109, {   -1,    -1,  9538,    -1,    -1}},
+    {0x15A801, { 2319,    -1,  5116,    -1,    -1}},
+    {0x15A805, {   -1,    -1,  6689,    -1,    -1}},
+    {0x15A807, {   -1,    -1,  7791,    -1,    -1}},
+    {0x15A809, {   -1,    -1,  9619,    -1,    -1}},
+    {0x15A901, { 2337,    -1,  5203,    -1,    -1}},
+    {0x15A909, {   -1,    -1,  9706,    -1,    -1}},
+    {0x15AA01, {   -1,    -1,  5231,    -1,    -1}},
+    {0x15AA09, {   -1,    -1,  9734,    -1,    -1}},
+    {0x15B001, { 2361,   159,  5312,    -1,    -1}},
+    {0x15B003, {   -1,    -1,  6396,    -1,    -1}},
+    {0x15B005, {   -1,    -1,  6709,    -1,    -1}},
+    {0x15B007, {   -1,    -1,  7848,    -1,    -1}},
+    {0x15B009, {   -1,    -1,  9815,    -1,    -1}},
+    {0x15B0F1, {   -1,    -1,    -1,   378,    -1}},
+    {0x15B101, {   -1,    -1,  5393,    -1,    -1}},
+    {0x15B105, {   -1,    -1,  6741,    -1,    -1}},
+    {0x15B107, {   -1,    -1,  7929,    -1,    -1}},
+    {0x15B109, {   -1,    -1,  9896,    -1,    -1}},
+    {0x15B201, {   -1,    -1,  5468,    -1,    -1}},
+    {0x15B205, {   -1,    -1,  6801,    -1,    -1}},
+    {0x15B207, {   -1,    -1,  8004,    -1,    -1}},
+    {0x15B209, {   -1,    -1,  9971,    -1,    -1}},
+    {0x15B301, {   -1,    -1,  5555,    -1,    -1}},
+    {0x15B309, {   -1,    -1, 10058,    -1,    -1}},
+    {0x15B401, {   -1,    -1,  5642,    -1,    -1}},
+    {0x15B407, {   -1,    -1,  8091,    -1,    -1}},
+    {0x15B409, {   -1,    -1, 10145,    -1,    -1}},
+    {0x15B501, {   -1,    -1,  5701,    -1,    -1}},
+    {0x15B507, {   -1,    -1,  8148,    -1,    -1}},
+    {0x15B509, {   -1,    -1, 10204,    -1,    -1}},
+    {0x15B601, {   -1,    -1,  5762,    -1,    -1}},
+    {0x15B609, {   -1,    -1, 10265,    -1,    -1}},
+    {0x15B801, { 2385,   177,  5830,    -1,    -1}},
+    {0x15B803, {   -1,    -1,  6414,    -1,    -1}},
+    {0x15B805, {   -1,    -1,  6862,    -1,    -1}},
+    {0x15B807, {   -1,    -1,  8224,    -1,    -1}},
+    {0x15B809, {   -1,    -1, 10333,    -1,    -1}},
+    {0x15B8F1, {   -1,    -1,    -1,   396,    -1}},
+    {0x15B901, { 2414,    -1,  5891,    -1,    -1}},
+    {0x15B905, {   -1,    -1,  6917,    -1,    -1}},
+    {0x15B907, {   -1,    -1,  8285,    -1,    -1}},
+    {0x15B909, {   -1,    -1, 10394,    -1,    -1}},
+    {0x15BA01, {   -1,    -1,  5944,    -1,    -1}},
+    {0x15BA07, {   -1,    -1,  8338,    -1,    -1}},
+    {0x15BA09, {   -1,    -1, 10447,    -1,    -1}},
+    {0x15BB01, {   -1,    -1,  6019,    -1,    -1}},
+    {0x15BB09, {   -1,    -1, 10522,    -1,    -1}},
+    {0x15BC01, {   -1,    -1,  6108,    -1,    -1}},
+    {0x15BC09, {   -1,    -1, 10611,    -1,    -1}},
+    {0x15BD01, {   -1,    -1,  6163,    -1,    -1}},
+    {0x15BD09, {   -1,    -1, 10666,    -1,    -1}},
+    {0x15BE01, {   -1,    -1,  6220,    -1,    -1}},
+    {0x15BE09, {   -1,    -1, 10723,    -1,    -1}},
+    {0x15C000, {  309,    -1,    -1,    -1,    -1}},
+    {0x15C001, { 2446,    -1,    -1,    -1,    -1}},
+    {0x15C100, {  401,    -1,    -1,    -1,    -1}},
+    {0x15C101, { 2495,    -1,    -1,    -1,    -1}},
+    {0x15C200, {  479,    -1,    -1,    -1,    -1}},
+    {0x15C201, { 2543,    -1,    -1,    -1,    -1}},
+    {0x15FE00, {  948,    -1,    -1,    -1,    -1}},
+    {0x15FF00, { 1076,    -1,    -1,    -1,    -1}},
+    {0x15FF01, { 2621,    -1,    -1,    -1,    -1}},
+    {0x15FF03, {   -1,    -1,  6464,    -1,    -1}},
+    {0x160000, {   -1,    -1,    -1,    -1,    44}},
+    {0x160001, { 1548,    -1,    -1,    -1,   137}},
+    {0x160003, {   -1,    -1,  6291,    -1,    -1}},
+    {0x160004, {   -1,    -1,   865,    -1,    -1}},
+    {0x160005, {   -1,    -1,  6542,    -1,    -1}},
+    {0x160007, {   -1,    -1,  7005,    -1,    -1}},
+    {0x160009, {   -1,    -1,  8431,    -1,    -1}},
+    {0x160010, {   -1,    -1,  1686,    -1,    -1}},
+    {0x160012, {   -1,    -1,  2081,    -1,    -1}},
+    {0x160014, {   -1,    -1,  2276,    -1,    -1}},
+    {0x1600F1, {   -1,    -1,    -1,   273,    -1}},
+    {0x1600F2, {   -1,    -1,    -1,    44,    -1}},
+    {0x160100, {   -1,    -1,    44,    -1,    -1}},
+    {0x160101, {   -1,    -1,  4048,    -1,    -1}},
+    {0x160103, { 1352,    -1,    -1,    -1,    -1}},
+    {0x160107, {   -1,    -1,  7093,    -1,    -1}},
+    {0x160109, {   -1,    -1,  8551,    -1,    -1}},
+    {0x1601FC, {   -1,    -1,  3858,    -1,    -1}},
+    {0x1601FE, {   -1,    -1,  3922,    -1,    -1}},
+    {0x160200, {   -1,    -1,   172,    -1,    -1}},
+    {0x160201, {   -1,    -1,  4149,    -1,    -1}},
+    {0x160207, {   -1,    -1,  7120,    -1,    -1}},
+    {0x160209, {   -1,    -1,  8652,    -1,    -1}},
+    {0x160210, {   -1,    -1,  1820,    -1,    -1}},
+    {0x160212, {   -1,    -1,  2138,    -1,    -1}},
+    {0x160300, {   -1,    -1,   300,    -1,    -1}},
+    {0x160301, { 1638,    -1,    -1,    -1,    -1}},
+    {0x160310, {   -1,    -1,  1891,    -1,    -1}},
+    {0x160312, {   -1,    -1,  2165,    -1,    -1}},
+    {0x160400, {   -1,    -1,   428,    -1,    -1}},
+    {0x160401, { 1699,    -1,    -1,    -1,    -1}},
+    {0x160404, {   -1,    -1,  1017,    -1,    -1}},
+    {0x160410, {   -1,    -1,  1993,    -1,    -1}},
+    {0x160412, {   -1,    -1,  2220,    -1,    -1}},
+    {0x160414, {   -1,    -1,  2346,    -1,    -1}},
+    {0x160501, { 1749,    -1,    -1,    -1,    -1}},
+    {0x160601, { 1795,    -1,    -1,    -1,    -1}},
+    {0x160701, { 1841,    -1,    -1,    -1,    -1}},
+    {0x160800, {   22,    -1,    -1,    -1,    -1}},
+    {0x160801, {   -1,    -1,  4232,    -1,    -1}},
+    {0x160807, {   -1,    -1,  7147,    -1,    -1}},
+    {0x160809, {   -1,    -1,  8735,    -1,    -1}},
+    {0x160901, { 1892,    -1,  4288,    -1,    -1}},
+    {0x160907, {   -1,    -1,  7203,    -1,    -1}},
+    {0x160909, {   -1,    -1,  8791,    -1,    -1}},
+    {0x160A01, {   -1,    -1,  4386,    -1,    -1}},
+    {0x160A07, {   -1,    -1,  7291,    -1,    -1}},
+    {0x160A09, {   -1,    -1,  8889,    -1,    -1}},
+    {0x160B01, {   -1,    -1,  4429,    -1,    -1}},
+    {0x160B07, {   -1,    -1,  7325,    -1,    -1}},
+    {0x160B09, {   -1,    -1,  8932,    -1,    -1}},
+    {0x160C01, {   -1,    -1,  4477,    -1,    -1}},
+    {0x160C09, {   -1,    -1,  8980,    -1,    -1}},
+    {0x160D01, {   -1,    -1,  4529,    -1,    -1}},
+    {0x160D09, {   -1,    -1,  9032,    -1,    -1}},
+    {0x161001, {   -1,    -1,  4577,    -1,    -1}},
+    {0x161003, { 1386,    -1,    -1,    -1,    -1}},
+    {0x161007, {   -1,    -1,  7365,    -1,    -1}},
+    {0x161009, {   -1,    -1,  9080,    -1,    -1}},
+    {0x161101, { 1944,    -1,    -1,    -1,    -1}},
+    {0x161103, { 1406,    -1,    -1,    -1,    -1}},
+    {0x161203, { 1445,    -1,    -1,    -1,    -1}},
+    {0x161801, {   -1,    -1,  4621,    -1,    -1}},
+    {0x161807, {   -1,    -1,  7391,    -1,    -1}},
+    {0x161809, {   -1,    -1,  9124,    -1,    -1}},
+    {0x161901, { 1996,   128,  4674,    -1,    -1}},
+    {0x161903, {   -1,    -1,  6365,    -1,    -1}},
+    {0x161905, {   -1,    -1,  6642,    -1,    -1}},
+    {0x161907, {   -1,    -1,  7431,    -1,    -1}},
+    {0x161909, {   -1,    -1,  9177,    -1,    -1}},
+    {0x1619F1, {   -1,    -1,    -1,   347,    -1}},
+    {0x161A01, { 2030,    -1,  4717,    -1,    -1}},
+    {0x161A05, {   -1,    -1,  6664,    -1,    -1}},
+    {0x161A07, {   -1,    -1,  7472,    -1,    -1}},
+    {0x161A09, {   -1,    -1,  9220,    -1,    -1}},
+    {0x161B01, { 2071,    -1,  4759,    -1,    -1}},
+    {0x161B07, {   -1,    -1,  7513,    -1,    -1}},
+    {0x161B09, {   -1,    -1,  9262,    -1,    -1}},
+    {0x161C01, { 2104,    -1,  4800,    -1,    -1}},
+    {0x161C07, {   -1,    -1,  7554,    -1,    -1}},
+    {0x161C09, {   -1,    -1,  9303,    -1,    -1}},
+    {0x161D01, { 2148,    -1,  4841,    -1,    -1}},
+    {0x161D07, {   -1,    -1,  7595,    -1,    -1}},
+    {0x161D09, {   -1,    -1,  9344,    -1,    -1}},
+    {0x161E01, { 2192,    -1,  4882,    -1,    -1}},
+    {0x161E07, {   -1,    -1,  7636,    -1,    -1}},
+    {0x161E09, {   -1,    -1,  9385,    -1,    -1}},
+    {0x161F01, { 2239,    -1,    -1,    -1,    -1}},
+    {0x162001, {   -1,    -1,  4949,    -1,    -1}},
+    {0x162003, { 1484,    -1,    -1,    -1,    -1}},
+    {0x162007, {   -1,    -1,  7707,    -1,    -1}},
+    {0x162009, {   -1,    -1,  9452,    -1,    -1}},
+    {0x162101, { 2289,    -1,  5036,    -1,    -1}},
+    {0x162103, { 1507,    -1,    -1,    -1,    -1}},
+    {0x162109, {   -1,    -1,  9539,    -1,    -1}},
+    {0x162800, {  195,    -1,    -1,    -1,    -1}},
+    {0x162801, {   -1,    -1,  5117,    -1,    -1}},
+    {0x162807, {   -1,    -1,  7792,    -1,    -1}},
+    {0x162809, {   -1,    -1,  9620,    -1,    -1}},
+    {0x162901, { 2338,    -1,  5204,    -1,    -1}},
+    {0x162909, {   -1,    -1,  9707,    -1,    -1}},
+    {0x162A01, {   -1,    -1,  5232,    -1,    -1}},
+    {0x162A09, {   -1,    -1,  9735,    -1,    -1}},
+    {0x163001, {   -1,   160,  5313,    -1,    -1}},
+    {0x163003, {   -1,    -1,  6397,    -1,    -1}},
+    {0x163005, {   -1,    -1,  6710,    -1,    -1}},
+    {0x163007, {   -1,    -1,  7849,    -1,    -1}},
+    {0x163009, {   -1,    -1,  9816,    -1,    -1}},
+    {0x1630F1, {   -1,    -1,    -1,   379,    -1}},
+    {0x163101, {   -1,    -1,  5394,    -1,    -1}},
+    {0x163105, {   -1,    -1,  6742,    -1,    -1}},
+    {0x163107, {   -1,    -1,  7930,    -1,    -1}},
+    {0x163109, {   -1,    -1,  9897,    -1,    -1}},
+    {0x163201, {   -1,    -1,  5469,    -1,    -1}},
+    {0x163205, {   -1,    -1,  6802,    -1,    -1}},
+    {0x163207, {   -1,    -1,  8005,    -1,    -1}},
+    {0x163209, {   -1,    -1,  9972,    -1,    -1}},
+    {0x163301, {   -1,    -1,  5556,    -1,    -1}},
+    {0x163309, {   -1,    -1, 10059,    -1,    -1}},
+    {0x163401, {   -1,    -1,  5643,    -1,    -1}},
+    {0x163407, {   -1,    -1,  8092,    -1,    -1}},
+    {0x163409, {   -1,    -1, 10146,    -1,    -1}},
+    {0x163501, {   -1,    -1,  5702,    -1,    -1}},
+    {0x163507, {   -1,    -1,  8149,    -1,    -1}},
+    {0x163509, {   -1,    -1, 10205,    -1,    -1}},
+    {0x163601, {   -1,    -1,  5763,    -1,    -1}},
+    {0x163609, {   -1,    -1, 10266,    -1,    -1}},
+    {0x163801, { 2386,   178,  5831,    -1,    -1}},
+    {0x163803, {   -1,    -1,  6415,    -1,    -1}},
+    {0x163805, {   -1,    -1,  6863,    -1,    -1}},
+    {0x163807, {   -1,    -1,  8225,    -1,    -1}},
+    {0x163809, {   -1,    -1, 10334,    -1,    -1}},
+    {0x1638F1, {   -1,    -1,    -1,   397,    -1}},
+    {0x163901, { 2415,    -1,  5892,    -1,    -1}},
+    {0x163905, {   -1,    -1,  6918,    -1,    -1}},
+    {0x163907, {   -1,    -1,  8286,    -1,    -1}},
+    {0x163909, {   -1,    -1, 10395,    -1,    -1}},
+    {0x163A01, {   -1,    -1,  5945,    -1,    -1}},
+    {0x163A07, {   -1,    -1,  8339,    -1,    -1}},
+    {0x163A09, {   -1,    -1, 10448,    -1,    -1}},
+    {0x163B01, {   -1,    -1,  6020,    -1,    -1}},
+    {0x163B09, {   -1,    -1, 10523,    -1,    -1}},
+    {0x163C01, {   -1,    -1,  6109,    -1,    -1}},
+    {0x163C09, {   -1,    -1, 10612,    -1,    -1}},
+    {0x163D01, {   -1,    -1,  6164,    -1,    -1}},
+    {0x163D09, {   -1,    -1, 10667,    -1,    -1}},
+    {0x163E01, {   -1,    -1,  6221,    -1,    -1}},
+    {0x163E09, {   -1,    -1, 10724,    -1,    -1}},
+    {0x164000, {  310,    -1,    -1,    -1,    -1}},
+    {0x164001, { 2447,    -1,    -1,    -1,    -1}},
+    {0x164100, {  402,    -1,    -1,    -1,    -1}},
+    {0x164101, { 2496,    -1,    -1,    -1,    -1}},
+    {0x164200, {  480,    -1,    -1,    -1,    -1}},
+    {0x164201, { 2544,    -1,    -1,    -1,    -1}},
+    {0x164300, {  546,    -1,    -1,    -1,    -1}},
+    {0x167E00, {  949,    -1,    -1,    -1,    -1}},
+    {0x167E01, { 2579,    -1,    -1,    -1,    -1}},
+    {0x167F00, { 1077,    -1,    -1,    -1,    -1}},
+    {0x167F01, { 2622,    -1,    -1,    -1,    -1}},
+    {0x167F03, {   -1,    -1,  6465,    -1,    -1}},
+    {0x168000, {   -1,    -1,    -1,    -1,    45}},
+    {0x168001, {   -1,    -1,    -1,    -1,   138}},
+    {0x168002, {   -1,    -1,   541,    -1,    -1}},
+    {0x168003, {   -1,    -1,  6292,    -1,    -1}},
+    {0x168004, {   -1,    -1,   866,    -1,    -1}},
+    {0x168005, {   -1,    -1,  6543,    -1,    -1}},
+    {0x168006, {   -1,    -1,  1080,    -1,    -1}},
+    {0x168007, {   -1,    -1,  7006,    -1,    -1}},
+    {0x168009, {   -1,    -1,  8432,    -1,    -1}},
+    {0x168010, {   -1,    -1,  1687,    -1,    -1}},
+    {0x168020, {   -1,    -1,  2636,    -1,    -1}},
+    {0x168022, {   -1,    -1,  2858,    -1,    -1}},
+    {0x1680F1, {   -1,    -1,    -1,   274,    -1}},
+    {0x1680F2, {   -1,    -1,    -1,    45,    -1}},
+    {0x168100, {   -1,    -1,    45,    -1,    -1}},
+    {0x168101, {   -1,    -1,  4049,    -1,    -1}},
+    {0x168107, {   -1,    -1,  7094,    -1,    -1}},
+    {0x168109, {   -1,    -1,  8552,    -1,    -1}},
+    {0x1681FC, {   -1,    -1,  3859,    -1,    -1}},
+    {0x1681FE, {   -1,    -1,  3923,    -1,    -1}},
+    {0x168200, {   -1,    -1,   173,    -1,    -1}},
+    {0x168201, { 1584,    -1,  4150,    -1,    -1}},
+    {0x168207, {   -1,    -1,  7121,    -1,    -1}},
+    {0x168209, {   -1,    -1,  8653,    -1,    -1}},
+    {0x168300, {   -1,    -1,   301,    -1,    -1}},
+    {0x168301, { 1639,    -1,    -1,    -1,    -1}},
+    {0x168302, {   -1,    -1,   698,    -1,    -1}},
+    {0x168304, {   -1,    -1,   961,    -1,    -1}},
+    {0x168306, {   -1,    -1,  1155,    -1,    -1}},
+    {0x168310, {   -1,    -1,  1892,    -1,    -1}},
+    {0x168320, {   -1,    -1,  2743,    -1,    -1}},
+    {0x168400, {   -1,    -1,   429,    -1,    -1}},
+    {0x168401, { 1700,    -1,    -1,    -1,    -1}},
+    {0x168402, {   -1,    -1,   784,    -1,    -1}},
+    {0x168404, {   -1,    -1,  1018,    -1,    -1}},
+    {0x168406, {   -1,    -1,  1194,    -1,    -1}},
+    {0x168410, {   -1,    -1,  1994,    -1,    -1}},
+    {0x168420, {   -1,    -1,  2805,    -1,    -1}},
+    {0x168422, {   -1,    -1,  2933,    -1,    -1}},
+    {0x168501, { 1750,    -1,    -1,    -1,    -1}},
+    {0x168601, { 1796,    -1,    -1,    -1,    -1}},
+    {0x168701, { 1842,    -1,    -1,    -1,    -1}},
+    {0x168801, { 1874,   100,  4233,    -1,    -1}},
+    {0x168803, {   -1,    -1,  6337,    -1,    -1}},
+    {0x168805, {   -1,    -1,  6600,    -1,    -1}},
+    {0x168807, {   -1,    -1,  7148,    -1,    -1}},
+    {0x168809, {   -1,    -1,  8736,    -1,    -1}},
+    {0x1688F1, {   -1,    -1,    -1,   319,    -1}},
+    {0x168901, { 1893,    -1,  4289,    -1,    -1}},
+    {0x168907, {   -1,    -1,  7204,    -1,    -1}},
+    {0x168909, {   -1,    -1,  8792,    -1,    -1}},
+    {0x168A01, {   -1,    -1,  4387,    -1,    -1}},
+    {0x168A07, {   -1,    -1,  7292,    -1,    -1}},
+    {0x168A09, {   -1,    -1,  8890,    -1,    -1}},
+    {0x168B01, {   -1,    -1,  4430,    -1,    -1}},
+    {0x168B07, {   -1,    -1,  7326,    -1,    -1}},
+    {0x168B09, {   -1,    -1,  8933,    -1,    -1}},
+    {0x168C01, {   -1,    -1,  4478,    -1,    -1}},
+    {0x168C09, {   -1,    -1,  8981,    -1,    -1}},
+    {0x168D01, {   -1,    -1,  4530,    -1,    -1}},
+    {0x168D09, {   -1,    -1,  9033,    -1,    -1}},
+    {0x169001, { 1924,   108,  4578,    -1,    -1}},
+    {0x169003, { 1387,    -1,  6345,    -1,    -1}},
+    {0x169005, {   -1,    -1,  6612,    -1,    -1}},
+    {0x169007, {   -1,    -1,  7366,    -1,    -1}},
+    {0x169009, {   -1,    -1,  9081,    -1,    -1}},
+    {0x1690F1, {   -1,    -1,    -1,   327,    -1}},
+    {0x169101, { 1945,    -1,    -1,    -1,    -1}},
+    {0x169103, { 1407,    -1,    -1,    -1,    -1}},
+    {0x169203, { 1446,    -1,    -1,    -1,    -1}},
+    {0x169801, { 1978,   117,  4622,    -1,    -1}},
+    {0x169803, {   -1,    -1,  6354,    -1,    -1}},
+    {0x169805, {   -1,    -1,  6626,    -1,    -1}},
+    {0x169807, {   -1,    -1,  7392,    -1,    -1}},
+    {0x169809, {   -1,    -1,  9125,    -1,    -1}},
+    {0x1698F1, {   -1,    -1,    -1,   336,    -1}},
+    {0x169901, { 1997,   129,  4675,    -1,    -1}},
+    {0x169903, {   -1,    -1,  6366,    -1,    -1}},
+    {0x169905, {   -1,    -1,  6643,    -1,    -1}},
+    {0x169907, {   -1,    -1,  7432,    -1,    -1}},
+    {0x169909, {   -1,    -1,  9178,    -1,    -1}},
+    {0x1699F1, {   -1,    -1,    -1,   348,    -1}},
+    {0x169A01, { 2031,    -1,  4718,    -1,    -1}},
+    {0x169A05, {   -1,    -1,  6665,    -1,    -1}},
+    {0x169A07, {   -1,    -1,  7473,    -1,    -1}},
+    {0x169A09, {   -1,    -1,  9221,    -1,    -1}},
+    {0x169B01, { 2072,    -1,  4760,    -1,    -1}},
+    {0x169B07, {   -1,    -1,  7514,    -1,    -1}},
+    {0x169B09, {   -1,    -1,  9263,    -1,    -1}},
+    {0x169C01, { 2105,    -1,  4801,    -1,    -1}},
+    {0x169C07, {   -1,    -1,  7555,    -1,    -1}},
+    {0x169C09, {   -1,    -1,  9304,    -1,    -1}},
+    {0x169D01, { 2149,    -1,  4842,    -1,    -1}},
+    {0x169D07, {   -1,    -1,  7596,    -1,    -1}},
+    {0x169D09, {   -1,    -1,  9345,    -1,    -1}},
+    {0x169E01, { 2193,    -1,  4883,    -1,    -1}},
+    {0x169E07, {   -1,    -1,  7637,    -1,    -1}},
+    {0x169E09, {   -1,    -1,  9386,    -1,    -1}},
+    {0x169F01, { 2240,    -1,    -1,    -1,    -1}},
+    {0x16A001, { 2272,    -1,  4950,    -1,    -1}},
+    {0x16A003, { 1485,    -1,    -1,    -1,    -1}},
+    {0x16A007, {   -1,    -1,  7708,    -1,    -1}},
+    {0x16A009, {   -1,    -1,  9453,    -1,    -1}},
+    {0x16A101, { 2290,    -1,  5037,    -1,    -1}},
+    {0x16A103, { 1508,    -1,    -1,    -1,    -1}},
+    {0x16A109, {   -1,    -1,  9540,    -1,    -1}},
+    {0x16A300, {  148,    -1,    -1,    -1,    -1}},
+    {0x16A800, {  196,    -1,    -1,    -1,    -1}},
+    {0x16A801, { 2320,    -1,  5118,    -1,    -1}},
+    {0x16A805, {   -1,    -1,  6690,    -1,    -1}},
+    {0x16A807, {   -1,    -1,  7793,    -1,    -1}},
+    {0x16A809, {   -1,    -1,  9621,    -1,    -1}},
+    {0x16A901, { 2339,    -1,  5205,    -1,    -1}},
+    {0x16A909, {   -1,    -1,  9708,    -1,    -1}},
+    {0x16AA01, {   -1,    -1,  5233,    -1,    -1}},
+    {0x16AA09, {   -1,    -1,  9736,    -1,    -1}},
+    {0x16B001, { 2362,   161,  5314,    -1,    -1}},
+    {0x16B003, {   -1,    -1,  6398,    -1,    -1}},
+    {0x16B005, {   -1,    -1,  6711,    -1,    -1}},
+    {0x16B007, {   -1,    -1,  7850,    -1,    -1}},
+    {0x16B009, {   -1,    -1,  9817,    -1,    -1}},
+    {0x16B0F1, {   -1,    -1,    -1,   380,    -1}},
+    {0x16B101, {   -1,    -1,  5395,    -1,    -1}},
+    {0x16B105, {   -1,    -1,  6743,    -1,    -1}},
+    {0x16B107, {   -1,    -1,  7931,    -1,    -1}},
+    {0x16B109, {   -1,    -1,  9898,    -1,    -1}},
+    {0x16B201, {   -1,    -1,  5470,    -1,    -1}},
+    {0x16B205, {   -1,    -1,  6803,    -1,    -1}},
+    {0x16B207, {   -1,    -1,  8006,    -1,    -1}},
+    {0x16B209, {   -1,    -1,  9973,    -1,    -1}},
+    {0x16B301, {   -1,    -1,  5557,    -1,    -1}},
+    {0x16B309, {   -1,    -1, 10060,    -1,    -1}},
+    {0x16B401, {   -1,    -1,  5644,    -1,    -1}},
+    {0x16B407, {   -1,    -1,  8093,    -1,    -1}},
+    {0x16B409, {   -1,    -1, 10147,    -1,    -1}},
+    {0x16B501, {   -1,    -1,  5703,    -1,    -1}},
+    {0x16B507, {   -1,    -1,  8150,    -1,    -1}},
+    {0x16B509, {   -1,    -1, 10206,    -1,    -1}},
+    {0x16B601, {   -1,    -1,  5764,    -1,    -1}},
+    {0x16B609, {   -1,    -1, 10267,    -1,    -1}},
+    {0x16B801, { 2387,   179,  5832,    -1,    -1}},
+    {0x16B803, {   -1,    -1,  6416,    -1,    -1}},
+    {0x16B805, {   -1,    -1,  6864,    -1,    -1}},
+    {0x16B807, {   -1,    -1,  8226,    -1,    -1}},
+    {0x16B809, {   -1,    -1, 10335,    -1,    -1}},
+    {0x16B8F1, {   -1,    -1,    -1,   398,    -1}},
+    {0x16B901, { 2416,    -1,  5893,    -1,    -1}},
+    {0x16B905, {   -1,    -1,  6919,    -1,    -1}},
+    {0x16B907, {   -1,    -1,  8287,    -1,    -1}},
+    {0x16B909, {   -1,    -1, 10396,    -1,    -1}},
+    {0x16BA01, {   -1,    -1,  5946,    -1,    -1}},
+    {0x16BA07, {   -1,    -1,  8340,    -1,    -1}},
+    {0x16BA09, {   -1,    -1, 10449,    -1,    -1}},
+    {0x16BB01, {   -1,    -1,  6021,    -1,    -1}},
+    {0x16BB09, {   -1,    -1, 10524,    -1,    -1}},
+    {0x16BC01, {   -1,    -1,  6110,    -1,    -1}},
+    {0x16BC09, {   -1,    -1, 10613,    -1,    -1}},
+    {0x16BD01, {   -1,    -1,  6165,    -1,    -1}},
+    {0x16BD09, {   -1,    -1, 10668,    -1,    -1}},
+    {0x16BE01, {   -1,    -1,  6222,    -1,    -1}},
+    {0x16BE09, {   -1,    -1, 10725,    -1,    -1}},
+    {0x16C000, {  311,    -1,    -1,    -1,    -1}},
+    {0x16C001, { 2448,    -1,    -1,    -1,    -1}},
+    {0x16C101, { 2497,    -1,    -1,    -1,    -1}},
+    {0x16C201, { 2545,    -1,    -1,    -1,    -1}},
+    {0x16FE00, {  950,    -1,    -1,    -1,    -1}},
+    {0x16FF00, { 1078,    -1,    -1,    -1,    -1}},
+    {0x16FF01, { 2623,    -1,    -1,    -1,    -1}},
+    {0x16FF03, {   -1,    -1,  6466,    -1,    -1}},
+    {0x170000, {   -1,    -1,    -1,    -1,    46}},
+    {0x170001, { 1549,    -1,    -1,    -1,   139}},
+    {0x170002, {   -1,    -1,   542,    -1,    -1}},
+    {0x170003, {   -1,    -1,  6293,    -1,    -1}},
+    {0x170004, {   -1,    -1,   867,    -1,    -1}},
+    {0x170005, {   -1,    -1,  6544,    -1,    -1}},
+    {0x170007, {   -1,    -1,  7007,    -1,    -1}},
+    {0x170009, {   -1,    -1,  8433,    -1,    -1}},
+    {0x170010, {   -1,    -1,  1688,    -1,    -1}},
+    {0x170020, {   -1,    -1,  2637,    -1,    -1}},
+    {0x170030, {   -1,    -1,  3212,    -1,    -1}},
+    {0x170032, {   -1,    -1,  3335,    -1,    -1}},
+    {0x170034, {   -1,    -1,  3395,    -1,    -1}},
+    {0x1700F1, {   -1,    -1,    -1,   275,    -1}},
+    {0x1700F2, {   -1,    -1,    -1,    46,    -1}},
+    {0x170100, {   -1,    -1,    46,    -1,    -1}},
+    {0x170101, {   -1,    -1,  4050,    -1,    -1}},
+    {0x170105, {   -1,    -1,  6591,    -1,    -1}},
+    {0x170107, {   -1,    -1,  7095,    -1,    -1}},
+    {0x170109, {   -1,    -1,  8553,    -1,    -1}},
+    {0x1701F2, {   -1,    -1,    -1,   156,    -1}},
+    {0x1701FC, {   -1,    -1,  3860,    -1,    -1}},
+    {0x1701FE, {   -1,    -1,  3924,    -1,    -1}},
+    {0x170200, {   -1,    -1,   174,    -1,    -1}},
+    {0x170201, {   -1,    -1,  4151,    -1,    -1}},
+    {0x170207, {   -1,    -1,  7122,    -1,    -1}},
+    {0x170209, {   -1,    -1,  8654,    -1,    -1}},
+    {0x170300, {   -1,    -1,   302,    -1,    -1}},
+    {0x170301, { 1640,    -1,    -1,    -1,    -1}},
+    {0x170320, {   -1,    -1,  2744,    -1,    -1}},
+    {0x170400, {   -1,    -1,   430,    -1,    -1}},
+    {0x170401, { 1701,    -1,    -1,    -1,    -1}},
+    {0x170402, {   -1,    -1,   785,    -1,    -1}},
+    {0x170404, {   -1,    -1,  1019,    -1,    -1}},
+    {0x170410, {   -1,    -1,  1995,    -1,    -1}},
+    {0x170420, {   -1,    -1,  2806,    -1,    -1}},
+    {0x170430, {   -1,    -1,  3302,    -1,    -1}},
+    {0x170432, {   -1,    -1,  3374,    -1,    -1}},
+    {0x170434, {   -1,    -1,  3420,    -1,    -1}},
+    {0x170501, { 1751,    -1,    -1,    -1,    -1}},
+    {0x170601, { 1797,    -1,    -1,    -1,    -1}},
+    {0x170701, { 1843,    -1,    -1,    -1,    -1}},
+    {0x170801, {   -1,    -1,  4234,    -1,    -1}},
+    {0x170805, {   -1,    -1,  6601,    -1,    -1}},
+    {0x170807, {   -1,    -1,  7149,    -1,    -1}},
+    {0x170809, {   -1,    -1,  8737,    -1,    -1}},
+    {0x170901, { 1894,    -1,  4290,    -1,    -1}},
+    {0x170907, {   -1,    -1,  7205,    -1,    -1}},
+    {0x170909, {   -1,    -1,  8793,    -1,    -1}},
+    {0x170A01, {   -1,    -1,  4388,    -1,    -1}},
+    {0x170A07, {   -1,    -1,  7293,    -1,    -1}},
+    {0x170A09, {   -1,    -1,  8891,    -1,    -1}},
+    {0x170B01, {   -1,    -1,  4431,    -1,    -1}},
+    {0x170B07, {   -1,    -1,  7327,    -1,    -1}},
+    {0x170B09, {   -1,    -1,  8934,    -1,    -1}},
+    {0x170C01, {   -1,    -1,  4479,    -1,    -1}},
+    {0x170C09, {   -1,    -1,  8982,    -1,    -1}},
+    {0x170D01, {   -1,    -1,  4531,    -1,    -1}},
+    {0x170D09, {   -1,    -1,  9034,    -1,    -1}},
+    {0x171001, {   -1,    -1,  4579,    -1,    -1}},
+    {0x171003, { 1388,    -1,    -1,    -1,    -1}},
+    {0x171005, {   -1,    -1,  6613,    -1,    -1}},
+    {0x171007, {   -1,    -1,  7367,    -1,    -1}},
+    {0x171009, {   -1,    -1,  9082,    -1,    -1}},
+    {0x171101, { 1946,    -1,    -1,    -1,    -1}},
+    {0x171103, { 1408,    -1,    -1,    -1,    -1}},
+    {0x171203, { 1447,    -1,    -1,    -1,    -1}},
+    {0x171801, {   -1,    -1,  4623,    -1,    -1}},
+    {0x171805, {   -1,    -1,  6627,    -1,    -1}},
+    {0x171807, {   -1,    -1,  7393,    -1,    -1}},
+    {0x171809, {   -1,    -1,  9126,    -1,    -1}},
+    {0x171901, { 1998,   130,  4676,    -1,    -1}},
+    {0x171903, {   -1,    -1,  6367,    -1,    -1}},
+    {0x171905, {   -1,    -1,  6644,    -1,    -1}},
+    {0x171907, {   -1,    -1,  7433,    -1,    -1}},
+    {0x171909, {   -1,    -1,  9179,    -1,    -1}},
+    {0x1719F1, {   -1,    -1,    -1,   349,    -1}},
+    {0x171A01, { 2032,    -1,  4719,    -1,    -1}},
+    {0x171A05, {   -1,    -1,  6666,    -1,    -1}},
+    {0x171A07, {   -1,    -1,  7474,    -1,    -1}},
+    {0x171A09, {   -1,    -1,  9222,    -1,    -1}},
+    {0x171B01, { 2073,    -1,  4761,    -1,    -1}},
+    {0x171B07, {   -1,    -1,  7515,    -1,    -1}},
+    {0x171B09, {   -1,    -1,  9264,    -1,    -1}},
+    {0x171C01, { 2106,    -1,  4802,    -1,    -1}},
+    {0x171C07, {   -1,    -1,  7556,    -1,    -1}},
+    {0x171C09, {   -1,    -1,  9305,    -1,    -1}},
+    {0x171D01, { 2150,    -1,  4843,    -1,    -1}},
+    {0x171D07, {   -1,    -1,  7597,    -1,    -1}},
+    {0x171D09, {   -1,    -1,  9346,    -1,    -1}},
+    {0x171E01, { 2194,    -1,  4884,    -1,    -1}},
+    {0x171E07, {   -1,    -1,  7638,    -1,    -1}},
+    {0x171E09, {   -1,    -1,  9387,    -1,    -1}},
+    {0x171F01, { 2241,    -1,    -1,    -1,    -1}},
+    {0x172001, {   -1,    -1,  4951,    -1,    -1}},
+    {0x172003, { 1486,    -1,    -1,    -1,    -1}},
+    {0x172005, {   -1,    -1,  6681,    -1,    -1}},
+    {0x172007, {   -1,    -1,  7709,    -1,    -1}},
+    {0x172009, {   -1,    -1,  9454,    -1,    -1}},
+    {0x172101, { 2291,    -1,  5038,    -1,    -1}},
+    {0x172103, { 1509,    -1,    -1,    -1,    -1}},
+    {0x172109, {   -1,    -1,  9541,    -1,    -1}},
+    {0x172800, {  197,    -1,    -1,    -1,    -1}},
+    {0x172801, {   -1,    -1,  5119,    -1,    -1}},
+    {0x172805, {   -1,    -1,  6691,    -1,    -1}},
+    {0x172807, {   -1,    -1,  7794,    -1,    -1}},
+    {0x172809, {   -1,    -1,  9622,    -1,    -1}},
+    {0x172901, { 2340,    -1,  5206,    -1,    -1}},
+    {0x172909, {   -1,    -1,  9709,    -1,    -1}},
+    {0x172A01, {   -1,    -1,  5234,    -1,    -1}},
+    {0x172A09, {   -1,    -1,  9737,    -1,    -1}},
+    {0x173001, {   -1,   162,  5315,    -1,    -1}},
+    {0x173003, {   -1,    -1,  6399,    -1,    -1}},
+    {0x173005, {   -1,    -1,  6712,    -1,    -1}},
+    {0x173007, {   -1,    -1,  7851,    -1,    -1}},
+    {0x173009, {   -1,    -1,  9818,    -1,    -1}},
+    {0x1730F1, {   -1,    -1,    -1,   381,    -1}},
+    {0x173101, {   -1,    -1,  5396,    -1,    -1}},
+    {0x173105, {   -1,    -1,  6744,    -1,    -1}},
+    {0x173107, {   -1,    -1,  7932,    -1,    -1}},
+    {0x173109, {   -1,    -1,  9899,    -1,    -1}},
+    {0x173201, {   -1,    -1,  5471,    -1,    -1}},
+    {0x173205, {   -1,    -1,  6804,    -1,    -1}},
+    {0x173207, {   -1,    -1,  8007,    -1,    -1}},
+    {0x173209, {   -1,    -1,  9974,    -1,    -1}},
+    {0x173301, {   -1,    -1,  5558,    -1,    -1}},
+    {0x173309, {   -1,    -1, 10061,    -1,    -1}},
+    {0x173401, {   -1,    -1,  5645,    -1,    -1}},
+    {0x173407, {   -1,    -1,  8094,    -1,    -1}},
+    {0x173409, {   -1,    -1, 10148,    -1,    -1}},
+    {0x173501, {   -1,    -1,  5704,    -1,    -1}},
+    {0x173507, {   -1,    -1,  8151,    -1,    -1}},
+    {0x173509, {   -1,    -1, 10207,    -1,    -1}},
+    {0x173601, {   -1,    -1,  5765,    -1,    -1}},
+    {0x173609, {   -1,    -1, 10268,    -1,    -1}},
+    {0x173801, { 2388,   180,  5833,    -1,    -1}},
+    {0x173803, {   -1,    -1,  6417,    -1,    -1}},
+    {0x173805, {   -1,    -1,  6865,    -1,    -1}},
+    {0x173807, {   -1,    -1,  8227,    -1,    -1}},
+    {0x173809, {   -1,    -1, 10336,    -1,    -1}},
+    {0x1738F1, {   -1,    -1,    -1,   399,    -1}},
+    {0x173901, { 2417,    -1,  5894,    -1,    -1}},
+    {0x173905, {   -1,    -1,  6920,    -1,    -1}},
+    {0x173907, {   -1,    -1,  8288,    -1,    -1}},
+    {0x173909, {   -1,    -1, 10397,    -1,    -1}},
+    {0x173A01, {   -1,    -1,  5947,    -1,    -1}},
+    {0x173A07, {   -1,    -1,  8341,    -1,    -1}},
+    {0x173A09, {   -1,    -1, 10450,    -1,    -1}},
+    {0x173B01, {   -1,    -1,  6022,    -1,    -1}},
+    {0x173B09, {   -1,    -1, 10525,    -1,    -1}},
+    {0x173C01, {   -1,    -1,  6111,    -1,    -1}},
+    {0x173C09, {   -1,    -1, 10614,    -1,    -1}},
+    {0x173D01, {   -1,    -1,  6166,    -1,    -1}},
+    {0x173D09, {   -1,    -1, 10669,    -1,    -1}},
+    {0x173E01, {   -1,    -1,  6223,    -1,    -1}},
+    {0x173E09, {   -1,    -1, 10726,    -1,    -1}},
+    {0x174000, {  312,    -1,    -1,    -1,    -1}},
+    {0x174001, { 2449,    -1,    -1,    -1,    -1}},
+    {0x174101, { 2498,    -1,    -1,    -1,    -1}},
+    {0x174201, { 2546,    -1,    -1,    -1,    -1}},
+    {0x176000, {  849,    -1,    -1,    -1,    -1}},
+    {0x177E00, {  951,    -1,    -1,    -1,    -1}},
+    {0x177E01, { 2580,    -1,    -1,    -1,    -1}},
+    {0x177F00, { 1079,    -1,    -1,    -1,    -1}},
+    {0x177F01, { 2624,    -1,    -1,    -1,    -1}},
+    {0x177F03, {   -1,    -1,  6467,    -1,    -1}},
+    {0x178000, {   -1,    -1,    -1,    -1,    47}},
+    {0x178001, {   -1,    -1,    -1,    -1,   140}},
+    {0x178003, {   -1,    -1,  6294,    -1,    -1}},
+    {0x178005, {   -1,    -1,  6545,    -1,    -1}},
+    {0x178007, {   -1,    -1,  7008,    -1,    -1}},
+    {0x178009, {   -1,    -1,  8434,    -1,    -1}},
+    {0x1780F1, {   -1,    -1,    -1,   276,    -1}},
+    {0x1780F2, {   -1,    -1,    -1,    47,    -1}},
+    {0x178100, {   -1,    -1,    47,    -1,    -1}},
+    {0x178101, {   -1,    -1,  4051,    -1,    -1}},
+    {0x178107, {   -1,    -1,  7096,    -1,    -1}},
+    {0x178109, {   -1,    -1,  8554,    -1,    -1}},
+    {0x1781FC, {   -1,    -1,  3861,    -1,    -1}},
+    {0x1781FE, {   -1,    -1,  3925,    -1,    -1}},
+    {0x178200, {   -1,    -1,   175,    -1,    -1}},
+    {0x178201, { 1585,    -1,  4152,    -1,    -1}},
+    {0x178207, {   -1,    -1,  7123,    -1,    -1}},
+    {0x178209, {   -1,    -1,  8655,    -1,    -1}},
+    {0x178300, {   -1,    -1,   303,    -1,    -1}},
+    {0x178301, { 1641,    -1,    -1,    -1,    -1}},
+    {0x178400, {   -1,    -1,   431,    -1,    -1}},
+    {0x178401, { 1702,    -1,    -1,    -1,    -1}},
+    {0x178501, { 1752,    -1,    -1,    -1,    -1}},
+    {0x178601, { 1798,    -1,    -1,    -1,    -1}},
+    {0x178701, { 1844,    -1,    -1,    -1,    -1}},
+    {0x178801, { 1875,   101,  4235,    -1,    -1}},
+    {0x178803, {   -1,    -1,  6338,    -1,    -1}},
+    {0x178805, {   -1,    -1,  6602,    -1,    -1}},
+    {0x178807, {   -1,    -1,  7150,    -1,    -1}},
+    {0x178809, {   -1,    -1,  8738,    -1,    -1}},
+    {0x1788F1, {   -1,    -1,    -1,   320,    -1}},
+    {0x178901, { 1895,    -1,  4291,    -1,    -1}},
+    {0x178907, {   -1,    -1,  7206,    -1,    -1}},
+    {0x178909, {   -1,    -1,  8794,    -1,    -1}},
+    {0x178A01, {   -1,    -1,  4389,    -1,    -1}},
+    {0x178A07, {   -1,    -1,  7294,    -1,    -1}},
+    {0x178A09, {   -1,    -1,  8892,    -1,    -1}},
+    {0x178B01, {   -1,    -1,  4432,    -1,    -1}},
+    {0x178B07, {   -1,    -1,  7328,    -1,    -1}},
+    {0x178B09, {   -1,    -1,  8935,    -1,    -1}},
+    {0x178C01, {   -1,    -1,  4480,    -1,    -1}},
+    {0x178C09, {   -1,    -1,  8983,    -1,    -1}},
+    {0x178D01, {   -1,    -1,  4532,    -1,    -1}},
+    {0x178D09, {   -1,    -1,  9035,    -1,    -1}},
+    {0x179001, { 1925,   109,  4580,    -1,    -1}},
+    {0x179003, { 1389,    -1,  6346,    -1,    -1}},
+    {0x179005, {   -1,    -1,  6614,    -1,    -1}},
+    {0x179007, {   -1,    -1,  7368,    -1,    -1}},
+    {0x179009, {   -1,    -1,  9083,    -1,    -1}},
+    {0x1790F1, {   -1,    -1,    -1,   328,    -1}},
+    {0x179101, { 1947,    -1,    -1,    -1,    -1}},
+    {0x179103, { 1409,    -1,    -1,    -1,    -1}},
+    {0x179203, { 1448,    -1,    -1,    -1,    -1}},
+    {0x179801, { 1979,   118,  4624,    -1,    -1}},
+    {0x179803, {   -1,    -1,  6355,    -1,    -1}},
+    {0x179805, {   -1,    -1,  6628,    -1,    -1}},
+    {0x179807, {   -1,    -1,  7394,    -1,    -1}},
+    {0x179809, {   -1,    -1,  9127,    -1,    -1}},
+    {0x1798F1, {   -1,    -1,    -1,   337,    -1}},
+    {0x179901, { 1999,   131,  4677,    -1,    -1}},
+    {0x179903, {   -1,    -1,  6368,    -1,    -1}},
+    {0x179905, {   -1,    -1,  6645,    -1,    -1}},
+    {0x179907, {   -1,    -1,  7434,    -1,    -1}},
+    {0x179909, {   -1,    -1,  9180,    -1,    -1}},
+    {0x1799F1, {   -1,    -1,    -1,   350,    -1}},
+    {0x179A01, { 2033,    -1,  4720,    -1,    -1}},
+    {0x179A05, {   -1,    -1,  6667,    -1,    -1}},
+    {0x179A07, {   -1,    -1,  7475,    -1,    -1}},
+    {0x179A09, {   -1,    -1,  9223,    -1,    -1}},
+    {0x179B01, { 2074,    -1,  4762,    -1,    -1}},
+    {0x179B07, {   -1,    -1,  7516,    -1,    -1}},
+    {0x179B09, {   -1,    -1,  9265,    -1,    -1}},
+    {0x179C01, { 2107,    -1,  4803,    -1,    -1}},
+    {0x179C07, {   -1,    -1,  7557,    -1,    -1}},
+    {0x179C09, {   -1,    -1,  9306,    -1,    -1}},
+    {0x179D01, { 2151,    -1,  4844,    -1,    -1}},
+    {0x179D07, {   -1,    -1,  7598,    -1,    -1}},
+    {0x179D09, {   -1,    -1,  9347,    -1,    -1}},
+    {0x179E01, { 2195,    -1,  4885,    -1,    -1}},
+    {0x179E07, {   -1,    -1,  7639,    -1,    -1}},
+    {0x179E09, {   -1,    -1,  9388,    -1,    -1}},
+    {0x179F01, { 2242,    -1,    -1,    -1,    -1}},
+    {0x17A001, { 2273,    -1,  4952,    -1,    -1}},
+    {0x17A003, { 1487,    -1,    -1,    -1,    -1}},
+    {0x17A007, {   -1,    -1,  7710,    -1,    -1}},
+    {0x17A009, {   -1,    -1,  9455,    -1,    -1}},
+    {0x17A101, { 2292,    -1,  5039,    -1,    -1}},
+    {0x17A103, { 1510,    -1,    -1,    -1,    -1}},
+    {0x17A109, {   -1,    -1,  9542,    -1,    -1}},
+    {0x17A801, { 2321,    -1,  5120,    -1,    -1}},
+    {0x17A805, {   -1,    -1,  6692,    -1,    -1}},
+    {0x17A807, {   -1,    -1,  7795,    -1,    -1}},
+    {0x17A809, {   -1,    -1,  9623,    -1,    -1}},
+    {0x17A901, { 2341,    -1,  5207,    -1,    -1}},
+    {0x17A909, {   -1,    -1,  9710,    -1,    -1}},
+    {0x17AA01, {   -1,    -1,  5235,    -1,    -1}},
+    {0x17AA09, {   -1,    -1,  9738,    -1,    -1}},
+    {0x17AB00, {  256,    -1,    -1,    -1,    -1}},
+    {0x17B001, { 2363,   163,  5316,    -1,    -1}},
+    {0x17B003, {   -1,    -1,  6400,    -1,    -1}},
+    {0x17B005, {   -1,    -1,  6713,    -1,    -1}},
+    {0x17B007, {   -1,    -1,  7852,    -1,    -1}},
+    {0x17B009, {   -1,    -1,  9819,    -1,    -1}},
+    {0x17B0F1, {   -1,    -1,    -1,   382,    -1}},
+    {0x17B101, {   -1,    -1,  5397,    -1,    -1}},
+    {0x17B105, {   -1,    -1,  6745,    -1,    -1}},
+    {0x17B107, {   -1,    -1,  7933,    -1,    -1}},
+    {0x17B109, {   -1,    -1,  9900,    -1,    -1}},
+    {0x17B201, {   -1,    -1,  5472,    -1,    -1}},
+    {0x17B205, {   -1,    -1,  6805,    -1,    -1}},
+    {0x17B207, {   -1,    -1,  8008,    -1,    -1}},
+    {0x17B209, {   -1,    -1,  9975,    -1,    -1}},
+    {0x17B301, {   -1,    -1,  5559,    -1,    -1}},
+    {0x17B309, {   -1,    -1, 10062,    -1,    -1}},
+    {0x17B401, {   -1,    -1,  5646,    -1,    -1}},
+    {0x17B407, {   -1,    -1,  8095,    -1,    -1}},
+    {0x17B409, {   -1,    -1, 10149,    -1,    -1}},
+    {0x17B501, {   -1,    -1,  5705,    -1,    -1}},
+    {0x17B507, {   -1,    -1,  8152,    -1,    -1}},
+    {0x17B509, {   -1,    -1, 10208,    -1,    -1}},
+    {0x17B601, {   -1,    -1,  5766,    -1,    -1}},
+    {0x17B609, {   -1,    -1, 10269,    -1,    -1}},
+    {0x17B801, { 2389,   181,  5834,    -1,    -1}},
+    {0x17B803, {   -1,    -1,  6418,    -1,    -1}},
+    {0x17B805, {   -1,    -1,  6866,    -1,    -1}},
+    {0x17B807, {   -1,    -1,  8228,    -1,    -1}},
+    {0x17B809, {   -1,    -1, 10337,    -1,    -1}},
+    {0x17B8F1, {   -1,    -1,    -1,   400,    -1}},
+    {0x17B901, { 2418,    -1,  5895,    -1,    -1}},
+    {0x17B905, {   -1,    -1,  6921,    -1,    -1}},
+    {0x17B907, {   -1,    -1,  8289,    -1,    -1}},
+    {0x17B909, {   -1,    -1, 10398,    -1,    -1}},
+    {0x17BA01, {   -1,    -1,  5948,    -1,    -1}},
+    {0x17BA07, {   -1,    -1,  8342,    -1,    -1}},
+    {0x17BA09, {   -1,    -1, 10451,    -1,    -1}},
+    {0x17BB01, {   -1,    -1,  6023,    -1,    -1}},
+    {0x17BB09, {   -1,    -1, 10526,    -1,    -1}},
+    {0x17BC01, {   -1,    -1,  6112,    -1,    -1}},
+    {0x17BC09, {   -1,    -1, 10615,    -1,    -1}},
+    {0x17BD01, {   -1,    -1,  6167,    -1,    -1}},
+    {0x17BD09, {   -1,    -1, 10670,    -1,    -1}},
+    {0x17BE01, {   -1,    -1,  6224,    -1,    -1}},
+    {0x17BE09, {   -1,    -1, 10727,    -1,    -1}},
+    {0x17C001, { 2450,    -1,    -1,    -1,    -1}},
+    {0x17C101, { 2499,    -1,    -1,    -1,    -1}},
+    {0x17C201, { 2547,    -1,    -1,    -1,    -1}},
+    {0x17E100, {  878,    -1,    -1,    -1,    -1}},
+    {0x17FE00, {  952,    -1,    -1,    -1,    -1}},
+    {0x17FF00, { 1080,    -1,    -1,    -1,    -1}},
+    {0x17FF01, { 2625,    -1,    -1,    -1,    -1}},
+    {0x17FF03, {   -1,    -1,  6468,    -1,    -1}},
+    {0x180000, {   -1,    -1,    -1,    -1,    48}},
+    {0x180001, {   -1,    -1,    -1,    -1,   141}},
+    {0x180002, {   -1,    -1,   543,    -1,    -1}},
+    {0x180003, {   -1,    -1,  6295,    -1,    -1}},
+    {0x180004, {   -1,    -1,   868,    -1,    -1}},
+    {0x180005, {   -1,    -1,  6546,    -1,    -1}},
+    {0x180006, {   -1,    -1,  1081,    -1,    -1}},
+    {0x180007, {   -1,    -1,  7009,    -1,    -1}},
+    {0x180008, {   -1,    -1,  1250,    -1,    -1}},
+    {0x180009, {   -1,    -1,  8435,    -1,    -1}},
+    {0x18000A, {   -1,    -1,  1390,    -1,    -1}},
+    {0x18000C, {   -1,    -1,  1505,    -1,    -1}},
+    {0x18000E, {   -1,    -1,  1590,    -1,    -1}},
+    {0x180010, {   -1,    64,  1689,    -1,    -1}},
+    {0x180012, {   -1,    -1,  2082,    -1,    -1}},
+    {0x180014, {   -1,    -1,  2277,    -1,    -1}},
+    {0x180016, {   -1,    -1,  2385,    -1,    -1}},
+    {0x180018, {   -1,    -1,  2464,    -1,    -1}},
+    {0x18001A, {   -1,    -1,  2522,    -1,    -1}},
+    {0x18001C, {   -1,    -1,  2560,    -1,    -1}},
+    {0x18001E, {   -1,    -1,  2588,    -1,    -1}},
+    {0x180020, {   -1,    -1,  2638,    -1,    -1}},
+    {0x180022, {   -1,    -1,  2859,    -1,    -1}},
+    {0x180024, {   -1,    -1,  2969,    -1,    -1}},
+    {0x180026, {   -1,    -1,  3034,    -1,    -1}},
+    {0x180028, {   -1,    -1,  3084,    -1,    -1}},
+    {0x180030, {   -1,    -1,  3213,    -1,    -1}},
+    {0x180040, {   -1,    -1,  3540,    -1,    -1}},
+    {0x180042, {   -1,    -1,  3611,    -1,    -1}},
+    {0x180044, {   -1,    -1,  3643,    -1,    -1}},
+    {0x180050, {   -1,    -1,  3719,    -1,    -1}},
+    {0x180080, { 1276,    -1,    -1,    -1,    -1}},
+    {0x1800F1, {   -1,    -1,    -1,   277,    -1}},
+    {0x1800F2, {   -1,    -1,    -1,    48,    -1}},
+    {0x180100, {   -1,    -1,    48,    -1,    -1}},
+    {0x180101, {   -1,    -1,  4052,    -1,    -1}},
+    {0x180107, {   -1,    -1,  7097,    -1,    -1}},
+    {0x180109, {   -1,    -1,  8555,    -1,    -1}},
+    {0x180110, {   -1,    -1,  1779,    -1,    -1}},
+    {0x1801F2, {   -1,    -1,    -1,   157,    -1}},
+    {0x1801FC, {   -1,    -1,  3862,    -1,    -1}},
+    {0x1801FE, {   -1,    -1,  3926,    -1,    -1}},
+    {0x180200, {   -1,    -1,   176,    -1,    -1}},
+    {0x180201, { 1586,    -1,  4153,    -1,    -1}},
+    {0x180202, {   -1,    -1,   634,    -1,    -1}},
+    {0x180207, {   -1,    -1,  7124,    -1,    -1}},
+    {0x180209, {   -1,    -1,  8656,    -1,    -1}},
+    {0x180210, {   -1,    -1,  1821,    -1,    -1}},
+    {0x180212, {   -1,    -1,  2139,    -1,    -1}},
+    {0x180214, {   -1,    -1,  2312,    -1,    -1}},
+    {0x180216, {   -1,    -1,  2412,    -1,    -1}},
+    {0x180220, {   -1,    -1,  2705,    -1,    -1}},
+    {0x180230, {   -1,    -1,  3249,    -1,    -1}},
+    {0x1802F2, {   -1,    -1,    -1,   207,    -1}},
+    {0x180300, {   12,    -1,   304,    -1,    -1}},
+    {0x180301, { 1642,    -1,    -1,    -1,    -1}},
+    {0x180302, {   -1,    -1,   699,    -1,    -1}},
+    {0x180304, {   -1,    -1,   962,    -1,    -1}},
+    {0x180306, {   -1,    -1,  1156,    -1,    -1}},
+    {0x180310, {   -1,    -1,  1893,    -1,    -1}},
+    {0x180312, {   -1,    -1,  2166,    -1,    -1}},
+    {0x180314, {   -1,    -1,  2320,    -1,    -1}},
+    {0x180316, {   -1,    -1,  2416,    -1,    -1}},
+    {0x180318, {   -1,    -1,  2488,    -1,    -1}},
+    {0x180320, {   -1,    -1,  2745,    -1,    -1}},
+    {0x180330, {   -1,    -1,  3269,    -1,    -1}},
+    {0x180340, {   -1,    -1,  3572,    -1,    -1}},
+    {0x180342, {   -1,    -1,  3622,    -1,    -1}},
+    {0x180400, {   -1,    -1,   432,    -1,    -1}},
+    {0x180401, { 1703,    -1,    -1,    -1,    -1}},
+    {0x180402, {   -1,    -1,   786,    -1,    -1}},
+    {0x180404, {   -1,    -1,  1020,    -1,    -1}},
+    {0x180406, {   -1,    -1,  1195,    -1,    -1}},
+    {0x180408, {   -1,    -1,  1341,    -1,    -1}},
+    {0x18040A, {   -1,    -1,  1466,    -1,    -1}},
+    {0x18040C, {   -1,    -1,  1559,    -1,    -1}},
+    {0x18040E, {   -1,    -1,  1627,    -1,    -1}},
+    {0x180410, {   -1,    -1,  1996,    -1,    -1}},
+    {0x180412, {   -1,    -1,  2221,    -1,    -1}},
+    {0x180414, {   -1,    -1,  2347,    -1,    -1}},
+    {0x180416, {   -1,    -1,  2433,    -1,    -1}},
+    {0x180418, {   -1,    -1,  2498,    -1,    -1}},
+    {0x18041A, {   -1,    -1,  2543,    -1,    -1}},
+    {0x18041C, {   -1,    -1,  2575,    -1,    -1}},
+    {0x18041E, {   -1,    -1,  2601,    -1,    -1}},
+    {0x180420, {   -1,    -1,  2807,    -1,    -1}},
+    {0x180422, {   -1,    -1,  2934,    -1,    -1}},
+    {0x180424, {   -1,    -1,  3013,    -1,    -1}},
+    {0x180426, {   -1,    -1,  3065,    -1,    -1}},
+    {0x180428, {   -1,    -1,  3103,    -1,    -1}},
+    {0x180430, {   -1,    -1,  3303,    -1,    -1}},
+    {0x180440, {   -1,    -1,  3589,    -1,    -1}},
+    {0x180442, {   -1,    -1,  3633,    -1,    -1}},
+    {0x180444, {   -1,    -1,  3652,    -1,    -1}},
+    {0x180450, {   -1,    -1,  3737,    -1,    -1}},
+    {0x180501, { 1753,    -1,    -1,    -1,    -1}},
+    {0x180601, { 1799,    -1,    -1,    -1,    -1}},
+    {0x180701, { 1845,    -1,    -1,    -1,    -1}},
+    {0x180800, {   23,    -1,    -1,    -1,    -1}},
+    {0x180801, { 1876,   102,  4236,    -1,    -1}},
+    {0x180803, {   -1,    -1,  6339,    -1,    -1}},
+    {0x180805, {   -1,    -1,  6603,    -1,    -1}},
+    {0x180807, {   -1,    -1,  7151,    -1,    -1}},
+    {0x180809, {   -1,    -1,  8739,    -1,    -1}},
+    {0x1808F1, {   -1,    -1,    -1,   321,    -1}},
+    {0x180901, { 1896,    -1,  4292,    -1,    -1}},
+    {0x180907, {   -1,    -1,  7207,    -1,    -1}},
+    {0x180909, {   -1,    -1,  8795,    -1,    -1}},
+    {0x180A01, {   -1,    -1,  4390,    -1,    -1}},
+    {0x180A07, {   -1,    -1,  7295,    -1,    -1}},
+    {0x180A09, {   -1,    -1,  8893,    -1,    -1}},
+    {0x180B01, {   -1,    -1,  4433,    -1,    -1}},
+    {0x180B07, {   -1,    -1,  7329,    -1,    -1}},
+    {0x180B09, {   -1,    -1,  8936,    -1,    -1}},
+    {0x180C01, {   -1,    -1,  4481,    -1,    -1}},
+    {0x180C09, {   -1,    -1,  8984,    -1,    -1}},
+    {0x180D01, {   -1,    -1,  4533,    -1,    -1}},
+    {0x180D09, {   -1,    -1,  9036,    -1,    -1}},
+    {0x180E00, {   37,    -1,    -1,    -1,    -1}},
+    {0x181001, { 1926,   110,  4581,    -1,    -1}},
+    {0x181003, {   -1,    -1,  6347,    -1,    -1}},
+    {0x181005, {   -1,    -1,  6615,    -1,    -1}},
+    {0x181007, {   -1,    -1,  7369,    -1,    -1}},
+    {0x181009, {   -1,    -1,  9084,    -1,    -1}},
+    {0x1810F1, {   -1,    -1,    -1,   329,    -1}},
+    {0x181101, { 1948,    -1,    -1,    -1,    -1}},
+    {0x181103, { 1410,    -1,    -1,    -1,    -1}},
+    {0x181203, { 1449,    -1,    -1,    -1,    -1}},
+    {0x181800, {   84,    -1,    -1,    -1,    -1}},
+    {0x181801, { 1980,   119,  4625,    -1,    -1}},
+    {0x181803, {   -1,    -1,  6356,    -1,    -1}},
+    {0x181805, {   -1,    -1,  6629,    -1,    -1}},
+    {0x181807, {   -1,    -1,  7395,    -1,    -1}},
+    {0x181809, {   -1,    -1,  9128,    -1,    -1}},
+    {0x1818F1, {   -1,    -1,    -1,   338,    -1}},
+    {0x181901, { 2000,   132,  4678,    -1,    -1}},
+    {0x181903, {   -1,    -1,  6369,    -1,    -1}},
+    {0x181905, {   -1,    -1,  6646,    -1,    -1}},
+    {0x181907, {   -1,    -1,  7435,    -1,    -1}},
+    {0x181909, {   -1,    -1,  9181,    -1,    -1}},
+    {0x1819F1, {   -1,    -1,    -1,   351,    -1}},
+    {0x181A01, { 2034,    -1,  4721,    -1,    -1}},
+    {0x181A05, {   -1,    -1,  6668,    -1,    -1}},
+    {0x181A07, {   -1,    -1,  7476,    -1,    -1}},
+    {0x181A09, {   -1,    -1,  9224,    -1,    -1}},
+    {0x181B01, { 2075,    -1,  4763,    -1,    -1}},
+    {0x181B07, {   -1,    -1,  7517,    -1,    -1}},
+    {0x181B09, {   -1,    -1,  9266,    -1,    -1}},
+    {0x181C01, { 2108,    -1,  4804,    -1,    -1}},
+    {0x181C07, {   -1,    -1,  7558,    -1,    -1}},
+    {0x181C09, {   -1,    -1,  9307,    -1,    -1}},
+    {0x181D01, { 2152,    -1,  4845,    -1,    -1}},
+    {0x181D07, {   -1,    -1,  7599,    -1,    -1}},
+    {0x181D09, {   -1,    -1,  9348,    -1,    -1}},
+    {0x181E01, { 2196,    -1,  4886,    -1,    -1}},
+    {0x181E07, {   -1,    -1,  7640,    -1,    -1}},
+    {0x181E09, {   -1,    -1,  9389,    -1,    -1}},
+    {0x181F01, { 2243,    -1,    -1,    -1,    -1}},
+    {0x182001, { 2274,    -1,  4953,    -1,    -1}},
+    {0x182003, { 1488,    -1,    -1,    -1,    -1}},
+    {0x182007, {   -1,    -1,  7711,    -1,    -1}},
+    {0x182009, {   -1,    -1,  9456,    -1,    -1}},
+    {0x182101, { 2293,    -1,  5040,    -1,    -1}},
+    {0x182103, { 1511,    -1,    -1,    -1,    -1}},
+    {0x182109, {   -1,    -1,  9543,    -1,    -1}},
+    {0x182300, {  149,    -1,    -1,    -1,    -1}},
+    {0x182800, {  198,    -1,    -1,    -1,    -1}},
+    {0x182801, { 2322,    -1,  5121,    -1,    -1}},
+    {0x182805, {   -1,    -1,  6693,    -1,    -1}},
+    {0x182807, {   -1,    -1,  7796,    -1,    -1}},
+    {0x182809, {   -1,    -1,  9624,    -1,    -1}},
+    {0x182900, {  230,    -1,    -1,    -1,    -1}},
+    {0x182901, { 2342,    -1,  5208,    -1,    -1}},
+    {0x182909, {   -1,    -1,  9711,    -1,    -1}},
+    {0x182A00, {  244,    -1,    -1,    -1,    -1}},
+    {0x182A01, {   -1,    -1,  5236,    -1,    -1}},
+    {0x182A09, {   -1,    -1,  9739,    -1,    -1}},
+    {0x182D00, {  265,    -1,    -1,    -1,    -1}},
+    {0x183001, { 2364,   164,  5317,    -1,    -1}},
+    {0x183003, {   -1,    -1,  6401,    -1,    -1}},
+    {0x183005, {   -1,    -1,  6714,    -1,    -1}},
+    {0x183007, {   -1,    -1,  7853,    -1,    -1}},
+    {0x183009, {   -1,    -1,  9820,    -1,    -1}},
+    {0x1830F1, {   -1,    -1,    -1,   383,    -1}},
+    {0x183101, {   -1,    -1,  5398,    -1,    -1}},
+    {0x183105, {   -1,    -1,  6746,    -1,    -1}},
+    {0x183107, {   -1,    -1,  7934,    -1,    -1}},
+    {0x183109, {   -1,    -1,  9901,    -1,    -1}},
+    {0x183201, {   -1,    -1,  5473,    -1,    -1}},
+    {0x183205, {   -1,    -1,  6806,    -1,    -1}},
+    {0x183207, {   -1,    -1,  8009,    -1,    -1}},
+    {0x183209, {   -1,    -1,  9976,    -1,    -1}},
+    {0x183301, {   -1,    -1,  5560,    -1,    -1}},
+    {0x183309, {   -1,    -1, 10063,    -1,    -1}},
+    {0x183400, {  272,    -1,    -1,    -1,    -1}},
+    {0x183401, {   -1,    -1,  5647,    -1,    -1}},
+    {0x183407, {   -1,    -1,  8096,    -1,    -1}},
+    {0x183409, {   -1,    -1, 10150,    -1,    -1}},
+    {0x183501, {   -1,    -1,  5706,    -1,    -1}},
+    {0x183507, {   -1,    -1,  8153,    -1,    -1}},
+    {0x183509, {   -1,    -1, 10209,    -1,    -1}},
+    {0x183601, {   -1,    -1,  5767,    -1,    -1}},
+    {0x183609, {   -1,    -1, 10270,    -1,    -1}},
+    {0x183801, { 2390,   182,  5835,    -1,    -1}},
+    {0x183803, {   -1,    -1,  6419,    -1,    -1}},
+    {0x183805, {   -1,    -1,  6867,    -1,    -1}},
+    {0x183807, {   -1,    -1,  8229,    -1,    -1}},
+    {0x183809, {   -1,    -1, 10338,    -1,    -1}},
+    {0x1838F1, {   -1,    -1,    -1,   401,    -1}},
+    {0x183901, { 2419,    -1,  5896,    -1,    -1}},
+    {0x183905, {   -1,    -1,  6922,    -1,    -1}},
+    {0x183907, {   -1,    -1,  8290,    -1,    -1}},
+    {0x183909, {   -1,    -1, 10399,    -1,    -1}},
+    {0x183A01, {   -1,    -1,  5949,    -1,    -1}},
+    {0x183A07, {   -1,    -1,  8343,    -1,    -1}},
+    {0x183A09, {   -1,    -1, 10452,    -1,    -1}},
+    {0x183B01, {   -1,    -1,  6024,    -1,    -1}},
+    {0x183B09, {   -1,    -1, 10527,    -1,    -1}},
+    {0x183C01, {   -1,    -1,  6113,    -1,    -1}},
+    {0x183C09, {   -1,    -1, 10616,    -1,    -1}},
+    {0x183D01, {   -1,    -1,  6168,    -1,    -1}},
+    {0x183D09, {   -1,    -1, 10671,    -1,    -1}},
+    {0x183E01, {   -1,    -1,  6225,    -1,    -1}},
+    {0x183E09, {   -1,    -1, 10728,    -1,    -1}},
+    {0x184000, {  313,    -1,    -1,    -1,    -1}},
+    {0x184001, { 2451,    -1,    -1,    -1,    -1}},
+    {0x184100, {  403,    -1,    -1,    -1,    -1}},
+    {0x184101, { 2500,    -1,    -1,    -1,    -1}},
+    {0x184200, {  481,    -1,    -1,    -1,    -1}},
+    {0x184201, { 2548,    -1,    -1,    -1,    -1}},
+    {0x184300, {  547,    -1,    -1,    -1,    -1}},
+    {0x184400, {  593,    -1,    -1,    -1,    -1}},
+    {0x184500, {  626,    -1,    -1,    -1,    -1}},
+    {0x184600, {  656,    -1,    -1,    -1,    -1}},
+    {0x184700, {  684,    -1,    -1,    -1,    -1}},
+    {0x184800, {  707,    -1,    -1,    -1,    -1}},
+    {0x184900, {  726,    -1,    -1,    -1,    -1}},
+    {0x184A00, {  744,    -1,    -1,    -1,    -1}},
+    {0x184B00, {  759,    -1,    -1,    -1,    -1}},
+    {0x184C00, {  773,    -1,    -1,    -1,    -1}},
+    {0x187E00, {  953,    -1,    -1,    -1,    -1}},
+    {0x187F00, { 1081,    -1,    -1,    -1,    -1}},
+    {0x187F01, { 2626,    -1,    -1,    -1,    -1}},
+    {0x187F03, {   -1,    -1,  6469,    -1,    -1}},
+    {0x188000, {   -1,    -1,    -1,    -1,    49}},
+    {0x188001, { 1550,    -1,    -1,    -1,   142}},
+    {0x188002, {   -1,    -1,   544,    -1,    -1}},
+    {0x188003, {   -1,    -1,  6296,    -1,    -1}},
+    {0x188004, {   -1,    -1,   869,    -1,    -1}},
+    {0x188005, {   -1,    -1,  6547,    -1,    -1}},
+    {0x188007, {   -1,    -1,  7010,    -1,    -1}},
+    {0x188009, {   -1,    -1,  8436,    -1,    -1}},
+    {0x188010, {   -1,    -1,  1690,    -1,    -1}},
+    {0x188012, {   -1,    -1,  2083,    -1,    -1}},
+    {0x188014, {   -1,    -1,  2278,    -1,    -1}},
+    {0x188016, {   -1,    -1,  2386,    -1,    -1}},
+    {0x188018, {   -1,    -1,  2465,    -1,    -1}},
+    {0x18801A, {   -1,    -1,  2523,    -1,    -1}},
+    {0x188080, { 1277,    -1,    -1,    -1,    -1}},
+    {0x1880F1, {   -1,    -1,    -1,   278,    -1}},
+    {0x1880F2, {   -1,    -1,    -1,    49,    -1}},
+    {0x188100, {   -1,    -1,    49,    -1,    -1}},
+    {0x188101, {   -1,    -1,  4053,    -1,    -1}},
+    {0x188107, {   -1,    -1,  7098,    -1,    -1}},
+    {0x188109, {   -1,    -1,  8556,    -1,    -1}},
+    {0x1881FC, {   -1,    -1,  3863,    -1,    -1}},
+    {0x1881FE, {   -1,    -1,  3927,    -1,    -1}},
+    {0x188200, {   -1,    -1,   177,    -1,    -1}},
+    {0x188201, { 1587,    -1,  4154,    -1,    -1}},
+    {0x188202, {   -1,    -1,   635,    -1,    -1}},
+    {0x188207, {   -1,    -1,  7125,    -1,    -1}},
+    {0x188209, {   -1,    -1,  8657,    -1,    -1}},
+    {0x188210, {   -1,    -1,  1822,    -1,    -1}},
+    {0x188212, {   -1,    -1,  2140,    -1,    -1}},
+    {0x188214, {   -1,    -1,  2313,    -1,    -1}},
+    {0x188300, {   13,    -1,   305,    -1,    -1}},
+    {0x188301, { 1643,    -1,    -1,    -1,    -1}},
+    {0x188302, {   -1,    -1,   700,    -1,    -1}},
+    {0x188310, {   -1,    -1,  1894,    -1,    -1}},
+    {0x188312, {   -1,    -1,  2167,    -1,    -1}},
+    {0x188314, {   -1,    -1,  2321,    -1,    -1}},
+    {0x188400, {   -1,    -1,   433,    -1,    -1}},
+    {0x188401, { 1704,    -1,    -1,    -1,    -1}},
+    {0x188402, {   -1,    -1,   787,    -1,    -1}},
+    {0x188404, {   -1,    -1,  1021,    -1,    -1}},
+    {0x188410, {   -1,    -1,  1997,    -1,    -1}},
+    {0x188412, {   -1,    -1,  2222,    -1,    -1}},
+    {0x188414, {   -1,    -1,  2348,    -1,    -1}},
+    {0x188416, {   -1,    -1,  2434,    -1,    -1}},
+    {0x188418, {   -1,    -1,  2499,    -1,    -1}},
+    {0x18841A, {   -1,    -1,  2544,    -1,    -1}},
+    {0x188501, { 1754,    -1,    -1,    -1,    -1}},
+    {0x188601, { 1800,    -1,    -1,    -1,    -1}},
+    {0x188701, { 1846,    -1,    -1,    -1,    -1}},
+    {0x188800, {   24,    -1,    -1,    -1,    -1}},
+    {0x188801, {   -1,    -1,  4237,    -1,    -1}},
+    {0x188807, {   -1,    -1,  7152,    -1,    -1}},
+    {0x188809, {   -1,    -1,  8740,    -1,    -1}},
+    {0x188901, {   -1,    -1,  4293,    -1,    -1}},
+    {0x188907, {   -1,    -1,  7208,    -1,    -1}},
+    {0x188909, {   -1,    -1,  8796,    -1,    -1}},
+    {0x188A01, {   -1,    -1,  4391,    -1,    -1}},
+    {0x188A07, {   -1,    -1,  7296,    -1,    -1}},
+    {0x188A09, {   -1,    -1,  8894,    -1,    -1}},
+    {0x188B01, {   -1,    -1,  4434,    -1,    -1}},
+    {0x188B07, {   -1,    -1,  7330,    -1,    -1}},
+    {0x188B09, {   -1,    -1,  8937,    -1,    -1}},
+    {0x188C01, {   -1,    -1,  4482,    -1,    -1}},
+    {0x188C09, {   -1,    -1,  8985,    -1,    -1}},
+    {0x188D01, {   -1,    -1,  4534,    -1,    -1}},
+    {0x188D09, {   -1,    -1,  9037,    -1,    -1}},
+    {0x189001, {   -1,    -1,  4582,    -1,    -1}},
+    {0x189007, {   -1,    -1,  7370,    -1,    -1}},
+    {0x189009, {   -1,    -1,  9085,    -1,    -1}},
+    {0x189103, { 1411,    -1,    -1,    -1,    -1}},
+    {0x189203, { 1450,    -1,    -1,    -1,    -1}},
+    {0x189801, {   -1,    -1,  4626,    -1,    -1}},
+    {0x189807, {   -1,    -1,  7396,    -1,    -1}},
+    {0x189809, {   -1,    -1,  9129,    -1,    -1}},
+    {0x189901, { 2001,   133,  4679,    -1,    -1}},
+    {0x189903, {   -1,    -1,  6370,    -1,    -1}},
+    {0x189905, {   -1,    -1,  6647,    -1,    -1}},
+    {0x189907, {   -1,    -1,  7436,    -1,    -1}},
+    {0x189909, {   -1,    -1,  9182,    -1,    -1}},
+    {0x1899F1, {   -1,    -1,    -1,   352,    -1}},
+    {0x189A01, { 2035,    -1,  4722,    -1,    -1}},
+    {0x189A07, {   -1,    -1,  7477,    -1,    -1}},
+    {0x189A09, {   -1,    -1,  9225,    -1,    -1}},
+    {0x189B01, { 2076,    -1,  4764,    -1,    -1}},
+    {0x189B07, {   -1,    -1,  7518,    -1,    -1}},
+    {0x189B09, {   -1,    -1,  9267,    -1,    -1}},
+    {0x189C01, { 2109,    -1,  4805,    -1,    -1}},
+    {0x189C07, {   -1,    -1,  7559,    -1,    -1}},
+    {0x189C09, {   -1,    -1,  9308,    -1,    -1}},
+    {0x189D01, { 2153,    -1,  4846,    -1,    -1}},
+    {0x189D07, {   -1,    -1,  7600,    -1,    -1}},
+    {0x189D09, {   -1,    -1,  9349,    -1,    -1}},
+    {0x189E01, { 2197,    -1,  4887,    -1,    -1}},
+    {0x189E07, {   -1,    -1,  7641,    -1,    -1}},
+    {0x189E09, {   -1,    -1,  9390,    -1,    -1}},
+    {0x189F01, { 2244,    -1,    -1,    -1,    -1}},
+    {0x18A001, {   -1,    -1,  4954,    -1,    -1}},
+    {0x18A003, { 1489,    -1,    -1,    -1,    -1}},
+    {0x18A007, {   -1,    -1,  7712,    -1,    -1}},
+    {0x18A009, {   -1,    -1,  9457,    -1,    -1}},
+    {0x18A101, {   -1,    -1,  5041,    -1,    -1}},
+    {0x18A103, { 1512,    -1,    -1,    -1,    -1}},
+    {0x18A109, {   -1,    -1,  9544,    -1,    -1}},
+    {0x18A800, {  199,    -1,    -1,    -1,    -1}},
+    {0x18A801, {   -1,    -1,  5122,    -1,    -1}},
+    {0x18A805, {   -1,    -1,  6694,    -1,    -1}},
+    {0x18A807, {   -1,    -1,  7797,    -1,    -1}},
+    {0x18A809, {   -1,    -1,  9625,    -1,    -1}},
+    {0x18A900, {  231,    -1,    -1,    -1,    -1}},
+    {0x18A901, { 2343,    -1,  5209,    -1,    -1}},
+    {0x18A909, {   -1,    -1,  9712,    -1,    -1}},
+    {0x18AA01, {   -1,    -1,  5237,    -1,    -1}},
+    {0x18AA09, {   -1,    -1,  9740,    -1,    -1}},
+    {0x18B001, { 2365,   165,  5318,    -1,    -1}},
+    {0x18B003, {   -1,    -1,  6402,    -1,    -1}},
+    {0x18B005, {   -1,    -1,  6715,    -1,    -1}},
+    {0x18B007, {   -1,    -1,  7854,    -1,    -1}},
+    {0x18B009, {   -1,    -1,  9821,    -1,    -1}},
+    {0x18B0F1, {   -1,    -1,    -1,   384,    -1}},
+    {0x18B101, {   -1,    -1,  5399,    -1,    -1}},
+    {0x18B105, {   -1,    -1,  6747,    -1,    -1}},
+    {0x18B107, {   -1,    -1,  7935,    -1,    -1}},
+    {0x18B109, {   -1,    -1,  9902,    -1,    -1}},
+    {0x18B201, {   -1,    -1,  5474,    -1,    -1}},
+    {0x18B205, {   -1,    -1,  6807,    -1,    -1}},
+    {0x18B207, {   -1,    -1,  8010,    -1,    -1}},
+    {0x18B209, {   -1,    -1,  9977,    -1,    -1}},
+    {0x18B301, {   -1,    -1,  5561,    -1,    -1}},
+    {0x18B309, {   -1,    -1, 10064,    -1,    -1}},
+    {0x18B401, {   -1,    -1,  5648,    -1,    -1}},
+    {0x18B407, {   -1,    -1,  8097,    -1,    -1}},
+    {0x18B409, {   -1,    -1, 10151,    -1,    -1}},
+    {0x18B501, {   -1,    -1,  5707,    -1,    -1}},
+    {0x18B507, {   -1,    -1,  8154,    -1,    -1}},
+    {0x18B509, {   -1,    -1, 10210,    -1,    -1}},
+    {0x18B601, {   -1,    -1,  5768,    -1,    -1}},
+    {0x18B609, {   -1,    -1, 10271,    -1,    -1}},
+    {0x18B801, { 2391,   183,  5836,    -1,    -1}},
+    {0x18B803, {   -1,    -1,  6420,    -1,    -1}},
+    {0x18B805, {   -1,    -1,  6868,    -1,    -1}},
+    {0x18B807, {   -1,    -1,  8230,    -1,    -1}},
+    {0x18B809, {   -1,    -1, 10339,    -1,    -1}},
+    {0x18B8F1, {   -1,    -1,    -1,   402,    -1}},
+    {0x18B901, { 2420,    -1,  5897,    -1,    -1}},
+    {0x18B905, {   -1,    -1,  6923,    -1,    -1}},
+    {0x18B907, {   -1,    -1,  8291,    -1,    -1}},
+    {0x18B909, {   -1,    -1, 10400,    -1,    -1}},
+    {0x18BA01, {   -1,    -1,  5950,    -1,    -1}},
+    {0x18BA07, {   -1,    -1,  8344,    -1,    -1}},
+    {0x18BA09, {   -1,    -1, 10453,    -1,    -1}},
+    {0x18BB01, {   -1,    -1,  6025,    -1,    -1}},
+    {0x18BB09, {   -1,    -1, 10528,    -1,    -1}},
+    {0x18BC01, {   -1,    -1,  6114,    -1,    -1}},
+    {0x18BC09, {   -1,    -1, 10617,    -1,    -1}},
+    {0x18BD01, {   -1,    -1,  6169,    -1,    -1}},
+    {0x18BD09, {   -1,    -1, 10672,    -1,    -1}},
+    {0x18BE01, {   -1,    -1,  6226,    -1,    -1}},
+    {0x18BE09, {   -1,    -1, 10729,    -1,    -1}},
+    {0x18C000, {  314,    -1,    -1,    -1,    -1}},
+    {0x18C001, { 2452,    -1,    -1,    -1,    -1}},
+    {0x18C100, {  404,    -1,    -1,    -1,    -1}},
+    {0x18C101, { 2501,    -1,    -1,    -1,    -1}},
+    {0x18C201, { 2549,    -1,    -1,    -1,    -1}},
+    {0x18FE00, {  954,    -1,    -1,    -1,    -1}},
+    {0x18FE01, { 2581,    -1,    -1,    -1,    -1}},
+    {0x18FF00, { 1082,    -1,    -1,    -1,    -1}},
+    {0x18FF01, { 2627,    -1,    -1,    -1,    -1}},
+    {0x18FF03, {   -1,    -1,  6470,    -1,    -1}},
+    {0x190000, {   -1,    -1,    -1,    -1,    50}},
+    {0x190001, {   -1,    -1,    -1,    -1,   143}},
+    {0x190002, {   -1,    -1,   545,    -1,    -1}},
+    {0x190003, {   -1,    -1,  6297,    -1,    -1}},
+    {0x190004, {   -1,    -1,   870,    -1,    -1}},
+    {0x190005, {   -1,    -1,  6548,    -1,    -1}},
+    {0x190006, {   -1,    -1,  1082,    -1,    -1}},
+    {0x190007, {   -1,    -1,  7011,    -1,    -1}},
+    {0x190008, {   -1,    -1,  1251,    -1,    -1}},
+    {0x190009, {   -1,    -1,  8437,    -1,    -1}},
+    {0x190010, {   -1,    65,  1691,    -1,    -1}},
+    {0x190012, {   -1,    -1,  2084,    -1,    -1}},
+    {0x190014, {   -1,    -1,  2279,    -1,    -1}},
+    {0x190016, {   -1,    -1,  2387,    -1,    -1}},
+    {0x190018, {   -1,    -1,  2466,    -1,    -1}},
+    {0x190020, {   -1,    -1,  2639,    -1,    -1}},
+    {0x190022, {   -1,    -1,  2860,    -1,    -1}},
+    {0x190030, {   -1,    -1,  3214,    -1,    -1}},
+    {0x190032, {   -1,    -1,  3336,    -1,    -1}},
+    {0x190080, { 1278,    -1,    -1,    -1,    -1}},
+    {0x1900F1, {   -1,    -1,    -1,   279,    -1}},
+    {0x1900F2, {   -1,    -1,    -1,    50,    -1}},
+    {0x190100, {   -1,    -1,    50,    -1,    -1}},
+    {0x190101, {   -1,    -1,  4054,    -1,    -1}},
+    {0x190107, {   -1,    -1,  7099,    -1,    -1}},
+    {0x190109, {   -1,    -1,  8557,    -1,    -1}},
+    {0x190110, {   -1,    -1,  1780,    -1,    -1}},
+    {0x1901F2, {   -1,    -1,    -1,   158,    -1}},
+    {0x1901FC, {   -1,    -1,  3864,    -1,    -1}},
+    {0x1901FE, {   -1,    -1,  3928,    -1,    -1}},
+    {0x190200, {   -1,    -1,   178,    -1,    -1}},
+    {0x190201, { 1588,    -1,  4155,    -1,    -1}},
+    {0x190202, {   -1,    -1,   636,    -1,    -1}},
+    {0x190207, {   -1,    -1,  7126,    -1,    -1}},
+    {0x190209, {   -1,    -1,  8658,    -1,    -1}},
+    {0x190210, {   -1,    -1,  1823,    -1,    -1}},
+    {0x190300, {   -1,    -1,   306,    -1,    -1}},
+    {0x190301, { 1644,    -1,    -1,    -1,    -1}},
+    {0x190302, {   -1,    -1,   701,    -1,    -1}},
+    {0x190304, {   -1,    -1,   963,    -1,    -1}},
+    {0x190306, {   -1,    -1,  1157,    -1,    -1}},
+    {0x190310, {   -1,    -1,  1895,    -1,    -1}},
+    {0x190312, {   -1,    -1,  2168,    -1,    -1}},
+    {0x190320, {   -1,    -1,  2746,    -1,    -1}},
+    {0x190322, {   -1,    -1,  2904,    -1,    -1}},
+    {0x190330, {   -1,    -1,  3270,    -1,    -1}},
+    {0x190332, {   -1,    -1,  3360,    -1,    -1}},
+    {0x190400, {   -1,    -1,   434,    -1,    -1}},
+    {0x190401, { 1705,    -1,    -1,    -1,    -1}},
+    {0x190402, {   -1,    -1,   788,    -1,    -1}},
+    {0x190404, {   -1,    -1,  1022,    -1,    -1}},
+    {0x190406, {   -1,    -1,  1196,    -1,    -1}},
+    {0x190408, {   -1,    -1,  1342,    -1,    -1}},
+    {0x190410, {   -1,    -1,  1998,    -1,    -1}},
+    {0x190412, {   -1,    -1,  2223,    -1,    -1}},
+    {0x190414, {   -1,    -1,  2349,    -1,    -1}},
+    {0x190416, {   -1,    -1,  2435,    -1,    -1}},
+    {0x190418, {   -1,    -1,  2500,    -1,    -1}},
+    {0x190420, {   -1,    -1,  2808,    -1,    -1}},
+    {0x190422, {   -1,    -1,  2935,    -1,    -1}},
+    {0x190430, {   -1,    -1,  3304,    -1,    -1}},
+    {0x190432, {   -1,    -1,  3375,    -1,    -1}},
+    {0x190501, { 1755,    -1,    -1,    -1,    -1}},
+    {0x190601, { 1801,    -1,    -1,    -1,    -1}},
+    {0x190701, { 1847,    -1,    -1,    -1,    -1}},
+    {0x190800, {   25,    -1,    -1,    -1,    -1}},
+    {0x190801, { 1877,   103,  4238,    -1,    -1}},
+    {0x190803, {   -1,    -1,  6340,    -1,    -1}},
+    {0x190805, {   -1,    -1,  6604,    -1,    -1}},
+    {0x190807, {   -1,    -1,  7153,    -1,    -1}},
+    {0x190809, {   -1,    -1,  8741,    -1,    -1}},
+    {0x1908F1, {   -1,    -1,    -1,   322,    -1}},
+    {0x190901, { 1897,    -1,  4294,    -1,    -1}},
+    {0x190907, {   -1,    -1,  7209,    -1,    -1}},
+    {0x190909, {   -1,    -1,  8797,    -1,    -1}},
+    {0x190A01, {   -1,    -1,  4392,    -1,    -1}},
+    {0x190A07, {   -1,    -1,  7297,    -1,    -1}},
+    {0x190A09, {   -1,    -1,  8895,    -1,    -1}},
+    {0x190B01, {   -1,    -1,  4435,    -1,    -1}},
+    {0x190B07, {   -1,    -1,  7331,    -1,    -1}},
+    {0x190B09, {   -1,    -1,  8938,    -1,    -1}},
+    {0x190C01, {   -1,    -1,  4483,    -1,    -1}},
+    {0x190C09, {   -1,    -1,  8986,    -1,    -1}},
+    {0x190D01, {   -1,    -1,  4535,    -1,    -1}},
+    {0x190D09, {   -1,    -1,  9038,    -1,    -1}},
+    {0x191001, { 1927,   111,  4583,    -1,    -1}},
+    {0x191003, {   -1,    -1,  6348,    -1,    -1}},
+    {0x191005, {   -1,    -1,  6616,    -1,    -1}},
+    {0x191007, {   -1,    -1,  7371,    -1,    -1}},
+    {0x191009, {   -1,    -1,  9086,    -1,    -1}},
+    {0x1910F1, {   -1,    -1,    -1,   330,    -1}},
+    {0x191101, { 1949,    -1,    -1,    -1,    -1}},
+    {0x191103, { 1412,    -1,    -1,    -1,    -1}},
+    {0x191200, {   57,    -1,    -1,    -1,    -1}},
+    {0x191203, { 1451,    -1,    -1,    -1,    -1}},
+    {0x191801, { 1981,   120,  4627,    -1,    -1}},
+    {0x191803, {   -1,    -1,  6357,    -1,    -1}},
+    {0x191805, {   -1,    -1,  6630,    -1,    -1}},
+    {0x191807, {   -1,    -1,  7397,    -1,    -1}},
+    {0x191809, {   -1,    -1,  9130,    -1,    -1}},
+    {0x1918F1, {   -1,    -1,    -1,   339,    -1}},
+    {0x191901, { 2002,   134,  4680,    -1,    -1}},
+    {0x191903, {   -1,    -1,  6371,    -1,    -1}},
+    {0x191905, {   -1,    -1,  6648,    -1,    -1}},
+    {0x191907, {   -1,    -1,  7437,    -1,    -1}},
+    {0x191909, {   -1,    -1,  9183,    -1,    -1}},
+    {0x1919F1, {   -1,    -1,    -1,   353,    -1}},
+    {0x191A01, { 2036,    -1,  4723,    -1,    -1}},
+    {0x191A05, {   -1,    -1,  6669,    -1,    -1}},
+    {0x191A07, {   -1,    -1,  7478,    -1,    -1}},
+    {0x191A09, {   -1,    -1,  9226,    -1,    -1}},
+    {0x191B00, {   96,    -1,    -1,    -1,    -1}},
+    {0x191B01, { 2077,    -1,  4765,    -1,    -1}},
+    {0x191B07, {   -1,    -1,  7519,    -1,    -1}},
+    {0x191B09, {   -1,    -1,  9268,    -1,    -1}},
+    {0x191C01, { 2110,    -1,  4806,    -1,    -1}},
+    {0x191C07, {   -1,    -1,  7560,    -1,    -1}},
+    {0x191C09, {   -1,    -1,  9309,    -1,    -1}},
+    {0x191D01, { 2154,    -1,  4847,    -1,    -1}},
+    {0x191D07, {   -1,    -1,  7601,    -1,    -1}},
+    {0x191D09, {   -1,    -1,  9350,    -1,    -1}},
+    {0x191E01, { 2198,    -1,  4888,    -1,    -1}},
+    {0x191E07, {   -1,    -1,  7642,    -1,    -1}},
+    {0x191E09, {   -1,    -1,  9391,    -1,    -1}},
+    {0x191F01, { 2245,    -1,    -1,    -1,    -1}},
+    {0x192001, { 2275,    -1,  4955,    -1,    -1}},
+    {0x192003, { 1490,    -1,    -1,    -1,    -1}},
+    {0x192007, {   -1,    -1,  7713,    -1,    -1}},
+    {0x192009, {   -1,    -1,  9458,    -1,    -1}},
+    {0x192101, { 2294,    -1,  5042,    -1,    -1}},
+    {0x192103, { 1513,    -1,    -1,    -1,    -1}},
+    {0x192109, {   -1,    -1,  9545,    -1,    -1}},
+    {0x192300, {  150,    -1,    -1,    -1,    -1}},
+    {0x192700, {  168,    -1,    -1,    -1,    -1}},
+    {0x192800, {  200,    -1,    -1,    -1,    -1}},
+    {0x192801, { 2323,    -1,  5123,    -1,    -1}},
+    {0x192805, {   -1,    -1,  6695,    -1,    -1}},
+    {0x192807, {   -1,    -1,  7798,    -1,    -1}},
+    {0x192809, {   -1,    -1,  9626,    -1,    -1}},
+    {0x192900, {  232,    -1,    -1,    -1,    -1}},
+    {0x192901, { 2344,    -1,  5210,    -1,    -1}},
+    {0x192909, {   -1,    -1,  9713,    -1,    -1}},
+    {0x192A00, {  245,    -1,    -1,    -1,    -1}},
+    {0x192A01, {   -1,    -1,  5238,    -1,    -1}},
+    {0x192A09, {   -1,    -1,  9741,    -1,    -1}},
+    {0x193001, { 2366,   166,  5319,    -1,    -1}},
+    {0x193003, {   -1,    -1,  6403,    -1,    -1}},
+    {0x193005, {   -1,    -1,  6716,    -1,    -1}},
+    {0x193007, {   -1,    -1,  7855,    -1,    -1}},
+    {0x193009, {   -1,    -1,  9822,    -1,    -1}},
+    {0x1930F1, {   -1,    -1,    -1,   385,    -1}},
+    {0x193101, {   -1,    -1,  5400,    -1,    -1}},
+    {0x193105, {   -1,    -1,  6748,    -1,    -1}},
+    {0x193107, {   -1,    -1,  7936,    -1,    -1}},
+    {0x193109, {   -1,    -1,  9903,    -1,    -1}},
+    {0x193201, {   -1,    -1,  5475,    -1,    -1}},
+    {0x193205, {   -1,    -1,  6808,    -1,    -1}},
+    {0x193207, {   -1,    -1,  8011,    -1,    -1}},
+    {0x193209, {   -1,    -1,  9978,    -1,    -1}},
+    {0x193301, {   -1,    -1,  5562,    -1,    -1}},
+    {0x193309, {   -1,    -1, 10065,    -1,    -1}},
+    {0x193401, {   -1,    -1,  5649,    -1,    -1}},
+    {0x193407, {   -1,    -1,  8098,    -1,    -1}},
+    {0x193409, {   -1,    -1, 10152,    -1,    -1}},
+    {0x193501, {   -1,    -1,  5708,    -1,    -1}},
+    {0x193507, {   -1,    -1,  8155,    -1,    -1}},
+    {0x193509, {   -1,    -1, 10211,    -1,    -1}},
+    {0x193601, {   -1,    -1,  5769,    -1,    -1}},
+    {0x193609, {   -1,    -1, 10272,    -1,    -1}},
+    {0x193801, { 2392,   184,  5837,    -1,    -1}},
+    {0x193803, {   -1,    -1,  6421,    -1,    -1}},
+    {0x193805, {   -1,    -1,  6869,    -1,    -1}},
+    {0x193807, {   -1,    -1,  8231,    -1,    -1}},
+    {0x193809, {   -1,    -1, 10340,    -1,    -1}},
+    {0x1938F1, {   -1,    -1,    -1,   403,    -1}},
+    {0x193901, { 2421,    -1,  5898,    -1,    -1}},
+    {0x193905, {   -1,    -1,  6924,    -1,    -1}},
+    {0x193907, {   -1,    -1,  8292,    -1,    -1}},
+    {0x193909, {   -1,    -1, 10401,    -1,    -1}},
+    {0x193A01, {   -1,    -1,  5951,    -1,    -1}},
+    {0x193A07, {   -1,    -1,  8345,    -1,    -1}},
+    {0x193A09, {   -1,    -1, 10454,    -1,    -1}},
+    {0x193B01, {   -1,    -1,  6026,    -1,    -1}},
+    {0x193B09, {   -1,    -1, 10529,    -1,    -1}},
+    {0x193C01, {   -1,    -1,  6115,    -1,    -1}},
+    {0x193C09, {   -1,    -1, 10618,    -1,    -1}},
+    {0x193D01, {   -1,    -1,  6170,    -1,    -1}},
+    {0x193D09, {   -1,    -1, 10673,    -1,    -1}},
+    {0x193E01, {   -1,    -1,  6227,    -1,    -1}},
+    {0x193E09, {   -1,    -1, 10730,    -1,    -1}},
+    {0x194000, {  315,    -1,    -1,    -1,    -1}},
+    {0x194001, { 2453,    -1,    -1,    -1,    -1}},
+    {0x194100, {  405,    -1,    -1,    -1,    -1}},
+    {0x194101, { 2502,    -1,    -1,    -1,    -1}},
+    {0x194200, {  482,    -1,    -1,    -1,    -1}},
+    {0x194201, { 2550,    -1,    -1,    -1,    -1}},
+    {0x194300, {  548,    -1,    -1,    -1,    -1}},
+    {0x194400, {  594,    -1,    -1,    -1,    -1}},
+    {0x194500, {  627,    -1,    -1,    -1,    -1}},
+    {0x194600, {  657,    -1,    -1,    -1,    -1}},
+    {0x194700, {  685,    -1,    -1,    -1,    -1}},
+    {0x197E00, {  955,    -1,    -1,    -1,    -1}},
+    {0x197F00, { 1083,    -1,    -1,    -1,    -1}},
+    {0x197F01, { 2628,    -1,    -1,    -1,    -1}},
+    {0x197F03, {   -1,    -1,  6471,    -1,    -1}},
+    {0x198000, {   -1,    -1,    -1,    -1,    51}},
+    {0x198001, { 1551,    -1,    -1,    -1,   144}},
+    {0x198002, {   -1,    -1,   546,    -1,    -1}},
+    {0x198003, {   -1,    -1,  6298,    -1,    -1}},
+    {0x198004, {   -1,    -1,   871,    -1,    -1}},
+    {0x198005, {   -1,    -1,  6549,    -1,    -1}},
+    {0x198006, {   -1,    -1,  1083,    -1,    -1}},
+    {0x198007, {   -1,    -1,  7012,    -1,    -1}},
+    {0x198008, {   -1,    -1,  1252,    -1,    -1}},
+    {0x198009, {   -1,    -1,  8438,    -1,    -1}},
+    {0x19800A, {   -1,    -1,  1391,    -1,    -1}},
+    {0x19800C, {   -1,    -1,  1506,    -1,    -1}},
+    {0x19800E, {   -1,    -1,  1591,    -1,    -1}},
+    {0x198010, {   -1,    -1,  1692,    -1,    -1}},
+    {0x198012, {   -1,    -1,  2085,    -1,    -1}},
+    {0x198014, {   -1,    -1,  2280,    -1,    -1}},
+    {0x198080, { 1279,    -1,    -1,    -1,    -1}},
+    {0x1980F1, {   -1,    -1,    -1,   280,    -1}},
+    {0x1980F2, {   -1,    -1,    -1,    51,    -1}},
+    {0x198100, {   -1,    -1,    51,    -1,    -1}},
+    {0x198101, {   -1,    -1,  4055,    -1,    -1}},
+    {0x198107, {   -1,    -1,  7100,    -1,    -1}},
+    {0x198109, {   -1,    -1,  8558,    -1,    -1}},
+    {0x1981FC, {   -1,    -1,  3865,    -1,    -1}},
+    {0x1981FE, {   -1,    -1,  3929,    -1,    -1}},
+    {0x198200, {   -1,    -1,   179,    -1,    -1}},
+    {0x198201, { 1589,    -1,  4156,    -1,    -1}},
+    {0x198207, {   -1,    -1,  7127,    -1,    -1}},
+    {0x198209, {   -1,    -1,  8659,    -1,    -1}},
+    {0x198300, {   -1,    -1,   307,    -1,    -1}},
+    {0x198301, { 1645,    -1,    -1,    -1,    -1}},
+    {0x198302, {   -1,    -1,   702,    -1,    -1}},
+    {0x198304, {   -1,    -1,   964,    -1,    -1}},
+    {0x198310, {   -1,    -1,  1896,    -1,    -1}},
+    {0x198400, {   -1,    -1,   435,    -1,    -1}},
+    {0x198401, { 1706,    -1,    -1,    -1,    -1}},
+    {0x198402, {   -1,    -1,   789,    -1,    -1}},
+    {0x198404, {   -1,    -1,  1023,    -1,    -1}},
+    {0x198406, {   -1,    -1,  1197,    -1,    -1}},
+    {0x198408, {   -1,    -1,  1343,    -1,    -1}},
+    {0x19840A, {   -1,    -1,  1467,    -1,    -1}},
+    {0x19840C, {   -1,    -1,  1560,    -1,    -1}},
+    {0x19840E, {   -1,    -1,  1628,    -1,    -1}},
+    {0x198410, {   -1,    -1,  1999,    -1,    -1}},
+    {0x198412, {   -1,    -1,  2224,    -1,    -1}},
+    {0x198414, {   -1,    -1,  2350,    -1,    -1}},
+    {0x198501, { 1756,    -1,    -1,    -1,    -1}},
+    {0x198601, { 1802,    -1,    -1,    -1,    -1}},
+    {0x198701, { 1848,    -1,    -1,    -1,    -1}},
+    {0x198801, {   -1,    -1,  4239,    -1,    -1}},
+    {0x198807, {   -1,    -1,  7154,    -1,    -1}},
+    {0x198809, {   -1,    -1,  8742,    -1,    -1}},
+    {0x198901, { 1898,    -1,  4295,    -1,    -1}},
+    {0x198907, {   -1,    -1,  7210,    -1,    -1}},
+    {0x198909, {   -1,    -1,  8798,    -1,    -1}},
+    {0x198A01, {   -1,    -1,  4393,    -1,    -1}},
+    {0x198A07, {   -1,    -1,  7298,    -1,    -1}},
+    {0x198A09, {   -1,    -1,  8896,    -1,    -1}},
+    {0x198B01, {   -1,    -1,  4436,    -1,    -1}},
+    {0x198B07, {   -1,    -1,  7332,    -1,    -1}},
+    {0x198B09, {   -1,    -1,  8939,    -1,    -1}},
+    {0x198C01, {   -1,    -1,  4484,    -1,    -1}},
+    {0x198C09, {   -1,    -1,  8987,    -1,    -1}},
+    {0x198D01, {   -1,    -1,  4536,    -1,    -1}},
+    {0x198D09, {   -1,    -1,  9039,    -1,    -1}},
+    {0x199001, {   -1,    -1,  4584,    -1,    -1}},
+    {0x199007, {   -1,    -1,  7372,    -1,    -1}},
+    {0x199009, {   -1,    -1,  9087,    -1,    -1}},
+    {0x199101, { 1950,    -1,    -1,    -1,    -1}},
+    {0x199103, { 1413,    -1,    -1,    -1,    -1}},
+    {0x199203, { 1452,    -1,    -1,    -1,    -1}},
+    {0x199500, {   78,    -1,    -1,    -1,    -1}},
+    {0x199801, {   -1,    -1,  4628,    -1,    -1}},
+    {0x199807, {   -1,    -1,  7398,    -1,    -1}},
+    {0x199809, {   -1,    -1,  9131,    -1,    -1}},
+    {0x199901, {   -1,    -1,  4681,    -1,    -1}},
+    {0x199907, {   -1,    -1,  7438,    -1,    -1}},
+    {0x199909, {   -1,    -1,  9184,    -1,    -1}},
+    {0x199A01, { 2037,    -1,  4724,    -1,    -1}},
+    {0x199A07, {   -1,    -1,  7479,    -1,    -1}},
+    {0x199A09, {   -1,    -1,  9227,    -1,    -1}},
+    {0x199B01, {   -1,    -1,  4766,    -1,    -1}},
+    {0x199B07, {   -1,    -1,  7520,    -1,    -1}},
+    {0x199B09, {   -1,    -1,  9269,    -1,    -1}},
+    {0x199C01, { 2111,    -1,  4807,    -1,    -1}},
+    {0x199C07, {   -1,    -1,  7561,    -1,    -1}},
+    {0x199C09, {   -1,    -1,  9310,    -1,    -1}},
+    {0x199D01, { 2155,    -1,  4848,    -1,    -1}},
+    {0x199D07, {   -1,    -1,  7602,    -1,    -1}},
+    {0x199D09, {   -1,    -1,  9351,    -1,    -1}},
+    {0x199E01, { 2199,    -1,  4889,    -1,    -1}},
+    {0x199E07, {   -1,    -1,  7643,    -1,    -1}},
+    {0x199E09, {   -1,    -1,  9392,    -1,    -1}},
+    {0x199F01, { 2246,    -1,    -1,    -1,    -1}},
+    {0x19A001, {   -1,    -1,  4956,    -1,    -1}},
+    {0x19A003, { 1491,    -1,    -1,    -1,    -1}},
+    {0x19A007, {   -1,    -1,  7714,    -1,    -1}},
+    {0x19A009, {   -1,    -1,  9459,    -1,    -1}},
+    {0x19A101, { 2295,    -1,  5043,    -1,    -1}},
+    {0x19A103, { 1514,    -1,    -1,    -1,    -1}},
+    {0x19A109, {   -1,    -1,  9546,    -1,    -1}},
+    {0x19A700, {  169,    -1,    -1,    -1,    -1}},
+    {0x19A801, {   -1,    -1,  5124,    -1,    -1}},
+    {0x19A805, {   -1,    -1,  6696,    -1,    -1}},
+    {0x19A807, {   -1,    -1,  7799,    -1,    -1}},
+    {0x19A809, {   -1,    -1,  9627,    -1,    -1}},
+    {0x19A901, { 2345,    -1,  5211,    -1,    -1}},
+    {0x19A909, {   -1,    -1,  9714,    -1,    -1}},
+    {0x19AA01, {   -1,    -1,  5239,    -1,    -1}},
+    {0x19AA09, {   -1,    -1,  9742,    -1,    -1}},
+    {0x19B001, { 2367,   167,  5320,    -1,    -1}},
+    {0x19B003, {   -1,    -1,  6404,    -1,    -1}},
+    {0x19B005, {   -1,    -1,  6717,    -1,    -1}},
+    {0x19B007, {   -1,    -1,  7856,    -1,    -1}},
+    {0x19B009, {   -1,    -1,  9823,    -1,    -1}},
+    {0x19B0F1, {   -1,    -1,    -1,   386,    -1}},
+    {0x19B101, {   -1,    -1,  5401,    -1,    -1}},
+    {0x19B105, {   -1,    -1,  6749,    -1,    -1}},
+    {0x19B107, {   -1,    -1,  7937,    -1,    -1}},
+    {0x19B109, {   -1,    -1,  9904,    -1,    -1}},
+    {0x19B201, {   -1,    -1,  5476,    -1,    -1}},
+    {0x19B205, {   -1,    -1,  6809,    -1,    -1}},
+    {0x19B207, {   -1,    -1,  8012,    -1,    -1}},
+    {0x19B209, {   -1,    -1,  9979,    -1,    -1}},
+    {0x19B301, {   -1,    -1,  5563,    -1,    -1}},
+    {0x19B309, {   -1,    -1, 10066,    -1,    -1}},
+    {0x19B401, {   -1,    -1,  5650,    -1,    -1}},
+    {0x19B407, {   -1,    -1,  8099,    -1,    -1}},
+    {0x19B409, {   -1,    -1, 10153,    -1,    -1}},
+    {0x19B501, {   -1,    -1,  5709,    -1,    -1}},
+    {0x19B507, {   -1,    -1,  8156,    -1,    -1}},
+    {0x19B509, {   -1,    -1, 10212,    -1,    -1}},
+    {0x19B601, {   -1,    -1,  5770,    -1,    -1}},
+    {0x19B609, {   -1,    -1, 10273,    -1,    -1}},
+    {0x19B801, { 2393,   185,  5838,    -1,    -1}},
+    {0x19B803, {   -1,    -1,  6422,    -1,    -1}},
+    {0x19B805, {   -1,    -1,  6870,    -1,    -1}},
+    {0x19B807, {   -1,    -1,  8232,    -1,    -1}},
+    {0x19B809, {   -1,    -1, 10341,    -1,    -1}},
+    {0x19B8F1, {   -1,    -1,    -1,   404,    -1}},
+    {0x19B901, { 2422,    -1,  5899,    -1,    -1}},
+    {0x19B905, {   -1,    -1,  6925,    -1,    -1}},
+    {0x19B907, {   -1,    -1,  8293,    -1,    -1}},
+    {0x19B909, {   -1,    -1, 10402,    -1,    -1}},
+    {0x19BA01, {   -1,    -1,  5952,    -1,    -1}},
+    {0x19BA07, {   -1,    -1,  8346,    -1,    -1}},
+    {0x19BA09, {   -1,    -1, 10455,    -1,    -1}},
+    {0x19BB01, {   -1,    -1,  6027,    -1,    -1}},
+    {0x19BB09, {   -1,    -1, 10530,    -1,    -1}},
+    {0x19BC01, {   -1,    -1,  6116,    -1,    -1}},
+    {0x19BC09, {   -1,    -1, 10619,    -1,    -1}},
+    {0x19BD01, {   -1,    -1,  6171,    -1,    -1}},
+    {0x19BD09, {   -1,    -1, 10674,    -1,    -1}},
+    {0x19BE01, {   -1,    -1,  6228,    -1,    -1}},
+    {0x19BE09, {   -1,    -1, 10731,    -1,    -1}},
+    {0x19C000, {  316,    -1,    -1,    -1,    -1}},
+    {0x19C001, { 2454,    -1,    -1,    -1,    -1}},
+    {0x19C100, {  406,    -1,    -1,    -1,    -1}},
+    {0x19C101, { 2503,    -1,    -1,    -1,    -1}},
+    {0x19C200, {  483,    -1,    -1,    -1,    -1}},
+    {0x19C201, { 2551,    -1,    -1,    -1,    -1}},
+    {0x19C300, {  549,    -1,    -1,    -1,    -1}},
+    {0x19C400, {  595,    -1,    -1,    -1,    -1}},
+    {0x19C500, {  628,    -1,    -1,    -1,    -1}},
+    {0x19C600, {  658,    -1,    -1,    -1,    -1}},
+    {0x19C700, {  686,    -1,    -1,    -1,    -1}},
+    {0x19C800, {  708,    -1,    -1,    -1,    -1}},
+    {0x19FE00, {  956,    -1,    -1,    -1,    -1}},
+    {0x19FE01, { 2582,    -1,    -1,    -1,    -1}},
+    {0x19FF00, { 1084,    -1,    -1,    -1,    -1}},
+    {0x19FF01, { 2629,    -1,    -1,    -1,    -1}},
+    {0x19FF03, {   -1,    -1,  6472,    -1,    -1}},
+    {0x1A0000, {   -1,    -1,    -1,    -1,    52}},
+    {0x1A0001, { 1552,    -1,    -1,    -1,   145}},
+    {0x1A0003, { 1328,    -1,  6299,    -1,    -1}},
+    {0x1A0005, {   -1,    -1,  6550,    -1,    -1}},
+    {0x1A0007, {   -1,    -1,  7013,    -1,    -1}},
+    {0x1A0009, {   -1,    -1,  8439,    -1,    -1}},
+    {0x1A0010, {   -1,    -1,  1693,    -1,    -1}},
+    {0x1A0012, {   -1,    -1,  2086,    -1,    -1}},
+    {0x1A0014, {   -1,    -1,  2281,    -1,    -1}},
+    {0x1A0016, {   -1,    -1,  2388,    -1,    -1}},
+    {0x1A0018, {   -1,    -1,  2467,    -1,    -1}},
+    {0x1A001A, {   -1,    -1,  2524,    -1,    -1}},
+    {0x1A001C, {   -1,    -1,  2561,    -1,    -1}},
+    {0x1A0020, {   -1,    -1,  2640,    -1,    -1}},
+    {0x1A0030, {   -1,    -1,  3215,    -1,    -1}},
+    {0x1A0040, {   -1,    97,  3541,    -1,    -1}},
+    {0x1A0042, {   -1,    -1,  3612,    -1,    -1}},
+    {0x1A0080, { 1280,    -1,    -1,    -1,    -1}},
+    {0x1A00F1, {   -1,    -1,    -1,   281,    -1}},
+    {0x1A00F2, {   -1,    -1,    -1,    52,    -1}},
+    {0x1A0100, {   -1,    -1,    52,    -1,    -1}},
+    {0x1A0101, {   -1,    -1,  4056,    -1,    -1}},
+    {0x1A0103, { 1353,    -1,    -1,    -1,    -1}},
+    {0x1A0107, {   -1,    -1,  7101,    -1,    -1}},
+    {0x1A0109, {   -1,    -1,  8559,    -1,    -1}},
+    {0x1A0140, {   -1,    -1,  3558,    -1,    -1}},
+    {0x1A01F2, {   -1,    -1,    -1,   159,    -1}},
+    {0x1A01FC, {   -1,    -1,  3866,    -1,    -1}},
+    {0x1A01FE, {   -1,    -1,  3930,    -1,    -1}},
+    {0x1A0200, {   -1,    -1,   180,    -1,    -1}},
+    {0x1A0201, { 1590,    -1,  4157,    -1,    -1}},
+    {0x1A0207, {   -1,    -1,  7128,    -1,    -1}},
+    {0x1A0209, {   -1,    -1,  8660,    -1,    -1}},
+    {0x1A0210, {   -1,    -1,  1824,    -1,    -1}},
+    {0x1A0212, {   -1,    -1,  2141,    -1,    -1}},
+    {0x1A0240, {   -1,    -1,  3564,    -1,    -1}},
+    {0x1A0300, {   14,    -1,   308,    -1,    -1}},
+    {0x1A0301, { 1646,    -1,    -1,    -1,    -1}},
+    {0x1A0310, {   -1,    -1,  1897,    -1,    -1}},
+    {0x1A0312, {   -1,    -1,  2169,    -1,    -1}},
+    {0x1A0314, {   -1,    -1,  2322,    -1,    -1}},
+    {0x1A0320, {   -1,    -1,  2747,    -1,    -1}},
+    {0x1A0330, {   -1,    -1,  3271,    -1,    -1}},
+    {0x1A0340, {   -1,    -1,  3573,    -1,    -1}},
+    {0x1A0342, {   -1,    -1,  3623,    -1,    -1}},
+    {0x1A0400, {   -1,    -1,   436,    -1,    -1}},
+    {0x1A0401, { 1707,    -1,    -1,    -1,    -1}},
+    {0x1A0410, {   -1,    -1,  2000,    -1,    -1}},
+    {0x1A0412, {   -1,    -1,  2225,    -1,    -1}},
+    {0x1A0414, {   -1,    -1,  2351,    -1,    -1}},
+    {0x1A0416, {   -1,    -1,  2436,    -1,    -1}},
+    {0x1A0418, {   -1,    -1,  2501,    -1,    -1}},
+    {0x1A041A, {   -1,    -1,  2545,    -1,    -1}},
+    {0x1A041C, {   -1,    -1,  2576,    -1,    -1}},
+    {0x1A0420, {   -1,    -1,  2809,    -1,    -1}},
+    {0x1A0430, {   -1,    -1,  3305,    -1,    -1}},
+    {0x1A0440, {   -1,    -1,  3590,    -1,    -1}},
+    {0x1A0442, {   -1,    -1,  3634,    -1,    -1}},
+    {0x1A0501, { 1757,    -1,    -1,    -1,    -1}},
+    {0x1A0601, { 1803,    -1,    -1,    -1,    -1}},
+    {0x1A0701, { 1849,    -1,    -1,    -1,    -1}},
+    {0x1A0801, {   -1,    -1,  4240,    -1,    -1}},
+    {0x1A0807, {   -1,    -1,  7155,    -1,    -1}},
+    {0x1A0809, {   -1,    -1,  8743,    -1,    -1}},
+    {0x1A0901, { 1899,    -1,  4296,    -1,    -1}},
+    {0x1A0907, {   -1,    -1,  7211,    -1,    -1}},
+    {0x1A0909, {   -1,    -1,  8799,    -1,    -1}},
+    {0x1A0A01, {   -1,    -1,  4394,    -1,    -1}},
+    {0x1A0A07, {   -1,    -1,  7299,    -1,    -1}},
+    {0x1A0A09, {   -1,    -1,  8897,    -1,    -1}},
+    {0x1A0B01, {   -1,    -1,  4437,    -1,    -1}},
+    {0x1A0B07, {   -1,    -1,  7333,    -1,    -1}},
+    {0x1A0B09, {   -1,    -1,  8940,    -1,    -1}},
+    {0x1A0C01, {   -1,    -1,  4485,    -1,    -1}},
+    {0x1A0C09, {   -1,    -1,  8988,    -1,    -1}},
+    {0x1A0D01, {   -1,    -1,  4537,    -1,    -1}},
+    {0x1A0D09, {   -1,    -1,  9040,    -1,    -1}},
+    {0x1A1000, {   44,    -1,    -1,    -1,    -1}},
+    {0x1A1001, {   -1,    -1,  4585,    -1,    -1}},
+    {0x1A1003, { 1390,    -1,    -1,    -1,    -1}},
+    {0x1A1007, {   -1,    -1,  7373,    -1,    -1}},
+    {0x1A1009, {   -1,    -1,  9088,    -1,    -1}},
+    {0x1A1101, { 1951,    -1,    -1,    -1,    -1}},
+    {0x1A1103, { 1414,    -1,    -1,    -1,    -1}},
+    {0x1A1203, { 1453,    -1,    -1,    -1,    -1}},
+    {0x1A1801, {   -1,   121,  4629,    -1,    -1}},
+    {0x1A1803, {   -1,    -1,  6358,    -1,    -1}},
+    {0x1A1805, {   -1,    -1,  6631,    -1,    -1}},
+    {0x1A1807, {   -1,    -1,  7399,    -1,    -1}},
+    {0x1A1809, {   -1,    -1,  9132,    -1,    -1}},
+    {0x1A18F1, {   -1,    -1,    -1,   340,    -1}},
+    {0x1A1901, {   -1,    -1,  4682,    -1,    -1}},
+    {0x1A1907, {   -1,    -1,  7439,    -1,    -1}},
+    {0x1A1909, {   -1,    -1,  9185,    -1,    -1}},
+    {0x1A1A01, { 2038,    -1,  4725,    -1,    -1}},
+    {0x1A1A05, {   -1,    -1,  6670,    -1,    -1}},
+    {0x1A1A07, {   -1,    -1,  7480,    -1,    -1}},
+    {0x1A1A09, {   -1,    -1,  9228,    -1,    -1}},
+    {0x1A1B01, {   -1,    -1,  4767,    -1,    -1}},
+    {0x1A1B07, {   -1,    -1,  7521,    -1,    -1}},
+    {0x1A1B09, {   -1,    -1,  9270,    -1,    -1}},
+    {0x1A1C01, { 2112,    -1,  4808,    -1,    -1}},
+    {0x1A1C07, {   -1,    -1,  7562,    -1,    -1}},
+    {0x1A1C09, {   -1,    -1,  9311,    -1,    -1}},
+    {0x1A1D01, { 2156,    -1,  4849,    -1,    -1}},
+    {0x1A1D07, {   -1,    -1,  7603,    -1,    -1}},
+    {0x1A1D09, {   -1,    -1,  9352,    -1,    -1}},
+    {0x1A1E01, {   -1,    -1,  4890,    -1,    -1}},
+    {0x1A1E07, {   -1,    -1,  7644,    -1,    -1}},
+    {0x1A1E09, {   -1,    -1,  9393,    -1,    -1}},
+    {0x1A1F01, { 2247,    -1,    -1,    -1,    -1}},
+    {0x1A2000, {  126,    -1,    -1,    -1,    -1}},
+    {0x1A2001, {   -1,    -1,  4957,    -1,    -1}},
+    {0x1A2003, { 1492,    -1,    -1,    -1,    -1}},
+    {0x1A2007, {   -1,    -1,  7715,    -1,    -1}},
+    {0x1A2009, {   -1,    -1,  9460,    -1,    -1}},
+    {0x1A2101, { 2296,    -1,  5044,    -1,    -1}},
+    {0x1A2103, { 1515,    -1,    -1,    -1,    -1}},
+    {0x1A2109, {   -1,    -1,  9547,    -1,    -1}},
+    {0x1A2203, { 1528,    -1,    -1,    -1,    -1}},
+    {0x1A2700, {  170,    -1,    -1,    -1,    -1}},
+    {0x1A2800, {  201,    -1,    -1,    -1,    -1}},
+    {0x1A2801, {   -1,    -1,  5125,    -1,    -1}},
+    {0x1A2807, {   -1,    -1,  7800,    -1,    -1}},
+    {0x1A2809, {   -1,    -1,  9628,    -1,    -1}},
+    {0x1A2900, {  233,    -1,    -1,    -1,    -1}},
+    {0x1A2901, {   -1,    -1,  5212,    -1,    -1}},
+    {0x1A2909, {   -1,    -1,  9715,    -1,    -1}},
+    {0x1A2A01, {   -1,    -1,  5240,    -1,    -1}},
+    {0x1A2A09, {   -1,    -1,  9743,    -1,    -1}},
+    {0x1A3001, {   -1,   168,  5321,    -1,    -1}},
+    {0x1A3003, {   -1,    -1,  6405,    -1,    -1}},
+    {0x1A3005, {   -1,    -1,  6718,    -1,    -1}},
+    {0x1A3007, {   -1,    -1,  7857,    -1,    -1}},
+    {0x1A3009, {   -1,    -1,  9824,    -1,    -1}},
+    {0x1A30F1, {   -1,    -1,    -1,   387,    -1}},
+    {0x1A3101, {   -1,    -1,  5402,    -1,    -1}},
+    {0x1A3105, {   -1,    -1,  6750,    -1,    -1}},
+    {0x1A3107, {   -1,    -1,  7938,    -1,    -1}},
+    {0x1A3109, {   -1,    -1,  9905,    -1,    -1}},
+    {0x1A3201, {   -1,    -1,  5477,    -1,    -1}},
+    {0x1A3205, {   -1,    -1,  6810,    -1,    -1}},
+    {0x1A3207, {   -1,    -1,  8013,    -1,    -1}},
+    {0x1A3209, {   -1,    -1,  9980,    -1,    -1}},
+    {0x1A3301, {   -1,    -1,  5564,    -1,    -1}},
+    {0x1A3309, {   -1,    -1, 10067,    -1,    -1}},
+    {0x1A3401, {   -1,    -1,  5651,    -1,    -1}},
+    {0x1A3407, {   -1,    -1,  8100,    -1,    -1}},
+    {0x1A3409, {   -1,    -1, 10154,    -1,    -1}},
+    {0x1A3501, {   -1,    -1,  5710,    -1,    -1}},
+    {0x1A3507, {   -1,    -1,  8157,    -1,    -1}},
+    {0x1A3509, {   -1,    -1, 10213,    -1,    -1}},
+    {0x1A3601, {   -1,    -1,  5771,    -1,    -1}},
+    {0x1A3609, {   -1,    -1, 10274,    -1,    -1}},
+    {0x1A3801, { 2394,   186,  5839,    -1,    -1}},
+    {0x1A3803, {   -1,    -1,  6423,    -1,    -1}},
+    {0x1A3805, {   -1,    -1,  6871,    -1,    -1}},
+    {0x1A3807, {   -1,    -1,  8233,    -1,    -1}},
+    {0x1A3809, {   -1,    -1, 10342,    -1,    -1}},
+    {0x1A38F1, {   -1,    -1,    -1,   405,    -1}},
+    {0x1A3901, { 2423,    -1,  5900,    -1,    -1}},
+    {0x1A3905, {   -1,    -1,  6926,    -1,    -1}},
+    {0x1A3907, {   -1,    -1,  8294,    -1,    -1}},
+    {0x1A3909, {   -1,    -1, 10403,    -1,    -1}},
+    {0x1A3A01, {   -1,    -1,  5953,    -1,    -1}},
+    {0x1A3A07, {   -1,    -1,  8347,    -1,    -1}},
+    {0x1A3A09, {   -1,    -1, 10456,    -1,    -1}},
+    {0x1A3B01, {   -1,    -1,  6028,    -1,    -1}},
+    {0x1A3B09, {   -1,    -1, 10531,    -1,    -1}},
+    {0x1A3C01, {   -1,    -1,  6117,    -1,    -1}},
+    {0x1A3C09, {   -1,    -1, 10620,    -1,    -1}},
+    {0x1A3D01, {   -1,    -1,  6172,    -1,    -1}},
+    {0x1A3D09, {   -1,    -1, 10675,    -1,    -1}},
+    {0x1A3E01, {   -1,    -1,  6229,    -1,    -1}},
+    {0x1A3E09, {   -1,    -1, 10732,    -1,    -1}},
+    {0x1A4000, {  317,    -1,    -1,    -1,    -1}},
+    {0x1A4001, { 2455,    -1,    -1,    -1,    -1}},
+    {0x1A4100, {  407,    -1,    -1,    -1,    -1}},
+    {0x1A4101, { 2504,    -1,    -1,    -1,    -1}},
+    {0x1A4200, {  484,    -1,    -1,    -1,    -1}},
+    {0x1A4201, { 2552,    -1,    -1,    -1,    -1}},
+    {0x1A4300, {  550,    -1,    -1,    -1,    -1}},
+    {0x1A4400, {  596,    -1,    -1,    -1,    -1}},
+    {0x1A4500, {  629,    -1,    -1,    -1,    -1}},
+    {0x1A4600, {  659,    -1,    -1,    -1,    -1}},
+    {0x1A7E00, {  957,    -1,    -1,    -1,    -1}},
+    {0x1A7E01, { 2583,    -1,    -1,    -1,    -1}},
+    {0x1A7F00, { 1085,    -1,    -1,    -1,    -1}},
+    {0x1A7F01, { 2630,    -1,    -1,    -1,    -1}},
+    {0x1A8000, {   -1,    -1,    -1,    -1,    53}},
+    {0x1A8001, { 1553,    -1,    -1,    -1,   146}},
+    {0x1A8002, {   -1,    -1,   547,    -1,    -1}},
+    {0x1A8003, {   -1,    -1,  6300,    -1,    -1}},
+    {0x1A8004, {   -1,    -1,   872,    -1,    -1}},
+    {0x1A8005, {   -1,    -1,  6551,    -1,    -1}},
+    {0x1A8006, {   -1,    -1,  1084,    -1,    -1}},
+    {0x1A8007, {   -1,    -1,  7014,    -1,    -1}},
+    {0x1A8008, {   -1,    -1,  1253,    -1,    -1}},
+    {0x1A8009, {   -1,    -1,  8440,    -1,    -1}},
+    {0x1A800A, {   -1,    -1,  1392,    -1,    -1}},
+    {0x1A800C, {   -1,    -1,  1507,    -1,    -1}},
+    {0x1A8010, {   -1,    -1,  1694,    -1,    -1}},
+    {0x1A8012, {   -1,    -1,  2087,    -1,    -1}},
+    {0x1A8014, {   -1,    -1,  2282,    -1,    -1}},
+    {0x1A8016, {   -1,    -1,  2389,    -1,    -1}},
+    {0x1A8018, {   -1,    -1,  2468,    -1,    -1}},
+    {0x1A8020, {   -1,    -1,  2641,    -1,    -1}},
+    {0x1A8022, {   -1,    -1,  2861,    -1,    -1}},
+    {0x1A8024, {   -1,    -1,  2970,    -1,    -1}},
+    {0x1A8026, {   -1,    -1,  3035,    -1,    -1}},
+    {0x1A8028, {   -1,    -1,  3085,    -1,    -1}},
+    {0x1A802A, {   -1,    -1,  3117,    -1,    -1}},
+    {0x1A802C, {   -1,    -1,  3143,    -1,    -1}},
+    {0x1A802E, {   -1,    -1,  3171,    -1,    -1}},
+    {0x1A8030, {   -1,    -1,  3216,    -1,    -1}},
+    {0x1A8040, {   -1,    -1,  3542,    -1,    -1}},
+    {0x1A8042, {   -1,    -1,  3613,    -1,    -1}},
+    {0x1A8044, {   -1,    -1,  3644,    -1,    -1}},
+    {0x1A8046, {   -1,    -1,  3661,    -1,    -1}},
+    {0x1A8048, {   -1,    -1,  3680,    -1,    -1}},
+    {0x1A804A, {   -1,    -1,  3693,    -1,    -1}},
+    {0x1A8050, {   -1,    -1,  3720,    -1,    -1}},
+    {0x1A8080, { 1281,    -1,    -1,    -1,    -1}},
+    {0x1A80F1, {   -1,    -1,    -1,   282,    -1}},
+    {0x1A80F2, {   -1,    -1,    -1,    53,    -1}},
+    {0x1A8100, {   -1,    -1,    53,    -1,    -1}},
+    {0x1A8101, {   -1,    -1,  4057,    -1,    -1}},
+    {0x1A8103, { 1354,    -1,    -1,    -1,    -1}},
+    {0x1A8107, {   -1,    -1,  7102,    -1,    -1}},
+    {0x1A8109, {   -1,    -1,  8560,    -1,    -1}},
+    {0x1A81F2, {   -1,    -1,    -1,   160,    -1}},
+    {0x1A81FC, {   -1,    -1,  3867,    -1,    -1}},
+    {0x1A81FE, {   -1,    -1,  3931,    -1,    -1}},
+    {0x1A8200, {   -1,    -1,   181,    -1,    -1}},
+    {0x1A8201, {   -1,    -1,  4158,    -1,    -1}},
+    {0x1A8207, {   -1,    -1,  7129,    -1,    -1}},
+    {0x1A8209, {   -1,    -1,  8661,    -1,    -1}},
+    {0x1A8300, {   -1,    -1,   309,    -1,    -1}},
+    {0x1A8301, { 1647,    -1,    -1,    -1,    -1}},
+    {0x1A8310, {   -1,    -1,  1898,    -1,    -1}},
+    {0x1A8400, {   -1,    -1,   437,    -1,    -1}},
+    {0x1A8401, { 1708,    -1,    -1,    -1,    -1}},
+    {0x1A8402, {   -1,    -1,   790,    -1,    -1}},
+    {0x1A8404, {   -1,    -1,  1024,    -1,    -1}},
+    {0x1A8406, {   -1,    -1,  1198,    -1,    -1}},
+    {0x1A8408, {   -1,    -1,  1344,    -1,    -1}},
+    {0x1A840A, {   -1,    -1,  1468,    -1,    -1}},
+    {0x1A840C, {   -1,    -1,  1561,    -1,    -1}},
+    {0x1A8410, {   -1,    -1,  2001,    -1,    -1}},
+    {0x1A8412, {   -1,    -1,  2226,    -1,    -1}},
+    {0x1A8414, {   -1,    -1,  2352,    -1,    -1}},
+    {0x1A8416, {   -1,    -1,  2437,    -1,    -1}},
+    {0x1A8418, {   -1,    -1,  2502,    -1,    -1}},
+    {0x1A8420, {   -1,    -1,  2810,    -1,    -1}},
+    {0x1A8422, {   -1,    -1,  2936,    -1,    -1}},
+    {0x1A8424, {   -1,    -1,  3014,    -1,    -1}},
+    {0x1A8426, {   -1,    -1,  3066,    -1,    -1}},
+    {0x1A8428, {   -1,    -1,  3104,    -1,    -1}},
+    {0x1A842A, {   -1,    -1,  3131,    -1,    -1}},
+    {0x1A842C, {   -1,    -1,  3158,    -1,    -1}},
+    {0x1A842E, {   -1,    -1,  3185,    -1,    -1}},
+    {0x1A8430, {   -1,    -1,  3306,    -1,    -1}},
+    {0x1A8440, {   -1,    -1,  3591,    -1,    -1}},
+    {0x1A8442, {   -1,    -1,  3635,    -1,    -1}},
+    {0x1A8444, {   -1,    -1,  3653,    -1,    -1}},
+    {0x1A8446, {   -1,    -1,  3672,    -1,    -1}},
+    {0x1A8448, {   -1,    -1,  3687,    -1,    -1}},
+    {0x1A844A, {   -1,    -1,  3698,    -1,    -1}},
+    {0x1A8450, {   -1,    -1,  3738,    -1,    -1}},
+    {0x1A8501, { 1758,    -1,    -1,    -1,    -1}},
+    {0x1A8601, { 1804,    -1,    -1,    -1,    -1}},
+    {0x1A8701, { 1850,    -1,    -1,    -1,    -1}},
+    {0x1A8801, {   -1,    -1,  4241,    -1,    -1}},
+    {0x1A8807, {   -1,    -1,  7156,    -1,    -1}},
+    {0x1A8809, {   -1,    -1,  8744,    -1,    -1}},
+    {0x1A8901, {   -1,    -1,  4297,    -1,    -1}},
+    {0x1A8907, {   -1,    -1,  7212,    -1,    -1}},
+    {0x1A8909, {   -1,    -1,  8800,    -1,    -1}},
+    {0x1A8A01, {   -1,    -1,  4395,    -1,    -1}},
+    {0x1A8A07, {   -1,    -1,  7300,    -1,    -1}},
+    {0x1A8A09, {   -1,    -1,  8898,    -1,    -1}},
+    {0x1A8B01, {   -1,    -1,  4438,    -1,    -1}},
+    {0x1A8B07, {   -1,    -1,  7334,    -1,    -1}},
+    {0x1A8B09, {   -1,    -1,  8941,    -1,    -1}},
+    {0x1A8C01, {   -1,    -1,  4486,    -1,    -1}},
+    {0x1A8C09, {   -1,    -1,  8989,    -1,    -1}},
+    {0x1A8D01, {   -1,    -1,  4538,    -1,    -1}},
+    {0x1A8D09, {   -1,    -1,  9041,    -1,    -1}},
+    {0x1A9001, {   -1,    -1,  4586,    -1,    -1}},
+    {0x1A9003, { 1391,    -1,    -1,    -1,    -1}},
+    {0x1A9007, {   -1,    -1,  7374,    -1,    -1}},
+    {0x1A9009, {   -1,    -1,  9089,    -1,    -1}},
+    {0x1A9103, { 1415,    -1,    -1,    -1,    -1}},
+    {0x1A9203, { 1454,    -1,    -1,    -1,    -1}},
+    {0x1A9807, {   -1,    -1,  7400,    -1,    -1}},
+    {0x1A9901, {   -1,    -1,  4683,    -1,    -1}},
+    {0x1A9907, {   -1,    -1,  7440,    -1,    -1}},
+    {0x1A9909, {   -1,    -1,  9186,    -1,    -1}},
+    {0x1A9A01, {   -1,    -1,  4726,    -1,    -1}},
+    {0x1A9A07, {   -1,    -1,  7481,    -1,    -1}},
+    {0x1A9A09, {   -1,    -1,  9229,    -1,    -1}},
+    {0x1A9B01, {   -1,    -1,  4768,    -1,    -1}},
+    {0x1A9B07, {   -1,    -1,  7522,    -1,    -1}},
+    {0x1A9B09, {   -1,    -1,  9271,    -1,    -1}},
+    {0x1A9C01, {   -1,    -1,  4809,    -1,    -1}},
+    {0x1A9C07, {   -1,    -1,  7563,    -1,    -1}},
+    {0x1A9C09, {   -1,    -1,  9312,    -1,    -1}},
+    {0x1A9D01, {   -1,    -1,  4850,    -1,    -1}},
+    {0x1A9D07, {   -1,    -1,  7604,    -1,    -1}},
+    {0x1A9D09, {   -1,    -1,  9353,    -1,    -1}},
+    {0x1A9E01, { 2200,    -1,  4891,    -1,    -1}},
+    {0x1A9E07, {   -1,    -1,  7645,    -1,    -1}},
+    {0x1A9E09, {   -1,    -1,  9394,    -1,    -1}},
+    {0x1A9F01, { 2248,    -1,    -1,    -1,    -1}},
+    {0x1AA001, {   -1,    -1,  4958,    -1,    -1}},
+    {0x1AA003, { 1493,    -1,    -1,    -1,    -1}},
+    {0x1AA007, {   -1,    -1,  7716,    -1,    -1}},
+    {0x1AA009, {   -1,    -1,  9461,    -1,    -1}},
+    {0x1AA101, { 2297,    -1,  5045,    -1,    -1}},
+    {0x1AA103, { 1516,    -1,    -1,    -1,    -1}},
+    {0x1AA109, {   -1,    -1,  9548,    -1,    -1}},
+    {0x1AA203, { 1529,    -1,    -1,    -1,    -1}},
+    {0x1AA801, {   -1,    -1,  5126,    -1,    -1}},
+    {0x1AA805, {   -1,    -1,  6697,    -1,    -1}},
+    {0x1AA807, {   -1,    -1,  7801,    -1,    -1}},
+    {0x1AA809, {   -1,    -1,  9629,    -1,    -1}},
+    {0x1AA901, { 2346,    -1,  5213,    -1,    -1}},
+    {0x1AA909, {   -1,    -1,  9716,    -1,    -1}},
+    {0x1AAA01, {   -1,    -1,  5241,    -1,    -1}},
+    {0x1AAA09, {   -1,    -1,  9744,    -1,    -1}},
+    {0x1AB001, {   -1,   169,  5322,    -1,    -1}},
+    {0x1AB003, {   -1,    -1,  6406,    -1,    -1}},
+    {0x1AB005, {   -1,    -1,  6719,    -1,    -1}},
+    {0x1AB007, {   -1,    -1,  7858,    -1,    -1}},
+    {0x1AB009, {   -1,    -1,  9825,    -1,    -1}},
+    {0x1AB0F1, {   -1,    -1,    -1,   388,    -1}},
+    {0x1AB101, {   -1,    -1,  5403,    -1,    -1}},
+    {0x1AB105, {   -1,    -1,  6751,    -1,    -1}},
+    {0x1AB107, {   -1,    -1,  7939,    -1,    -1}},
+    {0x1AB109, {   -1,    -1,  9906,    -1,    -1}},
+    {0x1AB201, {   -1,    -1,  5478,    -1,    -1}},
+    {0x1AB205, {   -1,    -1,  6811,    -1,    -1}},
+    {0x1AB207, {   -1,    -1,  8014,    -1,    -1}},
+    {0x1AB209, {   -1,    -1,  9981,    -1,    -1}},
+    {0x1AB301, {   -1,    -1,  5565,    -1,    -1}},
+    {0x1AB309, {   -1,    -1, 10068,    -1,    -1}},
+    {0x1AB401, {   -1,    -1,  5652,    -1,    -1}},
+    {0x1AB407, {   -1,    -1,  8101,    -1,    -1}},
+    {0x1AB409, {   -1,    -1, 10155,    -1,    -1}},
+    {0x1AB501, {   -1,    -1,  5711,    -1,    -1}},
+    {0x1AB507, {   -1,    -1,  8158,    -1,    -1}},
+    {0x1AB509, {   -1,    -1, 10214,    -1,    -1}},
+    {0x1AB601, {   -1,    -1,  5772,    -1,    -1}},
+    {0x1AB609, {   -1,    -1, 10275,    -1,    -1}},
+    {0x1AB801, { 2395,   187,  5840,    -1,    -1}},
+    {0x1AB803, {   -1,    -1,  6424,    -1,    -1}},
+    {0x1AB805, {   -1,    -1,  6872,    -1,    -1}},
+    {0x1AB807, {   -1,    -1,  8234,    -1,    -1}},
+    {0x1AB809, {   -1,    -1, 10343,    -1,    -1}},
+    {0x1AB8F1, {   -1,    -1,    -1,   406,    -1}},
+    {0x1AB901, { 2424,    -1,  5901,    -1,    -1}},
+    {0x1AB905, {   -1,    -1,  6927,    -1,    -1}},
+    {0x1AB907, {   -1,    -1,  8295,    -1,    -1}},
+    {0x1AB909, {   -1,    -1, 10404,    -1,    -1}},
+    {0x1ABA01, {   -1,    -1,  5954,    -1,    -1}},
+    {0x1ABA07, {   -1,    -1,  8348,    -1,    -1}},
+    {0x1ABA09, {   -1,    -1, 10457,    -1,    -1}},
+    {0x1ABB01, {   -1,    -1,  6029,    -1,    -1}},
+    {0x1ABB09, {   -1,    -1, 10532,    -1,    -1}},
+    {0x1ABC01, {   -1,    -1,  6118,    -1,    -1}},
+    {0x1ABC09, {   -1,    -1, 10621,    -1,    -1}},
+    {0x1ABD01, {   -1,    -1,  6173,    -1,    -1}},
+    {0x1ABD09, {   -1,    -1, 10676,    -1,    -1}},
+    {0x1ABE01, {   -1,    -1,  6230,    -1,    -1}},
+    {0x1ABE09, {   -1,    -1, 10733,    -1,    -1}},
+    {0x1AC000, {  318,    -1,    -1,    -1,    -1}},
+    {0x1AC001, { 2456,    -1,    -1,    -1,    -1}},
+    {0x1AC100, {  408,    -1,    -1,    -1,    -1}},
+    {0x1AC101, { 2505,    -1,    -1,    -1,    -1}},
+    {0x1AC200, {  485,    -1,    -1,    -1,    -1}},
+    {0x1AC201, { 2553,    -1,    -1,    -1,    -1}},
+    {0x1AC300, {  551,    -1,    -1,    -1,    -1}},
+    {0x1AE000, {  850,    -1,    -1,    -1,    -1}},
+    {0x1AFE00, {  958,    -1,    -1,    -1,    -1}},
+    {0x1AFE01, { 2584,    -1,    -1,    -1,    -1}},
+    {0x1AFF00, { 1086,    -1,    -1,    -1,    -1}},
+    {0x1AFF01, { 2631,    -1,    -1,    -1,    -1}},
+    {0x1B0000, {   -1,    -1,    -1,    -1,    54}},
+    {0x1B0001, {   -1,    -1,    -1,    -1,   147}},
+    {0x1B0002, {   -1,    -1,   548,    -1,    -1}},
+    {0x1B0003, {   -1,    -1,  6301,    -1,    -1}},
+    {0x1B0004, {   -1,    -1,   873,    -1,    -1}},
+    {0x1B0005, {   -1,    -1,  6552,    -1,    -1}},
+    {0x1B0007, {   -1,    -1,  7015,    -1,    -1}},
+    {0x1B0009, {   -1,    -1,  8441,    -1,    -1}},
+    {0x1B0010, {   -1,    -1,  1695,    -1,    -1}},
+    {0x1B0012, {   -1,    -1,  2088,    -1,    -1}},
+    {0x1B0014, {   -1,    -1,  2283,    -1,    -1}},
+    {0x1B0020, {   -1,    -1,  2642,    -1,    -1}},
+    {0x1B0022, {   -1,    -1,  2862,    -1,    -1}},
+    {0x1B0024, {   -1,    -1,  2971,    -1,    -1}},
+    {0x1B0026, {   -1,    -1,  3036,    -1,    -1}},
+    {0x1B0080, { 1282,    -1,    -1,    -1,    -1}},
+    {0x1B00F1, {   -1,    -1,    -1,   283,    -1}},
+    {0x1B00F2, {   -1,    -1,    -1,    54,    -1}},
+    {0x1B0100, {   -1,    -1,    54,    -1,    -1}},
+    {0x1B0101, {   -1,    -1,  4058,    -1,    -1}},
+    {0x1B0103, { 1355,    -1,    -1,    -1,    -1}},
+    {0x1B0107, {   -1,    -1,  7103,    -1,    -1}},
+    {0x1B0109, {   -1,    -1,  8561,    -1,    -1}},
+    {0x1B01F2, {   -1,    -1,    -1,   161,    -1}},
+    {0x1B01FC, {   -1,    -1,  3868,    -1,    -1}},
+    {0x1B01FE, {   -1,    -1,  3932,    -1,    -1}},
+    {0x1B0200, {   -1,    -1,   182,    -1,    -1}},
+    {0x1B0201, {   -1,    -1,  4159,    -1,    -1}},
+    {0x1B0207, {   -1,    -1,  7130,    -1,    -1}},
+    {0x1B0209, {   -1,    -1,  8662,    -1,    -1}},
+    {0x1B0210, {   -1,    -1,  1825,    -1,    -1}},
+    {0x1B0300, {   -1,    -1,   310,    -1,    -1}},
+    {0x1B0301, { 1648,    -1,    -1,    -1,    -1}},
+    {0x1B0310, {   -1,    -1,  1899,    -1,    -1}},
+    {0x1B0312, {   -1,    -1,  2170,    -1,    -1}},
+    {0x1B0320, {   -1,    -1,  2748,    -1,    -1}},
+    {0x1B0322, {   -1,    -1,  2905,    -1,    -1}},
+    {0x1B0400, {   -1,    -1,   438,    -1,    -1}},
+    {0x1B0401, { 1709,    -1,    -1,    -1,    -1}},
+    {0x1B0402, {   -1,    -1,   791,    -1,    -1}},
+    {0x1B0404, {   -1,    -1,  1025,    -1,    -1}},
+    {0x1B0410, {   -1,    -1,  2002,    -1,    -1}},
+    {0x1B0412, {   -1,    -1,  2227,    -1,    -1}},
+    {0x1B0414, {   -1,    -1,  2353,    -1,    -1}},
+    {0x1B0420, {   -1,    -1,  2811,    -1,    -1}},
+    {0x1B0422, {   -1,    -1,  2937,    -1,    -1}},
+    {0x1B0424, {   -1,    -1,  3015,    -1,    -1}},
+    {0x1B0426, {   -1,    -1,  3067,    -1,    -1}},
+    {0x1B0701, { 1851,    -1,    -1,    -1,    -1}},
+    {0x1B0807, {   -1,    -1,  7157,    -1,    -1}},
+    {0x1B0901, {   -1,    -1,  4298,    -1,    -1}},
+    {0x1B0907, {   -1,    -1,  7213,    -1,    -1}},
+    {0x1B0909, {   -1,    -1,  8801,    -1,    -1}},
+    {0x1B0A01, {   -1,    -1,  4396,    -1,    -1}},
+    {0x1B0A07, {   -1,    -1,  7301,    -1,    -1}},
+    {0x1B0A09, {   -1,    -1,  8899,    -1,    -1}},
+    {0x1B0B01, {   -1,    -1,  4439,    -1,    -1}},
+    {0x1B0B07, {   -1,    -1,  7335,    -1,    -1}},
+    {0x1B0B09, {   -1,    -1,  8942,    -1,    -1}},
+    {0x1B0C01, {   -1,    -1,  4487,    -1,    -1}},
+    {0x1B0C09, {   -1,    -1,  8990,    -1,    -1}},
+    {0x1B0D01, {   -1,    -1,  4539,    -1,    -1}},
+    {0x1B0D09, {   -1,    -1,  9042,    -1,    -1}},
+    {0x1B1001, {   -1,    -1,  4587,    -1,    -1}},
+    {0x1B1003, { 1392,    -1,    -1,    -1,    -1}},
+    {0x1B1007, {   -1,    -1,  7375,    -1,    -1}},
+    {0x1B1009, {   -1,    -1,  9090,    -1,    -1}},
+    {0x1B1103, { 1416,    -1,    -1,    -1,    -1}},
+    {0x1B1203, { 1455,    -1,    -1,    -1,    -1}},
+    {0x1B1807, {   -1,    -1,  7401,    -1,    -1}},
+    {0x1B1901, {   -1,    -1,  4684,    -1,    -1}},
+    {0x1B1907, {   -1,    -1,  7441,    -1,    -1}},
+    {0x1B1909, {   -1,    -1,  9187,    -1,    -1}},
+    {0x1B1A01, {   -1,    -1,  4727,    -1,    -1}},
+    {0x1B1A07, {   -1,    -1,  7482,    -1,    -1}},
+    {0x1B1A09, {   -1,    -1,  9230,    -1,    -1}},
+    {0x1B1B01, {   -1,    -1,  4769,    -1,    -1}},
+    {0x1B1B07, {   -1,    -1,  7523,    -1,    -1}},
+    {0x1B1B09, {   -1,    -1,  9272,    -1,    -1}},
+    {0x1B1C01, {   -1,    -1,  4810,    -1,    -1}},
+    {0x1B1C07, {   -1,    -1,  7564,    -1,    -1}},
+    {0x1B1C09, {   -1,    -1,  9313,    -1,    -1}},
+    {0x1B1D01, {   -1,    -1,  4851,    -1,    -1}},
+    {0x1B1D07, {   -1,    -1,  7605,    -1,    -1}},
+    {0x1B1D09, {   -1,    -1,  9354,    -1,    -1}},
+    {0x1B1E01, {   -1,    -1,  4892,    -1,    -1}},
+    {0x1B1E07, {   -1,    -1,  7646,    -1,    -1}},
+    {0x1B1E09, {   -1,    -1,  9395,    -1,    -1}},
+    {0x1B1F01, { 2249,    -1,    -1,    -1,    -1}},
+    {0x1B2001, {   -1,    -1,  4959,    -1,    -1}},
+    {0x1B2003, { 1494,    -1,    -1,    -1,    -1}},
+    {0x1B2007, {   -1,    -1,  7717,    -1,    -1}},
+    {0x1B2009, {   -1,    -1,  9462,    -1,    -1}},
+    {0x1B2101, {   -1,    -1,  5046,    -1,    -1}},
+    {0x1B2103, { 1517,    -1,    -1,    -1,    -1}},
+    {0x1B2109, {   -1,    -1,  9549,    -1,    -1}},
+    {0x1B2203, { 1530,    -1,    -1,    -1,    -1}},
+    {0x1B2800, {  202,    -1,    -1,    -1,    -1}},
+    {0x1B2801, {   -1,    -1,  5127,    -1,    -1}},
+    {0x1B2807, {   -1,    -1,  7802,    -1,    -1}},
+    {0x1B2809, {   -1,    -1,  9630,    -1,    -1}},
+    {0x1B2900, {  234,    -1,    -1,    -1,    -1}},
+    {0x1B2901, {   -1,    -1,  5214,    -1,    -1}},
+    {0x1B2909, {   -1,    -1,  9717,    -1,    -1}},
+    {0x1B2A01, {   -1,    -1,  5242,    -1,    -1}},
+    {0x1B2A09, {   -1,    -1,  9745,    -1,    -1}},
+    {0x1B3001, {   -1,    -1,  5323,    -1,    -1}},
+    {0x1B3007, {   -1,    -1,  7859,    -1,    -1}},
+    {0x1B3009, {   -1,    -1,  9826,    -1,    -1}},
+    {0x1B3101, {   -1,    -1,  5404,    -1,    -1}},
+    {0x1B3105, {   -1,    -1,  6752,    -1,    -1}},
+    {0x1B3107, {   -1,    -1,  7940,    -1,    -1}},
+    {0x1B3109, {   -1,    -1,  9907,    -1,    -1}},
+    {0x1B3201, {   -1,    -1,  5479,    -1,    -1}},
+    {0x1B3205, {   -1,    -1,  6812,    -1,    -1}},
+    {0x1B3207, {   -1,    -1,  8015,    -1,    -1}},
+    {0x1B3209, {   -1,    -1,  9982,    -1,    -1}},
+    {0x1B3301, {   -1,    -1,  5566,    -1,    -1}},
+    {0x1B3309, {   -1,    -1, 10069,    -1,    -1}},
+    {0x1B3401, {   -1,    -1,  5653,    -1,    -1}},
+    {0x1B3407, {   -1,    -1,  8102,    -1,    -1}},
+    {0x1B3409, {   -1,    -1, 10156,    -1,    -1}},
+    {0x1B3501, {   -1,    -1,  5712,    -1,    -1}},
+    {0x1B3507, {   -1,    -1,  8159,    -1,    -1}},
+    {0x1B3509, {   -1,    -1, 10215,    -1,    -1}},
+    {0x1B3601, {   -1,    -1,  5773,    -1,    -1}},
+    {0x1B3609, {   -1,    -1, 10276,    -1,    -1}},
+    {0x1B3801, {   -1,   188,  5841,    -1,    -1}},
+    {0x1B3803, {   -1,    -1,  6425,    -1,    -1}},
+    {0x1B3805, {   -1,    -1,  6873,    -1,    -1}},
+    {0x1B3807, {   -1,    -1,  8235,    -1,    -1}},
+    {0x1B3809, {   -1,    -1, 10344,    -1,    -1}},
+    {0x1B38F1, {   -1,    -1,    -1,   407,    -1}},
+    {0x1B3901, {   -1,    -1,  5902,    -1,    -1}},
+    {0x1B3905, {   -1,    -1,  6928,    -1,    -1}},
+    {0x1B3907, {   -1,    -1,  8296,    -1,    -1}},
+    {0x1B3909, {   -1,    -1, 10405,    -1,    -1}},
+    {0x1B3A01, {   -1,    -1,  5955,    -1,    -1}},
+    {0x1B3A07, {   -1,    -1,  8349,    -1,    -1}},
+    {0x1B3A09, {   -1,    -1, 10458,    -1,    -1}},
+    {0x1B3B01, {   -1,    -1,  6030,    -1,    -1}},
+    {0x1B3B09, {   -1,    -1, 10533,    -1,    -1}},
+    {0x1B3C01, {   -1,    -1,  6119,    -1,    -1}},
+    {0x1B3C09, {   -1,    -1, 10622,    -1,    -1}},
+    {0x1B3D01, {   -1,    -1,  6174,    -1,    -1}},
+    {0x1B3D09, {   -1,    -1, 10677,    -1,    -1}},
+    {0x1B3E01, {   -1,    -1,  6231,    -1,    -1}},
+    {0x1B3E09, {   -1,    -1, 10734,    -1,    -1}},
+    {0x1B4000, {  319,    -1,    -1,    -1,    -1}},
+    {0x1B4001, { 2457,    -1,    -1,    -1,    -1}},
+    {0x1B4100, {  409,    -1,    -1,    -1,    -1}},
+    {0x1B4101, { 2506,    -1,    -1,    -1,    -1}},
+    {0x1B4200, {  486,    -1,    -1,    -1,    -1}},
+    {0x1B4201, { 2554,    -1,    -1,    -1,    -1}},
+    {0x1B4300, {  552,    -1,    -1,    -1,    -1}},
+    {0x1B7E00, {  959,    -1,    -1,    -1,    -1}},
+    {0x1B7F00, { 1087,    -1,    -1,    -1,    -1}},
+    {0x1B7F01, { 2632,    -1,    -1,    -1,    -1}},
+    {0x1B7F03, {   -1,    -1,  6473,    -1,    -1}},
+    {0x1B8000, {   -1,    -1,    -1,    -1,    55}},
+    {0x1B8001, {   -1,    -1,    -1,    -1,   148}},
+    {0x1B8002, {   -1,    -1,   549,    -1,    -1}},
+    {0x1B8003, {   -1,    -1,  6302,    -1,    -1}},
+    {0x1B8004, {   -1,    -1,   874,    -1,    -1}},
+    {0x1B8005, {   -1,    -1,  6553,    -1,    -1}},
+    {0x1B8006, {   -1,    -1,  1085,    -1,    -1}},
+    {0x1B8007, {   -1,    -1,  7016,    -1,    -1}},
+    {0x1B8009, {   -1,    -1,  8442,    -1,    -1}},
+    {0x1B8010, {   -1,    -1,  1696,    -1,    -1}},
+    {0x1B8012, {   -1,    -1,  2089,    -1,    -1}},
+    {0x1B8014, {   -1,    -1,  2284,    -1,    -1}},
+    {0x1B8016, {   -1,    -1,  2390,    -1,    -1}},
+    {0x1B8018, {   -1,    -1,  2469,    -1,    -1}},
+    {0x1B801A, {   -1,    -1,  2525,    -1,    -1}},
+    {0x1B801C, {   -1,    -1,  2562,    -1,    -1}},
+    {0x1B801E, {   -1,    -1,  2589,    -1,    -1}},
+    {0x1B8020, {   -1,    -1,  2643,    -1,    -1}},
+    {0x1B8022, {   -1,    -1,  2863,    -1,    -1}},
+    {0x1B8024, {   -1,    -1,  2972,    -1,    -1}},
+    {0x1B8026, {   -1,    -1,  3037,    -1,    -1}},
+    {0x1B8028, {   -1,    -1,  3086,    -1,    -1}},
+    {0x1B802A, {   -1,    -1,  3118,    -1,    -1}},
+    {0x1B802C, {   -1,    -1,  3144,    -1,    -1}},
+    {0x1B802E, {   -1,    -1,  3172,    -1,    -1}},
+    {0x1B8030, {   -1,    -1,  3217,    -1,    -1}},
+    {0x1B8032, {   -1,    -1,  3337,    -1,    -1}},
+    {0x1B8034, {   -1,    -1,  3396,    -1,    -1}},
+    {0x1B8036, {   -1,    -1,  3437,    -1,    -1}},
+    {0x1B8080, { 1283,    -1,    -1,    -1,    -1}},
+    {0x1B80F1, {   -1,    -1,    -1,   284,    -1}},
+    {0x1B80F2, {   -1,    -1,    -1,    55,    -1}},
+    {0x1B8100, {   -1,    -1,    55,    -1,    -1}},
+    {0x1B8101, {   -1,    -1,  4059,    -1,    -1}},
+    {0x1B8103, { 1356,    -1,    -1,    -1,    -1}},
+    {0x1B8107, {   -1,    -1,  7104,    -1,    -1}},
+    {0x1B8109, {   -1,    -1,  8562,    -1,    -1}},
+    {0x1B81F2, {   -1,    -1,    -1,   162,    -1}},
+    {0x1B81FC, {   -1,    -1,  3869,    -1,    -1}},
+    {0x1B81FE, {   -1,    -1,  3933,    -1,    -1}},
+    {0x1B8200, {   -1,    -1,   183,    -1,    -1}},
+    {0x1B8201, { 1591,    -1,  4160,    -1,    -1}},
+    {0x1B8207, {   -1,    -1,  7131,    -1,    -1}},
+    {0x1B8209, {   -1,    -1,  8663,    -1,    -1}},
+    {0x1B8210, {   -1,    -1,  1826,    -1,    -1}},
+    {0x1B8212, {   -1,    -1,  2142,    -1,    -1}},
+    {0x1B8214, {   -1,    -1,  2314,    -1,    -1}},
+    {0x1B8220, {   -1,    -1,  2706,    -1,    -1}},
+    {0x1B82F2, {   -1,    -1,    -1,   208,    -1}},
+    {0x1B8300, {   -1,    -1,   311,    -1,    -1}},
+    {0x1B8301, { 1649,    -1,    -1,    -1,    -1}},
+    {0x1B8310, {   -1,    -1,  1900,    -1,    -1}},
+    {0x1B8312, {   -1,    -1,  2171,    -1,    -1}},
+    {0x1B8314, {   -1,    -1,  2323,    -1,    -1}},
+    {0x1B8316, {   -1,    -1,  2417,    -1,    -1}},
+    {0x1B8318, {   -1,    -1,  2489,    -1,    -1}},
+    {0x1B8320, {   -1,    -1,  2749,    -1,    -1}},
+    {0x1B8322, {   -1,    -1,  2906,    -1,    -1}},
+    {0x1B8324, {   -1,    -1,  2997,    -1,    -1}},
+    {0x1B8326, {   -1,    -1,  3055,    -1,    -1}},
+    {0x1B8328, {   -1,    -1,  3096,    -1,    -1}},
+    {0x1B832A, {   -1,    -1,  3127,    -1,    -1}},
+    {0x1B832C, {   -1,    -1,  3154,    -1,    -1}},
+    {0x1B832E, {   -1,    -1,  3181,    -1,    -1}},
+    {0x1B8330, {   -1,    -1,  3272,    -1,    -1}},
+    {0x1B8332, {   -1,    -1,  3361,    -1,    -1}},
+    {0x1B83F2, {   -1,    -1,    -1,   232,    -1}},
+    {0x1B8400, {   -1,    -1,   439,    -1,    -1}},
+    {0x1B8401, { 1710,    -1,    -1,    -1,    -1}},
+    {0x1B8402, {   -1,    -1,   792,    -1,    -1}},
+    {0x1B8404, {   -1,    -1,  1026,    -1,    -1}},
+    {0x1B8406, {   -1,    -1,  1199,    -1,    -1}},
+    {0x1B8410, {   -1,    -1,  2003,    -1,    -1}},
+    {0x1B8412, {   -1,    -1,  2228,    -1,    -1}},
+    {0x1B8414, {   -1,    -1,  2354,    -1,    -1}},
+    {0x1B8416, {   -1,    -1,  2438,    -1,    -1}},
+    {0x1B8418, {   -1,    -1,  2503,    -1,    -1}},
+    {0x1B841A, {   -1,    -1,  2546,    -1,    -1}},
+    {0x1B841C, {   -1,    -1,  2577,    -1,    -1}},
+    {0x1B841E, {   -1,    -1,  2602,    -1,    -1}},
+    {0x1B8420, {   -1,    -1,  2812,    -1,    -1}},
+    {0x1B8422, {   -1,    -1,  2938,    -1,    -1}},
+    {0x1B8424, {   -1,    -1,  3016,    -1,    -1}},
+    {0x1B8426, {   -1,    -1,  3068,    -1,    -1}},
+    {0x1B8428, {   -1,    -1,  3105,    -1,    -1}},
+    {0x1B842A, {   -1,    -1,  3132,    -1,    -1}},
+    {0x1B842C, {   -1,    -1,  3159,    -1,    -1}},
+    {0x1B842E, {   -1,    -1,  3186,    -1,    -1}},
+    {0x1B8430, {   -1,    -1,  3307,    -1,    -1}},
+    {0x1B8432, {   -1,    -1,  3376,    -1,    -1}},
+    {0x1B8434, {   -1,    -1,  3421,    -1,    -1}},
+    {0x1B8436, {   -1,    -1,  3453,    -1,    -1}},
+    {0x1B8501, { 1759,    -1,    -1,    -1,    -1}},
+    {0x1B8601, { 1805,    -1,    -1,    -1,    -1}},
+    {0x1B8701, { 1852,    -1,    -1,    -1,    -1}},
+    {0x1B8807, {   -1,    -1,  7158,    -1,    -1}},
+    {0x1B8901, { 1900,    -1,  4299,    -1,    -1}},
+    {0x1B8907, {   -1,    -1,  7214,    -1,    -1}},
+    {0x1B8909, {   -1,    -1,  8802,    -1,    -1}},
+    {0x1B8A01, {   -1,    -1,  4397,    -1,    -1}},
+    {0x1B8A07, {   -1,    -1,  7302,    -1,    -1}},
+    {0x1B8A09, {   -1,    -1,  8900,    -1,    -1}},
+    {0x1B8B01, {   -1,    -1,  4440,    -1,    -1}},
+    {0x1B8B07, {   -1,    -1,  7336,    -1,    -1}},
+    {0x1B8B09, {   -1,    -1,  8943,    -1,    -1}},
+    {0x1B8C00, {   34,    -1,    -1,    -1,    -1}},
+    {0x1B8C01, {   -1,    -1,  4488,    -1,    -1}},
+    {0x1B8C09, {   -1,    -1,  8991,    -1,    -1}},
+    {0x1B8D01, {   -1,    -1,  4540,    -1,    -1}},
+    {0x1B8D09, {   -1,    -1,  9043,    -1,    -1}},
+    {0x1B9001, {   -1,    -1,  4588,    -1,    -1}},
+    {0x1B9003, { 1393,    -1,    -1,    -1,    -1}},
+    {0x1B9007, {   -1,    -1,  7376,    -1,    -1}},
+    {0x1B9009, {   -1,    -1,  9091,    -1,    -1}},
+    {0x1B9101, { 1952,    -1,    -1,    -1,    -1}},
+    {0x1B9103, { 1417,    -1,    -1,    -1,    -1}},
+    {0x1B9203, { 1456,    -1,    -1,    -1,    -1}},
+    {0x1B9807, {   -1,    -1,  7402,    -1,    -1}},
+    {0x1B9901, {   -1,    -1,  4685,    -1,    -1}},
+    {0x1B9907, {   -1,    -1,  7442,    -1,    -1}},
+    {0x1B9909, {   -1,    -1,  9188,    -1,    -1}},
+    {0x1B9A01, { 2039,    -1,  4728,    -1,    -1}},
+    {0x1B9A07, {   -1,    -1,  7483,    -1,    -1}},
+    {0x1B9A09, {   -1,    -1,  9231,    -1,    -1}},
+    {0x1B9B01, {   -1,    -1,  4770,    -1,    -1}},
+    {0x1B9B07, {   -1,    -1,  7524,    -1,    -1}},
+    {0x1B9B09, {   -1,    -1,  9273,    -1,    -1}},
+    {0x1B9C01, { 2113,    -1,  4811,    -1,    -1}},
+    {0x1B9C07, {   -1,    -1,  7565,    -1,    -1}},
+    {0x1B9C09, {   -1,    -1,  9314,    -1,    -1}},
+    {0x1B9D01, { 2157,    -1,  4852,    -1,    -1}},
+    {0x1B9D07, {   -1,    -1,  7606,    -1,    -1}},
+    {0x1B9D09, {   -1,    -1,  9355,    -1,    -1}},
+    {0x1B9E01, { 2201,    -1,  4893,    -1,    -1}},
+    {0x1B9E07, {   -1,    -1,  7647,    -1,    -1}},
+    {0x1B9E09, {   -1,    -1,  9396,    -1,    -1}},
+    {0x1B9F01, { 2250,    -1,    -1,    -1,    -1}},
+    {0x1BA001, {   -1,    -1,  4960,    -1,    -1}},
+    {0x1BA003, { 1495,    -1,    -1,    -1,    -1}},
+    {0x1BA007, {   -1,    -1,  7718,    -1,    -1}},
+    {0x1BA009, {   -1,    -1,  9463,    -1,    -1}},
+    {0x1BA101, { 2298,    -1,  5047,    -1,    -1}},
+    {0x1BA103, { 1518,    -1,    -1,    -1,    -1}},
+    {0x1BA109, {   -1,    -1,  9550,    -1,    -1}},
+    {0x1BA203, { 1531,    -1,    -1,    -1,    -1}},
+    {0x1BA300, {  151,    -1,    -1,    -1,    -1}},
+    {0x1BA800, {  203,    -1,    -1,    -1,    -1}},
+    {0x1BA801, {   -1,    -1,  5128,    -1,    -1}},
+    {0x1BA807, {   -1,    -1,  7803,    -1,    -1}},
+    {0x1BA809, {   -1,    -1,  9631,    -1,    -1}},
+    {0x1BA901, { 2347,    -1,  5215,    -1,    -1}},
+    {0x1BA909, {   -1,    -1,  9718,    -1,    -1}},
+    {0x1BAA01, {   -1,    -1,  5243,    -1,    -1}},
+    {0x1BAA09, {   -1,    -1,  9746,    -1,    -1}},
+    {0x1BB001, {   -1,    -1,  5324,    -1,    -1}},
+    {0x1BB007, {   -1,    -1,  7860,    -1,    -1}},
+    {0x1BB009, {   -1,    -1,  9827,    -1,    -1}},
+    {0x1BB101, {   -1,    -1,  5405,    -1,    -1}},
+    {0x1BB105, {   -1,    -1,  6753,    -1,    -1}},
+    {0x1BB107, {   -1,    -1,  7941,    -1,    -1}},
+    {0x1BB109, {   -1,    -1,  9908,    -1,    -1}},
+    {0x1BB201, {   -1,    -1,  5480,    -1,    -1}},
+    {0x1BB205, {   -1,    -1,  6813,    -1,    -1}},
+    {0x1BB207, {   -1,    -1,  8016,    -1,    -1}},
+    {0x1BB209, {   -1,    -1,  9983,    -1,    -1}},
+    {0x1BB301, {   -1,    -1,  5567,    -1,    -1}},
+    {0x1BB309, {   -1,    -1, 10070,    -1,    -1}},
+    {0x1BB401, {   -1,    -1,  5654,    -1,    -1}},
+    {0x1BB407, {   -1,    -1,  8103,    -1,    -1}},
+    {0x1BB409, {   -1,    -1, 10157,    -1,    -1}},
+    {0x1BB501, {   -1,    -1,  5713,    -1,    -1}},
+    {0x1BB507, {   -1,    -1,  8160,    -1,    -1}},
+    {0x1BB509, {   -1,    -1, 10216,    -1,    -1}},
+    {0x1BB601, {   -1,    -1,  5774,    -1,    -1}},
+    {0x1BB609, {   -1,    -1, 10277,    -1,    -1}},
+    {0x1BB801, { 2396,   189,  5842,    -1,    -1}},
+    {0x1BB803, {   -1,    -1,  6426,    -1,    -1}},
+    {0x1BB805, {   -1,    -1,  6874,    -1,    -1}},
+    {0x1BB807, {   -1,    -1,  8236,    -1,    -1}},
+    {0x1BB809, {   -1,    -1, 10345,    -1,    -1}},
+    {0x1BB8F1, {   -1,    -1,    -1,   408,    -1}},
+    {0x1BB901, { 2425,    -1,  5903,    -1,    -1}},
+    {0x1BB905, {   -1,    -1,  6929,    -1,    -1}},
+    {0x1BB907, {   -1,    -1,  8297,    -1,    -1}},
+    {0x1BB909, {   -1,    -1, 10406,    -1,    -1}},
+    {0x1BBA01, {   -1,    -1,  5956,    -1,    -1}},
+    {0x1BBA07, {   -1,    -1,  8350,    -1,    -1}},
+    {0x1BBA09, {   -1,    -1, 10459,    -1,    -1}},
+    {0x1BBB01, {   -1,    -1,  6031,    -1,    -1}},
+    {0x1BBB09, {   -1,    -1, 10534,    -1,    -1}},
+    {0x1BBC01, {   -1,    -1,  6120,    -1,    -1}},
+    {0x1BBC09, {   -1,    -1, 10623,    -1,    -1}},
+    {0x1BBD01, {   -1,    -1,  6175,    -1,    -1}},
+    {0x1BBD09, {   -1,    -1, 10678,    -1,    -1}},
+    {0x1BBE01, {   -1,    -1,  6232,    -1,    -1}},
+    {0x1BBE09, {   -1,    -1, 10735,    -1,    -1}},
+    {0x1BC000, {  320,    -1,    -1,    -1,    -1}},
+    {0x1BC001, { 2458,    -1,    -1,    -1,    -1}},
+    {0x1BC100, {  410,    -1,    -1,    -1,    -1}},
+    {0x1BC101, { 2507,    -1,    -1,    -1,    -1}},
+    {0x1BC200, {  487,    -1,    -1,    -1,    -1}},
+    {0x1BC201, { 2555,    -1,    -1,    -1,    -1}},
+    {0x1BC300, {  553,    -1,    -1,    -1,    -1}},
+    {0x1BC400, {  597,    -1,    -1,    -1,    -1}},
+    {0x1BC500, {  630,    -1,    -1,    -1,    -1}},
+    {0x1BC600, {  660,    -1,    -1,    -1,    -1}},
+    {0x1BC700, {  687,    -1,    -1,    -1,    -1}},
+    {0x1BC800, {  709,    -1,    -1,    -1,    -1}},
+    {0x1BC900, {  727,    -1,    -1,    -1,    -1}},
+    {0x1BCA00, {  745,    -1,    -1,    -1,    -1}},
+    {0x1BCB00, {  760,    -1,    -1,    -1,    -1}},
+    {0x1BFE00, {  960,    -1,    -1,    -1,    -1}},
+    {0x1BFF00, { 1088,    -1,    -1,    -1,    -1}},
+    {0x1BFF01, { 2633,    -1,    -1,    -1,    -1}},
+    {0x1C0000, {   -1,    -1,    -1,    -1,    56}},
+    {0x1C0001, { 1554,    -1,    -1,    -1,   149}},
+    {0x1C0002, {   -1,    -1,   550,    -1,    -1}},
+    {0x1C0003, {   -1,    -1,  6303,    -1,    -1}},
+    {0x1C0004, {   -1,    -1,   875,    -1,    -1}},
+    {0x1C0005, {   -1,    -1,  6554,    -1,    -1}},
+    {0x1C0006, {   -1,    -1,  1086,    -1,    -1}},
+    {0x1C0007, {   -1,    -1,  7017,    -1,    -1}},
+    {0x1C0008, {   -1,    -1,  1254,    -1,    -1}},
+    {0x1C0009, {   -1,    -1,  8443,    -1,    -1}},
+    {0x1C0010, {   -1,    -1,  1697,    -1,    -1}},
+    {0x1C0020, {   -1,    -1,  2644,    -1,    -1}},
+    {0x1C0030, {   -1,    -1,  3218,    -1,    -1}},
+    {0x1C0032, {   -1,    -1,  3338,    -1,    -1}},
+    {0x1C0034, {   -1,    -1,  3397,    -1,    -1}},
+    {0x1C0036, {   -1,    -1,  3438,    -1,    -1}},
+    {0x1C0040, {   -1,    -1,  3543,    -1,    -1}},
+    {0x1C0080, { 1284,    -1,    -1,    -1,    -1}},
+    {0x1C00F1, {   -1,    -1,    -1,   285,    -1}},
+    {0x1C00F2, {   -1,    -1,    -1,    56,    -1}},
+    {0x1C0100, {   -1,    -1,    56,    -1,    -1}},
+    {0x1C0101, {   -1,    -1,  4060,    -1,    -1}},
+    {0x1C0103, { 1357,    -1,    -1,    -1,    -1}},
+    {0x1C0107, {   -1,    -1,  7105,    -1,    -1}},
+    {0x1C0109, {   -1,    -1,  8563,    -1,    -1}},
+    {0x1C01F2, {   -1,    -1,    -1,   163,    -1}},
+    {0x1C01FC, {   -1,    -1,  3870,    -1,    -1}},
+    {0x1C01FE, {   -1,    -1,  3934,    -1,    -1}},
+    {0x1C0200, {   -1,    -1,   184,    -1,    -1}},
+    {0x1C0201, {   -1,    -1,  4161,    -1,    -1}},
+    {0x1C0202, {   -1,    -1,   637,    -1,    -1}},
+    {0x1C0207, {   -1,    -1,  7132,    -1,    -1}},
+    {0x1C0209, {   -1,    -1,  8664,    -1,    -1}},
+    {0x1C0210, {   -1,    -1,  1827,    -1,    -1}},
+    {0x1C0230, {   -1,    -1,  3250,    -1,    -1}},
+    {0x1C0232, {   -1,    -1,  3353,    -1,    -1}},
+    {0x1C0300, {   -1,    -1,   312,    -1,    -1}},
+    {0x1C0301, { 1650,    -1,    -1,    -1,    -1}},
+    {0x1C0302, {   -1,    -1,   703,    -1,    -1}},
+    {0x1C0304, {   -1,    -1,   965,    -1,    -1}},
+    {0x1C0310, {   -1,    -1,  1901,    -1,    -1}},
+    {0x1C0320, {   -1,    -1,  2750,    -1,    -1}},
+    {0x1C0330, {   -1,    -1,  3273,    -1,    -1}},
+    {0x1C0332, {   -1,    -1,  3362,    -1,    -1}},
+    {0x1C0340, {   -1,    -1,  3574,    -1,    -1}},
+    {0x1C0400, {   -1,    -1,   440,    -1,    -1}},
+    {0x1C0401, { 1711,    -1,    -1,    -1,    -1}},
+    {0x1C0402, {   -1,    -1,   793,    -1,    -1}},
+    {0x1C0404, {   -1,    -1,  1027,    -1,    -1}},
+    {0x1C0406, {   -1,    -1,  1200,    -1,    -1}},
+    {0x1C0408, {   -1,    -1,  1345,    -1,    -1}},
+    {0x1C0410, {   -1,    -1,  2004,    -1,    -1}},
+    {0x1C0420, {   -1,    -1,  2813,    -1,    -1}},
+    {0x1C0430, {   -1,    -1,  3308,    -1,    -1}},
+    {0x1C0432, {   -1,    -1,  3377,    -1,    -1}},
+    {0x1C0434, {   -1,    -1,  3422,    -1,    -1}},
+    {0x1C0436, {   -1,    -1,  3454,    -1,    -1}},
+    {0x1C0440, {   -1,    -1,  3592,    -1,    -1}},
+    {0x1C0501, { 1760,    -1,    -1,    -1,    -1}},
+    {0x1C0601, { 1806,    -1,    -1,    -1,    -1}},
+    {0x1C0701, { 1853,    -1,    -1,    -1,    -1}},
+    {0x1C0807, {   -1,    -1,  7159,    -1,    -1}},
+    {0x1C0901, {   -1,    -1,  4300,    -1,    -1}},
+    {0x1C0907, {   -1,    -1,  7215,    -1,    -1}},
+    {0x1C0909, {   -1,    -1,  8803,    -1,    -1}},
+    {0x1C0A01, {   -1,    -1,  4398,    -1,    -1}},
+    {0x1C0A07, {   -1,    -1,  7303,    -1,    -1}},
+    {0x1C0A09, {   -1,    -1,  8901,    -1,    -1}},
+    {0x1C0B01, {   -1,    -1,  4441,    -1,    -1}},
+    {0x1C0B07, {   -1,    -1,  7337,    -1,    -1}},
+    {0x1C0B09, {   -1,    -1,  8944,    -1,    -1}},
+    {0x1C0C01, {   -1,    -1,  4489,    -1,    -1}},
+    {0x1C0C09, {   -1,    -1,  8992,    -1,    -1}},
+    {0x1C0D01, {   -1,    -1,  4541,    -1,    -1}},
+    {0x1C0D09, {   -1,    -1,  9044,    -1,    -1}},
+    {0x1C1000, {   45,    -1,    -1,    -1,    -1}},
+    {0x1C1001, {   -1,    -1,  4589,    -1,    -1}},
+    {0x1C1003, { 1394,    -1,    -1,    -1,    -1}},
+    {0x1C1007, {   -1,    -1,  7377,    -1,    -1}},
+    {0x1C1009, {   -1,    -1,  9092,    -1,    -1}},
+    {0x1C1100, {   49,    -1,    -1,    -1,    -1}},
+    {0x1C1103, { 1418,    -1,    -1,    -1,    -1}},
+    {0x1C1203, { 1457,    -1,    -1,    -1,    -1}},
+    {0x1C1807, {   -1,    -1,  7403,    -1,    -1}},
+    {0x1C1901, { 2003,   135,  4686,    -1,    -1}},
+    {0x1C1903, {   -1,    -1,  6372,    -1,    -1}},
+    {0x1C1905, {   -1,    -1,  6649,    -1,    -1}},
+    {0x1C1907, {   -1,    -1,  7443,    -1,    -1}},
+    {0x1C1909, {   -1,    -1,  9189,    -1,    -1}},
+    {0x1C19F1, {   -1,    -1,    -1,   354,    -1}},
+    {0x1C1A01, { 2040,    -1,  4729,    -1,    -1}},
+    {0x1C1A07, {   -1,    -1,  7484,    -1,    -1}},
+    {0x1C1A09, {   -1,    -1,  9232,    -1,    -1}},
+    {0x1C1B01, { 2078,    -1,  4771,    -1,    -1}},
+    {0x1C1B07, {   -1,    -1,  7525,    -1,    -1}},
+    {0x1C1B09, {   -1,    -1,  9274,    -1,    -1}},
+    {0x1C1C01, {   -1,    -1,  4812,    -1,    -1}},
+    {0x1C1C07, {   -1,    -1,  7566,    -1,    -1}},
+    {0x1C1C09, {   -1,    -1,  9315,    -1,    -1}},
+    {0x1C1D01, {   -1,    -1,  4853,    -1,    -1}},
+    {0x1C1D07, {   -1,    -1,  7607,    -1,    -1}},
+    {0x1C1D09, {   -1,    -1,  9356,    -1,    -1}},
+    {0x1C1E01, { 2202,    -1,  4894,    -1,    -1}},
+    {0x1C1E07, {   -1,    -1,  7648,    -1,    -1}},
+    {0x1C1E09, {   -1,    -1,  9397,    -1,    -1}},
+    {0x1C1F01, { 2251,    -1,    -1,    -1,    -1}},
+    {0x1C2000, {  127,    -1,    -1,    -1,    -1}},
+    {0x1C2001, {   -1,    -1,  4961,    -1,    -1}},
+    {0x1C2003, { 1496,    -1,    -1,    -1,    -1}},
+    {0x1C2007, {   -1,    -1,  7719,    -1,    -1}},
+    {0x1C2009, {   -1,    -1,  9464,    -1,    -1}},
+    {0x1C2101, {   -1,    -1,  5048,    -1,    -1}},
+    {0x1C2103, { 1519,    -1,    -1,    -1,    -1}},
+    {0x1C2109, {   -1,    -1,  9551,    -1,    -1}},
+    {0x1C2203, { 1532,    -1,    -1,    -1,    -1}},
+    {0x1C2800, {  204,    -1,    -1,    -1,    -1}},
+    {0x1C2801, {   -1,    -1,  5129,    -1,    -1}},
+    {0x1C2807, {   -1,    -1,  7804,    -1,    -1}},
+    {0x1C2809, {   -1,    -1,  9632,    -1,    -1}},
+    {0x1C2901, { 2348,    -1,  5216,    -1,    -1}},
+    {0x1C2909, {   -1,    -1,  9719,    -1,    -1}},
+    {0x1C2A01, {   -1,    -1,  5244,    -1,    -1}},
+    {0x1C2A09, {   -1,    -1,  9747,    -1,    -1}},
+    {0x1C3001, {   -1,    -1,  5325,    -1,    -1}},
+    {0x1C3007, {   -1,    -1,  7861,    -1,    -1}},
+    {0x1C3009, {   -1,    -1,  9828,    -1,    -1}},
+    {0x1C3101, {   -1,    -1,  5406,    -1,    -1}},
+    {0x1C3105, {   -1,    -1,  6754,    -1,    -1}},
+    {0x1C3107, {   -1,    -1,  7942,    -1,    -1}},
+    {0x1C3109, {   -1,    -1,  9909,    -1,    -1}},
+    {0x1C3201, {   -1,    -1,  5481,    -1,    -1}},
+    {0x1C3205, {   -1,    -1,  6814,    -1,    -1}},
+    {0x1C3207, {   -1,    -1,  8017,    -1,    -1}},
+    {0x1C3209, {   -1,    -1,  9984,    -1,    -1}},
+    {0x1C3301, {   -1,    -1,  5568,    -1,    -1}},
+    {0x1C3309, {   -1,    -1, 10071,    -1,    -1}},
+    {0x1C3401, {   -1,    -1,  5655,    -1,    -1}},
+    {0x1C3407, {   -1,    -1,  8104,    -1,    -1}},
+    {0x1C3409, {   -1,    -1, 10158,    -1,    -1}},
+    {0x1C3501, {   -1,    -1,  5714,    -1,    -1}},
+    {0x1C3507, {   -1,    -1,  8161,    -1,    -1}},
+    {0x1C3509, {   -1,    -1, 10217,    -1,    -1}},
+    {0x1C3601, {   -1,    -1,  5775,    -1,    -1}},
+    {0x1C3609, {   -1,    -1, 10278,    -1,    -1}},
+    {0x1C3801, {   -1,   190,  5843,    -1,    -1}},
+    {0x1C3803, {   -1,    -1,  6427,    -1,    -1}},
+    {0x1C3805, {   -1,    -1,  6875,    -1,    -1}},
+    {0x1C3807, {   -1,    -1,  8237,    -1,    -1}},
+    {0x1C3809, {   -1,    -1, 10346,    -1,    -1}},
+    {0x1C38F1, {   -1,    -1,    -1,   409,    -1}},
+    {0x1C3901, {   -1,    -1,  5904,    -1,    -1}},
+    {0x1C3905, {   -1,    -1,  6930,    -1,    -1}},
+    {0x1C3907, {   -1,    -1,  8298,    -1,    -1}},
+    {0x1C3909, {   -1,    -1, 10407,    -1,    -1}},
+    {0x1C3A01, {   -1,    -1,  5957,    -1,    -1}},
+    {0x1C3A07, {   -1,    -1,  8351,    -1,    -1}},
+    {0x1C3A09, {   -1,    -1, 10460,    -1,    -1}},
+    {0x1C3B01, {   -1,    -1,  6032,    -1,    -1}},
+    {0x1C3B09, {   -1,    -1, 10535,    -1,    -1}},
+    {0x1C3C01, {   -1,    -1,  6121,    -1,    -1}},
+    {0x1C3C09, {   -1,    -1, 10624,    -1,    -1}},
+    {0x1C3D01, {   -1,    -1,  6176,    -1,    -1}},
+    {0x1C3D09, {   -1,    -1, 10679,    -1,    -1}},
+    {0x1C3E01, {   -1,    -1,  6233,    -1,    -1}},
+    {0x1C3E09, {   -1,    -1, 10736,    -1,    -1}},
+    {0x1C4000, {  321,    -1,    -1,    -1,    -1}},
+    {0x1C4001, { 2459,    -1,    -1,    -1,    -1}},
+    {0x1C4100, {  411,    -1,    -1,    -1,    -1}},
+    {0x1C4101, { 2508,    -1,    -1,    -1,    -1}},
+    {0x1C4200, {  488,    -1,    -1,    -1,    -1}},
+    {0x1C4201, { 2556,    -1,    -1,    -1,    -1}},
+    {0x1C4300, {  554,    -1,    -1,    -1,    -1}},
+    {0x1C4400, {  598,    -1,    -1,    -1,    -1}},
+    {0x1C4500, {  631,    -1,    -1,    -1,    -1}},
+    {0x1C4600, {  661,    -1,    -1,    -1,    -1}},
+    {0x1C4700, {  688,    -1,    -1,    -1,    -1}},
+    {0x1C4800, {  710,    -1,    -1,    -1,    -1}},
+    {0x1C4900, {  728,    -1,    -1,    -1,    -1}},
+    {0x1C4A00, {  746,    -1,    -1,    -1,    -1}},
+    {0x1C4B00, {  761,    -1,    -1,    -1,    -1}},
+    {0x1C6000, {  851,    -1,    -1,    -1,    -1}},
+    {0x1C6100, {  879,    -1,    -1,    -1,    -1}},
+    {0x1C7E00, {  961,    -1,    -1,    -1,    -1}},
+    {0x1C7E01, { 2585,    -1,    -1,    -1,    -1}},
+    {0x1C7F00, { 1089,    -1,    -1,    -1,    -1}},
+    {0x1C7F01, { 2634,    -1,    -1,    -1,    -1}},
+    {0x1C7F03, {   -1,    -1,  6474,    -1,    -1}},
+    {0x1C8000, {   -1,    -1,    -1,    -1,    57}},
+    {0x1C8001, { 1555,    -1,    -1,    -1,   150}},
+    {0x1C8002, {   -1,     1,   551,    -1,    -1}},
+    {0x1C8003, {   -1,    -1,  6304,    -1,    -1}},
+    {0x1C8004, {   -1,    -1,   876,    -1,    -1}},
+    {0x1C8005, {   -1,    -1,  6555,    -1,    -1}},
+    {0x1C8006, {   -1,    -1,  1087,    -1,    -1}},
+    {0x1C8007, {   -1,    -1,  7018,    -1,    -1}},
+    {0x1C8008, {   -1,    -1,  1255,    -1,    -1}},
+    {0x1C8009, {   -1,    -1,  8444,    -1,    -1}},
+    {0x1C8010, {   -1,    -1,  1698,    -1,    -1}},
+    {0x1C8020, {   -1,    -1,  2645,    -1,    -1}},
+    {0x1C8080, { 1285,    -1,    -1,    -1,    -1}},
+    {0x1C80F1, {   -1,    -1,    -1,   286,    -1}},
+    {0x1C80F2, {   -1,    -1,    -1,    57,    -1}},
+    {0x1C8100, {   -1,    -1,    57,    -1,    -1}},
+    {0x1C8101, {   -1,    -1,  4061,    -1,    -1}},
+    {0x1C8102, {   -1,    -1,   606,    -1,    -1}},
+    {0x1C8103, { 1358,    -1,    -1,    -1,    -1}},
+    {0x1C8109, {   -1,    -1,  8564,    -1,    -1}},
+    {0x1C81F2, {   -1,    -1,    -1,   164,    -1}},
+    {0x1C81FC, {   -1,    -1,  3871,    -1,    -1}},
+    {0x1C81FE, {   -1,    -1,  3935,    -1,    -1}},
+    {0x1C8200, {   -1,    -1,   185,    -1,    -1}},
+    {0x1C8201, { 1592,    -1,  4162,    -1,    -1}},
+    {0x1C8202, {   -1,    -1,   638,    -1,    -1}},
+    {0x1C8209, {   -1,    -1,  8665,    -1,    -1}},
+    {0x1C82F2, {   -1,    -1,    -1,   209,    -1}},
+    {0x1C8300, {   -1,    -1,   313,    -1,    -1}},
+    {0x1C8301, { 1651,    -1,    -1,    -1,    -1}},
+    {0x1C8302, {   -1,    -1,   704,    -1,    -1}},
+    {0x1C8304, {   -1,    -1,   966,    -1,    -1}},
+    {0x1C8310, {   -1,    -1,  1902,    -1,    -1}},
+    {0x1C8400, {   -1,    -1,   441,    -1,    -1}},
+    {0x1C8401, { 1712,    -1,    -1,    -1,    -1}},
+    {0x1C8402, {   -1,    -1,   794,    -1,    -1}},
+    {0x1C8404, {   -1,    -1,  1028,    -1,    -1}},
+    {0x1C8406, {   -1,    -1,  1201,    -1,    -1}},
+    {0x1C8408, {   -1,    -1,  1346,    -1,    -1}},
+    {0x1C8410, {   -1,    -1,  2005,    -1,    -1}},
+    {0x1C8420, {   -1,    -1,  2814,    -1,    -1}},
+    {0x1C8501, { 1761,    -1,    -1,    -1,    -1}},
+    {0x1C8601, { 1807,    -1,    -1,    -1,    -1}},
+    {0x1C8701, { 1854,    -1,    -1,    -1,    -1}},
+    {0x1C8901, { 1901,    -1,  4301,    -1,    -1}},
+    {0x1C8907, {   -1,    -1,  7216,    -1,    -1}},
+    {0x1C8909, {   -1,    -1,  8804,    -1,    -1}},
+    {0x1C8B01, {   -1,    -1,  4442,    -1,    -1}},
+    {0x1C8B07, {   -1,    -1,  7338,    -1,    -1}},
+    {0x1C8B09, {   -1,    -1,  8945,    -1,    -1}},
+    {0x1C8D01, {   -1,    -1,  4542,    -1,    -1}},
+    {0x1C8D09, {   -1,    -1,  9045,    -1,    -1}},
+    {0x1C9003, { 1395,    -1,    -1,    -1,    -1}},
+    {0x1C9101, { 1953,    -1,    -1,    -1,    -1}},
+    {0x1C9103, { 1419,    -1,    -1,    -1,    -1}},
+    {0x1C9200, {   58,    -1,    -1,    -1,    -1}},
+    {0x1C9203, { 1458,    -1,    -1,    -1,    -1}},
+    {0x1C9807, {   -1,    -1,  7404,    -1,    -1}},
+    {0x1C9901, {   -1,    -1,  4687,    -1,    -1}},
+    {0x1C9907, {   -1,    -1,  7444,    -1,    -1}},
+    {0x1C9909, {   -1,    -1,  9190,    -1,    -1}},
+    {0x1C9A01, { 2041,    -1,    -1,    -1,    -1}},
+    {0x1C9A07, {   -1,    -1,  7485,    -1,    -1}},
+    {0x1C9B01, {   -1,    -1,  4772,    -1,    -1}},
+    {0x1C9B07, {   -1,    -1,  7526,    -1,    -1}},
+    {0x1C9B09, {   -1,    -1,  9275,    -1,    -1}},
+    {0x1C9C01, { 2114,    -1,  4813,    -1,    -1}},
+    {0x1C9C07, {   -1,    -1,  7567,    -1,    -1}},
+    {0x1C9C09, {   -1,    -1,  9316,    -1,    -1}},
+    {0x1C9D01, { 2158,    -1,  4854,    -1,    -1}},
+    {0x1C9D07, {   -1,    -1,  7608,    -1,    -1}},
+    {0x1C9D09, {   -1,    -1,  9357,    -1,    -1}},
+    {0x1C9E01, { 2203,    -1,    -1,    -1,    -1}},
+    {0x1C9E07, {   -1,    -1,  7649,    -1,    -1}},
+    {0x1C9F01, { 2252,    -1,    -1,    -1,    -1}},
+    {0x1CA001, {   -1,    -1,  4962,    -1,    -1}},
+    {0x1CA003, { 1497,    -1,    -1,    -1,    -1}},
+    {0x1CA007, {   -1,    -1,  7720,    -1,    -1}},
+    {0x1CA009, {   -1,    -1,  9465,    -1,    -1}},
+    {0x1CA101, { 2299,    -1,    -1,    -1,    -1}},
+    {0x1CA103, { 1520,    -1,    -1,    -1,    -1}},
+    {0x1CA203, { 1533,    -1,    -1,    -1,    -1}},
+    {0x1CA801, {   -1,    -1,  5130,    -1,    -1}},
+    {0x1CA809, {   -1,    -1,  9633,    -1,    -1}},
+    {0x1CB001, { 2368,   170,  5326,    -1,    -1}},
+    {0x1CB003, {   -1,    -1,  6407,    -1,    -1}},
+    {0x1CB005, {   -1,    -1,  6720,    -1,    -1}},
+    {0x1CB007, {   -1,    -1,  7862,    -1,    -1}},
+    {0x1CB009, {   -1,    -1,  9829,    -1,    -1}},
+    {0x1CB0F1, {   -1,    -1,    -1,   389,    -1}},
+    {0x1CB101, {   -1,    -1,  5407,    -1,    -1}},
+    {0x1CB105, {   -1,    -1,  6755,    -1,    -1}},
+    {0x1CB107, {   -1,    -1,  7943,    -1,    -1}},
+    {0x1CB109, {   -1,    -1,  9910,    -1,    -1}},
+    {0x1CB201, {   -1,    -1,  5482,    -1,    -1}},
+    {0x1CB205, {   -1,    -1,  6815,    -1,    -1}},
+    {0x1CB207, {   -1,    -1,  8018,    -1,    -1}},
+    {0x1CB209, {   -1,    -1,  9985,    -1,    -1}},
+    {0x1CB301, {   -1,    -1,  5569,    -1,    -1}},
+    {0x1CB309, {   -1,    -1, 10072,    -1,    -1}},
+    {0x1CB401, {   -1,    -1,  5656,    -1,    -1}},
+    {0x1CB407, {   -1,    -1,  8105,    -1,    -1}},
+    {0x1CB409, {   -1,    -1, 10159,    -1,    -1}},
+    {0x1CB501, {   -1,    -1,  5715,    -1,    -1}},
+    {0x1CB507, {   -1,    -1,  8162,    -1,    -1}},
+    {0x1CB509, {   -1,    -1, 10218,    -1,    -1}},
+    {0x1CB601, {   -1,    -1,  5776,    -1,    -1}},
+    {0x1CB609, {   -1,    -1, 10279,    -1,    -1}},
+    {0x1CB801, { 2397,   191,  5844,    -1,    -1}},
+    {0x1CB803, {   -1,    -1,  6428,    -1,    -1}},
+    {0x1CB805, {   -1,    -1,  6876,    -1,    -1}},
+    {0x1CB807, {   -1,    -1,  8238,    -1,    -1}},
+    {0x1CB809, {   -1,    -1, 10347,    -1,    -1}},
+    {0x1CB8F1, {   -1,    -1,    -1,   410,    -1}},
+    {0x1CB901, { 2426,    -1,  5905,    -1,    -1}},
+    {0x1CB905, {   -1,    -1,  6931,    -1,    -1}},
+    {0x1CB907, {   -1,    -1,  8299,    -1,    -1}},
+    {0x1CB909, {   -1,    -1, 10408,    -1,    -1}},
+    {0x1CBA01, {   -1,    -1,  5958,    -1,    -1}},
+    {0x1CBA07, {   -1,    -1,  8352,    -1,    -1}},
+    {0x1CBA09, {   -1,    -1, 10461,    -1,    -1}},
+    {0x1CBB01, {   -1,    -1,  6033,    -1,    -1}},
+    {0x1CBB09, {   -1,    -1, 10536,    -1,    -1}},
+    {0x1CBC01, {   -1,    -1,  6122,    -1,    -1}},
+    {0x1CBC09, {   -1,    -1, 10625,    -1,    -1}},
+    {0x1CBD01, {   -1,    -1,  6177,    -1,    -1}},
+    {0x1CBD09, {   -1,    -1, 10680,    -1,    -1}},
+    {0x1CBE01, {   -1,    -1,  6234,    -1,    -1}},
+    {0x1CBE09, {   -1,    -1, 10737,    -1,    -1}},
+    {0x1CC000, {  322,    -1,    -1,    -1,    -1}},
+    {0x1CC001, { 2460,    -1,    -1,    -1,    -1}},
+    {0x1CC100, {  412,    -1,    -1,    -1,    -1}},
+    {0x1CC101, { 2509,    -1,    -1,    -1,    -1}},
+    {0x1CC200, {  489,    -1,    -1,    -1,    -1}},
+    {0x1CC201, { 2557,    -1,    -1,    -1,    -1}},
+    {0x1CC300, {  555,    -1,    -1,    -1,    -1}},
+    {0x1CC400, {  599,    -1,    -1,    -1,    -1}},
+    {0x1CC500, {  632,    -1,    -1,    -1,    -1}},
+    {0x1CC600, {  662,    -1,    -1,    -1,    -1}},
+    {0x1CFE00, {  962,    -1,    -1,    -1,    -1}},
+    {0x1CFE01, { 2586,    -1,    -1,    -1,    -1}},
+    {0x1CFF00, { 1090,    -1,    -1,    -1,    -1}},
+    {0x1CFF01, { 2635,    -1,    -1,    -1,    -1}},
+    {0x1D0000, {   -1,    -1,    -1,    -1,    58}},
+    {0x1D0001, {   -1,    -1,    -1,    -1,   151}},
+    {0x1D0002, {   -1,    -1,   552,    -1,    -1}},
+    {0x1D0003, {   -1,    -1,  6305,    -1,    -1}},
+    {0x1D0005, {   -1,    -1,  6556,    -1,    -1}},
+    {0x1D0007, {   -1,    -1,  7019,    -1,    -1}},
+    {0x1D0009, {   -1,    -1,  8445,    -1,    -1}},
+    {0x1D0010, {   -1,    -1,  1699,    -1,    -1}},
+    {0x1D00F1, {   -1,    -1,    -1,   287,    -1}},
+    {0x1D00F2, {   -1,    -1,    -1,    58,    -1}},
+    {0x1D0100, {   -1,    -1,    58,    -1,    -1}},
+    {0x1D0101, {   -1,    -1,  4062,    -1,    -1}},
+    {0x1D0103, { 1359,    -1,    -1,    -1,    -1}},
+    {0x1D0109, {   -1,    -1,  8565,    -1,    -1}},
+    {0x1D01FC, {   -1,    -1,  3872,    -1,    -1}},
+    {0x1D01FE, {   -1,    -1,  3936,    -1,    -1}},
+    {0x1D0200, {   -1,    -1,   186,    -1,    -1}},
+    {0x1D0201, {   -1,    -1,  4163,    -1,    -1}},
+    {0x1D0202, {   -1,    -1,   639,    -1,    -1}},
+    {0x1D0209, {   -1,    -1,  8666,    -1,    -1}},
+    {0x1D0300, {   -1,    -1,   314,    -1,    -1}},
+    {0x1D0301, { 1652,    -1,    -1,    -1,    -1}},
+    {0x1D0302, {   -1,    -1,   705,    -1,    -1}},
+    {0x1D0400, {   -1,    -1,   442,    -1,    -1}},
+    {0x1D0402, {   -1,    -1,   795,    -1,    -1}},
+    {0x1D0410, {   -1,    -1,  2006,    -1,    -1}},
+    {0x1D0901, {   -1,    -1,  4302,    -1,    -1}},
+    {0x1D0907, {   -1,    -1,  7217,    -1,    -1}},
+    {0x1D0909, {   -1,    -1,  8805,    -1,    -1}},
+    {0x1D1000, {   46,    -1,    -1,    -1,    -1}},
+    {0x1D1103, { 1420,    -1,    -1,    -1,    -1}},
+    {0x1D1203, { 1459,    -1,    -1,    -1,    -1}},
+    {0x1D2001, {   -1,    -1,  4963,    -1,    -1}},
+    {0x1D2003, { 1498,    -1,    -1,    -1,    -1}},
+    {0x1D2007, {   -1,    -1,  7721,    -1,    -1}},
+    {0x1D2009, {   -1,    -1,  9466,    -1,    -1}},
+    {0x1D2103, { 1521,    -1,    -1,    -1,    -1}},
+    {0x1D2203, { 1534,    -1,    -1,    -1,    -1}},
+    {0x1D2801, {   -1,    -1,  5131,    -1,    -1}},
+    {0x1D2809, {   -1,    -1,  9634,    -1,    -1}},
+    {0x1D3001, {   -1,    -1,  5327,    -1,    -1}},
+    {0x1D3007, {   -1,    -1,  7863,    -1,    -1}},
+    {0x1D3009, {   -1,    -1,  9830,    -1,    -1}},
+    {0x1D3101, {   -1,    -1,  5408,    -1,    -1}},
+    {0x1D3105, {   -1,    -1,  6756,    -1,    -1}},
+    {0x1D3107, {   -1,    -1,  7944,    -1,    -1}},
+    {0x1D3109, {   -1,    -1,  9911,    -1,    -1}},
+    {0x1D3201, {   -1,    -1,  5483,    -1,    -1}},
+    {0x1D3205, {   -1,    -1,  6816,    -1,    -1}},
+    {0x1D3207, {   -1,    -1,  8019,    -1,    -1}},
+    {0x1D3209, {   -1,    -1,  9986,    -1,    -1}},
+    {0x1D3301, {   -1,    -1,  5570,    -1,    -1}},
+    {0x1D3309, {   -1,    -1, 10073,    -1,    -1}},
+    {0x1D3401, {   -1,    -1,  5657,    -1,    -1}},
+    {0x1D3407, {   -1,    -1,  8106,    -1,    -1}},
+    {0x1D3409, {   -1,    -1, 10160,    -1,    -1}},
+    {0x1D3501, {   -1,    -1,  5716,    -1,    -1}},
+    {0x1D3507, {   -1,    -1,  8163,    -1,    -1}},
+    {0x1D3509, {   -1,    -1, 10219,    -1,    -1}},
+    {0x1D3601, {   -1,    -1,  5777,    -1,    -1}},
+    {0x1D3609, {   -1,    -1, 10280,    -1,    -1}},
+    {0x1D3801, {   -1,   192,  5845,    -1,    -1}},
+    {0x1D3803, {   -1,    -1,  6429,    -1,    -1}},
+    {0x1D3805, {   -1,    -1,  6877,    -1,    -1}},
+    {0x1D3807, {   -1,    -1,  8239,    -1,    -1}},
+    {0x1D3809, {   -1,    -1, 10348,    -1,    -1}},
+    {0x1D38F1, {   -1,    -1,    -1,   411,    -1}},
+    {0x1D3901, {   -1,    -1,  5906,    -1,    -1}},
+    {0x1D3905, {   -1,    -1,  6932,    -1,    -1}},
+    {0x1D3907, {   -1,    -1,  8300,    -1,    -1}},
+    {0x1D3909, {   -1,    -1, 10409,    -1,    -1}},
+    {0x1D3A01, {   -1,    -1,  5959,    -1,    -1}},
+    {0x1D3A07, {   -1,    -1,  8353,    -1,    -1}},
+    {0x1D3A09, {   -1,    -1, 10462,    -1,    -1}},
+    {0x1D3B01, {   -1,    -1,  6034,    -1,    -1}},
+    {0x1D3B09, {   -1,    -1, 10537,    -1,    -1}},
+    {0x1D3C01, {   -1,    -1,  6123,    -1,    -1}},
+    {0x1D3C09, {   -1,    -1, 10626,    -1,    -1}},
+    {0x1D3D01, {   -1,    -1,  6178,    -1,    -1}},
+    {0x1D3D09, {   -1,    -1, 10681,    -1,    -1}},
+    {0x1D3E01, {   -1,    -1,  6235,    -1,    -1}},
+    {0x1D3E09, {   -1,    -1, 10738,    -1,    -1}},
+    {0x1D4000, {  323,    -1,    -1,    -1,    -1}},
+    {0x1D4100, {  413,    -1,    -1,    -1,    -1}},
+    {0x1D4200, {  490,    -1,    -1,    -1,    -1}},
+    {0x1D7E00, {  963,    -1,    -1,    -1,    -1}},
+    {0x1D7F00, { 1091,    -1,    -1,    -1,    -1}},
+    {0x1D7F01, { 2636,    -1,    -1,    -1,    -1}},
+    {0x1D8000, {   -1,    -1,    -1,    -1,    59}},
+    {0x1D8001, { 1556,    -1,    -1,    -1,   152}},
+    {0x1D8002, {   -1,    -1,   553,    -1,    -1}},
+    {0x1D8003, {   -1,    -1,  6306,    -1,    -1}},
+    {0x1D8004, {   -1,    -1,   877,    -1,    -1}},
+    {0x1D8005, {   -1,    -1,  6557,    -1,    -1}},
+    {0x1D8006, {   -1,    -1,  1088,    -1,    -1}},
+    {0x1D8007, {   -1,    -1,  7020,    -1,    -1}},
+    {0x1D8009, {   -1,    -1,  8446,    -1,    -1}},
+    {0x1D8010, {   -1,    -1,  1700,    -1,    -1}},
+    {0x1D80F1, {   -1,    -1,    -1,   288,    -1}},
+    {0x1D80F2, {   -1,    -1,    -1,    59,    -1}},
+    {0x1D8100, {   -1,    -1,    59,    -1,    -1}},
+    {0x1D8101, {   -1,    -1,  4063,    -1,    -1}},
+    {0x1D8103, { 1360,    -1,    -1,    -1,    -1}},
+    {0x1D8109, {   -1,    -1,  8566,    -1,    -1}},
+    {0x1D81F2, {   -1,    -1,    -1,   165,    -1}},
+    {0x1D81FC, {   -1,    -1,  3873,    -1,    -1}},
+    {0x1D81FE, {   -1,    -1,  3937,    -1,    -1}},
+    {0x1D8200, {   -1,    -1,   187,    -1,    -1}},
+    {0x1D8201, { 1593,    -1,  4164,    -1,    -1}},
+    {0x1D8207, {   -1,    -1,  7133,    -1,    -1}},
+    {0x1D8209, {   -1,    -1,  8667,    -1,    -1}},
+    {0x1D8300, {   -1,    -1,   315,    -1,    -1}},
+    {0x1D8301, { 1653,    -1,    -1,    -1,    -1}},
+    {0x1D8310, {   -1,    -1,  1903,    -1,    -1}},
+    {0x1D8400, {   -1,    -1,   443,    -1,    -1}},
+    {0x1D8401, { 1713,    -1,    -1,    -1,    -1}},
+    {0x1D8402, {   -1,    -1,   796,    -1,    -1}},
+    {0x1D8404, {   -1,    -1,  1029,    -1,    -1}},
+    {0x1D8406, {   -1,    -1,  1202,    -1,    -1}},
+    {0x1D8410, {   -1,    -1,  2007,    -1,    -1}},
+    {0x1D8501, { 1762,    -1,    -1,    -1,    -1}},
+    {0x1D8601, { 1808,    -1,    -1,    -1,    -1}},
+    {0x1D8701, { 1855,    -1,    -1,    -1,    -1}},
+    {0x1D8901, { 1902,    -1,  4303,    -1,    -1}},
+    {0x1D8907, {   -1,    -1,  7218,    -1,    -1}},
+    {0x1D8909, {   -1,    -1,  8806,    -1,    -1}},
+    {0x1D9101, { 1954,    -1,    -1,    -1,    -1}},
+    {0x1D9103, { 1421,    -1,    -1,    -1,    -1}},
+    {0x1D9203, { 1460,    -1,    -1,    -1,    -1}},
+    {0x1D9901, {   -1,    -1,  4688,    -1,    -1}},
+    {0x1D9907, {   -1,    -1,  7445,    -1,    -1}},
+    {0x1D9909, {   -1,    -1,  9191,    -1,    -1}},
+    {0x1D9A01, { 2042,    -1,    -1,    -1,    -1}},
+    {0x1D9A07, {   -1,    -1,  7486,    -1,    -1}},
+    {0x1D9B01, {   -1,    -1,  4773,    -1,    -1}},
+    {0x1D9B07, {   -1,    -1,  7527,    -1,    -1}},
+    {0x1D9B09, {   -1,    -1,  9276,    -1,    -1}},
+    {0x1D9C01, { 2115,    -1,  4814,    -1,    -1}},
+    {0x1D9C07, {   -1,    -1,  7568,    -1,    -1}},
+    {0x1D9C09, {   -1,    -1,  9317,    -1,    -1}},
+    {0x1D9D01, { 2159,    -1,  4855,    -1,    -1}},
+    {0x1D9D07, {   -1,    -1,  7609,    -1,    -1}},
+    {0x1D9D09, {   -1,    -1,  9358,    -1,    -1}},
+    {0x1D9E01, { 2204,    -1,  4895,    -1,    -1}},
+    {0x1D9E07, {   -1,    -1,  7650,    -1,    -1}},
+    {0x1D9E09, {   -1,    -1,  9398,    -1,    -1}},
+    {0x1D9F01, { 2253,    -1,    -1,    -1,    -1}},
+    {0x1DA001, {   -1,    -1,  4964,    -1,    -1}},
+    {0x1DA007, {   -1,    -1,  7722,    -1,    -1}},
+    {0x1DA009, {   -1,    -1,  9467,    -1,    -1}},
+    {0x1DA101, { 2300,    -1,  5049,    -1,    -1}},
+    {0x1DA109, {   -1,    -1,  9552,    -1,    -1}},
+    {0x1DA801, {   -1,    -1,  5132,    -1,    -1}},
+    {0x1DA807, {   -1,    -1,  7805,    -1,    -1}},
+    {0x1DA809, {   -1,    -1,  9635,    -1,    -1}},
+    {0x1DA901, { 2349,    -1,  5217,    -1,    -1}},
+    {0x1DA909, {   -1,    -1,  9720,    -1,    -1}},
+    {0x1DAA01, {   -1,    -1,  5245,    -1,    -1}},
+    {0x1DAA09, {   -1,    -1,  9748,    -1,    -1}},
+    {0x1DB001, { 2369,   171,  5328,    -1,    -1}},
+    {0x1DB003, {   -1,    -1,  6408,    -1,    -1}},
+    {0x1DB005, {   -1,    -1,  6721,    -1,    -1}},
+    {0x1DB007, {   -1,    -1,  7864,    -1,    -1}},
+    {0x1DB009, {   -1,    -1,  9831,    -1,    -1}},
+    {0x1DB0F1, {   -1,    -1,    -1,   390,    -1}},
+    {0x1DB101, {   -1,    -1,  5409,    -1,    -1}},
+    {0x1DB105, {   -1,    -1,  6757,    -1,    -1}},
+    {0x1DB107, {   -1,    -1,  7945,    -1,    -1}},
+    {0x1DB109, {   -1,    -1,  9912,    -1,    -1}},
+    {0x1DB201, {   -1,    -1,  5484,    -1,    -1}},
+    {0x1DB205, {   -1,    -1,  6817,    -1,    -1}},
+    {0x1DB207, {   -1,    -1,  8020,    -1,    -1}},
+    {0x1DB209, {   -1,    -1,  9987,    -1,    -1}},
+    {0x1DB301, {   -1,    -1,  5571,    -1,    -1}},
+    {0x1DB309, {   -1,    -1, 10074,    -1,    -1}},
+    {0x1DB401, {   -1,    -1,  5658,    -1,    -1}},
+    {0x1DB407, {   -1,    -1,  8107,    -1,    -1}},
+    {0x1DB409, {   -1,    -1, 10161,    -1,    -1}},
+    {0x1DB501, {   -1,    -1,  5717,    -1,    -1}},
+    {0x1DB507, {   -1,    -1,  8164,    -1,    -1}},
+    {0x1DB509, {   -1,    -1, 10220,    -1,    -1}},
+    {0x1DB601, {   -1,    -1,  5778,    -1,    -1}},
+    {0x1DB609, {   -1,    -1, 10281,    -1,    -1}},
+    {0x1DB801, { 2398,   193,  5846,    -1,    -1}},
+    {0x1DB803, {   -1,    -1,  6430,    -1,    -1}},
+    {0x1DB805, {   -1,    -1,  6878,    -1,    -1}},
+    {0x1DB807, {   -1,    -1,  8240,    -1,    -1}},
+    {0x1DB809, {   -1,    -1, 10349,    -1,    -1}},
+    {0x1DB8F1, {   -1,    -1,    -1,   412,    -1}},
+    {0x1DB901, { 2427,    -1,  5907,    -1,    -1}},
+    {0x1DB905, {   -1,    -1,  6933,    -1,    -1}},
+    {0x1DB907, {   -1,    -1,  8301,    -1,    -1}},
+    {0x1DB909, {   -1,    -1, 10410,    -1,    -1}},
+    {0x1DBA01, {   -1,    -1,  5960,    -1,    -1}},
+    {0x1DBA07, {   -1,    -1,  8354,    -1,    -1}},
+    {0x1DBA09, {   -1,    -1, 10463,    -1,    -1}},
+    {0x1DBB01, {   -1,    -1,  6035,    -1,    -1}},
+    {0x1DBB09, {   -1,    -1, 10538,    -1,    -1}},
+    {0x1DBC01, {   -1,    -1,  6124,    -1,    -1}},
+    {0x1DBC09, {   -1,    -1, 10627,    -1,    -1}},
+    {0x1DBD01, {   -1,    -1,  6179,    -1,    -1}},
+    {0x1DBD09, {   -1,    -1, 10682,    -1,    -1}},
+    {0x1DBE01, {   -1,    -1,  6236,    -1,    -1}},
+    {0x1DBE09, {   -1,    -1, 10739,    -1,    -1}},
+    {0x1DC000, {  324,    -1,    -1,    -1,    -1}},
+    {0x1DC001, { 2461,    -1,    -1,    -1,    -1}},
+    {0x1DC100, {  414,    -1,    -1,    -1,    -1}},
+    {0x1DC101, { 2510,    -1,    -1,    -1,    -1}},
+    {0x1DC201, { 2558,    -1,    -1,    -1,    -1}},
+    {0x1DFE00, {  964,    -1,    -1,    -1,    -1}},
+    {0x1DFE01, { 2587,    -1,    -1,    -1,    -1}},
+    {0x1DFF00, { 1092,    -1,    -1,    -1,    -1}},
+    {0x1DFF01, { 2637,    -1,    -1,    -1,    -1}},
+    {0x1E0000, {   -1,    -1,    -1,    -1,    60}},
+    {0x1E0001, {   -1,    -1,    -1,    -1,   153}},
+    {0x1E0002, {   -1,     2,   554,    -1,    -1}},
+    {0x1E0003, {   -1,    -1,  6307,    -1,    -1}},
+    {0x1E0004, {   -1,    -1,   878,    -1,    -1}},
+    {0x1E0005, {   -1,    -1,  6558,    -1,    -1}},
+    {0x1E0006, {   -1,    -1,  1089,    -1,    -1}},
+    {0x1E0007, {   -1,    -1,  7021,    -1,    -1}},
+    {0x1E0009, {   -1,    -1,  8447,    -1,    -1}},
+    {0x1E0010, {   -1,    -1,  1701,    -1,    -1}},
+    {0x1E0012, {   -1,    -1,  2090,    -1,    -1}},
+    {0x1E0020, {   -1,    -1,  2646,    -1,    -1}},
+    {0x1E0030, {   -1,    -1,  3219,    -1,    -1}},
+    {0x1E00F1, {   -1,    -1,    -1,   289,    -1}},
+    {0x1E00F2, {   -1,    -1,    -1,    60,    -1}},
+    {0x1E0100, {   -1,    -1,    60,    -1,    -1}},
+    {0x1E0101, {   -1,    -1,  4064,    -1,    -1}},
+    {0x1E0102, {   -1,    -1,   607,    -1,    -1}},
+    {0x1E0103, { 1361,    -1,    -1,    -1,    -1}},
+    {0x1E0109, {   -1,    -1,  8567,    -1,    -1}},
+    {0x1E01F2, {   -1,    -1,    -1,   166,    -1}},
+    {0x1E01FC, {   -1,    -1,  3874,    -1,    -1}},
+    {0x1E01FE, {   -1,    -1,  3938,    -1,    -1}},
+    {0x1E0200, {   -1,    -1,   188,    -1,    -1}},
+    {0x1E0201, { 1594,    -1,  4165,    -1,    -1}},
+    {0x1E0202, {   -1,    -1,   640,    -1,    -1}},
+    {0x1E0209, {   -1,    -1,  8668,    -1,    -1}},
+    {0x1E0210, {   -1,    -1,  1828,    -1,    -1}},
+    {0x1E0220, {   -1,    -1,  2707,    -1,    -1}},
+    {0x1E0300, {   -1,    -1,   316,    -1,    -1}},
+    {0x1E0301, { 1654,    -1,    -1,    -1,    -1}},
+    {0x1E0302, {   -1,    -1,   706,    -1,    -1}},
+    {0x1E0304, {   -1,    -1,   967,    -1,    -1}},
+    {0x1E0306, {   -1,    -1,  1158,    -1,    -1}},
+    {0x1E0310, {   -1,    -1,  1904,    -1,    -1}},
+    {0x1E0312, {   -1,    -1,  2172,    -1,    -1}},
+    {0x1E0320, {   -1,    -1,  2751,    -1,    -1}},
+    {0x1E0330, {   -1,    -1,  3274,    -1,    -1}},
+    {0x1E0400, {   -1,    -1,   444,    -1,    -1}},
+    {0x1E0401, { 1714,    -1,    -1,    -1,    -1}},
+    {0x1E0402, {   -1,    -1,   797,    -1,    -1}},
+    {0x1E0404, {   -1,    -1,  1030,    -1,    -1}},
+    {0x1E0406, {   -1,    -1,  1203,    -1,    -1}},
+    {0x1E0410, {   -1,    -1,  2008,    -1,    -1}},
+    {0x1E0412, {   -1,    -1,  2229,    -1,    -1}},
+    {0x1E0420, {   -1,    -1,  2815,    -1,    -1}},
+    {0x1E0430, {   -1,    -1,  3309,    -1,    -1}},
+    {0x1E0501, { 1763,    -1,    -1,    -1,    -1}},
+    {0x1E0600, {   18,    -1,    -1,    -1,    -1}},
+    {0x1E0601, { 1809,    -1,    -1,    -1,    -1}},
+    {0x1E0701, { 1856,    -1,    -1,    -1,    -1}},
+    {0x1E0901, { 1903,    -1,  4304,    -1,    -1}},
+    {0x1E0907, {   -1,    -1,  7219,    -1,    -1}},
+    {0x1E0909, {   -1,    -1,  8807,    -1,    -1}},
+    {0x1E0B01, {   -1,    -1,  4443,    -1,    -1}},
+    {0x1E0B07, {   -1,    -1,  7339,    -1,    -1}},
+    {0x1E0B09, {   -1,    -1,  8946,    -1,    -1}},
+    {0x1E0D01, {   -1,    -1,  4543,    -1,    -1}},
+    {0x1E0D09, {   -1,    -1,  9046,    -1,    -1}},
+    {0x1E1101, { 1955,    -1,    -1,    -1,    -1}},
+    {0x1E1103, { 1422,    -1,    -1,    -1,    -1}},
+    {0x1E1203, { 1461,    -1,    -1,    -1,    -1}},
+    {0x1E1807, {   -1,    -1,  7405,    -1,    -1}},
+    {0x1E1901, {   -1,    -1,  4689,    -1,    -1}},
+    {0x1E1907, {   -1,    -1,  7446,    -1,    -1}},
+    {0x1E1909, {   -1,    -1,  9192,    -1,    -1}},
+    {0x1E1A01, { 2043,    -1,    -1,    -1,    -1}},
+    {0x1E1A07, {   -1,    -1,  7487,    -1,    -1}},
+    {0x1E1B01, {   -1,    -1,  4774,    -1,    -1}},
+    {0x1E1B07, {   -1,    -1,  7528,    -1,    -1}},
+    {0x1E1B09, {   -1,    -1,  9277,    -1,    -1}},
+    {0x1E1C01, { 2116,    -1,  4815,    -1,    -1}},
+    {0x1E1C07, {   -1,    -1,  7569,    -1,    -1}},
+    {0x1E1C09, {   -1,    -1,  9318,    -1,    -1}},
+    {0x1E1D01, { 2160,    -1,  4856,    -1,    -1}},
+    {0x1E1D07, {   -1,    -1,  7610,    -1,    -1}},
+    {0x1E1D09, {   -1,    -1,  9359,    -1,    -1}},
+    {0x1E1E01, { 2205,    -1,    -1,    -1,    -1}},
+    {0x1E1E07, {   -1,    -1,  7651,    -1,    -1}},
+    {0x1E1F01, { 2254,    -1,    -1,    -1,    -1}},
+    {0x1E2000, {  128,    -1,    -1,    -1,    -1}},
+    {0x1E2001, {   -1,    -1,  4965,    -1,    -1}},
+    {0x1E2007, {   -1,    -1,  7723,    -1,    -1}},
+    {0x1E2009, {   -1,    -1,  9468,    -1,    -1}},
+    {0x1E2101, { 2301,    -1,    -1,    -1,    -1}},
+    {0x1E2500, {  165,    -1,    -1,    -1,    -1}},
+    {0x1E2801, {   -1,    -1,  5133,    -1,    -1}},
+    {0x1E2809, {   -1,    -1,  9636,    -1,    -1}},
+    {0x1E3001, {   -1,    -1,  5329,    -1,    -1}},
+    {0x1E3007, {   -1,    -1,  7865,    -1,    -1}},
+    {0x1E3009, {   -1,    -1,  9832,    -1,    -1}},
+    {0x1E3101, {   -1,    -1,  5410,    -1,    -1}},
+    {0x1E3105, {   -1,    -1,  6758,    -1,    -1}},
+    {0x1E3107, {   -1,    -1,  7946,    -1,    -1}},
+    {0x1E3109, {   -1,    -1,  9913,    -1,    -1}},
+    {0x1E3201, {   -1,    -1,  5485,    -1,    -1}},
+    {0x1E3205, {   -1,    -1,  6818,    -1,    -1}},
+    {0x1E3207, {   -1,    -1,  8021,    -1,    -1}},
+    {0x1E3209, {   -1,    -1,  9988,    -1,    -1}},
+    {0x1E3301, {   -1,    -1,  5572,    -1,    -1}},
+    {0x1E3309, {   -1,    -1, 10075,    -1,    -1}},
+    {0x1E3401, {   -1,    -1,  5659,    -1,    -1}},
+    {0x1E3407, {   -1,    -1,  8108,    -1,    -1}},
+    {0x1E3409, {   -1,    -1, 10162,    -1,    -1}},
+    {0x1E3501, {   -1,    -1,  5718,    -1,    -1}},
+    {0x1E3507, {   -1,    -1,  8165,    -1,    -1}},
+    {0x1E3509, {   -1,    -1, 10221,    -1,    -1}},
+    {0x1E3601, {   -1,    -1,  5779,    -1,    -1}},
+    {0x1E3609, {   -1,    -1, 10282,    -1,    -1}},
+    {0x1E3801, {   -1,   194,  5847,    -1,    -1}},
+    {0x1E3803, {   -1,    -1,  6431,    -1,    -1}},
+    {0x1E3805, {   -1,    -1,  6879,    -1,    -1}},
+    {0x1E3807, {   -1,    -1,  8241,    -1,    -1}},
+    {0x1E3809, {   -1,    -1, 10350,    -1,    -1}},
+    {0x1E38F1, {   -1,    -1,    -1,   413,    -1}},
+    {0x1E3901, {   -1,    -1,  5908,    -1,    -1}},
+    {0x1E3905, {   -1,    -1,  6934,    -1,    -1}},
+    {0x1E3907, {   -1,    -1,  8302,    -1,    -1}},
+    {0x1E3909, {   -1,    -1, 10411,    -1,    -1}},
+    {0x1E3A01, {   -1,    -1,  5961,    -1,    -1}},
+    {0x1E3A07, {   -1,    -1,  8355,    -1,    -1}},
+    {0x1E3A09, {   -1,    -1, 10464,    -1,    -1}},
+    {0x1E3B01, {   -1,    -1,  6036,    -1,    -1}},
+    {0x1E3B09, {   -1,    -1, 10539,    -1,    -1}},
+    {0x1E3C01, {   -1,    -1,  6125,    -1,    -1}},
+    {0x1E3C09, {   -1,    -1, 10628,    -1,    -1}},
+    {0x1E3D01, {   -1,    -1,  6180,    -1,    -1}},
+    {0x1E3D09, {   -1,    -1, 10683,    -1,    -1}},
+    {0x1E3E01, {   -1,    -1,  6237,    -1,    -1}},
+    {0x1E3E09, {   -1,    -1, 10740,    -1,    -1}},
+    {0x1E4000, {  325,    -1,    -1,    -1,    -1}},
+    {0x1E4001, { 2462,    -1,    -1,    -1,    -1}},
+    {0x1E4100, {  415,    -1,    -1,    -1,    -1}},
+    {0x1E4101, { 2511,    -1,    -1,    -1,    -1}},
+    {0x1E4200, {  491,    -1,    -1,    -1,    -1}},
+    {0x1E4201, { 2559,    -1,    -1,    -1,    -1}},
+    {0x1E4300, {  556,    -1,    -1,    -1,    -1}},
+    {0x1E7E00, {  965,    -1,    -1,    -1,    -1}},
+    {0x1E7F00, { 1093,    -1,    -1,    -1,    -1}},
+    {0x1E7F01, { 2638,    -1,    -1,    -1,    -1}},
+    {0x1E7F03, {   -1,    -1,  6475,    -1,    -1}},
+    {0x1E8000, {   -1,    -1,    -1,    -1,    61}},
+    {0x1E8001, {   -1,    -1,    -1,    -1,   154}},
+    {0x1E8002, {   -1,    -1,   555,    -1,    -1}},
+    {0x1E8003, {   -1,    -1,  6308,    -1,    -1}},
+    {0x1E8004, {   -1,    -1,   879,    -1,    -1}},
+    {0x1E8005, {   -1,    -1,  6559,    -1,    -1}},
+    {0x1E8006, {   -1,    -1,  1090,    -1,    -1}},
+    {0x1E8007, {   -1,    -1,  7022,    -1,    -1}},
+    {0x1E8008, {   -1,    -1,  1256,    -1,    -1}},
+    {0x1E8009, {   -1,    -1,  8448,    -1,    -1}},
+    {0x1E800A, {   -1,    -1,  1393,    -1,    -1}},
+    {0x1E8010, {   -1,    66,  1702,    -1,    -1}},
+    {0x1E8012, {   -1,    -1,  2091,    -1,    -1}},
+    {0x1E8014, {   -1,    -1,  2285,    -1,    -1}},
+    {0x1E8018, {   -1,    -1,  2470,    -1,    -1}},
+    {0x1E801C, {   -1,    -1,  2563,    -1,    -1}},
+    {0x1E8020, {   -1,    -1,  2647,    -1,    -1}},
+    {0x1E8022, {   -1,    -1,  2864,    -1,    -1}},
+    {0x1E8030, {   -1,    -1,  3220,    -1,    -1}},
+    {0x1E8032, {   -1,    -1,  3339,    -1,    -1}},
+    {0x1E8034, {   -1,    -1,  3398,    -1,    -1}},
+    {0x1E8040, {   -1,    -1,  3544,    -1,    -1}},
+    {0x1E8042, {   -1,    -1,  3614,    -1,    -1}},
+    {0x1E8046, {   -1,    -1,  3662,    -1,    -1}},
+    {0x1E8048, {   -1,    -1,  3681,    -1,    -1}},
+    {0x1E804A, {   -1,    -1,  3694,    -1,    -1}},
+    {0x1E804C, {   -1,    -1,  3703,    -1,    -1}},
+    {0x1E80F1, {   -1,    -1,    -1,   290,    -1}},
+    {0x1E80F2, {   -1,    -1,    -1,    61,    -1}},
+    {0x1E8100, {   -1,    -1,    61,    -1,    -1}},
+    {0x1E8101, {   -1,    -1,  4065,    -1,    -1}},
+    {0x1E8103, { 1362,    -1,    -1,    -1,    -1}},
+    {0x1E8109, {   -1,    -1,  8568,    -1,    -1}},
+    {0x1E8110, {   -1,    -1,  1781,    -1,    -1}},
+    {0x1E81F2, {   -1,    -1,    -1,   167,    -1}},
+    {0x1E81FC, {   -1,    -1,  3875,    -1,    -1}},
+    {0x1E81FE, {   -1,    -1,  3939,    -1,    -1}},
+    {0x1E8200, {   -1,    -1,   189,    -1,    -1}},
+    {0x1E8201, { 1595,    -1,  4166,    -1,    -1}},
+    {0x1E8209, {   -1,    -1,  8669,    -1,    -1}},
+    {0x1E8210, {   -1,    -1,  1829,    -1,    -1}},
+    {0x1E8220, {   -1,    -1,  2708,    -1,    -1}},
+    {0x1E8300, {   15,    -1,   317,    -1,    -1}},
+    {0x1E8301, { 1655,    -1,    -1,    -1,    -1}},
+    {0x1E8302, {   -1,    -1,   707,    -1,    -1}},
+    {0x1E8304, {   -1,    -1,   968,    -1,    -1}},
+    {0x1E8310, {   -1,    -1,  1905,    -1,    -1}},
+    {0x1E8312, {   -1,    -1,  2173,    -1,    -1}},
+    {0x1E8314, {   -1,    -1,  2324,    -1,    -1}},
+    {0x1E8320, {   -1,    -1,  2752,    -1,    -1}},
+    {0x1E8322, {   -1,    -1,  2907,    -1,    -1}},
+    {0x1E8330, {   -1,    -1,  3275,    -1,    -1}},
+    {0x1E8332, {   -1,    -1,  3363,    -1,    -1}},
+    {0x1E8400, {   -1,    -1,   445,    -1,    -1}},
+    {0x1E8401, { 1715,    -1,    -1,    -1,    -1}},
+    {0x1E8402, {   -1,    -1,   798,    -1,    -1}},
+    {0x1E8404, {   -1,    -1,  1031,    -1,    -1}},
+    {0x1E8406, {   -1,    -1,  1204,    -1,    -1}},
+    {0x1E8408, {   -1,    -1,  1347,    -1,    -1}},
+    {0x1E840A, {   -1,    -1,  1469,    -1,    -1}},
+    {0x1E8410, {   -1,    -1,  2009,    -1,    -1}},
+    {0x1E8412, {   -1,    -1,  2230,    -1,    -1}},
+    {0x1E8414, {   -1,    -1,  2355,    -1,    -1}},
+    {0x1E8418, {   -1,    -1,  2504,    -1,    -1}},
+    {0x1E841C, {   -1,    -1,  2578,    -1,    -1}},
+    {0x1E8420, {   -1,    -1,  2816,    -1,    -1}},
+    {0x1E8422, {   -1,    -1,  2939,    -1,    -1}},
+    {0x1E8430, {   -1,    -1,  3310,    -1,    -1}},
+    {0x1E8432, {   -1,    -1,  3378,    -1,    -1}},
+    {0x1E8434, {   -1,    -1,  3423,    -1,    -1}},
+    {0x1E8440, {   -1,    -1,  3593,    -1,    -1}},
+    {0x1E8442, {   -1,    -1,  3636,    -1,    -1}},
+    {0x1E8446, {   -1,    -1,  3673,    -1,    -1}},
+    {0x1E8448, {   -1,    -1,  3688,    -1,    -1}},
+    {0x1E844A, {   -1,    -1,  3699,    -1,    -1}},
+    {0x1E844C, {   -1,    -1,  3707,    -1,    -1}},
+    {0x1E8501, { 1764,    -1,    -1,    -1,    -1}},
+    {0x1E8601, { 1810,    -1,    -1,    -1,    -1}},
+    {0x1E8701, { 1857,    -1,    -1,    -1,    -1}},
+    {0x1E8901, { 1904,    -1,  4305,    -1,    -1}},
+    {0x1E8907, {   -1,    -1,  7220,    -1,    -1}},
+    {0x1E8909, {   -1,    -1,  8808,    -1,    -1}},
+    {0x1E8B01, {   -1,    -1,  4444,    -1,    -1}},
+    {0x1E8B07, {   -1,    -1,  7340,    -1,    -1}},
+    {0x1E8B09, {   -1,    -1,  8947,    -1,    -1}},
+    {0x1E8D01, {   -1,    -1,  4544,    -1,    -1}},
+    {0x1E8D09, {   -1,    -1,  9047,    -1,    -1}},
+    {0x1E8E00, {   38,    -1,    -1,    -1,    -1}},
+    {0x1E9101, { 1956,    -1,    -1,    -1,    -1}},
+    {0x1E9103, { 1423,    -1,    -1,    -1,    -1}},
+    {0x1E9200, {   59,    -1,    -1,    -1,    -1}},
+    {0x1E9203, { 1462,    -1,    -1,    -1,    -1}},
+    {0x1E9807, {   -1,    -1,  7406,    -1,    -1}},
+    {0x1E9901, {   -1,    -1,  4690,    -1,    -1}},
+    {0x1E9907, {   -1,    -1,  7447,    -1,    -1}},
+    {0x1E9909, {   -1,    -1,  9193,    -1,    -1}},
+    {0x1E9A01, { 2044,    -1,    -1,    -1,    -1}},
+    {0x1E9A07, {   -1,    -1,  7488,    -1,    -1}},
+    {0x1E9B01, {   -1,    -1,  4775,    -1,    -1}},
+    {0x1E9B07, {   -1,    -1,  7529,    -1,    -1}},
+    {0x1E9B09, {   -1,    -1,  9278,    -1,    -1}},
+    {0x1E9C01, { 2117,    -1,  4816,    -1,    -1}},
+    {0x1E9C07, {   -1,    -1,  7570,    -1,    -1}},
+    {0x1E9C09, {   -1,    -1,  9319,    -1,    -1}},
+    {0x1E9D01, { 2161,    -1,  4857,    -1,    -1}},
+    {0x1E9D07, {   -1,    -1,  7611,    -1,    -1}},
+    {0x1E9D09, {   -1,    -1,  9360,    -1,    -1}},
+    {0x1E9E01, { 2206,    -1,    -1,    -1,    -1}},
+    {0x1E9E07, {   -1,    -1,  7652,    -1,    -1}},
+    {0x1E9F01, { 2255,    -1,    -1,    -1,    -1}},
+    {0x1EA001, {   -1,    -1,  4966,    -1,    -1}},
+    {0x1EA007, {   -1,    -1,  7724,    -1,    -1}},
+    {0x1EA009, {   -1,    -1,  9469,    -1,    -1}},
+    {0x1EA101, { 2302,    -1,    -1,    -1,    -1}},
+    {0x1EA300, {  152,    -1,    -1,    -1,    -1}},
+    {0x1EA400, {  160,    -1,    -1,    -1,    -1}},
+    {0x1EA700, {  171,    -1,    -1,    -1,    -1}},
+    {0x1EA800, {  205,    -1,    -1,    -1,    -1}},
+    {0x1EA801, {   -1,    -1,  5134,    -1,    -1}},
+    {0x1EA809, {   -1,    -1,  9637,    -1,    -1}},
+    {0x1EA900, {  235,    -1,    -1,    -1,    -1}},
+    {0x1EAA00, {  246,    -1,    -1,    -1,    -1}},
+    {0x1EB001, {   -1,    -1,  5330,    -1,    -1}},
+    {0x1EB007, {   -1,    -1,  7866,    -1,    -1}},
+    {0x1EB009, {   -1,    -1,  9833,    -1,    -1}},
+    {0x1EB101, {   -1,    -1,  5411,    -1,    -1}},
+    {0x1EB105, {   -1,    -1,  6759,    -1,    -1}},
+    {0x1EB107, {   -1,    -1,  7947,    -1,    -1}},
+    {0x1EB109, {   -1,    -1,  9914,    -1,    -1}},
+    {0x1EB201, {   -1,    -1,  5486,    -1,    -1}},
+    {0x1EB205, {   -1,    -1,  6819,    -1,    -1}},
+    {0x1EB207, {   -1,    -1,  8022,    -1,    -1}},
+    {0x1EB209, {   -1,    -1,  9989,    -1,    -1}},
+    {0x1EB301, {   -1,    -1,  5573,    -1,    -1}},
+    {0x1EB309, {   -1,    -1, 10076,    -1,    -1}},
+    {0x1EB400, {  273,    -1,    -1,    -1,    -1}},
+    {0x1EB401, {   -1,    -1,  5660,    -1,    -1}},
+    {0x1EB407, {   -1,    -1,  8109,    -1,    -1}},
+    {0x1EB409, {   -1,    -1, 10163,    -1,    -1}},
+    {0x1EB500, {  274,    -1,    -1,    -1,    -1}},
+    {0x1EB501, {   -1,    -1,  5719,    -1,    -1}},
+    {0x1EB507, {   -1,    -1,  8166,    -1,    -1}},
+    {0x1EB509, {   -1,    -1, 10222,    -1,    -1}},
+    {0x1EB600, {  275,    -1,    -1,    -1,    -1}},
+    {0x1EB601, {   -1,    -1,  5780,    -1,    -1}},
+    {0x1EB609, {   -1,    -1, 10283,    -1,    -1}},
+    {0x1EB801, {   -1,   195,  5848,    -1,    -1}},
+    {0x1EB803, {   -1,    -1,  6432,    -1,    -1}},
+    {0x1EB805, {   -1,    -1,  6880,    -1,    -1}},
+    {0x1EB807, {   -1,    -1,  8242,    -1,    -1}},
+    {0x1EB809, {   -1,    -1, 10351,    -1,    -1}},
+    {0x1EB8F1, {   -1,    -1,    -1,   414,    -1}},
+    {0x1EB901, {   -1,    -1,  5909,    -1,    -1}},
+    {0x1EB905, {   -1,    -1,  6935,    -1,    -1}},
+    {0x1EB907, {   -1,    -1,  8303,    -1,    -1}},
+    {0x1EB909, {   -1,    -1, 10412,    -1,    -1}},
+    {0x1EBA01, {   -1,    -1,  5962,    -1,    -1}},
+    {0x1EBA07, {   -1,    -1,  8356,    -1,    -1}},
+    {0x1EBA09, {   -1,    -1, 10465,    -1,    -1}},
+    {0x1EBB01, {   -1,    -1,  6037,    -1,    -1}},
+    {0x1EBB09, {   -1,    -1, 10540,    -1,    -1}},
+    {0x1EBC01, {   -1,    -1,  6126,    -1,    -1}},
+    {0x1EBC09, {   -1,    -1, 10629,    -1,    -1}},
+    {0x1EBD01, {   -1,    -1,  6181,    -1,    -1}},
+    {0x1EBD09, {   -1,    -1, 10684,    -1,    -1}},
+    {0x1EBE01, {   -1,    -1,  6238,    -1,    -1}},
+    {0x1EBE09, {   -1,    -1, 10741,    -1,    -1}},
+    {0x1EC000, {  326,    -1,    -1,    -1,    -1}},
+    {0x1EC001, { 2463,    -1,    -1,    -1,    -1}},
+    {0x1EC100, {  416,    -1,    -1,    -1,    -1}},
+    {0x1EC101, { 2512,    -1,    -1,    -1,    -1}},
+    {0x1EC200, {  492,    -1,    -1,    -1,    -1}},
+    {0x1EC201, { 2560,    -1,    -1,    -1,    -1}},
+    {0x1EC300, {  557,    -1,    -1,    -1,    -1}},
+    {0x1EC400, {  600,    -1,    -1,    -1,    -1}},
+    {0x1EC500, {  633,    -1,    -1,    -1,    -1}},
+    {0x1EC600, {  663,    -1,    -1,    -1,    -1}},
+    {0x1EC700, {  689,    -1,    -1,    -1,    -1}},
+    {0x1EC800, {  711,    -1,    -1,    -1,    -1}},
+    {0x1EC900, {  729,    -1,    -1,    -1,    -1}},
+    {0x1ECA00, {  747,    -1,    -1,    -1,    -1}},
+    {0x1ECB00, {  762,    -1,    -1,    -1,    -1}},
+    {0x1ECC00, {  774,    -1,    -1,    -1,    -1}},
+    {0x1ECD00, {  784,    -1,    -1,    -1,    -1}},
+    {0x1ECE00, {  793,    -1,    -1,    -1,    -1}},
+    {0x1EFE00, {  966,    -1,    -1,    -1,    -1}},
+    {0x1EFF00, { 1094,    -1,    -1,    -1,    -1}},
+    {0x1EFF01, { 2639,    -1,    -1,    -1,    -1}},
+    {0x1EFF03, {   -1,    -1,  6476,    -1,    -1}},
+    {0x1F0000, {   -1,    -1,    -1,    -1,    62}},
+    {0x1F0001, { 1557,    -1,    -1,    -1,   155}},
+    {0x1F0002, {   -1,    -1,   556,    -1,    -1}},
+    {0x1F0003, {   -1,    -1,  6309,    -1,    -1}},
+    {0x1F0004, {   -1,    -1,   880,    -1,    -1}},
+    {0x1F0005, {   -1,    -1,  6560,    -1,    -1}},
+    {0x1F0006, {   -1,    -1,  1091,    -1,    -1}},
+    {0x1F0007, {   -1,    -1,  7023,    -1,    -1}},
+    {0x1F0008, {   -1,    -1,  1257,    -1,    -1}},
+    {0x1F0009, {   -1,    -1,  8449,    -1,    -1}},
+    {0x1F000A, {   -1,    -1,  1394,    -1,    -1}},
+    {0x1F0010, {   -1,    67,  1703,    -1,    -1}},
+    {0x1F0012, {   -1,    -1,  2092,    -1,    -1}},
+    {0x1F0014, {   -1,    -1,  2286,    -1,    -1}},
+    {0x1F0020, {   -1,    90,  2648,    -1,    -1}},
+    {0x1F0022, {   -1,    -1,  2865,    -1,    -1}},
+    {0x1F0024, {   -1,    -1,  2973,    -1,    -1}},
+    {0x1F0026, {   -1,    -1,  3038,    -1,    -1}},
+    {0x1F00F1, {   -1,    -1,    -1,   291,    -1}},
+    {0x1F00F2, {   -1,    -1,    -1,    62,    -1}},
+    {0x1F0100, {   -1,    -1,    62,    -1,    -1}},
+    {0x1F0101, {   -1,    -1,  4066,    -1,    -1}},
+    {0x1F0103, { 1363,    -1,    -1,    -1,    -1}},
+    {0x1F0109, {   -1,    -1,  8569,    -1,    -1}},
+    {0x1F0110, {   -1,    -1,  1782,    -1,    -1}},
+    {0x1F0120, {   -1,    -1,  2688,    -1,    -1}},
+    {0x1F01F2, {   -1,    -1,    -1,   168,    -1}},
+    {0x1F01FC, {   -1,    -1,  3876,    -1,    -1}},
+    {0x1F01FE, {   -1,    -1,  3940,    -1,    -1}},
+    {0x1F0200, {   -1,    -1,   190,    -1,    -1}},
+    {0x1F0201, { 1596,    -1,  4167,    -1,    -1}},
+    {0x1F0202, {   -1,    -1,   641,    -1,    -1}},
+    {0x1F0209, {   -1,    -1,  8670,    -1,    -1}},
+    {0x1F0210, {   -1,    -1,  1830,    -1,    -1}},
+    {0x1F0212, {   -1,    -1,  2143,    -1,    -1}},
+    {0x1F0220, {   -1,    -1,  2709,    -1,    -1}},
+    {0x1F02F2, {   -1,    -1,    -1,   210,    -1}},
+    {0x1F0300, {   -1,    -1,   318,    -1,    -1}},
+    {0x1F0301, { 1656,    -1,    -1,    -1,    -1}},
+    {0x1F0302, {   -1,    -1,   708,    -1,    -1}},
+    {0x1F0304, {   -1,    -1,   969,    -1,    -1}},
+    {0x1F0306, {   -1,    -1,  1159,    -1,    -1}},
+    {0x1F0308, {   -1,    -1,  1313,    -1,    -1}},
+    {0x1F0310, {   -1,    -1,  1906,    -1,    -1}},
+    {0x1F0312, {   -1,    -1,  2174,    -1,    -1}},
+    {0x1F0320, {   -1,    -1,  2753,    -1,    -1}},
+    {0x1F0322, {   -1,    -1,  2908,    -1,    -1}},
+    {0x1F03F2, {   -1,    -1,    -1,   233,    -1}},
+    {0x1F0400, {   -1,    -1,   446,    -1,    -1}},
+    {0x1F0401, { 1716,    -1,    -1,    -1,    -1}},
+    {0x1F0402, {   -1,    -1,   799,    -1,    -1}},
+    {0x1F0404, {   -1,    -1,  1032,    -1,    -1}},
+    {0x1F0406, {   -1,    -1,  1205,    -1,    -1}},
+    {0x1F0408, {   -1,    -1,  1348,    -1,    -1}},
+    {0x1F040A, {   -1,    -1,  1470,    -1,    -1}},
+    {0x1F0410, {   -1,    -1,  2010,    -1,    -1}},
+    {0x1F0412, {   -1,    -1,  2231,    -1,    -1}},
+    {0x1F0414, {   -1,    -1,  2356,    -1,    -1}},
+    {0x1F0420, {   -1,    -1,  2817,    -1,    -1}},
+    {0x1F0422, {   -1,    -1,  2940,    -1,    -1}},
+    {0x1F0424, {   -1,    -1,  3017,    -1,    -1}},
+    {0x1F0426, {   -1,    -1,  3069,    -1,    -1}},
+    {0x1F0501, { 1765,    -1,    -1,    -1,    -1}},
+    {0x1F0601, { 1811,    -1,    -1,    -1,    -1}},
+    {0x1F0701, { 1858,    -1,    -1,    -1,    -1}},
+    {0x1F0901, { 1905,    -1,  4306,    -1,    -1}},
+    {0x1F0907, {   -1,    -1,  7221,    -1,    -1}},
+    {0x1F0909, {   -1,    -1,  8809,    -1,    -1}},
+    {0x1F0B01, {   -1,    -1,  4445,    -1,    -1}},
+    {0x1F0B07, {   -1,    -1,  7341,    -1,    -1}},
+    {0x1F0B09, {   -1,    -1,  8948,    -1,    -1}},
+    {0x1F0C00, {   35,    -1,    -1,    -1,    -1}},
+    {0x1F0D01, {   -1,    -1,  4545,    -1,    -1}},
+    {0x1F0D09, {   -1,    -1,  9048,    -1,    -1}},
+    {0x1F1101, { 1957,    -1,    -1,    -1,    -1}},
+    {0x1F1103, { 1424,    -1,    -1,    -1,    -1}},
+    {0x1F1203, { 1463,    -1,    -1,    -1,    -1}},
+    {0x1F1400, {   73,    -1,    -1,    -1,    -1}},
+    {0x1F1800, {   85,    -1,    -1,    -1,    -1}},
+    {0x1F1807, {   -1,    -1,  7407,    -1,    -1}},
+    {0x1F1901, { 2004,   136,  4691,    -1,    -1}},
+    {0x1F1903, {   -1,    -1,  6373,    -1,    -1}},
+    {0x1F1905, {   -1,    -1,  6650,    -1,    -1}},
+    {0x1F1907, {   -1,    -1,  7448,    -1,    -1}},
+    {0x1F1909, {   -1,    -1,  9194,    -1,    -1}},
+    {0x1F19F1, {   -1,    -1,    -1,   355,    -1}},
+    {0x1F1A01, { 2045,    -1,    -1,    -1,    -1}},
+    {0x1F1A07, {   -1,    -1,  7489,    -1,    -1}},
+    {0x1F1B00, {   97,    -1,    -1,    -1,    -1}},
+    {0x1F1B01, { 2079,    -1,  4776,    -1,    -1}},
+    {0x1F1B07, {   -1,    -1,  7530,    -1,    -1}},
+    {0x1F1B09, {   -1,    -1,  9279,    -1,    -1}},
+    {0x1F1C01, { 2118,    -1,  4817,    -1,    -1}},
+    {0x1F1C07, {   -1,    -1,  7571,    -1,    -1}},
+    {0x1F1C09, {   -1,    -1,  9320,    -1,    -1}},
+    {0x1F1D00, {  105,    -1,    -1,    -1,    -1}},
+    {0x1F1D01, { 2162,    -1,  4858,    -1,    -1}},
+    {0x1F1D07, {   -1,    -1,  7612,    -1,    -1}},
+    {0x1F1D09, {   -1,    -1,  9361,    -1,    -1}},
+    {0x1F1E01, { 2207,    -1,    -1,    -1,    -1}},
+    {0x1F1E07, {   -1,    -1,  7653,    -1,    -1}},
+    {0x1F1F01, { 2256,    -1,    -1,    -1,    -1}},
+    {0x1F2000, {  129,    -1,    -1,    -1,    -1}},
+    {0x1F2001, {   -1,    -1,  4967,    -1,    -1}},
+    {0x1F2007, {   -1,    -1,  7725,    -1,    -1}},
+    {0x1F2009, {   -1,    -1,  9470,    -1,    -1}},
+    {0x1F2101, { 2303,    -1,    -1,    -1,    -1}},
+    {0x1F2800, {  206,    -1,    -1,    -1,    -1}},
+    {0x1F2801, {   -1,    -1,  5135,    -1,    -1}},
+    {0x1F2809, {   -1,    -1,  9638,    -1,    -1}},
+    {0x1F2901, { 2350,    -1,    -1,    -1,    -1}},
+    {0x1F2D00, {  266,    -1,    -1,    -1,    -1}},
+    {0x1F3001, {   -1,    -1,  5331,    -1,    -1}},
+    {0x1F3007, {   -1,    -1,  7867,    -1,    -1}},
+    {0x1F3009, {   -1,    -1,  9834,    -1,    -1}},
+    {0x1F3101, {   -1,    -1,  5412,    -1,    -1}},
+    {0x1F3105, {   -1,    -1,  6760,    -1,    -1}},
+    {0x1F3107, {   -1,    -1,  7948,    -1,    -1}},
+    {0x1F3109, {   -1,    -1,  9915,    -1,    -1}},
+    {0x1F3201, {   -1,    -1,  5487,    -1,    -1}},
+    {0x1F3205, {   -1,    -1,  6820,    -1,    -1}},
+    {0x1F3207, {   -1,    -1,  8023,    -1,    -1}},
+    {0x1F3209, {   -1,    -1,  9990,    -1,    -1}},
+    {0x1F3301, {   -1,    -1,  5574,    -1,    -1}},
+    {0x1F3309, {   -1,    -1, 10077,    -1,    -1}},
+    {0x1F3401, {   -1,    -1,  5661,    -1,    -1}},
+    {0x1F3407, {   -1,    -1,  8110,    -1,    -1}},
+    {0x1F3409, {   -1,    -1, 10164,    -1,    -1}},
+    {0x1F3501, {   -1,    -1,  5720,    -1,    -1}},
+    {0x1F3507, {   -1,    -1,  8167,    -1,    -1}},
+    {0x1F3509, {   -1,    -1, 10223,    -1,    -1}},
+    {0x1F3601, {   -1,    -1,  5781,    -1,    -1}},
+    {0x1F3609, {   -1,    -1, 10284,    -1,    -1}},
+    {0x1F3801, {   -1,   196,  5849,    -1,    -1}},
+    {0x1F3803, {   -1,    -1,  6433,    -1,    -1}},
+    {0x1F3805, {   -1,    -1,  6881,    -1,    -1}},
+    {0x1F3807, {   -1,    -1,  8243,    -1,    -1}},
+    {0x1F3809, {   -1,    -1, 10352,    -1,    -1}},
+    {0x1F38F1, {   -1,    -1,    -1,   415,    -1}},
+    {0x1F3901, {   -1,    -1,  5910,    -1,    -1}},
+    {0x1F3905, {   -1,    -1,  6936,    -1,    -1}},
+    {0x1F3907, {   -1,    -1,  8304,    -1,    -1}},
+    {0x1F3909, {   -1,    -1, 10413,    -1,    -1}},
+    {0x1F3A01, {   -1,    -1,  5963,    -1,    -1}},
+    {0x1F3A07, {   -1,    -1,  8357,    -1,    -1}},
+    {0x1F3A09, {   -1,    -1, 10466,    -1,    -1}},
+    {0x1F3B01, {   -1,    -1,  6038,    -1,    -1}},
+    {0x1F3B09, {   -1,    -1, 10541,    -1,    -1}},
+    {0x1F3C01, {   -1,    -1,  6127,    -1,    -1}},
+    {0x1F3C09, {   -1,    -1, 10630,    -1,    -1}},
+    {0x1F3D01, {   -1,    -1,  6182,    -1,    -1}},
+    {0x1F3D09, {   -1,    -1, 10685,    -1,    -1}},
+    {0x1F3E01, {   -1,    -1,  6239,    -1,    -1}},
+    {0x1F3E09, {   -1,    -1, 10742,    -1,    -1}},
+    {0x1F4000, {  327,    -1,    -1,    -1,    -1}},
+    {0x1F4001, { 2464,    -1,    -1,    -1,    -1}},
+    {0x1F4100, {  417,    -1,    -1,    -1,    -1}},
+    {0x1F4101, { 2513,    -1,    -1,    -1,    -1}},
+    {0x1F4200, {  493,    -1,    -1,    -1,    -1}},
+    {0x1F4201, { 2561,    -1,    -1,    -1,    -1}},
+    {0x1F4300, {  558,    -1,    -1,    -1,    -1}},
+    {0x1F4400, {  601,    -1,    -1,    -1,    -1}},
+    {0x1F4500, {  634,    -1,    -1,    -1,    -1}},
+    {0x1F4600, {  664,    -1,    -1,    -1,    -1}},
+    {0x1F4700, {  690,    -1,    -1,    -1,    -1}},
+    {0x1F7E00, {  967,    -1,    -1,    -1,    -1}},
+    {0x1F7E01, { 2588,    -1,    -1,    -1,    -1}},
+    {0x1F7F00, { 1095,    -1,    -1,    -1,    -1}},
+    {0x1F7F01, { 2640,    -1,    -1,    -1,    -1}},
+    {0x1F7F03, {   -1,    -1,  6477,    -1,    -1}},
+    {0x1F8000, {   -1,    -1,    -1,    -1,    63}},
+    {0x1F8001, { 1558,    -1,    -1,    -1,   156}},
+    {0x1F8002, {   -1,    -1,   557,    -1,    -1}},
+    {0x1F8003, {   -1,    -1,  6310,    -1,    -1}},
+    {0x1F8004, {   -1,    -1,   881,    -1,    -1}},
+    {0x1F8005, {   -1,    -1,  6561,    -1,    -1}},
+    {0x1F8006, {   -1,    -1,  1092,    -1,    -1}},
+    {0x1F8007, {   -1,    -1,  7024,    -1,    -1}},
+    {0x1F8008, {   -1,    -1,  1258,    -1,    -1}},
+    {0x1F8009, {   -1,    -1,  8450,    -1,    -1}},
+    {0x1F800A, {   -1,    -1,  1395,    -1,    -1}},
+    {0x1F800C, {   -1,    -1,  1508,    -1,    -1}},
+    {0x1F8010, {   -1,    68,  1704,    -1,    -1}},
+    {0x1F8012, {   -1,    -1,  2093,    -1,    -1}},
+    {0x1F8014, {   -1,    -1,  2287,    -1,    -1}},
+    {0x1F8016, {   -1,    -1,  2391,    -1,    -1}},
+    {0x1F8018, {   -1,    -1,  2471,    -1,    -1}},
+    {0x1F8020, {   -1,    91,  2649,    -1,    -1}},
+    {0x1F8022, {   -1,    -1,  2866,    -1,    -1}},
+    {0x1F80F1, {   -1,    -1,    -1,   292,    -1}},
+    {0x1F80F2, {   -1,    -1,    -1,    63,    -1}},
+    {0x1F8100, {   -1,    -1,    63,    -1,    -1}},
+    {0x1F8101, {   -1,    -1,  4067,    -1,    -1}},
+    {0x1F8103, { 1364,    -1,    -1,    -1,    -1}},
+    {0x1F8109, {   -1,    -1,  8570,    -1,    -1}},
+    {0x1F8110, {   -1,    -1,  1783,    -1,    -1}},
+    {0x1F8120, {   -1,    -1,  2689,    -1,    -1}},
+    {0x1F81F2, {   -1,    -1,    -1,   169,    -1}},
+    {0x1F81FC, {   -1,    -1,  3877,    -1,    -1}},
+    {0x1F81FE, {   -1,    -1,  3941,    -1,    -1}},
+    {0x1F8200, {   -1,    -1,   191,    -1,    -1}},
+    {0x1F8201, { 1597,    -1,  4168,    -1,    -1}},
+    {0x1F8202, {   -1,    -1,   642,    -1,    -1}},
+    {0x1F8209, {   -1,    -1,  8671,    -1,    -1}},
+    {0x1F8210, {   -1,    -1,  1831,    -1,    -1}},
+    {0x1F8220, {   -1,    -1,  2710,    -1,    -1}},
+    {0x1F8222, {   -1,    -1,  2891,    -1,    -1}},
+    {0x1F82F2, {   -1,    -1,    -1,   211,    -1}},
+    {0x1F8300, {   -1,    -1,   319,    -1,    -1}},
+    {0x1F8301, { 1657,    -1,    -1,    -1,    -1}},
+    {0x1F8302, {   -1,    -1,   709,    -1,    -1}},
+    {0x1F8304, {   -1,    -1,   970,    -1,    -1}},
+    {0x1F8310, {   -1,    -1,  1907,    -1,    -1}},
+    {0x1F8312, {   -1,    -1,  2175,    -1,    -1}},
+    {0x1F8314, {   -1,    -1,  2325,    -1,    -1}},
+    {0x1F8320, {   -1,    -1,  2754,    -1,    -1}},
+    {0x1F8322, {   -1,    -1,  2909,    -1,    -1}},
+    {0x1F8400, {   -1,    -1,   447,    -1,    -1}},
+    {0x1F8401, { 1717,    -1,    -1,    -1,    -1}},
+    {0x1F8402, {   -1,    -1,   800,    -1,    -1}},
+    {0x1F8404, {   -1,    -1,  1033,    -1,    -1}},
+    {0x1F8406, {   -1,    -1,  1206,    -1,    -1}},
+    {0x1F8408, {   -1,    -1,  1349,    -1,    -1}},
+    {0x1F840A, {   -1,    -1,  1471,    -1,    -1}},
+    {0x1F840C, {   -1,    -1,  1562,    -1,    -1}},
+    {0x1F8410, {   -1,    -1,  2011,    -1,    -1}},
+    {0x1F8412, {   -1,    -1,  2232,    -1,    -1}},
+    {0x1F8414, {   -1,    -1,  2357,    -1,    -1}},
+    {0x1F8416, {   -1,    -1,  2439,    -1,    -1}},
+    {0x1F8418, {   -1,    -1,  2505,    -1,    -1}},
+    {0x1F8420, {   -1,    -1,  2818,    -1,    -1}},
+    {0x1F8422, {   -1,    -1,  2941,    -1,    -1}},
+    {0x1F8501, { 1766,    -1,    -1,    -1,    -1}},
+    {0x1F8601, { 1812,    -1,    -1,    -1,    -1}},
+    {0x1F8701, { 1859,    -1,    -1,    -1,    -1}},
+    {0x1F8901, { 1906,    -1,  4307,    -1,    -1}},
+    {0x1F8907, {   -1,    -1,  7222,    -1,    -1}},
+    {0x1F8909, {   -1,    -1,  8810,    -1,    -1}},
+    {0x1F8B01, {   -1,    -1,  4446,    -1,    -1}},
+    {0x1F8B07, {   -1,    -1,  7342,    -1,    -1}},
+    {0x1F8B09, {   -1,    -1,  8949,    -1,    -1}},
+    {0x1F8D01, {   -1,    -1,  4546,    -1,    -1}},
+    {0x1F8D09, {   -1,    -1,  9049,    -1,    -1}},
+    {0x1F9101, { 1958,    -1,    -1,    -1,    -1}},
+    {0x1F9103, { 1425,    -1,    -1,    -1,    -1}},
+    {0x1F9200, {   60,    -1,    -1,    -1,    -1}},
+    {0x1F9203, { 1464,    -1,    -1,    -1,    -1}},
+    {0x1F9807, {   -1,    -1,  7408,    -1,    -1}},
+    {0x1F9901, { 2005,   137,  4692,    -1,    -1}},
+    {0x1F9903, {   -1,    -1,  6374,    -1,    -1}},
+    {0x1F9905, {   -1,    -1,  6651,    -1,    -1}},
+    {0x1F9907, {   -1,    -1,  7449,    -1,    -1}},
+    {0x1F9909, {   -1,    -1,  9195,    -1,    -1}},
+    {0x1F99F1, {   -1,    -1,    -1,   356,    -1}},
+    {0x1F9A01, { 2046,    -1,    -1,    -1,    -1}},
+    {0x1F9A07, {   -1,    -1,  7490,    -1,    -1}},
+    {0x1F9B01, { 2080,    -1,  4777,    -1,    -1}},
+    {0x1F9B07, {   -1,    -1,  7531,    -1,    -1}},
+    {0x1F9B09, {   -1,    -1,  9280,    -1,    -1}},
+    {0x1F9C01, { 2119,    -1,  4818,    -1,    -1}},
+    {0x1F9C07, {   -1,    -1,  7572,    -1,    -1}},
+    {0x1F9C09, {   -1,    -1,  9321,    -1,    -1}},
+    {0x1F9D01, { 2163,    -1,  4859,    -1,    -1}},
+    {0x1F9D07, {   -1,    -1,  7613,    -1,    -1}},
+    {0x1F9D09, {   -1,    -1,  9362,    -1,    -1}},
+    {0x1F9E01, { 2208,    -1,    -1,    -1,    -1}},
+    {0x1F9E07, {   -1,    -1,  7654,    -1,    -1}},
+    {0x1F9F01, { 2257,    -1,    -1,    -1,    -1}},
+    {0x1FA001, {   -1,    -1,  4968,    -1,    -1}},
+    {0x1FA007, {   -1,    -1,  7726,    -1,    -1}},
+    {0x1FA009, {   -1,    -1,  9471,    -1,    -1}},
+    {0x1FA101, { 2304,    -1,    -1,    -1,    -1}},
+    {0x1FA800, {  207,    -1,    -1,    -1,    -1}},
+    {0x1FA801, {   -1,    -1,  5136,    -1,    -1}},
+    {0x1FA809, {   -1,    -1,  9639,    -1,    -1}},
+    {0x1FA900, {  236,    -1,    -1,    -1,    -1}},
+    {0x1FA901, { 2351,    -1,    -1,    -1,    -1}},
+    {0x1FAA00, {  247,    -1,    -1,    -1,    -1}},
+    {0x1FAD00, {  267,    -1,    -1,    -1,    -1}},
+    {0x1FB001, {   -1,    -1,  5332,    -1,    -1}},
+    {0x1FB007, {   -1,    -1,  7868,    -1,    -1}},
+    {0x1FB009, {   -1,    -1,  9835,    -1,    -1}},
+    {0x1FB101, {   -1,    -1,  5413,    -1,    -1}},
+    {0x1FB105, {   -1,    -1,  6761,    -1,    -1}},
+    {0x1FB107, {   -1,    -1,  7949,    -1,    -1}},
+    {0x1FB109, {   -1,    -1,  9916,    -1,    -1}},
+    {0x1FB201, {   -1,    -1,  5488,    -1,    -1}},
+    {0x1FB205, {   -1,    -1,  6821,    -1,    -1}},
+    {0x1FB207, {   -1,    -1,  8024,    -1,    -1}},
+    {0x1FB209, {   -1,    -1,  9991,    -1,    -1}},
+    {0x1FB301, {   -1,    -1,  5575,    -1,    -1}},
+    {0x1FB309, {   -1,    -1, 10078,    -1,    -1}},
+    {0x1FB401, {   -1,    -1,  5662,    -1,    -1}},
+    {0x1FB407, {   -1,    -1,  8111,    -1,    -1}},
+    {0x1FB409, {   -1,    -1, 10165,    -1,    -1}},
+    {0x1FB501, {   -1,    -1,  5721,    -1,    -1}},
+    {0x1FB507, {   -1,    -1,  8168,    -1,    -1}},
+    {0x1FB509, {   -1,    -1, 10224,    -1,    -1}},
+    {0x1FB601, {   -1,    -1,  5782,    -1,    -1}},
+    {0x1FB609, {   -1,    -1, 10285,    -1,    -1}},
+    {0x1FB801, {   -1,   197,  5850,    -1,    -1}},
+    {0x1FB803, {   -1,    -1,  6434,    -1,    -1}},
+    {0x1FB805, {   -1,    -1,  6882,    -1,    -1}},
+    {0x1FB807, {   -1,    -1,  8244,    -1,    -1}},
+    {0x1FB809, {   -1,    -1, 10353,    -1,    -1}},
+    {0x1FB8F1, {   -1,    -1,    -1,   416,    -1}},
+    {0x1FB901, {   -1,    -1,  5911,    -1,    -1}},
+    {0x1FB905, {   -1,    -1,  6937,    -1,    -1}},
+    {0x1FB907, {   -1,    -1,  8305,    -1,    -1}},
+    {0x1FB909, {   -1,    -1, 10414,    -1,    -1}},
+    {0x1FBA01, {   -1,    -1,  5964,    -1,    -1}},
+    {0x1FBA07, {   -1,    -1,  8358,    -1,    -1}},
+    {0x1FBA09, {   -1,    -1, 10467,    -1,    -1}},
+    {0x1FBB01, {   -1,    -1,  6039,    -1,    -1}},
+    {0x1FBB09, {   -1,    -1, 10542,    -1,    -1}},
+    {0x1FBC01, {   -1,    -1,  6128,    -1,    -1}},
+    {0x1FBC09, {   -1,    -1, 10631,    -1,    -1}},
+    {0x1FBD01, {   -1,    -1,  6183,    -1,    -1}},
+    {0x1FBD09, {   -1,    -1, 10686,    -1,    -1}},
+    {0x1FBE01, {   -1,    -1,  6240,    -1,    -1}},
+    {0x1FBE09, {   -1,    -1, 10743,    -1,    -1}},
+    {0x1FC000, {  328,    -1,    -1,    -1,    -1}},
+    {0x1FC001, { 2465,    -1,    -1,    -1,    -1}},
+    {0x1FC100, {  418,    -1,    -1,    -1,    -1}},
+    {0x1FC101, { 2514,    -1,    -1,    -1,    -1}},
+    {0x1FC200, {  494,    -1,    -1,    -1,    -1}},
+    {0x1FC201, { 2562,    -1,    -1,    -1,    -1}},
+    {0x1FFE00, {  968,    -1,    -1,    -1,    -1}},
+    {0x1FFE01, { 2589,    -1,    -1,    -1,    -1}},
+    {0x1FFF00, { 1096,    -1,    -1,    -1,    -1}},
+    {0x1FFF01, { 2641,    -1,    -1,    -1,    -1}},
+    {0x1FFF03, {   -1,    -1,  6478,    -1,    -1}},
+    {0x200000, {   -1,    -1,    -1,    -1,    64}},
+    {0x200001, { 1559,    -1,    -1,    -1,   157}},
+    {0x200003, {   -1,    -1,  6311,    -1,    -1}},
+    {0x200005, {   -1,    -1,  6562,    -1,    -1}},
+    {0x200007, {   -1,    -1,  7025,    -1,    -1}},
+    {0x200009, {   -1,    -1,  8451,    -1,    -1}},
+    {0x200010, {   -1,    -1,  1705,    -1,    -1}},
+    {0x200080, { 1286,    -1,    -1,    -1,    -1}},
+    {0x2000F1, {   -1,    -1,    -1,   293,    -1}},
+    {0x2000F2, {   -1,    -1,    -1,    64,    -1}},
+    {0x200100, {   -1,    -1,    64,    -1,    -1}},
+    {0x200101, {   -1,    -1,  4068,    -1,    -1}},
+    {0x200103, { 1365,    -1,    -1,    -1,    -1}},
+    {0x200109, {   -1,    -1,  8571,    -1,    -1}},
+    {0x2001FE, {   -1,    -1,  3942,    -1,    -1}},
+    {0x200200, {   -1,    -1,   192,    -1,    -1}},
+    {0x200201, { 1598,    -1,  4169,    -1,    -1}},
+    {0x200209, {   -1,    -1,  8672,    -1,    -1}},
+    {0x200300, {   -1,    -1,   320,    -1,    -1}},
+    {0x200301, { 1658,    -1,    -1,    -1,    -1}},
+    {0x200310, {   -1,    -1,  1908,    -1,    -1}},
+    {0x200400, {   -1,    -1,   448,    -1,    -1}},
+    {0x200401, { 1718,    -1,    -1,    -1,    -1}},
+    {0x200410, {   -1,    -1,  2012,    -1,    -1}},
+    {0x200501, { 1767,    -1,    -1,    -1,    -1}},
+    {0x200601, { 1813,    -1,    -1,    -1,    -1}},
+    {0x200701, { 1860,    -1,    -1,    -1,    -1}},
+    {0x200800, {   26,    -1,    -1,    -1,    -1}},
+    {0x200901, { 1907,    -1,  4308,    -1,    -1}},
+    {0x200907, {   -1,    -1,  7223,    -1,    -1}},
+    {0x200909, {   -1,    -1,  8811,    -1,    -1}},
+    {0x200B01, {   -1,    -1,  4447,    -1,    -1}},
+    {0x200B07, {   -1,    -1,  7343,    -1,    -1}},
+    {0x200B09, {   -1,    -1,  8950,    -1,    -1}},
+    {0x200D01, {   -1,    -1,  4547,    -1,    -1}},
+    {0x200D09, {   -1,    -1,  9050,    -1,    -1}},
+    {0x201101, { 1959,    -1,    -1,    -1,    -1}},
+    {0x201103, { 1426,    -1,    -1,    -1,    -1}},
+    {0x201203, { 1465,    -1,    -1,    -1,    -1}},
+    {0x201807, {   -1,    -1,  7409,    -1,    -1}},
+    {0x201901, { 2006,   138,  4693,    -1,    -1}},
+    {0x201903, {   -1,    -1,  6375,    -1,    -1}},
+    {0x201905, {   -1,    -1,  6652,    -1,    -1}},
+    {0x201907, {   -1,    -1,  7450,    -1,    -1}},
+    {0x201909, {   -1,    -1,  9196,    -1,    -1}},
+    {0x2019F1, {   -1,    -1,    -1,   357,    -1}},
+    {0x201A01, { 2047,    -1,    -1,    -1,    -1}},
+    {0x201A07, {   -1,    -1,  7491,    -1,    -1}},
+    {0x201B01, { 2081,    -1,  4778,    -1,    -1}},
+    {0x201B07, {   -1,    -1,  7532,    -1,    -1}},
+    {0x201B09, {   -1,    -1,  9281,    -1,    -1}},
+    {0x201C01, { 2120,    -1,  4819,    -1,    -1}},
+    {0x201C07, {   -1,    -1,  7573,    -1,    -1}},
+    {0x201C09, {   -1,    -1,  9322,    -1,    -1}},
+    {0x201D01, { 2164,    -1,  4860,    -1,    -1}},
+    {0x201D07, {   -1,    -1,  7614,    -1,    -1}},
+    {0x201D09, {   -1,    -1,  9363,    -1,    -1}},
+    {0x201E01, { 2209,    -1,    -1,    -1,    -1}},
+    {0x201E07, {   -1,    -1,  7655,    -1,    -1}},
+    {0x201F01, { 2258,    -1,    -1,    -1,    -1}},
+    {0x202001, {   -1,    -1,  4969,    -1,    -1}},
+    {0x202007, {   -1,    -1,  7727,    -1,    -1}},
+    {0x202009, {   -1,    -1,  9472,    -1,    -1}},
+    {0x202101, { 2305,    -1,    -1,    -1,    -1}},
+    {0x202801, {   -1,    -1,  5137,    -1,    -1}},
+    {0x202809, {   -1,    -1,  9640,    -1,    -1}},
+    {0x202901, { 2352,    -1,    -1,    -1,    -1}},
+    {0x203001, {   -1,    -1,  5333,    -1,    -1}},
+    {0x203007, {   -1,    -1,  7869,    -1,    -1}},
+    {0x203009, {   -1,    -1,  9836,    -1,    -1}},
+    {0x203101, {   -1,    -1,  5414,    -1,    -1}},
+    {0x203105, {   -1,    -1,  6762,    -1,    -1}},
+    {0x203107, {   -1,    -1,  7950,    -1,    -1}},
+    {0x203109, {   -1,    -1,  9917,    -1,    -1}},
+    {0x203201, {   -1,    -1,  5489,    -1,    -1}},
+    {0x203205, {   -1,    -1,  6822,    -1,    -1}},
+    {0x203207, {   -1,    -1,  8025,    -1,    -1}},
+    {0x203209, {   -1,    -1,  9992,    -1,    -1}},
+    {0x203301, {   -1,    -1,  5576,    -1,    -1}},
+    {0x203309, {   -1,    -1, 10079,    -1,    -1}},
+    {0x203401, {   -1,    -1,  5663,    -1,    -1}},
+    {0x203407, {   -1,    -1,  8112,    -1,    -1}},
+    {0x203409, {   -1,    -1, 10166,    -1,    -1}},
+    {0x203501, {   -1,    -1,  5722,    -1,    -1}},
+    {0x203507, {   -1,    -1,  8169,    -1,    -1}},
+    {0x203509, {   -1,    -1, 10225,    -1,    -1}},
+    {0x203601, {   -1,    -1,  5783,    -1,    -1}},
+    {0x203609, {   -1,    -1, 10286,    -1,    -1}},
+    {0x203801, {   -1,   198,  5851,    -1,    -1}},
+    {0x203803, {   -1,    -1,  6435,    -1,    -1}},
+    {0x203805, {   -1,    -1,  6883,    -1,    -1}},
+    {0x203807, {   -1,    -1,  8245,    -1,    -1}},
+    {0x203809, {   -1,    -1, 10354,    -1,    -1}},
+    {0x2038F1, {   -1,    -1,    -1,   417,    -1}},
+    {0x203901, {   -1,    -1,  5912,    -1,    -1}},
+    {0x203905, {   -1,    -1,  6938,    -1,    -1}},
+    {0x203907, {   -1,    -1,  8306,    -1,    -1}},
+    {0x203909, {   -1,    -1, 10415,    -1,    -1}},
+    {0x203A01, {   -1,    -1,  5965,    -1,    -1}},
+    {0x203A07, {   -1,    -1,  8359,    -1,    -1}},
+    {0x203A09, {   -1,    -1, 10468,    -1,    -1}},
+    {0x203B01, {   -1,    -1,  6040,    -1,    -1}},
+    {0x203B09, {   -1,    -1, 10543,    -1,    -1}},
+    {0x203C01, {   -1,    -1,  6129,    -1,    -1}},
+    {0x203C09, {   -1,    -1, 10632,    -1,    -1}},
+    {0x203D01, {   -1,    -1,  6184,    -1,    -1}},
+    {0x203D09, {   -1,    -1, 10687,    -1,    -1}},
+    {0x203E01, {   -1,    -1,  6241,    -1,    -1}},
+    {0x203E09, {   -1,    -1, 10744,    -1,    -1}},
+    {0x204000, {  329,    -1,    -1,    -1,    -1}},
+    {0x204001, { 2466,    -1,    -1,    -1,    -1}},
+    {0x204100, {  419,    -1,    -1,    -1,    -1}},
+    {0x204101, { 2515,    -1,    -1,    -1,    -1}},
+    {0x204201, { 2563,    -1,    -1,    -1,    -1}},
+    {0x207E00, {  969,    -1,    -1,    -1,    -1}},
+    {0x207E01, { 2590,    -1,    -1,    -1,    -1}},
+    {0x207F00, { 1097,    -1,    -1,    -1,    -1}},
+    {0x207F01, { 2642,    -1,    -1,    -1,    -1}},
+    {0x207F03, {   -1,    -1,  6479,    -1,    -1}},
+    {0x208000, {   -1,    -1,    -1,    -1,    65}},
+    {0x208001, {   -1,    -1,    -1,    -1,   158}},
+    {0x208003, {   -1,    -1,  6312,    -1,    -1}},
+    {0x208005, {   -1,    -1,  6563,    -1,    -1}},
+    {0x208007, {   -1,    -1,  7026,    -1,    -1}},
+    {0x208009, {   -1,    -1,  8452,    -1,    -1}},
+    {0x208010, {   -1,    -1,  1706,    -1,    -1}},
+    {0x208012, {   -1,    -1,  2094,    -1,    -1}},
+    {0x208020, {   -1,    -1,  2650,    -1,    -1}},
+    {0x208022, {   -1,    -1,  2867,    -1,    -1}},
+    {0x208080, { 1287,    -1,    -1,    -1,    -1}},
+    {0x2080F1, {   -1,    -1,    -1,   294,    -1}},
+    {0x2080F2, {   -1,    -1,    -1,    65,    -1}},
+    {0x208100, {   -1,    -1,    65,    -1,    -1}},
+    {0x208101, {   -1,    -1,  4069,    -1,    -1}},
+    {0x208103, { 1366,    -1,    -1,    -1,    -1}},
+    {0x208109, {   -1,    -1,  8572,    -1,    -1}},
+    {0x2081FE, {   -1,    -1,  3943,    -1,    -1}},
+    {0x208200, {   -1,    -1,   193,    -1,    -1}},
+    {0x208201, { 1599,    -1,  4170,    -1,    -1}},
+    {0x208209, {   -1,    -1,  8673,    -1,    -1}},
+    {0x208210, {   -1,    -1,  1832,    -1,    -1}},
+    {0x208300, {   -1,    -1,   321,    -1,    -1}},
+    {0x208301, { 1659,    -1,    -1,    -1,    -1}},
+    {0x208310, {   -1,    -1,  1909,    -1,    -1}},
+    {0x208312, {   -1,    -1,  2176,    -1,    -1}},
+    {0x208320, {   -1,    -1,  2755,    -1,    -1}},
+    {0x208400, {   -1,    -1,   449,    -1,    -1}},
+    {0x208401, { 1719,    -1,    -1,    -1,    -1}},
+    {0x208410, {   -1,    -1,  2013,    -1,    -1}},
+    {0x208412, {   -1,    -1,  2233,    -1,    -1}},
+    {0x208420, {   -1,    -1,  2819,    -1,    -1}},
+    {0x208422, {   -1,    -1,  2942,    -1,    -1}},
+    {0x208501, { 1768,    -1,    -1,    -1,    -1}},
+    {0x208601, { 1814,    -1,    -1,    -1,    -1}},
+    {0x208701, { 1861,    -1,    -1,    -1,    -1}},
+    {0x208901, { 1908,    -1,  4309,    -1,    -1}},
+    {0x208907, {   -1,    -1,  7224,    -1,    -1}},
+    {0x208909, {   -1,    -1,  8812,    -1,    -1}},
+    {0x209101, { 1960,    -1,    -1,    -1,    -1}},
+    {0x209103, { 1427,    -1,    -1,    -1,    -1}},
+    {0x209200, {   61,    -1,    -1,    -1,    -1}},
+    {0x209203, { 1466,    -1,    -1,    -1,    -1}},
+    {0x209A01, { 2048,    -1,    -1,    -1,    -1}},
+    {0x209C01, { 2121,    -1,    -1,    -1,    -1}},
+    {0x209D01, { 2165,    -1,    -1,    -1,    -1}},
+    {0x209E01, { 2210,    -1,    -1,    -1,    -1}},
+    {0x209F01, { 2259,    -1,    -1,    -1,    -1}},
+    {0x20A001, {   -1,    -1,  4970,    -1,    -1}},
+    {0x20A007, {   -1,    -1,  7728,    -1,    -1}},
+    {0x20A009, {   -1,    -1,  9473,    -1,    -1}},
+    {0x20A101, { 2306,    -1,    -1,    -1,    -1}},
+    {0x20A800, {  208,    -1,    -1,    -1,    -1}},
+    {0x20A801, {   -1,    -1,  5138,    -1,    -1}},
+    {0x20A809, {   -1,    -1,  9641,    -1,    -1}},
+    {0x20AB00, {  257,    -1,    -1,    -1,    -1}},
+    {0x20B001, {   -1,    -1,  5334,    -1,    -1}},
+    {0x20B007, {   -1,    -1,  7870,    -1,    -1}},
+    {0x20B009, {   -1,    -1,  9837,    -1,    -1}},
+    {0x20B101, {   -1,    -1,  5415,    -1,    -1}},
+    {0x20B105, {   -1,    -1,  6763,    -1,    -1}},
+    {0x20B107, {   -1,    -1,  7951,    -1,    -1}},
+    {0x20B109, {   -1,    -1,  9918,    -1,    -1}},
+    {0x20B201, {   -1,    -1,  5490,    -1,    -1}},
+    {0x20B205, {   -1,    -1,  6823,    -1,    -1}},
+    {0x20B207, {   -1,    -1,  8026,    -1,    -1}},
+    {0x20B209, {   -1,    -1,  9993,    -1,    -1}},
+    {0x20B301, {   -1,    -1,  5577,    -1,    -1}},
+    {0x20B309, {   -1,    -1, 10080,    -1,    -1}},
+    {0x20B401, {   -1,    -1,  5664,    -1,    -1}},
+    {0x20B407, {   -1,    -1,  8113,    -1,    -1}},
+    {0x20B409, {   -1,    -1, 10167,    -1,    -1}},
+    {0x20B501, {   -1,    -1,  5723,    -1,    -1}},
+    {0x20B507, {   -1,    -1,  8170,    -1,    -1}},
+    {0x20B509, {   -1,    -1, 10226,    -1,    -1}},
+    {0x20B601, {   -1,    -1,  5784,    -1,    -1}},
+    {0x20B609, {   -1,    -1, 10287,    -1,    -1}},
+    {0x20B801, {   -1,   199,  5852,    -1,    -1}},
+    {0x20B803, {   -1,    -1,  6436,    -1,    -1}},
+    {0x20B805, {   -1,    -1,  6884,    -1,    -1}},
+    {0x20B807, {   -1,    -1,  8246,    -1,    -1}},
+    {0x20B809, {   -1,    -1, 10355,    -1,    -1}},
+    {0x20B8F1, {   -1,    -1,    -1,   418,    -1}},
+    {0x20B901, {   -1,    -1,  5913,    -1,    -1}},
+    {0x20B905, {   -1,    -1,  6939,    -1,    -1}},
+    {0x20B907, {   -1,    -1,  8307,    -1,    -1}},
+    {0x20B909, {   -1,    -1, 10416,    -1,    -1}},
+    {0x20BA01, {   -1,    -1,  5966,    -1,    -1}},
+    {0x20BA07, {   -1,    -1,  8360,    -1,    -1}},
+    {0x20BA09, {   -1,    -1, 10469,    -1,    -1}},
+    {0x20BB01, {   -1,    -1,  6041,    -1,    -1}},
+    {0x20BB09, {   -1,    -1, 10544,    -1,    -1}},
+    {0x20BC01, {   -1,    -1,  6130,    -1,    -1}},
+    {0x20BC09, {   -1,    -1, 10633,    -1,    -1}},
+    {0x20BD01, {   -1,    -1,  6185,    -1,    -1}},
+    {0x20BD09, {   -1,    -1, 10688,    -1,    -1}},
+    {0x20BE01, {   -1,    -1,  6242,    -1,    -1}},
+    {0x20BE09, {   -1,    -1, 10745,    -1,    -1}},
+    {0x20C000, {  330,    -1,    -1,    -1,    -1}},
+    {0x20C001, { 2467,    -1,    -1,    -1,    -1}},
+    {0x20C100, {  420,    -1,    -1,    -1,    -1}},
+    {0x20C101, { 2516,    -1,    -1,    -1,    -1}},
+    {0x20C200, {  495,    -1,    -1,    -1,    -1}},
+    {0x20C201, { 2564,    -1,    -1,    -1,    -1}},
+    {0x20C300, {  559,    -1,    -1,    -1,    -1}},
+    {0x20FE00, {  970,    -1,    -1,    -1,    -1}},
+    {0x20FF00, { 1098,    -1,    -1,    -1,    -1}},
+    {0x20FF01, { 2643,    -1,    -1,    -1,    -1}},
+    {0x20FF03, {   -1,    -1,  6480,    -1,    -1}},
+    {0x210000, {   -1,    -1,    -1,    -1,    66}},
+    {0x210001, {   -1,    -1,    -1,    -1,   159}},
+    {0x210002, {   -1,    -1,   558,    -1,    -1}},
+    {0x210003, {   -1,    -1,  6313,    -1,    -1}},
+    {0x210005, {   -1,    -1,  6564,    -1,    -1}},
+    {0x210007, {   -1,    -1,  7027,    -1,    -1}},
+    {0x210009, {   -1,    -1,  8453,    -1,    -1}},
+    {0x210010, {   -1,    -1,  1707,    -1,    -1}},
+    {0x210012, {   -1,    -1,  2095,    -1,    -1}},
+    {0x210080, { 1288,    -1,    -1,    -1,    -1}},
+    {0x2100F1, {   -1,    -1,    -1,   295,    -1}},
+    {0x2100F2, {   -1,    -1,    -1,    66,    -1}},
+    {0x210100, {   -1,    -1,    66,    -1,    -1}},
+    {0x210101, {   -1,    -1,  4070,    -1,    -1}},
+    {0x210109, {   -1,    -1,  8573,    -1,    -1}},
+    {0x2101FE, {   -1,    -1,  3944,    -1,    -1}},
+    {0x210200, {   -1,    -1,   194,    -1,    -1}},
+    {0x210201, { 1600,    -1,  4171,    -1,    -1}},
+    {0x210209, {   -1,    -1,  8674,    -1,    -1}},
+    {0x210210, {   -1,    -1,  1833,    -1,    -1}},
+    {0x210300, {   -1,    -1,   322,    -1,    -1}},
+    {0x210301, { 1660,    -1,    -1,    -1,    -1}},
+    {0x210302, {   -1,    -1,   710,    -1,    -1}},
+    {0x210310, {   -1,    -1,  1910,    -1,    -1}},
+    {0x210312, {   -1,    -1,  2177,    -1,    -1}},
+    {0x210400, {   -1,    -1,   450,    -1,    -1}},
+    {0x210401, { 1720,    -1,    -1,    -1,    -1}},
+    {0x210402, {   -1,    -1,   801,    -1,    -1}},
+    {0x210410, {   -1,    -1,  2014,    -1,    -1}},
+    {0x210412, {   -1,    -1,  2234,    -1,    -1}},
+    {0x210501, { 1769,    -1,    -1,    -1,    -1}},
+    {0x210601, { 1815,    -1,    -1,    -1,    -1}},
+    {0x210701, { 1862,    -1,    -1,    -1,    -1}},
+    {0x210901, { 1909,    -1,  4310,    -1,    -1}},
+    {0x210907, {   -1,    -1,  7225,    -1,    -1}},
+    {0x210909, {   -1,    -1,  8813,    -1,    -1}},
+    {0x211101, { 1961,    -1,    -1,    -1,    -1}},
+    {0x211103, { 1428,    -1,    -1,    -1,    -1}},
+    {0x211203, { 1467,    -1,    -1,    -1,    -1}},
+    {0x211A01, { 2049,    -1,    -1,    -1,    -1}},
+    {0x211C01, { 2122,    -1,    -1,    -1,    -1}},
+    {0x211D01, { 2166,    -1,    -1,    -1,    -1}},
+    {0x211E01, { 2211,    -1,    -1,    -1,    -1}},
+    {0x211F01, { 2260,    -1,    -1,    -1,    -1}},
+    {0x212001, {   -1,    -1,  4971,    -1,    -1}},
+    {0x212007, {   -1,    -1,  7729,    -1,    -1}},
+    {0x212009, {   -1,    -1,  9474,    -1,    -1}},
+    {0x212101, { 2307,    -1,    -1,    -1,    -1}},
+    {0x212800, {  209,    -1,    -1,    -1,    -1}},
+    {0x212801, {   -1,    -1,  5139,    -1,    -1}},
+    {0x212809, {   -1,    -1,  9642,    -1,    -1}},
+    {0x212900, {  237,    -1,    -1,    -1,    -1}},
+    {0x213001, {   -1,    -1,  5335,    -1,    -1}},
+    {0x213007, {   -1,    -1,  7871,    -1,    -1}},
+    {0x213009, {   -1,    -1,  9838,    -1,    -1}},
+    {0x213101, {   -1,    -1,  5416,    -1,    -1}},
+    {0x213105, {   -1,    -1,  6764,    -1,    -1}},
+    {0x213107, {   -1,    -1,  7952,    -1,    -1}},
+    {0x213109, {   -1,    -1,  9919,    -1,    -1}},
+    {0x213201, {   -1,    -1,  5491,    -1,    -1}},
+    {0x213205, {   -1,    -1,  6824,    -1,    -1}},
+    {0x213207, {   -1,    -1,  8027,    -1,    -1}},
+    {0x213209, {   -1,    -1,  9994,    -1,    -1}},
+    {0x213301, {   -1,    -1,  5578,    -1,    -1}},
+    {0x213309, {   -1,    -1, 10081,    -1,    -1}},
+    {0x213401, {   -1,    -1,  5665,    -1,    -1}},
+    {0x213407, {   -1,    -1,  8114,    -1,    -1}},
+    {0x213409, {   -1,    -1, 10168,    -1,    -1}},
+    {0x213501, {   -1,    -1,  5724,    -1,    -1}},
+    {0x213507, {   -1,    -1,  8171,    -1,    -1}},
+    {0x213509, {   -1,    -1, 10227,    -1,    -1}},
+    {0x213601, {   -1,    -1,  5785,    -1,    -1}},
+    {0x213609, {   -1,    -1, 10288,    -1,    -1}},
+    {0x213801, {   -1,   200,  5853,    -1,    -1}},
+    {0x213803, {   -1,    -1,  6437,    -1,    -1}},
+    {0x213805, {   -1,    -1,  6885,    -1,    -1}},
+    {0x213807, {   -1,    -1,  8247,    -1,    -1}},
+    {0x213809, {   -1,    -1, 10356,    -1,    -1}},
+    {0x2138F1, {   -1,    -1,    -1,   419,    -1}},
+    {0x213901, {   -1,    -1,  5914,    -1,    -1}},
+    {0x213905, {   -1,    -1,  6940,    -1,    -1}},
+    {0x213907, {   -1,    -1,  8308,    -1,    -1}},
+    {0x213909, {   -1,    -1, 10417,    -1,    -1}},
+    {0x213A01, {   -1,    -1,  5967,    -1,    -1}},
+    {0x213A07, {   -1,    -1,  8361,    -1,    -1}},
+    {0x213A09, {   -1,    -1, 10470,    -1,    -1}},
+    {0x213B01, {   -1,    -1,  6042,    -1,    -1}},
+    {0x213B09, {   -1,    -1, 10545,    -1,    -1}},
+    {0x213C01, {   -1,    -1,  6131,    -1,    -1}},
+    {0x213C09, {   -1,    -1, 10634,    -1,    -1}},
+    {0x213D01, {   -1,    -1,  6186,    -1,    -1}},
+    {0x213D09, {   -1,    -1, 10689,    -1,    -1}},
+    {0x213E01, {   -1,    -1,  6243,    -1,    -1}},
+    {0x213E09, {   -1,    -1, 10746,    -1,    -1}},
+    {0x214000, {  331,    -1,    -1,    -1,    -1}},
+    {0x214001, { 2468,    -1,    -1,    -1,    -1}},
+    {0x214100, {  421,    -1,    -1,    -1,    -1}},
+    {0x214101, { 2517,    -1,    -1,    -1,    -1}},
+    {0x214200, {  496,    -1,    -1,    -1,    -1}},
+    {0x214201, { 2565,    -1,    -1,    -1,    -1}},
+    {0x214300, {  560,    -1,    -1,    -1,    -1}},
+    {0x214400, {  602,    -1,    -1,    -1,    -1}},
+    {0x217E00, {  971,    -1,    -1,    -1,    -1}},
+    {0x217F00, { 1099,    -1,    -1,    -1,    -1}},
+    {0x217F01, { 2644,    -1,    -1,    -1,    -1}},
+    {0x217F03, {   -1,    -1,  6481,    -1,    -1}},
+    {0x218000, {   -1,    -1,    -1,    -1,    67}},
+    {0x218001, {   -1,    -1,    -1,    -1,   160}},
+    {0x218002, {   -1,    -1,   559,    -1,    -1}},
+    {0x218003, {   -1,    -1,  6314,    -1,    -1}},
+    {0x218005, {   -1,    -1,  6565,    -1,    -1}},
+    {0x218007, {   -1,    -1,  7028,    -1,    -1}},
+    {0x218009, {   -1,    -1,  8454,    -1,    -1}},
+    {0x218010, {   -1,    -1,  1708,    -1,    -1}},
+    {0x218080, { 1289,    -1,    -1,    -1,    -1}},
+    {0x2180F1, {   -1,    -1,    -1,   296,    -1}},
+    {0x2180F2, {   -1,    -1,    -1,    67,    -1}},
+    {0x218100, {   -1,    -1,    67,    -1,    -1}},
+    {0x218101, {   -1,    -1,  4071,    -1,    -1}},
+    {0x218109, {   -1,    -1,  8574,    -1,    -1}},
+    {0x2181FE, {   -1,    -1,  3945,    -1,    -1}},
+    {0x218200, {   -1,    -1,   195,    -1,    -1}},
+    {0x218201, { 1601,    -1,  4172,    -1,    -1}},
+    {0x218209, {   -1,    -1,  8675,    -1,    -1}},
+    {0x218300, {   -1,    -1,   323,    -1,    -1}},
+    {0x218301, { 1661,    -1,    -1,    -1,    -1}},
+    {0x218302, {   -1,    -1,   711,    -1,    -1}},
+    {0x218400, {   -1,    -1,   451,    -1,    -1}},
+    {0x218401, { 1721,    -1,    -1,    -1,    -1}},
+    {0x218402, {   -1,    -1,   802,    -1,    -1}},
+    {0x218410, {   -1,    -1,  2015,    -1,    -1}},
+    {0x218501, { 1770,    -1,    -1,    -1,    -1}},
+    {0x218601, { 1816,    -1,    -1,    -1,    -1}},
+    {0x218701, { 1863,    -1,    -1,    -1,    -1}},
+    {0x218901, { 1910,    -1,  4311,    -1,    -1}},
+    {0x218907, {   -1,    -1,  7226,    -1,    -1}},
+    {0x218909, {   -1,    -1,  8814,    -1,    -1}},
+    {0x219101, { 1962,    -1,    -1,    -1,    -1}},
+    {0x219103, { 1429,    -1,    -1,    -1,    -1}},
+    {0x219203, { 1468,    -1,    -1,    -1,    -1}},
+    {0x219A01, { 2050,    -1,    -1,    -1,    -1}},
+    {0x219C01, { 2123,    -1,    -1,    -1,    -1}},
+    {0x219D01, { 2167,    -1,    -1,    -1,    -1}},
+    {0x219E01, { 2212,    -1,    -1,    -1,    -1}},
+    {0x219F01, { 2261,    -1,    -1,    -1,    -1}},
+    {0x21A001, {   -1,    -1,  4972,    -1,    -1}},
+    {0x21A007, {   -1,    -1,  7730,    -1,    -1}},
+    {0x21A009, {   -1,    -1,  9475,    -1,    -1}},
+    {0x21A101, { 2308,    -1,    -1,    -1,    -1}},
+    {0x21A801, {   -1,    -1,  5140,    -1,    -1}},
+    {0x21A809, {   -1,    -1,  9643,    -1,    -1}},
+    {0x21B001, {   -1,    -1,  5336,    -1,    -1}},
+    {0x21B007, {   -1,    -1,  7872,    -1,    -1}},
+    {0x21B009, {   -1,    -1,  9839,    -1,    -1}},
+    {0x21B101, {   -1,    -1,  5417,    -1,    -1}},
+    {0x21B105, {   -1,    -1,  6765,    -1,    -1}},
+    {0x21B107, {   -1,    -1,  7953,    -1,    -1}},
+    {0x21B109, {   -1,    -1,  9920,    -1,    -1}},
+    {0x21B201, {   -1,    -1,  5492,    -1,    -1}},
+    {0x21B205, {   -1,    -1,  6825,    -1,    -1}},
+    {0x21B207, {   -1,    -1,  8028,    -1,    -1}},
+    {0x21B209, {   -1,    -1,  9995,    -1,    -1}},
+    {0x21B301, {   -1,    -1,  5579,    -1,    -1}},
+    {0x21B309, {   -1,    -1, 10082,    -1,    -1}},
+    {0x21B401, {   -1,    -1,  5666,    -1,    -1}},
+    {0x21B407, {   -1,    -1,  8115,    -1,    -1}},
+    {0x21B409, {   -1,    -1, 10169,    -1,    -1}},
+    {0x21B501, {   -1,    -1,  5725,    -1,    -1}},
+    {0x21B507, {   -1,    -1,  8172,    -1,    -1}},
+    {0x21B509, {   -1,    -1, 10228,    -1,    -1}},
+    {0x21B601, {   -1,    -1,  5786,    -1,    -1}},
+    {0x21B609, {   -1,    -1, 10289,    -1,    -1}},
+    {0x21B801, {   -1,   201,  5854,    -1,    -1}},
+    {0x21B803, {   -1,    -1,  6438,    -1,    -1}},
+    {0x21B805, {   -1,    -1,  6886,    -1,    -1}},
+    {0x21B807, {   -1,    -1,  8248,    -1,    -1}},
+    {0x21B809, {   -1,    -1, 10357,    -1,    -1}},
+    {0x21B8F1, {   -1,    -1,    -1,   420,    -1}},
+    {0x21B901, {   -1,    -1,  5915,    -1,    -1}},
+    {0x21B905, {   -1,    -1,  6941,    -1,    -1}},
+    {0x21B907, {   -1,    -1,  8309,    -1,    -1}},
+    {0x21B909, {   -1,    -1, 10418,    -1,    -1}},
+    {0x21BA01, {   -1,    -1,  5968,    -1,    -1}},
+    {0x21BA07, {   -1,    -1,  8362,    -1,    -1}},
+    {0x21BA09, {   -1,    -1, 10471,    -1,    -1}},
+    {0x21BB01, {   -1,    -1,  6043,    -1,    -1}},
+    {0x21BB09, {   -1,    -1, 10546,    -1,    -1}},
+    {0x21BC01, {   -1,    -1,  6132,    -1,    -1}},
+    {0x21BC09, {   -1,    -1, 10635,    -1,    -1}},
+    {0x21BD01, {   -1,    -1,  6187,    -1,    -1}},
+    {0x21BD09, {   -1,    -1, 10690,    -1,    -1}},
+    {0x21BE01, {   -1,    -1,  6244,    -1,    -1}},
+    {0x21BE09, {   -1,    -1, 10747,    -1,    -1}},
+    {0x21C001, { 2469,    -1,    -1,    -1,    -1}},
+    {0x21C101, { 2518,    -1,    -1,    -1,    -1}},
+    {0x21C201, { 2566,    -1,    -1,    -1,    -1}},
+    {0x21FE00, {  972,    -1,    -1,    -1,    -1}},
+    {0x21FF00, { 1100,    -1,    -1,    -1,    -1}},
+    {0x21FF01, { 2645,    -1,    -1,    -1,    -1}},
+    {0x21FF03, {   -1,    -1,  6482,    -1,    -1}},
+    {0x220000, {   -1,    -1,    -1,    -1,    68}},
+    {0x220001, {   -1,    -1,    -1,    -1,   161}},
+    {0x220003, { 1329,    -1,  6315,    -1,    -1}},
+    {0x220005, {   -1,    -1,  6566,    -1,    -1}},
+    {0x220007, {   -1,    -1,  7029,    -1,    -1}},
+    {0x220009, {   -1,    -1,  8455,    -1,    -1}},
+    {0x220010, {   -1,    -1,  1709,    -1,    -1}},
+    {0x220020, {   -1,    -1,  2651,    -1,    -1}},
+    {0x220080, { 1290,    -1,    -1,    -1,    -1}},
+    {0x2200F1, {   -1,    -1,    -1,   297,    -1}},
+    {0x2200F2, {   -1,    -1,    -1,    68,    -1}},
+    {0x220100, {   -1,    -1,    68,    -1,    -1}},
+    {0x220101, {   -1,    -1,  4072,    -1,    -1}},
+    {0x220103, { 1367,    -1,    -1,    -1,    -1}},
+    {0x220109, {   -1,    -1,  8575,    -1,    -1}},
+    {0x2201FE, {   -1,    -1,  3946,    -1,    -1}},
+    {0x220200, {   -1,    -1,   196,    -1,    -1}},
+    {0x220201, { 1602,    -1,  4173,    -1,    -1}},
+    {0x220209, {   -1,    -1,  8676,    -1,    -1}},
+    {0x220300, {   -1,    -1,   324,    -1,    -1}},
+    {0x220301, { 1662,    -1,    -1,    -1,    -1}},
+    {0x220310, {   -1,    -1,  1911,    -1,    -1}},
+    {0x220320, {   -1,    -1,  2756,    -1,    -1}},
+    {0x220400, {   -1,    -1,   452,    -1,    -1}},
+    {0x220401, { 1722,    -1,    -1,    -1,    -1}},
+    {0x220410, {   -1,    -1,  2016,    -1,    -1}},
+    {0x220420, {   -1,    -1,  2820,    -1,    -1}},
+    {0x220501, { 1771,    -1,    -1,    -1,    -1}},
+    {0x220601, { 1817,    -1,    -1,    -1,    -1}},
+    {0x220701, { 1864,    -1,    -1,    -1,    -1}},
+    {0x220901, { 1911,    -1,  4312,    -1,    -1}},
+    {0x220907, {   -1,    -1,  7227,    -1,    -1}},
+    {0x220909, {   -1,    -1,  8815,    -1,    -1}},
+    {0x221003, { 1396,    -1,    -1,    -1,    -1}},
+    {0x221101, { 1963,    -1,    -1,    -1,    -1}},
+    {0x221103, { 1430,    -1,    -1,    -1,    -1}},
+    {0x221203, { 1469,    -1,    -1,    -1,    -1}},
+    {0x221A01, { 2051,    -1,    -1,    -1,    -1}},
+    {0x221C01, { 2124,    -1,    -1,    -1,    -1}},
+    {0x221D01, { 2168,    -1,    -1,    -1,    -1}},
+    {0x221E01, { 2213,    -1,    -1,    -1,    -1}},
+    {0x221F01, { 2262,    -1,    -1,    -1,    -1}},
+    {0x222001, {   -1,    -1,  4973,    -1,    -1}},
+    {0x222007, {   -1,    -1,  7731,    -1,    -1}},
+    {0x222009, {   -1,    -1,  9476,    -1,    -1}},
+    {0x222101, { 2309,    -1,    -1,    -1,    -1}},
+    {0x222203, { 1535,    -1,    -1,    -1,    -1}},
+    {0x222801, {   -1,    -1,  5141,    -1,    -1}},
+    {0x222809, {   -1,    -1,  9644,    -1,    -1}},
+    {0x223001, {   -1,    -1,  5337,    -1,    -1}},
+    {0x223007, {   -1,    -1,  7873,    -1,    -1}},
+    {0x223009, {   -1,    -1,  9840,    -1,    -1}},
+    {0x223101, {   -1,    -1,  5418,    -1,    -1}},
+    {0x223105, {   -1,    -1,  6766,    -1,    -1}},
+    {0x223107, {   -1,    -1,  7954,    -1,    -1}},
+    {0x223109, {   -1,    -1,  9921,    -1,    -1}},
+    {0x223201, {   -1,    -1,  5493,    -1,    -1}},
+    {0x223205, {   -1,    -1,  6826,    -1,    -1}},
+    {0x223207, {   -1,    -1,  8029,    -1,    -1}},
+    {0x223209, {   -1,    -1,  9996,    -1,    -1}},
+    {0x223301, {   -1,    -1,  5580,    -1,    -1}},
+    {0x223309, {   -1,    -1, 10083,    -1,    -1}},
+    {0x223401, {   -1,    -1,  5667,    -1,    -1}},
+    {0x223407, {   -1,    -1,  8116,    -1,    -1}},
+    {0x223409, {   -1,    -1, 10170,    -1,    -1}},
+    {0x223501, {   -1,    -1,  5726,    -1,    -1}},
+    {0x223507, {   -1,    -1,  8173,    -1,    -1}},
+    {0x223509, {   -1,    -1, 10229,    -1,    -1}},
+    {0x223601, {   -1,    -1,  5787,    -1,    -1}},
+    {0x223609, {   -1,    -1, 10290,    -1,    -1}},
+    {0x223801, {   -1,   202,  5855,    -1,    -1}},
+    {0x223803, {   -1,    -1,  6439,    -1,    -1}},
+    {0x223805, {   -1,    -1,  6887,    -1,    -1}},
+    {0x223807, {   -1,    -1,  8249,    -1,    -1}},
+    {0x223809, {   -1,    -1, 10358,    -1,    -1}},
+    {0x2238F1, {   -1,    -1,    -1,   421,    -1}},
+    {0x223901, {   -1,    -1,  5916,    -1,    -1}},
+    {0x223905, {   -1,    -1,  6942,    -1,    -1}},
+    {0x223907, {   -1,    -1,  8310,    -1,    -1}},
+    {0x223909, {   -1,    -1, 10419,    -1,    -1}},
+    {0x223A01, {   -1,    -1,  5969,    -1,    -1}},
+    {0x223A07, {   -1,    -1,  8363,    -1,    -1}},
+    {0x223A09, {   -1,    -1, 10472,    -1,    -1}},
+    {0x223B01, {   -1,    -1,  6044,    -1,    -1}},
+    {0x223B09, {   -1,    -1, 10547,    -1,    -1}},
+    {0x223C01, {   -1,    -1,  6133,    -1,    -1}},
+    {0x223C09, {   -1,    -1, 10636,    -1,    -1}},
+    {0x223D01, {   -1,    -1,  6188,    -1,    -1}},
+    {0x223D09, {   -1,    -1, 10691,    -1,    -1}},
+    {0x223E01, {   -1,    -1,  6245,    -1,    -1}},
+    {0x223E09, {   -1,    -1, 10748,    -1,    -1}},
+    {0x224000, {  332,    -1,    -1,    -1,    -1}},
+    {0x224001, { 2470,    -1,    -1,    -1,    -1}},
+    {0x224100, {  422,    -1,    -1,    -1,    -1}},
+    {0x224101, { 2519,    -1,    -1,    -1,    -1}},
+    {0x224200, {  497,    -1,    -1,    -1,    -1}},
+    {0x224201, { 2567,    -1,    -1,    -1,    -1}},
+    {0x227E00, {  973,    -1,    -1,    -1,    -1}},
+    {0x227F00, { 1101,    -1,    -1,    -1,    -1}},
+    {0x227F01, { 2646,    -1,    -1,    -1,    -1}},
+    {0x227F03, {   -1,    -1,  6483,    -1,    -1}},
+    {0x228000, {   -1,    -1,    -1,    -1,    69}},
+    {0x228001, {   -1,    -1,    -1,    -1,   162}},
+    {0x228003, { 1330,    -1,  6316,    -1,    -1}},
+    {0x228005, {   -1,    -1,  6567,    -1,    -1}},
+    {0x228007, {   -1,    -1,  7030,    -1,    -1}},
+    {0x228009, {   -1,    -1,  8456,    -1,    -1}},
+    {0x228080, { 1291,    -1,    -1,    -1,    -1}},
+    {0x2280F1, {   -1,    -1,    -1,   298,    -1}},
+    {0x2280F2, {   -1,    -1,    -1,    69,    -1}},
+    {0x228100, {   -1,    -1,    69,    -1,    -1}},
+    {0x228101, {   -1,    -1,  4073,    -1,    -1}},
+    {0x228103, { 1368,    -1,    -1,    -1,    -1}},
+    {0x228109, {   -1,    -1,  8576,    -1,    -1}},
+    {0x2281FE, {   -1,    -1,  3947,    -1,    -1}},
+    {0x228200, {   -1,    -1,   197,    -1,    -1}},
+    {0x228201, {   -1,    -1,  4174,    -1,    -1}},
+    {0x228209, {   -1,    -1,  8677,    -1,    -1}},
+    {0x228300, {   -1,    -1,   325,    -1,    -1}},
+    {0x228301, { 1663,    -1,    -1,    -1,    -1}},
+    {0x228400, {   -1,    -1,   453,    -1,    -1}},
+    {0x228401, { 1723,    -1,    -1,    -1,    -1}},
+    {0x228901, {   -1,    -1,  4313,    -1,    -1}},
+    {0x228907, {   -1,    -1,  7228,    -1,    -1}},
+    {0x228909, {   -1,    -1,  8816,    -1,    -1}},
+    {0x229003, { 1397,    -1,    -1,    -1,    -1}},
+    {0x229103, { 1431,    -1,    -1,    -1,    -1}},
+    {0x229203, { 1470,    -1,    -1,    -1,    -1}},
+    {0x22A001, {   -1,    -1,  4974,    -1,    -1}},
+    {0x22A007, {   -1,    -1,  7732,    -1,    -1}},
+    {0x22A009, {   -1,    -1,  9477,    -1,    -1}},
+    {0x22A203, { 1536,    -1,    -1,    -1,    -1}},
+    {0x22A801, {   -1,    -1,  5142,    -1,    -1}},
+    {0x22A809, {   -1,    -1,  9645,    -1,    -1}},
+    {0x22B001, {   -1,    -1,  5338,    -1,    -1}},
+    {0x22B007, {   -1,    -1,  7874,    -1,    -1}},
+    {0x22B009, {   -1,    -1,  9841,    -1,    -1}},
+    {0x22B101, {   -1,    -1,  5419,    -1,    -1}},
+    {0x22B105, {   -1,    -1,  6767,    -1,    -1}},
+    {0x22B107, {   -1,    -1,  7955,    -1,    -1}},
+    {0x22B109, {   -1,    -1,  9922,    -1,    -1}},
+    {0x22B201, {   -1,    -1,  5494,    -1,    -1}},
+    {0x22B205, {   -1,    -1,  6827,    -1,    -1}},
+    {0x22B207, {   -1,    -1,  8030,    -1,    -1}},
+    {0x22B209, {   -1,    -1,  9997,    -1,    -1}},
+    {0x22B301, {   -1,    -1,  5581,    -1,    -1}},
+    {0x22B309, {   -1,    -1, 10084,    -1,    -1}},
+    {0x22B401, {   -1,    -1,  5668,    -1,    -1}},
+    {0x22B407, {   -1,    -1,  8117,    -1,    -1}},
+    {0x22B409, {   -1,    -1, 10171,    -1,    -1}},
+    {0x22B501, {   -1,    -1,  5727,    -1,    -1}},
+    {0x22B507, {   -1,    -1,  8174,    -1,    -1}},
+    {0x22B509, {   -1,    -1, 10230,    -1,    -1}},
+    {0x22B601, {   -1,    -1,  5788,    -1,    -1}},
+    {0x22B609, {   -1,    -1, 10291,    -1,    -1}},
+    {0x22B801, {   -1,   203,  5856,    -1,    -1}},
+    {0x22B803, {   -1,    -1,  6440,    -1,    -1}},
+    {0x22B805, {   -1,    -1,  6888,    -1,    -1}},
+    {0x22B807, {   -1,    -1,  8250,    -1,    -1}},
+    {0x22B809, {   -1,    -1, 10359,    -1,    -1}},
+    {0x22B8F1, {   -1,    -1,    -1,   422,    -1}},
+    {0x22B901, {   -1,    -1,  5917,    -1,    -1}},
+    {0x22B905, {   -1,    -1,  6943,    -1,    -1}},
+    {0x22B907, {   -1,    -1,  8311,    -1,    -1}},
+    {0x22B909, {   -1,    -1, 10420,    -1,    -1}},
+    {0x22BA01, {   -1,    -1,  5970,    -1,    -1}},
+    {0x22BA07, {   -1,    -1,  8364,    -1,    -1}},
+    {0x22BA09, {   -1,    -1, 10473,    -1,    -1}},
+    {0x22BB01, {   -1,    -1,  6045,    -1,    -1}},
+    {0x22BB09, {   -1,    -1, 10548,    -1,    -1}},
+    {0x22BC01, {   -1,    -1,  6134,    -1,    -1}},
+    {0x22BC09, {   -1,    -1, 10637,    -1,    -1}},
+    {0x22BD01, {   -1,    -1,  6189,    -1,    -1}},
+    {0x22BD09, {   -1,    -1, 10692,    -1,    -1}},
+    {0x22BE01, {   -1,    -1,  6246,    -1,    -1}},
+    {0x22BE09, {   -1,    -1, 10749,    -1,    -1}},
+    {0x22FE00, {  974,    -1,    -1,    -1,    -1}},
+    {0x22FF00, { 1102,    -1,    -1,    -1,    -1}},
+    {0x22FF01, { 2647,    -1,    -1,    -1,    -1}},
+    {0x22FF03, {   -1,    -1,  6484,    -1,    -1}},
+    {0x230000, {   -1,    -1,    -1,    -1,    70}},
+    {0x230001, {   -1,    -1,    -1,    -1,   163}},
+    {0x230003, { 1331,    -1,  6317,    -1,    -1}},
+    {0x230005, {   -1,    -1,  6568,    -1,    -1}},
+    {0x230007, {   -1,    -1,  7031,    -1,    -1}},
+    {0x230009, {   -1,    -1,  8457,    -1,    -1}},
+    {0x230080, { 1292,    -1,    -1,    -1,    -1}},
+    {0x2300F1, {   -1,    -1,    -1,   299,    -1}},
+    {0x2300F2, {   -1,    -1,    -1,    70,    -1}},
+    {0x230100, {   -1,    -1,    70,    -1,    -1}},
+    {0x230101, {   -1,    -1,  4074,    -1,    -1}},
+    {0x230103, { 1369,    -1,    -1,    -1,    -1}},
+    {0x230109, {   -1,    -1,  8577,    -1,    -1}},
+    {0x2301FE, {   -1,    -1,  3948,    -1,    -1}},
+    {0x230200, {   -1,    -1,   198,    -1,    -1}},
+    {0x230201, {   -1,    -1,  4175,    -1,    -1}},
+    {0x230209, {   -1,    -1,  8678,    -1,    -1}},
+    {0x230300, {   -1,    -1,   326,    -1,    -1}},
+    {0x230301, { 1664,    -1,    -1,    -1,    -1}},
+    {0x230400, {   -1,    -1,   454,    -1,    -1}},
+    {0x230401, { 1724,    -1,    -1,    -1,    -1}},
+    {0x230501, { 1772,    -1,    -1,    -1,    -1}},
+    {0x230601, { 1818,    -1,    -1,    -1,    -1}},
+    {0x230701, { 1865,    -1,    -1,    -1,    -1}},
+    {0x230901, {   -1,    -1,  4314,    -1,    -1}},
+    {0x230907, {   -1,    -1,  7229,    -1,    -1}},
+    {0x230909, {   -1,    -1,  8817,    -1,    -1}},
+    {0x230A07, {   -1,    -1,  7304,    -1,    -1}},
+    {0x230B01, {   -1,    -1,  4448,    -1,    -1}},
+    {0x230B07, {   -1,    -1,  7344,    -1,    -1}},
+    {0x230B09, {   -1,    -1,  8951,    -1,    -1}},
+    {0x230D01, {   -1,    -1,  4548,    -1,    -1}},
+    {0x230D09, {   -1,    -1,  9051,    -1,    -1}},
+    {0x231103, { 1432,    -1,    -1,    -1,    -1}},
+    {0x231203, { 1471,    -1,    -1,    -1,    -1}},
+    {0x231807, {   -1,    -1,  7410,    -1,    -1}},
+    {0x231901, { 2007,   139,  4694,    -1,    -1}},
+    {0x231903, {   -1,    -1,  6376,    -1,    -1}},
+    {0x231905, {   -1,    -1,  6653,    -1,    -1}},
+    {0x231907, {   -1,    -1,  7451,    -1,    -1}},
+    {0x231909, {   -1,    -1,  9197,    -1,    -1}},
+    {0x2319F1, {   -1,    -1,    -1,   358,    -1}},
+    {0x231A01, { 2052,    -1,  4730,    -1,    -1}},
+    {0x231A07, {   -1,    -1,  7492,    -1,    -1}},
+    {0x231A09, {   -1,    -1,  9233,    -1,    -1}},
+    {0x231B01, { 2082,    -1,  4779,    -1,    -1}},
+    {0x231B07, {   -1,    -1,  7533,    -1,    -1}},
+    {0x231B09, {   -1,    -1,  9282,    -1,    -1}},
+    {0x231C01, {   -1,    -1,  4820,    -1,    -1}},
+    {0x231C07, {   -1,    -1,  7574,    -1,    -1}},
+    {0x231C09, {   -1,    -1,  9323,    -1,    -1}},
+    {0x231D01, {   -1,    -1,  4861,    -1,    -1}},
+    {0x231D07, {   -1,    -1,  7615,    -1,    -1}},
+    {0x231D09, {   -1,    -1,  9364,    -1,    -1}},
+    {0x231E01, { 2214,    -1,  4896,    -1,    -1}},
+    {0x231E07, {   -1,    -1,  7656,    -1,    -1}},
+    {0x231E09, {   -1,    -1,  9399,    -1,    -1}},
+    {0x231F01, { 2263,    -1,    -1,    -1,    -1}},
+    {0x232001, {   -1,    -1,  4975,    -1,    -1}},
+    {0x232007, {   -1,    -1,  7733,    -1,    -1}},
+    {0x232009, {   -1,    -1,  9478,    -1,    -1}},
+    {0x232203, { 1537,    -1,    -1,    -1,    -1}},
+    {0x232801, {   -1,    -1,  5143,    -1,    -1}},
+    {0x232809, {   -1,    -1,  9646,    -1,    -1}},
+    {0x232901, { 2353,    -1,    -1,    -1,    -1}},
+    {0x233001, {   -1,    -1,  5339,    -1,    -1}},
+    {0x233007, {   -1,    -1,  7875,    -1,    -1}},
+    {0x233009, {   -1,    -1,  9842,    -1,    -1}},
+    {0x233101, {   -1,    -1,  5420,    -1,    -1}},
+    {0x233105, {   -1,    -1,  6768,    -1,    -1}},
+    {0x233107, {   -1,    -1,  7956,    -1,    -1}},
+    {0x233109, {   -1,    -1,  9923,    -1,    -1}},
+    {0x233201, {   -1,    -1,  5495,    -1,    -1}},
+    {0x233205, {   -1,    -1,  6828,    -1,    -1}},
+    {0x233207, {   -1,    -1,  8031,    -1,    -1}},
+    {0x233209, {   -1,    -1,  9998,    -1,    -1}},
+    {0x233301, {   -1,    -1,  5582,    -1,    -1}},
+    {0x233309, {   -1,    -1, 10085,    -1,    -1}},
+    {0x233401, {   -1,    -1,  5669,    -1,    -1}},
+    {0x233407, {   -1,    -1,  8118,    -1,    -1}},
+    {0x233409, {   -1,    -1, 10172,    -1,    -1}},
+    {0x233501, {   -1,    -1,  5728,    -1,    -1}},
+    {0x233507, {   -1,    -1,  8175,    -1,    -1}},
+    {0x233509, {   -1,    -1, 10231,    -1,    -1}},
+    {0x233601, {   -1,    -1,  5789,    -1,    -1}},
+    {0x233609, {   -1,    -1, 10292,    -1,    -1}},
+    {0x233801, {   -1,   204,  5857,    -1,    -1}},
+    {0x233803, {   -1,    -1,  6441,    -1,    -1}},
+    {0x233805, {   -1,    -1,  6889,    -1,    -1}},
+    {0x233807, {   -1,    -1,  8251,    -1,    -1}},
+    {0x233809, {   -1,    -1, 10360,    -1,    -1}},
+    {0x2338F1, {   -1,    -1,    -1,   423,    -1}},
+    {0x233901, {   -1,    -1,  5918,    -1,    -1}},
+    {0x233905, {   -1,    -1,  6944,    -1,    -1}},
+    {0x233907, {   -1,    -1,  8312,    -1,    -1}},
+    {0x233909, {   -1,    -1, 10421,    -1,    -1}},
+    {0x233A01, {   -1,    -1,  5971,    -1,    -1}},
+    {0x233A07, {   -1,    -1,  8365,    -1,    -1}},
+    {0x233A09, {   -1,    -1, 10474,    -1,    -1}},
+    {0x233B01, {   -1,    -1,  6046,    -1,    -1}},
+    {0x233B09, {   -1,    -1, 10549,    -1,    -1}},
+    {0x233C01, {   -1,    -1,  6135,    -1,    -1}},
+    {0x233C09, {   -1,    -1, 10638,    -1,    -1}},
+    {0x233D01, {   -1,    -1,  6190,    -1,    -1}},
+    {0x233D09, {   -1,    -1, 10693,    -1,    -1}},
+    {0x233E01, {   -1,    -1,  6247,    -1,    -1}},
+    {0x233E09, {   -1,    -1, 10750,    -1,    -1}},
+    {0x234001, { 2471,    -1,    -1,    -1,    -1}},
+    {0x234101, { 2520,    -1,    -1,    -1,    -1}},
+    {0x234201, { 2568,    -1,    -1,    -1,    -1}},
+    {0x237E00, {  975,    -1,    -1,    -1,    -1}},
+    {0x237F00, { 1103,    -1,    -1,    -1,    -1}},
+    {0x237F01, { 2648,    -1,    -1,    -1,    -1}},
+    {0x237F03, {   -1,    -1,  6485,    -1,    -1}},
+    {0x238000, {   -1,    -1,    -1,    -1,    71}},
+    {0x238001, {   -1,    -1,    -1,    -1,   164}},
+    {0x238003, { 1332,    -1,  6318,    -1,    -1}},
+    {0x238005, {   -1,    -1,  6569,    -1,    -1}},
+    {0x238007, {   -1,    -1,  7032,    -1,    -1}},
+    {0x238009, {   -1,    -1,  8458,    -1,    -1}},
+    {0x238010, {   -1,    -1,  1710,    -1,    -1}},
+    {0x238020, {   -1,    -1,  2652,    -1,    -1}},
+    {0x238022, {   -1,    -1,  2868,    -1,    -1}},
+    {0x238080, { 1293,    -1,    -1,    -1,    -1}},
+    {0x2380F1, {   -1,    -1,    -1,   300,    -1}},
+    {0x2380F2, {   -1,    -1,    -1,    71,    -1}},
+    {0x238100, {   -1,    -1,    71,    -1,    -1}},
+    {0x238101, {   -1,    -1,  4075,    -1,    -1}},
+    {0x238103, { 1370,    -1,    -1,    -1,    -1}},
+    {0x238109, {   -1,    -1,  8578,    -1,    -1}},
+    {0x2381FE, {   -1,    -1,  3949,    -1,    -1}},
+    {0x238200, {   -1,    -1,   199,    -1,    -1}},
+    {0x238201, { 1603,    -1,  4176,    -1,    -1}},
+    {0x238209, {   -1,    -1,  8679,    -1,    -1}},
+    {0x238210, {   -1,    -1,  1834,    -1,    -1}},
+    {0x238300, {   -1,    -1,   327,    -1,    -1}},
+    {0x238301, { 1665,    -1,    -1,    -1,    -1}},
+    {0x238310, {   -1,    -1,  1912,    -1,    -1}},
+    {0x238320, {   -1,    -1,  2757,    -1,    -1}},
+    {0x238400, {   -1,    -1,   455,    -1,    -1}},
+    {0x238401, { 1725,    -1,    -1,    -1,    -1}},
+    {0x238410, {   -1,    -1,  2017,    -1,    -1}},
+    {0x238420, {   -1,    -1,  2821,    -1,    -1}},
+    {0x238422, {   -1,    -1,  2943,    -1,    -1}},
+    {0x238501, { 1773,    -1,    -1,    -1,    -1}},
+    {0x238601, { 1819,    -1,    -1,    -1,    -1}},
+    {0x238701, { 1866,    -1,    -1,    -1,    -1}},
+    {0x238901, { 1912,    -1,  4315,    -1,    -1}},
+    {0x238907, {   -1,    -1,  7230,    -1,    -1}},
+    {0x238909, {   -1,    -1,  8818,    -1,    -1}},
+    {0x239101, { 1964,    -1,    -1,    -1,    -1}},
+    {0x239103, { 1433,    -1,    -1,    -1,    -1}},
+    {0x239203, { 1472,    -1,    -1,    -1,    -1}},
+    {0x239A01, { 2053,    -1,    -1,    -1,    -1}},
+    {0x239C01, { 2125,    -1,    -1,    -1,    -1}},
+    {0x239D01, { 2169,    -1,    -1,    -1,    -1}},
+    {0x239E01, { 2215,    -1,    -1,    -1,    -1}},
+    {0x239F01, { 2264,    -1,    -1,    -1,    -1}},
+    {0x23A001, {   -1,    -1,  4976,    -1,    -1}},
+    {0x23A007, {   -1,    -1,  7734,    -1,    -1}},
+    {0x23A009, {   -1,    -1,  9479,    -1,    -1}},
+    {0x23A101, { 2310,    -1,    -1,    -1,    -1}},
+    {0x23A203, { 1538,    -1,    -1,    -1,    -1}},
+    {0x23A800, {  210,    -1,    -1,    -1,    -1}},
+    {0x23A801, {   -1,    -1,  5144,    -1,    -1}},
+    {0x23A809, {   -1,    -1,  9647,    -1,    -1}},
+    {0x23B001, {   -1,    -1,  5340,    -1,    -1}},
+    {0x23B007, {   -1,    -1,  7876,    -1,    -1}},
+    {0x23B009, {   -1,    -1,  9843,    -1,    -1}},
+    {0x23B101, {   -1,    -1,  5421,    -1,    -1}},
+    {0x23B105, {   -1,    -1,  6769,    -1,    -1}},
+    {0x23B107, {   -1,    -1,  7957,    -1,    -1}},
+    {0x23B109, {   -1,    -1,  9924,    -1,    -1}},
+    {0x23B201, {   -1,    -1,  5496,    -1,    -1}},
+    {0x23B205, {   -1,    -1,  6829,    -1,    -1}},
+    {0x23B207, {   -1,    -1,  8032,    -1,    -1}},
+    {0x23B209, {   -1,    -1,  9999,    -1,    -1}},
+    {0x23B301, {   -1,    -1,  5583,    -1,    -1}},
+    {0x23B309, {   -1,    -1, 10086,    -1,    -1}},
+    {0x23B401, {   -1,    -1,  5670,    -1,    -1}},
+    {0x23B407, {   -1,    -1,  8119,    -1,    -1}},
+    {0x23B409, {   -1,    -1, 10173,    -1,    -1}},
+    {0x23B501, {   -1,    -1,  5729,    -1,    -1}},
+    {0x23B507, {   -1,    -1,  8176,    -1,    -1}},
+    {0x23B509, {   -1,    -1, 10232,    -1,    -1}},
+    {0x23B601, {   -1,    -1,  5790,    -1,    -1}},
+    {0x23B609, {   -1,    -1, 10293,    -1,    -1}},
+    {0x23B801, {   -1,   205,  5858,    -1,    -1}},
+    {0x23B803, {   -1,    -1,  6442,    -1,    -1}},
+    {0x23B805, {   -1,    -1,  6890,    -1,    -1}},
+    {0x23B807, {   -1,    -1,  8252,    -1,    -1}},
+    {0x23B809, {   -1,    -1, 10361,    -1,    -1}},
+    {0x23B8F1, {   -1,    -1,    -1,   424,    -1}},
+    {0x23B901, {   -1,    -1,  5919,    -1,    -1}},
+    {0x23B905, {   -1,    -1,  6945,    -1,    -1}},
+    {0x23B907, {   -1,    -1,  8313,    -1,    -1}},
+    {0x23B909, {   -1,    -1, 10422,    -1,    -1}},
+    {0x23BA01, {   -1,    -1,  5972,    -1,    -1}},
+    {0x23BA07, {   -1,    -1,  8366,    -1,    -1}},
+    {0x23BA09, {   -1,    -1, 10475,    -1,    -1}},
+    {0x23BB01, {   -1,    -1,  6047,    -1,    -1}},
+    {0x23BB09, {   -1,    -1, 10550,    -1,    -1}},
+    {0x23BC01, {   -1,    -1,  6136,    -1,    -1}},
+    {0x23BC09, {   -1,    -1, 10639,    -1,    -1}},
+    {0x23BD01, {   -1,    -1,  6191,    -1,    -1}},
+    {0x23BD09, {   -1,    -1, 10694,    -1,    -1}},
+    {0x23BE01, {   -1,    -1,  6248,    -1,    -1}},
+    {0x23BE09, {   -1,    -1, 10751,    -1,    -1}},
+    {0x23C001, { 2472,    -1,    -1,    -1,    -1}},
+    {0x23C101, { 2521,    -1,    -1,    -1,    -1}},
+    {0x23C201, { 2569,    -1,    -1,    -1,    -1}},
+    {0x23E000, {  852,    -1,    -1,    -1,    -1}},
+    {0x23FE00, {  976,    -1,    -1,    -1,    -1}},
+    {0x23FF00, { 1104,    -1,    -1,    -1,    -1}},
+    {0x23FF01, { 2649,    -1,    -1,    -1,    -1}},
+    {0x23FF03, {   -1,    -1,  6486,    -1,    -1}},
+    {0x240000, {   -1,    -1,    -1,    -1,    72}},
+    {0x240001, {   -1,    -1,    -1,    -1,   165}},
+    {0x240002, {   -1,    -1,   560,    -1,    -1}},
+    {0x240003, { 1333,    -1,  6319,    -1,    -1}},
+    {0x240005, {   -1,    -1,  6570,    -1,    -1}},
+    {0x240007, {   -1,    -1,  7033,    -1,    -1}},
+    {0x240009, {   -1,    -1,  8459,    -1,    -1}},
+    {0x240010, {   -1,    -1,  1711,    -1,    -1}},
+    {0x240012, {   -1,    -1,  2096,    -1,    -1}},
+    {0x240020, {   -1,    -1,  2653,    -1,    -1}},
+    {0x240080, { 1294,    -1,    -1,    -1,    -1}},
+    {0x2400F1, {   -1,    -1,    -1,   301,    -1}},
+    {0x2400F2, {   -1,    -1,    -1,    72,    -1}},
+    {0x240100, {   -1,    -1,    72,    -1,    -1}},
+    {0x240101, {   -1,    -1,  4076,    -1,    -1}},
+    {0x240103, { 1371,    -1,    -1,    -1,    -1}},
+    {0x240109, {   -1,    -1,  8579,    -1,    -1}},
+    {0x2401FE, {   -1,    -1,  3950,    -1,    -1}},
+    {0x240200, {   -1,    -1,   200,    -1,    -1}},
+    {0x240201, { 1604,    -1,  4177,    -1,    -1}},
+    {0x240209, {   -1,    -1,  8680,    -1,    -1}},
+    {0x240300, {   -1,    -1,   328,    -1,    -1}},
+    {0x240301, { 1666,    -1,    -1,    -1,    -1}},
+    {0x240302, {   -1,    -1,   712,    -1,    -1}},
+    {0x240310, {   -1,    -1,  1913,    -1,    -1}},
+    {0x240312, {   -1,    -1,  2178,    -1,    -1}},
+    {0x240320, {   -1,    -1,  2758,    -1,    -1}},
+    {0x240400, {   -1,    -1,   456,    -1,    -1}},
+    {0x240401, { 1726,    -1,    -1,    -1,    -1}},
+    {0x240402, {   -1,    -1,   803,    -1,    -1}},
+    {0x240410, {   -1,    -1,  2018,    -1,    -1}},
+    {0x240412, {   -1,    -1,  2235,    -1,    -1}},
+    {0x240420, {   -1,    -1,  2822,    -1,    -1}},
+    {0x240501, { 1774,    -1,    -1,    -1,    -1}},
+    {0x240601, { 1820,    -1,    -1,    -1,    -1}},
+    {0x240701, { 1867,    -1,    -1,    -1,    -1}},
+    {0x240901, { 1913,    -1,  4316,    -1,    -1}},
+    {0x240907, {   -1,    -1,  7231,    -1,    -1}},
+    {0x240909, {   -1,    -1,  8819,    -1,    -1}},
+    {0x241101, { 1965,    -1,    -1,    -1,    -1}},
+    {0x241103, { 1434,    -1,    -1,    -1,    -1}},
+    {0x241203, { 1473,    -1,    -1,    -1,    -1}},
+    {0x241A01, { 2054,    -1,    -1,    -1,    -1}},
+    {0x241C01, { 2126,    -1,    -1,    -1,    -1}},
+    {0x241D01, { 2170,    -1,    -1,    -1,    -1}},
+    {0x241E01, { 2216,    -1,    -1,    -1,    -1}},
+    {0x241F01, { 2265,    -1,    -1,    -1,    -1}},
+    {0x242001, {   -1,    -1,  4977,    -1,    -1}},
+    {0x242007, {   -1,    -1,  7735,    -1,    -1}},
+    {0x242009, {   -1,    -1,  9480,    -1,    -1}},
+    {0x242101, { 2311,    -1,    -1,    -1,    -1}},
+    {0x242203, { 1539,    -1,    -1,    -1,    -1}},
+    {0x242801, {   -1,    -1,  5145,    -1,    -1}},
+    {0x242809, {   -1,    -1,  9648,    -1,    -1}},
+    {0x243001, {   -1,    -1,  5341,    -1,    -1}},
+    {0x243007, {   -1,    -1,  7877,    -1,    -1}},
+    {0x243009, {   -1,    -1,  9844,    -1,    -1}},
+    {0x243101, {   -1,    -1,  5422,    -1,    -1}},
+    {0x243105, {   -1,    -1,  6770,    -1,    -1}},
+    {0x243107, {   -1,    -1,  7958,    -1,    -1}},
+    {0x243109, {   -1,    -1,  9925,    -1,    -1}},
+    {0x243201, {   -1,    -1,  5497,    -1,    -1}},
+    {0x243205, {   -1,    -1,  6830,    -1,    -1}},
+    {0x243207, {   -1,    -1,  8033,    -1,    -1}},
+    {0x243209, {   -1,    -1, 10000,    -1,    -1}},
+    {0x243301, {   -1,    -1,  5584,    -1,    -1}},
+    {0x243309, {   -1,    -1, 10087,    -1,    -1}},
+    {0x243401, {   -1,    -1,  5671,    -1,    -1}},
+    {0x243407, {   -1,    -1,  8120,    -1,    -1}},
+    {0x243409, {   -1,    -1, 10174,    -1,    -1}},
+    {0x243501, {   -1,    -1,  5730,    -1,    -1}},
+    {0x243507, {   -1,    -1,  8177,    -1,    -1}},
+    {0x243509, {   -1,    -1, 10233,    -1,    -1}},
+    {0x243601, {   -1,    -1,  5791,    -1,    -1}},
+    {0x243609, {   -1,    -1, 10294,    -1,    -1}},
+    {0x243801, {   -1,   206,  5859,    -1,    -1}},
+    {0x243803, {   -1,    -1,  6443,    -1,    -1}},
+    {0x243805, {   -1,    -1,  6891,    -1,    -1}},
+    {0x243807, {   -1,    -1,  8253,    -1,    -1}},
+    {0x243809, {   -1,    -1, 10362,    -1,    -1}},
+    {0x2438F1, {   -1,    -1,    -1,   425,    -1}},
+    {0x243901, {   -1,    -1,  5920,    -1,    -1}},
+    {0x243905, {   -1,    -1,  6946,    -1,    -1}},
+    {0x243907, {   -1,    -1,  8314,    -1,    -1}},
+    {0x243909, {   -1,    -1, 10423,    -1,    -1}},
+    {0x243A01, {   -1,    -1,  5973,    -1,    -1}},
+    {0x243A07, {   -1,    -1,  8367,    -1,    -1}},
+    {0x243A09, {   -1,    -1, 10476,    -1,    -1}},
+    {0x243B01, {   -1,    -1,  6048,    -1,    -1}},
+    {0x243B09, {   -1,    -1, 10551,    -1,    -1}},
+    {0x243C01, {   -1,    -1,  6137,    -1,    -1}},
+    {0x243C09, {   -1,    -1, 10640,    -1,    -1}},
+    {0x243D01, {   -1,    -1,  6192,    -1,    -1}},
+    {0x243D09, {   -1,    -1, 10695,    -1,    -1}},
+    {0x243E01, {   -1,    -1,  6249,    -1,    -1}},
+    {0x243E09, {   -1,    -1, 10752,    -1,    -1}},
+    {0x244001, { 2473,    -1,    -1,    -1,    -1}},
+    {0x244101, { 2522,    -1,    -1,    -1,    -1}},
+    {0x244201, { 2570,    -1,    -1,    -1,    -1}},
+    {0x246000, {  853,    -1,    -1,    -1,    -1}},
+    {0x247E00, {  977,    -1,    -1,    -1,    -1}},
+    {0x247F00, { 1105,    -1,    -1,    -1,    -1}},
+    {0x247F01, { 2650,    -1,    -1,    -1,    -1}},
+    {0x247F03, {   -1,    -1,  6487,    -1,    -1}},
+    {0x248000, {   -1,    -1,    -1,    -1,    73}},
+    {0x248001, {   -1,    -1,    -1,    -1,   166}},
+    {0x248002, {   -1,    -1,   561,    -1,    -1}},
+    {0x248003, { 1334,    -1,  6320,    -1,    -1}},
+    {0x248004, {   -1,    -1,   882,    -1,    -1}},
+    {0x248005, {   -1,    -1,  6571,    -1,    -1}},
+    {0x248006, {   -1,    -1,  1093,    -1,    -1}},
+    {0x248007, {   -1,    -1,  7034,    -1,    -1}},
+    {0x248009, {   -1,    -1,  8460,    -1,    -1}},
+    {0x248010, {   -1,    -1,  1712,    -1,    -1}},
+    {0x248012, {   -1,    -1,  2097,    -1,    -1}},
+    {0x248020, {   -1,    -1,  2654,    -1,    -1}},
+    {0x248022, {   -1,    -1,  2869,    -1,    -1}},
+    {0x2480F1, {   -1,    -1,    -1,   302,    -1}},
+    {0x2480F2, {   -1,    -1,    -1,    73,    -1}},
+    {0x248100, {   -1,    -1,    73,    -1,    -1}},
+    {0x248101, {   -1,    -1,  4077,    -1,    -1}},
+    {0x248103, { 1372,    -1,    -1,    -1,    -1}},
+    {0x248109, {   -1,    -1,  8580,    -1,    -1}},
+    {0x2481FE, {   -1,    -1,  3951,    -1,    -1}},
+    {0x248200, {   -1,    -1,   201,    -1,    -1}},
+    {0x248201, {   -1,    -1,  4178,    -1,    -1}},
+    {0x248209, {   -1,    -1,  8681,    -1,    -1}},
+    {0x248300, {   -1,    -1,   329,    -1,    -1}},
+    {0x248301, { 1667,    -1,    -1,    -1,    -1}},
+    {0x248302, {   -1,    -1,   713,    -1,    -1}},
+    {0x248304, {   -1,    -1,   971,    -1,    -1}},
+    {0x248306, {   -1,    -1,  1160,    -1,    -1}},
+    {0x248310, {   -1,    -1,  1914,    -1,    -1}},
+    {0x248320, {   -1,    -1,  2759,    -1,    -1}},
+    {0x248400, {   -1,    -1,   457,    -1,    -1}},
+    {0x248402, {   -1,    -1,   804,    -1,    -1}},
+    {0x248404, {   -1,    -1,  1034,    -1,    -1}},
+    {0x248406, {   -1,    -1,  1207,    -1,    -1}},
+    {0x248410, {   -1,    -1,  2019,    -1,    -1}},
+    {0x248412, {   -1,    -1,  2236,    -1,    -1}},
+    {0x248420, {   -1,    -1,  2823,    -1,    -1}},
+    {0x248422, {   -1,    -1,  2944,    -1,    -1}},
+    {0x248901, {   -1,    -1,  4317,    -1,    -1}},
+    {0x248907, {   -1,    -1,  7232,    -1,    -1}},
+    {0x248909, {   -1,    -1,  8820,    -1,    -1}},
+    {0x249103, { 1435,    -1,    -1,    -1,    -1}},
+    {0x249203, { 1474,    -1,    -1,    -1,    -1}},
+    {0x24A001, {   -1,    -1,  4978,    -1,    -1}},
+    {0x24A007, {   -1,    -1,  7736,    -1,    -1}},
+    {0x24A009, {   -1,    -1,  9481,    -1,    -1}},
+    {0x24A203, { 1540,    -1,    -1,    -1,    -1}},
+    {0x24A800, {  211,    -1,    -1,    -1,    -1}},
+    {0x24A801, {   -1,    -1,  5146,    -1,    -1}},
+    {0x24A809, {   -1,    -1,  9649,    -1,    -1}},
+    {0x24B001, {   -1,    -1,  5342,    -1,    -1}},
+    {0x24B007, {   -1,    -1,  7878,    -1,    -1}},
+    {0x24B009, {   -1,    -1,  9845,    -1,    -1}},
+    {0x24B101, {   -1,    -1,  5423,    -1,    -1}},
+    {0x24B105, {   -1,    -1,  6771,    -1,    -1}},
+    {0x24B107, {   -1,    -1,  7959,    -1,    -1}},
+    {0x24B109, {   -1,    -1,  9926,    -1,    -1}},
+    {0x24B201, {   -1,    -1,  5498,    -1,    -1}},
+    {0x24B205, {   -1,    -1,  6831,    -1,    -1}},
+    {0x24B207, {   -1,    -1,  8034,    -1,    -1}},
+    {0x24B209, {   -1,    -1, 10001,    -1,    -1}},
+    {0x24B301, {   -1,    -1,  5585,    -1,    -1}},
+    {0x24B309, {   -1,    -1, 10088,    -1,    -1}},
+    {0x24B401, {   -1,    -1,  5672,    -1,    -1}},
+    {0x24B407, {   -1,    -1,  8121,    -1,    -1}},
+    {0x24B409, {   -1,    -1, 10175,    -1,    -1}},
+    {0x24B501, {   -1,    -1,  5731,    -1,    -1}},
+    {0x24B507, {   -1,    -1,  8178,    -1,    -1}},
+    {0x24B509, {   -1,    -1, 10234,    -1,    -1}},
+    {0x24B601, {   -1,    -1,  5792,    -1,    -1}},
+    {0x24B609, {   -1,    -1, 10295,    -1,    -1}},
+    {0x24B801, {   -1,   207,  5860,    -1,    -1}},
+    {0x24B803, {   -1,    -1,  6444,    -1,    -1}},
+    {0x24B805, {   -1,    -1,  6892,    -1,    -1}},
+    {0x24B807, {   -1,    -1,  8254,    -1,    -1}},
+    {0x24B809, {   -1,    -1, 10363,    -1,    -1}},
+    {0x24B8F1, {   -1,    -1,    -1,   426,    -1}},
+    {0x24B901, {   -1,    -1,  5921,    -1,    -1}},
+    {0x24B905, {   -1,    -1,  6947,    -1,    -1}},
+    {0x24B907, {   -1,    -1,  8315,    -1,    -1}},
+    {0x24B909, {   -1,    -1, 10424,    -1,    -1}},
+    {0x24BA01, {   -1,    -1,  5974,    -1,    -1}},
+    {0x24BA07, {   -1,    -1,  8368,    -1,    -1}},
+    {0x24BA09, {   -1,    -1, 10477,    -1,    -1}},
+    {0x24BB01, {   -1,    -1,  6049,    -1,    -1}},
+    {0x24BB09, {   -1,    -1, 10552,    -1,    -1}},
+    {0x24BC01, {   -1,    -1,  6138,    -1,    -1}},
+    {0x24BC09, {   -1,    -1, 10641,    -1,    -1}},
+    {0x24BD01, {   -1,    -1,  6193,    -1,    -1}},
+    {0x24BD09, {   -1,    -1, 10696,    -1,    -1}},
+    {0x24BE01, {   -1,    -1,  6250,    -1,    -1}},
+    {0x24BE09, {   -1,    -1, 10753,    -1,    -1}},
+    {0x24C000, {  333,    -1,    -1,    -1,    -1}},
+    {0x24C100, {  423,    -1,    -1,    -1,    -1}},
+    {0x24C200, {  498,    -1,    -1,    -1,    -1}},
+    {0x24C300, {  561,    -1,    -1,    -1,    -1}},
+    {0x24E000, {  854,    -1,    -1,    -1,    -1}},
+    {0x24FE00, {  978,    -1,    -1,    -1,    -1}},
+    {0x24FF00, { 1106,    -1,    -1,    -1,    -1}},
+    {0x24FF01, { 2651,    -1,    -1,    -1,    -1}},
+    {0x24FF03, {   -1,    -1,  6488,    -1,    -1}},
+    {0x250000, {   -1,    -1,    -1,    -1,    74}},
+    {0x250001, {   -1,    -1,    -1,    -1,   167}},
+    {0x250003, { 1335,    -1,  6321,    -1,    -1}},
+    {0x250005, {   -1,    -1,  6572,    -1,    -1}},
+    {0x250007, {   -1,    -1,  7035,    -1,    -1}},
+    {0x250009, {   -1,    -1,  8461,    -1,    -1}},
+    {0x2500F1, {   -1,    -1,    -1,   303,    -1}},
+    {0x2500F2, {   -1,    -1,    -1,    74,    -1}},
+    {0x250100, {   -1,    -1,    74,    -1,    -1}},
+    {0x250101, {   -1,    -1,  4078,    -1,    -1}},
+    {0x250109, {   -1,    -1,  8581,    -1,    -1}},
+    {0x2501FE, {   -1,    -1,  3952,    -1,    -1}},
+    {0x250200, {   -1,    -1,   202,    -1,    -1}},
+    {0x250201, {   -1,    -1,  4179,    -1,    -1}},
+    {0x250209, {   -1,    -1,  8682,    -1,    -1}},
+    {0x250300, {   -1,    -1,   330,    -1,    -1}},
+    {0x250301, { 1668,    -1,    -1,    -1,    -1}},
+    {0x250400, {   -1,    -1,   458,    -1,    -1}},
+    {0x250901, {   -1,    -1,  4318,    -1,    -1}},
+    {0x250907, {   -1,    -1,  7233,    -1,    -1}},
+    {0x250909, {   -1,    -1,  8821,    -1,    -1}},
+    {0x250A01, {   -1,    -1,  4399,    -1,    -1}},
+    {0x250A07, {   -1,    -1,  7305,    -1,    -1}},
+    {0x250A09, {   -1,    -1,  8902,    -1,    -1}},
+    {0x250B01, {   -1,    -1,  4449,    -1,    -1}},
+    {0x250B07, {   -1,    -1,  7345,    -1,    -1}},
+    {0x250B09, {   -1,    -1,  8952,    -1,    -1}},
+    {0x250D01, {   -1,    -1,  4549,    -1,    -1}},
+    {0x250D09, {   -1,    -1,  9052,    -1,    -1}},
+    {0x251103, { 1436,    -1,    -1,    -1,    -1}},
+    {0x251203, { 1475,    -1,    -1,    -1,    -1}},
+    {0x251807, {   -1,    -1,  7411,    -1,    -1}},
+    {0x251901, {   -1,    -1,  4695,    -1,    -1}},
+    {0x251907, {   -1,    -1,  7452,    -1,    -1}},
+    {0x251909, {   -1,    -1,  9198,    -1,    -1}},
+    {0x251A01, {   -1,    -1,  4731,    -1,    -1}},
+    {0x251A07, {   -1,    -1,  7493,    -1,    -1}},
+    {0x251A09, {   -1,    -1,  9234,    -1,    -1}},
+    {0x251B01, {   -1,    -1,  4780,    -1,    -1}},
+    {0x251B07, {   -1,    -1,  7534,    -1,    -1}},
+    {0x251B09, {   -1,    -1,  9283,    -1,    -1}},
+    {0x251C01, {   -1,    -1,  4821,    -1,    -1}},
+    {0x251C07, {   -1,    -1,  7575,    -1,    -1}},
+    {0x251C09, {   -1,    -1,  9324,    -1,    -1}},
+    {0x251D01, {   -1,    -1,  4862,    -1,    -1}},
+    {0x251D07, {   -1,    -1,  7616,    -1,    -1}},
+    {0x251D09, {   -1,    -1,  9365,    -1,    -1}},
+    {0x251E01, {   -1,    -1,  4897,    -1,    -1}},
+    {0x251E07, {   -1,    -1,  7657,    -1,    -1}},
+    {0x251E09, {   -1,    -1,  9400,    -1,    -1}},
+    {0x252001, {   -1,    -1,  4979,    -1,    -1}},
+    {0x252007, {   -1,    -1,  7737,    -1,    -1}},
+    {0x252009, {   -1,    -1,  9482,    -1,    -1}},
+    {0x252801, {   -1,    -1,  5147,    -1,    -1}},
+    {0x252809, {   -1,    -1,  9650,    -1,    -1}},
+    {0x253001, {   -1,    -1,  5343,    -1,    -1}},
+    {0x253007, {   -1,    -1,  7879,    -1,    -1}},
+    {0x253009, {   -1,    -1,  9846,    -1,    -1}},
+    {0x253101, {   -1,    -1,  5424,    -1,    -1}},
+    {0x253105, {   -1,    -1,  6772,    -1,    -1}},
+    {0x253107, {   -1,    -1,  7960,    -1,    -1}},
+    {0x253109, {   -1,    -1,  9927,    -1,    -1}},
+    {0x253201, {   -1,    -1,  5499,    -1,    -1}},
+    {0x253205, {   -1,    -1,  6832,    -1,    -1}},
+    {0x253207, {   -1,    -1,  8035,    -1,    -1}},
+    {0x253209, {   -1,    -1, 10002,    -1,    -1}},
+    {0x253301, {   -1,    -1,  5586,    -1,    -1}},
+    {0x253309, {   -1,    -1, 10089,    -1,    -1}},
+    {0x253401, {   -1,    -1,  5673,    -1,    -1}},
+    {0x253407, {   -1,    -1,  8122,    -1,    -1}},
+    {0x253409, {   -1,    -1, 10176,    -1,    -1}},
+    {0x253501, {   -1,    -1,  5732,    -1,    -1}},
+    {0x253507, {   -1,    -1,  8179,    -1,    -1}},
+    {0x253509, {   -1,    -1, 10235,    -1,    -1}},
+    {0x253601, {   -1,    -1,  5793,    -1,    -1}},
+    {0x253609, {   -1,    -1, 10296,    -1,    -1}},
+    {0x253801, {   -1,   208,  5861,    -1,    -1}},
+    {0x253803, {   -1,    -1,  6445,    -1,    -1}},
+    {0x253805, {   -1,    -1,  6893,    -1,    -1}},
+    {0x253807, {   -1,    -1,  8255,    -1,    -1}},
+    {0x253809, {   -1,    -1, 10364,    -1,    -1}},
+    {0x2538F1, {   -1,    -1,    -1,   427,    -1}},
+    {0x253901, {   -1,    -1,  5922,    -1,    -1}},
+    {0x253905, {   -1,    -1,  6948,    -1,    -1}},
+    {0x253907, {   -1,    -1,  8316,    -1,    -1}},
+    {0x253909, {   -1,    -1, 10425,    -1,    -1}},
+    {0x253A01, {   -1,    -1,  5975,    -1,    -1}},
+    {0x253A07, {   -1,    -1,  8369,    -1,    -1}},
+    {0x253A09, {   -1,    -1, 10478,    -1,    -1}},
+    {0x253B01, {   -1,    -1,  6050,    -1,    -1}},
+    {0x253B09, {   -1,    -1, 10553,    -1,    -1}},
+    {0x253C01, {   -1,    -1,  6139,    -1,    -1}},
+    {0x253C09, {   -1,    -1, 10642,    -1,    -1}},
+    {0x253D01, {   -1,    -1,  6194,    -1,    -1}},
+    {0x253D09, {   -1,    -1, 10697,    -1,    -1}},
+    {0x253E01, {   -1,    -1,  6251,    -1,    -1}},
+    {0x253E09, {   -1,    -1, 10754,    -1,    -1}},
+    {0x254000, {  334,    -1,    -1,    -1,    -1}},
+    {0x254100, {  424,    -1,    -1,    -1,    -1}},
+    {0x257E00, {  979,    -1,    -1,    -1,    -1}},
+    {0x257F00, { 1107,    -1,    -1,    -1,    -1}},
+    {0x257F01, { 2652,    -1,    -1,    -1,    -1}},
+    {0x258000, {   -1,    -1,    -1,    -1,    75}},
+    {0x258001, {   -1,    -1,    -1,    -1,   168}},
+    {0x258003, {   -1,    -1,  6322,    -1,    -1}},
+    {0x258005, {   -1,    -1,  6573,    -1,    -1}},
+    {0x258007, {   -1,    -1,  7036,    -1,    -1}},
+    {0x258009, {   -1,    -1,  8462,    -1,    -1}},
+    {0x258010, {   -1,    -1,  1713,    -1,    -1}},
+    {0x258020, {   -1,    -1,  2655,    -1,    -1}},
+    {0x258022, {   -1,    -1,  2870,    -1,    -1}},
+    {0x258030, {   -1,    -1,  3221,    -1,    -1}},
+    {0x258032, {   -1,    -1,  3340,    -1,    -1}},
+    {0x258034, {   -1,    -1,  3399,    -1,    -1}},
+    {0x2580F1, {   -1,    -1,    -1,   304,    -1}},
+    {0x2580F2, {   -1,    -1,    -1,    75,    -1}},
+    {0x258100, {   -1,    -1,    75,    -1,    -1}},
+    {0x258101, {   -1,    -1,  4079,    -1,    -1}},
+    {0x258109, {   -1,    -1,  8582,    -1,    -1}},
+    {0x2581FE, {   -1,    -1,  3953,    -1,    -1}},
+    {0x258200, {   -1,    -1,   203,    -1,    -1}},
+    {0x258201, {   -1,    -1,  4180,    -1,    -1}},
+    {0x258209, {   -1,    -1,  8683,    -1,    -1}},
+    {0x258210, {   -1,    -1,  1835,    -1,    -1}},
+    {0x258300, {   -1,    -1,   331,    -1,    -1}},
+    {0x258301, { 1669,    -1,    -1,    -1,    -1}},
+    {0x258310, {   -1,    -1,  1915,    -1,    -1}},
+    {0x258320, {   -1,    -1,  2760,    -1,    -1}},
+    {0x258322, {   -1,    -1,  2910,    -1,    -1}},
+    {0x258400, {   -1,    -1,   459,    -1,    -1}},
+    {0x258410, {   -1,    -1,  2020,    -1,    -1}},
+    {0x258420, {   -1,    -1,  2824,    -1,    -1}},
+    {0x258422, {   -1,    -1,  2945,    -1,    -1}},
+    {0x258430, {   -1,    -1,  3311,    -1,    -1}},
+    {0x258432, {   -1,    -1,  3379,    -1,    -1}},
+    {0x258434, {   -1,    -1,  3424,    -1,    -1}},
+    {0x258901, {   -1,    -1,  4319,    -1,    -1}},
+    {0x258907, {   -1,    -1,  7234,    -1,    -1}},
+    {0x258909, {   -1,    -1,  8822,    -1,    -1}},
+    {0x258A01, {   -1,    -1,  4400,    -1,    -1}},
+    {0x258A07, {   -1,    -1,  7306,    -1,    -1}},
+    {0x258A09, {   -1,    -1,  8903,    -1,    -1}},
+    {0x258B01, {   -1,    -1,  4450,    -1,    -1}},
+    {0x258B07, {   -1,    -1,  7346,    -1,    -1}},
+    {0x258B09, {   -1,    -1,  8953,    -1,    -1}},
+    {0x258D01, {   -1,    -1,  4550,    -1,    -1}},
+    {0x258D09, {   -1,    -1,  9053,    -1,    -1}},
+    {0x259807, {   -1,    -1,  7412,    -1,    -1}},
+    {0x259901, { 2008,   140,  4696,    -1,    -1}},
+    {0x259903, {   -1,    -1,  6377,    -1,    -1}},
+    {0x259905, {   -1,    -1,  6654,    -1,    -1}},
+    {0x259907, {   -1,    -1,  7453,    -1,    -1}},
+    {0x259909, {   -1,    -1,  9199,    -1,    -1}},
+    {0x2599F1, {   -1,    -1,    -1,   359,    -1}},
+    {0x259A01, { 2055,    -1,  4732,    -1,    -1}},
+    {0x259A07, {   -1,    -1,  7494,    -1,    -1}},
+    {0x259A09, {   -1,    -1,  9235,    -1,    -1}},
+    {0x259B01, { 2083,    -1,  4781,    -1,    -1}},
+    {0x259B07, {   -1,    -1,  7535,    -1,    -1}},
+    {0x259B09, {   -1,    -1,  9284,    -1,    -1}},
+    {0x259C01, {   -1,    -1,  4822,    -1,    -1}},
+    {0x259C07, {   -1,    -1,  7576,    -1,    -1}},
+    {0x259C09, {   -1,    -1,  9325,    -1,    -1}},
+    {0x259D01, {   -1,    -1,  4863,    -1,    -1}},
+    {0x259D07, {   -1,    -1,  7617,    -1,    -1}},
+    {0x259D09, {   -1,    -1,  9366,    -1,    -1}},
+    {0x259E01, { 2217,    -1,  4898,    -1,    -1}},
+    {0x259E07, {   -1,    -1,  7658,    -1,    -1}},
+    {0x259E09, {   -1,    -1,  9401,    -1,    -1}},
+    {0x259F01, { 2266,    -1,    -1,    -1,    -1}},
+    {0x25A001, {   -1,    -1,  4980,    -1,    -1}},
+    {0x25A007, {   -1,    -1,  7738,    -1,    -1}},
+    {0x25A009, {   -1,    -1,  9483,    -1,    -1}},
+    {0x25A801, {   -1,    -1,  5148,    -1,    -1}},
+    {0x25A809, {   -1,    -1,  9651,    -1,    -1}},
+    {0x25B001, {   -1,    -1,  5344,    -1,    -1}},
+    {0x25B007, {   -1,    -1,  7880,    -1,    -1}},
+    {0x25B009, {   -1,    -1,  9847,    -1,    -1}},
+    {0x25B101, {   -1,    -1,  5425,    -1,    -1}},
+    {0x25B105, {   -1,    -1,  6773,    -1,    -1}},
+    {0x25B107, {   -1,    -1,  7961,    -1,    -1}},
+    {0x25B109, {   -1,    -1,  9928,    -1,    -1}},
+    {0x25B201, {   -1,    -1,  5500,    -1,    -1}},
+    {0x25B205, {   -1,    -1,  6833,    -1,    -1}},
+    {0x25B207, {   -1,    -1,  8036,    -1,    -1}},
+    {0x25B209, {   -1,    -1, 10003,    -1,    -1}},
+    {0x25B301, {   -1,    -1,  5587,    -1,    -1}},
+    {0x25B309, {   -1,    -1, 10090,    -1,    -1}},
+    {0x25B401, {   -1,    -1,  5674,    -1,    -1}},
+    {0x25B407, {   -1,    -1,  8123,    -1,    -1}},
+    {0x25B409, {   -1,    -1, 10177,    -1,    -1}},
+    {0x25B501, {   -1,    -1,  5733,    -1,    -1}},
+    {0x25B507, {   -1,    -1,  8180,    -1,    -1}},
+    {0x25B509, {   -1,    -1, 10236,    -1,    -1}},
+    {0x25B601, {   -1,    -1,  5794,    -1,    -1}},
+    {0x25B609, {   -1,    -1, 10297,    -1,    -1}},
+    {0x25B801, {   -1,   209,  5862,    -1,    -1}},
+    {0x25B803, {   -1,    -1,  6446,    -1,    -1}},
+    {0x25B805, {   -1,    -1,  6894,    -1,    -1}},
+    {0x25B807, {   -1,    -1,  8256,    -1,    -1}},
+    {0x25B809, {   -1,    -1, 10365,    -1,    -1}},
+    {0x25B8F1, {   -1,    -1,    -1,   428,    -1}},
+    {0x25B901, {   -1,    -1,  5923,    -1,    -1}},
+    {0x25B905, {   -1,    -1,  6949,    -1,    -1}},
+    {0x25B907, {   -1,    -1,  8317,    -1,    -1}},
+    {0x25B909, {   -1,    -1, 10426,    -1,    -1}},
+    {0x25BA01, {   -1,    -1,  5976,    -1,    -1}},
+    {0x25BA07, {   -1,    -1,  8370,    -1,    -1}},
+    {0x25BA09, {   -1,    -1, 10479,    -1,    -1}},
+    {0x25BB01, {   -1,    -1,  6051,    -1,    -1}},
+    {0x25BB09, {   -1,    -1, 10554,    -1,    -1}},
+    {0x25BC01, {   -1,    -1,  6140,    -1,    -1}},
+    {0x25BC09, {   -1,    -1, 10643,    -1,    -1}},
+    {0x25BD01, {   -1,    -1,  6195,    -1,    -1}},
+    {0x25BD09, {   -1,    -1, 10698,    -1,    -1}},
+    {0x25BE01, {   -1,    -1,  6252,    -1,    -1}},
+    {0x25BE09, {   -1,    -1, 10755,    -1,    -1}},
+    {0x25C000, {  335,    -1,    -1,    -1,    -1}},
+    {0x25C100, {  425,    -1,    -1,    -1,    -1}},
+    {0x25E000, {  855,    -1,    -1,    -1,    -1}},
+    {0x25FE00, {  980,    -1,    -1,    -1,    -1}},
+    {0x25FF00, { 1108,    -1,    -1,    -1,    -1}},
+    {0x25FF01, { 2653,    -1,    -1,    -1,    -1}},
+    {0x25FF03, {   -1,    -1,  6489,    -1,    -1}},
+    {0x260000, {   -1,    -1,    -1,    -1,    76}},
+    {0x260001, {   -1,    -1,    -1,    -1,   169}},
+    {0x260003, {   -1,    -1,  6323,    -1,    -1}},
+    {0x260005, {   -1,    -1,  6574,    -1,    -1}},
+    {0x260007, {   -1,    -1,  7037,    -1,    -1}},
+    {0x260009, {   -1,    -1,  8463,    -1,    -1}},
+    {0x2600F1, {   -1,    -1,    -1,   305,    -1}},
+    {0x2600F2, {   -1,    -1,    -1,    76,    -1}},
+    {0x260100, {   -1,    -1,    76,    -1,    -1}},
+    {0x260101, {   -1,    -1,  4080,    -1,    -1}},
+    {0x260109, {   -1,    -1,  8583,    -1,    -1}},
+    {0x2601FE, {   -1,    -1,  3954,    -1,    -1}},
+    {0x260200, {   -1,    -1,   204,    -1,    -1}},
+    {0x260201, {   -1,    -1,  4181,    -1,    -1}},
+    {0x260209, {   -1,    -1,  8684,    -1,    -1}},
+    {0x260300, {   -1,    -1,   332,    -1,    -1}},
+    {0x260301, { 1670,    -1,    -1,    -1,    -1}},
+    {0x260400, {   -1,    -1,   460,    -1,    -1}},
+    {0x260901, {   -1,    -1,  4320,    -1,    -1}},
+    {0x260907, {   -1,    -1,  7235,    -1,    -1}},
+    {0x260909, {   -1,    -1,  8823,    -1,    -1}},
+    {0x262001, {   -1,    -1,  4981,    -1,    -1}},
+    {0x262007, {   -1,    -1,  7739,    -1,    -1}},
+    {0x262009, {   -1,    -1,  9484,    -1,    -1}},
+    {0x262801, {   -1,    -1,  5149,    -1,    -1}},
+    {0x262809, {   -1,    -1,  9652,    -1,    -1}},
+    {0x263001, {   -1,    -1,  5345,    -1,    -1}},
+    {0x263007, {   -1,    -1,  7881,    -1,    -1}},
+    {0x263009, {   -1,    -1,  9848,    -1,    -1}},
+    {0x263101, {   -1,    -1,  5426,    -1,    -1}},
+    {0x263105, {   -1,    -1,  6774,    -1,    -1}},
+    {0x263107, {   -1,    -1,  7962,    -1,    -1}},
+    {0x263109, {   -1,    -1,  9929,    -1,    -1}},
+    {0x263201, {   -1,    -1,  5501,    -1,    -1}},
+    {0x263205, {   -1,    -1,  6834,    -1,    -1}},
+    {0x263207, {   -1,    -1,  8037,    -1,    -1}},
+    {0x263209, {   -1,    -1, 10004,    -1,    -1}},
+    {0x263301, {   -1,    -1,  5588,    -1,    -1}},
+    {0x263309, {   -1,    -1, 10091,    -1,    -1}},
+    {0x263401, {   -1,    -1,  5675,    -1,    -1}},
+    {0x263407, {   -1,    -1,  8124,    -1,    -1}},
+    {0x263409, {   -1,    -1, 10178,    -1,    -1}},
+    {0x263501, {   -1,    -1,  5734,    -1,    -1}},
+    {0x263507, {   -1,    -1,  8181,    -1,    -1}},
+    {0x263509, {   -1,    -1, 10237,    -1,    -1}},
+    {0x263601, {   -1,    -1,  5795,    -1,    -1}},
+    {0x263609, {   -1,    -1, 10298,    -1,    -1}},
+    {0x263801, {   -1,   210,  5863,    -1,    -1}},
+    {0x263803, {   -1,    -1,  6447,    -1,    -1}},
+    {0x263805, {   -1,    -1,  6895,    -1,    -1}},
+    {0x263807, {   -1,    -1,  8257,    -1,    -1}},
+    {0x263809, {   -1,    -1, 10366,    -1,    -1}},
+    {0x2638F1, {   -1,    -1,    -1,   429,    -1}},
+    {0x263901, {   -1,    -1,  5924,    -1,    -1}},
+    {0x263905, {   -1,    -1,  6950,    -1,    -1}},
+    {0x263907, {   -1,    -1,  8318,    -1,    -1}},
+    {0x263909, {   -1,    -1, 10427,    -1,    -1}},
+    {0x263A01, {   -1,    -1,  5977,    -1,    -1}},
+    {0x263A07, {   -1,    -1,  8371,    -1,    -1}},
+    {0x263A09, {   -1,    -1, 10480,    -1,    -1}},
+    {0x263B01, {   -1,    -1,  6052,    -1,    -1}},
+    {0x263B09, {   -1,    -1, 10555,    -1,    -1}},
+    {0x263C01, {   -1,    -1,  6141,    -1,    -1}},
+    {0x263C09, {   -1,    -1, 10644,    -1,    -1}},
+    {0x263D01, {   -1,    -1,  6196,    -1,    -1}},
+    {0x263D09, {   -1,    -1, 10699,    -1,    -1}},
+    {0x263E01, {   -1,    -1,  6253,    -1,    -1}},
+    {0x263E09, {   -1,    -1, 10756,    -1,    -1}},
+    {0x264000, {  336,    -1,    -1,    -1,    -1}},
+    {0x267E00, {  981,    -1,    -1,    -1,    -1}},
+    {0x267F00, { 1109,    -1,    -1,    -1,    -1}},
+    {0x267F01, { 2654,    -1,    -1,    -1,    -1}},
+    {0x267F03, {   -1,    -1,  6490,    -1,    -1}},
+    {0x268000, {   -1,    -1,    -1,    -1,    77}},
+    {0x268001, {   -1,    -1,    -1,    -1,   170}},
+    {0x268002, {   -1,    -1,   562,    -1,    -1}},
+    {0x268003, {   -1,    -1,  6324,    -1,    -1}},
+    {0x268005, {   -1,    -1,  6575,    -1,    -1}},
+    {0x268007, {   -1,    -1,  7038,    -1,    -1}},
+    {0x268009, {   -1,    -1,  8464,    -1,    -1}},
+    {0x2680F1, {   -1,    -1,    -1,   306,    -1}},
+    {0x2680F2, {   -1,    -1,    -1,    77,    -1}},
+    {0x268100, {   -1,    -1,    77,    -1,    -1}},
+    {0x268101, {   -1,    -1,  4081,    -1,    -1}},
+    {0x268109, {   -1,    -1,  8584,    -1,    -1}},
+    {0x2681FE, {   -1,    -1,  3955,    -1,    -1}},
+    {0x268200, {   -1,    -1,   205,    -1,    -1}},
+    {0x268201, {   -1,    -1,  4182,    -1,    -1}},
+    {0x268209, {   -1,    -1,  8685,    -1,    -1}},
+    {0x268300, {   -1,    -1,   333,    -1,    -1}},
+    {0x268301, { 1671,    -1,    -1,    -1,    -1}},
+    {0x268302, {   -1,    -1,   714,    -1,    -1}},
+    {0x268400, {   -1,    -1,   461,    -1,    -1}},
+    {0x268402, {   -1,    -1,   805,    -1,    -1}},
+    {0x268901, {   -1,    -1,  4321,    -1,    -1}},
+    {0x268907, {   -1,    -1,  7236,    -1,    -1}},
+    {0x268909, {   -1,    -1,  8824,    -1,    -1}},
+    {0x26A001, {   -1,    -1,  4982,    -1,    -1}},
+    {0x26A007, {   -1,    -1,  7740,    -1,    -1}},
+    {0x26A009, {   -1,    -1,  9485,    -1,    -1}},
+    {0x26A801, {   -1,    -1,  5150,    -1,    -1}},
+    {0x26A809, {   -1,    -1,  9653,    -1,    -1}},
+    {0x26B001, {   -1,    -1,  5346,    -1,    -1}},
+    {0x26B007, {   -1,    -1,  7882,    -1,    -1}},
+    {0x26B009, {   -1,    -1,  9849,    -1,    -1}},
+    {0x26B101, {   -1,    -1,  5427,    -1,    -1}},
+    {0x26B105, {   -1,    -1,  6775,    -1,    -1}},
+    {0x26B107, {   -1,    -1,  7963,    -1,    -1}},
+    {0x26B109, {   -1,    -1,  9930,    -1,    -1}},
+    {0x26B201, {   -1,    -1,  5502,    -1,    -1}},
+    {0x26B205, {   -1,    -1,  6835,    -1,    -1}},
+    {0x26B207, {   -1,    -1,  8038,    -1,    -1}},
+    {0x26B209, {   -1,    -1, 10005,    -1,    -1}},
+    {0x26B301, {   -1,    -1,  5589,    -1,    -1}},
+    {0x26B309, {   -1,    -1, 10092,    -1,    -1}},
+    {0x26B401, {   -1,    -1,  5676,    -1,    -1}},
+    {0x26B407, {   -1,    -1,  8125,    -1,    -1}},
+    {0x26B409, {   -1,    -1, 10179,    -1,    -1}},
+    {0x26B501, {   -1,    -1,  5735,    -1,    -1}},
+    {0x26B507, {   -1,    -1,  8182,    -1,    -1}},
+    {0x26B509, {   -1,    -1, 10238,    -1,    -1}},
+    {0x26B601, {   -1,    -1,  5796,    -1,    -1}},
+    {0x26B609, {   -1,    -1, 10299,    -1,    -1}},
+    {0x26B801, {   -1,   211,  5864,    -1,    -1}},
+    {0x26B803, {   -1,    -1,  6448,    -1,    -1}},
+    {0x26B805, {   -1,    -1,  6896,    -1,    -1}},
+    {0x26B807, {   -1,    -1,  8258,    -1,    -1}},
+    {0x26B809, {   -1,    -1, 10367,    -1,    -1}},
+    {0x26B8F1, {   -1,    -1,    -1,   430,    -1}},
+    {0x26B901, {   -1,    -1,  5925,    -1,    -1}},
+    {0x26B905, {   -1,    -1,  6951,    -1,    -1}},
+    {0x26B907, {   -1,    -1,  8319,    -1,    -1}},
+    {0x26B909, {   -1,    -1, 10428,    -1,    -1}},
+    {0x26BA01, {   -1,    -1,  5978,    -1,    -1}},
+    {0x26BA07, {   -1,    -1,  8372,    -1,    -1}},
+    {0x26BA09, {   -1,    -1, 10481,    -1,    -1}},
+    {0x26BB01, {   -1,    -1,  6053,    -1,    -1}},
+    {0x26BB09, {   -1,    -1, 10556,    -1,    -1}},
+    {0x26BC01, {   -1,    -1,  6142,    -1,    -1}},
+    {0x26BC09, {   -1,    -1, 10645,    -1,    -1}},
+    {0x26BD01, {   -1,    -1,  6197,    -1,    -1}},
+    {0x26BD09, {   -1,    -1, 10700,    -1,    -1}},
+    {0x26BE01, {   -1,    -1,  6254,    -1,    -1}},
+    {0x26BE09, {   -1,    -1, 10757,    -1,    -1}},
+    {0x26FE00, {  982,    -1,    -1,    -1,    -1}},
+    {0x26FF00, { 1110,    -1,    -1,    -1,    -1}},
+    {0x26FF01, { 2655,    -1,    -1,    -1,    -1}},
+    {0x26FF03, {   -1,    -1,  6491,    -1,    -1}},
+    {0x270000, {   -1,    -1,    -1,    -1,    78}},
+    {0x270001, {   -1,    -1,    -1,    -1,   171}},
+    {0x270002, {   -1,    -1,   563,    -1,    -1}},
+    {0x270003, {   -1,    -1,  6325,    -1,    -1}},
+    {0x270005, {   -1,    -1,  6576,    -1,    -1}},
+    {0x270007, {   -1,    -1,  7039,    -1,    -1}},
+    {0x270009, {   -1,    -1,  8465,    -1,    -1}},
+    {0x2700F1, {   -1,    -1,    -1,   307,    -1}},
+    {0x2700F2, {   -1,    -1,    -1,    78,    -1}},
+    {0x270100, {   -1,    -1,    78,    -1,    -1}},
+    {0x270101, {   -1,    -1,  4082,    -1,    -1}},
+    {0x270109, {   -1,    -1,  8585,    -1,    -1}},
+    {0x2701FE, {   -1,    -1,  3956,    -1,    -1}},
+    {0x270200, {   -1,    -1,   206,    -1,    -1}},
+    {0x270201, { 1605,    -1,  4183,    -1,    -1}},
+    {0x270209, {   -1,    -1,  8686,    -1,    -1}},
+    {0x270300, {   -1,    -1,   334,    -1,    -1}},
+    {0x270301, { 1672,    -1,    -1,    -1,    -1}},
+    {0x270302, {   -1,    -1,   715,    -1,    -1}},
+    {0x270400, {   -1,    -1,   462,    -1,    -1}},
+    {0x270402, {   -1,    -1,   806,    -1,    -1}},
+    {0x270901, { 1914,    -1,  4322,    -1,    -1}},
+    {0x270907, {   -1,    -1,  7237,    -1,    -1}},
+    {0x270909, {   -1,    -1,  8825,    -1,    -1}},
+    {0x270A01, {   -1,    -1,  4401,    -1,    -1}},
+    {0x270A07, {   -1,    -1,  7307,    -1,    -1}},
+    {0x270A09, {   -1,    -1,  8904,    -1,    -1}},
+    {0x270B01, {   -1,    -1,  4451,    -1,    -1}},
+    {0x270B07, {   -1,    -1,  7347,    -1,    -1}},
+    {0x270B09, {   -1,    -1,  8954,    -1,    -1}},
+    {0x270D01, {   -1,    -1,  4551,    -1,    -1}},
+    {0x270D09, {   -1,    -1,  9054,    -1,    -1}},
+    {0x271101, { 1966,    -1,    -1,    -1,    -1}},
+    {0x271801, { 1982,    -1,    -1,    -1,    -1}},
+    {0x271807, {   -1,    -1,  7413,    -1,    -1}},
+    {0x271901, { 2009,    -1,  4697,    -1,    -1}},
+    {0x271907, {   -1,    -1,  7454,    -1,    -1}},
+    {0x271909, {   -1,    -1,  9200,    -1,    -1}},
+    {0x271A01, { 2056,    -1,  4733,    -1,    -1}},
+    {0x271A05, {   -1,    -1,  6671,    -1,    -1}},
+    {0x271A07, {   -1,    -1,  7495,    -1,    -1}},
+    {0x271A09, {   -1,    -1,  9236,    -1,    -1}},
+    {0x271B01, { 2084,    -1,  4782,    -1,    -1}},
+    {0x271B07, {   -1,    -1,  7536,    -1,    -1}},
+    {0x271B09, {   -1,    -1,  9285,    -1,    -1}},
+    {0x271C01, { 2127,    -1,  4823,    -1,    -1}},
+    {0x271C07, {   -1,    -1,  7577,    -1,    -1}},
+    {0x271C09, {   -1,    -1,  9326,    -1,    -1}},
+    {0x271D01, { 2171,    -1,  4864,    -1,    -1}},
+    {0x271D07, {   -1,    -1,  7618,    -1,    -1}},
+    {0x271D09, {   -1,    -1,  9367,    -1,    -1}},
+    {0x271E01, { 2218,    -1,  4899,    -1,    -1}},
+    {0x271E07, {   -1,    -1,  7659,    -1,    -1}},
+    {0x271E09, {   -1,    -1,  9402,    -1,    -1}},
+    {0x271F01, { 2267,    -1,    -1,    -1,    -1}},
+    {0x272001, {   -1,    -1,  4983,    -1,    -1}},
+    {0x272007, {   -1,    -1,  7741,    -1,    -1}},
+    {0x272009, {   -1,    -1,  9486,    -1,    -1}},
+    {0x272101, { 2312,    -1,    -1,    -1,    -1}},
+    {0x272801, {   -1,    -1,  5151,    -1,    -1}},
+    {0x272809, {   -1,    -1,  9654,    -1,    -1}},
+    {0x273001, {   -1,    -1,  5347,    -1,    -1}},
+    {0x273007, {   -1,    -1,  7883,    -1,    -1}},
+    {0x273009, {   -1,    -1,  9850,    -1,    -1}},
+    {0x273101, {   -1,    -1,  5428,    -1,    -1}},
+    {0x273105, {   -1,    -1,  6776,    -1,    -1}},
+    {0x273107, {   -1,    -1,  7964,    -1,    -1}},
+    {0x273109, {   -1,    -1,  9931,    -1,    -1}},
+    {0x273201, {   -1,    -1,  5503,    -1,    -1}},
+    {0x273205, {   -1,    -1,  6836,    -1,    -1}},
+    {0x273207, {   -1,    -1,  8039,    -1,    -1}},
+    {0x273209, {   -1,    -1, 10006,    -1,    -1}},
+    {0x273301, {   -1,    -1,  5590,    -1,    -1}},
+    {0x273309, {   -1,    -1, 10093,    -1,    -1}},
+    {0x273401, {   -1,    -1,  5677,    -1,    -1}},
+    {0x273407, {   -1,    -1,  8126,    -1,    -1}},
+    {0x273409, {   -1,    -1, 10180,    -1,    -1}},
+    {0x273501, {   -1,    -1,  5736,    -1,    -1}},
+    {0x273507, {   -1,    -1,  8183,    -1,    -1}},
+    {0x273509, {   -1,    -1, 10239,    -1,    -1}},
+    {0x273601, {   -1,    -1,  5797,    -1,    -1}},
+    {0x273609, {   -1,    -1, 10300,    -1,    -1}},
+    {0x273801, {   -1,   212,  5865,    -1,    -1}},
+    {0x273803, {   -1,    -1,  6449,    -1,    -1}},
+    {0x273805, {   -1,    -1,  6897,    -1,    -1}},
+    {0x273807, {   -1,    -1,  8259,    -1,    -1}},
+    {0x273809, {   -1,    -1, 10368,    -1,    -1}},
+    {0x2738F1, {   -1,    -1,    -1,   431,    -1}},
+    {0x273901, {   -1,    -1,  5926,    -1,    -1}},
+    {0x273905, {   -1,    -1,  6952,    -1,    -1}},
+    {0x273907, {   -1,    -1,  8320,    -1,    -1}},
+    {0x273909, {   -1,    -1, 10429,    -1,    -1}},
+    {0x273A01, {   -1,    -1,  5979,    -1,    -1}},
+    {0x273A07, {   -1,    -1,  8373,    -1,    -1}},
+    {0x273A09, {   -1,    -1, 10482,    -1,    -1}},
+    {0x273B01, {   -1,    -1,  6054,    -1,    -1}},
+    {0x273B09, {   -1,    -1, 10557,    -1,    -1}},
+    {0x273C01, {   -1,    -1,  6143,    -1,    -1}},
+    {0x273C09, {   -1,    -1, 10646,    -1,    -1}},
+    {0x273D01, {   -1,    -1,  6198,    -1,    -1}},
+    {0x273D09, {   -1,    -1, 10701,    -1,    -1}},
+    {0x273E01, {   -1,    -1,  6255,    -1,    -1}},
+    {0x273E09, {   -1,    -1, 10758,    -1,    -1}},
+    {0x274000, {  337,    -1,    -1,    -1,    -1}},
+    {0x274001, { 2474,    -1,    -1,    -1,    -1}},
+    {0x277E00, {  983,    -1,    -1,    -1,    -1}},
+    {0x277F00, { 1111,    -1,    -1,    -1,    -1}},
+    {0x277F01, { 2656,    -1,    -1,    -1,    -1}},
+    {0x277F03, {   -1,    -1,  6492,    -1,    -1}},
+    {0x278000, {   -1,    -1,    -1,    -1,    79}},
+    {0x278001, {   -1,    -1,    -1,    -1,   172}},
+    {0x278003, {   -1,    -1,  6326,    -1,    -1}},
+    {0x278005, {   -1,    -1,  6577,    -1,    -1}},
+    {0x278007, {   -1,    -1,  7040,    -1,    -1}},
+    {0x278009, {   -1,    -1,  8466,    -1,    -1}},
+    {0x2780F1, {   -1,    -1,    -1,   308,    -1}},
+    {0x2780F2, {   -1,    -1,    -1,    79,    -1}},
+    {0x278100, {   -1,    -1,    79,    -1,    -1}},
+    {0x278101, {   -1,    -1,  4083,    -1,    -1}},
+    {0x278109, {   -1,    -1,  8586,    -1,    -1}},
+    {0x2781FE, {   -1,    -1,  3957,    -1,    -1}},
+    {0x278200, {   -1,    -1,   207,    -1,    -1}},
+    {0x278201, { 1606,    -1,  4184,    -1,    -1}},
+    {0x278209, {   -1,    -1,  8687,    -1,    -1}},
+    {0x278300, {   -1,    -1,   335,    -1,    -1}},
+    {0x278301, { 1673,    -1,    -1,    -1,    -1}},
+    {0x278400, {   -1,    -1,   463,    -1,    -1}},
+    {0x278401, { 1727,    -1,    -1,    -1,    -1}},
+    {0x278501, { 1775,    -1,    -1,    -1,    -1}},
+    {0x278601, { 1821,    -1,    -1,    -1,    -1}},
+    {0x278701, { 1868,    -1,    -1,    -1,    -1}},
+    {0x278901, { 1915,    -1,  4323,    -1,    -1}},
+    {0x278907, {   -1,    -1,  7238,    -1,    -1}},
+    {0x278909, {   -1,    -1,  8826,    -1,    -1}},
+    {0x278A01, {   -1,    -1,  4402,    -1,    -1}},
+    {0x278A07, {   -1,    -1,  7308,    -1,    -1}},
+    {0x278A09, {   -1,    -1,  8905,    -1,    -1}},
+    {0x278B01, {   -1,    -1,  4452,    -1,    -1}},
+    {0x278B07, {   -1,    -1,  7348,    -1,    -1}},
+    {0x278B09, {   -1,    -1,  8955,    -1,    -1}},
+    {0x278D01, {   -1,    -1,  4552,    -1,    -1}},
+    {0x278D09, {   -1,    -1,  9055,    -1,    -1}},
+    {0x279101, { 1967,    -1,    -1,    -1,    -1}},
+    {0x279801, { 1983,    -1,    -1,    -1,    -1}},
+    {0x279807, {   -1,    -1,  7414,    -1,    -1}},
+    {0x279901, { 2010,    -1,  4698,    -1,    -1}},
+    {0x279907, {   -1,    -1,  7455,    -1,    -1}},
+    {0x279909, {   -1,    -1,  9201,    -1,    -1}},
+    {0x279A01, { 2057,    -1,  4734,    -1,    -1}},
+    {0x279A05, {   -1,    -1,  6672,    -1,    -1}},
+    {0x279A07, {   -1,    -1,  7496,    -1,    -1}},
+    {0x279A09, {   -1,    -1,  9237,    -1,    -1}},
+    {0x279B01, { 2085,    -1,  4783,    -1,    -1}},
+    {0x279B07, {   -1,    -1,  7537,    -1,    -1}},
+    {0x279B09, {   -1,    -1,  9286,    -1,    -1}},
+    {0x279C01, { 2128,    -1,  4824,    -1,    -1}},
+    {0x279C07, {   -1,    -1,  7578,    -1,    -1}},
+    {0x279C09, {   -1,    -1,  9327,    -1,    -1}},
+    {0x279D01, { 2172,    -1,  4865,    -1,    -1}},
+    {0x279D07, {   -1,    -1,  7619,    -1,    -1}},
+    {0x279D09, {   -1,    -1,  9368,    -1,    -1}},
+    {0x279E01, { 2219,    -1,  4900,    -1,    -1}},
+    {0x279E07, {   -1,    -1,  7660,    -1,    -1}},
+    {0x279E09, {   -1,    -1,  9403,    -1,    -1}},
+    {0x279F01, { 2268,    -1,    -1,    -1,    -1}},
+    {0x27A001, {   -1,    -1,  4984,    -1,    -1}},
+    {0x27A007, {   -1,    -1,  7742,    -1,    -1}},
+    {0x27A009, {   -1,    -1,  9487,    -1,    -1}},
+    {0x27A101, { 2313,    -1,    -1,    -1,    -1}},
+    {0x27A801, {   -1,    -1,  5152,    -1,    -1}},
+    {0x27A809, {   -1,    -1,  9655,    -1,    -1}},
+    {0x27A901, { 2354,    -1,    -1,    -1,    -1}},
+    {0x27B001, {   -1,    -1,  5348,    -1,    -1}},
+    {0x27B007, {   -1,    -1,  7884,    -1,    -1}},
+    {0x27B009, {   -1,    -1,  9851,    -1,    -1}},
+    {0x27B101, {   -1,    -1,  5429,    -1,    -1}},
+    {0x27B105, {   -1,    -1,  6777,    -1,    -1}},
+    {0x27B107, {   -1,    -1,  7965,    -1,    -1}},
+    {0x27B109, {   -1,    -1,  9932,    -1,    -1}},
+    {0x27B201, {   -1,    -1,  5504,    -1,    -1}},
+    {0x27B205, {   -1,    -1,  6837,    -1,    -1}},
+    {0x27B207, {   -1,    -1,  8040,    -1,    -1}},
+    {0x27B209, {   -1,    -1, 10007,    -1,    -1}},
+    {0x27B301, {   -1,    -1,  5591,    -1,    -1}},
+    {0x27B309, {   -1,    -1, 10094,    -1,    -1}},
+    {0x27B401, {   -1,    -1,  5678,    -1,    -1}},
+    {0x27B407, {   -1,    -1,  8127,    -1,    -1}},
+    {0x27B409, {   -1,    -1, 10181,    -1,    -1}},
+    {0x27B501, {   -1,    -1,  5737,    -1,    -1}},
+    {0x27B507, {   -1,    -1,  8184,    -1,    -1}},
+    {0x27B509, {   -1,    -1, 10240,    -1,    -1}},
+    {0x27B601, {   -1,    -1,  5798,    -1,    -1}},
+    {0x27B609, {   -1,    -1, 10301,    -1,    -1}},
+    {0x27B801, {   -1,   213,  5866,    -1,    -1}},
+    {0x27B803, {   -1,    -1,  6450,    -1,    -1}},
+    {0x27B805, {   -1,    -1,  6898,    -1,    -1}},
+    {0x27B807, {   -1,    -1,  8260,    -1,    -1}},
+    {0x27B809, {   -1,    -1, 10369,    -1,    -1}},
+    {0x27B8F1, {   -1,    -1,    -1,   432,    -1}},
+    {0x27B901, {   -1,    -1,  5927,    -1,    -1}},
+    {0x27B905, {   -1,    -1,  6953,    -1,    -1}},
+    {0x27B907, {   -1,    -1,  8321,    -1,    -1}},
+    {0x27B909, {   -1,    -1, 10430,    -1,    -1}},
+    {0x27BA01, {   -1,    -1,  5980,    -1,    -1}},
+    {0x27BA07, {   -1,    -1,  8374,    -1,    -1}},
+    {0x27BA09, {   -1,    -1, 10483,    -1,    -1}},
+    {0x27BB01, {   -1,    -1,  6055,    -1,    -1}},
+    {0x27BB09, {   -1,    -1, 10558,    -1,    -1}},
+    {0x27BC01, {   -1,    -1,  6144,    -1,    -1}},
+    {0x27BC09, {   -1,    -1, 10647,    -1,    -1}},
+    {0x27BD01, {   -1,    -1,  6199,    -1,    -1}},
+    {0x27BD09, {   -1,    -1, 10702,    -1,    -1}},
+    {0x27BE01, {   -1,    -1,  6256,    -1,    -1}},
+    {0x27BE09, {   -1,    -1, 10759,    -1,    -1}},
+    {0x27C000, {  338,    -1,    -1,    -1,    -1}},
+    {0x27C001, { 2475,    -1,    -1,    -1,    -1}},
+    {0x27C101, { 2523,    -1,    -1,    -1,    -1}},
+    {0x27C201, { 2571,    -1,    -1,    -1,    -1}},
+    {0x27FE00, {  984,    -1,    -1,    -1,    -1}},
+    {0x27FF00, { 1112,    -1,    -1,    -1,    -1}},
+    {0x27FF01, { 2657,    -1,    -1,    -1,    -1}},
+    {0x27FF03, {   -1,    -1,  6493,    -1,    -1}},
+    {0x280000, {   -1,    -1,    -1,    -1,    80}},
+    {0x280001, {   -1,    -1,    -1,    -1,   173}},
+    {0x280002, {   -1,     3,   564,    -1,    -1}},
+    {0x280003, {   -1,    -1,  6327,    -1,    -1}},
+    {0x280004, {   -1,    -1,   883,    -1,    -1}},
+    {0x280005, {   -1,    -1,  6578,    -1,    -1}},
+    {0x280006, {   -1,    -1,  1094,    -1,    -1}},
+    {0x280007, {   -1,    -1,  7041,    -1,    -1}},
+    {0x280008, {   -1,    -1,  1259,    -1,    -1}},
+    {0x280009, {   -1,    -1,  8467,    -1,    -1}},
+    {0x28000A, {   -1,    -1,  1396,    -1,    -1}},
+    {0x28000C, {   -1,    -1,  1509,    -1,    -1}},
+    {0x28000E, {   -1,    -1,  1592,    -1,    -1}},
+    {0x280010, {   -1,    69,  1714,    -1,    -1}},
+    {0x280012, {   -1,    -1,  2098,    -1,    -1}},
+    {0x280014, {   -1,    -1,  2288,    -1,    -1}},
+    {0x280016, {   -1,    -1,  2392,    -1,    -1}},
+    {0x280020, {   -1,    -1,  2656,    -1,    -1}},
+    {0x280022, {   -1,    -1,  2871,    -1,    -1}},
+    {0x280024, {   -1,    -1,  2974,    -1,    -1}},
+    {0x280026, {   -1,    -1,  3039,    -1,    -1}},
+    {0x280028, {   -1,    -1,  3087,    -1,    -1}},
+    {0x28002A, {   -1,    -1,  3119,    -1,    -1}},
+    {0x28002C, {   -1,    -1,  3145,    -1,    -1}},
+    {0x28002E, {   -1,    -1,  3173,    -1,    -1}},
+    {0x280030, {   -1,    -1,  3222,    -1,    -1}},
+    {0x280032, {   -1,    -1,  3341,    -1,    -1}},
+    {0x280034, {   -1,    -1,  3400,    -1,    -1}},
+    {0x280036, {   -1,    -1,  3439,    -1,    -1}},
+    {0x280038, {   -1,    -1,  3464,    -1,    -1}},
+    {0x28003A, {   -1,    -1,  3486,    -1,    -1}},
+    {0x28003C, {   -1,    -1,  3502,    -1,    -1}},
+    {0x28003E, {   -1,    -1,  3517,    -1,    -1}},
+    {0x280040, {   -1,    -1,  3545,    -1,    -1}},
+    {0x280042, {   -1,    -1,  3615,    -1,    -1}},
+    {0x280044, {   -1,    -1,  3645,    -1,    -1}},
+    {0x280046, {   -1,    -1,  3663,    -1,    -1}},
+    {0x280080, { 1295,    -1,    -1,    -1,    -1}},
+    {0x2800F1, {   -1,    -1,    -1,   309,    -1}},
+    {0x2800F2, {   -1,    -1,    -1,    80,    -1}},
+    {0x280100, {   -1,    -1,    80,    -1,    -1}},
+    {0x280101, {   -1,    -1,  4084,    -1,    -1}},
+    {0x280102, {   -1,    -1,   608,    -1,    -1}},
+    {0x280109, {   -1,    -1,  8587,    -1,    -1}},
+    {0x280110, {   -1,    -1,  1784,    -1,    -1}},
+    {0x2801F2, {   -1,    -1,    -1,   170,    -1}},
+    {0x2801FE, {   -1,    -1,  3958,    -1,    -1}},
+    {0x280200, {   -1,    -1,   208,    -1,    -1}},
+    {0x280201, {   -1,    -1,  4185,    -1,    -1}},
+    {0x280202, {   -1,    -1,   643,    -1,    -1}},
+    {0x280204, {   -1,    -1,   930,    -1,    -1}},
+    {0x280206, {   -1,    -1,  1134,    -1,    -1}},
+    {0x280208, {   -1,    -1,  1295,    -1,    -1}},
+    {0x280209, {   -1,    -1,  8688,    -1,    -1}},
+    {0x28020A, {   -1,    -1,  1429,    -1,    -1}},
+    {0x28020C, {   -1,    -1,  1533,    -1,    -1}},
+    {0x280210, {   -1,    -1,  1836,    -1,    -1}},
+    {0x2802F2, {   -1,    -1,    -1,   212,    -1}},
+    {0x280300, {   -1,    -1,   336,    -1,    -1}},
+    {0x280301, { 1674,    -1,    -1,    -1,    -1}},
+    {0x280302, {   -1,    -1,   716,    -1,    -1}},
+    {0x280304, {   -1,    -1,   972,    -1,    -1}},
+    {0x280306, {   -1,    -1,  1161,    -1,    -1}},
+    {0x280308, {   -1,    -1,  1314,    -1,    -1}},
+    {0x28030A, {   -1,    -1,  1443,    -1,    -1}},
+    {0x28030C, {   -1,    -1,  1543,    -1,    -1}},
+    {0x280310, {   -1,    -1,  1916,    -1,    -1}},
+    {0x280312, {   -1,    -1,  2179,    -1,    -1}},
+    {0x280314, {   -1,    -1,  2326,    -1,    -1}},
+    {0x280320, {   -1,    -1,  2761,    -1,    -1}},
+    {0x280322, {   -1,    -1,  2911,    -1,    -1}},
+    {0x280324, {   -1,    -1,  2998,    -1,    -1}},
+    {0x280330, {   -1,    -1,  3276,    -1,    -1}},
+    {0x280332, {   -1,    -1,  3364,    -1,    -1}},
+    {0x280334, {   -1,    -1,  3413,    -1,    -1}},
+    {0x280336, {   -1,    -1,  3448,    -1,    -1}},
+    {0x280400, {   -1,    -1,   464,    -1,    -1}},
+    {0x280402, {   -1,    -1,   807,    -1,    -1}},
+    {0x280404, {   -1,    -1,  1035,    -1,    -1}},
+    {0x280406, {   -1,    -1,  1208,    -1,    -1}},
+    {0x280408, {   -1,    -1,  1350,    -1,    -1}},
+    {0x28040A, {   -1,    -1,  1472,    -1,    -1}},
+    {0x28040C, {   -1,    -1,  1563,    -1,    -1}},
+    {0x28040E, {   -1,    -1,  1629,    -1,    -1}},
+    {0x280410, {   -1,    -1,  2021,    -1,    -1}},
+    {0x280412, {   -1,    -1,  2237,    -1,    -1}},
+    {0x280414, {   -1,    -1,  2358,    -1,    -1}},
+    {0x280416, {   -1,    -1,  2440,    -1,    -1}},
+    {0x280420, {   -1,    -1,  2825,    -1,    -1}},
+    {0x280422, {   -1,    -1,  2946,    -1,    -1}},
+    {0x280424, {   -1,    -1,  3018,    -1,    -1}},
+    {0x280426, {   -1,    -1,  3070,    -1,    -1}},
+    {0x280428, {   -1,    -1,  3106,    -1,    -1}},
+    {0x28042A, {   -1,    -1,  3133,    -1,    -1}},
+    {0x28042C, {   -1,    -1,  3160,    -1,    -1}},
+    {0x28042E, {   -1,    -1,  3187,    -1,    -1}},
+    {0x280430, {   -1,    -1,  3312,    -1,    -1}},
+    {0x280432, {   -1,    -1,  3380,    -1,    -1}},
+    {0x280434, {   -1,    -1,  3425,    -1,    -1}},
+    {0x280436, {   -1,    -1,  3455,    -1,    -1}},
+    {0x280438, {   -1,    -1,  3477,    -1,    -1}},
+    {0x28043A, {   -1,    -1,  3495,    -1,    -1}},
+    {0x28043C, {   -1,    -1,  3510,    -1,    -1}},
+    {0x28043E, {   -1,    -1,  3525,    -1,    -1}},
+    {0x280440, {   -1,    -1,  3594,    -1,    -1}},
+    {0x280442, {   -1,    -1,  3637,    -1,    -1}},
+    {0x280444, {   -1,    -1,  3654,    -1,    -1}},
+    {0x280446, {   -1,    -1,  3674,    -1,    -1}},
+    {0x280600, {   19,    -1,    -1,    -1,    -1}},
+    {0x280800, {   27,    -1,    -1,    -1,    -1}},
+    {0x280901, {   -1,    -1,  4324,    -1,    -1}},
+    {0x280907, {   -1,    -1,  7239,    -1,    -1}},
+    {0x280909, {   -1,    -1,  8827,    -1,    -1}},
+    {0x280A01, {   -1,    -1,  4403,    -1,    -1}},
+    {0x280A07, {   -1,    -1,  7309,    -1,    -1}},
+    {0x280A09, {   -1,    -1,  8906,    -1,    -1}},
+    {0x280B01, {   -1,    -1,  4453,    -1,    -1}},
+    {0x280B07, {   -1,    -1,  7349,    -1,    -1}},
+    {0x280B09, {   -1,    -1,  8956,    -1,    -1}},
+    {0x280D01, {   -1,    -1,  4553,    -1,    -1}},
+    {0x280D09, {   -1,    -1,  9056,    -1,    -1}},
+    {0x281200, {   62,    -1,    -1,    -1,    -1}},
+    {0x281300, {   68,    -1,    -1,    -1,    -1}},
+    {0x281807, {   -1,    -1,  7415,    -1,    -1}},
+    {0x281901, {   -1,    -1,  4699,    -1,    -1}},
+    {0x281907, {   -1,    -1,  7456,    -1,    -1}},
+    {0x281909, {   -1,    -1,  9202,    -1,    -1}},
+    {0x281A01, {   -1,    -1,  4735,    -1,    -1}},
+    {0x281A05, {   -1,    -1,  6673,    -1,    -1}},
+    {0x281A07, {   -1,    -1,  7497,    -1,    -1}},
+    {0x281A09, {   -1,    -1,  9238,    -1,    -1}},
+    {0x281B01, {   -1,    -1,  4784,    -1,    -1}},
+    {0x281B07, {   -1,    -1,  7538,    -1,    -1}},
+    {0x281B09, {   -1,    -1,  9287,    -1,    -1}},
+    {0x281C01, {   -1,    -1,  4825,    -1,    -1}},
+    {0x281C07, {   -1,    -1,  7579,    -1,    -1}},
+    {0x281C09, {   -1,    -1,  9328,    -1,    -1}},
+    {0x281D01, {   -1,    -1,  4866,    -1,    -1}},
+    {0x281D07, {   -1,    -1,  7620,    -1,    -1}},
+    {0x281D09, {   -1,    -1,  9369,    -1,    -1}},
+    {0x281E01, {   -1,    -1,  4901,    -1,    -1}},
+    {0x281E07, {   -1,    -1,  7661,    -1,    -1}},
+    {0x281E09, {   -1,    -1,  9404,    -1,    -1}},
+    {0x282001, {   -1,    -1,  4985,    -1,    -1}},
+    {0x282007, {   -1,    -1,  7743,    -1,    -1}},
+    {0x282009, {   -1,    -1,  9488,    -1,    -1}},
+    {0x282300, {  153,    -1,    -1,    -1,    -1}},
+    {0x282801, {   -1,    -1,  5153,    -1,    -1}},
+    {0x282809, {   -1,    -1,  9656,    -1,    -1}},
+    {0x283001, {   -1,    -1,  5349,    -1,    -1}},
+    {0x283007, {   -1,    -1,  7885,    -1,    -1}},
+    {0x283009, {   -1,    -1,  9852,    -1,    -1}},
+    {0x283101, {   -1,    -1,  5430,    -1,    -1}},
+    {0x283105, {   -1,    -1,  6778,    -1,    -1}},
+    {0x283107, {   -1,    -1,  7966,    -1,    -1}},
+    {0x283109, {   -1,    -1,  9933,    -1,    -1}},
+    {0x283201, {   -1,    -1,  5505,    -1,    -1}},
+    {0x283205, {   -1,    -1,  6838,    -1,    -1}},
+    {0x283207, {   -1,    -1,  8041,    -1,    -1}},
+    {0x283209, {   -1,    -1, 10008,    -1,    -1}},
+    {0x283301, {   -1,    -1,  5592,    -1,    -1}},
+    {0x283309, {   -1,    -1, 10095,    -1,    -1}},
+    {0x283401, {   -1,    -1,  5679,    -1,    -1}},
+    {0x283407, {   -1,    -1,  8128,    -1,    -1}},
+    {0x283409, {   -1,    -1, 10182,    -1,    -1}},
+    {0x283501, {   -1,    -1,  5738,    -1,    -1}},
+    {0x283507, {   -1,    -1,  8185,    -1,    -1}},
+    {0x283509, {   -1,    -1, 10241,    -1,    -1}},
+    {0x283601, {   -1,    -1,  5799,    -1,    -1}},
+    {0x283609, {   -1,    -1, 10302,    -1,    -1}},
+    {0x283801, {   -1,   214,  5867,    -1,    -1}},
+    {0x283803, {   -1,    -1,  6451,    -1,    -1}},
+    {0x283805, {   -1,    -1,  6899,    -1,    -1}},
+    {0x283807, {   -1,    -1,  8261,    -1,    -1}},
+    {0x283809, {   -1,    -1, 10370,    -1,    -1}},
+    {0x2838F1, {   -1,    -1,    -1,   433,    -1}},
+    {0x283901, {   -1,    -1,  5928,    -1,    -1}},
+    {0x283905, {   -1,    -1,  6954,    -1,    -1}},
+    {0x283907, {   -1,    -1,  8322,    -1,    -1}},
+    {0x283909, {   -1,    -1, 10431,    -1,    -1}},
+    {0x283A01, {   -1,    -1,  5981,    -1,    -1}},
+    {0x283A07, {   -1,    -1,  8375,    -1,    -1}},
+    {0x283A09, {   -1,    -1, 10484,    -1,    -1}},
+    {0x283B01, {   -1,    -1,  6056,    -1,    -1}},
+    {0x283B09, {   -1,    -1, 10559,    -1,    -1}},
+    {0x283C01, {   -1,    -1,  6145,    -1,    -1}},
+    {0x283C09, {   -1,    -1, 10648,    -1,    -1}},
+    {0x283D01, {   -1,    -1,  6200,    -1,    -1}},
+    {0x283D09, {   -1,    -1, 10703,    -1,    -1}},
+    {0x283E01, {   -1,    -1,  6257,    -1,    -1}},
+    {0x283E09, {   -1,    -1, 10760,    -1,    -1}},
+    {0x284000, {  339,    -1,    -1,    -1,    -1}},
+    {0x284100, {  426,    -1,    -1,    -1,    -1}},
+    {0x284200, {  499,    -1,    -1,    -1,    -1}},
+    {0x284300, {  562,    -1,    -1,    -1,    -1}},
+    {0x284400, {  603,    -1,    -1,    -1,    -1}},
+    {0x284500, {  635,    -1,    -1,    -1,    -1}},
+    {0x284600, {  665,    -1,    -1,    -1,    -1}},
+    {0x284700, {  691,    -1,    -1,    -1,    -1}},
+    {0x284800, {  712,    -1,    -1,    -1,    -1}},
+    {0x284900, {  730,    -1,    -1,    -1,    -1}},
+    {0x284A00, {  748,    -1,    -1,    -1,    -1}},
+    {0x284B00, {  763,    -1,    -1,    -1,    -1}},
+    {0x284C00, {  775,    -1,    -1,    -1,    -1}},
+    {0x284D00, {  785,    -1,    -1,    -1,    -1}},
+    {0x284E00, {  794,    -1,    -1,    -1,    -1}},
+    {0x284F00, {  801,    -1,    -1,    -1,    -1}},
+    {0x285000, {  806,    -1,    -1,    -1,    -1}},
+    {0x287E00, {  985,    -1,    -1,    -1,    -1}},
+    {0x287F00, { 1113,    -1,    -1,    -1,    -1}},
+    {0x287F01, { 2658,    -1,    -1,    -1,    -1}},
+    {0x287F03, {   -1,    -1,  6494,    -1,    -1}},
+    {0x288000, {   -1,    -1,    -1,    -1,    81}},
+    {0x288001, {   -1,    -1,    -1,    -1,   174}},
+    {0x288002, {   -1,     4,   565,    -1,    -1}},
+    {0x288003, {   -1,    -1,  6328,    -1,    -1}},
+    {0x288004, {   -1,    -1,   884,    -1,    -1}},
+    {0x288005, {   -1,    -1,  6579,    -1,    -1}},
+    {0x288006, {   -1,    -1,  1095,    -1,    -1}},
+    {0x288007, {   -1,    -1,  7042,    -1,    -1}},
+    {0x288008, {   -1,    -1,  1260,    -1,    -1}},
+    {0x288009, {   -1,    -1,  8468,    -1,    -1}},
+    {0x28800A, {   -1,    -1,  1397,    -1,    -1}},
+    {0x28800C, {   -1,    -1,  1510,    -1,    -1}},
+    {0x28800E, {   -1,    -1,  1593,    -1,    -1}},
+    {0x288010, {   -1,    70,  1715,    -1,    -1}},
+    {0x288012, {   -1,    -1,  2099,    -1,    -1}},
+    {0x288014, {   -1,    -1,  2289,    -1,    -1}},
+    {0x288016, {   -1,    -1,  2393,    -1,    -1}},
+    {0x288018, {   -1,    -1,  2472,    -1,    -1}},
+    {0x28801A, {   -1,    -1,  2526,    -1,    -1}},
+    {0x28801C, {   -1,    -1,  2564,    -1,    -1}},
+    {0x28801E, {   -1,    -1,  2590,    -1,    -1}},
+    {0x288020, {   -1,    -1,  2657,    -1,    -1}},
+    {0x288022, {   -1,    -1,  2872,    -1,    -1}},
+    {0x288024, {   -1,    -1,  2975,    -1,    -1}},
+    {0x288030, {   -1,    -1,  3223,    -1,    -1}},
+    {0x288032, {   -1,    -1,  3342,    -1,    -1}},
+    {0x288034, {   -1,    -1,  3401,    -1,    -1}},
+    {0x288036, {   -1,    -1,  3440,    -1,    -1}},
+    {0x288038, {   -1,    -1,  3465,    -1,    -1}},
+    {0x28803A, {   -1,    -1,  3487,    -1,    -1}},
+    {0x28803C, {   -1,    -1,  3503,    -1,    -1}},
+    {0x28803E, {   -1,    -1,  3518,    -1,    -1}},
+    {0x288040, {   -1,    -1,  3546,    -1,    -1}},
+    {0x288042, {   -1,    -1,  3616,    -1,    -1}},
+    {0x288044, {   -1,    -1,  3646,    -1,    -1}},
+    {0x288046, {   -1,    -1,  3664,    -1,    -1}},
+    {0x288048, {   -1,    -1,  3682,    -1,    -1}},
+    {0x288050, {   -1,    -1,  3721,    -1,    -1}},
+    {0x288052, {   -1,    -1,  3748,    -1,    -1}},
+    {0x288054, {   -1,    -1,  3765,    -1,    -1}},
+    {0x288056, {   -1,    -1,  3781,    -1,    -1}},
+    {0x288058, {   -1,    -1,  3792,    -1,    -1}},
+    {0x28805A, {   -1,    -1,  3800,    -1,    -1}},
+    {0x28805C, {   -1,    -1,  3805,    -1,    -1}},
+    {0x28805E, {   -1,    -1,  3809,    -1,    -1}},
+    {0x288080, { 1296,    -1,    -1,    -1,    -1}},
+    {0x2880F1, {   -1,    -1,    -1,   310,    -1}},
+    {0x2880F2, {   -1,    -1,    -1,    81,    -1}},
+    {0x288100, {   -1,    -1,    81,    -1,    -1}},
+    {0x288101, {   -1,    -1,  4085,    -1,    -1}},
+    {0x288102, {   -1,    -1,   609,    -1,    -1}},
+    {0x288109, {   -1,    -1,  8588,    -1,    -1}},
+    {0x288110, {   -1,    -1,  1785,    -1,    -1}},
+    {0x2881F2, {   -1,    -1,    -1,   171,    -1}},
+    {0x2881FE, {   -1,    -1,  3959,    -1,    -1}},
+    {0x288200, {   -1,    -1,   209,    -1,    -1}},
+    {0x288201, {   -1,    -1,  4186,    -1,    -1}},
+    {0x288202, {   -1,    -1,   644,    -1,    -1}},
+    {0x288204, {   -1,    -1,   931,    -1,    -1}},
+    {0x288206, {   -1,    -1,  1135,    -1,    -1}},
+    {0x288208, {   -1,    -1,  1296,    -1,    -1}},
+    {0x288209, {   -1,    -1,  8689,    -1,    -1}},
+    {0x28820A, {   -1,    -1,  1430,    -1,    -1}},
+    {0x28820C, {   -1,    -1,  1534,    -1,    -1}},
+    {0x28820E, {   -1,    -1,  1611,    -1,    -1}},
+    {0x288210, {   -1,    -1,  1837,    -1,    -1}},
+    {0x288220, {   -1,    -1,  2711,    -1,    -1}},
+    {0x2882F2, {   -1,    -1,    -1,   213,    -1}},
+    {0x288300, {   -1,    -1,   337,    -1,    -1}},
+    {0x288301, { 1675,    -1,    -1,    -1,    -1}},
+    {0x288302, {   -1,    -1,   717,    -1,    -1}},
+    {0x288304, {   -1,    -1,   973,    -1,    -1}},
+    {0x288306, {   -1,    -1,  1162,    -1,    -1}},
+    {0x288308, {   -1,    -1,  1315,    -1,    -1}},
+    {0x28830A, {   -1,    -1,  1444,    -1,    -1}},
+    {0x28830C, {   -1,    -1,  1544,    -1,    -1}},
+    {0x28830E, {   -1,    -1,  1616,    -1,    -1}},
+    {0x288310, {   -1,    -1,  1917,    -1,    -1}},
+    {0x288312, {   -1,    -1,  2180,    -1,    -1}},
+    {0x288316, {   -1,    -1,  2418,    -1,    -1}},
+    {0x288320, {   -1,    -1,  2762,    -1,    -1}},
+    {0x288322, {   -1,    -1,  2912,    -1,    -1}},
+    {0x288324, {   -1,    -1,  2999,    -1,    -1}},
+    {0x288330, {   -1,    -1,  3277,    -1,    -1}},
+    {0x288332, {   -1,    -1,  3365,    -1,    -1}},
+    {0x288334, {   -1,    -1,  3414,    -1,    -1}},
+    {0x288336, {   -1,    -1,  3449,    -1,    -1}},
+    {0x288338, {   -1,    -1,  3473,    -1,    -1}},
+    {0x28833A, {   -1,    -1,  3492,    -1,    -1}},
+    {0x28833C, {   -1,    -1,  3507,    -1,    -1}},
+    {0x28833E, {   -1,    -1,  3522,    -1,    -1}},
+    {0x288340, {   -1,    -1,  3575,    -1,    -1}},
+    {0x288342, {   -1,    -1,  3624,    -1,    -1}},
+    {0x288344, {   -1,    -1,  3648,    -1,    -1}},
+    {0x288346, {   -1,    -1,  3667,    -1,    -1}},
+    {0x288350, {   -1,    -1,  3732,    -1,    -1}},
+    {0x288352, {   -1,    -1,  3754,    -1,    -1}},
+    {0x288354, {   -1,    -1,  3771,    -1,    -1}},
+    {0x288356, {   -1,    -1,  3785,    -1,    -1}},
+    {0x288358, {   -1,    -1,  3795,    -1,    -1}},
+    {0x28835A, {   -1,    -1,  3802,    -1,    -1}},
+    {0x2883F2, {   -1,    -1,    -1,   234,    -1}},
+    {0x288400, {   -1,    -1,   465,    -1,    -1}},
+    {0x288402, {   -1,    -1,   808,    -1,    -1}},
+    {0x288404, {   -1,    -1,  1036,    -1,    -1}},
+    {0x288406, {   -1,    -1,  1209,    -1,    -1}},
+    {0x288408, {   -1,    -1,  1351,    -1,    -1}},
+    {0x28840A, {   -1,    -1,  1473,    -1,    -1}},
+    {0x28840C, {   -1,    -1,  1564,    -1,    -1}},
+    {0x28840E, {   -1,    -1,  1630,    -1,    -1}},
+    {0x288410, {   -1,    -1,  2022,    -1,    -1}},
+    {0x288412, {   -1,    -1,  2238,    -1,    -1}},
+    {0x288414, {   -1,    -1,  2359,    -1,    -1}},
+    {0x288416, {   -1,    -1,  2441,    -1,    -1}},
+    {0x288418, {   -1,    -1,  2506,    -1,    -1}},
+    {0x28841A, {   -1,    -1,  2547,    -1,    -1}},
+    {0x28841C, {   -1,    -1,  2579,    -1,    -1}},
+    {0x28841E, {   -1,    -1,  2603,    -1,    -1}},
+    {0x288420, {   -1,    -1,  2826,    -1,    -1}},
+    {0x288422, {   -1,    -1,  2947,    -1,    -1}},
+    {0x288424, {   -1,    -1,  3019,    -1,    -1}},
+    {0x288430, {   -1,    -1,  3313,    -1,    -1}},
+    {0x288432, {   -1,    -1,  3381,    -1,    -1}},
+    {0x288434, {   -1,    -1,  3426,    -1,    -1}},
+    {0x288436, {   -1,    -1,  3456,    -1,    -1}},
+    {0x288438, {   -1,    -1,  3478,    -1,    -1}},
+    {0x28843A, {   -1,    -1,  3496,    -1,    -1}},
+    {0x28843C, {   -1,    -1,  3511,    -1,    -1}},
+    {0x28843E, {   -1,    -1,  3526,    -1,    -1}},
+    {0x288440, {   -1,    -1,  3595,    -1,    -1}},
+    {0x288442, {   -1,    -1,  3638,    -1,    -1}},
+    {0x288444, {   -1,    -1,  3655,    -1,    -1}},
+    {0x288446, {   -1,    -1,  3675,    -1,    -1}},
+    {0x288448, {   -1,    -1,  3689,    -1,    -1}},
+    {0x288450, {   -1,    -1,  3739,    -1,    -1}},
+    {0x288452, {   -1,    -1,  3757,    -1,    -1}},
+    {0x288454, {   -1,    -1,  3774,    -1,    -1}},
+    {0x288456, {   -1,    -1,  3787,    -1,    -1}},
+    {0x288458, {   -1,    -1,  3797,    -1,    -1}},
+    {0x28845A, {   -1,    -1,  3803,    -1,    -1}},
+    {0x28845C, {   -1,    -1,  3807,    -1,    -1}},
+    {0x28845E, {   -1,    -1,  3810,    -1,    -1}},
+    {0x2884F2, {   -1,    -1,    -1,   243,    -1}},
+    {0x288600, {   20,    -1,    -1,    -1,    -1}},
+    {0x288800, {   28,    -1,    -1,    -1,    -1}},
+    {0x288901, {   -1,    -1,  4325,    -1,    -1}},
+    {0x288907, {   -1,    -1,  7240,    -1,    -1}},
+    {0x288909, {   -1,    -1,  8828,    -1,    -1}},
+    {0x288A01, {   -1,    -1,  4404,    -1,    -1}},
+    {0x288A07, {   -1,    -1,  7310,    -1,    -1}},
+    {0x288A09, {   -1,    -1,  8907,    -1,    -1}},
+    {0x288B01, {   -1,    -1,  4454,    -1,    -1}},
+    {0x288B07, {   -1,    -1,  7350,    -1,    -1}},
+    {0x288B09, {   -1,    -1,  8957,    -1,    -1}},
+    {0x288D01, {   -1,    -1,  4554,    -1,    -1}},
+    {0x288D09, {   -1,    -1,  9057,    -1,    -1}},
+    {0x289200, {   63,    -1,    -1,    -1,    -1}},
+    {0x289300, {   69,    -1,    -1,    -1,    -1}},
+    {0x289400, {   74,    -1,    -1,    -1,    -1}},
+    {0x289800, {   86,    -1,    -1,    -1,    -1}},
+    {0x289807, {   -1,    -1,  7416,    -1,    -1}},
+    {0x289900, {   90,    -1,    -1,    -1,    -1}},
+    {0x289901, {   -1,    -1,  4700,    -1,    -1}},
+    {0x289907, {   -1,    -1,  7457,    -1,    -1}},
+    {0x289909, {   -1,    -1,  9203,    -1,    -1}},
+    {0x289A00, {   91,    -1,    -1,    -1,    -1}},
+    {0x289A01, {   -1,    -1,  4736,    -1,    -1}},
+    {0x289A05, {   -1,    -1,  6674,    -1,    -1}},
+    {0x289A07, {   -1,    -1,  7498,    -1,    -1}},
+    {0x289A09, {   -1,    -1,  9239,    -1,    -1}},
+    {0x289B00, {   98,    -1,    -1,    -1,    -1}},
+    {0x289B01, {   -1,    -1,  4785,    -1,    -1}},
+    {0x289B07, {   -1,    -1,  7539,    -1,    -1}},
+    {0x289B09, {   -1,    -1,  9288,    -1,    -1}},
+    {0x289C01, {   -1,    -1,  4826,    -1,    -1}},
+    {0x289C07, {   -1,    -1,  7580,    -1,    -1}},
+    {0x289C09, {   -1,    -1,  9329,    -1,    -1}},
+    {0x289D01, {   -1,    -1,  4867,    -1,    -1}},
+    {0x289D07, {   -1,    -1,  7621,    -1,    -1}},
+    {0x289D09, {   -1,    -1,  9370,    -1,    -1}},
+    {0x289E01, {   -1,    -1,  4902,    -1,    -1}},
+    {0x289E07, {   -1,    -1,  7662,    -1,    -1}},
+    {0x289E09, {   -1,    -1,  9405,    -1,    -1}},
+    {0x28A000, {  130,    -1,    -1,    -1,    -1}},
+    {0x28A001, {   -1,    -1,  4986,    -1,    -1}},
+    {0x28A007, {   -1,    -1,  7744,    -1,    -1}},
+    {0x28A009, {   -1,    -1,  9489,    -1,    -1}},
+    {0x28A300, {  154,    -1,    -1,    -1,    -1}},
+    {0x28A400, {  161,    -1,    -1,    -1,    -1}},
+    {0x28A800, {  212,    -1,    -1,    -1,    -1}},
+    {0x28A801, {   -1,    -1,  5154,    -1,    -1}},
+    {0x28A809, {   -1,    -1,  9657,    -1,    -1}},
+    {0x28A900, {  238,    -1,    -1,    -1,    -1}},
+    {0x28AD00, {  268,    -1,    -1,    -1,    -1}},
+    {0x28B001, {   -1,    -1,  5350,    -1,    -1}},
+    {0x28B007, {   -1,    -1,  7886,    -1,    -1}},
+    {0x28B009, {   -1,    -1,  9853,    -1,    -1}},
+    {0x28B101, {   -1,    -1,  5431,    -1,    -1}},
+    {0x28B105, {   -1,    -1,  6779,    -1,    -1}},
+    {0x28B107, {   -1,    -1,  7967,    -1,    -1}},
+    {0x28B109, {   -1,    -1,  9934,    -1,    -1}},
+    {0x28B201, {   -1,    -1,  5506,    -1,    -1}},
+    {0x28B205, {   -1,    -1,  6839,    -1,    -1}},
+    {0x28B207, {   -1,    -1,  8042,    -1,    -1}},
+    {0x28B209, {   -1,    -1, 10009,    -1,    -1}},
+    {0x28B301, {   -1,    -1,  5593,    -1,    -1}},
+    {0x28B309, {   -1,    -1, 10096,    -1,    -1}},
+    {0x28B401, {   -1,    -1,  5680,    -1,    -1}},
+    {0x28B407, {   -1,    -1,  8129,    -1,    -1}},
+    {0x28B409, {   -1,    -1, 10183,    -1,    -1}},
+    {0x28B501, {   -1,    -1,  5739,    -1,    -1}},
+    {0x28B507, {   -1,    -1,  8186,    -1,    -1}},
+    {0x28B509, {   -1,    -1, 10242,    -1,    -1}},
+    {0x28B601, {   -1,    -1,  5800,    -1,    -1}},
+    {0x28B609, {   -1,    -1, 10303,    -1,    -1}},
+    {0x28B801, {   -1,   215,  5868,    -1,    -1}},
+    {0x28B803, {   -1,    -1,  6452,    -1,    -1}},
+    {0x28B805, {   -1,    -1,  6900,    -1,    -1}},
+    {0x28B807, {   -1,    -1,  8262,    -1,    -1}},
+    {0x28B809, {   -1,    -1, 10371,    -1,    -1}},
+    {0x28B8F1, {   -1,    -1,    -1,   434,    -1}},
+    {0x28B901, {   -1,    -1,  5929,    -1,    -1}},
+    {0x28B905, {   -1,    -1,  6955,    -1,    -1}},
+    {0x28B907, {   -1,    -1,  8323,    -1,    -1}},
+    {0x28B909, {   -1,    -1, 10432,    -1,    -1}},
+    {0x28BA01, {   -1,    -1,  5982,    -1,    -1}},
+    {0x28BA07, {   -1,    -1,  8376,    -1,    -1}},
+    {0x28BA09, {   -1,    -1, 10485,    -1,    -1}},
+    {0x28BB01, {   -1,    -1,  6057,    -1,    -1}},
+    {0x28BB09, {   -1,    -1, 10560,    -1,    -1}},
+    {0x28BC01, {   -1,    -1,  6146,    -1,    -1}},
+    {0x28BC09, {   -1,    -1, 10649,    -1,    -1}},
+    {0x28BD01, {   -1,    -1,  6201,    -1,    -1}},
+    {0x28BD09, {   -1,    -1, 10704,    -1,    -1}},
+    {0x28BE01, {   -1,    -1,  6258,    -1,    -1}},
+    {0x28BE09, {   -1,    -1, 10761,    -1,    -1}},
+    {0x28C000, {  340,    -1,    -1,    -1,    -1}},
+    {0x28C100, {  427,    -1,    -1,    -1,    -1}},
+    {0x28C200, {  500,    -1,    -1,    -1,    -1}},
+    {0x28C300, {  563,    -1,    -1,    -1,    -1}},
+    {0x28C400, {  604,    -1,    -1,    -1,    -1}},
+    {0x28C500, {  636,    -1,    -1,    -1,    -1}},
+    {0x28C600, {  666,    -1,    -1,    -1,    -1}},
+    {0x28C700, {  692,    -1,    -1,    -1,    -1}},
+    {0x28C800, {  713,    -1,    -1,    -1,    -1}},
+    {0x28C900, {  731,    -1,    -1,    -1,    -1}},
+    {0x28CA00, {  749,    -1,    -1,    -1,    -1}},
+    {0x28CB00, {  764,    -1,    -1,    -1,    -1}},
+    {0x28CC00, {  776,    -1,    -1,    -1,    -1}},
+    {0x28CD00, {  786,    -1,    -1,    -1,    -1}},
+    {0x28CE00, {  795,    -1,    -1,    -1,    -1}},
+    {0x28CF00, {  802,    -1,    -1,    -1,    -1}},
+    {0x28D000, {  807,    -1,    -1,    -1,    -1}},
+    {0x28D100, {  811,    -1,    -1,    -1,    -1}},
+    {0x28D200, {  814,    -1,    -1,    -1,    -1}},
+    {0x28D300, {  817,    -1,    -1,    -1,    -1}},
+    {0x28D400, {  820,    -1,    -1,    -1,    -1}},
+    {0x28D500, {  823,    -1,    -1,    -1,    -1}},
+    {0x28D600, {  825,    -1,    -1,    -1,    -1}},
+    {0x28D700, {  827,    -1,    -1,    -1,    -1}},
+    {0x28D800, {  829,    -1,    -1,    -1,    -1}},
+    {0x28D900, {  831,    -1,    -1,    -1,    -1}},
+    {0x28DA00, {  833,    -1,    -1,    -1,    -1}},
+    {0x28DB00, {  835,    -1,    -1,    -1,    -1}},
+    {0x28E000, {  856,    -1,    -1,    -1,    -1}},
+    {0x28FE00, {  986,    -1,    -1,    -1,    -1}},
+    {0x28FF00, { 1114,    -1,    -1,    -1,    -1}},
+    {0x28FF01, { 2659,    -1,    -1,    -1,    -1}},
+    {0x28FF03, {   -1,    -1,  6495,    -1,    -1}},
+    {0x290000, {   -1,    -1,    -1,    -1,    82}},
+    {0x290001, {   -1,    -1,    -1,    -1,   183}},
+    {0x290002, {   -1,    -1,   566,    -1,    -1}},
+    {0x290003, {   -1,    -1,  6329,    -1,    -1}},
+    {0x290004, {   -1,    -1,   885,    -1,    -1}},
+    {0x290005, {   -1,    -1,  6580,    -1,    -1}},
+    {0x290007, {   -1,    -1,  7043,    -1,    -1}},
+    {0x290009, {   -1,    -1,  8469,    -1,    -1}},
+    {0x290010, {   -1,    -1,  1716,    -1,    -1}},
+    {0x290012, {   -1,    -1,  2100,    -1,    -1}},
+    {0x290080, { 1297,    -1,    -1,    -1,    -1}},
+    {0x2900F1, {   -1,    -1,    -1,   311,    -1}},
+    {0x2900F2, {   -1,    -1,    -1,    82,    -1}},
+    {0x290100, {   -1,    -1,    82,    -1,    -1}},
+    {0x290101, {   -1,    -1,  4086,    -1,    -1}},
+    {0x290109, {   -1,    -1,  8589,    -1,    -1}},
+    {0x2901FE, {   -1,    -1,  3960,    -1,    -1}},
+    {0x290200, {   -1,    -1,   210,    -1,    -1}},
+    {0x290201, {   -1,    -1,  4187,    -1,    -1}},
+    {0x290202, {   -1,    -1,   645,    -1,    -1}},
+    {0x290204, {   -1,    -1,   932,    -1,    -1}},
+    {0x290209, {   -1,    -1,  8690,    -1,    -1}},
+    {0x290300, {   -1,    -1,   338,    -1,    -1}},
+    {0x290301, { 1676,    -1,    -1,    -1,    -1}},
+    {0x290302, {   -1,    -1,   718,    -1,    -1}},
+    {0x290304, {   -1,    -1,   974,    -1,    -1}},
+    {0x290400, {   -1,    -1,   466,    -1,    -1}},
+    {0x290402, {   -1,    -1,   809,    -1,    -1}},
+    {0x290404, {   -1,    -1,  1037,    -1,    -1}},
+    {0x290410, {   -1,    -1,  2023,    -1,    -1}},
+    {0x290412, {   -1,    -1,  2239,    -1,    -1}},
+    {0x290901, {   -1,    -1,  4326,    -1,    -1}},
+    {0x290907, {   -1,    -1,  7241,    -1,    -1}},
+    {0x290909, {   -1,    -1,  8829,    -1,    -1}},
+    {0x290A01, {   -1,    -1,  4405,    -1,    -1}},
+    {0x290A07, {   -1,    -1,  7311,    -1,    -1}},
+    {0x290A09, {   -1,    -1,  8908,    -1,    -1}},
+    {0x290B01, {   -1,    -1,  4455,    -1,    -1}},
+    {0x290B07, {   -1,    -1,  7351,    -1,    -1}},
+    {0x290B09, {   -1,    -1,  8958,    -1,    -1}},
+    {0x290D01, {   -1,    -1,  4555,    -1,    -1}},
+    {0x290D09, {   -1,    -1,  9058,    -1,    -1}},
+    {0x291807, {   -1,    -1,  7417,    -1,    -1}},
+    {0x291901, {   -1,    -1,  4701,    -1,    -1}},
+    {0x291907, {   -1,    -1,  7458,    -1,    -1}},
+    {0x291909, {   -1,    -1,  9204,    -1,    -1}},
+    {0x291A01, {   -1,    -1,  4737,    -1,    -1}},
+    {0x291A07, {   -1,    -1,  7499,    -1,    -1}},
+    {0x291A09, {   -1,    -1,  9240,    -1,    -1}},
+    {0x291B01, {   -1,    -1,  4786,    -1,    -1}},
+    {0x291B07, {   -1,    -1,  7540,    -1,    -1}},
+    {0x291B09, {   -1,    -1,  9289,    -1,    -1}},
+    {0x291C01, {   -1,    -1,  4827,    -1,    -1}},
+    {0x291C07, {   -1,    -1,  7581,    -1,    -1}},
+    {0x291C09, {   -1,    -1,  9330,    -1,    -1}},
+    {0x291D01, {   -1,    -1,  4868,    -1,    -1}},
+    {0x291D07, {   -1,    -1,  7622,    -1,    -1}},
+    {0x291D09, {   -1,    -1,  9371,    -1,    -1}},
+    {0x291E01, {   -1,    -1,  4903,    -1,    -1}},
+    {0x291E07, {   -1,    -1,  7663,    -1,    -1}},
+    {0x291E09, {   -1,    -1,  9406,    -1,    -1}},
+    {0x292001, {   -1,    -1,  4987,    -1,    -1}},
+    {0x292007, {   -1,    -1,  7745,    -1,    -1}},
+    {0x292009, {   -1,    -1,  9490,    -1,    -1}},
+    {0x292800, {  213,    -1,    -1,    -1,    -1}},
+    {0x292801, {   -1,    -1,  5155,    -1,    -1}},
+    {0x292809, {   -1,    -1,  9658,    -1,    -1}},
+    {0x293001, {   -1,    -1,  5351,    -1,    -1}},
+    {0x293007, {   -1,    -1,  7887,    -1,    -1}},
+    {0x293009, {   -1,    -1,  9854,    -1,    -1}},
+    {0x293101, {   -1,    -1,  5432,    -1,    -1}},
+    {0x293105, {   -1,    -1,  6780,    -1,    -1}},
+    {0x293107, {   -1,    -1,  7968,    -1,    -1}},
+    {0x293109, {   -1,    -1,  9935,    -1,    -1}},
+    {0x293201, {   -1,    -1,  5507,    -1,    -1}},
+    {0x293205, {   -1,    -1,  6840,    -1,    -1}},
+    {0x293207, {   -1,    -1,  8043,    -1,    -1}},
+    {0x293209, {   -1,    -1, 10010,    -1,    -1}},
+    {0x293301, {   -1,    -1,  5594,    -1,    -1}},
+    {0x293309, {   -1,    -1, 10097,    -1,    -1}},
+    {0x293401, {   -1,    -1,  5681,    -1,    -1}},
+    {0x293407, {   -1,    -1,  8130,    -1,    -1}},
+    {0x293409, {   -1,    -1, 10184,    -1,    -1}},
+    {0x293501, {   -1,    -1,  5740,    -1,    -1}},
+    {0x293507, {   -1,    -1,  8187,    -1,    -1}},
+    {0x293509, {   -1,    -1, 10243,    -1,    -1}},
+    {0x293601, {   -1,    -1,  5801,    -1,    -1}},
+    {0x293609, {   -1,    -1, 10304,    -1,    -1}},
+    {0x293801, {   -1,   216,  5869,    -1,    -1}},
+    {0x293803, {   -1,    -1,  6453,    -1,    -1}},
+    {0x293805, {   -1,    -1,  6901,    -1,    -1}},
+    {0x293807, {   -1,    -1,  8263,    -1,    -1}},
+    {0x293809, {   -1,    -1, 10372,    -1,    -1}},
+    {0x2938F1, {   -1,    -1,    -1,   435,    -1}},
+    {0x293901, {   -1,    -1,  5930,    -1,    -1}},
+    {0x293905, {   -1,    -1,  6956,    -1,    -1}},
+    {0x293907, {   -1,    -1,  8324,    -1,    -1}},
+    {0x293909, {   -1,    -1, 10433,    -1,    -1}},
+    {0x293A01, {   -1,    -1,  5983,    -1,    -1}},
+    {0x293A07, {   -1,    -1,  8377,    -1,    -1}},
+    {0x293A09, {   -1,    -1, 10486,    -1,    -1}},
+    {0x293B01, {   -1,    -1,  6058,    -1,    -1}},
+    {0x293B09, {   -1,    -1, 10561,    -1,    -1}},
+    {0x293C01, {   -1,    -1,  6147,    -1,    -1}},
+    {0x293C09, {   -1,    -1, 10650,    -1,    -1}},
+    {0x293D01, {   -1,    -1,  6202,    -1,    -1}},
+    {0x293D09, {   -1,    -1, 10705,    -1,    -1}},
+    {0x293E01, {   -1,    -1,  6259,    -1,    -1}},
+    {0x293E09, {   -1,    -1, 10762,    -1,    -1}},
+    {0x294000, {  341,    -1,    -1,    -1,    -1}},
+    {0x294100, {  428,    -1,    -1,    -1,    -1}},
+    {0x294200, {  501,    -1,    -1,    -1,    -1}},
+    {0x297E00, {  987,    -1,    -1,    -1,    -1}},
+    {0x297F00, { 1115,    -1,    -1,    -1,    -1}},
+    {0x297F01, { 2660,    -1,    -1,    -1,    -1}},
+    {0x297F03, {   -1,    -1,  6496,    -1,    -1}},
+    {0x298000, {   -1,    -1,    -1,    -1,    83}},
+    {0x298001, {   -1,    -1,    -1,    -1,   184}},
+    {0x298002, {   -1,    -1,   567,    -1,    -1}},
+    {0x298003, {   -1,    -1,  6330,    -1,    -1}},
+    {0x298004, {   -1,    -1,   886,    -1,    -1}},
+    {0x298005, {   -1,    -1,  6581,    -1,    -1}},
+    {0x298006, {   -1,    -1,  1096,    -1,    -1}},
+    {0x298007, {   -1,    -1,  7044,    -1,    -1}},
+    {0x298008, {   -1,    -1,  1261,    -1,    -1}},
+    {0x298009, {   -1,    -1,  8470,    -1,    -1}},
+    {0x29800A, {   -1,    -1,  1398,    -1,    -1}},
+    {0x29800C, {   -1,    -1,  1511,    -1,    -1}},
+    {0x29800E, {   -1,    -1,  1594,    -1,    -1}},
+    {0x298010, {   -1,    -1,  1717,    -1,    -1}},
+    {0x298012, {   -1,    -1,  2101,    -1,    -1}},
+    {0x298014, {   -1,    -1,  2290,    -1,    -1}},
+    {0x298080, { 1298,    -1,    -1,    -1,    -1}},
+    {0x2980F1, {   -1,    -1,    -1,   312,    -1}},
+    {0x2980F2, {   -1,    -1,    -1,    83,    -1}},
+    {0x298100, {   -1,    -1,    83,    -1,    -1}},
+    {0x298101, {   -1,    -1,  4087,    -1,    -1}},
+    {0x298109, {   -1,    -1,  8590,    -1,    -1}},
+    {0x2981FE, {   -1,    -1,  3961,    -1,    -1}},
+    {0x298200, {   -1,    -1,   211,    -1,    -1}},
+    {0x298201, {   -1,    -1,  4188,    -1,    -1}},
+    {0x298209, {   -1,    -1,  8691,    -1,    -1}},
+    {0x298300, {   -1,    -1,   339,    -1,    -1}},
+    {0x298301, { 1677,    -1,    -1,    -1,    -1}},
+    {0x298302, {   -1,    -1,   719,    -1,    -1}},
+    {0x298310, {   -1,    -1,  1918,    -1,    -1}},
+    {0x298400, {   -1,    -1,   467,    -1,    -1}},
+    {0x298402, {   -1,    -1,   810,    -1,    -1}},
+    {0x298404, {   -1,    -1,  1038,    -1,    -1}},
+    {0x298406, {   -1,    -1,  1210,    -1,    -1}},
+    {0x298408, {   -1,    -1,  1352,    -1,    -1}},
+    {0x29840A, {   -1,    -1,  1474,    -1,    -1}},
+    {0x29840C, {   -1,    -1,  1565,    -1,    -1}},
+    {0x29840E, {   -1,    -1,  1631,    -1,    -1}},
+    {0x298410, {   -1,    -1,  2024,    -1,    -1}},
+    {0x298412, {   -1,    -1,  2240,    -1,    -1}},
+    {0x298414, {   -1,    -1,  2360,    -1,    -1}},
+    {0x298901, {   -1,    -1,  4327,    -1,    -1}},
+    {0x298907, {   -1,    -1,  7242,    -1,    -1}},
+    {0x298909, {   -1,    -1,  8830,    -1,    -1}},
+    {0x29A001, {   -1,    -1,  4988,    -1,    -1}},
+    {0x29A007, {   -1,    -1,  7746,    -1,    -1}},
+    {0x29A009, {   -1,    -1,  9491,    -1,    -1}},
+    {0x29A800, {  214,    -1,    -1,    -1,    -1}},
+    {0x29A801, {   -1,    -1,  5156,    -1,    -1}},
+    {0x29A809, {   -1,    -1,  9659,    -1,    -1}},
+    {0x29B001, {   -1,    -1,  5352,    -1,    -1}},
+    {0x29B007, {   -1,    -1,  7888,    -1,    -1}},
+    {0x29B009, {   -1,    -1,  9855,    -1,    -1}},
+    {0x29B101, {   -1,    -1,  5433,    -1,    -1}},
+    {0x29B105, {   -1,    -1,  6781,    -1,    -1}},
+    {0x29B107, {   -1,    -1,  7969,    -1,    -1}},
+    {0x29B109, {   -1,    -1,  9936,    -1,    -1}},
+    {0x29B201, {   -1,    -1,  5508,    -1,    -1}},
+    {0x29B205, {   -1,    -1,  6841,    -1,    -1}},
+    {0x29B207, {   -1,    -1,  8044,    -1,    -1}},
+    {0x29B209, {   -1,    -1, 10011,    -1,    -1}},
+    {0x29B301, {   -1,    -1,  5595,    -1,    -1}},
+    {0x29B309, {   -1,    -1, 10098,    -1,    -1}},
+    {0x29B401, {   -1,    -1,  5682,    -1,    -1}},
+    {0x29B407, {   -1,    -1,  8131,    -1,    -1}},
+    {0x29B409, {   -1,    -1, 10185,    -1,    -1}},
+    {0x29B501, {   -1,    -1,  5741,    -1,    -1}},
+    {0x29B507, {   -1,    -1,  8188,    -1,    -1}},
+    {0x29B509, {   -1,    -1, 10244,    -1,    -1}},
+    {0x29B601, {   -1,    -1,  5802,    -1,    -1}},
+    {0x29B609, {   -1,    -1, 10305,    -1,    -1}},
+    {0x29B801, {   -1,   217,  5870,    -1,    -1}},
+    {0x29B803, {   -1,    -1,  6454,    -1,    -1}},
+    {0x29B805, {   -1,    -1,  6902,    -1,    -1}},
+    {0x29B807, {   -1,    -1,  8264,    -1,    -1}},
+    {0x29B809, {   -1,    -1, 10373,    -1,    -1}},
+    {0x29B8F1, {   -1,    -1,    -1,   436,    -1}},
+    {0x29B901, {   -1,    -1,  5931,    -1,    -1}},
+    {0x29B905, {   -1,    -1,  6957,    -1,    -1}},
+    {0x29B907, {   -1,    -1,  8325,    -1,    -1}},
+    {0x29B909, {   -1,    -1, 10434,    -1,    -1}},
+    {0x29BA01, {   -1,    -1,  5984,    -1,    -1}},
+    {0x29BA07, {   -1,    -1,  8378,    -1,    -1}},
+    {0x29BA09, {   -1,    -1, 10487,    -1,    -1}},
+    {0x29BB01, {   -1,    -1,  6059,    -1,    -1}},
+    {0x29BB09, {   -1,    -1, 10562,    -1,    -1}},
+    {0x29BC01, {   -1,    -1,  6148,    -1,    -1}},
+    {0x29BC09, {   -1,    -1, 10651,    -1,    -1}},
+    {0x29BD01, {   -1,    -1,  6203,    -1,    -1}},
+    {0x29BD09, {   -1,    -1, 10706,    -1,    -1}},
+    {0x29BE01, {   -1,    -1,  6260,    -1,    -1}},
+    {0x29BE09, {   -1,    -1, 10763,    -1,    -1}},
+    {0x29C000, {  342,    -1,    -1,    -1,    -1}},
+    {0x29C100, {  429,    -1,    -1,    -1,    -1}},
+    {0x29FE00, {  988,    -1,    -1,    -1,    -1}},
+    {0x29FF00, { 1116,    -1,    -1,    -1,    -1}},
+    {0x29FF01, { 2661,    -1,    -1,    -1,    -1}},
+    {0x29FF03, {   -1,    -1,  6497,    -1,    -1}},
+    {0x2A0000, {   -1,    -1,    -1,    -1,    84}},
+    {0x2A0001, {   -1,    -1,    -1,    -1,   185}},
+    {0x2A0002, {   -1,    -1,   568,    -1,    -1}},
+    {0x2A0003, { 1336,    -1,  6331,    -1,    -1}},
+    {0x2A0004, {   -1,    -1,   887,    -1,    -1}},
+    {0x2A0005, {   -1,    -1,  6582,    -1,    -1}},
+    {0x2A0006, {   -1,    -1,  1097,    -1,    -1}},
+    {0x2A0007, {   -1,    -1,  7045,    -1,    -1}},
+    {0x2A0008, {   -1,    -1,  1262,    -1,    -1}},
+    {0x2A0009, {   -1,    -1,  8471,    -1,    -1}},
+    {0x2A000A, {   -1,    -1,  1399,    -1,    -1}},
+    {0x2A000C, {   -1,    -1,  1512,    -1,    -1}},
+    {0x2A0010, {   -1,    -1,  1718,    -1,    -1}},
+    {0x2A0012, {   -1,    -1,  2102,    -1,    -1}},
+    {0x2A0014, {   -1,    -1,  2291,    -1,    -1}},
+    {0x2A0016, {   -1,    -1,  2394,    -1,    -1}},
+    {0x2A0018, {   -1,    -1,  2473,    -1,    -1}},
+    {0x2A0020, {   -1,    -1,  2658,    -1,    -1}},
+    {0x2A0022, {   -1,    -1,  2873,    -1,    -1}},
+    {0x2A0024, {   -1,    -1,  2976,    -1,    -1}},
+    {0x2A0026, {   -1,    -1,  3040,    -1,    -1}},
+    {0x2A0028, {   -1,    -1,  3088,    -1,    -1}},
+    {0x2A002A, {   -1,    -1,  3120,    -1,    -1}},
+    {0x2A002C, {   -1,    -1,  3146,    -1,    -1}},
+    {0x2A0030, {   -1,    -1,  3224,    -1,    -1}},
+    {0x2A0032, {   -1,    -1,  3343,    -1,    -1}},
+    {0x2A0034, {   -1,    -1,  3402,    -1,    -1}},
+    {0x2A0080, { 1299,    -1,    -1,    -1,    -1}},
+    {0x2A00F1, {   -1,    -1,    -1,   313,    -1}},
+    {0x2A00F2, {   -1,    -1,    -1,    84,    -1}},
+    {0x2A0100, {   -1,    -1,    84,    -1,    -1}},
+    {0x2A0101, {   -1,    -1,  4088,    -1,    -1}},
+    {0x2A0103, { 1373,    -1,    -1,    -1,    -1}},
+    {0x2A0105, {   -1,    -1,  6592,    -1,    -1}},
+    {0x2A0107, {   -1,    -1,  7106,    -1,    -1}},
+    {0x2A0109, {   -1,    -1,  8591,    -1,    -1}},
+    {0x2A01F2, {   -1,    -1,    -1,   172,    -1}},
+    {0x2A01FE, {   -1,    -1,  3962,    -1,    -1}},
+    {0x2A0200, {   -1,    -1,   212,    -1,    -1}},
+    {0x2A0201, {   -1,    -1,  4189,    -1,    -1}},
+    {0x2A0209, {   -1,    -1,  8692,    -1,    -1}},
+    {0x2A0210, {   -1,    -1,  1838,    -1,    -1}},
+    {0x2A0300, {   -1,    -1,   340,    -1,    -1}},
+    {0x2A0301, { 1678,    -1,    -1,    -1,    -1}},
+    {0x2A0310, {   -1,    -1,  1919,    -1,    -1}},
+    {0x2A0312, {   -1,    -1,  2181,    -1,    -1}},
+    {0x2A0314, {   -1,    -1,  2327,    -1,    -1}},
+    {0x2A0320, {   -1,    -1,  2763,    -1,    -1}},
+    {0x2A0322, {   -1,    -1,  2913,    -1,    -1}},
+    {0x2A0324, {   -1,    -1,  3000,    -1,    -1}},
+    {0x2A0326, {   -1,    -1,  3056,    -1,    -1}},
+    {0x2A0328, {   -1,    -1,  3097,    -1,    -1}},
+    {0x2A0330, {   -1,    -1,  3278,    -1,    -1}},
+    {0x2A0400, {   -1,    -1,   468,    -1,    -1}},
+    {0x2A0402, {   -1,    -1,   811,    -1,    -1}},
+    {0x2A0404, {   -1,    -1,  1039,    -1,    -1}},
+    {0x2A0406, {   -1,    -1,  1211,    -1,    -1}},
+    {0x2A0408, {   -1,    -1,  1353,    -1,    -1}},
+    {0x2A040A, {   -1,    -1,  1475,    -1,    -1}},
+    {0x2A040C, {   -1,    -1,  1566,    -1,    -1}},
+    {0x2A0410, {   -1,    -1,  2025,    -1,    -1}},
+    {0x2A0412, {   -1,    -1,  2241,    -1,    -1}},
+    {0x2A0414, {   -1,    -1,  2361,    -1,    -1}},
+    {0x2A0416, {   -1,    -1,  2442,    -1,    -1}},
+    {0x2A0418, {   -1,    -1,  2507,    -1,    -1}},
+    {0x2A0420, {   -1,    -1,  2827,    -1,    -1}},
+    {0x2A0422, {   -1,    -1,  2948,    -1,    -1}},
+    {0x2A0424, {   -1,    -1,  3020,    -1,    -1}},
+    {0x2A0426, {   -1,    -1,  3071,    -1,    -1}},
+    {0x2A0428, {   -1,    -1,  3107,    -1,    -1}},
+    {0x2A042A, {   -1,    -1,  3134,    -1,    -1}},
+    {0x2A042C, {   -1,    -1,  3161,    -1,    -1}},
+    {0x2A0430, {   -1,    -1,  3314,    -1,    -1}},
+    {0x2A0432, {   -1,    -1,  3382,    -1,    -1}},
+    {0x2A0434, {   -1,    -1,  3427,    -1,    -1}},
+    {0x2A0901, {   -1,    -1,  4328,    -1,    -1}},
+    {0x2A0907, {   -1,    -1,  7243,    -1,    -1}},
+    {0x2A0909, {   -1,    -1,  8831,    -1,    -1}},
+    {0x2A1001, {   -1,    -1,  4590,    -1,    -1}},
+    {0x2A1009, {   -1,    -1,  9093,    -1,    -1}},
+    {0x2A2001, {   -1,    -1,  4989,    -1,    -1}},
+    {0x2A2007, {   -1,    -1,  7747,    -1,    -1}},
+    {0x2A2009, {   -1,    -1,  9492,    -1,    -1}},
+    {0x2A2801, {   -1,    -1,  5157,    -1,    -1}},
+    {0x2A2809, {   -1,    -1,  9660,    -1,    -1}},
+    {0x2A3001, {   -1,    -1,  5353,    -1,    -1}},
+    {0x2A3007, {   -1,    -1,  7889,    -1,    -1}},
+    {0x2A3009, {   -1,    -1,  9856,    -1,    -1}},
+    {0x2A3101, {   -1,    -1,  5434,    -1,    -1}},
+    {0x2A3105, {   -1,    -1,  6782,    -1,    -1}},
+    {0x2A3107, {   -1,    -1,  7970,    -1,    -1}},
+    {0x2A3109, {   -1,    -1,  9937,    -1,    -1}},
+    {0x2A3201, {   -1,    -1,  5509,    -1,    -1}},
+    {0x2A3205, {   -1,    -1,  6842,    -1,    -1}},
+    {0x2A3207, {   -1,    -1,  8045,    -1,    -1}},
+    {0x2A3209, {   -1,    -1, 10012,    -1,    -1}},
+    {0x2A3301, {   -1,    -1,  5596,    -1,    -1}},
+    {0x2A3309, {   -1,    -1, 10099,    -1,    -1}},
+    {0x2A3401, {   -1,    -1,  5683,    -1,    -1}},
+    {0x2A3407, {   -1,    -1,  8132,    -1,    -1}},
+    {0x2A3409, {   -1,    -1, 10186,    -1,    -1}},
+    {0x2A3501, {   -1,    -1,  5742,    -1,    -1}},
+    {0x2A3507, {   -1,    -1,  8189,    -1,    -1}},
+    {0x2A3509, {   -1,    -1, 10245,    -1,    -1}},
+    {0x2A3601, {   -1,    -1,  5803,    -1,    -1}},
+    {0x2A3609, {   -1,    -1, 10306,    -1,    -1}},
+    {0x2A3801, {   -1,   218,  5871,    -1,    -1}},
+    {0x2A3803, {   -1,    -1,  6455,    -1,    -1}},
+    {0x2A3805, {   -1,    -1,  6903,    -1,    -1}},
+    {0x2A3807, {   -1,    -1,  8265,    -1,    -1}},
+    {0x2A3809, {   -1,    -1, 10374,    -1,    -1}},
+    {0x2A38F1, {   -1,    -1,    -1,   437,    -1}},
+    {0x2A3901, {   -1,    -1,  5932,    -1,    -1}},
+    {0x2A3905, {   -1,    -1,  6958,    -1,    -1}},
+    {0x2A3907, {   -1,    -1,  8326,    -1,    -1}},
+    {0x2A3909, {   -1,    -1, 10435,    -1,    -1}},
+    {0x2A3A01, {   -1,    -1,  5985,    -1,    -1}},
+    {0x2A3A07, {   -1,    -1,  8379,    -1,    -1}},
+    {0x2A3A09, {   -1,    -1, 10488,    -1,    -1}},
+    {0x2A3B01, {   -1,    -1,  6060,    -1,    -1}},
+    {0x2A3B09, {   -1,    -1, 10563,    -1,    -1}},
+    {0x2A3C01, {   -1,    -1,  6149,    -1,    -1}},
+    {0x2A3C09, {   -1,    -1, 10652,    -1,    -1}},
+    {0x2A3D01, {   -1,    -1,  6204,    -1,    -1}},
+    {0x2A3D09, {   -1,    -1, 10707,    -1,    -1}},
+    {0x2A3E01, {   -1,    -1,  6261,    -1,    -1}},
+    {0x2A3E09, {   -1,    -1, 10764,    -1,    -1}},
+    {0x2A4000, {  343,    -1,    -1,    -1,    -1}},
+    {0x2A4100, {  430,    -1,    -1,    -1,    -1}},
+    {0x2A4200, {  502,    -1,    -1,    -1,    -1}},
+    {0x2A4300, {  564,    -1,    -1,    -1,    -1}},
+    {0x2A7E00, {  989,    -1,    -1,    -1,    -1}},
+    {0x2A7F00, { 1117,    -1,    -1,    -1,    -1}},
+    {0x2A7F01, { 2662,    -1,    -1,    -1,    -1}},
+    {0x2A7F03, {   -1,    -1,  6498,    -1,    -1}},
+    {0x2A8000, {   -1,    -1,    -1,    -1,    85}},
+    {0x2A8001, {   -1,    -1,    -1,    -1,   186}},
+    {0x2A8002, {   -1,    -1,   569,    -1,    -1}},
+    {0x2A8003, { 1337,    -1,  6332,    -1,    -1}},
+    {0x2A8005, {   -1,    -1,  6583,    -1,    -1}},
+    {0x2A8007, {   -1,    -1,  7046,    -1,    -1}},
+    {0x2A8009, {   -1,    -1,  8472,    -1,    -1}},
+    {0x2A8010, {   -1,    -1,  1719,    -1,    -1}},
+    {0x2A8012, {   -1,    -1,  2103,    -1,    -1}},
+    {0x2A8014, {   -1,    -1,  2292,    -1,    -1}},
+    {0x2A8080, { 1300,    -1,    -1,    -1,    -1}},
+    {0x2A80F1, {   -1,    -1,    -1,   314,    -1}},
+    {0x2A80F2, {   -1,    -1,    -1,    85,    -1}},
+    {0x2A8100, {   -1,    -1,    85,    -1,    -1}},
+    {0x2A8101, {   -1,    -1,  4089,    -1,    -1}},
+    {0x2A8103, { 1374,    -1,    -1,    -1,    -1}},
+    {0x2A8109, {   -1,    -1,  8592,    -1,    -1}},
+    {0x2A81FE, {   -1,    -1,  3963,    -1,    -1}},
+    {0x2A8200, {   -1,    -1,   213,    -1,    -1}},
+    {0x2A8201, {   -1,    -1,  4190,    -1,    -1}},
+    {0x2A8209, {   -1,    -1,  8693,    -1,    -1}},
+    {0x2A8300, {   -1,    -1,   341,    -1,    -1}},
+    {0x2A8310, {   -1,    -1,  1920,    -1,    -1}},
+    {0x2A8312, {   -1,    -1,  2182,    -1,    -1}},
+    {0x2A8400, {   -1,    -1,   469,    -1,    -1}},
+    {0x2A8402, {   -1,    -1,   812,    -1,    -1}},
+    {0x2A8410, {   -1,    -1,  2026,    -1,    -1}},
+    {0x2A8412, {   -1,    -1,  2242,    -1,    -1}},
+    {0x2A8414, {   -1,    -1,  2362,    -1,    -1}},
+    {0x2A8901, {   -1,    -1,  4329,    -1,    -1}},
+    {0x2A8907, {   -1,    -1,  7244,    -1,    -1}},
+    {0x2A8909, {   -1,    -1,  8832,    -1,    -1}},
+    {0x2A9800, {   87,    -1,    -1,    -1,    -1}},
+    {0x2AA001, {   -1,    -1,  4990,    -1,    -1}},
+    {0x2AA007, {   -1,    -1,  7748,    -1,    -1}},
+    {0x2AA009, {   -1,    -1,  9493,    -1,    -1}},
+    {0x2AA801, {   -1,    -1,  5158,    -1,    -1}},
+    {0x2AA809, {   -1,    -1,  9661,    -1,    -1}},
+    {0x2AB001, {   -1,    -1,  5354,    -1,    -1}},
+    {0x2AB007, {   -1,    -1,  7890,    -1,    -1}},
+    {0x2AB009, {   -1,    -1,  9857,    -1,    -1}},
+    {0x2AB101, {   -1,    -1,  5435,    -1,    -1}},
+    {0x2AB105, {   -1,    -1,  6783,    -1,    -1}},
+    {0x2AB107, {   -1,    -1,  7971,    -1,    -1}},
+    {0x2AB109, {   -1,    -1,  9938,    -1,    -1}},
+    {0x2AB201, {   -1,    -1,  5510,    -1,    -1}},
+    {0x2AB205, {   -1,    -1,  6843,    -1,    -1}},
+    {0x2AB207, {   -1,    -1,  8046,    -1,    -1}},
+    {0x2AB209, {   -1,    -1, 10013,    -1,    -1}},
+    {0x2AB301, {   -1,    -1,  5597,    -1,    -1}},
+    {0x2AB309, {   -1,    -1, 10100,    -1,    -1}},
+    {0x2AB401, {   -1,    -1,  5684,    -1,    -1}},
+    {0x2AB407, {   -1,    -1,  8133,    -1,    -1}},
+    {0x2AB409, {   -1,    -1, 10187,    -1,    -1}},
+    {0x2AB501, {   -1,    -1,  5743,    -1,    -1}},
+    {0x2AB507, {   -1,    -1,  8190,    -1,    -1}},
+    {0x2AB509, {   -1,    -1, 10246,    -1,    -1}},
+    {0x2AB601, {   -1,    -1,  5804,    -1,    -1}},
+    {0x2AB609, {   -1,    -1, 10307,    -1,    -1}},
+    {0x2AB801, {   -1,    -1,  5872,    -1,    -1}},
+    {0x2AB805, {   -1,    -1,  6904,    -1,    -1}},
+    {0x2AB807, {   -1,    -1,  8266,    -1,    -1}},
+    {0x2AB809, {   -1,    -1, 10375,    -1,    -1}},
+    {0x2AB901, {   -1,    -1,  5933,    -1,    -1}},
+    {0x2AB905, {   -1,    -1,  6959,    -1,    -1}},
+    {0x2AB907, {   -1,    -1,  8327,    -1,    -1}},
+    {0x2AB909, {   -1,    -1, 10436,    -1,    -1}},
+    {0x2ABA01, {   -1,    -1,  5986,    -1,    -1}},
+    {0x2ABA07, {   -1,    -1,  8380,    -1,    -1}},
+    {0x2ABA09, {   -1,    -1, 10489,    -1,    -1}},
+    {0x2ABB01, {   -1,    -1,  6061,    -1,    -1}},
+    {0x2ABB09, {   -1,    -1, 10564,    -1,    -1}},
+    {0x2ABC01, {   -1,    -1,  6150,    -1,    -1}},
+    {0x2ABC09, {   -1,    -1, 10653,    -1,    -1}},
+    {0x2ABD01, {   -1,    -1,  6205,    -1,    -1}},
+    {0x2ABD09, {   -1,    -1, 10708,    -1,    -1}},
+    {0x2ABE01, {   -1,    -1,  6262,    -1,    -1}},
+    {0x2ABE09, {   -1,    -1, 10765,    -1,    -1}},
+    {0x2AC000, {  344,    -1,    -1,    -1,    -1}},
+    {0x2AC100, {  431,    -1,    -1,    -1,    -1}},
+    {0x2AC200, {  503,    -1,    -1,    -1,    -1}},
+    {0x2AC300, {  565,    -1,    -1,    -1,    -1}},
+    {0x2AC400, {  605,    -1,    -1,    -1,    -1}},
+    {0x2AC500, {  637,    -1,    -1,    -1,    -1}},
+    {0x2AFE00, {  990,    -1,    -1,    -1,    -1}},
+    {0x2AFF00, { 1118,    -1,    -1,    -1,    -1}},
+    {0x2AFF03, {   -1,    -1,  6499,    -1,    -1}},
+    {0x2B0000, {   -1,    -1,    -1,    -1,    86}},
+    {0x2B0001, {   -1,    -1,    -1,    -1,   187}},
+    {0x2B0002, {   -1,    -1,   570,    -1,    -1}},
+    {0x2B0003, { 1338,    -1,  6333,    -1,    -1}},
+    {0x2B0004, {   -1,    -1,   888,    -1,    -1}},
+    {0x2B0005, {   -1,    -1,  6584,    -1,    -1}},
+    {0x2B0006, {   -1,    -1,  1098,    -1,    -1}},
+    {0x2B0007, {   -1,    -1,  7047,    -1,    -1}},
+    {0x2B0008, {   -1,    -1,  1263,    -1,    -1}},
+    {0x2B0009, {   -1,    -1,  8473,    -1,    -1}},
+    {0x2B000A, {   -1,    -1,  1400,    -1,    -1}},
+    {0x2B000C, {   -1,    -1,  1513,    -1,    -1}},
+    {0x2B0010, {   -1,    -1,  1720,    -1,    -1}},
+    {0x2B0080, { 1301,    -1,    -1,    -1,    -1}},
+    {0x2B00F1, {   -1,    -1,    -1,   315,    -1}},
+    {0x2B00F2, {   -1,    -1,    -1,    86,    -1}},
+    {0x2B0100, {   -1,    -1,    86,    -1,    -1}},
+    {0x2B0101, {   -1,    -1,  4090,    -1,    -1}},
+    {0x2B0103, { 1375,    -1,    -1,    -1,    -1}},
+    {0x2B0109, {   -1,    -1,  8593,    -1,    -1}},
+    {0x2B01FE, {   -1,    -1,  3964,    -1,    -1}},
+    {0x2B0200, {   -1,    -1,   214,    -1,    -1}},
+    {0x2B0201, {   -1,    -1,  4191,    -1,    -1}},
+    {0x2B0202, {   -1,    -1,   646,    -1,    -1}},
+    {0x2B0209, {   -1,    -1,  8694,    -1,    -1}},
+    {0x2B0300, {   -1,    -1,   342,    -1,    -1}},
+    {0x2B0302, {   -1,    -1,   720,    -1,    -1}},
+    {0x2B0304, {   -1,    -1,   975,    -1,    -1}},
+    {0x2B0306, {   -1,    -1,  1163,    -1,    -1}},
+    {0x2B0310, {   -1,    -1,  1921,    -1,    -1}},
+    {0x2B0400, {   -1,    -1,   470,    -1,    -1}},
+    {0x2B0402, {   -1,    -1,   813,    -1,    -1}},
+    {0x2B0404, {   -1,    -1,  1040,    -1,    -1}},
+    {0x2B0406, {   -1,    -1,  1212,    -1,    -1}},
+    {0x2B0408, {   -1,    -1,  1354,    -1,    -1}},
+    {0x2B040A, {   -1,    -1,  1476,    -1,    -1}},
+    {0x2B040C, {   -1,    -1,  1567,    -1,    -1}},
+    {0x2B0410, {   -1,    -1,  2027,    -1,    -1}},
+    {0x2B0800, {   29,    -1,    -1,    -1,    -1}},
+    {0x2B0901, {   -1,    -1,  4330,    -1,    -1}},
+    {0x2B0907, {   -1,    -1,  7245,    -1,    -1}},
+    {0x2B0909, {   -1,    -1,  8833,    -1,    -1}},
+    {0x2B2001, {   -1,    -1,  4991,    -1,    -1}},
+    {0x2B2007, {   -1,    -1,  7749,    -1,    -1}},
+    {0x2B2009, {   -1,    -1,  9494,    -1,    -1}},
+    {0x2B2300, {  155,    -1,    -1,    -1,    -1}},
+    {0x2B2801, {   -1,    -1,  5159,    -1,    -1}},
+    {0x2B2809, {   -1,    -1,  9662,    -1,    -1}},
+    {0x2B3001, {   -1,    -1,  5355,    -1,    -1}},
+    {0x2B3007, {   -1,    -1,  7891,    -1,    -1}},
+    {0x2B3009, {   -1,    -1,  9858,    -1,    -1}},
+    {0x2B3101, {   -1,    -1,  5436,    -1,    -1}},
+    {0x2B3105, {   -1,    -1,  6784,    -1,    -1}},
+    {0x2B3107, {   -1,    -1,  7972,    -1,    -1}},
+    {0x2B3109, {   -1,    -1,  9939,    -1,    -1}},
+    {0x2B3201, {   -1,    -1,  5511,    -1,    -1}},
+    {0x2B3205, {   -1,    -1,  6844,    -1,    -1}},
+    {0x2B3207, {   -1,    -1,  8047,    -1,    -1}},
+    {0x2B3209, {   -1,    -1, 10014,    -1,    -1}},
+    {0x2B3301, {   -1,    -1,  5598,    -1,    -1}},
+    {0x2B3309, {   -1,    -1, 10101,    -1,    -1}},
+    {0x2B3401, {   -1,    -1,  5685,    -1,    -1}},
+    {0x2B3407, {   -1,    -1,  8134,    -1,    -1}},
+    {0x2B3409, {   -1,    -1, 10188,    -1,    -1}},
+    {0x2B3501, {   -1,    -1,  5744,    -1,    -1}},
+    {0x2B3507, {   -1,    -1,  8191,    -1,    -1}},
+    {0x2B3509, {   -1,    -1, 10247,    -1,    -1}},
+    {0x2B3601, {   -1,    -1,  5805,    -1,    -1}},
+    {0x2B3609, {   -1,    -1, 10308,    -1,    -1}},
+    {0x2B3801, {   -1,    -1,  5873,    -1,    -1}},
+    {0x2B3805, {   -1,    -1,  6905,    -1,    -1}},
+    {0x2B3807, {   -1,    -1,  8267,    -1,    -1}},
+    {0x2B3809, {   -1,    -1, 10376,    -1,    -1}},
+    {0x2B3901, {   -1,    -1,  5934,    -1,    -1}},
+    {0x2B3905, {   -1,    -1,  6960,    -1,    -1}},
+    {0x2B3907, {   -1,    -1,  8328,    -1,    -1}},
+    {0x2B3909, {   -1,    -1, 10437,    -1,    -1}},
+    {0x2B3A01, {   -1,    -1,  5987,    -1,    -1}},
+    {0x2B3A07, {   -1,    -1,  8381,    -1,    -1}},
+    {0x2B3A09, {   -1,    -1, 10490,    -1,    -1}},
+    {0x2B3B01, {   -1,    -1,  6062,    -1,    -1}},
+    {0x2B3B09, {   -1,    -1, 10565,    -1,    -1}},
+    {0x2B3C01, {   -1,    -1,  6151,    -1,    -1}},
+    {0x2B3C09, {   -1,    -1, 10654,    -1,    -1}},
+    {0x2B3D01, {   -1,    -1,  6206,    -1,    -1}},
+    {0x2B3D09, {   -1,    -1, 10709,    -1,    -1}},
+    {0x2B3E01, {   -1,    -1,  6263,    -1,    -1}},
+    {0x2B3E09, {   -1,    -1, 10766,    -1,    -1}},
+    {0x2B7E00, {  991,    -1,    -1,    -1,    -1}},
+    {0x2B7F00, { 1119,    -1,    -1,    -1,    -1}},
+    {0x2B7F03, {   -1,    -1,  6500,    -1,    -1}},
+    {0x2B8000, {   -1,    -1,    -1,    -1,    87}},
+    {0x2B8001, {   -1,    -1,    -1,    -1,   188}},
+    {0x2B8002, {   -1,    -1,   571,    -1,    -1}},
+    {0x2B8003, { 1339,    -1,  6334,    -1,    -1}},
+    {0x2B8004, {   -1,    -1,   889,    -1,    -1}},
+    {0x2B8005, {   -1,    -1,  6585,    -1,    -1}},
+    {0x2B8006, {   -1,    -1,  1099,    -1,    -1}},
+    {0x2B8007, {   -1,    -1,  7048,    -1,    -1}},
+    {0x2B8008, {   -1,    -1,  1264,    -1,    -1}},
+    {0x2B8009, {   -1,    -1,  8474,    -1,    -1}},
+    {0x2B800A, {   -1,    -1,  1401,    -1,    -1}},
+    {0x2B800C, {   -1,    -1,  1514,    -1,    -1}},
+    {0x2B800E, {   -1,    -1,  1595,    -1,    -1}},
+    {0x2B8080, { 1302,    -1,    -1,    -1,    -1}},
+    {0x2B80F1, {   -1,    -1,    -1,   316,    -1}},
+    {0x2B80F2, {   -1,    -1,    -1,    87,    -1}},
+    {0x2B8100, {   -1,    -1,    87,    -1,    -1}},
+    {0x2B8101, {   -1,    -1,  4091,    -1,    -1}},
+    {0x2B8103, { 1376,    -1,    -1,    -1,    -1}},
+    {0x2B8109, {   -1,    -1,  8594,    -1,    -1}},
+    {0x2B81F2, {   -1,    -1,    -1,   173,    -1}},
+    {0x2B81FE, {   -1,    -1,  3965,    -1,    -1}},
+    {0x2B8200, {   -1,    -1,   215,    -1,    -1}},
+    {0x2B8201, {   -1,    -1,  4192,    -1,    -1}},
+    {0x2B8202, {   -1,    -1,   647,    -1,    -1}},
+    {0x2B8204, {   -1,    -1,   933,    -1,    -1}},
+    {0x2B8209, {   -1,    -1,  8695,    -1,    -1}},
+    {0x2B8300, {   -1,    -1,   343,    -1,    -1}},
+    {0x2B8302, {   -1,    -1,   721,    -1,    -1}},
+    {0x2B8304, {   -1,    -1,   976,    -1,    -1}},
+    {0x2B8306, {   -1,    -1,  1164,    -1,    -1}},
+    {0x2B8308, {   -1,    -1,  1316,    -1,    -1}},
+    {0x2B830A, {   -1,    -1,  1445,    -1,    -1}},
+    {0x2B830C, {   -1,    -1,  1545,    -1,    -1}},
+    {0x2B8400, {   -1,    -1,   471,    -1,    -1}},
+    {0x2B8402, {   -1,    -1,   814,    -1,    -1}},
+    {0x2B8404, {   -1,    -1,  1041,    -1,    -1}},
+    {0x2B8406, {   -1,    -1,  1213,    -1,    -1}},
+    {0x2B8408, {   -1,    -1,  1355,    -1,    -1}},
+    {0x2B840A, {   -1,    -1,  1477,    -1,    -1}},
+    {0x2B840C, {   -1,    -1,  1568,    -1,    -1}},
+    {0x2B840E, {   -1,    -1,  1632,    -1,    -1}},
+    {0x2B8901, {   -1,    -1,  4331,    -1,    -1}},
+    {0x2B8907, {   -1,    -1,  7246,    -1,    -1}},
+    {0x2B8909, {   -1,    -1,  8834,    -1,    -1}},
+    {0x2B9000, {   47,    -1,    -1,    -1,    -1}},
+    {0x2BA001, {   -1,    -1,  4992,    -1,    -1}},
+    {0x2BA007, {   -1,    -1,  7750,    -1,    -1}},
+    {0x2BA009, {   -1,    -1,  9495,    -1,    -1}},
+    {0x2BA801, {   -1,    -1,  5160,    -1,    -1}},
+    {0x2BA809, {   -1,    -1,  9663,    -1,    -1}},
+    {0x2BB001, {   -1,    -1,  5356,    -1,    -1}},
+    {0x2BB007, {   -1,    -1,  7892,    -1,    -1}},
+    {0x2BB009, {   -1,    -1,  9859,    -1,    -1}},
+    {0x2BB101, {   -1,    -1,  5437,    -1,    -1}},
+    {0x2BB105, {   -1,    -1,  6785,    -1,    -1}},
+    {0x2BB107, {   -1,    -1,  7973,    -1,    -1}},
+    {0x2BB109, {   -1,    -1,  9940,    -1,    -1}},
+    {0x2BB201, {   -1,    -1,  5512,    -1,    -1}},
+    {0x2BB205, {   -1,    -1,  6845,    -1,    -1}},
+    {0x2BB207, {   -1,    -1,  8048,    -1,    -1}},
+    {0x2BB209, {   -1,    -1, 10015,    -1,    -1}},
+    {0x2BB301, {   -1,    -1,  5599,    -1,    -1}},
+    {0x2BB309, {   -1,    -1, 10102,    -1,    -1}},
+    {0x2BB401, {   -1,    -1,  5686,    -1,    -1}},
+    {0x2BB407, {   -1,    -1,  8135,    -1,    -1}},
+    {0x2BB409, {   -1,    -1, 10189,    -1,    -1}},
+    {0x2BB501, {   -1,    -1,  5745,    -1,    -1}},
+    {0x2BB507, {   -1,    -1,  8192,    -1,    -1}},
+    {0x2BB509, {   -1,    -1, 10248,    -1,    -1}},
+    {0x2BB601, {   -1,    -1,  5806,    -1,    -1}},
+    {0x2BB609, {   -1,    -1, 10309,    -1,    -1}},
+    {0x2BB801, {   -1,    -1,  5874,    -1,    -1}},
+    {0x2BB805, {   -1,    -1,  6906,    -1,    -1}},
+    {0x2BB807, {   -1,    -1,  8268,    -1,    -1}},
+    {0x2BB809, {   -1,    -1, 10377,    -1,    -1}},
+    {0x2BB901, {   -1,    -1,  5935,    -1,    -1}},
+    {0x2BB905, {   -1,    -1,  6961,    -1,    -1}},
+    {0x2BB907, {   -1,    -1,  8329,    -1,    -1}},
+    {0x2BB909, {   -1,    -1, 10438,    -1,    -1}},
+    {0x2BBA01, {   -1,    -1,  5988,    -1,    -1}},
+    {0x2BBA07, {   -1,    -1,  8382,    -1,    -1}},
+    {0x2BBA09, {   -1,    -1, 10491,    -1,    -1}},
+    {0x2BBB01, {   -1,    -1,  6063,    -1,    -1}},
+    {0x2BBB09, {   -1,    -1, 10566,    -1,    -1}},
+    {0x2BBC01, {   -1,    -1,  6152,    -1,    -1}},
+    {0x2BBC09, {   -1,    -1, 10655,    -1,    -1}},
+    {0x2BBD01, {   -1,    -1,  6207,    -1,    -1}},
+    {0x2BBD09, {   -1,    -1, 10710,    -1,    -1}},
+    {0x2BBE01, {   -1,    -1,  6264,    -1,    -1}},
+    {0x2BBE09, {   -1,    -1, 10767,    -1,    -1}},
+    {0x2BC000, {  345,    -1,    -1,    -1,    -1}},
+    {0x2BC100, {  432,    -1,    -1,    -1,    -1}},
+    {0x2BC200, {  504,    -1,    -1,    -1,    -1}},
+    {0x2BC300, {  566,    -1,    -1,    -1,    -1}},
+    {0x2BC400, {  606,    -1,    -1,    -1,    -1}},
+    {0x2BC500, {  638,    -1,    -1,    -1,    -1}},
+    {0x2BC600, {  667,    -1,    -1,    -1,    -1}},
+    {0x2BFE00, {  992,    -1,    -1,    -1,    -1}},
+    {0x2BFF00, { 1120,    -1,    -1,    -1,    -1}},
+    {0x2BFF03, {   -1,    -1,  6501,    -1,    -1}},
+    {0x2C0000, {   -1,    -1,    -1,    -1,    88}},
+    {0x2C0002, {   -1,    -1,   572,    -1,    -1}},
+    {0x2C0003, { 1340,    -1,    -1,    -1,    -1}},
+    {0x2C0004, {   -1,    -1,   890,    -1,    -1}},
+    {0x2C0006, {   -1,    -1,  1100,    -1,    -1}},
+    {0x2C0007, {   -1,    -1,  7049,    -1,    -1}},
+    {0x2C0008, {   -1,    -1,  1265,    -1,    -1}},
+    {0x2C0009, {   -1,    -1,  8475,    -1,    -1}},
+    {0x2C000A, {   -1,    -1,  1402,    -1,    -1}},
+    {0x2C000C, {   -1,    -1,  1515,    -1,    -1}},
+    {0x2C000E, {   -1,    -1,  1596,    -1,    -1}},
+    {0x2C0080, { 1303,    -1,    -1,    -1,    -1}},
+    {0x2C00F2, {   -1,    -1,    -1,    88,    -1}},
+    {0x2C0100, {   -1,    -1,    88,    -1,    -1}},
+    {0x2C0101, {   -1,    -1,  4092,    -1,    -1}},
+    {0x2C0103, { 1377,    -1,    -1,    -1,    -1}},
+    {0x2C0107, {   -1,    -1,  7107,    -1,    -1}},
+    {0x2C0109, {   -1,    -1,  8595,    -1,    -1}},
+    {0x2C01FE, {   -1,    -1,  3966,    -1,    -1}},
+    {0x2C0200, {   -1,    -1,   216,    -1,    -1}},
+    {0x2C0201, {   -1,    -1,  4193,    -1,    -1}},
+    {0x2C0202, {   -1,    -1,   648,    -1,    -1}},
+    {0x2C0207, {   -1,    -1,  7134,    -1,    -1}},
+    {0x2C0209, {   -1,    -1,  8696,    -1,    -1}},
+    {0x2C0300, {   -1,    -1,   344,    -1,    -1}},
+    {0x2C0302, {   -1,    -1,   722,    -1,    -1}},
+    {0x2C0304, {   -1,    -1,   977,    -1,    -1}},
+    {0x2C0306, {   -1,    -1,  1165,    -1,    -1}},
+    {0x2C0400, {   -1,    -1,   472,    -1,    -1}},
+    {0x2C0402, {   -1,    -1,   815,    -1,    -1}},
+    {0x2C0404, {   -1,    -1,  1042,    -1,    -1}},
+    {0x2C0406, {   -1,    -1,  1214,    -1,    -1}},
+    {0x2C0408, {   -1,    -1,  1356,    -1,    -1}},
+    {0x2C040A, {   -1,    -1,  1478,    -1,    -1}},
+    {0x2C040C, {   -1,    -1,  1569,    -1,    -1}},
+    {0x2C040E, {   -1,    -1,  1633,    -1,    -1}},
+    {0x2C0807, {   -1,    -1,  7160,    -1,    -1}},
+    {0x2C0901, {   -1,    -1,  4332,    -1,    -1}},
+    {0x2C0907, {   -1,    -1,  7247,    -1,    -1}},
+    {0x2C0909, {   -1,    -1,  8835,    -1,    -1}},
+    {0x2C0A01, {   -1,    -1,  4406,    -1,    -1}},
+    {0x2C0A07, {   -1,    -1,  7312,    -1,    -1}},
+    {0x2C0A09, {   -1,    -1,  8909,    -1,    -1}},
+    {0x2C0B01, {   -1,    -1,  4456,    -1,    -1}},
+    {0x2C0B07, {   -1,    -1,  7352,    -1,    -1}},
+    {0x2C0B09, {   -1,    -1,  8959,    -1,    -1}},
+    {0x2C0C01, {   -1,    -1,  4490,    -1,    -1}},
+    {0x2C0C09, {   -1,    -1,  8993,    -1,    -1}},
+    {0x2C0D01, {   -1,    -1,  4556,    -1,    -1}},
+    {0x2C0D09, {   -1,    -1,  9059,    -1,    -1}},
+    {0x2C1001, {   -1,    -1,  4591,    -1,    -1}},
+    {0x2C1007, {   -1,    -1,  7378,    -1,    -1}},
+    {0x2C1009, {   -1,    -1,  9094,    -1,    -1}},
+    {0x2C1801, {   -1,    -1,  4630,    -1,    -1}},
+    {0x2C1807, {   -1,    -1,  7418,    -1,    -1}},
+    {0x2C1809, {   -1,    -1,  9133,    -1,    -1}},
+    {0x2C1901, {   -1,    -1,  4702,    -1,    -1}},
+    {0x2C1907, {   -1,    -1,  7459,    -1,    -1}},
+    {0x2C1909, {   -1,    -1,  9205,    -1,    -1}},
+    {0x2C1A01, {   -1,    -1,  4738,    -1,    -1}},
+    {0x2C1A07, {   -1,    -1,  7500,    -1,    -1}},
+    {0x2C1A09, {   -1,    -1,  9241,    -1,    -1}},
+    {0x2C1B01, {   -1,    -1,  4787,    -1,    -1}},
+    {0x2C1B07, {   -1,    -1,  7541,    -1,    -1}},
+    {0x2C1B09, {   -1,    -1,  9290,    -1,    -1}},
+    {0x2C1C01, {   -1,    -1,  4828,    -1,    -1}},
+    {0x2C1C07, {   -1,    -1,  7582,    -1,    -1}},
+    {0x2C1C09, {   -1,    -1,  9331,    -1,    -1}},
+    {0x2C1D01, {   -1,    -1,  4869,    -1,    -1}},
+    {0x2C1D07, {   -1,    -1,  7623,    -1,    -1}},
+    {0x2C1D09, {   -1,    -1,  9372,    -1,    -1}},
+    {0x2C1E01, {   -1,    -1,  4904,    -1,    -1}},
+    {0x2C1E07, {   -1,    -1,  7664,    -1,    -1}},
+    {0x2C1E09, {   -1,    -1,  9407,    -1,    -1}},
+    {0x2C2001, {   -1,    -1,  4993,    -1,    -1}},
+    {0x2C2007, {   -1,    -1,  7751,    -1,    -1}},
+    {0x2C2009, {   -1,    -1,  9496,    -1,    -1}},
+    {0x2C2101, {   -1,    -1,  5050,    -1,    -1}},
+    {0x2C2109, {   -1,    -1,  9553,    -1,    -1}},
+    {0x2C2801, {   -1,    -1,  5161,    -1,    -1}},
+    {0x2C2807, {   -1,    -1,  7806,    -1,    -1}},
+    {0x2C2809, {   -1,    -1,  9664,    -1,    -1}},
+    {0x2C2901, {   -1,    -1,  5218,    -1,    -1}},
+    {0x2C2909, {   -1,    -1,  9721,    -1,    -1}},
+    {0x2C2A01, {   -1,    -1,  5246,    -1,    -1}},
+    {0x2C2A09, {   -1,    -1,  9749,    -1,    -1}},
+    {0x2C3001, {   -1,   172,  5357,    -1,    -1}},
+    {0x2C3003, {   -1,    -1,  6409,    -1,    -1}},
+    {0x2C3005, {   -1,    -1,  6722,    -1,    -1}},
+    {0x2C3007, {   -1,    -1,  7893,    -1,    -1}},
+    {0x2C3009, {   -1,    -1,  9860,    -1,    -1}},
+    {0x2C30F1, {   -1,    -1,    -1,   391,    -1}},
+    {0x2C3101, {   -1,    -1,  5438,    -1,    -1}},
+    {0x2C3105, {   -1,    -1,  6786,    -1,    -1}},
+    {0x2C3107, {   -1,    -1,  7974,    -1,    -1}},
+    {0x2C3109, {   -1,    -1,  9941,    -1,    -1}},
+    {0x2C3201, {   -1,    -1,  5513,    -1,    -1}},
+    {0x2C3205, {   -1,    -1,  6846,    -1,    -1}},
+    {0x2C3207, {   -1,    -1,  8049,    -1,    -1}},
+    {0x2C3209, {   -1,    -1, 10016,    -1,    -1}},
+    {0x2C3301, {   -1,    -1,  5600,    -1,    -1}},
+    {0x2C3309, {   -1,    -1, 10103,    -1,    -1}},
+    {0x2C3401, {   -1,    -1,  5687,    -1,    -1}},
+    {0x2C3407, {   -1,    -1,  8136,    -1,    -1}},
+    {0x2C3409, {   -1,    -1, 10190,    -1,    -1}},
+    {0x2C3501, {   -1,    -1,  5746,    -1,    -1}},
+    {0x2C3507, {   -1,    -1,  8193,    -1,    -1}},
+    {0x2C3509, {   -1,    -1, 10249,    -1,    -1}},
+    {0x2C3601, {   -1,    -1,  5807,    -1,    -1}},
+    {0x2C3609, {   -1,    -1, 10310,    -1,    -1}},
+    {0x2C3801, {   -1,    -1,  5875,    -1,    -1}},
+    {0x2C3805, {   -1,    -1,  6907,    -1,    -1}},
+    {0x2C3807, {   -1,    -1,  8269,    -1,    -1}},
+    {0x2C3809, {   -1,    -1, 10378,    -1,    -1}},
+    {0x2C3901, {   -1,    -1,  5936,    -1,    -1}},
+    {0x2C3905, {   -1,    -1,  6962,    -1,    -1}},
+    {0x2C3907, {   -1,    -1,  8330,    -1,    -1}},
+    {0x2C3909, {   -1,    -1, 10439,    -1,    -1}},
+    {0x2C3A01, {   -1,    -1,  5989,    -1,    -1}},
+    {0x2C3A07, {   -1,    -1,  8383,    -1,    -1}},
+    {0x2C3A09, {   -1,    -1, 10492,    -1,    -1}},
+    {0x2C3B01, {   -1,    -1,  6064,    -1,    -1}},
+    {0x2C3B09, {   -1,    -1, 10567,    -1,    -1}},
+    {0x2C3C01, {   -1,    -1,  6153,    -1,    -1}},
+    {0x2C3C09, {   -1,    -1, 10656,    -1,    -1}},
+    {0x2C3D01, {   -1,    -1,  6208,    -1,    -1}},
+    {0x2C3D09, {   -1,    -1, 10711,    -1,    -1}},
+    {0x2C3E01, {   -1,    -1,  6265,    -1,    -1}},
+    {0x2C3E09, {   -1,    -1, 10768,    -1,    -1}},
+    {0x2C4000, {  346,    -1,    -1,    -1,    -1}},
+    {0x2C4100, {  433,    -1,    -1,    -1,    -1}},
+    {0x2C4200, {  505,    -1,    -1,    -1,    -1}},
+    {0x2C7E00, {  993,    -1,    -1,    -1,    -1}},
+    {0x2C7F00, { 1121,    -1,    -1,    -1,    -1}},
+    {0x2C7F03, {   -1,    -1,  6502,    -1,    -1}},
+    {0x2C8000, {   -1,    -1,    -1,    -1,    89}},
+    {0x2C8002, {   -1,    -1,   573,    -1,    -1}},
+    {0x2C8003, { 1341,    -1,    -1,    -1,    -1}},
+    {0x2C8004, {   -1,    -1,   891,    -1,    -1}},
+    {0x2C8006, {   -1,    -1,  1101,    -1,    -1}},
+    {0x2C8008, {   -1,    -1,  1266,    -1,    -1}},
+    {0x2C800A, {   -1,    -1,  1403,    -1,    -1}},
+    {0x2C800C, {   -1,    -1,  1516,    -1,    -1}},
+    {0x2C8010, {   -1,    -1,  1721,    -1,    -1}},
+    {0x2C8012, {   -1,    -1,  2104,    -1,    -1}},
+    {0x2C8014, {   -1,    -1,  2293,    -1,    -1}},
+    {0x2C8016, {   -1,    -1,  2395,    -1,    -1}},
+    {0x2C8018, {   -1,    -1,  2474,    -1,    -1}},
+    {0x2C801A, {   -1,    -1,  2527,    -1,    -1}},
+    {0x2C8080, { 1304,    -1,    -1,    -1,    -1}},
+    {0x2C80F2, {   -1,    -1,    -1,    89,    -1}},
+    {0x2C8100, {   -1,    -1,    89,    -1,    -1}},
+    {0x2C81F2, {   -1,    -1,    -1,   174,    -1}},
+    {0x2C81FE, {   -1,    -1,  3967,    -1,    -1}},
+    {0x2C8200, {   -1,    -1,   217,    -1,    -1}},
+    {0x2C8202, {   -1,    -1,   649,    -1,    -1}},
+    {0x2C8204, {   -1,    -1,   934,    -1,    -1}},
+    {0x2C8206, {   -1,    -1,  1136,    -1,    -1}},
+    {0x2C8208, {   -1,    -1,  1297,    -1,    -1}},
+    {0x2C8300, {   -1,    -1,   345,    -1,    -1}},
+    {0x2C8302, {   -1,    -1,   723,    -1,    -1}},
+    {0x2C8304, {   -1,    -1,   978,    -1,    -1}},
+    {0x2C8306, {   -1,    -1,  1166,    -1,    -1}},
+    {0x2C8308, {   -1,    -1,  1317,    -1,    -1}},
+    {0x2C8310, {   -1,    -1,  1922,    -1,    -1}},
+    {0x2C8312, {   -1,    -1,  2183,    -1,    -1}},
+    {0x2C8400, {   -1,    -1,   473,    -1,    -1}},
+    {0x2C8402, {   -1,    -1,   816,    -1,    -1}},
+    {0x2C8404, {   -1,    -1,  1043,    -1,    -1}},
+    {0x2C8406, {   -1,    -1,  1215,    -1,    -1}},
+    {0x2C8408, {   -1,    -1,  1357,    -1,    -1}},
+    {0x2C840A, {   -1,    -1,  1479,    -1,    -1}},
+    {0x2C840C, {   -1,    -1,  1570,    -1,    -1}},
+    {0x2C8410, {   -1,    -1,  2028,    -1,    -1}},
+    {0x2C8412, {   -1,    -1,  2243,    -1,    -1}},
+    {0x2C8414, {   -1,    -1,  2363,    -1,    -1}},
+    {0x2C8416, {   -1,    -1,  2443,    -1,    -1}},
+    {0x2C8418, {   -1,    -1,  2508,    -1,    -1}},
+    {0x2C841A, {   -1,    -1,  2548,    -1,    -1}},
+    {0x2C8901, {   -1,    -1,  4333,    -1,    -1}},
+    {0x2C8909, {   -1,    -1,  8836,    -1,    -1}},
+    {0x2C8A01, {   -1,    -1,  4407,    -1,    -1}},
+    {0x2C8A09, {   -1,    -1,  8910,    -1,    -1}},
+    {0x2C8B01, {   -1,    -1,  4457,    -1,    -1}},
+    {0x2C8B09, {   -1,    -1,  8960,    -1,    -1}},
+    {0x2C8D01, {   -1,    -1,  4557,    -1,    -1}},
+    {0x2C8D09, {   -1,    -1,  9060,    -1,    -1}},
+    {0x2C9000, {   48,    -1,    -1,    -1,    -1}},
+    {0x2C9100, {   50,    -1,    -1,    -1,    -1}},
+    {0x2C9200, {   64,    -1,    -1,    -1,    -1}},
+    {0x2C9A01, {   -1,    -1,  4739,    -1,    -1}},
+    {0x2C9A09, {   -1,    -1,  9242,    -1,    -1}},
+    {0x2CA800, {  215,    -1,    -1,    -1,    -1}},
+    {0x2CB101, {   -1,    -1,  5439,    -1,    -1}},
+    {0x2CB105, {   -1,    -1,  6787,    -1,    -1}},
+    {0x2CB107, {   -1,    -1,  7975,    -1,    -1}},
+    {0x2CB109, {   -1,    -1,  9942,    -1,    -1}},
+    {0x2CB201, {   -1,    -1,  5514,    -1,    -1}},
+    {0x2CB205, {   -1,    -1,  6847,    -1,    -1}},
+    {0x2CB207, {   -1,    -1,  8050,    -1,    -1}},
+    {0x2CB209, {   -1,    -1, 10017,    -1,    -1}},
+    {0x2CB301, {   -1,    -1,  5601,    -1,    -1}},
+    {0x2CB309, {   -1,    -1, 10104,    -1,    -1}},
+    {0x2CB401, {   -1,    -1,  5688,    -1,    -1}},
+    {0x2CB409, {   -1,    -1, 10191,    -1,    -1}},
+    {0x2CB501, {   -1,    -1,  5747,    -1,    -1}},
+    {0x2CB507, {   -1,    -1,  8194,    -1,    -1}},
+    {0x2CB509, {   -1,    -1, 10250,    -1,    -1}},
+    {0x2CB801, {   -1,    -1,  5876,    -1,    -1}},
+    {0x2CB805, {   -1,    -1,  6908,    -1,    -1}},
+    {0x2CB807, {   -1,    -1,  8270,    -1,    -1}},
+    {0x2CB809, {   -1,    -1, 10379,    -1,    -1}},
+    {0x2CBA01, {   -1,    -1,  5990,    -1,    -1}},
+    {0x2CBA07, {   -1,    -1,  8384,    -1,    -1}},
+    {0x2CBA09, {   -1,    -1, 10493,    -1,    -1}},
+    {0x2CBB01, {   -1,    -1,  6065,    -1,    -1}},
+    {0x2CBB09, {   -1,    -1, 10568,    -1,    -1}},
+    {0x2CBC01, {   -1,    -1,  6154,    -1,    -1}},
+    {0x2CBC09, {   -1,    -1, 10657,    -1,    -1}},
+    {0x2CBE01, {   -1,    -1,  6266,    -1,    -1}},
+    {0x2CBE09, {   -1,    -1, 10769,    -1,    -1}},
+    {0x2CC000, {  347,    -1,    -1,    -1,    -1}},
+    {0x2CC100, {  434,    -1,    -1,    -1,    -1}},
+    {0x2CC200, {  506,    -1,    -1,    -1,    -1}},
+    {0x2CFE00, {  994,    -1,    -1,    -1,    -1}},
+    {0x2CFF00, { 1122,    -1,    -1,    -1,    -1}},
+    {0x2CFF03, {   -1,    -1,  6503,    -1,    -1}},
+    {0x2D0000, {   -1,    -1,    -1,    -1,    90}},
+    {0x2D0002, {   -1,    -1,   574,    -1,    -1}},
+    {0x2D0003, { 1342,    -1,    -1,    -1,    -1}},
+    {0x2D0004, {   -1,    -1,   892,    -1,    -1}},
+    {0x2D0006, {   -1,    -1,  1102,    -1,    -1}},
+    {0x2D0008, {   -1,    -1,  1267,    -1,    -1}},
+    {0x2D0010, {   -1,    -1,  1722,    -1,    -1}},
+    {0x2D0012, {   -1,    -1,  2105,    -1,    -1}},
+    {0x2D0014, {   -1,    -1,  2294,    -1,    -1}},
+    {0x2D0016, {   -1,    -1,  2396,    -1,    -1}},
+    {0x2D0018, {   -1,    -1,  2475,    -1,    -1}},
+    {0x2D001A, {   -1,    -1,  2528,    -1,    -1}},
+    {0x2D001C, {   -1,    -1,  2565,    -1,    -1}},
+    {0x2D001E, {   -1,    -1,  2591,    -1,    -1}},
+    {0x2D0020, {   -1,    -1,  2659,    -1,    -1}},
+    {0x2D0022, {   -1,    -1,  2874,    -1,    -1}},
+    {0x2D0030, {   -1,    -1,  3225,    -1,    -1}},
+    {0x2D0080, { 1305,    -1,    -1,    -1,    -1}},
+    {0x2D00F2, {   -1,    -1,    -1,    90,    -1}},
+    {0x2D0100, {   -1,    -1,    90,    -1,    -1}},
+    {0x2D01FE, {   -1,    -1,  3968,    -1,    -1}},
+    {0x2D0200, {   -1,    -1,   218,    -1,    -1}},
+    {0x2D0202, {   -1,    -1,   650,    -1,    -1}},
+    {0x2D0300, {   -1,    -1,   346,    -1,    -1}},
+    {0x2D0302, {   -1,    -1,   724,    -1,    -1}},
+    {0x2D0304, {   -1,    -1,   979,    -1,    -1}},
+    {0x2D0306, {   -1,    -1,  1167,    -1,    -1}},
+    {0x2D0310, {   -1,    -1,  1923,    -1,    -1}},
+    {0x2D0312, {   -1,    -1,  2184,    -1,    -1}},
+    {0x2D0314, {   -1,    -1,  2328,    -1,    -1}},
+    {0x2D0316, {   -1,    -1,  2419,    -1,    -1}},
+    {0x2D0400, {   -1,    -1,   474,    -1,    -1}},
+    {0x2D0402, {   -1,    -1,   817,    -1,    -1}},
+    {0x2D0404, {   -1,    -1,  1044,    -1,    -1}},
+    {0x2D0406, {   -1,    -1,  1216,    -1,    -1}},
+    {0x2D0408, {   -1,    -1,  1358,    -1,    -1}},
+    {0x2D0410, {   -1,    -1,  2029,    -1,    -1}},
+    {0x2D0412, {   -1,    -1,  2244,    -1,    -1}},
+    {0x2D0414, {   -1,    -1,  2364,    -1,    -1}},
+    {0x2D0416, {   -1,    -1,  2444,    -1,    -1}},
+    {0x2D0418, {   -1,    -1,  2509,    -1,    -1}},
+    {0x2D041A, {   -1,    -1,  2549,    -1,    -1}},
+    {0x2D041C, {   -1,    -1,  2580,    -1,    -1}},
+    {0x2D041E, {   -1,    -1,  2604,    -1,    -1}},
+    {0x2D0420, {   -1,    -1,  2828,    -1,    -1}},
+    {0x2D0422, {   -1,    -1,  2949,    -1,    -1}},
+    {0x2D0430, {   -1,    -1,  3315,    -1,    -1}},
+    {0x2D0901, {   -1,    -1,  4334,    -1,    -1}},
+    {0x2D0909, {   -1,    -1,  8837,    -1,    -1}},
+    {0x2D0A01, {   -1,    -1,  4408,    -1,    -1}},
+    {0x2D0A09, {   -1,    -1,  8911,    -1,    -1}},
+    {0x2D0B01, {   -1,    -1,  4458,    -1,    -1}},
+    {0x2D0B09, {   -1,    -1,  8961,    -1,    -1}},
+    {0x2D0D01, {   -1,    -1,  4558,    -1,    -1}},
+    {0x2D0D09, {   -1,    -1,  9061,    -1,    -1}},
+    {0x2D1A01, {   -1,    -1,  4740,    -1,    -1}},
+    {0x2D1A09, {   -1,    -1,  9243,    -1,    -1}},
+    {0x2D3101, {   -1,    -1,  5440,    -1,    -1}},
+    {0x2D3105, {   -1,    -1,  6788,    -1,    -1}},
+    {0x2D3107, {   -1,    -1,  7976,    -1,    -1}},
+    {0x2D3109, {   -1,    -1,  9943,    -1,    -1}},
+    {0x2D3201, {   -1,    -1,  5515,    -1,    -1}},
+    {0x2D3205, {   -1,    -1,  6848,    -1,    -1}},
+    {0x2D3207, {   -1,    -1,  8051,    -1,    -1}},
+    {0x2D3209, {   -1,    -1, 10018,    -1,    -1}},
+    {0x2D3301, {   -1,    -1,  5602,    -1,    -1}},
+    {0x2D3309, {   -1,    -1, 10105,    -1,    -1}},
+    {0x2D3401, {   -1,    -1,  5689,    -1,    -1}},
+    {0x2D3409, {   -1,    -1, 10192,    -1,    -1}},
+    {0x2D3501, {   -1,    -1,  5748,    -1,    -1}},
+    {0x2D3507, {   -1,    -1,  8195,    -1,    -1}},
+    {0x2D3509, {   -1,    -1, 10251,    -1,    -1}},
+    {0x2D3801, {   -1,    -1,  5877,    -1,    -1}},
+    {0x2D3805, {   -1,    -1,  6909,    -1,    -1}},
+    {0x2D3807, {   -1,    -1,  8271,    -1,    -1}},
+    {0x2D3809, {   -1,    -1, 10380,    -1,    -1}},
+    {0x2D3A01, {   -1,    -1,  5991,    -1,    -1}},
+    {0x2D3A07, {   -1,    -1,  8385,    -1,    -1}},
+    {0x2D3A09, {   -1,    -1, 10494,    -1,    -1}},
+    {0x2D3B01, {   -1,    -1,  6066,    -1,    -1}},
+    {0x2D3B09, {   -1,    -1, 10569,    -1,    -1}},
+    {0x2D3C01, {   -1,    -1,  6155,    -1,    -1}},
+    {0x2D3C09, {   -1,    -1, 10658,    -1,    -1}},
+    {0x2D3E01, {   -1,    -1,  6267,    -1,    -1}},
+    {0x2D3E09, {   -1,    -1, 10770,    -1,    -1}},
+    {0x2D4000, {  348,    -1,    -1,    -1,    -1}},
+    {0x2D4100, {  435,    -1,    -1,    -1,    -1}},
+    {0x2D4200, {  507,    -1,    -1,    -1,    -1}},
+    {0x2D4300, {  567,    -1,    -1,    -1,    -1}},
+    {0x2D4400, {  607,    -1,    -1,    -1,    -1}},
+    {0x2D4500, {  639,    -1,    -1,    -1,    -1}},
+    {0x2D4600, {  668,    -1,    -1,    -1,    -1}},
+    {0x2D4700, {  693,    -1,    -1,    -1,    -1}},
+    {0x2D4800, {  714,    -1,    -1,    -1,    -1}},
+    {0x2D4900, {  732,    -1,    -1,    -1,    -1}},
+    {0x2D7E00, {  995,    -1,    -1,    -1,    -1}},
+    {0x2D7F00, { 1123,    -1,    -1,    -1,    -1}},
+    {0x2D7F03, {   -1,    -1,  6504,    -1,    -1}},
+    {0x2D8000, {   -1,    -1,    -1,    -1,    91}},
+    {0x2D8002, {   -1,    -1,   575,    -1,    -1}},
+    {0x2D8003, { 1343,    -1,    -1,    -1,    -1}},
+    {0x2D8004, {   -1,    -1,   893,    -1,    -1}},
+    {0x2D8006, {   -1,    -1,  1103,    -1,    -1}},
+    {0x2D8008, {   -1,    -1,  1268,    -1,    -1}},
+    {0x2D800A, {   -1,    -1,  1404,    -1,    -1}},
+    {0x2D800C, {   -1,    -1,  1517,    -1,    -1}},
+    {0x2D800E, {   -1,    -1,  1597,    -1,    -1}},
+    {0x2D8010, {   -1,    -1,  1723,    -1,    -1}},
+    {0x2D8012, {   -1,    -1,  2106,    -1,    -1}},
+    {0x2D8014, {   -1,    -1,  2295,    -1,    -1}},
+    {0x2D8016, {   -1,    -1,  2397,    -1,    -1}},
+    {0x2D8018, {   -1,    -1,  2476,    -1,    -1}},
+    {0x2D8080, { 1306,    -1,    -1,    -1,    -1}},
+    {0x2D80F2, {   -1,    -1,    -1,    91,    -1}},
+    {0x2D8100, {   -1,    -1,    91,    -1,    -1}},
+    {0x2D81F2, {   -1,    -1,    -1,   175,    -1}},
+    {0x2D81FE, {   -1,    -1,  3969,    -1,    -1}},
+    {0x2D8200, {   -1,    -1,   219,    -1,    -1}},
+    {0x2D8202, {   -1,    -1,   651,    -1,    -1}},
+    {0x2D8300, {   -1,    -1,   347,    -1,    -1}},
+    {0x2D8302, {   -1,    -1,   725,    -1,    -1}},
+    {0x2D8304, {   -1,    -1,   980,    -1,    -1}},
+    {0x2D8310, {   -1,    -1,  1924,    -1,    -1}},
+    {0x2D8312, {   -1,    -1,  2185,    -1,    -1}},
+    {0x2D8314, {   -1,    -1,  2329,    -1,    -1}},
+    {0x2D8316, {   -1,    -1,  2420,    -1,    -1}},
+    {0x2D8400, {   -1,    -1,   475,    -1,    -1}},
+    {0x2D8402, {   -1,    -1,   818,    -1,    -1}},
+    {0x2D8404, {   -1,    -1,  1045,    -1,    -1}},
+    {0x2D8406, {   -1,    -1,  1217,    -1,    -1}},
+    {0x2D8408, {   -1,    -1,  1359,    -1,    -1}},
+    {0x2D840A, {   -1,    -1,  1480,    -1,    -1}},
+    {0x2D840C, {   -1,    -1,  1571,    -1,    -1}},
+    {0x2D840E, {   -1,    -1,  1634,    -1,    -1}},
+    {0x2D8410, {   -1,    -1,  2030,    -1,    -1}},
+    {0x2D8412, {   -1,    -1,  2245,    -1,    -1}},
+    {0x2D8414, {   -1,    -1,  2365,    -1,    -1}},
+    {0x2D8416, {   -1,    -1,  2445,    -1,    -1}},
+    {0x2D8418, {   -1,    -1,  2510,    -1,    -1}},
+    {0x2D8901, {   -1,    -1,  4335,    -1,    -1}},
+    {0x2D8909, {   -1,    -1,  8838,    -1,    -1}},
+    {0x2D8A01, {   -1,    -1,  4409,    -1,    -1}},
+    {0x2D8A09, {   -1,    -1,  8912,    -1,    -1}},
+    {0x2D8B01, {   -1,    -1,  4459,    -1,    -1}},
+    {0x2D8B09, {   -1,    -1,  8962,    -1,    -1}},
+    {0x2D8D01, {   -1,    -1,  4559,    -1,    -1}},
+    {0x2D8D09, {   -1,    -1,  9062,    -1,    -1}},
+    {0x2D9A01, {   -1,    -1,  4741,    -1,    -1}},
+    {0x2D9A09, {   -1,    -1,  9244,    -1,    -1}},
+    {0x2DB101, {   -1,    -1,  5441,    -1,    -1}},
+    {0x2DB105, {   -1,    -1,  6789,    -1,    -1}},
+    {0x2DB107, {   -1,    -1,  7977,    -1,    -1}},
+    {0x2DB109, {   -1,    -1,  9944,    -1,    -1}},
+    {0x2DB201, {   -1,    -1,  5516,    -1,    -1}},
+    {0x2DB205, {   -1,    -1,  6849,    -1,    -1}},
+    {0x2DB207, {   -1,    -1,  8052,    -1,    -1}},
+    {0x2DB209, {   -1,    -1, 10019,    -1,    -1}},
+    {0x2DB301, {   -1,    -1,  5603,    -1,    -1}},
+    {0x2DB309, {   -1,    -1, 10106,    -1,    -1}},
+    {0x2DB501, {   -1,    -1,  5749,    -1,    -1}},
+    {0x2DB507, {   -1,    -1,  8196,    -1,    -1}},
+    {0x2DB509, {   -1,    -1, 10252,    -1,    -1}},
+    {0x2DB801, {   -1,    -1,  5878,    -1,    -1}},
+    {0x2DB807, {   -1,    -1,  8272,    -1,    -1}},
+    {0x2DB809, {   -1,    -1, 10381,    -1,    -1}},
+    {0x2DBA01, {   -1,    -1,  5992,    -1,    -1}},
+    {0x2DBA07, {   -1,    -1,  8386,    -1,    -1}},
+    {0x2DBA09, {   -1,    -1, 10495,    -1,    -1}},
+    {0x2DBB01, {   -1,    -1,  6067,    -1,    -1}},
+    {0x2DBB09, {   -1,    -1, 10570,    -1,    -1}},
+    {0x2DBE01, {   -1,    -1,  6268,    -1,    -1}},
+    {0x2DBE09, {   -1,    -1, 10771,    -1,    -1}},
+    {0x2DC000, {  349,    -1,    -1,    -1,    -1}},
+    {0x2DC100, {  436,    -1,    -1,    -1,    -1}},
+    {0x2DC200, {  508,    -1,    -1,    -1,    -1}},
+    {0x2DC300, {  568,    -1,    -1,    -1,    -1}},
+    {0x2DC400, {  608,    -1,    -1,    -1,    -1}},
+    {0x2DC500, {  640,    -1,    -1,    -1,    -1}},
+    {0x2DC600, {  669,    -1,    -1,    -1,    -1}},
+    {0x2DC700, {  694,    -1,    -1,    -1,    -1}},
+    {0x2DFE00, {  996,    -1,    -1,    -1,    -1}},
+    {0x2DFF00, { 1124,    -1,    -1,    -1,    -1}},
+    {0x2DFF03, {   -1,    -1,  6505,    -1,    -1}},
+    {0x2E0000, {   -1,    -1,    -1,    -1,    92}},
+    {0x2E0002, {   -1,    -1,   576,    -1,    -1}},
+    {0x2E0004, {   -1,    -1,   894,    -1,    -1}},
+    {0x2E0006, {   -1,    -1,  1104,    -1,    -1}},
+    {0x2E0008, {   -1,    -1,  1269,    -1,    -1}},
+    {0x2E000A, {   -1,    -1,  1405,    -1,    -1}},
+    {0x2E0080, { 1307,    -1,    -1,    -1,    -1}},
+    {0x2E00F2, {   -1,    -1,    -1,    92,    -1}},
+    {0x2E0100, {   -1,    -1,    92,    -1,    -1}},
+    {0x2E01FE, {   -1,    -1,  3970,    -1,    -1}},
+    {0x2E0200, {   -1,    -1,   220,    -1,    -1}},
+    {0x2E0300, {   -1,    -1,   348,    -1,    -1}},
+    {0x2E0302, {   -1,    -1,   726,    -1,    -1}},
+    {0x2E0304, {   -1,    -1,   981,    -1,    -1}},
+    {0x2E0306, {   -1,    -1,  1168,    -1,    -1}},
+    {0x2E0400, {   -1,    -1,   476,    -1,    -1}},
+    {0x2E0402, {   -1,    -1,   819,    -1,    -1}},
+    {0x2E0404, {   -1,    -1,  1046,    -1,    -1}},
+    {0x2E0406, {   -1,    -1,  1218,    -1,    -1}},
+    {0x2E0408, {   -1,    -1,  1360,    -1,    -1}},
+    {0x2E040A, {   -1,    -1,  1481,    -1,    -1}},
+    {0x2E0901, {   -1,    -1,  4336,    -1,    -1}},
+    {0x2E0909, {   -1,    -1,  8839,    -1,    -1}},
+    {0x2E0A01, {   -1,    -1,  4410,    -1,    -1}},
+    {0x2E0A09, {   -1,    -1,  8913,    -1,    -1}},
+    {0x2E0B01, {   -1,    -1,  4460,    -1,    -1}},
+    {0x2E0B09, {   -1,    -1,  8963,    -1,    -1}},
+    {0x2E0D01, {   -1,    -1,  4560,    -1,    -1}},
+    {0x2E0D09, {   -1,    -1,  9063,    -1,    -1}},
+    {0x2E1A01, {   -1,    -1,  4742,    -1,    -1}},
+    {0x2E1A09, {   -1,    -1,  9245,    -1,    -1}},
+    {0x2E3101, {   -1,    -1,  5442,    -1,    -1}},
+    {0x2E3105, {   -1,    -1,  6790,    -1,    -1}},
+    {0x2E3107, {   -1,    -1,  7978,    -1,    -1}},
+    {0x2E3109, {   -1,    -1,  9945,    -1,    -1}},
+    {0x2E3201, {   -1,    -1,  5517,    -1,    -1}},
+    {0x2E3207, {   -1,    -1,  8053,    -1,    -1}},
+    {0x2E3209, {   -1,    -1, 10020,    -1,    -1}},
+    {0x2E3301, {   -1,    -1,  5604,    -1,    -1}},
+    {0x2E3309, {   -1,    -1, 10107,    -1,    -1}},
+    {0x2E3501, {   -1,    -1,  5750,    -1,    -1}},
+    {0x2E3507, {   -1,    -1,  8197,    -1,    -1}},
+    {0x2E3509, {   -1,    -1, 10253,    -1,    -1}},
+    {0x2E3801, {   -1,    -1,  5879,    -1,    -1}},
+    {0x2E3807, {   -1,    -1,  8273,    -1,    -1}},
+    {0x2E3809, {   -1,    -1, 10382,    -1,    -1}},
+    {0x2E3B01, {   -1,    -1,  6068,    -1,    -1}},
+    {0x2E3B09, {   -1,    -1, 10571,    -1,    -1}},
+    {0x2E3E01, {   -1,    -1,  6269,    -1,    -1}},
+    {0x2E3E09, {   -1,    -1, 10772,    -1,    -1}},
+    {0x2E4000, {  350,    -1,    -1,    -1,    -1}},
+    {0x2E4100, {  437,    -1,    -1,    -1,    -1}},
+    {0x2E4200, {  509,    -1,    -1,    -1,    -1}},
+    {0x2E4300, {  569,    -1,    -1,    -1,    -1}},
+    {0x2E7E00, {  997,    -1,    -1,    -1,    -1}},
+    {0x2E7F00, { 1125,    -1,    -1,    -1,    -1}},
+    {0x2E7F03, {   -1,    -1,  6506,    -1,    -1}},
+    {0x2E8000, {   -1,    -1,    -1,    -1,    93}},
+    {0x2E8002, {   -1,    -1,   577,    -1,    -1}},
+    {0x2E8004, {   -1,    -1,   895,    -1,    -1}},
+    {0x2E8006, {   -1,    -1,  1105,    -1,    -1}},
+    {0x2E8008, {   -1,    -1,  1270,    -1,    -1}},
+    {0x2E800A, {   -1,    -1,  1406,    -1,    -1}},
+    {0x2E8080, { 1308,    -1,    -1,    -1,    -1}},
+    {0x2E80F2, {   -1,    -1,    -1,    93,    -1}},
+    {0x2E8100, {   -1,    -1,    93,    -1,    -1}},
+    {0x2E81FE, {   -1,    -1,  3971,    -1,    -1}},
+    {0x2E8200, {   -1,    -1,   221,    -1,    -1}},
+    {0x2E8202, {   -1,    -1,   652,    -1,    -1}},
+    {0x2E8204, {   -1,    -1,   935,    -1,    -1}},
+    {0x2E8300, {   -1,    -1,   349,    -1,    -1}},
+    {0x2E8302, {   -1,    -1,   727,    -1,    -1}},
+    {0x2E8304, {   -1,    -1,   982,    -1,    -1}},
+    {0x2E8400, {   -1,    -1,   477,    -1,    -1}},
+    {0x2E8402, {   -1,    -1,   820,    -1,    -1}},
+    {0x2E8404, {   -1,    -1,  1047,    -1,    -1}},
+    {0x2E8406, {   -1,    -1,  1219,    -1,    -1}},
+    {0x2E8408, {   -1,    -1,  1361,    -1,    -1}},
+    {0x2E840A, {   -1,    -1,  1482,    -1,    -1}},
+    {0x2E8901, {   -1,    -1,  4337,    -1,    -1}},
+    {0x2E8909, {   -1,    -1,  8840,    -1,    -1}},
+    {0x2E8A01, {   -1,    -1,  4411,    -1,    -1}},
+    {0x2E8A09, {   -1,    -1,  8914,    -1,    -1}},
+    {0x2E8B01, {   -1,    -1,  4461,    -1,    -1}},
+    {0x2E8B09, {   -1,    -1,  8964,    -1,    -1}},
+    {0x2E8D01, {   -1,    -1,  4561,    -1,    -1}},
+    {0x2E8D09, {   -1,    -1,  9064,    -1,    -1}},
+    {0x2E9A01, {   -1,    -1,  4743,    -1,    -1}},
+    {0x2E9A09, {   -1,    -1,  9246,    -1,    -1}},
+    {0x2EB101, {   -1,    -1,  5443,    -1,    -1}},
+    {0x2EB105, {   -1,    -1,  6791,    -1,    -1}},
+    {0x2EB107, {   -1,    -1,  7979,    -1,    -1}},
+    {0x2EB109, {   -1,    -1,  9946,    -1,    -1}},
+    {0x2EB201, {   -1,    -1,  5518,    -1,    -1}},
+    {0x2EB207, {   -1,    -1,  8054,    -1,    -1}},
+    {0x2EB209, {   -1,    -1, 10021,    -1,    -1}},
+    {0x2EB301, {   -1,    -1,  5605,    -1,    -1}},
+    {0x2EB309, {   -1,    -1, 10108,    -1,    -1}},
+    {0x2EB501, {   -1,    -1,  5751,    -1,    -1}},
+    {0x2EB507, {   -1,    -1,  8198,    -1,    -1}},
+    {0x2EB509, {   -1,    -1, 10254,    -1,    -1}},
+    {0x2EB801, {   -1,    -1,  5880,    -1,    -1}},
+    {0x2EB807, {   -1,    -1,  8274,    -1,    -1}},
+    {0x2EB809, {   -1,    -1, 10383,    -1,    -1}},
+    {0x2EBB01, {   -1,    -1,  6069,    -1,    -1}},
+    {0x2EBB09, {   -1,    -1, 10572,    -1,    -1}},
+    {0x2EBE01, {   -1,    -1,  6270,    -1,    -1}},
+    {0x2EBE09, {   -1,    -1, 10773,    -1,    -1}},
+    {0x2EC000, {  351,    -1,    -1,    -1,    -1}},
+    {0x2EC100, {  438,    -1,    -1,    -1,    -1}},
+    {0x2EC200, {  510,    -1,    -1,    -1,    -1}},
+    {0x2EFE00, {  998,    -1,    -1,    -1,    -1}},
+    {0x2EFF00, { 1126,    -1,    -1,    -1,    -1}},
+    {0x2EFF03, {   -1,    -1,  6507,    -1,    -1}},
+    {0x2F0000, {   -1,    -1,    -1,    -1,    94}},
+    {0x2F0002, {   -1,    -1,   578,    -1,    -1}},
+    {0x2F0004, {   -1,    -1,   896,    -1,    -1}},
+    {0x2F0010, {   -1,    -1,  1724,    -1,    -1}},
+    {0x2F0012, {   -1,    -1,  2107,    -1,    -1}},
+    {0x2F0014, {   -1,    -1,  2296,    -1,    -1}},
+    {0x2F0016, {   -1,    -1,  2398,    -1,    -1}},
+    {0x2F0018, {   -1,    -1,  2477,    -1,    -1}},
+    {0x2F00F2, {   -1,    -1,    -1,    94,    -1}},
+    {0x2F0100, {   -1,    -1,    94,    -1,    -1}},
+    {0x2F01FE, {   -1,    -1,  3972,    -1,    -1}},
+    {0x2F0200, {   -1,    -1,   222,    -1,    -1}},
+    {0x2F0300, {   -1,    -1,   350,    -1,    -1}},
+    {0x2F0302, {   -1,    -1,   728,    -1,    -1}},
+    {0x2F0304, {   -1,    -1,   983,    -1,    -1}},
+    {0x2F0310, {   -1,    -1,  1925,    -1,    -1}},
+    {0x2F0400, {   -1,    -1,   478,    -1,    -1}},
+    {0x2F0402, {   -1,    -1,   821,    -1,    -1}},
+    {0x2F0404, {   -1,    -1,  1048,    -1,    -1}},
+    {0x2F0410, {   -1,    -1,  2031,    -1,    -1}},
+    {0x2F0412, {   -1,    -1,  2246,    -1,    -1}},
+    {0x2F0414, {   -1,    -1,  2366,    -1,    -1}},
+    {0x2F0416, {   -1,    -1,  2446,    -1,    -1}},
+    {0x2F0418, {   -1,    -1,  2511,    -1,    -1}},
+    {0x2F0901, {   -1,    -1,  4338,    -1,    -1}},
+    {0x2F0909, {   -1,    -1,  8841,    -1,    -1}},
+    {0x2F0A01, {   -1,    -1,  4412,    -1,    -1}},
+    {0x2F0A09, {   -1,    -1,  8915,    -1,    -1}},
+    {0x2F0B01, {   -1,    -1,  4462,    -1,    -1}},
+    {0x2F0B09, {   -1,    -1,  8965,    -1,    -1}},
+    {0x2F0D01, {   -1,    -1,  4562,    -1,    -1}},
+    {0x2F0D09, {   -1,    -1,  9065,    -1,    -1}},
+    {0x2F1A01, {   -1,    -1,  4744,    -1,    -1}},
+    {0x2F1A09, {   -1,    -1,  9247,    -1,    -1}},
+    {0x2F2800, {  216,    -1,    -1,    -1,    -1}},
+    {0x2F3101, {   -1,    -1,  5444,    -1,    -1}},
+    {0x2F3105, {   -1,    -1,  6792,    -1,    -1}},
+    {0x2F3107, {   -1,    -1,  7980,    -1,    -1}},
+    {0x2F3109, {   -1,    -1,  9947,    -1,    -1}},
+    {0x2F3201, {   -1,    -1,  5519,    -1,    -1}},
+    {0x2F3207, {   -1,    -1,  8055,    -1,    -1}},
+    {0x2F3209, {   -1,    -1, 10022,    -1,    -1}},
+    {0x2F3301, {   -1,    -1,  5606,    -1,    -1}},
+    {0x2F3309, {   -1,    -1, 10109,    -1,    -1}},
+    {0x2F3501, {   -1,    -1,  5752,    -1,    -1}},
+    {0x2F3507, {   -1,    -1,  8199,    -1,    -1}},
+    {0x2F3509, {   -1,    -1, 10255,    -1,    -1}},
+    {0x2F3801, {   -1,    -1,  5881,    -1,    -1}},
+    {0x2F3807, {   -1,    -1,  8275,    -1,    -1}},
+    {0x2F3809, {   -1,    -1, 10384,    -1,    -1}},
+    {0x2F3B01, {   -1,    -1,  6070,    -1,    -1}},
+    {0x2F3B09, {   -1,    -1, 10573,    -1,    -1}},
+    {0x2F3E01, {   -1,    -1,  6271,    -1,    -1}},
+    {0x2F3E09, {   -1,    -1, 10774,    -1,    -1}},
+    {0x2F4000, {  352,    -1,    -1,    -1,    -1}},
+    {0x2F4100, {  439,    -1,    -1,    -1,    -1}},
+    {0x2F7E00, {  999,    -1,    -1,    -1,    -1}},
+    {0x2F7F00, { 1127,    -1,    -1,    -1,    -1}},
+    {0x2F7F03, {   -1,    -1,  6508,    -1,    -1}},
+    {0x2F8000, {   -1,    -1,    -1,    -1,    95}},
+    {0x2F8002, {   -1,    -1,   579,    -1,    -1}},
+    {0x2F8004, {   -1,    -1,   897,    -1,    -1}},
+    {0x2F8006, {   -1,    -1,  1106,    -1,    -1}},
+    {0x2F8008, {   -1,    -1,  1271,    -1,    -1}},
+    {0x2F8009, {   -1,    -1,  8476,    -1,    -1}},
+    {0x2F8010, {   -1,    -1,  1725,    -1,    -1}},
+    {0x2F8012, {   -1,    -1,  2108,    -1,    -1}},
+    {0x2F8014, {   -1,    -1,  2297,    -1,    -1}},
+    {0x2F8016, {   -1,    -1,  2399,    -1,    -1}},
+    {0x2F8018, {   -1,    -1,  2478,    -1,    -1}},
+    {0x2F801A, {   -1,    -1,  2529,    -1,    -1}},
+    {0x2F801C, {   -1,    -1,  2566,    -1,    -1}},
+    {0x2F801E, {   -1,    -1,  2592,    -1,    -1}},
+    {0x2F80F2, {   -1,    -1,    -1,    95,    -1}},
+    {0x2F8100, {   -1,    -1,    95,    -1,    -1}},
+    {0x2F81FE, {   -1,    -1,  3973,    -1,    -1}},
+    {0x2F8200, {   -1,    -1,   223,    -1,    -1}},
+    {0x2F8201, {   -1,    -1,  4194,    -1,    -1}},
+    {0x2F8202, {   -1,    -1,   653,    -1,    -1}},
+    {0x2F8209, {   -1,    -1,  8697,    -1,    -1}},
+    {0x2F8210, {   -1,    -1,  1839,    -1,    -1}},
+    {0x2F8212, {   -1,    -1,  2144,    -1,    -1}},
+    {0x2F8214, {   -1,    -1,  2315,    -1,    -1}},
+    {0x2F8300, {   -1,    -1,   351,    -1,    -1}},
+    {0x2F8302, {   -1,    -1,   729,    -1,    -1}},
+    {0x2F8310, {   -1,    -1,  1926,    -1,    -1}},
+    {0x2F8312, {   -1,    -1,  2186,    -1,    -1}},
+    {0x2F8314, {   -1,    -1,  2330,    -1,    -1}},
+    {0x2F8316, {   -1,    -1,  2421,    -1,    -1}},
+    {0x2F8400, {   -1,    -1,   479,    -1,    -1}},
+    {0x2F8402, {   -1,    -1,   822,    -1,    -1}},
+    {0x2F8404, {   -1,    -1,  1049,    -1,    -1}},
+    {0x2F8406, {   -1,    -1,  1220,    -1,    -1}},
+    {0x2F8408, {   -1,    -1,  1362,    -1,    -1}},
+    {0x2F8410, {   -1,    -1,  2032,    -1,    -1}},
+    {0x2F8412, {   -1,    -1,  2247,    -1,    -1}},
+    {0x2F8414, {   -1,    -1,  2367,    -1,    -1}},
+    {0x2F8416, {   -1,    -1,  2447,    -1,    -1}},
+    {0x2F8418, {   -1,    -1,  2512,    -1,    -1}},
+    {0x2F841A, {   -1,    -1,  2550,    -1,    -1}},
+    {0x2F841C, {   -1,    -1,  2581,    -1,    -1}},
+    {0x2F841E, {   -1,    -1,  2605,    -1,    -1}},
+    {0x2F8801, {   -1,    -1,  4242,    -1,    -1}},
+    {0x2F8809, {   -1,    -1,  8745,    -1,    -1}},
+    {0x2F8901, {   -1,    -1,  4339,    -1,    -1}},
+    {0x2F8909, {   -1,    -1,  8842,    -1,    -1}},
+    {0x2F8A01, {   -1,    -1,  4413,    -1,    -1}},
+    {0x2F8A09, {   -1,    -1,  8916,    -1,    -1}},
+    {0x2F8B01, {   -1,    -1,  4463,    -1,    -1}},
+    {0x2F8B09, {   -1,    -1,  8966,    -1,    -1}},
+    {0x2F8C01, {   -1,    -1,  4491,    -1,    -1}},
+    {0x2F8C09, {   -1,    -1,  8994,    -1,    -1}},
+    {0x2F8D01, {   -1,    -1,  4563,    -1,    -1}},
+    {0x2F8D09, {   -1,    -1,  9066,    -1,    -1}},
+    {0x2F9400, {   75,    -1,    -1,    -1,    -1}},
+    {0x2F9A01, {   -1,    -1,  4745,    -1,    -1}},
+    {0x2F9A09, {   -1,    -1,  9248,    -1,    -1}},
+    {0x2F9B00, {   99,    -1,    -1,    -1,    -1}},
+    {0x2FA101, {   -1,    -1,  5051,    -1,    -1}},
+    {0x2FA109, {   -1,    -1,  9554,    -1,    -1}},
+    {0x2FAA01, {   -1,    -1,  5247,    -1,    -1}},
+    {0x2FAA09, {   -1,    -1,  9750,    -1,    -1}},
+    {0x2FB101, {   -1,    -1,  5445,    -1,    -1}},
+    {0x2FB105, {   -1,    -1,  6793,    -1,    -1}},
+    {0x2FB107, {   -1,    -1,  7981,    -1,    -1}},
+    {0x2FB109, {   -1,    -1,  9948,    -1,    -1}},
+    {0x2FB201, {   -1,    -1,  5520,    -1,    -1}},
+    {0x2FB207, {   -1,    -1,  8056,    -1,    -1}},
+    {0x2FB209, {   -1,    -1, 10023,    -1,    -1}},
+    {0x2FB301, {   -1,    -1,  5607,    -1,    -1}},
+    {0x2FB309, {   -1,    -1, 10110,    -1,    -1}},
+    {0x2FB501, {   -1,    -1,  5753,    -1,    -1}},
+    {0x2FB507, {   -1,    -1,  8200,    -1,    -1}},
+    {0x2FB509, {   -1,    -1, 10256,    -1,    -1}},
+    {0x2FB801, {   -1,    -1,  5882,    -1,    -1}},
+    {0x2FB807, {   -1,    -1,  8276,    -1,    -1}},
+    {0x2FB809, {   -1,    -1, 10385,    -1,    -1}},
+    {0x2FBB01, {   -1,    -1,  6071,    -1,    -1}},
+    {0x2FBB09, {   -1,    -1, 10574,    -1,    -1}},
+    {0x2FBE01, {   -1,    -1,  6272,    -1,    -1}},
+    {0x2FBE09, {   -1,    -1, 10775,    -1,    -1}},
+    {0x2FC000, {  353,    -1,    -1,    -1,    -1}},
+    {0x2FC100, {  440,    -1,    -1,    -1,    -1}},
+    {0x2FC200, {  511,    -1,    -1,    -1,    -1}},
+    {0x2FC300, {  570,    -1,    -1,    -1,    -1}},
+    {0x2FC400, {  609,    -1,    -1,    -1,    -1}},
+    {0x2FFE00, { 1000,    -1,    -1,    -1,    -1}},
+    {0x2FFF00, { 1128,    -1,    -1,    -1,    -1}},
+    {0x2FFF03, {   -1,    -1,  6509,    -1,    -1}},
+    {0x300000, {   -1,    -1,    -1,    -1,    96}},
+    {0x300002, {   -1,    -1,   580,    -1,    -1}},
+    {0x300004, {   -1,    -1,   898,    -1,    -1}},
+    {0x300006, {   -1,    -1,  1107,    -1,    -1}},
+    {0x300008, {   -1,    -1,  1272,    -1,    -1}},
+    {0x300009, {   -1,    -1,  8477,    -1,    -1}},
+    {0x30000A, {   -1,    -1,  1407,    -1,    -1}},
+    {0x30000C, {   -1,    -1,  1518,    -1,    -1}},
+    {0x30000E, {   -1,    -1,  1598,    -1,    -1}},
+    {0x300010, {   -1,    -1,  1726,    -1,    -1}},
+    {0x300012, {   -1,    -1,  2109,    -1,    -1}},
+    {0x300014, {   -1,    -1,  2298,    -1,    -1}},
+    {0x300016, {   -1,    -1,  2400,    -1,    -1}},
+    {0x300080, { 1309,    -1,    -1,    -1,    -1}},
+    {0x3000F2, {   -1,    -1,    -1,    96,    -1}},
+    {0x300100, {   -1,    -1,    96,    -1,    -1}},
+    {0x3001FE, {   -1,    -1,  3974,    -1,    -1}},
+    {0x300200, {   -1,    -1,   224,    -1,    -1}},
+    {0x300201, {   -1,    -1,  4195,    -1,    -1}},
+    {0x300202, {   -1,    -1,   654,    -1,    -1}},
+    {0x300204, {   -1,    -1,   936,    -1,    -1}},
+    {0x300209, {   -1,    -1,  8698,    -1,    -1}},
+    {0x300210, {   -1,    -1,  1840,    -1,    -1}},
+    {0x300300, {   -1,    -1,   352,    -1,    -1}},
+    {0x300302, {   -1,    -1,   730,    -1,    -1}},
+    {0x300304, {   -1,    -1,   984,    -1,    -1}},
+    {0x300306, {   -1,    -1,  1169,    -1,    -1}},
+    {0x300308, {   -1,    -1,  1318,    -1,    -1}},
+    {0x300310, {   -1,    -1,  1927,    -1,    -1}},
+    {0x300400, {   -1,    -1,   480,    -1,    -1}},
+    {0x300402, {   -1,    -1,   823,    -1,    -1}},
+    {0x300404, {   -1,    -1,  1050,    -1,    -1}},
+    {0x300406, {   -1,    -1,  1221,    -1,    -1}},
+    {0x300408, {   -1,    -1,  1363,    -1,    -1}},
+    {0x30040A, {   -1,    -1,  1483,    -1,    -1}},
+    {0x30040C, {   -1,    -1,  1572,    -1,    -1}},
+    {0x30040E, {   -1,    -1,  1635,    -1,    -1}},
+    {0x300410, {   -1,    -1,  2033,    -1,    -1}},
+    {0x300412, {   -1,    -1,  2248,    -1,    -1}},
+    {0x300414, {   -1,    -1,  2368,    -1,    -1}},
+    {0x300416, {   -1,    -1,  2448,    -1,    -1}},
+    {0x300801, {   -1,    -1,  4243,    -1,    -1}},
+    {0x300809, {   -1,    -1,  8746,    -1,    -1}},
+    {0x300901, {   -1,    -1,  4340,    -1,    -1}},
+    {0x300909, {   -1,    -1,  8843,    -1,    -1}},
+    {0x300A01, {   -1,    -1,  4414,    -1,    -1}},
+    {0x300A09, {   -1,    -1,  8917,    -1,    -1}},
+    {0x300B01, {   -1,    -1,  4464,    -1,    -1}},
+    {0x300B09, {   -1,    -1,  8967,    -1,    -1}},
+    {0x300C01, {   -1,    -1,  4492,    -1,    -1}},
+    {0x300C09, {   -1,    -1,  8995,    -1,    -1}},
+    {0x300D01, {   -1,    -1,  4564,    -1,    -1}},
+    {0x300D09, {   -1,    -1,  9067,    -1,    -1}},
+    {0x301A01, {   -1,    -1,  4746,    -1,    -1}},
+    {0x301A09, {   -1,    -1,  9249,    -1,    -1}},
+    {0x302101, {   -1,    -1,  5052,    -1,    -1}},
+    {0x302109, {   -1,    -1,  9555,    -1,    -1}},
+    {0x302A01, {   -1,    -1,  5248,    -1,    -1}},
+    {0x302A09, {   -1,    -1,  9751,    -1,    -1}},
+    {0x302D00, {  269,    -1,    -1,    -1,    -1}},
+    {0x303101, {   -1,    -1,  5446,    -1,    -1}},
+    {0x303105, {   -1,    -1,  6794,    -1,    -1}},
+    {0x303107, {   -1,    -1,  7982,    -1,    -1}},
+    {0x303109, {   -1,    -1,  9949,    -1,    -1}},
+    {0x303201, {   -1,    -1,  5521,    -1,    -1}},
+    {0x303207, {   -1,    -1,  8057,    -1,    -1}},
+    {0x303209, {   -1,    -1, 10024,    -1,    -1}},
+    {0x303301, {   -1,    -1,  5608,    -1,    -1}},
+    {0x303309, {   -1,    -1, 10111,    -1,    -1}},
+    {0x303501, {   -1,    -1,  5754,    -1,    -1}},
+    {0x303507, {   -1,    -1,  8201,    -1,    -1}},
+    {0x303509, {   -1,    -1, 10257,    -1,    -1}},
+    {0x303801, {   -1,    -1,  5883,    -1,    -1}},
+    {0x303807, {   -1,    -1,  8277,    -1,    -1}},
+    {0x303809, {   -1,    -1, 10386,    -1,    -1}},
+    {0x303B01, {   -1,    -1,  6072,    -1,    -1}},
+    {0x303B09, {   -1,    -1, 10575,    -1,    -1}},
+    {0x303E01, {   -1,    -1,  6273,    -1,    -1}},
+    {0x303E09, {   -1,    -1, 10776,    -1,    -1}},
+    {0x304000, {  354,    -1,    -1,    -1,    -1}},
+    {0x304100, {  441,    -1,    -1,    -1,    -1}},
+    {0x304200, {  512,    -1,    -1,    -1,    -1}},
+    {0x307E00, { 1001,    -1,    -1,    -1,    -1}},
+    {0x307F00, { 1129,    -1,    -1,    -1,    -1}},
+    {0x307F03, {   -1,    -1,  6510,    -1,    -1}},
+    {0x308000, {   -1,    -1,    -1,    -1,    97}},
+    {0x308002, {   -1,    -1,   581,    -1,    -1}},
+    {0x308004, {   -1,    -1,   899,    -1,    -1}},
+    {0x308006, {   -1,    -1,  1108,    -1,    -1}},
+    {0x308007, {   -1,    -1,  7050,    -1,    -1}},
+    {0x308008, {   -1,    -1,  1273,    -1,    -1}},
+    {0x308009, {   -1,    -1,  8478,    -1,    -1}},
+    {0x30800A, {   -1,    -1,  1408,    -1,    -1}},
+    {0x308010, {   -1,    -1,  1727,    -1,    -1}},
+    {0x308080, { 1310,    -1,    -1,    -1,    -1}},
+    {0x3080F2, {   -1,    -1,    -1,    97,    -1}},
+    {0x308100, {   -1,    -1,    97,    -1,    -1}},
+    {0x308101, {   -1,    -1,  4093,    -1,    -1}},
+    {0x308109, {   -1,    -1,  8596,    -1,    -1}},
+    {0x3081FE, {   -1,    -1,  3975,    -1,    -1}},
+    {0x308200, {   -1,    -1,   225,    -1,    -1}},
+    {0x308201, {   -1,    -1,  4196,    -1,    -1}},
+    {0x308202, {   -1,    -1,   655,    -1,    -1}},
+    {0x308204, {   -1,    -1,   937,    -1,    -1}},
+    {0x308209, {   -1,    -1,  8699,    -1,    -1}},
+    {0x308210, {   -1,    -1,  1841,    -1,    -1}},
+    {0x308300, {   -1,    -1,   353,    -1,    -1}},
+    {0x308302, {   -1,    -1,   731,    -1,    -1}},
+    {0x308304, {   -1,    -1,   985,    -1,    -1}},
+    {0x308306, {   -1,    -1,  1170,    -1,    -1}},
+    {0x308308, {   -1,    -1,  1319,    -1,    -1}},
+    {0x308310, {   -1,    -1,  1928,    -1,    -1}},
+    {0x308400, {   -1,    -1,   481,    -1,    -1}},
+    {0x308402, {   -1,    -1,   824,    -1,    -1}},
+    {0x308404, {   -1,    -1,  1051,    -1,    -1}},
+    {0x308406, {   -1,    -1,  1222,    -1,    -1}},
+    {0x308408, {   -1,    -1,  1364,    -1,    -1}},
+    {0x30840A, {   -1,    -1,  1484,    -1,    -1}},
+    {0x308410, {   -1,    -1,  2034,    -1,    -1}},
+    {0x308901, {   -1,    -1,  4341,    -1,    -1}},
+    {0x308907, {   -1,    -1,  7248,    -1,    -1}},
+    {0x308909, {   -1,    -1,  8844,    -1,    -1}},
+    {0x308C01, {   -1,    -1,  4493,    -1,    -1}},
+    {0x308C09, {   -1,    -1,  8996,    -1,    -1}},
+    {0x309801, {   -1,    -1,  4631,    -1,    -1}},
+    {0x309809, {   -1,    -1,  9134,    -1,    -1}},
+    {0x309B00, {  100,    -1,    -1,    -1,    -1}},
+    {0x30A101, {   -1,    -1,  5053,    -1,    -1}},
+    {0x30A109, {   -1,    -1,  9556,    -1,    -1}},
+    {0x30AA01, {   -1,    -1,  5249,    -1,    -1}},
+    {0x30AA09, {   -1,    -1,  9752,    -1,    -1}},
+    {0x30B001, {   -1,    -1,  5358,    -1,    -1}},
+    {0x30B007, {   -1,    -1,  7894,    -1,    -1}},
+    {0x30B009, {   -1,    -1,  9861,    -1,    -1}},
+    {0x30B101, {   -1,    -1,  5447,    -1,    -1}},
+    {0x30B105, {   -1,    -1,  6795,    -1,    -1}},
+    {0x30B107, {   -1,    -1,  7983,    -1,    -1}},
+    {0x30B109, {   -1,    -1,  9950,    -1,    -1}},
+    {0x30B201, {   -1,    -1,  5522,    -1,    -1}},
+    {0x30B207, {   -1,    -1,  8058,    -1,    -1}},
+    {0x30B209, {   -1,    -1, 10025,    -1,    -1}},
+    {0x30B301, {   -1,    -1,  5609,    -1,    -1}},
+    {0x30B309, {   -1,    -1, 10112,    -1,    -1}},
+    {0x30BB01, {   -1,    -1,  6073,    -1,    -1}},
+    {0x30BB09, {   -1,    -1, 10576,    -1,    -1}},
+    {0x30C000, {  355,    -1,    -1,    -1,    -1}},
+    {0x30C100, {  442,    -1,    -1,    -1,    -1}},
+    {0x30C200, {  513,    -1,    -1,    -1,    -1}},
+    {0x30C300, {  571,    -1,    -1,    -1,    -1}},
+    {0x30FE00, { 1002,    -1,    -1,    -1,    -1}},
+    {0x30FF00, { 1130,    -1,    -1,    -1,    -1}},
+    {0x30FF03, {   -1,    -1,  6511,    -1,    -1}},
+    {0x310000, {   -1,    -1,    -1,    -1,    98}},
+    {0x310002, {   -1,     5,   582,    -1,    -1}},
+    {0x310004, {   -1,    -1,   900,    -1,    -1}},
+    {0x310006, {   -1,    -1,  1109,    -1,    -1}},
+    {0x310007, {   -1,    -1,  7051,    -1,    -1}},
+    {0x310008, {   -1,    -1,  1274,    -1,    -1}},
+    {0x310009, {   -1,    -1,  8479,    -1,    -1}},
+    {0x31000A, {   -1,    -1,  1409,    -1,    -1}},
+    {0x31000C, {   -1,    -1,  1519,    -1,    -1}},
+    {0x31000E, {   -1,    -1,  1599,    -1,    -1}},
+    {0x310010, {   -1,    -1,  1728,    -1,    -1}},
+    {0x310012, {   -1,    -1,  2110,    -1,    -1}},
+    {0x310014, {   -1,    -1,  2299,    -1,    -1}},
+    {0x310016, {   -1,    -1,  2401,    -1,    -1}},
+    {0x310018, {   -1,    -1,  2479,    -1,    -1}},
+    {0x31001A, {   -1,    -1,  2530,    -1,    -1}},
+    {0x310020, {   -1,    -1,  2660,    -1,    -1}},
+    {0x310022, {   -1,    -1,  2875,    -1,    -1}},
+    {0x310024, {   -1,    -1,  2977,    -1,    -1}},
+    {0x310026, {   -1,    -1,  3041,    -1,    -1}},
+    {0x310028, {   -1,    -1,  3089,    -1,    -1}},
+    {0x31002A, {   -1,    -1,  3121,    -1,    -1}},
+    {0x31002C, {   -1,    -1,  3147,    -1,    -1}},
+    {0x31002E, {   -1,    -1,  3174,    -1,    -1}},
+    {0x310080, { 1311,    -1,    -1,    -1,    -1}},
+    {0x3100F2, {   -1,    -1,    -1,    98,    -1}},
+    {0x310100, {   -1,    -1,    98,    -1,    -1}},
+    {0x310101, {   -1,    -1,  4094,    -1,    -1}},
+    {0x310102, {   -1,    -1,   610,    -1,    -1}},
+    {0x310109, {   -1,    -1,  8597,    -1,    -1}},
+    {0x3101F2, {   -1,    -1,    -1,   176,    -1}},
+    {0x3101FE, {   -1,    -1,  3976,    -1,    -1}},
+    {0x310200, {   -1,    -1,   226,    -1,    -1}},
+    {0x310201, {   -1,    -1,  4197,    -1,    -1}},
+    {0x310202, {   -1,    -1,   656,    -1,    -1}},
+    {0x310204, {   -1,    -1,   938,    -1,    -1}},
+    {0x310206, {   -1,    -1,  1137,    -1,    -1}},
+    {0x310208, {   -1,    -1,  1298,    -1,    -1}},
+    {0x310209, {   -1,    -1,  8700,    -1,    -1}},
+    {0x31020A, {   -1,    -1,  1431,    -1,    -1}},
+    {0x31020C, {   -1,    -1,  1535,    -1,    -1}},
+    {0x31020E, {   -1,    -1,  1612,    -1,    -1}},
+    {0x310210, {   -1,    -1,  1842,    -1,    -1}},
+    {0x310212, {   -1,    -1,  2145,    -1,    -1}},
+    {0x310220, {   -1,    -1,  2712,    -1,    -1}},
+    {0x310222, {   -1,    -1,  2892,    -1,    -1}},
+    {0x310224, {   -1,    -1,  2989,    -1,    -1}},
+    {0x310226, {   -1,    -1,  3051,    -1,    -1}},
+    {0x310300, {   -1,    -1,   354,    -1,    -1}},
+    {0x310302, {   -1,    -1,   732,    -1,    -1}},
+    {0x310304, {   -1,    -1,   986,    -1,    -1}},
+    {0x310306, {   -1,    -1,  1171,    -1,    -1}},
+    {0x310308, {   -1,    -1,  1320,    -1,    -1}},
+    {0x31030A, {   -1,    -1,  1446,    -1,    -1}},
+    {0x31030C, {   -1,    -1,  1546,    -1,    -1}},
+    {0x31030E, {   -1,    -1,  1617,    -1,    -1}},
+    {0x310310, {   -1,    -1,  1929,    -1,    -1}},
+    {0x310312, {   -1,    -1,  2187,    -1,    -1}},
+    {0x310314, {   -1,    -1,  2331,    -1,    -1}},
+    {0x310316, {   -1,    -1,  2422,    -1,    -1}},
+    {0x310320, {   -1,    -1,  2764,    -1,    -1}},
+    {0x310322, {   -1,    -1,  2914,    -1,    -1}},
+    {0x310324, {   -1,    -1,  3001,    -1,    -1}},
+    {0x310326, {   -1,    -1,  3057,    -1,    -1}},
+    {0x310328, {   -1,    -1,  3098,    -1,    -1}},
+    {0x310400, {   -1,    -1,   482,    -1,    -1}},
+    {0x310402, {   -1,    -1,   825,    -1,    -1}},
+    {0x310404, {   -1,    -1,  1052,    -1,    -1}},
+    {0x310406, {   -1,    -1,  1223,    -1,    -1}},
+    {0x310408, {   -1,    -1,  1365,    -1,    -1}},
+    {0x31040A, {   -1,    -1,  1485,    -1,    -1}},
+    {0x31040C, {   -1,    -1,  1573,    -1,    -1}},
+    {0x31040E, {   -1,    -1,  1636,    -1,    -1}},
+    {0x310410, {   -1,    -1,  2035,    -1,    -1}},
+    {0x310412, {   -1,    -1,  2249,    -1,    -1}},
+    {0x310414, {   -1,    -1,  2369,    -1,    -1}},
+    {0x310416, {   -1,    -1,  2449,    -1,    -1}},
+    {0x310418, {   -1,    -1,  2513,    -1,    -1}},
+    {0x31041A, {   -1,    -1,  2551,    -1,    -1}},
+    {0x310420, {   -1,    -1,  2829,    -1,    -1}},
+    {0x310422, {   -1,    -1,  2950,    -1,    -1}},
+    {0x310424, {   -1,    -1,  3021,    -1,    -1}},
+    {0x310426, {   -1,    -1,  3072,    -1,    -1}},
+    {0x310428, {   -1,    -1,  3108,    -1,    -1}},
+    {0x31042A, {   -1,    -1,  3135,    -1,    -1}},
+    {0x31042C, {   -1,    -1,  3162,    -1,    -1}},
+    {0x31042E, {   -1,    -1,  3188,    -1,    -1}},
+    {0x310901, {   -1,    -1,  4342,    -1,    -1}},
+    {0x310907, {   -1,    -1,  7249,    -1,    -1}},
+    {0x310909, {   -1,    -1,  8845,    -1,    -1}},
+    {0x310C00, {   36,    -1,    -1,    -1,    -1}},
+    {0x310C01, {   -1,    -1,  4494,    -1,    -1}},
+    {0x310C09, {   -1,    -1,  8997,    -1,    -1}},
+    {0x310E00, {   39,    -1,    -1,    -1,    -1}},
+    {0x311200, {   65,    -1,    -1,    -1,    -1}},
+    {0x311801, {   -1,    -1,  4632,    -1,    -1}},
+    {0x311809, {   -1,    -1,  9135,    -1,    -1}},
+    {0x312001, {   -1,    -1,  4994,    -1,    -1}},
+    {0x312009, {   -1,    -1,  9497,    -1,    -1}},
+    {0x312101, {   -1,    -1,  5054,    -1,    -1}},
+    {0x312109, {   -1,    -1,  9557,    -1,    -1}},
+    {0x312300, {  156,    -1,    -1,    -1,    -1}},
+    {0x312800, {  217,    -1,    -1,    -1,    -1}},
+    {0x312900, {  239,    -1,    -1,    -1,    -1}},
+    {0x312901, {   -1,    -1,  5219,    -1,    -1}},
+    {0x312909, {   -1,    -1,  9722,    -1,    -1}},
+    {0x312A00, {  248,    -1,    -1,    -1,    -1}},
+    {0x312A01, {   -1,    -1,  5250,    -1,    -1}},
+    {0x312A09, {   -1,    -1,  9753,    -1,    -1}},
+    {0x313001, {   -1,    -1,  5359,    -1,    -1}},
+    {0x313007, {   -1,    -1,  7895,    -1,    -1}},
+    {0x313009, {   -1,    -1,  9862,    -1,    -1}},
+    {0x313101, {   -1,    -1,  5448,    -1,    -1}},
+    {0x313105, {   -1,    -1,  6796,    -1,    -1}},
+    {0x313107, {   -1,    -1,  7984,    -1,    -1}},
+    {0x313109, {   -1,    -1,  9951,    -1,    -1}},
+    {0x313201, {   -1,    -1,  5523,    -1,    -1}},
+    {0x313207, {   -1,    -1,  8059,    -1,    -1}},
+    {0x313209, {   -1,    -1, 10026,    -1,    -1}},
+    {0x313301, {   -1,    -1,  5610,    -1,    -1}},
+    {0x313309, {   -1,    -1, 10113,    -1,    -1}},
+    {0x313B01, {   -1,    -1,  6074,    -1,    -1}},
+    {0x313B09, {   -1,    -1, 10577,    -1,    -1}},
+    {0x314000, {  356,    -1,    -1,    -1,    -1}},
+    {0x314100, {  443,    -1,    -1,    -1,    -1}},
+    {0x314200, {  514,    -1,    -1,    -1,    -1}},
+    {0x314300, {  572,    -1,    -1,    -1,    -1}},
+    {0x314400, {  610,    -1,    -1,    -1,    -1}},
+    {0x314500, {  641,    -1,    -1,    -1,    -1}},
+    {0x314600, {  670,    -1,    -1,    -1,    -1}},
+    {0x314700, {  695,    -1,    -1,    -1,    -1}},
+    {0x314800, {  715,    -1,    -1,    -1,    -1}},
+    {0x314900, {  733,    -1,    -1,    -1,    -1}},
+    {0x314A00, {  750,    -1,    -1,    -1,    -1}},
+    {0x317E00, { 1003,    -1,    -1,    -1,    -1}},
+    {0x317F00, { 1131,    -1,    -1,    -1,    -1}},
+    {0x317F03, {   -1,    -1,  6512,    -1,    -1}},
+    {0x318000, {   -1,    -1,    -1,    -1,    99}},
+    {0x318002, {   -1,    -1,   583,    -1,    -1}},
+    {0x318004, {   -1,    -1,   901,    -1,    -1}},
+    {0x318006, {   -1,    -1,  1110,    -1,    -1}},
+    {0x318007, {   -1,    -1,  7052,    -1,    -1}},
+    {0x318008, {   -1,    -1,  1275,    -1,    -1}},
+    {0x318009, {   -1,    -1,  8480,    -1,    -1}},
+    {0x31800A, {   -1,    -1,  1410,    -1,    -1}},
+    {0x31800C, {   -1,    -1,  1520,    -1,    -1}},
+    {0x31800E, {   -1,    -1,  1600,    -1,    -1}},
+    {0x318010, {   -1,    -1,  1729,    -1,    -1}},
+    {0x318012, {   -1,    -1,  2111,    -1,    -1}},
+    {0x318014, {   -1,    -1,  2300,    -1,    -1}},
+    {0x318016, {   -1,    -1,  2402,    -1,    -1}},
+    {0x318080, { 1312,    -1,    -1,    -1,    -1}},
+    {0x3180F2, {   -1,    -1,    -1,    99,    -1}},
+    {0x318100, {   -1,    -1,    99,    -1,    -1}},
+    {0x318101, {   -1,    -1,  4095,    -1,    -1}},
+    {0x318109, {   -1,    -1,  8598,    -1,    -1}},
+    {0x3181FE, {   -1,    -1,  3977,    -1,    -1}},
+    {0x318200, {   -1,    -1,   227,    -1,    -1}},
+    {0x318201, {   -1,    -1,  4198,    -1,    -1}},
+    {0x318202, {   -1,    -1,   657,    -1,    -1}},
+    {0x318204, {   -1,    -1,   939,    -1,    -1}},
+    {0x318206, {   -1,    -1,  1138,    -1,    -1}},
+    {0x318208, {   -1,    -1,  1299,    -1,    -1}},
+    {0x318209, {   -1,    -1,  8701,    -1,    -1}},
+    {0x31820A, {   -1,    -1,  1432,    -1,    -1}},
+    {0x31820C, {   -1,    -1,  1536,    -1,    -1}},
+    {0x318300, {   -1,    -1,   355,    -1,    -1}},
+    {0x318302, {   -1,    -1,   733,    -1,    -1}},
+    {0x318304, {   -1,    -1,   987,    -1,    -1}},
+    {0x318306, {   -1,    -1,  1172,    -1,    -1}},
+    {0x318308, {   -1,    -1,  1321,    -1,    -1}},
+    {0x31830A, {   -1,    -1,  1447,    -1,    -1}},
+    {0x31830C, {   -1,    -1,  1547,    -1,    -1}},
+    {0x31830E, {   -1,    -1,  1618,    -1,    -1}},
+    {0x318310, {   -1,    -1,  1930,    -1,    -1}},
+    {0x318312, {   -1,    -1,  2188,    -1,    -1}},
+    {0x318400, {   -1,    -1,   483,    -1,    -1}},
+    {0x318402, {   -1,    -1,   826,    -1,    -1}},
+    {0x318404, {   -1,    -1,  1053,    -1,    -1}},
+    {0x318406, {   -1,    -1,  1224,    -1,    -1}},
+    {0x318408, {   -1,    -1,  1366,    -1,    -1}},
+    {0x31840A, {   -1,    -1,  1486,    -1,    -1}},
+    {0x31840C, {   -1,    -1,  1574,    -1,    -1}},
+    {0x31840E, {   -1,    -1,  1637,    -1,    -1}},
+    {0x318410, {   -1,    -1,  2036,    -1,    -1}},
+    {0x318412, {   -1,    -1,  2250,    -1,    -1}},
+    {0x318414, {   -1,    -1,  2370,    -1,    -1}},
+    {0x318416, {   -1,    -1,  2450,    -1,    -1}},
+    {0x318901, {   -1,    -1,  4343,    -1,    -1}},
+    {0x318907, {   -1,    -1,  7250,    -1,    -1}},
+    {0x318909, {   -1,    -1,  8846,    -1,    -1}},
+    {0x318C01, {   -1,    -1,  4495,    -1,    -1}},
+    {0x318C09, {   -1,    -1,  8998,    -1,    -1}},
+    {0x319200, {   66,    -1,    -1,    -1,    -1}},
+    {0x319300, {   70,    -1,    -1,    -1,    -1}},
+    {0x319801, {   -1,    -1,  4633,    -1,    -1}},
+    {0x319809, {   -1,    -1,  9136,    -1,    -1}},
+    {0x31A001, {   -1,    -1,  4995,    -1,    -1}},
+    {0x31A009, {   -1,    -1,  9498,    -1,    -1}},
+    {0x31A101, {   -1,    -1,  5055,    -1,    -1}},
+    {0x31A109, {   -1,    -1,  9558,    -1,    -1}},
+    {0x31A800, {  218,    -1,    -1,    -1,    -1}},
+    {0x31A901, {   -1,    -1,  5220,    -1,    -1}},
+    {0x31A909, {   -1,    -1,  9723,    -1,    -1}},
+    {0x31AA01, {   -1,    -1,  5251,    -1,    -1}},
+    {0x31AA09, {   -1,    -1,  9754,    -1,    -1}},
+    {0x31B001, {   -1,    -1,  5360,    -1,    -1}},
+    {0x31B007, {   -1,    -1,  7896,    -1,    -1}},
+    {0x31B009, {   -1,    -1,  9863,    -1,    -1}},
+    {0x31B101, {   -1,    -1,  5449,    -1,    -1}},
+    {0x31B105, {   -1,    -1,  6797,    -1,    -1}},
+    {0x31B107, {   -1,    -1,  7985,    -1,    -1}},
+    {0x31B109, {   -1,    -1,  9952,    -1,    -1}},
+    {0x31B201, {   -1,    -1,  5524,    -1,    -1}},
+    {0x31B207, {   -1,    -1,  8060,    -1,    -1}},
+    {0x31B209, {   -1,    -1, 10027,    -1,    -1}},
+    {0x31B301, {   -1,    -1,  5611,    -1,    -1}},
+    {0x31B309, {   -1,    -1, 10114,    -1,    -1}},
+    {0x31BB01, {   -1,    -1,  6075,    -1,    -1}},
+    {0x31BB09, {   -1,    -1, 10578,    -1,    -1}},
+    {0x31C000, {  357,    -1,    -1,    -1,    -1}},
+    {0x31C100, {  444,    -1,    -1,    -1,    -1}},
+    {0x31C200, {  515,    -1,    -1,    -1,    -1}},
+    {0x31C300, {  573,    -1,    -1,    -1,    -1}},
+    {0x31C400, {  611,    -1,    -1,    -1,    -1}},
+    {0x31C500, {  642,    -1,    -1,    -1,    -1}},
+    {0x31C600, {  671,    -1,    -1,    -1,    -1}},
+    {0x31C700, {  696,    -1,    -1,    -1,    -1}},
+    {0x31C800, {  716,    -1,    -1,    -1,    -1}},
+    {0x31C900, {  734,    -1,    -1,    -1,    -1}},
+    {0x31FE00, { 1004,    -1,    -1,    -1,    -1}},
+    {0x31FF00, { 1132,    -1,    -1,    -1,    -1}},
+    {0x31FF03, {   -1,    -1,  6513,    -1,    -1}},
+    {0x320000, {   -1,    -1,    -1,    -1,   100}},
+    {0x320002, {   -1,    -1,   584,    -1,    -1}},
+    {0x320004, {   -1,    -1,   902,    -1,    -1}},
+    {0x320006, {   -1,    -1,  1111,    -1,    -1}},
+    {0x320007, {   -1,    -1,  7053,    -1,    -1}},
+    {0x320008, {   -1,    -1,  1276,    -1,    -1}},
+    {0x320009, {   -1,    -1,  8481,    -1,    -1}},
+    {0x32000A, {   -1,    -1,  1411,    -1,    -1}},
+    {0x32000C, {   -1,    -1,  1521,    -1,    -1}},
+    {0x32000E, {   -1,    -1,  1601,    -1,    -1}},
+    {0x320010, {   -1,    -1,  1730,    -1,    -1}},
+    {0x320080, { 1313,    -1,    -1,    -1,    -1}},
+    {0x3200F2, {   -1,    -1,    -1,   100,    -1}},
+    {0x320100, {   -1,    -1,   100,    -1,    -1}},
+    {0x320101, {   -1,    -1,  4096,    -1,    -1}},
+    {0x320109, {   -1,    -1,  8599,    -1,    -1}},
+    {0x3201FE, {   -1,    -1,  3978,    -1,    -1}},
+    {0x320200, {   -1,    -1,   228,    -1,    -1}},
+    {0x320201, {   -1,    -1,  4199,    -1,    -1}},
+    {0x320209, {   -1,    -1,  8702,    -1,    -1}},
+    {0x320300, {   -1,    -1,   356,    -1,    -1}},
+    {0x320302, {   -1,    -1,   734,    -1,    -1}},
+    {0x320304, {   -1,    -1,   988,    -1,    -1}},
+    {0x320310, {   -1,    -1,  1931,    -1,    -1}},
+    {0x320400, {   -1,    -1,   484,    -1,    -1}},
+    {0x320402, {   -1,    -1,   827,    -1,    -1}},
+    {0x320404, {   -1,    -1,  1054,    -1,    -1}},
+    {0x320406, {   -1,    -1,  1225,    -1,    -1}},
+    {0x320408, {   -1,    -1,  1367,    -1,    -1}},
+    {0x32040A, {   -1,    -1,  1487,    -1,    -1}},
+    {0x32040C, {   -1,    -1,  1575,    -1,    -1}},
+    {0x32040E, {   -1,    -1,  1638,    -1,    -1}},
+    {0x320410, {   -1,    -1,  2037,    -1,    -1}},
+    {0x320901, {   -1,    -1,  4344,    -1,    -1}},
+    {0x320907, {   -1,    -1,  7251,    -1,    -1}},
+    {0x320909, {   -1,    -1,  8847,    -1,    -1}},
+    {0x320C01, {   -1,    -1,  4496,    -1,    -1}},
+    {0x320C09, {   -1,    -1,  8999,    -1,    -1}},
+    {0x321801, {   -1,    -1,  4634,    -1,    -1}},
+    {0x321809, {   -1,    -1,  9137,    -1,    -1}},
+    {0x322001, {   -1,    -1,  4996,    -1,    -1}},
+    {0x322007, {   -1,    -1,  7752,    -1,    -1}},
+    {0x322009, {   -1,    -1,  9499,    -1,    -1}},
+    {0x322101, {   -1,    -1,  5056,    -1,    -1}},
+    {0x322109, {   -1,    -1,  9559,    -1,    -1}},
+    {0x322801, {   -1,    -1,  5162,    -1,    -1}},
+    {0x322809, {   -1,    -1,  9665,    -1,    -1}},
+    {0x322A01, {   -1,    -1,  5252,    -1,    -1}},
+    {0x322A09, {   -1,    -1,  9755,    -1,    -1}},
+    {0x323001, {   -1,    -1,  5361,    -1,    -1}},
+    {0x323007, {   -1,    -1,  7897,    -1,    -1}},
+    {0x323009, {   -1,    -1,  9864,    -1,    -1}},
+    {0x323201, {   -1,    -1,  5525,    -1,    -1}},
+    {0x323207, {   -1,    -1,  8061,    -1,    -1}},
+    {0x323209, {   -1,    -1, 10028,    -1,    -1}},
+    {0x323301, {   -1,    -1,  5612,    -1,    -1}},
+    {0x323309, {   -1,    -1, 10115,    -1,    -1}},
+    {0x323B01, {   -1,    -1,  6076,    -1,    -1}},
+    {0x323B09, {   -1,    -1, 10579,    -1,    -1}},
+    {0x324000, {  358,    -1,    -1,    -1,    -1}},
+    {0x324100, {  445,    -1,    -1,    -1,    -1}},
+    {0x324200, {  516,    -1,    -1,    -1,    -1}},
+    {0x326000, {  857,    -1,    -1,    -1,    -1}},
+    {0x327E00, { 1005,    -1,    -1,    -1,    -1}},
+    {0x327F00, { 1133,    -1,    -1,    -1,    -1}},
+    {0x327F03, {   -1,    -1,  6514,    -1,    -1}},
+    {0x328000, {   -1,    -1,    -1,    -1,   101}},
+    {0x328002, {   -1,    -1,   585,    -1,    -1}},
+    {0x328004, {   -1,    -1,   903,    -1,    -1}},
+    {0x328006, {   -1,    -1,  1112,    -1,    -1}},
+    {0x328007, {   -1,    -1,  7054,    -1,    -1}},
+    {0x328008, {   -1,    -1,  1277,    -1,    -1}},
+    {0x328009, {   -1,    -1,  8482,    -1,    -1}},
+    {0x32800A, {   -1,    -1,  1412,    -1,    -1}},
+    {0x32800C, {   -1,    -1,  1522,    -1,    -1}},
+    {0x32800E, {   -1,    -1,  1602,    -1,    -1}},
+    {0x328010, {   -1,    -1,  1731,    -1,    -1}},
+    {0x328012, {   -1,    -1,  2112,    -1,    -1}},
+    {0x328014, {   -1,    -1,  2301,    -1,    -1}},
+    {0x328016, {   -1,    -1,  2403,    -1,    -1}},
+    {0x328018, {   -1,    -1,  2480,    -1,    -1}},
+    {0x32801A, {   -1,    -1,  2531,    -1,    -1}},
+    {0x32801C, {   -1,    -1,  2567,    -1,    -1}},
+    {0x32801E, {   -1,    -1,  2593,    -1,    -1}},
+    {0x328020, {   -1,    -1,  2661,    -1,    -1}},
+    {0x328022, {   -1,    -1,  2876,    -1,    -1}},
+    {0x328024, {   -1,    -1,  2978,    -1,    -1}},
+    {0x328026, {   -1,    -1,  3042,    -1,    -1}},
+    {0x328028, {   -1,    -1,  3090,    -1,    -1}},
+    {0x32802A, {   -1,    -1,  3122,    -1,    -1}},
+    {0x32802C, {   -1,    -1,  3148,    -1,    -1}},
+    {0x32802E, {   -1,    -1,  3175,    -1,    -1}},
+    {0x328030, {   -1,    -1,  3226,    -1,    -1}},
+    {0x328032, {   -1,    -1,  3344,    -1,    -1}},
+    {0x328034, {   -1,    -1,  3403,    -1,    -1}},
+    {0x328036, {   -1,    -1,  3441,    -1,    -1}},
+    {0x328038, {   -1,    -1,  3466,    -1,    -1}},
+    {0x32803A, {   -1,    -1,  3488,    -1,    -1}},
+    {0x32803C, {   -1,    -1,  3504,    -1,    -1}},
+    {0x32803E, {   -1,    -1,  3519,    -1,    -1}},
+    {0x328040, {   -1,    -1,  3547,    -1,    -1}},
+    {0x328080, { 1314,    -1,    -1,    -1,    -1}},
+    {0x3280F2, {   -1,    -1,    -1,   101,    -1}},
+    {0x328100, {   -1,    -1,   101,    -1,    -1}},
+    {0x328101, {   -1,    -1,  4097,    -1,    -1}},
+    {0x328109, {   -1,    -1,  8600,    -1,    -1}},
+    {0x3281FE, {   -1,    -1,  3979,    -1,    -1}},
+    {0x328200, {   -1,    -1,   229,    -1,    -1}},
+    {0x328201, {   -1,    -1,  4200,    -1,    -1}},
+    {0x328202, {   -1,    -1,   658,    -1,    -1}},
+    {0x328204, {   -1,    -1,   940,    -1,    -1}},
+    {0x328209, {   -1,    -1,  8703,    -1,    -1}},
+    {0x328300, {   -1,    -1,   357,    -1,    -1}},
+    {0x328302, {   -1,    -1,   735,    -1,    -1}},
+    {0x328304, {   -1,    -1,   989,    -1,    -1}},
+    {0x328306, {   -1,    -1,  1173,    -1,    -1}},
+    {0x328308, {   -1,    -1,  1322,    -1,    -1}},
+    {0x32830A, {   -1,    -1,  1448,    -1,    -1}},
+    {0x32830C, {   -1,    -1,  1548,    -1,    -1}},
+    {0x32830E, {   -1,    -1,  1619,    -1,    -1}},
+    {0x328310, {   -1,    -1,  1932,    -1,    -1}},
+    {0x328312, {   -1,    -1,  2189,    -1,    -1}},
+    {0x328314, {   -1,    -1,  2332,    -1,    -1}},
+    {0x328316, {   -1,    -1,  2423,    -1,    -1}},
+    {0x328318, {   -1,    -1,  2490,    -1,    -1}},
+    {0x32831A, {   -1,    -1,  2539,    -1,    -1}},
+    {0x32831C, {   -1,    -1,  2572,    -1,    -1}},
+    {0x32831E, {   -1,    -1,  2598,    -1,    -1}},
+    {0x328320, {   -1,    -1,  2765,    -1,    -1}},
+    {0x328400, {   -1,    -1,   485,    -1,    -1}},
+    {0x328402, {   -1,    -1,   828,    -1,    -1}},
+    {0x328404, {   -1,    -1,  1055,    -1,    -1}},
+    {0x328406, {   -1,    -1,  1226,    -1,    -1}},
+    {0x328408, {   -1,    -1,  1368,    -1,    -1}},
+    {0x32840A, {   -1,    -1,  1488,    -1,    -1}},
+    {0x32840C, {   -1,    -1,  1576,    -1,    -1}},
+    {0x32840E, {   -1,    -1,  1639,    -1,    -1}},
+    {0x328410, {   -1,    -1,  2038,    -1,    -1}},
+    {0x328412, {   -1,    -1,  2251,    -1,    -1}},
+    {0x328414, {   -1,    -1,  2371,    -1,    -1}},
+    {0x328416, {   -1,    -1,  2451,    -1,    -1}},
+    {0x328418, {   -1,    -1,  2514,    -1,    -1}},
+    {0x32841A, {   -1,    -1,  2552,    -1,    -1}},
+    {0x32841C, {   -1,    -1,  2582,    -1,    -1}},
+    {0x32841E, {   -1,    -1,  2606,    -1,    -1}},
+    {0x328420, {   -1,    -1,  2830,    -1,    -1}},
+    {0x328422, {   -1,    -1,  2951,    -1,    -1}},
+    {0x328424, {   -1,    -1,  3022,    -1,    -1}},
+    {0x328426, {   -1,    -1,  3073,    -1,    -1}},
+    {0x328428, {   -1,    -1,  3109,    -1,    -1}},
+    {0x32842A, {   -1,    -1,  3136,    -1,    -1}},
+    {0x32842C, {   -1,    -1,  3163,    -1,    -1}},
+    {0x32842E, {   -1,    -1,  3189,    -1,    -1}},
+    {0x328430, {   -1,    -1,  3316,    -1,    -1}},
+    {0x328432, {   -1,    -1,  3383,    -1,    -1}},
+    {0x328434, {   -1,    -1,  3428,    -1,    -1}},
+    {0x328436, {   -1,    -1,  3457,    -1,    -1}},
+    {0x328438, {   -1,    -1,  3479,    -1,    -1}},
+    {0x32843A, {   -1,    -1,  3497,    -1,    -1}},
+    {0x32843C, {   -1,    -1,  3512,    -1,    -1}},
+    {0x32843E, {   -1,    -1,  3527,    -1,    -1}},
+    {0x328440, {   -1,    -1,  3596,    -1,    -1}},
+    {0x328901, {   -1,    -1,  4345,    -1,    -1}},
+    {0x328907, {   -1,    -1,  7252,    -1,    -1}},
+    {0x328909, {   -1,    -1,  8848,    -1,    -1}},
+    {0x328C01, {   -1,    -1,  4497,    -1,    -1}},
+    {0x328C09, {   -1,    -1,  9000,    -1,    -1}},
+    {0x329801, {   -1,    -1,  4635,    -1,    -1}},
+    {0x329809, {   -1,    -1,  9138,    -1,    -1}},
+    {0x32A001, {   -1,    -1,  4997,    -1,    -1}},
+    {0x32A007, {   -1,    -1,  7753,    -1,    -1}},
+    {0x32A009, {   -1,    -1,  9500,    -1,    -1}},
+    {0x32A101, {   -1,    -1,  5057,    -1,    -1}},
+    {0x32A109, {   -1,    -1,  9560,    -1,    -1}},
+    {0x32A801, {   -1,    -1,  5163,    -1,    -1}},
+    {0x32A809, {   -1,    -1,  9666,    -1,    -1}},
+    {0x32AA01, {   -1,    -1,  5253,    -1,    -1}},
+    {0x32AA09, {   -1,    -1,  9756,    -1,    -1}},
+    {0x32B001, {   -1,    -1,  5362,    -1,    -1}},
+    {0x32B007, {   -1,    -1,  7898,    -1,    -1}},
+    {0x32B009, {   -1,    -1,  9865,    -1,    -1}},
+    {0x32B201, {   -1,    -1,  5526,    -1,    -1}},
+    {0x32B207, {   -1,    -1,  8062,    -1,    -1}},
+    {0x32B209, {   -1,    -1, 10029,    -1,    -1}},
+    {0x32B301, {   -1,    -1,  5613,    -1,    -1}},
+    {0x32B309, {   -1,    -1, 10116,    -1,    -1}},
+    {0x32BB01, {   -1,    -1,  6077,    -1,    -1}},
+    {0x32BB09, {   -1,    -1, 10580,    -1,    -1}},
+    {0x32C000, {  359,    -1,    -1,    -1,    -1}},
+    {0x32C100, {  446,    -1,    -1,    -1,    -1}},
+    {0x32C200, {  517,    -1,    -1,    -1,    -1}},
+    {0x32C300, {  574,    -1,    -1,    -1,    -1}},
+    {0x32C400, {  612,    -1,    -1,    -1,    -1}},
+    {0x32C500, {  643,    -1,    -1,    -1,    -1}},
+    {0x32C600, {  672,    -1,    -1,    -1,    -1}},
+    {0x32C700, {  697,    -1,    -1,    -1,    -1}},
+    {0x32C800, {  717,    -1,    -1,    -1,    -1}},
+    {0x32C900, {  735,    -1,    -1,    -1,    -1}},
+    {0x32CA00, {  751,    -1,    -1,    -1,    -1}},
+    {0x32CB00, {  765,    -1,    -1,    -1,    -1}},
+    {0x32CC00, {  777,    -1,    -1,    -1,    -1}},
+    {0x32CD00, {  787,    -1,    -1,    -1,    -1}},
+    {0x32CE00, {  796,    -1,    -1,    -1,    -1}},
+    {0x32E000, {  858,    -1,    -1,    -1,    -1}},
+    {0x32E100, {  880,    -1,    -1,    -1,    -1}},
+    {0x32FE00, { 1006,    -1,    -1,    -1,    -1}},
+    {0x32FF00, { 1134,    -1,    -1,    -1,    -1}},
+    {0x32FF03, {   -1,    -1,  6515,    -1,    -1}},
+    {0x330000, {   -1,    -1,    -1,    -1,   102}},
+    {0x330002, {   -1,     6,   586,    -1,    -1}},
+    {0x330004, {   -1,    16,   904,    -1,    -1}},
+    {0x330006, {   -1,    -1,  1113,    -1,    -1}},
+    {0x330007, {   -1,    -1,  7055,    -1,    -1}},
+    {0x330008, {   -1,    -1,  1278,    -1,    -1}},
+    {0x330009, {   -1,    -1,  8483,    -1,    -1}},
+    {0x33000A, {   -1,    -1,  1413,    -1,    -1}},
+    {0x33000C, {   -1,    -1,  1523,    -1,    -1}},
+    {0x33000E, {   -1,    -1,  1603,    -1,    -1}},
+    {0x330010, {   -1,    -1,  1732,    -1,    -1}},
+    {0x330012, {   -1,    -1,  2113,    -1,    -1}},
+    {0x330014, {   -1,    -1,  2302,    -1,    -1}},
+    {0x330016, {   -1,    -1,  2404,    -1,    -1}},
+    {0x3300F2, {   -1,    -1,    -1,   102,    -1}},
+    {0x330100, {   -1,    -1,   102,    -1,    -1}},
+    {0x330101, {   -1,    -1,  4098,    -1,    -1}},
+    {0x330102, {   -1,    -1,   611,    -1,    -1}},
+    {0x330104, {   -1,    -1,   917,    -1,    -1}},
+    {0x330109, {   -1,    -1,  8601,    -1,    -1}},
+    {0x3301F2, {   -1,    -1,    -1,   177,    -1}},
+    {0x3301FE, {   -1,    -1,  3980,    -1,    -1}},
+    {0x330200, {   -1,    -1,   230,    -1,    -1}},
+    {0x330201, {   -1,    -1,  4201,    -1,    -1}},
+    {0x330202, {   -1,    -1,   659,    -1,    -1}},
+    {0x330204, {   -1,    -1,   941,    -1,    -1}},
+    {0x330206, {   -1,    -1,  1139,    -1,    -1}},
+    {0x330208, {   -1,    -1,  1300,    -1,    -1}},
+    {0x330209, {   -1,    -1,  8704,    -1,    -1}},
+    {0x33020A, {   -1,    -1,  1433,    -1,    -1}},
+    {0x33020C, {   -1,    -1,  1537,    -1,    -1}},
+    {0x3302F2, {   -1,    -1,    -1,   214,    -1}},
+    {0x330300, {   -1,    -1,   358,    -1,    -1}},
+    {0x330302, {   -1,    -1,   736,    -1,    -1}},
+    {0x330304, {   -1,    -1,   990,    -1,    -1}},
+    {0x330306, {   -1,    -1,  1174,    -1,    -1}},
+    {0x330308, {   -1,    -1,  1323,    -1,    -1}},
+    {0x33030A, {   -1,    -1,  1449,    -1,    -1}},
+    {0x33030C, {   -1,    -1,  1549,    -1,    -1}},
+    {0x330310, {   -1,    -1,  1933,    -1,    -1}},
+    {0x330312, {   -1,    -1,  2190,    -1,    -1}},
+    {0x330400, {   -1,    -1,   486,    -1,    -1}},
+    {0x330402, {   -1,    -1,   829,    -1,    -1}},
+    {0x330404, {   -1,    -1,  1056,    -1,    -1}},
+    {0x330406, {   -1,    -1,  1227,    -1,    -1}},
+    {0x330408, {   -1,    -1,  1369,    -1,    -1}},
+    {0x33040A, {   -1,    -1,  1489,    -1,    -1}},
+    {0x33040C, {   -1,    -1,  1577,    -1,    -1}},
+    {0x33040E, {   -1,    -1,  1640,    -1,    -1}},
+    {0x330410, {   -1,    -1,  2039,    -1,    -1}},
+    {0x330412, {   -1,    -1,  2252,    -1,    -1}},
+    {0x330414, {   -1,    -1,  2372,    -1,    -1}},
+    {0x330416, {   -1,    -1,  2452,    -1,    -1}},
+    {0x330800, {   30,    -1,    -1,    -1,    -1}},
+    {0x330901, {   -1,    -1,  4346,    -1,    -1}},
+    {0x330907, {   -1,    -1,  7253,    -1,    -1}},
+    {0x330909, {   -1,    -1,  8849,    -1,    -1}},
+    {0x330C01, {   -1,    -1,  4498,    -1,    -1}},
+    {0x330C09, {   -1,    -1,  9001,    -1,    -1}},
+    {0x330E00, {   40,    -1,    -1,    -1,    -1}},
+    {0x331801, {   -1,    -1,  4636,    -1,    -1}},
+    {0x331809, {   -1,    -1,  9139,    -1,    -1}},
+    {0x332001, {   -1,    -1,  4998,    -1,    -1}},
+    {0x332007, {   -1,    -1,  7754,    -1,    -1}},
+    {0x332009, {   -1,    -1,  9501,    -1,    -1}},
+    {0x332101, {   -1,    -1,  5058,    -1,    -1}},
+    {0x332109, {   -1,    -1,  9561,    -1,    -1}},
+    {0x332801, {   -1,    -1,  5164,    -1,    -1}},
+    {0x332809, {   -1,    -1,  9667,    -1,    -1}},
+    {0x332A01, {   -1,    -1,  5254,    -1,    -1}},
+    {0x332A09, {   -1,    -1,  9757,    -1,    -1}},
+    {0x333001, {   -1,    -1,  5363,    -1,    -1}},
+    {0x333007, {   -1,    -1,  7899,    -1,    -1}},
+    {0x333009, {   -1,    -1,  9866,    -1,    -1}},
+    {0x333201, {   -1,    -1,  5527,    -1,    -1}},
+    {0x333207, {   -1,    -1,  8063,    -1,    -1}},
+    {0x333209, {   -1,    -1, 10030,    -1,    -1}},
+    {0x333301, {   -1,    -1,  5614,    -1,    -1}},
+    {0x333309, {   -1,    -1, 10117,    -1,    -1}},
+    {0x333B01, {   -1,    -1,  6078,    -1,    -1}},
+    {0x333B09, {   -1,    -1, 10581,    -1,    -1}},
+    {0x334000, {  360,    -1,    -1,    -1,    -1}},
+    {0x334100, {  447,    -1,    -1,    -1,    -1}},
+    {0x334200, {  518,    -1,    -1,    -1,    -1}},
+    {0x334300, {  575,    -1,    -1,    -1,    -1}},
+    {0x334400, {  613,    -1,    -1,    -1,    -1}},
+    {0x334500, {  644,    -1,    -1,    -1,    -1}},
+    {0x334600, {  673,    -1,    -1,    -1,    -1}},
+    {0x337E00, { 1007,    -1,    -1,    -1,    -1}},
+    {0x337F00, { 1135,    -1,    -1,    -1,    -1}},
+    {0x337F03, {   -1,    -1,  6516,    -1,    -1}},
+    {0x338000, {   -1,    -1,    -1,    -1,   103}},
+    {0x338002, {   -1,    -1,   587,    -1,    -1}},
+    {0x338004, {   -1,    -1,   905,    -1,    -1}},
+    {0x338006, {   -1,    -1,  1114,    -1,    -1}},
+    {0x338007, {   -1,    -1,  7056,    -1,    -1}},
+    {0x338008, {   -1,    -1,  1279,    -1,    -1}},
+    {0x338009, {   -1,    -1,  8484,    -1,    -1}},
+    {0x33800A, {   -1,    -1,  1414,    -1,    -1}},
+    {0x33800C, {   -1,    -1,  1524,    -1,    -1}},
+    {0x338010, {   -1,    -1,  1733,    -1,    -1}},
+    {0x338012, {   -1,    -1,  2114,    -1,    -1}},
+    {0x338014, {   -1,    -1,  2303,    -1,    -1}},
+    {0x338016, {   -1,    -1,  2405,    -1,    -1}},
+    {0x338020, {   -1,    -1,  2662,    -1,    -1}},
+    {0x338022, {   -1,    -1,  2877,    -1,    -1}},
+    {0x338024, {   -1,    -1,  2979,    -1,    -1}},
+    {0x338026, {   -1,    -1,  3043,    -1,    -1}},
+    {0x3380F2, {   -1,    -1,    -1,   103,    -1}},
+    {0x338100, {   -1,    -1,   103,    -1,    -1}},
+    {0x338101, {   -1,    -1,  4099,    -1,    -1}},
+    {0x338109, {   -1,    -1,  8602,    -1,    -1}},
+    {0x3381FE, {   -1,    -1,  3981,    -1,    -1}},
+    {0x338200, {   -1,    -1,   231,    -1,    -1}},
+    {0x338201, {   -1,    -1,  4202,    -1,    -1}},
+    {0x338202, {   -1,    -1,   660,    -1,    -1}},
+    {0x338209, {   -1,    -1,  8705,    -1,    -1}},
+    {0x338300, {   -1,    -1,   359,    -1,    -1}},
+    {0x338302, {   -1,    -1,   737,    -1,    -1}},
+    {0x338310, {   -1,    -1,  1934,    -1,    -1}},
+    {0x338312, {   -1,    -1,  2191,    -1,    -1}},
+    {0x338320, {   -1,    -1,  2766,    -1,    -1}},
+    {0x338322, {   -1,    -1,  2915,    -1,    -1}},
+    {0x338324, {   -1,    -1,  3002,    -1,    -1}},
+    {0x338400, {   -1,    -1,   487,    -1,    -1}},
+    {0x338402, {   -1,    -1,   830,    -1,    -1}},
+    {0x338404, {   -1,    -1,  1057,    -1,    -1}},
+    {0x338406, {   -1,    -1,  1228,    -1,    -1}},
+    {0x338408, {   -1,    -1,  1370,    -1,    -1}},
+    {0x33840A, {   -1,    -1,  1490,    -1,    -1}},
+    {0x33840C, {   -1,    -1,  1578,    -1,    -1}},
+    {0x338410, {   -1,    -1,  2040,    -1,    -1}},
+    {0x338412, {   -1,    -1,  2253,    -1,    -1}},
+    {0x338414, {   -1,    -1,  2373,    -1,    -1}},
+    {0x338416, {   -1,    -1,  2453,    -1,    -1}},
+    {0x338420, {   -1,    -1,  2831,    -1,    -1}},
+    {0x338422, {   -1,    -1,  2952,    -1,    -1}},
+    {0x338424, {   -1,    -1,  3023,    -1,    -1}},
+    {0x338426, {   -1,    -1,  3074,    -1,    -1}},
+    {0x338901, {   -1,    -1,  4347,    -1,    -1}},
+    {0x338907, {   -1,    -1,  7254,    -1,    -1}},
+    {0x338909, {   -1,    -1,  8850,    -1,    -1}},
+    {0x338C01, {   -1,    -1,  4499,    -1,    -1}},
+    {0x338C09, {   -1,    -1,  9002,    -1,    -1}},
+    {0x339801, {   -1,    -1,  4637,    -1,    -1}},
+    {0x339809, {   -1,    -1,  9140,    -1,    -1}},
+    {0x33A001, {   -1,    -1,  4999,    -1,    -1}},
+    {0x33A007, {   -1,    -1,  7755,    -1,    -1}},
+    {0x33A009, {   -1,    -1,  9502,    -1,    -1}},
+    {0x33A101, {   -1,    -1,  5059,    -1,    -1}},
+    {0x33A109, {   -1,    -1,  9562,    -1,    -1}},
+    {0x33A801, {   -1,    -1,  5165,    -1,    -1}},
+    {0x33A809, {   -1,    -1,  9668,    -1,    -1}},
+    {0x33AA01, {   -1,    -1,  5255,    -1,    -1}},
+    {0x33AA09, {   -1,    -1,  9758,    -1,    -1}},
+    {0x33B001, {   -1,    -1,  5364,    -1,    -1}},
+    {0x33B007, {   -1,    -1,  7900,    -1,    -1}},
+    {0x33B009, {   -1,    -1,  9867,    -1,    -1}},
+    {0x33B201, {   -1,    -1,  5528,    -1,    -1}},
+    {0x33B207, {   -1,    -1,  8064,    -1,    -1}},
+    {0x33B209, {   -1,    -1, 10031,    -1,    -1}},
+    {0x33B301, {   -1,    -1,  5615,    -1,    -1}},
+    {0x33B309, {   -1,    -1, 10118,    -1,    -1}},
+    {0x33BB01, {   -1,    -1,  6079,    -1,    -1}},
+    {0x33BB09, {   -1,    -1, 10582,    -1,    -1}},
+    {0x33C000, {  361,    -1,    -1,    -1,    -1}},
+    {0x33C100, {  448,    -1,    -1,    -1,    -1}},
+    {0x33FE00, { 1008,    -1,    -1,    -1,    -1}},
+    {0x33FF00, { 1136,    -1,    -1,    -1,    -1}},
+    {0x33FF03, {   -1,    -1,  6517,    -1,    -1}},
+    {0x340000, {   -1,    -1,    -1,    -1,   104}},
+    {0x340002, {   -1,     7,   588,    -1,    -1}},
+    {0x340004, {   -1,    -1,   906,    -1,    -1}},
+    {0x340006, {   -1,    -1,  1115,    -1,    -1}},
+    {0x340007, {   -1,    -1,  7057,    -1,    -1}},
+    {0x340008, {   -1,    -1,  1280,    -1,    -1}},
+    {0x340009, {   -1,    -1,  8485,    -1,    -1}},
+    {0x34000A, {   -1,    -1,  1415,    -1,    -1}},
+    {0x340010, {   -1,    -1,  1734,    -1,    -1}},
+    {0x340020, {   -1,    -1,  2663,    -1,    -1}},
+    {0x3400F2, {   -1,    -1,    -1,   104,    -1}},
+    {0x340100, {   -1,    -1,   104,    -1,    -1}},
+    {0x340101, {   -1,    -1,  4100,    -1,    -1}},
+    {0x340102, {   -1,    -1,   612,    -1,    -1}},
+    {0x340109, {   -1,    -1,  8603,    -1,    -1}},
+    {0x3401F2, {   -1,    -1,    -1,   178,    -1}},
+    {0x3401FE, {   -1,    -1,  3982,    -1,    -1}},
+    {0x340200, {   -1,    -1,   232,    -1,    -1}},
+    {0x340201, {   -1,    -1,  4203,    -1,    -1}},
+    {0x340202, {   -1,    -1,   661,    -1,    -1}},
+    {0x340204, {   -1,    -1,   942,    -1,    -1}},
+    {0x340209, {   -1,    -1,  8706,    -1,    -1}},
+    {0x340210, {   -1,    -1,  1843,    -1,    -1}},
+    {0x340220, {   -1,    -1,  2713,    -1,    -1}},
+    {0x340300, {   -1,    -1,   360,    -1,    -1}},
+    {0x340302, {   -1,    -1,   738,    -1,    -1}},
+    {0x340304, {   -1,    -1,   991,    -1,    -1}},
+    {0x340306, {   -1,    -1,  1175,    -1,    -1}},
+    {0x340310, {   -1,    -1,  1935,    -1,    -1}},
+    {0x340320, {   -1,    -1,  2767,    -1,    -1}},
+    {0x340400, {   -1,    -1,   488,    -1,    -1}},
+    {0x340402, {   -1,    -1,   831,    -1,    -1}},
+    {0x340404, {   -1,    -1,  1058,    -1,    -1}},
+    {0x340406, {   -1,    -1,  1229,    -1,    -1}},
+    {0x340408, {   -1,    -1,  1371,    -1,    -1}},
+    {0x34040A, {   -1,    -1,  1491,    -1,    -1}},
+    {0x340410, {   -1,    -1,  2041,    -1,    -1}},
+    {0x340420, {   -1,    -1,  2832,    -1,    -1}},
+    {0x340901, {   -1,    -1,  4348,    -1,    -1}},
+    {0x340907, {   -1,    -1,  7255,    -1,    -1}},
+    {0x340909, {   -1,    -1,  8851,    -1,    -1}},
+    {0x340C01, {   -1,    -1,  4500,    -1,    -1}},
+    {0x340C09, {   -1,    -1,  9003,    -1,    -1}},
+    {0x341801, {   -1,    -1,  4638,    -1,    -1}},
+    {0x341809, {   -1,    -1,  9141,    -1,    -1}},
+    {0x342000, {  131,    -1,    -1,    -1,    -1}},
+    {0x342001, {   -1,    -1,  5000,    -1,    -1}},
+    {0x342007, {   -1,    -1,  7756,    -1,    -1}},
+    {0x342009, {   -1,    -1,  9503,    -1,    -1}},
+    {0x342101, {   -1,    -1,  5060,    -1,    -1}},
+    {0x342109, {   -1,    -1,  9563,    -1,    -1}},
+    {0x342300, {  157,    -1,    -1,    -1,    -1}},
+    {0x342800, {  219,    -1,    -1,    -1,    -1}},
+    {0x342801, {   -1,    -1,  5166,    -1,    -1}},
+    {0x342809, {   -1,    -1,  9669,    -1,    -1}},
+    {0x342A01, {   -1,    -1,  5256,    -1,    -1}},
+    {0x342A09, {   -1,    -1,  9759,    -1,    -1}},
+    {0x343001, {   -1,    -1,  5365,    -1,    -1}},
+    {0x343007, {   -1,    -1,  7901,    -1,    -1}},
+    {0x343009, {   -1,    -1,  9868,    -1,    -1}},
+    {0x343201, {   -1,    -1,  5529,    -1,    -1}},
+    {0x343207, {   -1,    -1,  8065,    -1,    -1}},
+    {0x343209, {   -1,    -1, 10032,    -1,    -1}},
+    {0x343301, {   -1,    -1,  5616,    -1,    -1}},
+    {0x343309, {   -1,    -1, 10119,    -1,    -1}},
+    {0x343B01, {   -1,    -1,  6080,    -1,    -1}},
+    {0x343B09, {   -1,    -1, 10583,    -1,    -1}},
+    {0x344000, {  362,    -1,    -1,    -1,    -1}},
+    {0x346000, {  859,    -1,    -1,    -1,    -1}},
+    {0x346100, {  881,    -1,    -1,    -1,    -1}},
+    {0x347E00, { 1009,    -1,    -1,    -1,    -1}},
+    {0x347F00, { 1137,    -1,    -1,    -1,    -1}},
+    {0x347F03, {   -1,    -1,  6518,    -1,    -1}},
+    {0x348000, {   -1,    -1,    -1,    -1,   105}},
+    {0x348002, {   -1,    -1,   589,    -1,    -1}},
+    {0x348007, {   -1,    -1,  7058,    -1,    -1}},
+    {0x348009, {   -1,    -1,  8486,    -1,    -1}},
+    {0x348010, {   -1,    -1,  1735,    -1,    -1}},
+    {0x348012, {   -1,    -1,  2115,    -1,    -1}},
+    {0x348020, {   -1,    -1,  2664,    -1,    -1}},
+    {0x348030, {   -1,    -1,  3227,    -1,    -1}},
+    {0x348038, {   -1,    -1,  3467,    -1,    -1}},
+    {0x348040, {   -1,    -1,  3548,    -1,    -1}},
+    {0x3480F2, {   -1,    -1,    -1,   105,    -1}},
+    {0x348100, {   -1,    -1,   105,    -1,    -1}},
+    {0x348101, {   -1,    -1,  4101,    -1,    -1}},
+    {0x348109, {   -1,    -1,  8604,    -1,    -1}},
+    {0x3481FE, {   -1,    -1,  3983,    -1,    -1}},
+    {0x348200, {   -1,    -1,   233,    -1,    -1}},
+    {0x348201, {   -1,    -1,  4204,    -1,    -1}},
+    {0x348202, {   -1,    -1,   662,    -1,    -1}},
+    {0x348209, {   -1,    -1,  8707,    -1,    -1}},
+    {0x348210, {   -1,    -1,  1844,    -1,    -1}},
+    {0x348220, {   -1,    -1,  2714,    -1,    -1}},
+    {0x348230, {   -1,    -1,  3251,    -1,    -1}},
+    {0x348300, {   -1,    -1,   361,    -1,    -1}},
+    {0x348302, {   -1,    -1,   739,    -1,    -1}},
+    {0x348310, {   -1,    -1,  1936,    -1,    -1}},
+    {0x348312, {   -1,    -1,  2192,    -1,    -1}},
+    {0x348320, {   -1,    -1,  2768,    -1,    -1}},
+    {0x348330, {   -1,    -1,  3279,    -1,    -1}},
+    {0x348338, {   -1,    -1,  3474,    -1,    -1}},
+    {0x348340, {   -1,    -1,  3576,    -1,    -1}},
+    {0x348400, {   -1,    -1,   489,    -1,    -1}},
+    {0x348402, {   -1,    -1,   832,    -1,    -1}},
+    {0x348410, {   -1,    -1,  2042,    -1,    -1}},
+    {0x348412, {   -1,    -1,  2254,    -1,    -1}},
+    {0x348420, {   -1,    -1,  2833,    -1,    -1}},
+    {0x348430, {   -1,    -1,  3317,    -1,    -1}},
+    {0x348438, {   -1,    -1,  3480,    -1,    -1}},
+    {0x348440, {   -1,    -1,  3597,    -1,    -1}},
+    {0x348901, {   -1,    -1,  4349,    -1,    -1}},
+    {0x348907, {   -1,    -1,  7256,    -1,    -1}},
+    {0x348909, {   -1,    -1,  8852,    -1,    -1}},
+    {0x348C01, {   -1,    -1,  4501,    -1,    -1}},
+    {0x348C09, {   -1,    -1,  9004,    -1,    -1}},
+    {0x349801, {   -1,    -1,  4639,    -1,    -1}},
+    {0x349809, {   -1,    -1,  9142,    -1,    -1}},
+    {0x349C00, {  103,    -1,    -1,    -1,    -1}},
+    {0x34A001, {   -1,    -1,  5001,    -1,    -1}},
+    {0x34A007, {   -1,    -1,  7757,    -1,    -1}},
+    {0x34A009, {   -1,    -1,  9504,    -1,    -1}},
+    {0x34A101, {   -1,    -1,  5061,    -1,    -1}},
+    {0x34A109, {   -1,    -1,  9564,    -1,    -1}},
+    {0x34A801, {   -1,    -1,  5167,    -1,    -1}},
+    {0x34A809, {   -1,    -1,  9670,    -1,    -1}},
+    {0x34AA01, {   -1,    -1,  5257,    -1,    -1}},
+    {0x34AA09, {   -1,    -1,  9760,    -1,    -1}},
+    {0x34B001, {   -1,    -1,  5366,    -1,    -1}},
+    {0x34B007, {   -1,    -1,  7902,    -1,    -1}},
+    {0x34B009, {   -1,    -1,  9869,    -1,    -1}},
+    {0x34B201, {   -1,    -1,  5530,    -1,    -1}},
+    {0x34B207, {   -1,    -1,  8066,    -1,    -1}},
+    {0x34B209, {   -1,    -1, 10033,    -1,    -1}},
+    {0x34B301, {   -1,    -1,  5617,    -1,    -1}},
+    {0x34B309, {   -1,    -1, 10120,    -1,    -1}},
+    {0x34BB01, {   -1,    -1,  6081,    -1,    -1}},
+    {0x34BB09, {   -1,    -1, 10584,    -1,    -1}},
+    {0x34C000, {  363,    -1,    -1,    -1,    -1}},
+    {0x34E000, {  860,    -1,    -1,    -1,    -1}},
+    {0x34E100, {  882,    -1,    -1,    -1,    -1}},
+    {0x34E200, {  891,    -1,    -1,    -1,    -1}},
+    {0x34E300, {  898,    -1,    -1,    -1,    -1}},
+    {0x34FE00, { 1010,    -1,    -1,    -1,    -1}},
+    {0x34FF00, { 1138,    -1,    -1,    -1,    -1}},
+    {0x34FF03, {   -1,    -1,  6519,    -1,    -1}},
+    {0x350000, {   -1,    -1,    -1,    -1,   106}},
+    {0x350002, {   -1,    -1,   590,    -1,    -1}},
+    {0x350007, {   -1,    -1,  7059,    -1,    -1}},
+    {0x350009, {   -1,    -1,  8487,    -1,    -1}},
+    {0x350010, {   -1,    -1,  1736,    -1,    -1}},
+    {0x3500F2, {   -1,    -1,    -1,   106,    -1}},
+    {0x350100, {   -1,    -1,   106,    -1,    -1}},
+    {0x350101, {   -1,    -1,  4102,    -1,    -1}},
+    {0x350109, {   -1,    -1,  8605,    -1,    -1}},
+    {0x3501FE, {   -1,    -1,  3984,    -1,    -1}},
+    {0x350200, {   -1,    -1,   234,    -1,    -1}},
+    {0x350201, {   -1,    -1,  4205,    -1,    -1}},
+    {0x350202, {   -1,    -1,   663,    -1,    -1}},
+    {0x350209, {   -1,    -1,  8708,    -1,    -1}},
+    {0x350300, {   -1,    -1,   362,    -1,    -1}},
+    {0x350302, {   -1,    -1,   740,    -1,    -1}},
+    {0x350310, {   -1,    -1,  1937,    -1,    -1}},
+    {0x350400, {   -1,    -1,   490,    -1,    -1}},
+    {0x350402, {   -1,    -1,   833,    -1,    -1}},
+    {0x350410, {   -1,    -1,  2043,    -1,    -1}},
+    {0x350901, {   -1,    -1,  4350,    -1,    -1}},
+    {0x350907, {   -1,    -1,  7257,    -1,    -1}},
+    {0x350909, {   -1,    -1,  8853,    -1,    -1}},
+    {0x350C01, {   -1,    -1,  4502,    -1,    -1}},
+    {0x350C09, {   -1,    -1,  9005,    -1,    -1}},
+    {0x351801, {   -1,    -1,  4640,    -1,    -1}},
+    {0x351809, {   -1,    -1,  9143,    -1,    -1}},
+    {0x352001, {   -1,    -1,  5002,    -1,    -1}},
+    {0x352007, {   -1,    -1,  7758,    -1,    -1}},
+    {0x352009, {   -1,    -1,  9505,    -1,    -1}},
+    {0x352101, {   -1,    -1,  5062,    -1,    -1}},
+    {0x352109, {   -1,    -1,  9565,    -1,    -1}},
+    {0x352801, {   -1,    -1,  5168,    -1,    -1}},
+    {0x352809, {   -1,    -1,  9671,    -1,    -1}},
+    {0x352A01, {   -1,    -1,  5258,    -1,    -1}},
+    {0x352A09, {   -1,    -1,  9761,    -1,    -1}},
+    {0x353001, {   -1,    -1,  5367,    -1,    -1}},
+    {0x353007, {   -1,    -1,  7903,    -1,    -1}},
+    {0x353009, {   -1,    -1,  9870,    -1,    -1}},
+    {0x353201, {   -1,    -1,  5531,    -1,    -1}},
+    {0x353207, {   -1,    -1,  8067,    -1,    -1}},
+    {0x353209, {   -1,    -1, 10034,    -1,    -1}},
+    {0x353301, {   -1,    -1,  5618,    -1,    -1}},
+    {0x353309, {   -1,    -1, 10121,    -1,    -1}},
+    {0x353B01, {   -1,    -1,  6082,    -1,    -1}},
+    {0x353B09, {   -1,    -1, 10585,    -1,    -1}},
+    {0x356000, {  861,    -1,    -1,    -1,    -1}},
+    {0x357E00, { 1011,    -1,    -1,    -1,    -1}},
+    {0x357F00, { 1139,    -1,    -1,    -1,    -1}},
+    {0x357F03, {   -1,    -1,  6520,    -1,    -1}},
+    {0x358000, {   -1,    -1,    -1,    -1,   107}},
+    {0x358002, {   -1,    -1,   591,    -1,    -1}},
+    {0x358007, {   -1,    -1,  7060,    -1,    -1}},
+    {0x358009, {   -1,    -1,  8488,    -1,    -1}},
+    {0x358010, {   -1,    71,  1737,    -1,    -1}},
+    {0x358020, {   -1,    -1,  2665,    -1,    -1}},
+    {0x358026, {   -1,    -1,  3044,    -1,    -1}},
+    {0x358030, {   -1,    -1,  3228,    -1,    -1}},
+    {0x3580F2, {   -1,    -1,    -1,   107,    -1}},
+    {0x358100, {   -1,    -1,   107,    -1,    -1}},
+    {0x358101, {   -1,    -1,  4103,    -1,    -1}},
+    {0x358109, {   -1,    -1,  8606,    -1,    -1}},
+    {0x358110, {   -1,    -1,  1786,    -1,    -1}},
+    {0x3581F2, {   -1,    -1,    -1,   179,    -1}},
+    {0x3581FE, {   -1,    -1,  3985,    -1,    -1}},
+    {0x358200, {   -1,    -1,   235,    -1,    -1}},
+    {0x358201, {   -1,    -1,  4206,    -1,    -1}},
+    {0x358209, {   -1,    -1,  8709,    -1,    -1}},
+    {0x358210, {   -1,    -1,  1845,    -1,    -1}},
+    {0x358220, {   -1,    -1,  2715,    -1,    -1}},
+    {0x358300, {   -1,    -1,   363,    -1,    -1}},
+    {0x358302, {   -1,    -1,   741,    -1,    -1}},
+    {0x358310, {   -1,    -1,  1938,    -1,    -1}},
+    {0x358320, {   -1,    -1,  2769,    -1,    -1}},
+    {0x358326, {   -1,    -1,  3058,    -1,    -1}},
+    {0x358330, {   -1,    -1,  3280,    -1,    -1}},
+    {0x358400, {   -1,    -1,   491,    -1,    -1}},
+    {0x358402, {   -1,    -1,   834,    -1,    -1}},
+    {0x358410, {   -1,    -1,  2044,    -1,    -1}},
+    {0x358420, {   -1,    -1,  2834,    -1,    -1}},
+    {0x358426, {   -1,    -1,  3075,    -1,    -1}},
+    {0x358430, {   -1,    -1,  3318,    -1,    -1}},
+    {0x358901, {   -1,    -1,  4351,    -1,    -1}},
+    {0x358907, {   -1,    -1,  7258,    -1,    -1}},
+    {0x358909, {   -1,    -1,  8854,    -1,    -1}},
+    {0x358C01, {   -1,    -1,  4503,    -1,    -1}},
+    {0x358C09, {   -1,    -1,  9006,    -1,    -1}},
+    {0x359801, {   -1,    -1,  4641,    -1,    -1}},
+    {0x359809, {   -1,    -1,  9144,    -1,    -1}},
+    {0x35A001, {   -1,    -1,  5003,    -1,    -1}},
+    {0x35A007, {   -1,    -1,  7759,    -1,    -1}},
+    {0x35A009, {   -1,    -1,  9506,    -1,    -1}},
+    {0x35A101, {   -1,    -1,  5063,    -1,    -1}},
+    {0x35A109, {   -1,    -1,  9566,    -1,    -1}},
+    {0x35A801, {   -1,    -1,  5169,    -1,    -1}},
+    {0x35A809, {   -1,    -1,  9672,    -1,    -1}},
+    {0x35AA01, {   -1,    -1,  5259,    -1,    -1}},
+    {0x35AA09, {   -1,    -1,  9762,    -1,    -1}},
+    {0x35B001, {   -1,    -1,  5368,    -1,    -1}},
+    {0x35B007, {   -1,    -1,  7904,    -1,    -1}},
+    {0x35B009, {   -1,    -1,  9871,    -1,    -1}},
+    {0x35B201, {   -1,    -1,  5532,    -1,    -1}},
+    {0x35B207, {   -1,    -1,  8068,    -1,    -1}},
+    {0x35B209, {   -1,    -1, 10035,    -1,    -1}},
+    {0x35B301, {   -1,    -1,  5619,    -1,    -1}},
+    {0x35B309, {   -1,    -1, 10122,    -1,    -1}},
+    {0x35BB01, {   -1,    -1,  6083,    -1,    -1}},
+    {0x35BB09, {   -1,    -1, 10586,    -1,    -1}},
+    {0x35C000, {  364,    -1,    -1,    -1,    -1}},
+    {0x35E000, {  862,    -1,    -1,    -1,    -1}},
+    {0x35E100, {  883,    -1,    -1,    -1,    -1}},
+    {0x35E200, {  892,    -1,    -1,    -1,    -1}},
+    {0x35FE00, { 1012,    -1,    -1,    -1,    -1}},
+    {0x35FF00, { 1140,    -1,    -1,    -1,    -1}},
+    {0x35FF03, {   -1,    -1,  6521,    -1,    -1}},
+    {0x360000, {   -1,    -1,    -1,    -1,   108}},
+    {0x360007, {   -1,    -1,  7061,    -1,    -1}},
+    {0x360009, {   -1,    -1,  8489,    -1,    -1}},
+    {0x360010, {   -1,    -1,  1738,    -1,    -1}},
+    {0x360012, {   -1,    -1,  2116,    -1,    -1}},
+    {0x360014, {   -1,    -1,  2304,    -1,    -1}},
+    {0x3600F2, {   -1,    -1,    -1,   108,    -1}},
+    {0x360100, {   -1,    -1,   108,    -1,    -1}},
+    {0x360101, {   -1,    -1,  4104,    -1,    -1}},
+    {0x360109, {   -1,    -1,  8607,    -1,    -1}},
+    {0x3601FE, {   -1,    -1,  3986,    -1,    -1}},
+    {0x360200, {   -1,    -1,   236,    -1,    -1}},
+    {0x360201, {   -1,    -1,  4207,    -1,    -1}},
+    {0x360209, {   -1,    -1,  8710,    -1,    -1}},
+    {0x360300, {   -1,    -1,   364,    -1,    -1}},
+    {0x360310, {   -1,    -1,  1939,    -1,    -1}},
+    {0x360400, {   -1,    -1,   492,    -1,    -1}},
+    {0x360410, {   -1,    -1,  2045,    -1,    -1}},
+    {0x360412, {   -1,    -1,  2255,    -1,    -1}},
+    {0x360414, {   -1,    -1,  2374,    -1,    -1}},
+    {0x360901, {   -1,    -1,  4352,    -1,    -1}},
+    {0x360907, {   -1,    -1,  7259,    -1,    -1}},
+    {0x360909, {   -1,    -1,  8855,    -1,    -1}},
+    {0x360C01, {   -1,    -1,  4504,    -1,    -1}},
+    {0x360C09, {   -1,    -1,  9007,    -1,    -1}},
+    {0x361801, {   -1,    -1,  4642,    -1,    -1}},
+    {0x361809, {   -1,    -1,  9145,    -1,    -1}},
+    {0x362001, {   -1,    -1,  5004,    -1,    -1}},
+    {0x362007, {   -1,    -1,  7760,    -1,    -1}},
+    {0x362009, {   -1,    -1,  9507,    -1,    -1}},
+    {0x362101, {   -1,    -1,  5064,    -1,    -1}},
+    {0x362109, {   -1,    -1,  9567,    -1,    -1}},
+    {0x362801, {   -1,    -1,  5170,    -1,    -1}},
+    {0x362809, {   -1,    -1,  9673,    -1,    -1}},
+    {0x362A01, {   -1,    -1,  5260,    -1,    -1}},
+    {0x362A09, {   -1,    -1,  9763,    -1,    -1}},
+    {0x363001, {   -1,    -1,  5369,    -1,    -1}},
+    {0x363007, {   -1,    -1,  7905,    -1,    -1}},
+    {0x363009, {   -1,    -1,  9872,    -1,    -1}},
+    {0x363201, {   -1,    -1,  5533,    -1,    -1}},
+    {0x363207, {   -1,    -1,  8069,    -1,    -1}},
+    {0x363209, {   -1,    -1, 10036,    -1,    -1}},
+    {0x363301, {   -1,    -1,  5620,    -1,    -1}},
+    {0x363309, {   -1,    -1, 10123,    -1,    -1}},
+    {0x363B01, {   -1,    -1,  6084,    -1,    -1}},
+    {0x363B09, {   -1,    -1, 10587,    -1,    -1}},
+    {0x364000, {  365,    -1,    -1,    -1,    -1}},
+    {0x367E00, { 1013,    -1,    -1,    -1,    -1}},
+    {0x367F00, { 1141,    -1,    -1,    -1,    -1}},
+    {0x367F03, {   -1,    -1,  6522,    -1,    -1}},
+    {0x368000, {   -1,    -1,    -1,    -1,   109}},
+    {0x368007, {   -1,    -1,  7062,    -1,    -1}},
+    {0x368009, {   -1,    -1,  8490,    -1,    -1}},
+    {0x368010, {   -1,    -1,  1739,    -1,    -1}},
+    {0x368012, {   -1,    -1,  2117,    -1,    -1}},
+    {0x368014, {   -1,    -1,  2305,    -1,    -1}},
+    {0x368016, {   -1,    -1,  2406,    -1,    -1}},
+    {0x3680F2, {   -1,    -1,    -1,   109,    -1}},
+    {0x368100, {   -1,    -1,   109,    -1,    -1}},
+    {0x368101, {   -1,    -1,  4105,    -1,    -1}},
+    {0x368109, {   -1,    -1,  8608,    -1,    -1}},
+    {0x3681FE, {   -1,    -1,  3987,    -1,    -1}},
+    {0x368200, {   -1,    -1,   237,    -1,    -1}},
+    {0x368201, {   -1,    -1,  4208,    -1,    -1}},
+    {0x368209, {   -1,    -1,  8711,    -1,    -1}},
+    {0x368300, {   -1,    -1,   365,    -1,    -1}},
+    {0x368310, {   -1,    -1,  1940,    -1,    -1}},
+    {0x368400, {   -1,    -1,   493,    -1,    -1}},
+    {0x368410, {   -1,    -1,  2046,    -1,    -1}},
+    {0x368412, {   -1,    -1,  2256,    -1,    -1}},
+    {0x368414, {   -1,    -1,  2375,    -1,    -1}},
+    {0x368416, {   -1,    -1,  2454,    -1,    -1}},
+    {0x368901, {   -1,    -1,  4353,    -1,    -1}},
+    {0x368907, {   -1,    -1,  7260,    -1,    -1}},
+    {0x368909, {   -1,    -1,  8856,    -1,    -1}},
+    {0x368C01, {   -1,    -1,  4505,    -1,    -1}},
+    {0x368C09, {   -1,    -1,  9008,    -1,    -1}},
+    {0x369801, {   -1,    -1,  4643,    -1,    -1}},
+    {0x369809, {   -1,    -1,  9146,    -1,    -1}},
+    {0x36A001, {   -1,    -1,  5005,    -1,    -1}},
+    {0x36A007, {   -1,    -1,  7761,    -1,    -1}},
+    {0x36A009, {   -1,    -1,  9508,    -1,    -1}},
+    {0x36A101, {   -1,    -1,  5065,    -1,    -1}},
+    {0x36A109, {   -1,    -1,  9568,    -1,    -1}},
+    {0x36A801, {   -1,    -1,  5171,    -1,    -1}},
+    {0x36A809, {   -1,    -1,  9674,    -1,    -1}},
+    {0x36AA01, {   -1,    -1,  5261,    -1,    -1}},
+    {0x36AA09, {   -1,    -1,  9764,    -1,    -1}},
+    {0x36B001, {   -1,    -1,  5370,    -1,    -1}},
+    {0x36B007, {   -1,    -1,  7906,    -1,    -1}},
+    {0x36B009, {   -1,    -1,  9873,    -1,    -1}},
+    {0x36B201, {   -1,    -1,  5534,    -1,    -1}},
+    {0x36B207, {   -1,    -1,  8070,    -1,    -1}},
+    {0x36B209, {   -1,    -1, 10037,    -1,    -1}},
+    {0x36B301, {   -1,    -1,  5621,    -1,    -1}},
+    {0x36B309, {   -1,    -1, 10124,    -1,    -1}},
+    {0x36BB01, {   -1,    -1,  6085,    -1,    -1}},
+    {0x36BB09, {   -1,    -1, 10588,    -1,    -1}},
+    {0x36C000, {  366,    -1,    -1,    -1,    -1}},
+    {0x36E000, {  863,    -1,    -1,    -1,    -1}},
+    {0x36FE00, { 1014,    -1,    -1,    -1,    -1}},
+    {0x36FF00, { 1142,    -1,    -1,    -1,    -1}},
+    {0x370000, {   -1,    -1,    -1,    -1,   110}},
+    {0x370007, {   -1,    -1,  7063,    -1,    -1}},
+    {0x370009, {   -1,    -1,  8491,    -1,    -1}},
+    {0x370010, {   -1,    -1,  1740,    -1,    -1}},
+    {0x370012, {   -1,    -1,  2118,    -1,    -1}},
+    {0x3700F2, {   -1,    -1,    -1,   110,    -1}},
+    {0x370100, {   -1,    -1,   110,    -1,    -1}},
+    {0x370101, {   -1,    -1,  4106,    -1,    -1}},
+    {0x370109, {   -1,    -1,  8609,    -1,    -1}},
+    {0x3701FE, {   -1,    -1,  3988,    -1,    -1}},
+    {0x370200, {   -1,    -1,   238,    -1,    -1}},
+    {0x370201, {   -1,    -1,  4209,    -1,    -1}},
+    {0x370209, {   -1,    -1,  8712,    -1,    -1}},
+    {0x370300, {   -1,    -1,   366,    -1,    -1}},
+    {0x370310, {   -1,    -1,  1941,    -1,    -1}},
+    {0x370312, {   -1,    -1,  2193,    -1,    -1}},
+    {0x370400, {   -1,    -1,   494,    -1,    -1}},
+    {0x370410, {   -1,    -1,  2047,    -1,    -1}},
+    {0x370412, {   -1,    -1,  2257,    -1,    -1}},
+    {0x370901, {   -1,    -1,  4354,    -1,    -1}},
+    {0x370907, {   -1,    -1,  7261,    -1,    -1}},
+    {0x370909, {   -1,    -1,  8857,    -1,    -1}},
+    {0x370C01, {   -1,    -1,  4506,    -1,    -1}},
+    {0x370C09, {   -1,    -1,  9009,    -1,    -1}},
+    {0x371801, {   -1,    -1,  4644,    -1,    -1}},
+    {0x371809, {   -1,    -1,  9147,    -1,    -1}},
+    {0x372001, {   -1,    -1,  5006,    -1,    -1}},
+    {0x372007, {   -1,    -1,  7762,    -1,    -1}},
+    {0x372009, {   -1,    -1,  9509,    -1,    -1}},
+    {0x372101, {   -1,    -1,  5066,    -1,    -1}},
+    {0x372109, {   -1,    -1,  9569,    -1,    -1}},
+    {0x372801, {   -1,    -1,  5172,    -1,    -1}},
+    {0x372809, {   -1,    -1,  9675,    -1,    -1}},
+    {0x372A01, {   -1,    -1,  5262,    -1,    -1}},
+    {0x372A09, {   -1,    -1,  9765,    -1,    -1}},
+    {0x373001, {   -1,    -1,  5371,    -1,    -1}},
+    {0x373007, {   -1,    -1,  7907,    -1,    -1}},
+    {0x373009, {   -1,    -1,  9874,    -1,    -1}},
+    {0x373201, {   -1,    -1,  5535,    -1,    -1}},
+    {0x373207, {   -1,    -1,  8071,    -1,    -1}},
+    {0x373209, {   -1,    -1, 10038,    -1,    -1}},
+    {0x373301, {   -1,    -1,  5622,    -1,    -1}},
+    {0x373309, {   -1,    -1, 10125,    -1,    -1}},
+    {0x373B01, {   -1,    -1,  6086,    -1,    -1}},
+    {0x373B09, {   -1,    -1, 10589,    -1,    -1}},
+    {0x376000, {  864,    -1,    -1,    -1,    -1}},
+    {0x376100, {  884,    -1,    -1,    -1,    -1}},
+    {0x376200, {  893,    -1,    -1,    -1,    -1}},
+    {0x377E00, { 1015,    -1,    -1,    -1,    -1}},
+    {0x377F00, { 1143,    -1,    -1,    -1,    -1}},
+    {0x378000, {   -1,    -1,    -1,    -1,   111}},
+    {0x378002, {   -1,    -1,   592,    -1,    -1}},
+    {0x378007, {   -1,    -1,  7064,    -1,    -1}},
+    {0x378009, {   -1,    -1,  8492,    -1,    -1}},
+    {0x378010, {   -1,    -1,  1741,    -1,    -1}},
+    {0x378020, {   -1,    -1,  2666,    -1,    -1}},
+    {0x378030, {   -1,    -1,  3229,    -1,    -1}},
+    {0x378040, {   -1,    -1,  3549,    -1,    -1}},
+    {0x378042, {   -1,    -1,  3617,    -1,    -1}},
+    {0x3780F2, {   -1,    -1,    -1,   111,    -1}},
+    {0x378100, {   -1,    -1,   111,    -1,    -1}},
+    {0x378101, {   -1,    -1,  4107,    -1,    -1}},
+    {0x378109, {   -1,    -1,  8610,    -1,    -1}},
+    {0x3781FE, {   -1,    -1,  3989,    -1,    -1}},
+    {0x378200, {   -1,    -1,   239,    -1,    -1}},
+    {0x378201, {   -1,    -1,  4210,    -1,    -1}},
+    {0x378202, {   -1,    -1,   664,    -1,    -1}},
+    {0x378209, {   -1,    -1,  8713,    -1,    -1}},
+    {0x378210, {   -1,    -1,  1846,    -1,    -1}},
+    {0x378220, {   -1,    -1,  2716,    -1,    -1}},
+    {0x378300, {   -1,    -1,   367,    -1,    -1}},
+    {0x378302, {   -1,    -1,   742,    -1,    -1}},
+    {0x378310, {   -1,    -1,  1942,    -1,    -1}},
+    {0x378320, {   -1,    -1,  2770,    -1,    -1}},
+    {0x378330, {   -1,    -1,  3281,    -1,    -1}},
+    {0x378340, {   -1,    -1,  3577,    -1,    -1}},
+    {0x378342, {   -1,    -1,  3625,    -1,    -1}},
+    {0x378400, {   -1,    -1,   495,    -1,    -1}},
+    {0x378402, {   -1,    -1,   835,    -1,    -1}},
+    {0x378410, {   -1,    -1,  2048,    -1,    -1}},
+    {0x378420, {   -1,    -1,  2835,    -1,    -1}},
+    {0x378430, {   -1,    -1,  3319,    -1,    -1}},
+    {0x378440, {   -1,    -1,  3598,    -1,    -1}},
+    {0x378442, {   -1,    -1,  3639,    -1,    -1}},
+    {0x378901, {   -1,    -1,  4355,    -1,    -1}},
+    {0x378907, {   -1,    -1,  7262,    -1,    -1}},
+    {0x378909, {   -1,    -1,  8858,    -1,    -1}},
+    {0x378C01, {   -1,    -1,  4507,    -1,    -1}},
+    {0x378C09, {   -1,    -1,  9010,    -1,    -1}},
+    {0x379801, {   -1,    -1,  4645,    -1,    -1}},
+    {0x379809, {   -1,    -1,  9148,    -1,    -1}},
+    {0x37A001, {   -1,    -1,  5007,    -1,    -1}},
+    {0x37A007, {   -1,    -1,  7763,    -1,    -1}},
+    {0x37A009, {   -1,    -1,  9510,    -1,    -1}},
+    {0x37A101, {   -1,    -1,  5067,    -1,    -1}},
+    {0x37A109, {   -1,    -1,  9570,    -1,    -1}},
+    {0x37A801, {   -1,    -1,  5173,    -1,    -1}},
+    {0x37A809, {   -1,    -1,  9676,    -1,    -1}},
+    {0x37AA01, {   -1,    -1,  5263,    -1,    -1}},
+    {0x37AA09, {   -1,    -1,  9766,    -1,    -1}},
+    {0x37B001, {   -1,    -1,  5372,    -1,    -1}},
+    {0x37B007, {   -1,    -1,  7908,    -1,    -1}},
+    {0x37B009, {   -1,    -1,  9875,    -1,    -1}},
+    {0x37B201, {   -1,    -1,  5536,    -1,    -1}},
+    {0x37B207, {   -1,    -1,  8072,    -1,    -1}},
+    {0x37B209, {   -1,    -1, 10039,    -1,    -1}},
+    {0x37B301, {   -1,    -1,  5623,    -1,    -1}},
+    {0x37B309, {   -1,    -1, 10126,    -1,    -1}},
+    {0x37BB01, {   -1,    -1,  6087,    -1,    -1}},
+    {0x37BB09, {   -1,    -1, 10590,    -1,    -1}},
+    {0x37C000, {  367,    -1,    -1,    -1,    -1}},
+    {0x37E000, {  865,    -1,    -1,    -1,    -1}},
+    {0x37E100, {  885,    -1,    -1,    -1,    -1}},
+    {0x37E200, {  894,    -1,    -1,    -1,    -1}},
+    {0x37FE00, { 1016,    -1,    -1,    -1,    -1}},
+    {0x37FF00, { 1144,    -1,    -1,    -1,    -1}},
+    {0x380000, {   -1,    -1,    -1,    -1,   112}},
+    {0x380007, {   -1,    -1,  7065,    -1,    -1}},
+    {0x380009, {   -1,    -1,  8493,    -1,    -1}},
+    {0x380010, {   -1,    -1,  1742,    -1,    -1}},
+    {0x380012, {   -1,    -1,  2119,    -1,    -1}},
+    {0x380014, {   -1,    -1,  2306,    -1,    -1}},
+    {0x380016, {   -1,    -1,  2407,    -1,    -1}},
+    {0x380018, {   -1,    -1,  2481,    -1,    -1}},
+    {0x38001A, {   -1,    -1,  2532,    -1,    -1}},
+    {0x38001C, {   -1,    -1,  2568,    -1,    -1}},
+    {0x38001E, {   -1,    -1,  2594,    -1,    -1}},
+    {0x380020, {   -1,    -1,  2667,    -1,    -1}},
+    {0x380022, {   -1,    -1,  2878,    -1,    -1}},
+    {0x380024, {   -1,    -1,  2980,    -1,    -1}},
+    {0x380026, {   -1,    -1,  3045,    -1,    -1}},
+    {0x380028, {   -1,    -1,  3091,    -1,    -1}},
+    {0x38002A, {   -1,    -1,  3123,    -1,    -1}},
+    {0x38002C, {   -1,    -1,  3149,    -1,    -1}},
+    {0x38002E, {   -1,    -1,  3176,    -1,    -1}},
+    {0x380030, {   -1,    -1,  3230,    -1,    -1}},
+    {0x380032, {   -1,    -1,  3345,    -1,    -1}},
+    {0x380040, {   -1,    -1,  3550,    -1,    -1}},
+    {0x380050, {   -1,    -1,  3722,    -1,    -1}},
+    {0x380052, {   -1,    -1,  3749,    -1,    -1}},
+    {0x380054, {   -1,    -1,  3766,    -1,    -1}},
+    {0x380080, { 1315,    -1,    -1,    -1,    -1}},
+    {0x3800F2, {   -1,    -1,    -1,   112,    -1}},
+    {0x380100, {   -1,    -1,   112,    -1,    -1}},
+    {0x380101, {   -1,    -1,  4108,    -1,    -1}},
+    {0x380109, {   -1,    -1,  8611,    -1,    -1}},
+    {0x3801FE, {   -1,    -1,  3990,    -1,    -1}},
+    {0x380200, {   -1,    -1,   240,    -1,    -1}},
+    {0x380201, {   -1,    -1,  4211,    -1,    -1}},
+    {0x380209, {   -1,    -1,  8714,    -1,    -1}},
+    {0x380210, {   -1,    -1,  1847,    -1,    -1}},
+    {0x380212, {   -1,    -1,  2146,    -1,    -1}},
+    {0x380214, {   -1,    -1,  2316,    -1,    -1}},
+    {0x380216, {   -1,    -1,  2413,    -1,    -1}},
+    {0x380220, {   -1,    -1,  2717,    -1,    -1}},
+    {0x380300, {   -1,    -1,   368,    -1,    -1}},
+    {0x380310, {   -1,    -1,  1943,    -1,    -1}},
+    {0x380312, {   -1,    -1,  2194,    -1,    -1}},
+    {0x380314, {   -1,    -1,  2333,    -1,    -1}},
+    {0x380316, {   -1,    -1,  2424,    -1,    -1}},
+    {0x380318, {   -1,    -1,  2491,    -1,    -1}},
+    {0x380320, {   -1,    -1,  2771,    -1,    -1}},
+    {0x380400, {   -1,    -1,   496,    -1,    -1}},
+    {0x380410, {   -1,    -1,  2049,    -1,    -1}},
+    {0x380412, {   -1,    -1,  2258,    -1,    -1}},
+    {0x380414, {   -1,    -1,  2376,    -1,    -1}},
+    {0x380416, {   -1,    -1,  2455,    -1,    -1}},
+    {0x380418, {   -1,    -1,  2515,    -1,    -1}},
+    {0x38041A, {   -1,    -1,  2553,    -1,    -1}},
+    {0x38041C, {   -1,    -1,  2583,    -1,    -1}},
+    {0x38041E, {   -1,    -1,  2607,    -1,    -1}},
+    {0x380420, {   -1,    -1,  2836,    -1,    -1}},
+    {0x380422, {   -1,    -1,  2953,    -1,    -1}},
+    {0x380424, {   -1,    -1,  3024,    -1,    -1}},
+    {0x380426, {   -1,    -1,  3076,    -1,    -1}},
+    {0x380428, {   -1,    -1,  3110,    -1,    -1}},
+    {0x38042A, {   -1,    -1,  3137,    -1,    -1}},
+    {0x38042C, {   -1,    -1,  3164,    -1,    -1}},
+    {0x38042E, {   -1,    -1,  3190,    -1,    -1}},
+    {0x380430, {   -1,    -1,  3320,    -1,    -1}},
+    {0x380432, {   -1,    -1,  3384,    -1,    -1}},
+    {0x380440, {   -1,    -1,  3599,    -1,    -1}},
+    {0x380450, {   -1,    -1,  3740,    -1,    -1}},
+    {0x380452, {   -1,    -1,  3758,    -1,    -1}},
+    {0x380454, {   -1,    -1,  3775,    -1,    -1}},
+    {0x380901, {   -1,    -1,  4356,    -1,    -1}},
+    {0x380907, {   -1,    -1,  7263,    -1,    -1}},
+    {0x380909, {   -1,    -1,  8859,    -1,    -1}},
+    {0x380C01, {   -1,    -1,  4508,    -1,    -1}},
+    {0x380C09, {   -1,    -1,  9011,    -1,    -1}},
+    {0x381801, {   -1,    -1,  4646,    -1,    -1}},
+    {0x381809, {   -1,    -1,  9149,    -1,    -1}},
+    {0x382001, {   -1,    -1,  5008,    -1,    -1}},
+    {0x382007, {   -1,    -1,  7764,    -1,    -1}},
+    {0x382009, {   -1,    -1,  9511,    -1,    -1}},
+    {0x382101, {   -1,    -1,  5068,    -1,    -1}},
+    {0x382109, {   -1,    -1,  9571,    -1,    -1}},
+    {0x382801, {   -1,    -1,  5174,    -1,    -1}},
+    {0x382809, {   -1,    -1,  9677,    -1,    -1}},
+    {0x382A01, {   -1,    -1,  5264,    -1,    -1}},
+    {0x382A09, {   -1,    -1,  9767,    -1,    -1}},
+    {0x383001, {   -1,    -1,  5373,    -1,    -1}},
+    {0x383007, {   -1,    -1,  7909,    -1,    -1}},
+    {0x383009, {   -1,    -1,  9876,    -1,    -1}},
+    {0x383B01, {   -1,    -1,  6088,    -1,    -1}},
+    {0x383B09, {   -1,    -1, 10591,    -1,    -1}},
+    {0x384000, {  368,    -1,    -1,    -1,    -1}},
+    {0x386000, {  866,    -1,    -1,    -1,    -1}},
+    {0x386100, {  886,    -1,    -1,    -1,    -1}},
+    {0x386200, {  895,    -1,    -1,    -1,    -1}},
+    {0x386300, {  899,    -1,    -1,    -1,    -1}},
+    {0x386400, {  901,    -1,    -1,    -1,    -1}},
+    {0x386500, {  903,    -1,    -1,    -1,    -1}},
+    {0x387E00, { 1017,    -1,    -1,    -1,    -1}},
+    {0x387F00, { 1145,    -1,    -1,    -1,    -1}},
+    {0x388000, {   -1,    -1,    -1,    -1,   113}},
+    {0x388007, {   -1,    -1,  7066,    -1,    -1}},
+    {0x388009, {   -1,    -1,  8494,    -1,    -1}},
+    {0x388010, {   -1,    -1,  1743,    -1,    -1}},
+    {0x388020, {   -1,    -1,  2668,    -1,    -1}},
+    {0x388080, { 1316,    -1,    -1,    -1,    -1}},
+    {0x3880F2, {   -1,    -1,    -1,   113,    -1}},
+    {0x388100, {   -1,    -1,   113,    -1,    -1}},
+    {0x388101, {   -1,    -1,  4109,    -1,    -1}},
+    {0x388109, {   -1,    -1,  8612,    -1,    -1}},
+    {0x3881FE, {   -1,    -1,  3991,    -1,    -1}},
+    {0x388200, {   -1,    -1,   241,    -1,    -1}},
+    {0x388201, {   -1,    -1,  4212,    -1,    -1}},
+    {0x388209, {   -1,    -1,  8715,    -1,    -1}},
+    {0x388210, {   -1,    -1,  1848,    -1,    -1}},
+    {0x388300, {   -1,    -1,   369,    -1,    -1}},
+    {0x388310, {   -1,    -1,  1944,    -1,    -1}},
+    {0x388320, {   -1,    -1,  2772,    -1,    -1}},
+    {0x388400, {   -1,    -1,   497,    -1,    -1}},
+    {0x388410, {   -1,    -1,  2050,    -1,    -1}},
+    {0x388420, {   -1,    -1,  2837,    -1,    -1}},
+    {0x388901, {   -1,    -1,  4357,    -1,    -1}},
+    {0x388907, {   -1,    -1,  7264,    -1,    -1}},
+    {0x388909, {   -1,    -1,  8860,    -1,    -1}},
+    {0x388C01, {   -1,    -1,  4509,    -1,    -1}},
+    {0x388C09, {   -1,    -1,  9012,    -1,    -1}},
+    {0x389801, {   -1,    -1,  4647,    -1,    -1}},
+    {0x389809, {   -1,    -1,  9150,    -1,    -1}},
+    {0x38A001, {   -1,    -1,  5009,    -1,    -1}},
+    {0x38A007, {   -1,    -1,  7765,    -1,    -1}},
+    {0x38A009, {   -1,    -1,  9512,    -1,    -1}},
+    {0x38A101, {   -1,    -1,  5069,    -1,    -1}},
+    {0x38A109, {   -1,    -1,  9572,    -1,    -1}},
+    {0x38A801, {   -1,    -1,  5175,    -1,    -1}},
+    {0x38A809, {   -1,    -1,  9678,    -1,    -1}},
+    {0x38AA01, {   -1,    -1,  5265,    -1,    -1}},
+    {0x38AA09, {   -1,    -1,  9768,    -1,    -1}},
+    {0x38B001, {   -1,    -1,  5374,    -1,    -1}},
+    {0x38B007, {   -1,    -1,  7910,    -1,    -1}},
+    {0x38B009, {   -1,    -1,  9877,    -1,    -1}},
+    {0x38BB01, {   -1,    -1,  6089,    -1,    -1}},
+    {0x38BB09, {   -1,    -1, 10592,    -1,    -1}},
+    {0x38E000, {  867,    -1,    -1,    -1,    -1}},
+    {0x38FE00, { 1018,    -1,    -1,    -1,    -1}},
+    {0x38FF00, { 1146,    -1,    -1,    -1,    -1}},
+    {0x390000, {   -1,    -1,    -1,    -1,   114}},
+    {0x390002, {   -1,    -1,   593,    -1,    -1}},
+    {0x390007, {   -1,    -1,  7067,    -1,    -1}},
+    {0x390009, {   -1,    -1,  8495,    -1,    -1}},
+    {0x390080, { 1317,    -1,    -1,    -1,    -1}},
+    {0x3900F2, {   -1,    -1,    -1,   114,    -1}},
+    {0x390100, {   -1,    -1,   114,    -1,    -1}},
+    {0x390101, {   -1,    -1,  4110,    -1,    -1}},
+    {0x390109, {   -1,    -1,  8613,    -1,    -1}},
+    {0x3901FE, {   -1,    -1,  3992,    -1,    -1}},
+    {0x390200, {   -1,    -1,   242,    -1,    -1}},
+    {0x390201, {   -1,    -1,  4213,    -1,    -1}},
+    {0x390209, {   -1,    -1,  8716,    -1,    -1}},
+    {0x390300, {   -1,    -1,   370,    -1,    -1}},
+    {0x390302, {   -1,    -1,   743,    -1,    -1}},
+    {0x390400, {   -1,    -1,   498,    -1,    -1}},
+    {0x390402, {   -1,    -1,   836,    -1,    -1}},
+    {0x390901, {   -1,    -1,  4358,    -1,    -1}},
+    {0x390907, {   -1,    -1,  7265,    -1,    -1}},
+    {0x390909, {   -1,    -1,  8861,    -1,    -1}},
+    {0x390C01, {   -1,    -1,  4510,    -1,    -1}},
+    {0x390C09, {   -1,    -1,  9013,    -1,    -1}},
+    {0x391801, {   -1,    -1,  4648,    -1,    -1}},
+    {0x391809, {   -1,    -1,  9151,    -1,    -1}},
+    {0x392001, {   -1,    -1,  5010,    -1,    -1}},
+    {0x392007, {   -1,    -1,  7766,    -1,    -1}},
+    {0x392009, {   -1,    -1,  9513,    -1,    -1}},
+    {0x392101, {   -1,    -1,  5070,    -1,    -1}},
+    {0x392109, {   -1,    -1,  9573,    -1,    -1}},
+    {0x392801, {   -1,    -1,  5176,    -1,    -1}},
+    {0x392809, {   -1,    -1,  9679,    -1,    -1}},
+    {0x392A01, {   -1,    -1,  5266,    -1,    -1}},
+    {0x392A09, {   -1,    -1,  9769,    -1,    -1}},
+    {0x393B01, {   -1,    -1,  6090,    -1,    -1}},
+    {0x393B09, {   -1,    -1, 10593,    -1,    -1}},
+    {0x396000, {  868,    -1,    -1,    -1,    -1}},
+    {0x396100, {  887,    -1,    -1,    -1,    -1}},
+    {0x396200, {  896,    -1,    -1,    -1,    -1}},
+    {0x397E00, { 1019,    -1,    -1,    -1,    -1}},
+    {0x397F00, { 1147,    -1,    -1,    -1,    -1}},
+    {0x398000, {   -1,    -1,    -1,    -1,   115}},
+    {0x398007, {   -1,    -1,  7068,    -1,    -1}},
+    {0x398009, {   -1,    -1,  8496,    -1,    -1}},
+    {0x398010, {   -1,    72,  1744,    -1,    -1}},
+    {0x398020, {   -1,    -1,  2669,    -1,    -1}},
+    {0x398022, {   -1,    -1,  2879,    -1,    -1}},
+    {0x398030, {   -1,    -1,  3231,    -1,    -1}},
+    {0x398040, {   -1,    -1,  3551,    -1,    -1}},
+    {0x398050, {   -1,    -1,  3723,    -1,    -1}},
+    {0x398080, { 1318,    -1,    -1,    -1,    -1}},
+    {0x3980F2, {   -1,    -1,    -1,   115,    -1}},
+    {0x398100, {   -1,    -1,   115,    -1,    -1}},
+    {0x398101, {   -1,    -1,  4111,    -1,    -1}},
+    {0x398109, {   -1,    -1,  8614,    -1,    -1}},
+    {0x398110, {   -1,    -1,  1787,    -1,    -1}},
+    {0x3981F2, {   -1,    -1,    -1,   180,    -1}},
+    {0x3981FE, {   -1,    -1,  3993,    -1,    -1}},
+    {0x398200, {   -1,    -1,   243,    -1,    -1}},
+    {0x398201, {   -1,    -1,  4214,    -1,    -1}},
+    {0x398209, {   -1,    -1,  8717,    -1,    -1}},
+    {0x398210, {   -1,    -1,  1849,    -1,    -1}},
+    {0x398300, {   -1,    -1,   371,    -1,    -1}},
+    {0x398310, {   -1,    -1,  1945,    -1,    -1}},
+    {0x398320, {   -1,    -1,  2773,    -1,    -1}},
+    {0x398322, {   -1,    -1,  2916,    -1,    -1}},
+    {0x398330, {   -1,    -1,  3282,    -1,    -1}},
+    {0x398340, {   -1,    -1,  3578,    -1,    -1}},
+    {0x398400, {   -1,    -1,   499,    -1,    -1}},
+    {0x398410, {   -1,    -1,  2051,    -1,    -1}},
+    {0x398420, {   -1,    -1,  2838,    -1,    -1}},
+    {0x398422, {   -1,    -1,  2954,    -1,    -1}},
+    {0x398430, {   -1,    -1,  3321,    -1,    -1}},
+    {0x398440, {   -1,    -1,  3600,    -1,    -1}},
+    {0x398450, {   -1,    -1,  3741,    -1,    -1}},
+    {0x398901, {   -1,    -1,  4359,    -1,    -1}},
+    {0x398907, {   -1,    -1,  7266,    -1,    -1}},
+    {0x398909, {   -1,    -1,  8862,    -1,    -1}},
+    {0x398C01, {   -1,    -1,  4511,    -1,    -1}},
+    {0x398C09, {   -1,    -1,  9014,    -1,    -1}},
+    {0x399801, {   -1,    -1,  4649,    -1,    -1}},
+    {0x399809, {   -1,    -1,  9152,    -1,    -1}},
+    {0x39A001, {   -1,    -1,  5011,    -1,    -1}},
+    {0x39A007, {   -1,    -1,  7767,    -1,    -1}},
+    {0x39A009, {   -1,    -1,  9514,    -1,    -1}},
+    {0x39A101, {   -1,    -1,  5071,    -1,    -1}},
+    {0x39A109, {   -1,    -1,  9574,    -1,    -1}},
+    {0x39A801, {   -1,    -1,  5177,    -1,    -1}},
+    {0x39A809, {   -1,    -1,  9680,    -1,    -1}},
+    {0x39AA01, {   -1,    -1,  5267,    -1,    -1}},
+    {0x39AA09, {   -1,    -1,  9770,    -1,    -1}},
+    {0x39BB01, {   -1,    -1,  6091,    -1,    -1}},
+    {0x39BB09, {   -1,    -1, 10594,    -1,    -1}},
+    {0x39E000, {  869,    -1,    -1,    -1,    -1}},
+    {0x39FE00, { 1020,    -1,    -1,    -1,    -1}},
+    {0x39FF00, { 1148,    -1,    -1,    -1,    -1}},
+    {0x3A0000, {   -1,    -1,    -1,    -1,   116}},
+    {0x3A0002, {   -1,    -1,   594,    -1,    -1}},
+    {0x3A0007, {   -1,    -1,  7069,    -1,    -1}},
+    {0x3A0009, {   -1,    -1,  8497,    -1,    -1}},
+    {0x3A0010, {   -1,    73,  1745,    -1,    -1}},
+    {0x3A0012, {   -1,    -1,  2120,    -1,    -1}},
+    {0x3A0020, {   -1,    -1,  2670,    -1,    -1}},
+    {0x3A0022, {   -1,    -1,  2880,    -1,    -1}},
+    {0x3A0024, {   -1,    -1,  2981,    -1,    -1}},
+    {0x3A0030, {   -1,    -1,  3232,    -1,    -1}},
+    {0x3A0032, {   -1,    -1,  3346,    -1,    -1}},
+    {0x3A0034, {   -1,    -1,  3404,    -1,    -1}},
+    {0x3A0036, {   -1,    -1,  3442,    -1,    -1}},
+    {0x3A0038, {   -1,    -1,  3468,    -1,    -1}},
+    {0x3A0040, {   -1,    -1,  3552,    -1,    -1}},
+    {0x3A0050, {   -1,    -1,  3724,    -1,    -1}},
+    {0x3A0052, {   -1,    -1,  3750,    -1,    -1}},
+    {0x3A0054, {   -1,    -1,  3767,    -1,    -1}},
+    {0x3A0056, {   -1,    -1,  3782,    -1,    -1}},
+    {0x3A0080, { 1319,    -1,    -1,    -1,    -1}},
+    {0x3A00F2, {   -1,    -1,    -1,   116,    -1}},
+    {0x3A0100, {   -1,    -1,   116,    -1,    -1}},
+    {0x3A0101, {   -1,    -1,  4112,    -1,    -1}},
+    {0x3A0109, {   -1,    -1,  8615,    -1,    -1}},
+    {0x3A0110, {   -1,    -1,  1788,    -1,    -1}},
+    {0x3A01F2, {   -1,    -1,    -1,   181,    -1}},
+    {0x3A01FE, {   -1,    -1,  3994,    -1,    -1}},
+    {0x3A0200, {   -1,    -1,   244,    -1,    -1}},
+    {0x3A0201, {   -1,    -1,  4215,    -1,    -1}},
+    {0x3A0209, {   -1,    -1,  8718,    -1,    -1}},
+    {0x3A0210, {   -1,    -1,  1850,    -1,    -1}},
+    {0x3A0300, {   -1,    -1,   372,    -1,    -1}},
+    {0x3A0302, {   -1,    -1,   744,    -1,    -1}},
+    {0x3A0310, {   -1,    -1,  1946,    -1,    -1}},
+    {0x3A0320, {   -1,    -1,  2774,    -1,    -1}},
+    {0x3A0322, {   -1,    -1,  2917,    -1,    -1}},
+    {0x3A0324, {   -1,    -1,  3003,    -1,    -1}},
+    {0x3A0400, {   -1,    -1,   500,    -1,    -1}},
+    {0x3A0402, {   -1,    -1,   837,    -1,    -1}},
+    {0x3A0410, {   -1,    -1,  2052,    -1,    -1}},
+    {0x3A0412, {   -1,    -1,  2259,    -1,    -1}},
+    {0x3A0420, {   -1,    -1,  2839,    -1,    -1}},
+    {0x3A0422, {   -1,    -1,  2955,    -1,    -1}},
+    {0x3A0424, {   -1,    -1,  3025,    -1,    -1}},
+    {0x3A0430, {   -1,    -1,  3322,    -1,    -1}},
+    {0x3A0432, {   -1,    -1,  3385,    -1,    -1}},
+    {0x3A0434, {   -1,    -1,  3429,    -1,    -1}},
+    {0x3A0436, {   -1,    -1,  3458,    -1,    -1}},
+    {0x3A0438, {   -1,    -1,  3481,    -1,    -1}},
+    {0x3A0440, {   -1,    -1,  3601,    -1,    -1}},
+    {0x3A0450, {   -1,    -1,  3742,    -1,    -1}},
+    {0x3A0452, {   -1,    -1,  3759,    -1,    -1}},
+    {0x3A0454, {   -1,    -1,  3776,    -1,    -1}},
+    {0x3A0456, {   -1,    -1,  3788,    -1,    -1}},
+    {0x3A0901, {   -1,    -1,  4360,    -1,    -1}},
+    {0x3A0907, {   -1,    -1,  7267,    -1,    -1}},
+    {0x3A0909, {   -1,    -1,  8863,    -1,    -1}},
+    {0x3A0C01, {   -1,    -1,  4512,    -1,    -1}},
+    {0x3A0C09, {   -1,    -1,  9015,    -1,    -1}},
+    {0x3A1801, {   -1,    -1,  4650,    -1,    -1}},
+    {0x3A1809, {   -1,    -1,  9153,    -1,    -1}},
+    {0x3A2001, {   -1,    -1,  5012,    -1,    -1}},
+    {0x3A2007, {   -1,    -1,  7768,    -1,    -1}},
+    {0x3A2009, {   -1,    -1,  9515,    -1,    -1}},
+    {0x3A2101, {   -1,    -1,  5072,    -1,    -1}},
+    {0x3A2109, {   -1,    -1,  9575,    -1,    -1}},
+    {0x3A2801, {   -1,    -1,  5178,    -1,    -1}},
+    {0x3A2809, {   -1,    -1,  9681,    -1,    -1}},
+    {0x3A2A01, {   -1,    -1,  5268,    -1,    -1}},
+    {0x3A2A09, {   -1,    -1,  9771,    -1,    -1}},
+    {0x3A3B01, {   -1,    -1,  6092,    -1,    -1}},
+    {0x3A3B09, {   -1,    -1, 10595,    -1,    -1}},
+    {0x3A6000, {  870,    -1,    -1,    -1,    -1}},
+    {0x3A7E00, { 1021,    -1,    -1,    -1,    -1}},
+    {0x3A7F00, { 1149,    -1,    -1,    -1,    -1}},
+    {0x3A8000, {   -1,    -1,    -1,    -1,   117}},
+    {0x3A8002, {   -1,    -1,   595,    -1,    -1}},
+    {0x3A8004, {   -1,    -1,   907,    -1,    -1}},
+    {0x3A8006, {   -1,    -1,  1116,    -1,    -1}},
+    {0x3A8007, {   -1,    -1,  7070,    -1,    -1}},
+    {0x3A8008, {   -1,    -1,  1281,    -1,    -1}},
+    {0x3A8009, {   -1,    -1,  8498,    -1,    -1}},
+    {0x3A8010, {   -1,    74,  1746,    -1,    -1}},
+    {0x3A8012, {   -1,    -1,  2121,    -1,    -1}},
+    {0x3A8020, {   -1,    -1,  2671,    -1,    -1}},
+    {0x3A8022, {   -1,    -1,  2881,    -1,    -1}},
+    {0x3A8024, {   -1,    -1,  2982,    -1,    -1}},
+    {0x3A8026, {   -1,    -1,  3046,    -1,    -1}},
+    {0x3A8030, {   -1,    -1,  3233,    -1,    -1}},
+    {0x3A8050, {   -1,    -1,  3725,    -1,    -1}},
+    {0x3A8052, {   -1,    -1,  3751,    -1,    -1}},
+    {0x3A8054, {   -1,    -1,  3768,    -1,    -1}},
+    {0x3A8056, {   -1,    -1,  3783,    -1,    -1}},
+    {0x3A8058, {   -1,    -1,  3793,    -1,    -1}},
+    {0x3A80F2, {   -1,    -1,    -1,   117,    -1}},
+    {0x3A8100, {   -1,    -1,   117,    -1,    -1}},
+    {0x3A8101, {   -1,    -1,  4113,    -1,    -1}},
+    {0x3A8109, {   -1,    -1,  8616,    -1,    -1}},
+    {0x3A8110, {   -1,    -1,  1789,    -1,    -1}},
+    {0x3A81F2, {   -1,    -1,    -1,   182,    -1}},
+    {0x3A81FE, {   -1,    -1,  3995,    -1,    -1}},
+    {0x3A8200, {   -1,    -1,   245,    -1,    -1}},
+    {0x3A8201, {   -1,    -1,  4216,    -1,    -1}},
+    {0x3A8202, {   -1,    -1,   665,    -1,    -1}},
+    {0x3A8209, {   -1,    -1,  8719,    -1,    -1}},
+    {0x3A8210, {   -1,    -1,  1851,    -1,    -1}},
+    {0x3A8212, {   -1,    -1,  2147,    -1,    -1}},
+    {0x3A8300, {   -1,    -1,   373,    -1,    -1}},
+    {0x3A8302, {   -1,    -1,   745,    -1,    -1}},
+    {0x3A8310, {   -1,    -1,  1947,    -1,    -1}},
+    {0x3A8312, {   -1,    -1,  2195,    -1,    -1}},
+    {0x3A8320, {   -1,    -1,  2775,    -1,    -1}},
+    {0x3A8322, {   -1,    -1,  2918,    -1,    -1}},
+    {0x3A8324, {   -1,    -1,  3004,    -1,    -1}},
+    {0x3A8326, {   -1,    -1,  3059,    -1,    -1}},
+    {0x3A8400, {   -1,    -1,   501,    -1,    -1}},
+    {0x3A8402, {   -1,    -1,   838,    -1,    -1}},
+    {0x3A8404, {   -1,    -1,  1059,    -1,    -1}},
+    {0x3A8406, {   -1,    -1,  1230,    -1,    -1}},
+    {0x3A8408, {   -1,    -1,  1372,    -1,    -1}},
+    {0x3A8410, {   -1,    -1,  2053,    -1,    -1}},
+    {0x3A8412, {   -1,    -1,  2260,    -1,    -1}},
+    {0x3A8420, {   -1,    -1,  2840,    -1,    -1}},
+    {0x3A8422, {   -1,    -1,  2956,    -1,    -1}},
+    {0x3A8424, {   -1,    -1,  3026,    -1,    -1}},
+    {0x3A8426, {   -1,    -1,  3077,    -1,    -1}},
+    {0x3A8430, {   -1,    -1,  3323,    -1,    -1}},
+    {0x3A8450, {   -1,    -1,  3743,    -1,    -1}},
+    {0x3A8452, {   -1,    -1,  3760,    -1,    -1}},
+    {0x3A8454, {   -1,    -1,  3777,    -1,    -1}},
+    {0x3A8456, {   -1,    -1,  3789,    -1,    -1}},
+    {0x3A8458, {   -1,    -1,  3798,    -1,    -1}},
+    {0x3A8901, {   -1,    -1,  4361,    -1,    -1}},
+    {0x3A8907, {   -1,    -1,  7268,    -1,    -1}},
+    {0x3A8909, {   -1,    -1,  8864,    -1,    -1}},
+    {0x3A8C01, {   -1,    -1,  4513,    -1,    -1}},
+    {0x3A8C09, {   -1,    -1,  9016,    -1,    -1}},
+    {0x3A9801, {   -1,    -1,  4651,    -1,    -1}},
+    {0x3A9809, {   -1,    -1,  9154,    -1,    -1}},
+    {0x3AA001, {   -1,    -1,  5013,    -1,    -1}},
+    {0x3AA007, {   -1,    -1,  7769,    -1,    -1}},
+    {0x3AA009, {   -1,    -1,  9516,    -1,    -1}},
+    {0x3AA101, {   -1,    -1,  5073,    -1,    -1}},
+    {0x3AA109, {   -1,    -1,  9576,    -1,    -1}},
+    {0x3AA801, {   -1,    -1,  5179,    -1,    -1}},
+    {0x3AA809, {   -1,    -1,  9682,    -1,    -1}},
+    {0x3AAA01, {   -1,    -1,  5269,    -1,    -1}},
+    {0x3AAA09, {   -1,    -1,  9772,    -1,    -1}},
+    {0x3ABB01, {   -1,    -1,  6093,    -1,    -1}},
+    {0x3ABB09, {   -1,    -1, 10596,    -1,    -1}},
+    {0x3AC000, {  369,    -1,    -1,    -1,    -1}},
+    {0x3AC100, {  449,    -1,    -1,    -1,    -1}},
+    {0x3AC200, {  519,    -1,    -1,    -1,    -1}},
+    {0x3AC300, {  576,    -1,    -1,    -1,    -1}},
+    {0x3AFE00, { 1022,    -1,    -1,    -1,    -1}},
+    {0x3AFF00, { 1150,    -1,    -1,    -1,    -1}},
+    {0x3B0000, {   -1,    -1,    -1,    -1,   118}},
+    {0x3B0007, {   -1,    -1,  7071,    -1,    -1}},
+    {0x3B0009, {   -1,    -1,  8499,    -1,    -1}},
+    {0x3B0010, {   -1,    75,  1747,    -1,    -1}},
+    {0x3B0012, {   -1,    78,  2122,    -1,    -1}},
+    {0x3B0014, {   -1,    -1,  2307,    -1,    -1}},
+    {0x3B0016, {   -1,    -1,  2408,    -1,    -1}},
+    {0x3B0018, {   -1,    -1,  2482,    -1,    -1}},
+    {0x3B001A, {   -1,    -1,  2533,    -1,    -1}},
+    {0x3B00F2, {   -1,    -1,    -1,   118,    -1}},
+    {0x3B0100, {   -1,    -1,   118,    -1,    -1}},
+    {0x3B0101, {   -1,    -1,  4114,    -1,    -1}},
+    {0x3B0109, {   -1,    -1,  8617,    -1,    -1}},
+    {0x3B0110, {   -1,    -1,  1790,    -1,    -1}},
+    {0x3B0112, {   -1,    -1,  2130,    -1,    -1}},
+    {0x3B01F2, {   -1,    -1,    -1,   183,    -1}},
+    {0x3B01FE, {   -1,    -1,  3996,    -1,    -1}},
+    {0x3B0200, {   -1,    -1,   246,    -1,    -1}},
+    {0x3B0201, {   -1,    -1,  4217,    -1,    -1}},
+    {0x3B0209, {   -1,    -1,  8720,    -1,    -1}},
+    {0x3B0210, {   -1,    -1,  1852,    -1,    -1}},
+    {0x3B0212, {   -1,    -1,  2148,    -1,    -1}},
+    {0x3B02F2, {   -1,    -1,    -1,   215,    -1}},
+    {0x3B0300, {   -1,    -1,   374,    -1,    -1}},
+    {0x3B0310, {   -1,    -1,  1948,    -1,    -1}},
+    {0x3B0312, {   -1,    -1,  2196,    -1,    -1}},
+    {0x3B0314, {   -1,    -1,  2334,    -1,    -1}},
+    {0x3B0316, {   -1,    -1,  2425,    -1,    -1}},
+    {0x3B0318, {   -1,    -1,  2492,    -1,    -1}},
+    {0x3B0400, {   -1,    -1,   502,    -1,    -1}},
+    {0x3B0410, {   -1,    -1,  2054,    -1,    -1}},
+    {0x3B0412, {   -1,    -1,  2261,    -1,    -1}},
+    {0x3B0414, {   -1,    -1,  2377,    -1,    -1}},
+    {0x3B0416, {   -1,    -1,  2456,    -1,    -1}},
+    {0x3B0418, {   -1,    -1,  2516,    -1,    -1}},
+    {0x3B041A, {   -1,    -1,  2554,    -1,    -1}},
+    {0x3B0901, {   -1,    -1,  4362,    -1,    -1}},
+    {0x3B0907, {   -1,    -1,  7269,    -1,    -1}},
+    {0x3B0909, {   -1,    -1,  8865,    -1,    -1}},
+    {0x3B0C01, {   -1,    -1,  4514,    -1,    -1}},
+    {0x3B0C09, {   -1,    -1,  9017,    -1,    -1}},
+    {0x3B1801, {   -1,    -1,  4652,    -1,    -1}},
+    {0x3B1809, {   -1,    -1,  9155,    -1,    -1}},
+    {0x3B2001, {   -1,    -1,  5014,    -1,    -1}},
+    {0x3B2007, {   -1,    -1,  7770,    -1,    -1}},
+    {0x3B2009, {   -1,    -1,  9517,    -1,    -1}},
+    {0x3B2101, {   -1,    -1,  5074,    -1,    -1}},
+    {0x3B2109, {   -1,    -1,  9577,    -1,    -1}},
+    {0x3B2801, {   -1,    -1,  5180,    -1,    -1}},
+    {0x3B2809, {   -1,    -1,  9683,    -1,    -1}},
+    {0x3B2A01, {   -1,    -1,  5270,    -1,    -1}},
+    {0x3B2A09, {   -1,    -1,  9773,    -1,    -1}},
+    {0x3B3B01, {   -1,    -1,  6094,    -1,    -1}},
+    {0x3B3B09, {   -1,    -1, 10597,    -1,    -1}},
+    {0x3B4000, {  370,    -1,    -1,    -1,    -1}},
+    {0x3B4100, {  450,    -1,    -1,    -1,    -1}},
+    {0x3B4200, {  520,    -1,    -1,    -1,    -1}},
+    {0x3B7E00, { 1023,    -1,    -1,    -1,    -1}},
+    {0x3B7F00, { 1151,    -1,    -1,    -1,    -1}},
+    {0x3B8000, {   -1,    -1,    -1,    -1,   119}},
+    {0x3B8002, {   -1,    -1,   596,    -1,    -1}},
+    {0x3B8004, {   -1,    -1,   908,    -1,    -1}},
+    {0x3B8006, {   -1,    -1,  1117,    -1,    -1}},
+    {0x3B8007, {   -1,    -1,  7072,    -1,    -1}},
+    {0x3B8009, {   -1,    -1,  8500,    -1,    -1}},
+    {0x3B8010, {   -1,    -1,  1748,    -1,    -1}},
+    {0x3B8012, {   -1,    -1,  2123,    -1,    -1}},
+    {0x3B8020, {   -1,    -1,  2672,    -1,    -1}},
+    {0x3B8022, {   -1,    -1,  2882,    -1,    -1}},
+    {0x3B8030, {   -1,    -1,  3234,    -1,    -1}},
+    {0x3B8032, {   -1,    -1,  3347,    -1,    -1}},
+    {0x3B8034, {   -1,    -1,  3405,    -1,    -1}},
+    {0x3B8036, {   -1,    -1,  3443,    -1,    -1}},
+    {0x3B8050, {   -1,    -1,  3726,    -1,    -1}},
+    {0x3B8052, {   -1,    -1,  3752,    -1,    -1}},
+    {0x3B8054, {   -1,    -1,  3769,    -1,    -1}},
+    {0x3B8056, {   -1,    -1,  3784,    -1,    -1}},
+    {0x3B8058, {   -1,    -1,  3794,    -1,    -1}},
+    {0x3B805A, {   -1,    -1,  3801,    -1,    -1}},
+    {0x3B805C, {   -1,    -1,  3806,    -1,    -1}},
+    {0x3B80F2, {   -1,    -1,    -1,   119,    -1}},
+    {0x3B8100, {   -1,    -1,   119,    -1,    -1}},
+    {0x3B8101, {   -1,    -1,  4115,    -1,    -1}},
+    {0x3B8109, {   -1,    -1,  8618,    -1,    -1}},
+    {0x3B81FE, {   -1,    -1,  3997,    -1,    -1}},
+    {0x3B8200, {   -1,    -1,   247,    -1,    -1}},
+    {0x3B8202, {   -1,    -1,   666,    -1,    -1}},
+    {0x3B8210, {   -1,    -1,  1853,    -1,    -1}},
+    {0x3B8212, {   -1,    -1,  2149,    -1,    -1}},
+    {0x3B8220, {   -1,    -1,  2718,    -1,    -1}},
+    {0x3B8222, {   -1,    -1,  2893,    -1,    -1}},
+    {0x3B8230, {   -1,    -1,  3252,    -1,    -1}},
+    {0x3B8232, {   -1,    -1,  3354,    -1,    -1}},
+    {0x3B8300, {   -1,    -1,   375,    -1,    -1}},
+    {0x3B8302, {   -1,    -1,   746,    -1,    -1}},
+    {0x3B8304, {   -1,    -1,   992,    -1,    -1}},
+    {0x3B8310, {   -1,    -1,  1949,    -1,    -1}},
+    {0x3B8312, {   -1,    -1,  2197,    -1,    -1}},
+    {0x3B8320, {   -1,    -1,  2776,    -1,    -1}},
+    {0x3B8322, {   -1,    -1,  2919,    -1,    -1}},
+    {0x3B8330, {   -1,    -1,  3283,    -1,    -1}},
+    {0x3B8332, {   -1,    -1,  3366,    -1,    -1}},
+    {0x3B8400, {   -1,    -1,   503,    -1,    -1}},
+    {0x3B8402, {   -1,    -1,   839,    -1,    -1}},
+    {0x3B8404, {   -1,    -1,  1060,    -1,    -1}},
+    {0x3B8406, {   -1,    -1,  1231,    -1,    -1}},
+    {0x3B8410, {   -1,    -1,  2055,    -1,    -1}},
+    {0x3B8412, {   -1,    -1,  2262,    -1,    -1}},
+    {0x3B8420, {   -1,    -1,  2841,    -1,    -1}},
+    {0x3B8422, {   -1,    -1,  2957,    -1,    -1}},
+    {0x3B8430, {   -1,    -1,  3324,    -1,    -1}},
+    {0x3B8432, {   -1,    -1,  3386,    -1,    -1}},
+    {0x3B8434, {   -1,    -1,  3430,    -1,    -1}},
+    {0x3B8436, {   -1,    -1,  3459,    -1,    -1}},
+    {0x3B8450, {   -1,    -1,  3744,    -1,    -1}},
+    {0x3B8452, {   -1,    -1,  3761,    -1,    -1}},
+    {0x3B8454, {   -1,    -1,  3778,    -1,    -1}},
+    {0x3B8456, {   -1,    -1,  3790,    -1,    -1}},
+    {0x3B8458, {   -1,    -1,  3799,    -1,    -1}},
+    {0x3B845A, {   -1,    -1,  3804,    -1,    -1}},
+    {0x3B845C, {   -1,    -1,  3808,    -1,    -1}},
+    {0x3B8901, {   -1,    -1,  4363,    -1,    -1}},
+    {0x3B8907, {   -1,    -1,  7270,    -1,    -1}},
+    {0x3B8909, {   -1,    -1,  8866,    -1,    -1}},
+    {0x3B9801, {   -1,    -1,  4653,    -1,    -1}},
+    {0x3B9809, {   -1,    -1,  9156,    -1,    -1}},
+    {0x3BA001, {   -1,    -1,  5015,    -1,    -1}},
+    {0x3BA007, {   -1,    -1,  7771,    -1,    -1}},
+    {0x3BA009, {   -1,    -1,  9518,    -1,    -1}},
+    {0x3BA801, {   -1,    -1,  5181,    -1,    -1}},
+    {0x3BA809, {   -1,    -1,  9684,    -1,    -1}},
+    {0x3BBB01, {   -1,    -1,  6095,    -1,    -1}},
+    {0x3BBB09, {   -1,    -1, 10598,    -1,    -1}},
+    {0x3BC000, {  371,    -1,    -1,    -1,    -1}},
+    {0x3BC100, {  451,    -1,    -1,    -1,    -1}},
+    {0x3BE000, {  871,    -1,    -1,    -1,    -1}},
+    {0x3BE100, {  888,    -1,    -1,    -1,    -1}},
+    {0x3BE200, {  897,    -1,    -1,    -1,    -1}},
+    {0x3BE300, {  900,    -1,    -1,    -1,    -1}},
+    {0x3BE400, {  902,    -1,    -1,    -1,    -1}},
+    {0x3BE500, {  904,    -1,    -1,    -1,    -1}},
+    {0x3BFE00, { 1024,    -1,    -1,    -1,    -1}},
+    {0x3BFF00, { 1152,    -1,    -1,    -1,    -1}},
+    {0x3C0000, {   -1,    -1,    -1,    -1,   120}},
+    {0x3C0002, {   -1,     8,   597,    -1,    -1}},
+    {0x3C0004, {   -1,    17,   909,    -1,    -1}},
+    {0x3C0006, {   -1,    -1,  1118,    -1,    -1}},
+    {0x3C0007, {   -1,    -1,  7073,    -1,    -1}},
+    {0x3C0008, {   -1,    -1,  1282,    -1,    -1}},
+    {0x3C0009, {   -1,    -1,  8501,    -1,    -1}},
+    {0x3C000A, {   -1,    -1,  1416,    -1,    -1}},
+    {0x3C000C, {   -1,    -1,  1525,    -1,    -1}},
+    {0x3C0010, {   -1,    -1,  1749,    -1,    -1}},
+    {0x3C0012, {   -1,    -1,  2124,    -1,    -1}},
+    {0x3C0014, {   -1,    -1,  2308,    -1,    -1}},
+    {0x3C0016, {   -1,    -1,  2409,    -1,    -1}},
+    {0x3C0018, {   -1,    -1,  2483,    -1,    -1}},
+    {0x3C001A, {   -1,    -1,  2534,    -1,    -1}},
+    {0x3C0020, {   -1,    -1,  2673,    -1,    -1}},
+    {0x3C0022, {   -1,    -1,  2883,    -1,    -1}},
+    {0x3C0024, {   -1,    -1,  2983,    -1,    -1}},
+    {0x3C0026, {   -1,    -1,  3047,    -1,    -1}},
+    {0x3C0028, {   -1,    -1,  3092,    -1,    -1}},
+    {0x3C002A, {   -1,    -1,  3124,    -1,    -1}},
+    {0x3C002C, {   -1,    -1,  3150,    -1,    -1}},
+    {0x3C002E, {   -1,    -1,  3177,    -1,    -1}},
+    {0x3C0030, {   -1,    -1,  3235,    -1,    -1}},
+    {0x3C0032, {   -1,    -1,  3348,    -1,    -1}},
+    {0x3C0034, {   -1,    -1,  3406,    -1,    -1}},
+    {0x3C0036, {   -1,    -1,  3444,    -1,    -1}},
+    {0x3C0038, {   -1,    -1,  3469,    -1,    -1}},
+    {0x3C003A, {   -1,    -1,  3489,    -1,    -1}},
+    {0x3C003C, {   -1,    -1,  3505,    -1,    -1}},
+    {0x3C003E, {   -1,    -1,  3520,    -1,    -1}},
+    {0x3C0040, {   -1,    -1,  3553,    -1,    -1}},
+    {0x3C0044, {   -1,    -1,  3647,    -1,    -1}},
+    {0x3C0046, {   -1,    -1,  3665,    -1,    -1}},
+    {0x3C0048, {   -1,    -1,  3683,    -1,    -1}},
+    {0x3C004A, {   -1,    -1,  3695,    -1,    -1}},
+    {0x3C004C, {   -1,    -1,  3704,    -1,    -1}},
+    {0x3C004E, {   -1,    -1,  3711,    -1,    -1}},
+    {0x3C0050, {   -1,    -1,  3727,    -1,    -1}},
+    {0x3C0052, {   -1,    -1,  3753,    -1,    -1}},
+    {0x3C0054, {   -1,    -1,  3770,    -1,    -1}},
+    {0x3C00F2, {   -1,    -1,    -1,   120,    -1}},
+    {0x3C0100, {   -1,    -1,   120,    -1,    -1}},
+    {0x3C0101, {   -1,    -1,  4116,    -1,    -1}},
+    {0x3C0102, {   -1,    -1,   613,    -1,    -1}},
+    {0x3C0104, {   -1,    -1,   918,    -1,    -1}},
+    {0x3C0109, {   -1,    -1,  8619,    -1,    -1}},
+    {0x3C01F2, {   -1,    -1,    -1,   184,    -1}},
+    {0x3C01FE, {   -1,    -1,  3998,    -1,    -1}},
+    {0x3C0200, {   -1,    -1,   248,    -1,    -1}},
+    {0x3C0202, {   -1,    -1,   667,    -1,    -1}},
+    {0x3C0204, {   -1,    -1,   943,    -1,    -1}},
+    {0x3C0206, {   -1,    -1,  1140,    -1,    -1}},
+    {0x3C0208, {   -1,    -1,  1301,    -1,    -1}},
+    {0x3C020A, {   -1,    -1,  1434,    -1,    -1}},
+    {0x3C020C, {   -1,    -1,  1538,    -1,    -1}},
+    {0x3C02F2, {   -1,    -1,    -1,   216,    -1}},
+    {0x3C0300, {   -1,    -1,   376,    -1,    -1}},
+    {0x3C0302, {   -1,    -1,   747,    -1,    -1}},
+    {0x3C0304, {   -1,    -1,   993,    -1,    -1}},
+    {0x3C0306, {   -1,    -1,  1176,    -1,    -1}},
+    {0x3C0308, {   -1,    -1,  1324,    -1,    -1}},
+    {0x3C030A, {   -1,    -1,  1450,    -1,    -1}},
+    {0x3C030C, {   -1,    -1,  1550,    -1,    -1}},
+    {0x3C0310, {   -1,    -1,  1950,    -1,    -1}},
+    {0x3C0312, {   -1,    -1,  2198,    -1,    -1}},
+    {0x3C0314, {   -1,    -1,  2335,    -1,    -1}},
+    {0x3C0316, {   -1,    -1,  2426,    -1,    -1}},
+    {0x3C0318, {   -1,    -1,  2493,    -1,    -1}},
+    {0x3C031A, {   -1,    -1,  2540,    -1,    -1}},
+    {0x3C0400, {   -1,    -1,   504,    -1,    -1}},
+    {0x3C0402, {   -1,    -1,   840,    -1,    -1}},
+    {0x3C0404, {   -1,    -1,  1061,    -1,    -1}},
+    {0x3C0406, {   -1,    -1,  1232,    -1,    -1}},
+    {0x3C0408, {   -1,    -1,  1373,    -1,    -1}},
+    {0x3C040A, {   -1,    -1,  1492,    -1,    -1}},
+    {0x3C040C, {   -1,    -1,  1579,    -1,    -1}},
+    {0x3C0410, {   -1,    -1,  2056,    -1,    -1}},
+    {0x3C0412, {   -1,    -1,  2263,    -1,    -1}},
+    {0x3C0414, {   -1,    -1,  2378,    -1,    -1}},
+    {0x3C0416, {   -1,    -1,  2457,    -1,    -1}},
+    {0x3C0418, {   -1,    -1,  2517,    -1,    -1}},
+    {0x3C041A, {   -1,    -1,  2555,    -1,    -1}},
+    {0x3C0420, {   -1,    -1,  2842,    -1,    -1}},
+    {0x3C0422, {   -1,    -1,  2958,    -1,    -1}},
+    {0x3C0424, {   -1,    -1,  3027,    -1,    -1}},
+    {0x3C0426, {   -1,    -1,  3078,    -1,    -1}},
+    {0x3C0428, {   -1,    -1,  3111,    -1,    -1}},
+    {0x3C042A, {   -1,    -1,  3138,    -1,    -1}},
+    {0x3C042C, {   -1,    -1,  3165,    -1,    -1}},
+    {0x3C042E, {   -1,    -1,  3191,    -1,    -1}},
+    {0x3C0430, {   -1,    -1,  3325,    -1,    -1}},
+    {0x3C0432, {   -1,    -1,  3387,    -1,    -1}},
+    {0x3C0434, {   -1,    -1,  3431,    -1,    -1}},
+    {0x3C0436, {   -1,    -1,  3460,    -1,    -1}},
+    {0x3C0438, {   -1,    -1,  3482,    -1,    -1}},
+    {0x3C043A, {   -1,    -1,  3498,    -1,    -1}},
+    {0x3C043C, {   -1,    -1,  3513,    -1,    -1}},
+    {0x3C043E, {   -1,    -1,  3528,    -1,    -1}},
+    {0x3C0440, {   -1,    -1,  3602,    -1,    -1}},
+    {0x3C0444, {   -1,    -1,  3656,    -1,    -1}},
+    {0x3C0446, {   -1,    -1,  3676,    -1,    -1}},
+    {0x3C0448, {   -1,    -1,  3690,    -1,    -1}},
+    {0x3C044A, {   -1,    -1,  3700,    -1,    -1}},
+    {0x3C044C, {   -1,    -1,  3708,    -1,    -1}},
+    {0x3C044E, {   -1,    -1,  3714,    -1,    -1}},
+    {0x3C0450, {   -1,    -1,  3745,    -1,    -1}},
+    {0x3C0452, {   -1,    -1,  3762,    -1,    -1}},
+    {0x3C0454, {   -1,    -1,  3779,    -1,    -1}},
+    {0x3C0901, {   -1,    -1,  4364,    -1,    -1}},
+    {0x3C0907, {   -1,    -1,  7271,    -1,    -1}},
+    {0x3C0909, {   -1,    -1,  8867,    -1,    -1}},
+    {0x3C1801, {   -1,    -1,  4654,    -1,    -1}},
+    {0x3C1809, {   -1,    -1,  9157,    -1,    -1}},
+    {0x3C2001, {   -1,    -1,  5016,    -1,    -1}},
+    {0x3C2007, {   -1,    -1,  7772,    -1,    -1}},
+    {0x3C2009, {   -1,    -1,  9519,    -1,    -1}},
+    {0x3C2801, {   -1,    -1,  5182,    -1,    -1}},
+    {0x3C2809, {   -1,    -1,  9685,    -1,    -1}},
+    {0x3C7E00, { 1025,    -1,    -1,    -1,    -1}},
+    {0x3C7F00, { 1153,    -1,    -1,    -1,    -1}},
+    {0x3C8000, {   -1,    -1,    -1,    -1,   121}},
+    {0x3C8002, {   -1,     9,   598,    -1,    -1}},
+    {0x3C8004, {   -1,    -1,   910,    -1,    -1}},
+    {0x3C8006, {   -1,    -1,  1119,    -1,    -1}},
+    {0x3C8007, {   -1,    -1,  7074,    -1,    -1}},
+    {0x3C8008, {   -1,    -1,  1283,    -1,    -1}},
+    {0x3C8009, {   -1,    -1,  8502,    -1,    -1}},
+    {0x3C800A, {   -1,    -1,  1417,    -1,    -1}},
+    {0x3C800C, {   -1,    -1,  1526,    -1,    -1}},
+    {0x3C800E, {   -1,    -1,  1604,    -1,    -1}},
+    {0x3C8010, {   -1,    -1,  1750,    -1,    -1}},
+    {0x3C8012, {   -1,    -1,  2125,    -1,    -1}},
+    {0x3C80F2, {   -1,    -1,    -1,   121,    -1}},
+    {0x3C8100, {   -1,    -1,   121,    -1,    -1}},
+    {0x3C8101, {   -1,    -1,  4117,    -1,    -1}},
+    {0x3C8102, {   -1,    -1,   614,    -1,    -1}},
+    {0x3C8109, {   -1,    -1,  8620,    -1,    -1}},
+    {0x3C81F2, {   -1,    -1,    -1,   185,    -1}},
+    {0x3C81FE, {   -1,    -1,  3999,    -1,    -1}},
+    {0x3C8200, {   -1,    -1,   249,    -1,    -1}},
+    {0x3C8202, {   -1,    -1,   668,    -1,    -1}},
+    {0x3C8300, {   -1,    -1,   377,    -1,    -1}},
+    {0x3C8302, {   -1,    -1,   748,    -1,    -1}},
+    {0x3C8400, {   -1,    -1,   505,    -1,    -1}},
+    {0x3C8402, {   -1,    -1,   841,    -1,    -1}},
+    {0x3C8404, {   -1,    -1,  1062,    -1,    -1}},
+    {0x3C8406, {   -1,    -1,  1233,    -1,    -1}},
+    {0x3C8408, {   -1,    -1,  1374,    -1,    -1}},
+    {0x3C840A, {   -1,    -1,  1493,    -1,    -1}},
+    {0x3C840C, {   -1,    -1,  1580,    -1,    -1}},
+    {0x3C840E, {   -1,    -1,  1641,    -1,    -1}},
+    {0x3C8410, {   -1,    -1,  2057,    -1,    -1}},
+    {0x3C8412, {   -1,    -1,  2264,    -1,    -1}},
+    {0x3C8901, {   -1,    -1,  4365,    -1,    -1}},
+    {0x3C8907, {   -1,    -1,  7272,    -1,    -1}},
+    {0x3C8909, {   -1,    -1,  8868,    -1,    -1}},
+    {0x3C9801, {   -1,    -1,  4655,    -1,    -1}},
+    {0x3C9809, {   -1,    -1,  9158,    -1,    -1}},
+    {0x3CA001, {   -1,    -1,  5017,    -1,    -1}},
+    {0x3CA007, {   -1,    -1,  7773,    -1,    -1}},
+    {0x3CA009, {   -1,    -1,  9520,    -1,    -1}},
+    {0x3CA801, {   -1,    -1,  5183,    -1,    -1}},
+    {0x3CA809, {   -1,    -1,  9686,    -1,    -1}},
+    {0x3CFE00, { 1026,    -1,    -1,    -1,    -1}},
+    {0x3CFF00, { 1154,    -1,    -1,    -1,    -1}},
+    {0x3D0000, {   -1,    -1,    -1,    -1,   122}},
+    {0x3D0002, {   -1,    10,   599,    -1,    -1}},
+    {0x3D0004, {   -1,    18,   911,    -1,    -1}},
+    {0x3D0006, {   -1,    24,  1120,    -1,    -1}},
+    {0x3D0007, {   -1,    -1,  7075,    -1,    -1}},
+    {0x3D0008, {   -1,    30,  1284,    -1,    -1}},
+    {0x3D0009, {   -1,    -1,  8503,    -1,    -1}},
+    {0x3D000A, {   -1,    34,  1418,    -1,    -1}},
+    {0x3D000C, {   -1,    -1,  1527,    -1,    -1}},
+    {0x3D000E, {   -1,    -1,  1605,    -1,    -1}},
+    {0x3D0020, {   -1,    -1,  2674,    -1,    -1}},
+    {0x3D0022, {   -1,    -1,  2884,    -1,    -1}},
+    {0x3D00F2, {   -1,    -1,    -1,   122,    -1}},
+    {0x3D0100, {   -1,    -1,   122,    -1,    -1}},
+    {0x3D0101, {   -1,    -1,  4118,    -1,    -1}},
+    {0x3D0102, {   -1,    -1,   615,    -1,    -1}},
+    {0x3D0104, {   -1,    -1,   919,    -1,    -1}},
+    {0x3D0106, {   -1,    -1,  1126,    -1,    -1}},
+    {0x3D0108, {   -1,    -1,  1290,    -1,    -1}},
+    {0x3D0109, {   -1,    -1,  8621,    -1,    -1}},
+    {0x3D010A, {   -1,    -1,  1424,    -1,    -1}},
+    {0x3D01F2, {   -1,    -1,    -1,   186,    -1}},
+    {0x3D01FE, {   -1,    -1,  4000,    -1,    -1}},
+    {0x3D0200, {   -1,    -1,   250,    -1,    -1}},
+    {0x3D0202, {   -1,    -1,   669,    -1,    -1}},
+    {0x3D0204, {   -1,    -1,   944,    -1,    -1}},
+    {0x3D0206, {   -1,    -1,  1141,    -1,    -1}},
+    {0x3D0208, {   -1,    -1,  1302,    -1,    -1}},
+    {0x3D020A, {   -1,    -1,  1435,    -1,    -1}},
+    {0x3D02F2, {   -1,    -1,    -1,   217,    -1}},
+    {0x3D0300, {   -1,    -1,   378,    -1,    -1}},
+    {0x3D0302, {   -1,    -1,   749,    -1,    -1}},
+    {0x3D0304, {   -1,    -1,   994,    -1,    -1}},
+    {0x3D0306, {   -1,    -1,  1177,    -1,    -1}},
+    {0x3D0308, {   -1,    -1,  1325,    -1,    -1}},
+    {0x3D030A, {   -1,    -1,  1451,    -1,    -1}},
+    {0x3D030C, {   -1,    -1,  1551,    -1,    -1}},
+    {0x3D0320, {   -1,    -1,  2777,    -1,    -1}},
+    {0x3D0322, {   -1,    -1,  2920,    -1,    -1}},
+    {0x3D03F2, {   -1,    -1,    -1,   235,    -1}},
+    {0x3D0400, {   -1,    -1,   506,    -1,    -1}},
+    {0x3D0402, {   -1,    -1,   842,    -1,    -1}},
+    {0x3D0404, {   -1,    -1,  1063,    -1,    -1}},
+    {0x3D0406, {   -1,    -1,  1234,    -1,    -1}},
+    {0x3D0408, {   -1,    -1,  1375,    -1,    -1}},
+    {0x3D040A, {   -1,    -1,  1494,    -1,    -1}},
+    {0x3D040C, {   -1,    -1,  1581,    -1,    -1}},
+    {0x3D040E, {   -1,    -1,  1642,    -1,    -1}},
+    {0x3D0420, {   -1,    -1,  2843,    -1,    -1}},
+    {0x3D0422, {   -1,    -1,  2959,    -1,    -1}},
+    {0x3D04F2, {   -1,    -1,    -1,   244,    -1}},
+    {0x3D05F2, {   -1,    -1,    -1,   248,    -1}},
+    {0x3D0901, {   -1,    -1,  4366,    -1,    -1}},
+    {0x3D0907, {   -1,    -1,  7273,    -1,    -1}},
+    {0x3D0909, {   -1,    -1,  8869,    -1,    -1}},
+    {0x3D1801, {   -1,    -1,  4656,    -1,    -1}},
+    {0x3D1809, {   -1,    -1,  9159,    -1,    -1}},
+    {0x3D2001, {   -1,    -1,  5018,    -1,    -1}},
+    {0x3D2007, {   -1,    -1,  7774,    -1,    -1}},
+    {0x3D2009, {   -1,    -1,  9521,    -1,    -1}},
+    {0x3D2801, {   -1,    -1,  5184,    -1,    -1}},
+    {0x3D2809, {   -1,    -1,  9687,    -1,    -1}},
+    {0x3D7E00, { 1027,    -1,    -1,    -1,    -1}},
+    {0x3D7F00, { 1155,    -1,    -1,    -1,    -1}},
+    {0x3D8000, {   -1,    -1,    -1,    -1,   123}},
+    {0x3D8002, {   -1,    11,   600,    -1,    -1}},
+    {0x3D8004, {   -1,    19,   912,    -1,    -1}},
+    {0x3D8006, {   -1,    25,  1121,    -1,    -1}},
+    {0x3D8007, {   -1,    -1,  7076,    -1,    -1}},
+    {0x3D8008, {   -1,    -1,  1285,    -1,    -1}},
+    {0x3D8009, {   -1,    -1,  8504,    -1,    -1}},
+    {0x3D800A, {   -1,    -1,  1419,    -1,    -1}},
+    {0x3D800C, {   -1,    -1,  1528,    -1,    -1}},
+    {0x3D800E, {   -1,    -1,  1606,    -1,    -1}},
+    {0x3D8010, {   -1,    -1,  1751,    -1,    -1}},
+    {0x3D80F2, {   -1,    -1,    -1,   123,    -1}},
+    {0x3D8100, {   -1,    -1,   123,    -1,    -1}},
+    {0x3D8101, {   -1,    -1,  4119,    -1,    -1}},
+    {0x3D8102, {   -1,    -1,   616,    -1,    -1}},
+    {0x3D8104, {   -1,    -1,   920,    -1,    -1}},
+    {0x3D8106, {   -1,    -1,  1127,    -1,    -1}},
+    {0x3D8109, {   -1,    -1,  8622,    -1,    -1}},
+    {0x3D81F2, {   -1,    -1,    -1,   187,    -1}},
+    {0x3D81FE, {   -1,    -1,  4001,    -1,    -1}},
+    {0x3D8200, {   -1,    -1,   251,    -1,    -1}},
+    {0x3D8202, {   -1,    -1,   670,    -1,    -1}},
+    {0x3D8204, {   -1,    -1,   945,    -1,    -1}},
+    {0x3D8206, {   -1,    -1,  1142,    -1,    -1}},
+    {0x3D8208, {   -1,    -1,  1303,    -1,    -1}},
+    {0x3D820A, {   -1,    -1,  1436,    -1,    -1}},
+    {0x3D82F2, {   -1,    -1,    -1,   218,    -1}},
+    {0x3D8300, {   -1,    -1,   379,    -1,    -1}},
+    {0x3D8302, {   -1,    -1,   750,    -1,    -1}},
+    {0x3D8304, {   -1,    -1,   995,    -1,    -1}},
+    {0x3D8306, {   -1,    -1,  1178,    -1,    -1}},
+    {0x3D8308, {   -1,    -1,  1326,    -1,    -1}},
+    {0x3D830A, {   -1,    -1,  1452,    -1,    -1}},
+    {0x3D83F2, {   -1,    -1,    -1,   236,    -1}},
+    {0x3D8400, {   -1,    -1,   507,    -1,    -1}},
+    {0x3D8402, {   -1,    -1,   843,    -1,    -1}},
+    {0x3D8404, {   -1,    -1,  1064,    -1,    -1}},
+    {0x3D8406, {   -1,    -1,  1235,    -1,    -1}},
+    {0x3D8408, {   -1,    -1,  1376,    -1,    -1}},
+    {0x3D840A, {   -1,    -1,  1495,    -1,    -1}},
+    {0x3D840C, {   -1,    -1,  1582,    -1,    -1}},
+    {0x3D840E, {   -1,    -1,  1643,    -1,    -1}},
+    {0x3D8410, {   -1,    -1,  2058,    -1,    -1}},
+    {0x3D8901, {   -1,    -1,  4367,    -1,    -1}},
+    {0x3D8907, {   -1,    -1,  7274,    -1,    -1}},
+    {0x3D8909, {   -1,    -1,  8870,    -1,    -1}},
+    {0x3D9801, {   -1,    -1,  4657,    -1,    -1}},
+    {0x3D9809, {   -1,    -1,  9160,    -1,    -1}},
+    {0x3DA001, {   -1,    -1,  5019,    -1,    -1}},
+    {0x3DA007, {   -1,    -1,  7775,    -1,    -1}},
+    {0x3DA009, {   -1,    -1,  9522,    -1,    -1}},
+    {0x3DA801, {   -1,    -1,  5185,    -1,    -1}},
+    {0x3DA809, {   -1,    -1,  9688,    -1,    -1}},
+    {0x3DFE00, { 1028,    -1,    -1,    -1,    -1}},
+    {0x3DFF00, { 1156,    -1,    -1,    -1,    -1}},
+    {0x3E0000, {   -1,    -1,    -1,    -1,   124}},
+    {0x3E0002, {   -1,    12,   601,    -1,    -1}},
+    {0x3E0004, {   -1,    20,   913,    -1,    -1}},
+    {0x3E0006, {   -1,    26,  1122,    -1,    -1}},
+    {0x3E0007, {   -1,    -1,  7077,    -1,    -1}},
+    {0x3E0008, {   -1,    31,  1286,    -1,    -1}},
+    {0x3E0009, {   -1,    -1,  8505,    -1,    -1}},
+    {0x3E000A, {   -1,    35,  1420,    -1,    -1}},
+    {0x3E000E, {   -1,    -1,  1607,    -1,    -1}},
+    {0x3E0010, {   -1,    -1,  1752,    -1,    -1}},
+    {0x3E0012, {   -1,    -1,  2126,    -1,    -1}},
+    {0x3E0014, {   -1,    -1,  2309,    -1,    -1}},
+    {0x3E0016, {   -1,    -1,  2410,    -1,    -1}},
+    {0x3E0018, {   -1,    -1,  2484,    -1,    -1}},
+    {0x3E001A, {   -1,    -1,  2535,    -1,    -1}},
+    {0x3E001C, {   -1,    -1,  2569,    -1,    -1}},
+    {0x3E001E, {   -1,    -1,  2595,    -1,    -1}},
+    {0x3E0020, {   -1,    -1,  2675,    -1,    -1}},
+    {0x3E00F2, {   -1,    -1,    -1,   124,    -1}},
+    {0x3E0100, {   -1,    -1,   124,    -1,    -1}},
+    {0x3E0101, {   -1,    -1,  4120,    -1,    -1}},
+    {0x3E0102, {   -1,    -1,   617,    -1,    -1}},
+    {0x3E0104, {   -1,    -1,   921,    -1,    -1}},
+    {0x3E0106, {   -1,    -1,  1128,    -1,    -1}},
+    {0x3E0108, {   -1,    -1,  1291,    -1,    -1}},
+    {0x3E0109, {   -1,    -1,  8623,    -1,    -1}},
+    {0x3E010A, {   -1,    -1,  1425,    -1,    -1}},
+    {0x3E01F2, {   -1,    -1,    -1,   188,    -1}},
+    {0x3E01FE, {   -1,    -1,  4002,    -1,    -1}},
+    {0x3E0200, {   -1,    -1,   252,    -1,    -1}},
+    {0x3E0202, {   -1,    -1,   671,    -1,    -1}},
+    {0x3E0204, {   -1,    -1,   946,    -1,    -1}},
+    {0x3E0206, {   -1,    -1,  1143,    -1,    -1}},
+    {0x3E0208, {   -1,    -1,  1304,    -1,    -1}},
+    {0x3E020A, {   -1,    -1,  1437,    -1,    -1}},
+    {0x3E020E, {   -1,    -1,  1613,    -1,    -1}},
+    {0x3E02F2, {   -1,    -1,    -1,   219,    -1}},
+    {0x3E0300, {   -1,    -1,   380,    -1,    -1}},
+    {0x3E0302, {   -1,    -1,   751,    -1,    -1}},
+    {0x3E0304, {   -1,    -1,   996,    -1,    -1}},
+    {0x3E0306, {   -1,    -1,  1179,    -1,    -1}},
+    {0x3E0308, {   -1,    -1,  1327,    -1,    -1}},
+    {0x3E030A, {   -1,    -1,  1453,    -1,    -1}},
+    {0x3E030E, {   -1,    -1,  1620,    -1,    -1}},
+    {0x3E0310, {   -1,    -1,  1951,    -1,    -1}},
+    {0x3E0312, {   -1,    -1,  2199,    -1,    -1}},
+    {0x3E0314, {   -1,    -1,  2336,    -1,    -1}},
+    {0x3E0316, {   -1,    -1,  2427,    -1,    -1}},
+    {0x3E03F2, {   -1,    -1,    -1,   237,    -1}},
+    {0x3E0400, {   -1,    -1,   508,    -1,    -1}},
+    {0x3E0402, {   -1,    -1,   844,    -1,    -1}},
+    {0x3E0404, {   -1,    -1,  1065,    -1,    -1}},
+    {0x3E0406, {   -1,    -1,  1236,    -1,    -1}},
+    {0x3E0408, {   -1,    -1,  1377,    -1,    -1}},
+    {0x3E040A, {   -1,    -1,  1496,    -1,    -1}},
+    {0x3E040E, {   -1,    -1,  1644,    -1,    -1}},
+    {0x3E0410, {   -1,    -1,  2059,    -1,    -1}},
+    {0x3E0412, {   -1,    -1,  2265,    -1,    -1}},
+    {0x3E0414, {   -1,    -1,  2379,    -1,    -1}},
+    {0x3E0416, {   -1,    -1,  2458,    -1,    -1}},
+    {0x3E0418, {   -1,    -1,  2518,    -1,    -1}},
+    {0x3E041A, {   -1,    -1,  2556,    -1,    -1}},
+    {0x3E041C, {   -1,    -1,  2584,    -1,    -1}},
+    {0x3E041E, {   -1,    -1,  2608,    -1,    -1}},
+    {0x3E0420, {   -1,    -1,  2844,    -1,    -1}},
+    {0x3E04F2, {   -1,    -1,    -1,   245,    -1}},
+    {0x3E05F2, {   -1,    -1,    -1,   249,    -1}},
+    {0x3E0901, {   -1,    -1,  4368,    -1,    -1}},
+    {0x3E0907, {   -1,    -1,  7275,    -1,    -1}},
+    {0x3E0909, {   -1,    -1,  8871,    -1,    -1}},
+    {0x3E1801, {   -1,    -1,  4658,    -1,    -1}},
+    {0x3E1809, {   -1,    -1,  9161,    -1,    -1}},
+    {0x3E2001, {   -1,    -1,  5020,    -1,    -1}},
+    {0x3E2007, {   -1,    -1,  7776,    -1,    -1}},
+    {0x3E2009, {   -1,    -1,  9523,    -1,    -1}},
+    {0x3E2801, {   -1,    -1,  5186,    -1,    -1}},
+    {0x3E2809, {   -1,    -1,  9689,    -1,    -1}},
+    {0x3E7E00, { 1029,    -1,    -1,    -1,    -1}},
+    {0x3E7F00, { 1157,    -1,    -1,    -1,    -1}},
+    {0x3E8000, {   -1,    -1,    -1,    -1,   125}},
+    {0x3E8002, {   -1,    13,   602,    -1,    -1}},
+    {0x3E8004, {   -1,    21,   914,    -1,    -1}},
+    {0x3E8006, {   -1,    27,  1123,    -1,    -1}},
+    {0x3E8007, {   -1,    -1,  7078,    -1,    -1}},
+    {0x3E8008, {   -1,    32,  1287,    -1,    -1}},
+    {0x3E8009, {   -1,    -1,  8506,    -1,    -1}},
+    {0x3E800A, {   -1,    36,  1421,    -1,    -1}},
+    {0x3E800C, {   -1,    38,  1529,    -1,    -1}},
+    {0x3E800E, {   -1,    39,  1608,    -1,    -1}},
+    {0x3E8010, {   -1,    76,  1753,    -1,    -1}},
+    {0x3E8012, {   -1,    79,  2127,    -1,    -1}},
+    {0x3E8014, {   -1,    -1,  2310,    -1,    -1}},
+    {0x3E8016, {   -1,    -1,  2411,    -1,    -1}},
+    {0x3E8018, {   -1,    -1,  2485,    -1,    -1}},
+    {0x3E801A, {   -1,    -1,  2536,    -1,    -1}},
+    {0x3E801C, {   -1,    -1,  2570,    -1,    -1}},
+    {0x3E801E, {   -1,    -1,  2596,    -1,    -1}},
+    {0x3E8020, {   -1,    -1,  2676,    -1,    -1}},
+    {0x3E8022, {   -1,    -1,  2885,    -1,    -1}},
+    {0x3E8024, {   -1,    -1,  2984,    -1,    -1}},
+    {0x3E8026, {   -1,    -1,  3048,    -1,    -1}},
+    {0x3E8028, {   -1,    -1,  3093,    -1,    -1}},
+    {0x3E802A, {   -1,    -1,  3125,    -1,    -1}},
+    {0x3E802C, {   -1,    -1,  3151,    -1,    -1}},
+    {0x3E802E, {   -1,    -1,  3178,    -1,    -1}},
+    {0x3E8030, {   -1,    -1,  3236,    -1,    -1}},
+    {0x3E8032, {   -1,    -1,  3349,    -1,    -1}},
+    {0x3E8034, {   -1,    -1,  3407,    -1,    -1}},
+    {0x3E8036, {   -1,    -1,  3445,    -1,    -1}},
+    {0x3E8038, {   -1,    -1,  3470,    -1,    -1}},
+    {0x3E803A, {   -1,    -1,  3490,    -1,    -1}},
+    {0x3E803C, {   -1,    -1,  3506,    -1,    -1}},
+    {0x3E803E, {   -1,    -1,  3521,    -1,    -1}},
+    {0x3E8040, {   -1,    -1,  3554,    -1,    -1}},
+    {0x3E80F2, {   -1,    -1,    -1,   125,    -1}},
+    {0x3E8100, {   -1,    -1,   125,    -1,    -1}},
+    {0x3E8101, {   -1,    -1,  4121,    -1,    -1}},
+    {0x3E8102, {   -1,    -1,   618,    -1,    -1}},
+    {0x3E8104, {   -1,    -1,   922,    -1,    -1}},
+    {0x3E8106, {   -1,    -1,  1129,    -1,    -1}},
+    {0x3E8108, {   -1,    -1,  1292,    -1,    -1}},
+    {0x3E8109, {   -1,    -1,  8624,    -1,    -1}},
+    {0x3E810A, {   -1,    -1,  1426,    -1,    -1}},
+    {0x3E810C, {   -1,    -1,  1532,    -1,    -1}},
+    {0x3E810E, {   -1,    -1,  1610,    -1,    -1}},
+    {0x3E8110, {   -1,    -1,  1791,    -1,    -1}},
+    {0x3E8112, {   -1,    -1,  2131,    -1,    -1}},
+    {0x3E81F2, {   -1,    -1,    -1,   189,    -1}},
+    {0x3E81FE, {   -1,    -1,  4003,    -1,    -1}},
+    {0x3E8200, {   -1,    -1,   253,    -1,    -1}},
+    {0x3E8202, {   -1,    -1,   672,    -1,    -1}},
+    {0x3E8204, {   -1,    -1,   947,    -1,    -1}},
+    {0x3E8206, {   -1,    -1,  1144,    -1,    -1}},
+    {0x3E8208, {   -1,    -1,  1305,    -1,    -1}},
+    {0x3E820A, {   -1,    -1,  1438,    -1,    -1}},
+    {0x3E820C, {   -1,    -1,  1539,    -1,    -1}},
+    {0x3E820E, {   -1,    -1,  1614,    -1,    -1}},
+    {0x3E8210, {   -1,    -1,  1854,    -1,    -1}},
+    {0x3E8212, {   -1,    -1,  2150,    -1,    -1}},
+    {0x3E82F2, {   -1,    -1,    -1,   220,    -1}},
+    {0x3E8300, {   -1,    -1,   381,    -1,    -1}},
+    {0x3E8302, {   -1,    -1,   752,    -1,    -1}},
+    {0x3E8304, {   -1,    -1,   997,    -1,    -1}},
+    {0x3E8306, {   -1,    -1,  1180,    -1,    -1}},
+    {0x3E8308, {   -1,    -1,  1328,    -1,    -1}},
+    {0x3E830A, {   -1,    -1,  1454,    -1,    -1}},
+    {0x3E830C, {   -1,    -1,  1552,    -1,    -1}},
+    {0x3E830E, {   -1,    -1,  1621,    -1,    -1}},
+    {0x3E8310, {   -1,    -1,  1952,    -1,    -1}},
+    {0x3E8312, {   -1,    -1,  2200,    -1,    -1}},
+    {0x3E8314, {   -1,    -1,  2337,    -1,    -1}},
+    {0x3E8316, {   -1,    -1,  2428,    -1,    -1}},
+    {0x3E83F2, {   -1,    -1,    -1,   238,    -1}},
+    {0x3E8400, {   -1,    -1,   509,    -1,    -1}},
+    {0x3E8402, {   -1,    -1,   845,    -1,    -1}},
+    {0x3E8404, {   -1,    -1,  1066,    -1,    -1}},
+    {0x3E8406, {   -1,    -1,  1237,    -1,    -1}},
+    {0x3E8408, {   -1,    -1,  1378,    -1,    -1}},
+    {0x3E840A, {   -1,    -1,  1497,    -1,    -1}},
+    {0x3E840C, {   -1,    -1,  1583,    -1,    -1}},
+    {0x3E840E, {   -1,    -1,  1645,    -1,    -1}},
+    {0x3E8410, {   -1,    -1,  2060,    -1,    -1}},
+    {0x3E8412, {   -1,    -1,  2266,    -1,    -1}},
+    {0x3E8414, {   -1,    -1,  2380,    -1,    -1}},
+    {0x3E8416, {   -1,    -1,  2459,    -1,    -1}},
+    {0x3E8418, {   -1,    -1,  2519,    -1,    -1}},
+    {0x3E841A, {   -1,    -1,  2557,    -1,    -1}},
+    {0x3E841C, {   -1,    -1,  2585,    -1,    -1}},
+    {0x3E841E, {   -1,    -1,  2609,    -1,    -1}},
+    {0x3E8420, {   -1,    -1,  2845,    -1,    -1}},
+    {0x3E8422, {   -1,    -1,  2960,    -1,    -1}},
+    {0x3E8424, {   -1,    -1,  3028,    -1,    -1}},
+    {0x3E8426, {   -1,    -1,  3079,    -1,    -1}},
+    {0x3E8428, {   -1,    -1,  3112,    -1,    -1}},
+    {0x3E842A, {   -1,    -1,  3139,    -1,    -1}},
+    {0x3E842C, {   -1,    -1,  3166,    -1,    -1}},
+    {0x3E842E, {   -1,    -1,  3192,    -1,    -1}},
+    {0x3E8430, {   -1,    -1,  3326,    -1,    -1}},
+    {0x3E8432, {   -1,    -1,  3388,    -1,    -1}},
+    {0x3E8434, {   -1,    -1,  3432,    -1,    -1}},
+    {0x3E8436, {   -1,    -1,  3461,    -1,    -1}},
+    {0x3E8438, {   -1,    -1,  3483,    -1,    -1}},
+    {0x3E843A, {   -1,    -1,  3499,    -1,    -1}},
+    {0x3E843C, {   -1,    -1,  3514,    -1,    -1}},
+    {0x3E843E, {   -1,    -1,  3529,    -1,    -1}},
+    {0x3E8440, {   -1,    -1,  3603,    -1,    -1}},
+    {0x3E84F2, {   -1,    -1,    -1,   246,    -1}},
+    {0x3E85F2, {   -1,    -1,    -1,   250,    -1}},
+    {0x3E86F2, {   -1,    -1,    -1,   252,    -1}},
+    {0x3E87F2, {   -1,    -1,    -1,   253,    -1}},
+    {0x3E88F2, {   -1,    -1,    -1,   254,    -1}},
+    {0x3E8901, {   -1,    -1,  4369,    -1,    -1}},
+    {0x3E8907, {   -1,    -1,  7276,    -1,    -1}},
+    {0x3E8909, {   -1,    -1,  8872,    -1,    -1}},
+    {0x3E89F2, {   -1,    -1,    -1,   255,    -1}},
+    {0x3E9801, {   -1,    -1,  4659,    -1,    -1}},
+    {0x3E9809, {   -1,    -1,  9162,    -1,    -1}},
+    {0x3EA001, {   -1,    -1,  5021,    -1,    -1}},
+    {0x3EA007, {   -1,    -1,  7777,    -1,    -1}},
+    {0x3EA009, {   -1,    -1,  9524,    -1,    -1}},
+    {0x3EA801, {   -1,    -1,  5187,    -1,    -1}},
+    {0x3EA809, {   -1,    -1,  9690,    -1,    -1}},
+    {0x3EFE00, { 1030,    -1,    -1,    -1,    -1}},
+    {0x3EFF00, { 1158,    -1,    -1,    -1,    -1}},
+    {0x3F0000, {   -1,    -1,    -1,    -1,   126}},
+    {0x3F0002, {   -1,    14,   603,    -1,    -1}},
+    {0x3F0004, {   -1,    22,   915,    -1,    -1}},
+    {0x3F0006, {   -1,    28,  1124,    -1,    -1}},
+    {0x3F0007, {   -1,    -1,  7079,    -1,    -1}},
+    {0x3F0008, {   -1,    33,  1288,    -1,    -1}},
+    {0x3F0009, {   -1,    -1,  8507,    -1,    -1}},
+    {0x3F000A, {   -1,    37,  1422,    -1,    -1}},
+    {0x3F000C, {   -1,    -1,  1530,    -1,    -1}},
+    {0x3F000E, {   -1,    -1,  1609,    -1,    -1}},
+    {0x3F0010, {   -1,    -1,  1754,    -1,    -1}},
+    {0x3F0012, {   -1,    -1,  2128,    -1,    -1}},
+    {0x3F0020, {   -1,    -1,  2677,    -1,    -1}},
+    {0x3F0022, {   -1,    -1,  2886,    -1,    -1}},
+    {0x3F0024, {   -1,    -1,  2985,    -1,    -1}},
+    {0x3F0026, {   -1,    -1,  3049,    -1,    -1}},
+    {0x3F0028, {   -1,    -1,  3094,    -1,    -1}},
+    {0x3F002C, {   -1,    -1,  3152,    -1,    -1}},
+    {0x3F002E, {   -1,    -1,  3179,    -1,    -1}},
+    {0x3F0030, {   -1,    -1,  3237,    -1,    -1}},
+    {0x3F0032, {   -1,    -1,  3350,    -1,    -1}},
+    {0x3F0034, {   -1,    -1,  3408,    -1,    -1}},
+    {0x3F00F2, {   -1,    -1,    -1,   126,    -1}},
+    {0x3F0100, {   -1,    -1,   126,    -1,    -1}},
+    {0x3F0101, {   -1,    -1,  4122,    -1,    -1}},
+    {0x3F0102, {   -1,    -1,   619,    -1,    -1}},
+    {0x3F0104, {   -1,    -1,   923,    -1,    -1}},
+    {0x3F0106, {   -1,    -1,  1130,    -1,    -1}},
+    {0x3F0108, {   -1,    -1,  1293,    -1,    -1}},
+    {0x3F0109, {   -1,    -1,  8625,    -1,    -1}},
+    {0x3F010A, {   -1,    -1,  1427,    -1,    -1}},
+    {0x3F01F2, {   -1,    -1,    -1,   190,    -1}},
+    {0x3F01FE, {   -1,    -1,  4004,    -1,    -1}},
+    {0x3F0200, {   -1,    -1,   254,    -1,    -1}},
+    {0x3F0202, {   -1,    -1,   673,    -1,    -1}},
+    {0x3F0204, {   -1,    -1,   948,    -1,    -1}},
+    {0x3F0206, {   -1,    -1,  1145,    -1,    -1}},
+    {0x3F0208, {   -1,    -1,  1306,    -1,    -1}},
+    {0x3F020A, {   -1,    -1,  1439,    -1,    -1}},
+    {0x3F020C, {   -1,    -1,  1540,    -1,    -1}},
+    {0x3F02F2, {   -1,    -1,    -1,   221,    -1}},
+    {0x3F0300, {   -1,    -1,   382,    -1,    -1}},
+    {0x3F0302, {   -1,    -1,   753,    -1,    -1}},
+    {0x3F0304, {   -1,    -1,   998,    -1,    -1}},
+    {0x3F0306, {   -1,    -1,  1181,    -1,    -1}},
+    {0x3F0308, {   -1,    -1,  1329,    -1,    -1}},
+    {0x3F030A, {   -1,    -1,  1455,    -1,    -1}},
+    {0x3F030C, {   -1,    -1,  1553,    -1,    -1}},
+    {0x3F030E, {   -1,    -1,  1622,    -1,    -1}},
+    {0x3F0310, {   -1,    -1,  1953,    -1,    -1}},
+    {0x3F0320, {   -1,    -1,  2778,    -1,    -1}},
+    {0x3F0322, {   -1,    -1,  2921,    -1,    -1}},
+    {0x3F0324, {   -1,    -1,  3005,    -1,    -1}},
+    {0x3F0326, {   -1,    -1,  3060,    -1,    -1}},
+    {0x3F0328, {   -1,    -1,  3099,    -1,    -1}},
+    {0x3F03F2, {   -1,    -1,    -1,   239,    -1}},
+    {0x3F0400, {   -1,    -1,   510,    -1,    -1}},
+    {0x3F0402, {   -1,    -1,   846,    -1,    -1}},
+    {0x3F0404, {   -1,    -1,  1067,    -1,    -1}},
+    {0x3F0406, {   -1,    -1,  1238,    -1,    -1}},
+    {0x3F0408, {   -1,    -1,  1379,    -1,    -1}},
+    {0x3F040A, {   -1,    -1,  1498,    -1,    -1}},
+    {0x3F040C, {   -1,    -1,  1584,    -1,    -1}},
+    {0x3F040E, {   -1,    -1,  1646,    -1,    -1}},
+    {0x3F0410, {   -1,    -1,  2061,    -1,    -1}},
+    {0x3F0412, {   -1,    -1,  2267,    -1,    -1}},
+    {0x3F0420, {   -1,    -1,  2846,    -1,    -1}},
+    {0x3F0422, {   -1,    -1,  2961,    -1,    -1}},
+    {0x3F0424, {   -1,    -1,  3029,    -1,    -1}},
+    {0x3F0426, {   -1,    -1,  3080,    -1,    -1}},
+    {0x3F0428, {   -1,    -1,  3113,    -1,    -1}},
+    {0x3F042C, {   -1,    -1,  3167,    -1,    -1}},
+    {0x3F042E, {   -1,    -1,  3193,    -1,    -1}},
+    {0x3F0430, {   -1,    -1,  3327,    -1,    -1}},
+    {0x3F0432, {   -1,    -1,  3389,    -1,    -1}},
+    {0x3F0434, {   -1,    -1,  3433,    -1,    -1}},
+    {0x3F04F2, {   -1,    -1,    -1,   247,    -1}},
+    {0x3F05F2, {   -1,    -1,    -1,   251,    -1}},
+    {0x3F0901, {   -1,    -1,  4370,    -1,    -1}},
+    {0x3F0907, {   -1,    -1,  7277,    -1,    -1}},
+    {0x3F0909, {   -1,    -1,  8873,    -1,    -1}},
+    {0x3F1801, {   -1,    -1,  4660,    -1,    -1}},
+    {0x3F1809, {   -1,    -1,  9163,    -1,    -1}},
+    {0x3F2001, {   -1,    -1,  5022,    -1,    -1}},
+    {0x3F2007, {   -1,    -1,  7778,    -1,    -1}},
+    {0x3F2009, {   -1,    -1,  9525,    -1,    -1}},
+    {0x3F2801, {   -1,    -1,  5188,    -1,    -1}},
+    {0x3F2809, {   -1,    -1,  9691,    -1,    -1}},
+    {0x3F7E00, { 1031,    -1,    -1,    -1,    -1}},
+    {0x3F7F00, { 1159,    -1,    -1,    -1,    -1}},
+    {0x3F8000, {   -1,    -1,    -1,    -1,   127}},
+    {0x3F8002, {   -1,    15,   604,    -1,    -1}},
+    {0x3F8004, {   -1,    23,   916,    -1,    -1}},
+    {0x3F8006, {   -1,    29,  1125,    -1,    -1}},
+    {0x3F8007, {   -1,    -1,  7080,    -1,    -1}},
+    {0x3F8008, {   -1,    -1,  1289,    -1,    -1}},
+    {0x3F8009, {   -1,    -1,  8508,    -1,    -1}},
+    {0x3F800A, {   -1,    -1,  1423,    -1,    -1}},
+    {0x3F800C, {   -1,    -1,  1531,    -1,    -1}},
+    {0x3F80F2, {   -1,    -1,    -1,   127,    -1}},
+    {0x3F8100, {   -1,    -1,   127,    -1,    -1}},
+    {0x3F8101, {   -1,    -1,  4123,    -1,    -1}},
+    {0x3F8102, {   -1,    -1,   620,    -1,    -1}},
+    {0x3F8104, {   -1,    -1,   924,    -1,    -1}},
+    {0x3F8106, {   -1,    -1,  1131,    -1,    -1}},
+    {0x3F8109, {   -1,    -1,  8626,    -1,    -1}},
+    {0x3F81F2, {   -1,    -1,    -1,   191,    -1}},
+    {0x3F81FE, {   -1,    -1,  4005,    -1,    -1}},
+    {0x3F8200, {   -1,    -1,   255,    -1,    -1}},
+    {0x3F8202, {   -1,    -1,   674,    -1,    -1}},
+    {0x3F8204, {   -1,    -1,   949,    -1,    -1}},
+    {0x3F8206, {   -1,    -1,  1146,    -1,    -1}},
+    {0x3F82F2, {   -1,    -1,    -1,   222,    -1}},
+    {0x3F8300, {   -1,    -1,   383,    -1,    -1}},
+    {0x3F8302, {   -1,    -1,   754,    -1,    -1}},
+    {0x3F8304, {   -1,    -1,   999,    -1,    -1}},
+    {0x3F8306, {   -1,    -1,  1182,    -1,    -1}},
+    {0x3F8308, {   -1,    -1,  1330,    -1,    -1}},
+    {0x3F830A, {   -1,    -1,  1456,    -1,    -1}},
+    {0x3F83F2, {   -1,    -1,    -1,   240,    -1}},
+    {0x3F8400, {   -1,    -1,   511,    -1,    -1}},
+    {0x3F8402, {   -1,    -1,   847,    -1,    -1}},
+    {0x3F8404, {   -1,    -1,  1068,    -1,    -1}},
+    {0x3F8406, {   -1,    -1,  1239,    -1,    -1}},
+    {0x3F8408, {   -1,    -1,  1380,    -1,    -1}},
+    {0x3F840A, {   -1,    -1,  1499,    -1,    -1}},
+    {0x3F840C, {   -1,    -1,  1585,    -1,    -1}},
+    {0x3F8901, {   -1,    -1,  4371,    -1,    -1}},
+    {0x3F8907, {   -1,    -1,  7278,    -1,    -1}},
+    {0x3F8909, {   -1,    -1,  8874,    -1,    -1}},
+    {0x3F9801, {   -1,    -1,  4661,    -1,    -1}},
+    {0x3F9809, {   -1,    -1,  9164,    -1,    -1}},
+    {0x3FA001, {   -1,    -1,  5023,    -1,    -1}},
+    {0x3FA007, {   -1,    -1,  7779,    -1,    -1}},
+    {0x3FA009, {   -1,    -1,  9526,    -1,    -1}},
+    {0x3FA801, {   -1,    -1,  5189,    -1,    -1}},
+    {0x3FA809, {   -1,    -1,  9692,    -1,    -1}},
+    {0x3FFE00, { 1032,    -1,    -1,    -1,    -1}},
+    {0x3FFF00, { 1160,    -1,    -1,    -1,    -1}},
+    {0x400000, {   -1,    -1,    -1,    -1,     0}},
+    {0x400001, { 1541,    -1,    -1,    -1,   128}},
+    {0x400002, {   -1,     0,   512,    -1,    -1}},
+    {0x400003, { 1320,    -1,  6274,    -1,    -1}},
+    {0x400004, {   -1,    16,   848,    -1,    -1}},
+    {0x400005, {   -1,    -1,  6523,    -1,    -1}},
+    {0x400006, {   -1,    24,  1069,    -1,    -1}},
+    {0x400007, {   -1,    -1,  6963,    -1,    -1}},
+    {0x400008, {   -1,    30,  1240,    -1,    -1}},
+    {0x400009, {   -1,    -1,  8387,    -1,    -1}},
+    {0x40000A, {   -1,    34,  1381,    -1,    -1}},
+    {0x40000C, {   -1,    38,  1500,    -1,    -1}},
+    {0x40000E, {   -1,    39,  1586,    -1,    -1}},
+    {0x400010, {   -1,    40,  1647,    -1,    -1}},
+    {0x400012, {   -1,    77,  2062,    -1,    -1}},
+    {0x400014, {   -1,    -1,  2268,    -1,    -1}},
+    {0x400016, {   -1,    -1,  2381,    -1,    -1}},
+    {0x400018, {   -1,    -1,  2460,    -1,    -1}},
+    {0x40001A, {   -1,    -1,  2520,    -1,    -1}},
+    {0x40001C, {   -1,    -1,  2558,    -1,    -1}},
+    {0x40001E, {   -1,    -1,  2586,    -1,    -1}},
+    {0x400020, {   -1,    80,  2610,    -1,    -1}},
+    {0x400022, {   -1,    -1,  2847,    -1,    -1}},
+    {0x400024, {   -1,    -1,  2962,    -1,    -1}},
+    {0x400026, {   -1,    -1,  3030,    -1,    -1}},
+    {0x400028, {   -1,    -1,  3081,    -1,    -1}},
+    {0x40002A, {   -1,    -1,  3114,    -1,    -1}},
+    {0x40002C, {   -1,    -1,  3140,    -1,    -1}},
+    {0x40002E, {   -1,    -1,  3168,    -1,    -1}},
+    {0x400030, {   -1,    92,  3194,    -1,    -1}},
+    {0x400032, {   -1,    -1,  3328,    -1,    -1}},
+    {0x400034, {   -1,    -1,  3390,    -1,    -1}},
+    {0x400036, {   -1,    -1,  3434,    -1,    -1}},
+    {0x400038, {   -1,    -1,  3462,    -1,    -1}},
+    {0x40003A, {   -1,    -1,  3484,    -1,    -1}},
+    {0x40003C, {   -1,    -1,  3500,    -1,    -1}},
+    {0x40003E, {   -1,    -1,  3515,    -1,    -1}},
+    {0x400040, {   -1,    94,  3530,    -1,    -1}},
+    {0x400042, {   -1,    -1,  3604,    -1,    -1}},
+    {0x400044, {   -1,    -1,  3640,    -1,    -1}},
+    {0x400046, {   -1,    -1,  3657,    -1,    -1}},
+    {0x400048, {   -1,    -1,  3677,    -1,    -1}},
+    {0x40004A, {   -1,    -1,  3691,    -1,    -1}},
+    {0x40004C, {   -1,    -1,  3701,    -1,    -1}},
+    {0x40004E, {   -1,    -1,  3709,    -1,    -1}},
+    {0x400050, {   -1,    -1,  3715,    -1,    -1}},
+    {0x400052, {   -1,    -1,  3746,    -1,    -1}},
+    {0x400054, {   -1,    -1,  3763,    -1,    -1}},
+    {0x400056, {   -1,    -1,  3780,    -1,    -1}},
+    {0x400058, {   -1,    -1,  3791,    -1,    -1}},
+    {0x40005A, {   -1,    -1,  3800,    -1,    -1}},
+    {0x40005C, {   -1,    -1,  3805,    -1,    -1}},
+    {0x40005E, {   -1,    -1,  3809,    -1,    -1}},
+    {0x400060, { 1161,    -1,  3811,    -1,    -1}},
+    {0x400080, { 1262,    -1,    -1,    -1,    -1}},
+    {0x4000F1, {   -1,    -1,    -1,   256,    -1}},
+    {0x4000F2, {   -1,    -1,    -1,     0,    -1}},
+    {0x400100, {    0,    -1,     0,    -1,    -1}},
+    {0x400101, { 1560,    -1,  4006,    -1,    -1}},
+    {0x400102, {   -1,    -1,   605,    -1,    -1}},
+    {0x400103, { 1344,    -1,    -1,    -1,    -1}},
+    {0x400104, {   -1,    -1,   917,    -1,    -1}},
+    {0x400105, {   -1,    -1,  6586,    -1,    -1}},
+    {0x400106, {   -1,    -1,  1126,    -1,    -1}},
+    {0x400107, {   -1,    -1,  7081,    -1,    -1}},
+    {0x400108, {   -1,    -1,  1290,    -1,    -1}},
+    {0x400109, {   -1,    -1,  8509,    -1,    -1}},
+    {0x40010A, {   -1,    -1,  1424,    -1,    -1}},
+    {0x40010C, {   -1,    -1,  1532,    -1,    -1}},
+    {0x40010E, {   -1,    -1,  1610,    -1,    -1}},
+    {0x400110, {   -1,    -1,  1755,    -1,    -1}},
+    {0x400112, {   -1,    -1,  2129,    -1,    -1}},
+    {0x400120, {   -1,    -1,  2678,    -1,    -1}},
+    {0x400130, {   -1,    -1,  3238,    -1,    -1}},
+    {0x400140, {   -1,    -1,  3555,    -1,    -1}},
+    {0x4001F2, {   -1,    -1,    -1,   128,    -1}},
+    {0x4001FC, {   -1,    -1,  3814,    -1,    -1}},
+    {0x4001FE, {   -1,    -1,  3878,    -1,    -1}},
+    {0x400200, {   -1,    -1,   128,    -1,    -1}},
+    {0x400201, { 1567,    -1,  4124,    -1,    -1}},
+    {0x400202, {   -1,    -1,   621,    -1,    -1}},
+    {0x400204, {   -1,    -1,   925,    -1,    -1}},
+    {0x400206, {   -1,    -1,  1132,    -1,    -1}},
+    {0x400207, {   -1,    -1,  7108,    -1,    -1}},
+    {0x400208, {   -1,    -1,  1294,    -1,    -1}},
+    {0x400209, {   -1,    -1,  8627,    -1,    -1}},
+    {0x40020A, {   -1,    -1,  1428,    -1,    -1}},
+    {0x40020C, {   -1,    -1,  1533,    -1,    -1}},
+    {0x40020E, {   -1,    -1,  1611,    -1,    -1}},
+    {0x400210, {   -1,    -1,  1792,    -1,    -1}},
+    {0x400212, {   -1,    -1,  2132,    -1,    -1}},
+    {0x400214, {   -1,    -1,  2311,    -1,    -1}},
+    {0x400216, {   -1,    -1,  2412,    -1,    -1}},
+    {0x400220, {   -1,    -1,  2690,    -1,    -1}},
+    {0x400222, {   -1,    -1,  2887,    -1,    -1}},
+    {0x400224, {   -1,    -1,  2986,    -1,    -1}},
+    {0x400226, {   -1,    -1,  3050,    -1,    -1}},
+    {0x400230, {   -1,    -1,  3240,    -1,    -1}},
+    {0x400232, {   -1,    -1,  3351,    -1,    -1}},
+    {0x400234, {   -1,    -1,  3409,    -1,    -1}},
+    {0x400240, {   -1,    -1,  3559,    -1,    -1}},
+    {0x400242, {   -1,    -1,  3618,    -1,    -1}},
+    {0x400250, {   -1,    -1,  3728,    -1,    -1}},
+    {0x4002F2, {   -1,    -1,    -1,   192,    -1}},
+    {0x400300, {   10,    -1,   256,    -1,    -1}},
+    {0x400301, { 1607,    -1,    -1,    -1,    -1}},
+    {0x400302, {   -1,    -1,   675,    -1,    -1}},
+    {0x400304, {   -1,    -1,   950,    -1,    -1}},
+    {0x400306, {   -1,    -1,  1147,    -1,    -1}},
+    {0x400308, {   -1,    -1,  1307,    -1,    -1}},
+    {0x40030A, {   -1,    -1,  1440,    -1,    -1}},
+    {0x40030C, {   -1,    -1,  1541,    -1,    -1}},
+    {0x40030E, {   -1,    -1,  1615,    -1,    -1}},
+    {0x400310, {   -1,    -1,  1855,    -1,    -1}},
+    {0x400312, {   -1,    -1,  2151,    -1,    -1}},
+    {0x400314, {   -1,    -1,  2317,    -1,    -1}},
+    {0x400316, {   -1,    -1,  2414,    -1,    -1}},
+    {0x400318, {   -1,    -1,  2486,    -1,    -1}},
+    {0x40031A, {   -1,    -1,  2537,    -1,    -1}},
+    {0x40031C, {   -1,    -1,  2571,    -1,    -1}},
+    {0x40031E, {   -1,    -1,  2597,    -1,    -1}},
+    {0x400320, {   -1,    -1,  2719,    -1,    -1}},
+    {0x400322, {   -1,    -1,  2894,    -1,    -1}},
+    {0x400324, {   -1,    -1,  2990,    -1,    -1}},
+    {0x400326, {   -1,    -1,  3052,    -1,    -1}},
+    {0x400328, {   -1,    -1,  3095,    -1,    -1}},
+    {0x40032A, {   -1,    -1,  3126,    -1,    -1}},
+    {0x40032C, {   -1,    -1,  3153,    -1,    -1}},
+    {0x40032E, {   -1,    -1,  3180,    -1,    -1}},
+    {0x400330, {   -1,    -1,  3253,    -1,    -1}},
+    {0x400332, {   -1,    -1,  3355,    -1,    -1}},
+    {0x400334, {   -1,    -1,  3410,    -1,    -1}},
+    {0x400336, {   -1,    -1,  3446,    -1,    -1}},
+    {0x400338, {   -1,    -1,  3471,    -1,    -1}},
+    {0x40033A, {   -1,    -1,  3491,    -1,    -1}},
+    {0x40033C, {   -1,    -1,  3507,    -1,    -1}},
+    {0x40033E, {   -1,    -1,  3522,    -1,    -1}},
+    {0x400340, {   -1,    -1,  3565,    -1,    -1}},
+    {0x400342, {   -1,    -1,  3619,    -1,    -1}},
+    {0x400344, {   -1,    -1,  3648,    -1,    -1}},
+    {0x400346, {   -1,    -1,  3666,    -1,    -1}},
+    {0x400350, {   -1,    -1,  3730,    -1,    -1}},
+    {0x400352, {   -1,    -1,  3754,    -1,    -1}},
+    {0x400354, {   -1,    -1,  3771,    -1,    -1}},
+    {0x400356, {   -1,    -1,  3785,    -1,    -1}},
+    {0x400358, {   -1,    -1,  3795,    -1,    -1}},
+    {0x40035A, {   -1,    -1,  3802,    -1,    -1}},
+    {0x400360, {   -1,    -1,  3812,    -1,    -1}},
+    {0x4003F2, {   -1,    -1,    -1,   223,    -1}},
+    {0x400400, {   -1,    -1,   384,    -1,    -1}},
+    {0x400401, { 1679,    -1,    -1,    -1,    -1}},
+    {0x400402, {   -1,    -1,   755,    -1,    -1}},
+    {0x400404, {   -1,    -1,  1000,    -1,    -1}},
+    {0x400406, {   -1,    -1,  1183,    -1,    -1}},
+    {0x400408, {   -1,    -1,  1331,    -1,    -1}},
+    {0x40040A, {   -1,    -1,  1457,    -1,    -1}},
+    {0x40040C, {   -1,    -1,  1554,    -1,    -1}},
+    {0x40040E, {   -1,    -1,  1623,    -1,    -1}},
+    {0x400410, {   -1,    -1,  1954,    -1,    -1}},
+    {0x400412, {   -1,    -1,  2201,    -1,    -1}},
+    {0x400414, {   -1,    -1,  2338,    -1,    -1}},
+    {0x400416, {   -1,    -1,  2429,    -1,    -1}},
+    {0x400418, {   -1,    -1,  2494,    -1,    -1}},
+    {0x40041A, {   -1,    -1,  2541,    -1,    -1}},
+    {0x40041C, {   -1,    -1,  2573,    -1,    -1}},
+    {0x40041E, {   -1,    -1,  2599,    -1,    -1}},
+    {0x400420, {   -1,    -1,  2779,    -1,    -1}},
+    {0x400422, {   -1,    -1,  2922,    -1,    -1}},
+    {0x400424, {   -1,    -1,  3006,    -1,    -1}},
+    {0x400426, {   -1,    -1,  3061,    -1,    -1}},
+    {0x400428, {   -1,    -1,  3100,    -1,    -1}},
+    {0x40042A, {   -1,    -1,  3128,    -1,    -1}},
+    {0x40042C, {   -1,    -1,  3155,    -1,    -1}},
+    {0x40042E, {   -1,    -1,  3182,    -1,    -1}},
+    {0x400430, {   -1,    -1,  3284,    -1,    -1}},
+    {0x400432, {   -1,    -1,  3367,    -1,    -1}},
+    {0x400434, {   -1,    -1,  3415,    -1,    -1}},
+    {0x400436, {   -1,    -1,  3450,    -1,    -1}},
+    {0x400438, {   -1,    -1,  3475,    -1,    -1}},
+    {0x40043A, {   -1,    -1,  3493,    -1,    -1}},
+    {0x40043C, {   -1,    -1,  3508,    -1,    -1}},
+    {0x40043E, {   -1,    -1,  3523,    -1,    -1}},
+    {0x400440, {   -1,    -1,  3579,    -1,    -1}},
+    {0x400442, {   -1,    -1,  3626,    -1,    -1}},
+    {0x400444, {   -1,    -1,  3649,    -1,    -1}},
+    {0x400446, {   -1,    -1,  3668,    -1,    -1}},
+    {0x400448, {   -1,    -1,  3684,    -1,    -1}},
+    {0x40044A, {   -1,    -1,  3696,    -1,    -1}},
+    {0x40044C, {   -1,    -1,  3705,    -1,    -1}},
+    {0x40044E, {   -1,    -1,  3712,    -1,    -1}},
+    {0x400450, {   -1,    -1,  3733,    -1,    -1}},
+    {0x400452, {   -1,    -1,  3755,    -1,    -1}},
+    {0x400454, {   -1,    -1,  3772,    -1,    -1}},
+    {0x400456, {   -1,    -1,  3786,    -1,    -1}},
+    {0x400458, {   -1,    -1,  3796,    -1,    -1}},
+    {0x40045A, {   -1,    -1,  3803,    -1,    -1}},
+    {0x40045C, {   -1,    -1,  3807,    -1,    -1}},
+    {0x40045E, {   -1,    -1,  3810,    -1,    -1}},
+    {0x400460, {   -1,    -1,  3813,    -1,    -1}},
+    {0x4004F2, {   -1,    -1,    -1,   241,    -1}},
+    {0x400501, { 1728,    -1,    -1,    -1,    -1}},
+    {0x4005F2, {   -1,    -1,    -1,   248,    -1}},
+    {0x400600, {   16,    -1,    -1,    -1,    -1}},
+    {0x400601, { 1776,    -1,    -1,    -1,    -1}},
+    {0x4006F2, {   -1,    -1,    -1,   252,    -1}},
+    {0x400701, { 1822,    -1,    -1,    -1,    -1}},
+    {0x4007F2, {   -1,    -1,    -1,   253,    -1}},
+    {0x400800, {   21,    -1,    -1,    -1,    -1}},
+    {0x400801, { 1869,    98,  4218,    -1,    -1}},
+    {0x400803, {   -1,    -1,  6335,    -1,    -1}},
+    {0x400805, {   -1,    -1,  6593,    -1,    -1}},
+    {0x400807, {   -1,    -1,  7135,    -1,    -1}},
+    {0x400809, {   -1,    -1,  8721,    -1,    -1}},
+    {0x400860, { 1163,    -1,    -1,    -1,    -1}},
+    {0x4008F1, {   -1,    -1,    -1,   317,    -1}},
+    {0x4008F2, {   -1,    -1,    -1,   254,    -1}},
+    {0x400901, { 1878,    -1,  4244,    -1,    -1}},
+    {0x400907, {   -1,    -1,  7161,    -1,    -1}},
+    {0x400909, {   -1,    -1,  8747,    -1,    -1}},
+    {0x4009F2, {   -1,    -1,    -1,   255,    -1}},
+    {0x400A01, {   -1,    -1,  4372,    -1,    -1}},
+    {0x400A07, {   -1,    -1,  7279,    -1,    -1}},
+    {0x400A09, {   -1,    -1,  8875,    -1,    -1}},
+    {0x400B01, {   -1,    -1,  4415,    -1,    -1}},
+    {0x400B07, {   -1,    -1,  7313,    -1,    -1}},
+    {0x400B09, {   -1,    -1,  8918,    -1,    -1}},
+    {0x400C00, {   31,    -1,    -1,    -1,    -1}},
+    {0x400C01, {   -1,    -1,  4465,    -1,    -1}},
+    {0x400C09, {   -1,    -1,  8968,    -1,    -1}},
+    {0x400D01, {   -1,    -1,  4515,    -1,    -1}},
+    {0x400D09, {   -1,    -1,  9018,    -1,    -1}},
+    {0x400E00, {   37,    -1,    -1,    -1,    -1}},
+    {0x401000, {   41,    -1,    -1,    -1,    -1}},
+    {0x401001, { 1916,   104,  4565,    -1,    -1}},
+    {0x401003, { 1378,    -1,  6341,    -1,    -1}},
+    {0x401005, {   -1,    -1,  6605,    -1,    -1}},
+    {0x401007, {   -1,    -1,  7353,    -1,    -1}},
+    {0x401009, {   -1,    -1,  9068,    -1,    -1}},
+    {0x401060, { 1185,    -1,    -1,    -1,    -1}},
+    {0x4010F1, {   -1,    -1,    -1,   323,    -1}},
+    {0x401100, {   49,    -1,    -1,    -1,    -1}},
+    {0x401101, { 1928,    -1,    -1,    -1,    -1}},
+    {0x401103, { 1398,    -1,    -1,    -1,    -1}},
+    {0x401200, {   51,    -1,    -1,    -1,    -1}},
+    {0x401203, { 1437,    -1,    -1,    -1,    -1}},
+    {0x401300, {   67,    -1,    -1,    -1,    -1}},
+    {0x401400, {   71,    -1,    -1,    -1,    -1}},
+    {0x401462, { 1257,    -1,    -1,    -1,    -1}},
+    {0x401500, {   76,    -1,    -1,    -1,    -1}},
+    {0x401600, {   79,    -1,    -1,    -1,    -1}},
+    {0x401800, {   81,    -1,    -1,    -1,    -1}},
+    {0x401801, { 1968,   112,  4592,    -1,    -1}},
+    {0x401803, {   -1,    -1,  6349,    -1,    -1}},
+    {0x401805, {   -1,    -1,  6617,    -1,    -1}},
+    {0x401807, {   -1,    -1,  7379,    -1,    -1}},
+    {0x401809, {   -1,    -1,  9095,    -1,    -1}},
+    {0x401860, { 1199,    -1,    -1,    -1,    -1}},
+    {0x4018F1, {   -1,    -1,    -1,   331,    -1}},
+    {0x401900, {   88,    -1,    -1,    -1,    -1}},
+    {0x401901, { 1984,   122,  4662,    -1,    -1}},
+    {0x401903, {   -1,    -1,  6359,    -1,    -1}},
+    {0x401905, {   -1,    -1,  6632,    -1,    -1}},
+    {0x401907, {   -1,    -1,  7419,    -1,    -1}},
+    {0x401909, {   -1,    -1,  9165,    -1,    -1}},
+    {0x4019F1, {   -1,    -1,    -1,   341,    -1}},
+    {0x401A00, {   91,    -1,    -1,    -1,    -1}},
+    {0x401A01, { 2011,    -1,  4703,    -1,    -1}},
+    {0x401A05, {   -1,    -1,  6655,    -1,    -1}},
+    {0x401A07, {   -1,    -1,  7460,    -1,    -1}},
+    {0x401A09, {   -1,    -1,  9206,    -1,    -1}},
+    {0x401B00, {   92,    -1,    -1,    -1,    -1}},
+    {0x401B01, { 2058,    -1,  4747,    -1,    -1}},
+    {0x401B07, {   -1,    -1,  7501,    -1,    -1}},
+    {0x401B09, {   -1,    -1,  9250,    -1,    -1}},
+    {0x401C00, {  101,    -1,    -1,    -1,    -1}},
+    {0x401C01, { 2086,    -1,  4788,    -1,    -1}},
+    {0x401C07, {   -1,    -1,  7542,    -1,    -1}},
+    {0x401C09, {   -1,    -1,  9291,    -1,    -1}},
+    {0x401D00, {  104,    -1,    -1,    -1,    -1}},
+    {0x401D01, { 2129,    -1,  4829,    -1,    -1}},
+    {0x401D07, {   -1,    -1,  7583,    -1,    -1}},
+    {0x401D09, {   -1,    -1,  9332,    -1,    -1}},
+    {0x401E01, { 2173,    -1,  4870,    -1,    -1}},
+    {0x401E07, {   -1,    -1,  7624,    -1,    -1}},
+    {0x401E09, {   -1,    -1,  9373,    -1,    -1}},
+    {0x401F01, { 2220,    -1,    -1,    -1,    -1}},
+    {0x402000, {  106,    -1,    -1,    -1,    -1}},
+    {0x402001, { 2269,   141,  4905,    -1,    -1}},
+    {0x402003, { 1476,    -1,  6378,    -1,    -1}},
+    {0x402005, {   -1,    -1,  6675,    -1,    -1}},
+    {0x402007, {   -1,    -1,  7665,    -1,    -1}},
+    {0x402009, {   -1,    -1,  9408,    -1,    -1}},
+    {0x4020F1, {   -1,    -1,    -1,   360,    -1}},
+    {0x402100, {  132,    -1,    -1,    -1,    -1}},
+    {0x402101, { 2276,    -1,  5024,    -1,    -1}},
+    {0x402103, { 1499,    -1,    -1,    -1,    -1}},
+    {0x402109, {   -1,    -1,  9527,    -1,    -1}},
+    {0x402200, {  137,    -1,    -1,    -1,    -1}},
+    {0x402203, { 1522,    -1,    -1,    -1,    -1}},
+    {0x402300, {  140,    -1,    -1,    -1,    -1}},
+    {0x402400, {  158,    -1,    -1,    -1,    -1}},
+    {0x402500, {  162,    -1,    -1,    -1,    -1}},
+    {0x402600, {  166,    -1,    -1,    -1,    -1}},
+    {0x402700, {  168,    -1,    -1,    -1,    -1}},
+    {0x402800, {  172,    -1,    -1,    -1,    -1}},
+    {0x402801, { 2314,   143,  5075,    -1,    -1}},
+    {0x402803, {   -1,    -1,  6380,    -1,    -1}},
+    {0x402805, {   -1,    -1,  6682,    -1,    -1}},
+    {0x402807, {   -1,    -1,  7780,    -1,    -1}},
+    {0x402809, {   -1,    -1,  9578,    -1,    -1}},
+    {0x4028F1, {   -1,    -1,    -1,   362,    -1}},
+    {0x402900, {  220,    -1,    -1,    -1,    -1}},
+    {0x402901, { 2324,    -1,  5190,    -1,    -1}},
+    {0x402909, {   -1,    -1,  9693,    -1,    -1}},
+    {0x402A00, {  240,    -1,    -1,    -1,    -1}},
+    {0x402A01, {   -1,    -1,  5221,    -1,    -1}},
+    {0x402A09, {   -1,    -1,  9724,    -1,    -1}},
+    {0x402B00, {  249,    -1,    -1,    -1,    -1}},
+    {0x402D00, {  258,    -1,    -1,    -1,    -1}},
+    {0x403000, {  270,    -1,    -1,    -1,    -1}},
+    {0x403001, { 2355,   148,  5271,    -1,    -1}},
+    {0x403003, {   -1,    -1,  6385,    -1,    -1}},
+    {0x403005, {   -1,    -1,  6698,    -1,    -1}},
+    {0x403007, {   -1,    -1,  7807,    -1,    -1}},
+    {0x403009, {   -1,    -1,  9774,    -1,    -1}},
+    {0x4030F1, {   -1,    -1,    -1,   367,    -1}},
+    {0x403101, {   -1,    -1,  5375,    -1,    -1}},
+    {0x403105, {   -1,    -1,  6723,    -1,    -1}},
+    {0x403107, {   -1,    -1,  7911,    -1,    -1}},
+    {0x403109, {   -1,    -1,  9878,    -1,    -1}},
+    {0x403201, {   -1,    -1,  5450,    -1,    -1}},
+    {0x403205, {   -1,    -1,  6798,    -1,    -1}},
+    {0x403207, {   -1,    -1,  7986,    -1,    -1}},
+    {0x403209, {   -1,    -1,  9953,    -1,    -1}},
+    {0x403301, {   -1,    -1,  5537,    -1,    -1}},
+    {0x403309, {   -1,    -1, 10040,    -1,    -1}},
+    {0x403400, {  271,    -1,    -1,    -1,    -1}},
+    {0x403401, {   -1,    -1,  5624,    -1,    -1}},
+    {0x403407, {   -1,    -1,  8073,    -1,    -1}},
+    {0x403409, {   -1,    -1, 10127,    -1,    -1}},
+    {0x403500, {  274,    -1,    -1,    -1,    -1}},
+    {0x403501, {   -1,    -1,  5690,    -1,    -1}},
+    {0x403507, {   -1,    -1,  8137,    -1,    -1}},
+    {0x403509, {   -1,    -1, 10193,    -1,    -1}},
+    {0x403600, {  275,    -1,    -1,    -1,    -1}},
+    {0x403601, {   -1,    -1,  5755,    -1,    -1}},
+    {0x403609, {   -1,    -1, 10258,    -1,    -1}},
+    {0x403801, { 2370,   173,  5808,    -1,    -1}},
+    {0x403803, {   -1,    -1,  6410,    -1,    -1}},
+    {0x403805, {   -1,    -1,  6850,    -1,    -1}},
+    {0x403807, {   -1,    -1,  8202,    -1,    -1}},
+    {0x403809, {   -1,    -1, 10311,    -1,    -1}},
+    {0x403860, { 1209,    -1,    -1,    -1,    -1}},
+    {0x4038F1, {   -1,    -1,    -1,   392,    -1}},
+    {0x403901, { 2399,    -1,  5884,    -1,    -1}},
+    {0x403905, {   -1,    -1,  6910,    -1,    -1}},
+    {0x403907, {   -1,    -1,  8278,    -1,    -1}},
+    {0x403909, {   -1,    -1, 10387,    -1,    -1}},
+    {0x403A01, {   -1,    -1,  5937,    -1,    -1}},
+    {0x403A07, {   -1,    -1,  8331,    -1,    -1}},
+    {0x403A09, {   -1,    -1, 10440,    -1,    -1}},
+    {0x403B01, {   -1,    -1,  5993,    -1,    -1}},
+    {0x403B09, {   -1,    -1, 10496,    -1,    -1}},
+    {0x403C01, {   -1,    -1,  6096,    -1,    -1}},
+    {0x403C09, {   -1,    -1, 10599,    -1,    -1}},
+    {0x403D01, {   -1,    -1,  6156,    -1,    -1}},
+    {0x403D09, {   -1,    -1, 10659,    -1,    -1}},
+    {0x403E01, {   -1,    -1,  6209,    -1,    -1}},
+    {0x403E09, {   -1,    -1, 10712,    -1,    -1}},
+    {0x404000, {  276,    -1,    -1,    -1,    -1}},
+    {0x404001, { 2428,    -1,    -1,    -1,    -1}},
+    {0x404060, { 1211,    -1,    -1,    -1,    -1}},
+    {0x404100, {  372,    -1,    -1,    -1,    -1}},
+    {0x404101, { 2476,    -1,    -1,    -1,    -1}},
+    {0x404200, {  452,    -1,    -1,    -1,    -1}},
+    {0x404201, { 2524,    -1,    -1,    -1,    -1}},
+    {0x404300, {  521,    -1,    -1,    -1,    -1}},
+    {0x404400, {  577,    -1,    -1,    -1,    -1}},
+    {0x404500, {  614,    -1,    -1,    -1,    -1}},
+    {0x404600, {  645,    -1,    -1,    -1,    -1}},
+    {0x404700, {  674,    -1,    -1,    -1,    -1}},
+    {0x404800, {  698,    -1,    -1,    -1,    -1}},
+    {0x404860, { 1215,    -1,    -1,    -1,    -1}},
+    {0x404900, {  718,    -1,    -1,    -1,    -1}},
+    {0x404A00, {  736,    -1,    -1,    -1,    -1}},
+    {0x404B00, {  752,    -1,    -1,    -1,    -1}},
+    {0x404C00, {  766,    -1,    -1,    -1,    -1}},
+    {0x404D00, {  778,    -1,    -1,    -1,    -1}},
+    {0x404E00, {  788,    -1,    -1,    -1,    -1}},
+    {0x404F00, {  797,    -1,    -1,    -1,    -1}},
+    {0x405000, {  803,    -1,    -1,    -1,    -1}},
+    {0x405060, { 1234,    -1,    -1,    -1,    -1}},
+    {0x405100, {  808,    -1,    -1,    -1,    -1}},
+    {0x405200, {  812,    -1,    -1,    -1,    -1}},
+    {0x405300, {  815,    -1,    -1,    -1,    -1}},
+    {0x405400, {  818,    -1,    -1,    -1,    -1}},
+    {0x405500, {  821,    -1,    -1,    -1,    -1}},
+    {0x405600, {  824,    -1,    -1,    -1,    -1}},
+    {0x405700, {  826,    -1,    -1,    -1,    -1}},
+    {0x405800, {  828,    -1,    -1,    -1,    -1}},
+    {0x405860, { 1235,    -1,    -1,    -1,    -1}},
+    {0x405900, {  830,    -1,    -1,    -1,    -1}},
+    {0x405A00, {  832,    -1,    -1,    -1,    -1}},
+    {0x405B00, {  834,    -1,    -1,    -1,    -1}},
+    {0x405C00, {  836,    -1,    -1,    -1,    -1}},
+    {0x405D00, {  837,    -1,    -1,    -1,    -1}},
+    {0x405E00, {  838,    -1,    -1,    -1,    -1}},
+    {0x406000, {  839,    -1,    -1,    -1,    -1}},
+    {0x406060, { 1244,    -1,    -1,    -1,    -1}},
+    {0x406100, {  872,    -1,    -1,    -1,    -1}},
+    {0x406200, {  889,    -1,    -1,    -1,    -1}},
+    {0x406300, {  898,    -1,    -1,    -1,    -1}},
+    {0x406400, {  901,    -1,    -1,    -1,    -1}},
+    {0x406500, {  903,    -1,    -1,    -1,    -1}},
+    {0x406860, { 1249,    -1,    -1,    -1,    -1}},
+    {0x407860, { 1256,    -1,    -1,    -1,    -1}},
+    {0x407E00, {  905,    -1,    -1,    -1,    -1}},
+    {0x407E01, { 2572,    -1,    -1,    -1,    -1}},
+    {0x407F00, { 1033,    -1,    -1,    -1,    -1}},
+    {0x407F01, { 2591,    -1,    -1,    -1,    -1}},
+    {0x407F03, {   -1,    -1,  6456,    -1,    -1}},
+};
@@ -0,0 +1,182 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instruments_model.h"
+#include "ins_names.h"
+#include <QCoreApplication>
+#include <QBrush>
+
+InstrumentsModel::InstrumentsModel(QObject *parent) :
+    QAbstractListModel(parent),
+    m_midiSpec(kMidiSpecXG | kMidiSpecGM1)
+{}
+
+void InstrumentsModel::setBank(const FmBank *bank)
+{
+    beginResetModel();
+    m_bank = bank;
+    computeRange(m_first, m_count);
+    endResetModel();
+}
+
+void InstrumentsModel::setFilter(bool percussion, int midiBank, bool allBanks)
+{
+    beginResetModel();
+    m_percussion = percussion;
+    m_midiBank = midiBank;
+    m_allBanks = allBanks;
+    computeRange(m_first, m_count);
+    endResetModel();
+}
+
+void InstrumentsModel::setMidiSpec(unsigned spec)
+{
+    if(m_midiSpec == spec)
+        return;
+    m_midiSpec = spec;
+    refreshNames();
+}
+
+void InstrumentsModel::reload()
+{
+    int first, count;
+    computeRange(first, count);
+    if(first == m_first && count == m_count)
+    {
+        // Keep the selection and the scroll position
+        refreshNames();
+        return;
+    }
+
+    beginResetModel();
+    m_first = first;
+    m_count = count;
+    endResetModel();
+}
+
+void InstrumentsModel::refreshNames()
+{
+    if(m_count > 0)
+        emit dataChanged(index(0), index(m_count - 1));
+}
+
+void InstrumentsModel::instrumentChanged(int ins)
+{
+    QModelIndex mi = indexOfInstrument(ins);
+    if(mi.isValid())
+        emit dataChanged(mi, mi);
+}
+
+QModelIndex InstrumentsModel::indexOfInstrument(int ins) const
+{
+    int row = ins - m_first;
+    if(row < 0 || row >= m_count)
+        return QModelIndex();
+    return index(row);
+}
+
+int InstrumentsModel::instrumentIndex(const QModelIndex &index) const
+{
+    if(!index.isValid() || index.row() >= m_count)
+        return -1;
+    return m_first + index.row();
+}
+
+QString InstrumentsModel::defaultName(int ins) const
+{
+    uint8_t msb = 0, lsb = 0;
+    if(m_bank)
+    {
+        const QVector<FmBank::MidiBank> &banks = m_percussion ? m_bank->Banks_Percussion : m_bank->Banks_Melodic;
+        int b = ins / 128;
+        if(b < banks.size())
+        {
+            msb = banks[b].msb;
+            lsb = banks[b].lsb;
+        }
+    }
+
+    MidiProgramId pr = MidiProgramId(m_percussion, msb, lsb, ins % 128);
+    unsigned specObtained = kMidiSpecXG;
+    const MidiProgram *p = findMidiProgram(pr, m_midiSpec, &specObtained);
+    if(p)
+        return QString::fromUtf8(p->patchName);
+    return QCoreApplication::translate("BankEditor", "<Reserved %1>").arg(ins % 128);
+}
+
+int InstrumentsModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_count;
+}
+
+QVariant InstrumentsModel::data(const QModelIndex &index, int role) const
+{
+    int ins = instrumentIndex(index);
+    if(ins < 0)
+        return QVariant();
+
+    switch(role)
+    {
+    case Qt::DisplayRole:
+    {
+        const FmBank::Instrument &in = storage()->at(ins);
+        return in.name[0] != '\0' ? QString::fromUtf8(in.name) : defaultName(ins);
+    }
+    case Qt::ForegroundRole:
+        return QBrush(storage()->at(ins).is_blank ? Qt::gray : Qt::black);
+    case Qt::ToolTipRole:
+        return QCoreApplication::translate("QObject", "Bank %1, ID: %2").arg(ins / 128).arg(ins % 128);
+    case InstrumentIndexRole:
+        return ins;
+    case BankIdRole:
+        return ins / 128;
+    case InstrumentIdRole:
+        return ins % 128;
+    default:
+        return QVariant();
+    }
+}
+
+Qt::ItemFlags InstrumentsModel::flags(const QModelIndex &index) const
+{
+    if(!index.isValid())
+        return Qt::NoItemFlags;
+    return Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+}
+
+const FmBank::InsStorage *InstrumentsModel::storage() const
+{
+    return m_percussion ? &m_bank->Ins_Percussion_box : &m_bank->Ins_Melodic_box;
+}
+
+void InstrumentsModel::computeRange(int &first, int &count) const
+{
+    first = 0;
+    count = 0;
+    if(!m_bank)
+        return;
+
+    int total = storage()->size();
+    if(m_allBanks)
+        count = total;
+    else if(m_midiBank >= 0)
+    {
+        first = m_midiBank * 128;
+        count = qBound(0, total - first, 128);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INSTRUMENTS_MODEL_H
+#define INSTRUMENTS_MODEL_H
+
+#include <QAbstractListModel>
+#include "bank.h"
+
+/**
+ * @brief List of instruments of one MIDI bank (or of all banks) of the FM bank
+ *
+ * The model refers instruments of the bank directly and doesn't keep any
+ * per-instrument data: names are made on demand for visible rows only.
+ * The owner must call reload() when count of instruments has been changed
+ * and instrumentChanged() when a single instrument has been modified.
+ */
+class InstrumentsModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles
+    {
+        //! Index of the instrument in the storage
+        InstrumentIndexRole = Qt::UserRole,
+        //! Index of the MIDI bank
+        BankIdRole,
+        //! MIDI program number in the bank
+        InstrumentIdRole
+    };
+
+    explicit InstrumentsModel(QObject *parent = nullptr);
+
+    /**
+     * @brief Set the source bank
+     * @param bank Bank to show, must outlive the model
+     */
+    void setBank(const FmBank *bank);
+
+    /**
+     * @brief Select instruments to show
+     * @param percussion Show percussion instruments instead of melodic ones
+     * @param midiBank Index of the MIDI bank to show, nothing is shown if it's negative
+     * @param allBanks Show instruments of every MIDI bank
+     */
+    void setFilter(bool percussion, int midiBank, bool allBanks);
+
+    /**
+     * @brief Set the MIDI standard to name instruments which have no custom names
+     * @param spec Combination of MidiSpec flags
+     */
+    void setMidiSpec(unsigned spec);
+
+    inline bool isPercussion() const { return m_percussion; }
+
+    //! Re-read the whole bank, the selection is kept unless count of shown instruments has been changed
+    void reload();
+    //! Refresh names and states of all shown instruments
+    void refreshNames();
+    /**
+     * @brief Refresh the name and the state of the instrument
+     * @param index Index of the instrument in the storage
+     */
+    void instrumentChanged(int index);
+
+    /**
+     * @brief Model index of the instrument
+     * @param index Index of the instrument in the storage
+     * @return model index, or invalid one if instrument is not shown
+     */
+    QModelIndex indexOfInstrument(int index) const;
+
+    /**
+     * @brief Index of the instrument in the storage
+     * @param index Model index
+     * @return index of the instrument, or -1 for invalid model index
+     */
+    int instrumentIndex(const QModelIndex &index) const;
+
+    /**
+     * @brief Name of the instrument which has no custom name
+     * @param index Index of the instrument in the storage
+     */
+    QString defaultName(int index) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+private:
+    const FmBank::InsStorage *storage() const;
+    void computeRange(int &first, int &count) const;
+
+    const FmBank   *m_bank = nullptr;
+    bool            m_percussion = false;
+    int             m_midiBank = 0;
+    bool            m_allBanks = false;
+    unsigned        m_midiSpec;
+    //! First shown instrument
+    int             m_first = 0;
+    //! Count of shown instruments
+    int             m_count = 0;
+};
+
+#endif // INSTRUMENTS_MODEL_H
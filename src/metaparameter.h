@@ -24,13 +24,25 @@
 struct MetaParameter
 {
     typedef int (Get)(const FmBank::Instrument &);
+    typedef void (Set)(FmBank::Instrument &, int);
 
     MetaParameter() {}
-    MetaParameter(const char *name, Get *get, int min, int max, unsigned flags)
-        : name(name), get(get), min(min), max(max), flags(flags) {}
+    MetaParameter(const char *name, Get *get, Set *set, int min, int max, unsigned flags)
+        : name(name), get(get), set(set), min(min), max(max), flags(flags) {}
+
+    /**
+     * @brief Store the value into the instrument, clamped to the valid range
+     * @param ins Target instrument
+     * @param value New value
+     */
+    void setClamped(FmBank::Instrument &ins, int value) const
+    {
+        set(ins, (value < min) ? min : ((value > max) ? max : value));
+    }
 
     const char *const name = nullptr;
     Get *const get = nullptr;
+    Set *const set = nullptr;
     int min = 0;
     int max = 0;
     const unsigned flags = 0;
@@ -53,40 +65,45 @@ enum MetaParameterFlag
 static const MetaParameter MP_instrument[] =
 {
 #define G(x) (+[](const FmBank::Instrument &ins) -> int { return (x); })
+#define S(x) (+[](FmBank::Instrument &ins, int v) { (x); })
+#define GS(f, T) G(ins.f), S(ins.f = T(v))
 
-    {"4op", G(ins.en_4op), 0, 1, MP_None},
-    {"ps4op", G(ins.en_pseudo4op), 0, 1, MP_4OpOnly},
-    {"rhy", G(ins.rhythm_drum_type ? (ins.rhythm_drum_type - 5) : 0), 0, 5, MP_None},
-    {"con1", G(ins.connection1), 0, 1, MP_None},
-    {"fb1", G(ins.feedback1), 0, 7, MP_None},
-    {"con2", G(ins.connection2), 0, 1, MP_4OpOnly},
-    {"fb2", G(ins.feedback2), 0, 7, MP_4OpOnly},
+    {"4op", GS(en_4op, bool), 0, 1, MP_None},
+    {"ps4op", GS(en_pseudo4op, bool), 0, 1, MP_4OpOnly},
+    {"rhy", G(ins.rhythm_drum_type ? (ins.rhythm_drum_type - 5) : 0),
+            S(ins.rhythm_drum_type = uint8_t(v ? (v + 5) : 0)), 0, 5, MP_None},
+    {"con1", GS(connection1, bool), 0, 1, MP_None},
+    {"fb1", GS(feedback1, uint8_t), 0, 7, MP_None},
+    {"con2", GS(connection2, bool), 0, 1, MP_4OpOnly},
+    {"fb2", GS(feedback2, uint8_t), 0, 7, MP_4OpOnly},
 #define OP(n, flags)                                                           \
-    {"ar", G(ins.OP[n].attack), 0, 15, (flags)}, \
-    {"dr", G(ins.OP[n].decay), 0, 15, (flags)}, \
-    {"sl", G(ins.OP[n].sustain), 0, 15, (flags)}, \
-    {"rr", G(ins.OP[n].release), 0, 15, (flags)}, \
-    {"wf", G(ins.OP[n].waveform), 0, 7, (flags)}, \
-    {"tl", G(ins.OP[n].level), 0, 63, (flags)}, \
-    {"ksl", G(ins.OP[n].ksl), 0, 3, (flags)}, \
-    {"mul", G(ins.OP[n].fmult), 0, 15, (flags)}, \
-    {"am", G(ins.OP[n].am), 0, 1, (flags)}, \
-    {"vib", G(ins.OP[n].vib), 0, 1, (flags)}, \
-    {"eg", G(ins.OP[n].eg), 0, 1, (flags)}, \
-    {"ksr", G(ins.OP[n].ksr), 0, 1, (flags)}
+    {"ar", GS(OP[n].attack, uint8_t), 0, 15, (flags)}, \
+    {"dr", GS(OP[n].decay, uint8_t), 0, 15, (flags)}, \
+    {"sl", GS(OP[n].sustain, uint8_t), 0, 15, (flags)}, \
+    {"rr", GS(OP[n].release, uint8_t), 0, 15, (flags)}, \
+    {"wf", GS(OP[n].waveform, uint8_t), 0, 7, (flags)}, \
+    {"tl", GS(OP[n].level, uint8_t), 0, 63, (flags)}, \
+    {"ksl", GS(OP[n].ksl, uint8_t), 0, 3, (flags)}, \
+    {"mul", GS(OP[n].fmult, uint8_t), 0, 15, (flags)}, \
+    {"am", GS(OP[n].am, bool), 0, 1, (flags)}, \
+    {"vib", GS(OP[n].vib, bool), 0, 1, (flags)}, \
+    {"eg", GS(OP[n].eg, bool), 0, 1, (flags)}, \
+    {"ksr", GS(OP[n].ksr, bool), 0, 1, (flags)}
     OP(MODULATOR1, MP_Operator1),
     OP(CARRIER1, MP_Operator2),
     OP(MODULATOR2, MP_Operator3|MP_4OpOnly),
     OP(CARRIER2, MP_Operator4|MP_4OpOnly),
 #undef OP
-    {"note1", G(ins.note_offset1), -128, 127, MP_None},
-    {"note2", G(ins.note_offset2), -128, 127, MP_Pseudo4OpOnly},
-    {"vel", G(ins.velocity_offset), -128, 127, MP_None},
-    {"dt2", G(ins.fine_tune), -128, 127, MP_Pseudo4OpOnly},
-    {"pk", G(ins.percNoteNum), 0, 127, MP_None},
-    {"kon", G(ins.ms_sound_kon), 0, 65535, MP_Measure},
-    {"koff", G(ins.ms_sound_koff), 0, 65535, MP_Measure},
+    {"note1", GS(note_offset1, int16_t), -128, 127, MP_None},
+    {"note2", GS(note_offset2, int16_t), -128, 127, MP_Pseudo4OpOnly},
+    {"vel", GS(velocity_offset, int8_t), -128, 127, MP_None},
+    {"dt2", GS(fine_tune, int8_t), -128, 127, MP_Pseudo4OpOnly},
+    {"pk", GS(percNoteNum, uint8_t), 0, 127, MP_None},
+    {"kon", GS(ms_sound_kon, uint16_t), 0, 65535, MP_Measure},
+    {"koff", GS(ms_sound_koff, uint16_t), 0, 65535, MP_Measure},
 
+#undef GS
+#undef S
 #undef G
 };
 
@@ -1,4 +1,6 @@
 set(CHIPS_SOURCES
+    "src/opl/realtime/ring_buffer.cpp"
+    "src/opl/realtime/ring_buffer.h"
     "src/opl/chips/dosbox_opl3.cpp"
     "src/opl/chips/dosbox_opl3.h"
     "src/opl/chips/java_opl3.cpp"
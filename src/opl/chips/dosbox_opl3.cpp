@@ -64,6 +64,7 @@ void DosBoxOPL3::writeReg(uint16_t addr, uint8_t data)
 {
     DBOPL::Handler *chip_r = reinterpret_cast<DBOPL::Handler*>(m_chip);
     chip_r->WriteReg(static_cast<Bit32u>(addr), data);
+    bufferRegisterWrite();
 }
 
 void DosBoxOPL3::writePan(uint16_t addr, uint8_t data)
@@ -63,6 +63,7 @@ void JavaOPL3::writeReg(uint16_t addr, uint8_t data)
 {
     ADL_JavaOPL3::OPL3 *chip_r = reinterpret_cast<ADL_JavaOPL3::OPL3 *>(m_chip);
     chip_r->WriteReg(addr, data);
+    bufferRegisterWrite();
 }
 
 void JavaOPL3::writePan(uint16_t addr, uint8_t data)
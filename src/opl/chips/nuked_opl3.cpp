@@ -57,6 +57,13 @@ void NukedOPL3::writeReg(uint16_t addr, uint8_t data)
     OPL3_WriteRegBuffered(chip_r, addr, data);
 }
 
+void NukedOPL3::writeRegImmediate(uint16_t addr, uint8_t data)
+{
+    // Scheduled writes are already timed, so they skip the delay of the write buffer
+    opl3_chip *chip_r = reinterpret_cast<opl3_chip*>(m_chip);
+    OPL3_WriteReg(chip_r, addr, data);
+}
+
 void NukedOPL3::writePan(uint16_t addr, uint8_t data)
 {
     opl3_chip *chip_r = reinterpret_cast<opl3_chip*>(m_chip);
@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <vector>
 
 #if !defined(_MSC_VER) && (__cplusplus <= 199711L)
 #define final
@@ -46,6 +47,16 @@ public:
 protected:
     uint32_t m_id;
     uint32_t m_rate;
+
+    struct ScheduledWrite
+    {
+        uint32_t frame;
+        uint16_t addr;
+        uint8_t  data;
+    };
+    //! Pending scheduled writes sorted by frame, starting from m_scheduleHead
+    std::vector<ScheduledWrite> m_schedule;
+    size_t m_scheduleHead;
 public:
     OPLChipBase();
     virtual ~OPLChipBase();
@@ -68,6 +79,37 @@ public:
     // extended
     virtual void writePan(uint16_t addr, uint8_t data) { (void)addr; (void)data; }
 
+    /**
+     * Never render ahead of the frames which are already requested, so any
+     * register write is heard from the next native frame. Only emulators
+     * which render in blocks are affected.
+     */
+    virtual void setWriteThrough(bool enabled) { (void)enabled; }
+
+    /**
+     * Write the register bypassing any emulator-specific write buffering,
+     * so the change takes effect on the next generated native sample.
+     */
+    virtual void writeRegImmediate(uint16_t addr, uint8_t data) { writeReg(addr, data); }
+
+    /**
+     * Schedule the register write at the exact output frame, counted from the
+     * beginning of the next generate*() call. Writes to the same frame are
+     * applied in order of scheduling, right before that frame is produced.
+     * The queue grows when it's full, so no write is ever applied early.
+     * Don't mix it with writeReg() on the same chip: writes which are still
+     * held by the emulator's own write buffer may land after scheduled ones.
+     */
+    void scheduleWrite(uint32_t frame, uint16_t addr, uint8_t data);
+    void clearScheduledWrites();
+    size_t scheduledWritesCount() const { return m_schedule.size() - m_scheduleHead; }
+
+    /**
+     * Preallocate the queue for the given count of writes per generate*() call,
+     * so the real-time thread doesn't allocate memory while scheduling.
+     */
+    void reserveScheduledWrites(size_t count) { m_schedule.reserve(count); }
+
     virtual void nativePreGenerate() = 0;
     virtual void nativePostGenerate() = 0;
     virtual void nativeGenerate(int16_t *frame) = 0;
@@ -79,6 +121,14 @@ public:
 
     virtual const char* emulatorName() = 0;
     virtual ChipType chipType() = 0;
+protected:
+    /**
+     * Apply all scheduled writes which are due to the frame
+     * Returns the frame of the next pending write, or the "end" if none is before it.
+     */
+    uint32_t applyScheduledWrites(uint32_t frame, uint32_t end);
+    //! Rebase pending writes after the given number of frames was generated
+    void advanceSchedule(uint32_t frames);
 private:
     OPLChipBase(const OPLChipBase &c);
     OPLChipBase &operator=(const OPLChipBase &c);
@@ -106,12 +156,18 @@ public:
     void generateAndMix(int16_t *output, size_t frames) override;
     void generate32(int32_t *output, size_t frames) override;
     void generateAndMix32(int32_t *output, size_t frames) override;
+protected:
+    //! Native frames which may be rendered ahead before the next scheduled write, 0 if unknown
+    size_t m_nativeLookahead;
 private:
     bool m_runningAtPcmRate;
 #if defined(ADLMIDI_AUDIO_TICK_HANDLER)
     void *m_audioTickHandlerInstance;
 #endif
     void nativeTick(int16_t *frame);
+    size_t nativeFramesFor(size_t frames) const;
+    size_t beginSpan(size_t frame, size_t frames);
+    void endGenerate(size_t frames);
     void setupResampler(uint32_t rate);
     void resetResampler();
     void resampledGenerate(int32_t *output);
@@ -130,23 +186,41 @@ private:
 };
 
 // A base class which provides frame-by-frame interfaces on emulations which
-// don't have a routine for it. It produces outputs in fixed size buffers.
-// Fast register updates will suffer some latency because of buffering.
-template <class T, unsigned Buffer = 256>
+// don't have a routine for it. It produces outputs in buffers of up to the
+// given size, never rendering ahead of the next scheduled register write
+// or the end of the current generate call. The block size adapts: it drops
+// to MinBuffer on register writes and doubles on every idle block.
+// Rendered frames are never dropped: a write which arrives while frames are
+// buffered is heard right after them, so the block is split at the write.
+template <class T, unsigned Buffer = 256, unsigned MinBuffer = 16>
 class OPLChipBaseBufferedT : public OPLChipBaseT<T>
 {
 public:
     OPLChipBaseBufferedT()
-        : OPLChipBaseT<T>(), m_bufferIndex(0) {}
+        : OPLChipBaseT<T>(),
+          m_bufferIndex(0), m_bufferFill(0), m_blockSize(Buffer),
+          m_writtenSinceFill(false), m_writeThrough(false) {}
     virtual ~OPLChipBaseBufferedT()
         {}
 public:
     void reset() override;
     void nativeGenerate(int16_t *frame) override;
+
+    // In write-through mode, frames are rendered ahead only as far as they are
+    // known to be needed. When that's unknown (the HQ resampler or the direct
+    // nativeGenerate() use), blocks are single frames.
+    void setWriteThrough(bool enabled) override { m_writeThrough = enabled; }
+    bool writeThrough() const { return m_writeThrough; }
 protected:
     virtual void nativeGenerateN(int16_t *output, size_t frames) = 0;
+    // Must be called by the emulator on every register write
+    void bufferRegisterWrite();
 private:
     unsigned m_bufferIndex;
+    unsigned m_bufferFill;
+    unsigned m_blockSize;
+    bool m_writtenSinceFill;
+    bool m_writeThrough;
     int16_t m_buffer[2 * Buffer];
 };
 
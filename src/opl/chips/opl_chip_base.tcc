@@ -21,7 +21,8 @@
 
 inline OPLChipBase::OPLChipBase() :
     m_id(0),
-    m_rate(44100)
+    m_rate(44100),
+    m_scheduleHead(0)
 {
 }
 
@@ -29,11 +30,71 @@ inline OPLChipBase::~OPLChipBase()
 {
 }
 
+inline void OPLChipBase::scheduleWrite(uint32_t frame, uint16_t addr, uint8_t data)
+{
+    // Reuse the space of already applied writes before growing the queue
+    if(m_scheduleHead > 0 && m_schedule.size() == m_schedule.capacity())
+    {
+        m_schedule.erase(m_schedule.begin(), m_schedule.begin() + (ptrdiff_t)m_scheduleHead);
+        m_scheduleHead = 0;
+    }
+
+    ScheduledWrite w;
+    w.frame = frame;
+    w.addr = addr;
+    w.data = data;
+    m_schedule.push_back(w);
+
+    // Keep the queue sorted, writes to the same frame are staying in order
+    size_t pos = m_schedule.size() - 1;
+    while(pos > m_scheduleHead && m_schedule[pos - 1].frame > frame)
+    {
+        m_schedule[pos] = m_schedule[pos - 1];
+        --pos;
+    }
+    m_schedule[pos] = w;
+}
+
+inline void OPLChipBase::clearScheduledWrites()
+{
+    m_schedule.clear();
+    m_scheduleHead = 0;
+}
+
+inline uint32_t OPLChipBase::applyScheduledWrites(uint32_t frame, uint32_t end)
+{
+    const size_t tail = m_schedule.size();
+    while(m_scheduleHead != tail && m_schedule[m_scheduleHead].frame <= frame)
+    {
+        const ScheduledWrite &w = m_schedule[m_scheduleHead++];
+        writeRegImmediate(w.addr, w.data);
+    }
+
+    if(m_scheduleHead == tail)
+    {
+        clearScheduledWrites();
+        return end;
+    }
+
+    uint32_t next = m_schedule[m_scheduleHead].frame;
+    return (next < end) ? next : end;
+}
+
+inline void OPLChipBase::advanceSchedule(uint32_t frames)
+{
+    for(size_t i = m_scheduleHead; i < m_schedule.size(); ++i)
+    {
+        uint32_t &f = m_schedule[i].frame;
+        f = (f > frames) ? (f - frames) : 0;
+    }
+}
+
 /* OPLChipBaseT */
 
 template <class T>
 OPLChipBaseT<T>::OPLChipBaseT()
     : OPLChipBase(),
+      m_nativeLookahead(0),
       m_runningAtPcmRate(false)
 #if defined(ADLMIDI_AUDIO_TICK_HANDLER)
     ,
@@ -108,8 +169,11 @@ template <class T>
 void OPLChipBaseT<T>::generate(int16_t *output, size_t frames)
 {
     static_cast<T *>(this)->nativePreGenerate();
+    size_t nextSpan = 0;
     for(size_t i = 0; i < frames; ++i)
     {
+        if(UNLIKELY(i == nextSpan))
+            nextSpan = beginSpan(i, frames);
         int32_t frame[2];
         static_cast<T *>(this)->resampledGenerate(frame);
         for (unsigned c = 0; c < 2; ++c) {
@@ -120,6 +184,7 @@ void OPLChipBaseT<T>::generate(int16_t *output, size_t frames)
         }
         output += 2;
     }
+    endGenerate(frames);
     static_cast<T *>(this)->nativePostGenerate();
 }
 
@@ -127,8 +192,11 @@ template <class T>
 void OPLChipBaseT<T>::generateAndMix(int16_t *output, size_t frames)
 {
     static_cast<T *>(this)->nativePreGenerate();
+    size_t nextSpan = 0;
     for(size_t i = 0; i < frames; ++i)
     {
+        if(UNLIKELY(i == nextSpan))
+            nextSpan = beginSpan(i, frames);
         int32_t frame[2];
         static_cast<T *>(this)->resampledGenerate(frame);
         for (unsigned c = 0; c < 2; ++c) {
@@ -139,6 +207,7 @@ void OPLChipBaseT<T>::generateAndMix(int16_t *output, size_t frames)
         }
         output += 2;
     }
+    endGenerate(frames);
     static_cast<T *>(this)->nativePostGenerate();
 }
 
@@ -146,11 +215,15 @@ template <class T>
 void OPLChipBaseT<T>::generate32(int32_t *output, size_t frames)
 {
     static_cast<T *>(this)->nativePreGenerate();
+    size_t nextSpan = 0;
     for(size_t i = 0; i < frames; ++i)
     {
+        if(UNLIKELY(i == nextSpan))
+            nextSpan = beginSpan(i, frames);
         static_cast<T *>(this)->resampledGenerate(output);
         output += 2;
     }
+    endGenerate(frames);
     static_cast<T *>(this)->nativePostGenerate();
 }
 
@@ -158,14 +231,18 @@ template <class T>
 void OPLChipBaseT<T>::generateAndMix32(int32_t *output, size_t frames)
 {
     static_cast<T *>(this)->nativePreGenerate();
+    size_t nextSpan = 0;
     for(size_t i = 0; i < frames; ++i)
     {
+        if(UNLIKELY(i == nextSpan))
+            nextSpan = beginSpan(i, frames);
         int32_t frame[2];
         static_cast<T *>(this)->resampledGenerate(frame);
         output[0] += frame[0];
         output[1] += frame[1];
         output += 2;
     }
+    endGenerate(frames);
     static_cast<T *>(this)->nativePostGenerate();
 }
 
@@ -176,6 +253,39 @@ void OPLChipBaseT<T>::nativeTick(int16_t *frame)
     adl_audioTickHandler(m_audioTickHandlerInstance, m_id, effectiveRate());
 #endif
     static_cast<T *>(this)->nativeGenerate(frame);
+    if(m_nativeLookahead > 0)
+        --m_nativeLookahead;
+}
+
+template <class T>
+size_t OPLChipBaseT<T>::nativeFramesFor(size_t frames) const
+{
+    if(frames == 0)
+        return 0;
+    if(m_runningAtPcmRate)
+        return frames;
+#if defined(ADLMIDI_ENABLE_HQ_RESAMPLER)
+    return 0; // Can't be known ahead
+#else
+    // Every output frame ticks the chip while the counter exceeds the ratio
+    // and then advances the counter by one unit, so the total count is exact
+    return (size_t)(((int64_t)m_samplecnt + ((int64_t)(frames - 1) << rsm_frac)) / m_rateratio);
+#endif
+}
+
+template <class T>
+size_t OPLChipBaseT<T>::beginSpan(size_t frame, size_t frames)
+{
+    size_t next = applyScheduledWrites((uint32_t)frame, (uint32_t)frames);
+    m_nativeLookahead = nativeFramesFor(next - frame);
+    return next;
+}
+
+template <class T>
+void OPLChipBaseT<T>::endGenerate(size_t frames)
+{
+    advanceSchedule((uint32_t)frames);
+    m_nativeLookahead = 0;
 }
 
 template <class T>
@@ -274,21 +384,48 @@ void OPLChipBaseT<T>::resampledGenerate(int32_t *output)
 
 /* OPLChipBaseBufferedT */
 
-template <class T, unsigned Buffer>
-void OPLChipBaseBufferedT<T, Buffer>::reset()
+template <class T, unsigned Buffer, unsigned MinBuffer>
+void OPLChipBaseBufferedT<T, Buffer, MinBuffer>::reset()
 {
     OPLChipBaseT<T>::reset();
     m_bufferIndex = 0;
+    m_bufferFill = 0;
+    m_blockSize = Buffer;
+    m_writtenSinceFill = false;
 }
 
-template <class T, unsigned Buffer>
-void OPLChipBaseBufferedT<T, Buffer>::nativeGenerate(int16_t *frame)
+template <class T, unsigned Buffer, unsigned MinBuffer>
+void OPLChipBaseBufferedT<T, Buffer, MinBuffer>::nativeGenerate(int16_t *frame)
 {
     unsigned bufferIndex = m_bufferIndex;
-    if(bufferIndex == 0)
-        static_cast<T *>(this)->nativeGenerateN(m_buffer, Buffer);
+    if(bufferIndex == m_bufferFill)
+    {
+        // Small blocks while registers are changing, large ones when idle
+        unsigned block = m_blockSize;
+        if(!m_writtenSinceFill && block < Buffer)
+            block = (2 * block < Buffer) ? (2 * block) : Buffer;
+        m_blockSize = block;
+        m_writtenSinceFill = false;
+
+        // Don't render ahead of the next register write
+        size_t lookahead = this->m_nativeLookahead;
+        unsigned fill;
+        if(lookahead > 0)
+            fill = (lookahead < block) ? (unsigned)lookahead : block;
+        else
+            fill = m_writeThrough ? 1 : block;
+        static_cast<T *>(this)->nativeGenerateN(m_buffer, fill);
+        m_bufferFill = fill;
+        bufferIndex = 0;
+    }
     frame[0] = m_buffer[2 * bufferIndex];
     frame[1] = m_buffer[2 * bufferIndex + 1];
-    bufferIndex = (bufferIndex + 1 < Buffer) ? (bufferIndex + 1) : 0;
-    m_bufferIndex = bufferIndex;
+    m_bufferIndex = bufferIndex + 1;
+}
+
+template <class T, unsigned Buffer, unsigned MinBuffer>
+void OPLChipBaseBufferedT<T, Buffer, MinBuffer>::bufferRegisterWrite()
+{
+    m_writtenSinceFill = true;
+    m_blockSize = (MinBuffer < Buffer) ? MinBuffer : Buffer;
 }
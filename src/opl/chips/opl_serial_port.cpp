@@ -64,9 +64,63 @@ static size_t retrowave_protocol_serial_pack(const uint8_t *buf_in, size_t len_i
     return out_cursor;
 }
 
+/**
+ * @brief Encode the register write into the frame of the protocol
+ * @param protocol Protocol of the port
+ * @param addr Register address
+ * @param data Register value
+ * @param out Frame buffer, 16 bytes at least
+ * @return length of the frame, 0 if the write can't be sent by this protocol
+ */
+static size_t encodeSerialWrite(unsigned protocol, uint16_t addr, uint8_t data, uint8_t *out)
+{
+    switch(protocol)
+    {
+    default:
+    case OPL_SerialPort::ProtocolArduinoOPL2:
+    {
+        if(addr >= 0x100)
+            return 0;
+        out[0] = (uint8_t)addr;
+        out[1] = (uint8_t)data;
+        return 2;
+    }
+    case OPL_SerialPort::ProtocolNukeYktOPL3:
+    {
+        out[0] = (addr >> 6) | 0x80;
+        out[1] = ((addr & 0x3f) << 1) | (data >> 7);
+        out[2] = (data & 0x7f);
+        return 3;
+    }
+    case OPL_SerialPort::ProtocolRetroWaveOPL3:
+    {
+        bool port1 = (addr & 0x100) != 0;
+        uint8_t buf[8] =
+        {
+            static_cast<uint8_t>(0x21 << 1), 0x12,
+            static_cast<uint8_t>(port1 ? 0xe5 : 0xe1), static_cast<uint8_t>(addr & 0xff),
+            static_cast<uint8_t>(port1 ? 0xe7 : 0xe3), static_cast<uint8_t>(data),
+            0xfb, static_cast<uint8_t>(data)
+        };
+        return retrowave_protocol_serial_pack(buf, sizeof(buf), out);
+    }
+    }
+}
+
+//! Bytes of encoded writes which may wait for the flush, a block never has so many
+static const size_t serialQueueSize = 65536;
+
 OPL_SerialPort::OPL_SerialPort()
-    : m_port(nullptr), m_protocol(ProtocolUnknown)
-{}
+    : m_port(nullptr), m_protocol(ProtocolUnknown),
+      m_pending(serialQueueSize),
+      m_pendingWrites(0), m_droppedWrites(0), m_pendingSince(-1),
+      m_deadlineNs(2000000), m_flushPosted(0),
+      m_statsSince(-1), m_latencySumMs(0.0)
+{
+    // The batch never outgrows the queue, so it is never reallocated
+    m_sending.reserve(int(serialQueueSize));
+    m_clock.start();
+}
 
 OPL_SerialPort::~OPL_SerialPort()
 {
@@ -79,6 +133,11 @@ bool OPL_SerialPort::connectPort(const QString &name, unsigned baudRate, unsigne
     delete m_port;
     m_port = nullptr;
 
+    // Pending writes are encoded for the previous protocol
+    m_pending.discard(m_pending.size_used());
+    m_pendingWrites.store(0);
+    m_pendingSince.store(-1);
+
     // ensure audio thread reads protocol atomically and in order,
     // so chipType() will be correct after the port is live
     m_protocol.storeRelease(protocol);
@@ -88,62 +147,121 @@ bool OPL_SerialPort::connectPort(const QString &name, unsigned baudRate, unsigne
     return port->open(QSerialPort::WriteOnly);
 }
 
-void OPL_SerialPort::writeReg(uint16_t addr, uint8_t data)
+void OPL_SerialPort::setFlushDeadline(unsigned usec)
 {
-    QMetaObject::invokeMethod(this, "sendSerial",
-                              Qt::QueuedConnection, Q_ARG(uint, addr), Q_ARG(uint, data));
+    m_deadlineNs.store(qint64(usec) * 1000, std::memory_order_relaxed);
 }
 
-void OPL_SerialPort::sendSerial(uint addr, uint data)
+OPL_SerialPort::Statistics OPL_SerialPort::statistics() const
 {
-    QSerialPort *port = m_port;
+    QMutexLocker lock(&m_lock);
+    Statistics stats = m_stats;
+    stats.dropped = m_droppedWrites.load(std::memory_order_relaxed);
+    return stats;
+}
 
-    if(!port || !port->isOpen())
-        return;
+void OPL_SerialPort::resetStatistics()
+{
+    QMutexLocker lock(&m_lock);
+    m_stats = Statistics();
+    m_statsSince = -1;
+    m_latencySumMs = 0.0;
+    m_droppedWrites.store(0, std::memory_order_relaxed);
+}
 
+void OPL_SerialPort::writeReg(uint16_t addr, uint8_t data)
+{
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
     unsigned protocol = m_protocol.loadRelaxed();
 #else
     unsigned protocol = m_protocol.load();
 #endif
 
-    uint8_t sendBuffer[16];
+    uint8_t frame[16];
+    size_t len = encodeSerialWrite(protocol, addr, data, frame);
+    if(len == 0)
+        return;
 
-    switch(protocol)
+    // Only this thread puts writes, nothing here locks or allocates
+    qint64 now = m_clock.nsecsElapsed();
+    qint64 since = m_pendingSince.load(std::memory_order_relaxed);
+    if(since < 0)
     {
-    default:
-    case ProtocolArduinoOPL2:
-    {
-        if(addr >= 0x100)
-            break;
-        sendBuffer[0] = (uint8_t)addr;
-        sendBuffer[1] = (uint8_t)data;
-        port->write((char *)sendBuffer, 2);
-        break;
+        since = now;
+        m_pendingSince.store(now, std::memory_order_relaxed);
     }
-    case ProtocolNukeYktOPL3:
+
+    if(!m_pending.put(frame, len))
     {
-        sendBuffer[0] = (addr >> 6) | 0x80;
-        sendBuffer[1] = ((addr & 0x3f) << 1) | (data >> 7);
-        sendBuffer[2] = (data & 0x7f);
-        port->write((char *)sendBuffer, 3);
-        break;
+        m_droppedWrites.fetch_add(1, std::memory_order_relaxed);
+        requestFlush();
+        return;
     }
-    case ProtocolRetroWaveOPL3:
+    m_pendingWrites.fetch_add(1, std::memory_order_relaxed);
+
+    if(now - since >= m_deadlineNs.load(std::memory_order_relaxed))
+        requestFlush();
+}
+
+void OPL_SerialPort::nativePostGenerate()
+{
+    // Everything written for this block goes out as one batch
+    requestFlush();
+}
+
+void OPL_SerialPort::requestFlush()
+{
+    // Only one flush is queued at a time, it takes everything pending at its run
+    if(m_flushPosted.testAndSetOrdered(0, 1))
+        QMetaObject::invokeMethod(this, "flushSerial", Qt::QueuedConnection);
+}
+
+void OPL_SerialPort::flushSerial()
+{
+    // Reset before taking the batch, so writes arriving later are not missed
+    m_flushPosted.storeRelease(0);
+
+    // Writes put after this moment are starting the next batch
+    qint64 since = m_pendingSince.exchange(-1, std::memory_order_relaxed);
+    quint64 writes = m_pendingWrites.exchange(0, std::memory_order_relaxed);
+
+    // Whole frames only, the audio thread puts every frame at once
+    size_t size = m_pending.size_used();
+    if(size == 0)
+        return;
+    m_sending.resize(int(size));
+    m_pending.get(m_sending.data(), size);
+
+    QSerialPort *port = m_port;
+    if(!port || !port->isOpen())
     {
-        bool port1 = (addr & 0x100) != 0;
-        uint8_t buf[8] =
-        {
-            static_cast<uint8_t>(0x21 << 1), 0x12,
-            static_cast<uint8_t>(port1 ? 0xe5 : 0xe1), static_cast<uint8_t>(addr & 0xff),
-            static_cast<uint8_t>(port1 ? 0xe7 : 0xe3), static_cast<uint8_t>(data),
-            0xfb, static_cast<uint8_t>(data)
-        };
-        size_t packed_len = retrowave_protocol_serial_pack(buf, sizeof(buf), sendBuffer);
-        port->write((char *)sendBuffer, (qint64)packed_len);
-        break;
+        m_sending.resize(0);
+        return;
     }
+
+    port->write(m_sending);
+
+    qint64 now = m_clock.nsecsElapsed();
+    if(since < 0)
+        since = now;
+    {
+        QMutexLocker lock(&m_lock);
+        double latencyMs = double(now - since) / 1e6;
+        if(m_statsSince < 0)
+            m_statsSince = since;
+        m_stats.writes += writes;
+        m_stats.bytes += quint64(m_sending.size());
+        m_stats.batches += 1;
+        m_latencySumMs += latencyMs;
+        m_stats.meanLatencyMs = m_latencySumMs / double(m_stats.batches);
+        if(latencyMs > m_stats.maxLatencyMs)
+            m_stats.maxLatencyMs = latencyMs;
+        if(now > m_statsSince)
+            m_stats.writesPerSecond = double(m_stats.writes) * 1e9 / double(now - m_statsSince);
     }
+
+    // The reserved capacity is kept by the resize
+    m_sending.resize(0);
 }
 
 void OPL_SerialPort::nativeGenerate(int16_t *frame)
@@ -25,6 +25,11 @@
 #include <QObject>
 #include <QString>
 #include <QAtomicInt>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <atomic>
+#include "../realtime/ring_buffer.h"
 
 class QSerialPort;
 
@@ -45,24 +50,76 @@ public:
         ProtocolRetroWaveOPL3,
     };
 
+    /**
+     * @brief Throughput of the transport
+     */
+    struct Statistics
+    {
+        //! Register writes sent to the port
+        quint64 writes = 0;
+        //! Bytes sent to the port
+        quint64 bytes = 0;
+        //! Count of port writes, each carries a batch of register writes
+        quint64 batches = 0;
+        //! Register writes per second since the first write
+        double  writesPerSecond = 0.0;
+        //! Average wait of the oldest register write of each batch
+        double  meanLatencyMs = 0.0;
+        //! Longest wait of the register write till its batch was sent
+        double  maxLatencyMs = 0.0;
+        //! Register writes lost because the queue was full
+        quint64 dropped = 0;
+    };
+
     bool connectPort(const QString &name, unsigned baudRate, unsigned protocol);
 
+    /**
+     * @brief Set the longest time the register write may wait for its batch
+     * @param usec Time in microseconds
+     *
+     * Batches are normally sent at the end of every generated block.
+     */
+    void setFlushDeadline(unsigned usec);
+
+    Statistics statistics() const;
+    void resetStatistics();
+
     bool canRunAtPcmRate() const override { return false; }
     void setRate(uint32_t /*rate*/) override {}
     void reset() override {}
     void writeReg(uint16_t addr, uint8_t data) override;
     void nativePreGenerate() override {}
-    void nativePostGenerate() override {}
+    void nativePostGenerate() override;
     void nativeGenerate(int16_t *frame) override;
     const char *emulatorName() override;
     ChipType chipType() override;
 
 private slots:
-    void sendSerial(uint addr, uint data);
+    void flushSerial();
 
 private:
+    void requestFlush();
+
     QSerialPort *m_port;
     QAtomicInt m_protocol;
+
+    //! Encoded writes which are waiting to be sent, put by the audio thread only
+    Ring_Buffer m_pending;
+    //! Batch which is being sent, its memory is reserved once
+    QByteArray m_sending;
+    std::atomic<quint64> m_pendingWrites;
+    std::atomic<quint64> m_droppedWrites;
+    //! Time of the oldest pending write, -1 if nothing is pending
+    std::atomic<qint64> m_pendingSince;
+    std::atomic<qint64> m_deadlineNs;
+    QAtomicInt m_flushPosted;
+
+    //! Guards statistics, the audio thread never takes it
+    mutable QMutex m_lock;
+    QElapsedTimer m_clock;
+    Statistics m_stats;
+    qint64 m_statsSince;
+    double m_latencySumMs;
 };
 
 #endif // ENABLE_HW_OPL_SERIAL_PORT
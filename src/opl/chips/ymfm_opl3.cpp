@@ -65,6 +65,28 @@ void YmFmOPL3::writeReg(uint16_t addr, uint8_t data)
     ++m_queueCount;
 }
 
+void YmFmOPL3::writeRegImmediate(uint16_t addr, uint8_t data)
+{
+    ymfm::ymf262 *chip_r = reinterpret_cast<ymfm::ymf262*>(m_chip);
+
+    // Flush queued writes first to keep the order of writes
+    while(m_queueCount > 0)
+    {
+        const Reg &front = m_queue[m_tailPos++];
+        if(m_tailPos >= c_queueSize)
+            m_tailPos = 0;
+        --m_queueCount;
+
+        uint32_t port = 2 * ((front.addr >> 8) & 3);
+        chip_r->write(port, front.addr & 0xff);
+        chip_r->write(port + 1, front.data);
+    }
+
+    uint32_t port = 2 * ((addr >> 8) & 3);
+    chip_r->write(port, addr & 0xff);
+    chip_r->write(port + 1, data);
+}
+
 void YmFmOPL3::writePan(uint16_t addr, uint8_t data)
 {
     // ymfm::ymf262 *chip_r = reinterpret_cast<ymfm::ymf262*>(m_chip);
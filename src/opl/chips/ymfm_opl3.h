@@ -49,6 +49,7 @@ public:
     void setRate(uint32_t rate) override;
     void reset() override;
     void writeReg(uint16_t addr, uint8_t data) override;
+    void writeRegImmediate(uint16_t addr, uint8_t data) override;
     void writePan(uint16_t addr, uint8_t data) override;
     void nativePreGenerate() override {}
     void nativePostGenerate() override {}
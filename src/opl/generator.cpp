@@ -17,6 +17,7 @@
  */
 
 #include "generator.h"
+#include "register_log.h"
 #include <qendian.h>
 #include <cmath>
 #include <QtDebug>
@@ -791,15 +792,19 @@ QString GeneratorDebugInfo::toStr()
     return QObject::tr(
         "Channels:\n"
         "2-op: %1, Ps-4op: %2\n"
-        "4-op: %3")
+        "4-op: %3\n"
+        "Writes: %4, skipped: %5")
         .arg(this->chan2op)
         .arg(this->chanPs4op)
-        .arg(this->chan4op);
+        .arg(this->chan4op)
+        .arg(this->regWrites)
+        .arg(this->regSkipped);
 }
 
-Generator::Generator(uint32_t sampleRate, OPL_Chips initialChip)
+Generator::Generator(uint32_t sampleRate, OPL_Chips initialChip, unsigned chipsCount)
 {
     m_rate = sampleRate;
+    m_chipsCount = (chipsCount < 1) ? 1 : (chipsCount > MAX_OF_CHIPS) ? MAX_OF_CHIPS : chipsCount;
     note = 60;
     m_patch =
     {
@@ -820,8 +825,8 @@ Generator::Generator(uint32_t sampleRate, OPL_Chips initialChip)
         -0.125000 // Fine tuning
     };
     m_regBD = 0;
-    memset(m_ins, 0, sizeof(uint16_t) * NUM_OF_CHANNELS);
-    memset(m_keyBlockFNumCache, 0, sizeof(uint8_t) * NUM_OF_CHANNELS);
+    memset(m_ins, 0, sizeof(m_ins));
+    memset(m_keyBlockFNumCache, 0, sizeof(m_keyBlockFNumCache));
     memset(m_four_op_category, 0, NUM_OF_CHANNELS * 2);
 
     uint32_t p = 0;
@@ -836,6 +841,8 @@ Generator::Generator(uint32_t sampleRate, OPL_Chips initialChip)
     rythmModePercussionMode = 0;
     testDrum = 0;//Note ON/OFF of one of legacy percussion channels
 
+    m_limiter.setup(m_rate);
+
     switchChip(initialChip);
 
     //Send the null patch to initialize the OPL stuff
@@ -846,17 +853,24 @@ Generator::Generator(uint32_t sampleRate, OPL_Chips initialChip)
 Generator::~Generator()
 {}
 
-void Generator::OPLChipDelete::operator()(OPLChipBase *x)
+bool Generator::isHardwareChip(OPLChipBase *chip)
 {
 #ifdef ENABLE_HW_OPL_PROXY
-    if(x == &Generator::oplProxy())
-        return;
+    if(chip == &Generator::oplProxy())
+        return true;
 #endif
 #ifdef ENABLE_HW_OPL_SERIAL_PORT
-    if(x == &Generator::serialPortOpl())
-        return;
+    if(chip == &Generator::serialPortOpl())
+        return true;
 #endif
-    delete x;
+    (void)chip;
+    return false;
+}
+
+void Generator::OPLChipDelete::operator()(OPLChipBase *x)
+{
+    if(!isHardwareChip(x))
+        delete x;
 }
 
 void Generator::initChip()
@@ -875,26 +889,36 @@ void Generator::initChip()
     };
     uint32_t maxChans = 18;
 
-    m_chipType = chip->chipType();
+    m_chipType = m_engine.chip(0)->chipType();
 
     if(m_chipType == OPLChipBase::CHIPTYPE_OPL2)
         maxChans = 9;
 
-    chip->setChipId(0);
-    chip->setRate(m_rate);
-
-    for(uint32_t a = 0; a < maxChans; ++a)
-        WriteReg(0xB0 + g_Channels[a], 0x00);
+    // The chip may be switched while recording
+    if(m_capture)
+        m_capture->updateChipType(m_chipType);
 
-    if(m_chipType == OPLChipBase::CHIPTYPE_OPL3)
-    {
-        for(size_t a = 0; a < 14; a += 2)
-            WriteReg(data[a], static_cast<uint8_t>(data[a + 1]));
-    }
-    else
+    for(uint32_t c = 0; c < m_engine.chipsCount(); ++c)
     {
-        for(size_t a = 0; a < 6; a += 2)
-            WriteReg(data[a], static_cast<uint8_t>(data_opl2[a + 1]));
+        OPLChipBase *chip = m_engine.chip(c);
+        chip->setChipId(c);
+        chip->setRate(m_rate);
+        // The chip is reset, so nothing is known about its registers
+        m_shadow[c].invalidate();
+
+        for(uint32_t a = 0; a < maxChans; ++a)
+            WriteReg(c, 0xB0 + g_Channels[a], 0x00);
+
+        if(m_chipType == OPLChipBase::CHIPTYPE_OPL3)
+        {
+            for(size_t a = 0; a < 14; a += 2)
+                WriteReg(c, data[a], static_cast<uint8_t>(data[a + 1]));
+        }
+        else
+        {
+            for(size_t a = 0; a < 6; a += 2)
+                WriteReg(c, data[a], static_cast<uint8_t>(data_opl2[a + 1]));
+        }
     }
 
 
@@ -920,68 +944,142 @@ OPL_SerialPort &Generator::serialPortOpl()
 }
 #endif
 
-void Generator::switchChip(Generator::OPL_Chips chipId)
+OPLChipBase *Generator::createChip(Generator::OPL_Chips chipId)
 {
     switch(chipId)
     {
 #ifdef ENABLE_HW_OPL_PROXY
     case CHIP_Win9xProxy:
         oplProxy().startChip();
-        chip.reset(&oplProxy());
-        break;
+        return &oplProxy();
 #endif
 #ifdef ENABLE_YMFM_EMULATOR
     case CHIP_YmFm:
-        chip.reset(new YmFmOPL3());
-        break;
+        return new YmFmOPL3();
 #endif
 #ifdef ENABLE_HW_OPL_SERIAL_PORT
     case CHIP_SerialPort:
-        chip.reset(&serialPortOpl());
-        break;
+        return &serialPortOpl();
 #endif
     case CHIP_YMF262LLC:
-        chip.reset(new Ymf262LLEOPL3());
-        break;
+        return new Ymf262LLEOPL3();
     case CHIP_DosBox:
-        chip.reset(new DosBoxOPL3());
-        break;
+        return new DosBoxOPL3();
     default:
     case CHIP_Nuked:
-        chip.reset(new NukedOPL3());
-        break;
+        return new NukedOPL3();
     case CHIP_Opal:
-        chip.reset(new OpalOPL3());
-        break;
+        return new OpalOPL3();
     case CHIP_Java:
-        chip.reset(new JavaOPL3());
-        break;
+        return new JavaOPL3();
+    }
+}
+
+void Generator::switchChip(Generator::OPL_Chips chipId)
+{
+    // Previous chips are destroyed by the engine
+    m_engine.clearChips();
+    m_chipId = chipId;
+
+    for(unsigned c = 0; c < m_chipsCount; ++c)
+    {
+        std::shared_ptr<OPLChipBase> chip(createChip(chipId), OPLChipDelete());
+        chip->reserveScheduledWrites(SCHEDULE_RESERVE_WRITES);
+        // Live playing: a patch change must not wait for already rendered frames
+        chip->setWriteThrough(true);
+        m_engine.addChip(chip);
+        // There is only one hardware chip
+        if(isHardwareChip(chip.get()))
+            break;
     }
 
     initChip();
 }
 
-void Generator::WriteReg(uint16_t address, uint8_t byte)
+void Generator::setChipsCount(unsigned count)
 {
-    chip->writeReg(address, byte);
+    if(count < 1)
+        count = 1;
+    else if(count > MAX_OF_CHIPS)
+        count = MAX_OF_CHIPS;
+
+    if(count == m_chipsCount)
+        return;
+
+    m_chipsCount = count;
+    switchChip(m_chipId);
+}
+
+void Generator::WriteReg(uint32_t chip, uint16_t address, uint8_t byte)
+{
+    if(m_shadow[chip].write(address, byte))
+    {
+        // Applied right before the first frame of the next block, the same way by every emulator
+        m_engine.chip(chip)->scheduleWrite(0, address, byte);
+        if(m_capture && chip == 0)
+            m_capture->put(m_captureFrame, address, byte);
+    }
+}
+
+void Generator::WriteRegAll(uint16_t address, uint8_t byte)
+{
+    for(uint32_t c = 0; c < m_engine.chipsCount(); ++c)
+        WriteReg(c, address, byte);
+}
+
+void Generator::startCapture(OPLRegisterCapture *capture)
+{
+    // The recording starts from the current state of the chip: mode registers
+    // first, then operators and channels, and key-on registers at last
+    static const uint16_t ranges[][2] =
+    {
+        {0x105, 0x105}, {0x104, 0x104}, {0x001, 0x001}, {0x008, 0x008},
+        {0x020, 0x09F}, {0x120, 0x19F}, {0x0E0, 0x0F5}, {0x1E0, 0x1F5},
+        {0x0A0, 0x0A8}, {0x1A0, 0x1A8}, {0x0C0, 0x0C8}, {0x1C0, 0x1C8},
+        {0x0BD, 0x0BD}, {0x0B0, 0x0B8}, {0x1B0, 0x1B8}
+    };
+
+    OPLRegisterLog *log = &capture->log();
+    capture->begin(m_rate, m_chipType);
+    m_captureFrame = 0;
+
+    for(const uint16_t *range : ranges)
+    {
+        for(uint16_t addr = range[0]; addr <= range[1]; ++addr)
+        {
+            if(m_shadow[0].isKnown(addr) && !OPLShadowRegisters::isStrobe(addr))
+                log->append(0, addr, m_shadow[0].value(addr));
+        }
+    }
+
+    m_capture = capture;
+}
+
+void Generator::stopCapture()
+{
+    if(m_capture)
+        m_capture->finish(m_captureFrame);
+    m_capture = nullptr;
 }
 
 void Generator::NoteOff(uint32_t c)
 {
+    uint32_t card = c / 23;
     uint8_t cc = static_cast<uint8_t>(c % 23);
 
     if(cc >= 18)
     {
         m_regBD &= ~(0x10 >> (cc - 18));
-        WriteReg(0xBD, m_regBD);
+        WriteReg(card, 0xBD, m_regBD);
         return;
     }
 
-    WriteReg(0xB0 + g_Channels[cc], m_keyBlockFNumCache[c] & 0xDF);
+    WriteReg(card, 0xB0 + g_Channels[cc], m_keyBlockFNumCache[c] & 0xDF);
 }
 
 void Generator::NoteOn(uint32_t c1, uint32_t c2, double tone, bool voice2ps4op) // Hertz range: 0..131071
 {
+    uint32_t card = c1 / 23;
     uint32_t cc1 = c1 % 23;
     uint32_t cc2 = c2 % 23;
     uint32_t octave = 0, ftone = 0, mul_offset = 0;
@@ -1069,26 +1167,26 @@ void Generator::NoteOn(uint32_t c1, uint32_t c2, double tone, bool voice2ps4op)
                     mul_offset = 0;
                     mul = 0x0F;
                 }
-                WriteReg(0x20 + op_addr[op],  uint8_t(dt | (mul + mul_offset)) & 0xFF);
+                WriteReg(card, 0x20 + op_addr[op],  uint8_t(dt | (mul + mul_offset)) & 0xFF);
             }
             else
             {
-                WriteReg(0x20 + op_addr[op],  ops[op] & 0xFF);
+                WriteReg(card, 0x20 + op_addr[op],  ops[op] & 0xFF);
             }
         }
     }
 
     if(chn != 0xFFF)
     {
-        WriteReg(0xA0 + chn, (ftone & 0xFF));
-        WriteReg(0xB0 + chn, (ftone >> 8));
+        WriteReg(card, 0xA0 + chn, (ftone & 0xFF));
+        WriteReg(card, 0xB0 + chn, (ftone >> 8));
         m_keyBlockFNumCache[c1] = static_cast<uint8_t>(ftone >> 8);
     }
 
     if(cc1 >= OPL3_CHANNELS_RHYTHM_BASE)
     {
         m_regBD |= (0x10 >> (cc1 - OPL3_CHANNELS_RHYTHM_BASE));
-        WriteReg(0x0BD, m_regBD);
+        WriteReg(card, 0x0BD, m_regBD);
         //x |= 0x800; // for test
     }
 }
@@ -1106,7 +1204,7 @@ void Generator::touchNote(uint32_t c,
                           uint8_t ccexpr,
                           uint32_t brightness, bool isDrum)
 {
-    uint16_t /*card = c/23,*/ cc = c % 23;
+    uint16_t card = c / 23, cc = c % 23;
     uint16_t i = m_ins[c],
             o1 = g_Operators[cc * 2 + 0],
             o2 = g_Operators[cc * 2 + 1];
@@ -1240,16 +1338,16 @@ void Generator::touchNote(uint32_t c,
     if(midiVolume > 127)
         midiVolume = 127;
 
-    if(m_four_op_category[c] == ChanCat_Regular ||
-       m_four_op_category[c] == ChanCat_Rhythm_Bass)
+    if(m_four_op_category[cc] == ChanCat_Regular ||
+       m_four_op_category[cc] == ChanCat_Rhythm_Bass)
     {
         mode = m_patch.OPS[i].feedconn & 1; // 2-op FM or 2-op AM
     }
-    else if(m_four_op_category[c] == ChanCat_4op_Master ||
-            m_four_op_category[c] == ChanCat_4op_Slave)
+    else if(m_four_op_category[cc] == ChanCat_4op_Master ||
+            m_four_op_category[cc] == ChanCat_4op_Slave)
     {
         uint32_t i0, i1;
-        if(m_four_op_category[c] == ChanCat_4op_Master)
+        if(m_four_op_category[cc] == ChanCat_4op_Master)
         {
             i0 = i;
             i1 = m_ins[c + 3];
@@ -1409,9 +1507,9 @@ void Generator::touchNote(uint32_t c,
     carrier = (kslCar & 0xC0) | (tlCar & 63);
 
     if(o1 != 0xFFF)
-        WriteReg(0x40 + o1, static_cast<uint8_t>(modulator));
+        WriteReg(card, 0x40 + o1, static_cast<uint8_t>(modulator));
     if(o2 != 0xFFF)
-        WriteReg(0x40 + o2, static_cast<uint8_t>(carrier));
+        WriteReg(card, 0x40 + o2, static_cast<uint8_t>(carrier));
 
     // Correct formula (ST3, AdPlug):
     //   63-((63-(instrvol))/63)*chanvol
@@ -1423,7 +1521,7 @@ void Generator::touchNote(uint32_t c,
 
 void Generator::Patch(uint32_t c, uint32_t i)
 {
-    uint32_t cc = c % 23;
+    uint32_t card = c / 23, cc = c % 23;
     static const uint16_t data[4] = {0x20, 0x60, 0x80, 0xE0};
     m_ins[c] = static_cast<uint16_t>(i);
     uint16_t o1 = g_Operators[cc * 2 + 0],
@@ -1433,17 +1531,18 @@ void Generator::Patch(uint32_t c, uint32_t i)
     for(uint32_t a = 0; a < 4; ++a, x >>= 8, y >>= 8)
     {
         if(o1 != 0xFFF)
-            WriteReg(data[a] + o1, x & 0xFF);
+            WriteReg(card, data[a] + o1, x & 0xFF);
         if(o2 != 0xFFF)
-            WriteReg(data[a] + o2, y & 0xFF);
+            WriteReg(card, data[a] + o2, y & 0xFF);
     }
 }
 
 void Generator::Pan(uint32_t c, uint32_t value)
 {
+    uint32_t card = c / 23;
     uint8_t cc = c % 23;
     if(g_Channels_pan[cc] != 0xFFF)
-        WriteReg(0xC0 + g_Channels_pan[cc], static_cast<uint8_t>(m_patch.OPS[m_ins[c]].feedconn | value));
+        WriteReg(card, 0xC0 + g_Channels_pan[cc], static_cast<uint8_t>(m_patch.OPS[m_ins[c]].feedconn | value));
 }
 
 void Generator::PlayNoteF(int noteID, uint32_t volume, uint8_t ccvolume, uint8_t ccexpr)
@@ -1458,27 +1557,52 @@ void Generator::PlayNoteF(int noteID, uint32_t volume, uint8_t ccvolume, uint8_t
     {
         //if it replaces an old note, shut up the old one first
         //this lets the sustain take over with a fresh envelope
-        bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
-        bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
-        if(natural_4op)
-        {
-            NoteOff(g_channelsMap1_4op[ch]);
-        }
-        else
-        {
-            if(pseudo_4op)
-            {
-                NoteOff(g_channelsMap1_p4op[ch]);
-                NoteOff(g_channelsMap2_p4op[ch]);
-            }
-            else
-                NoteOff(g_channels2Map_2op[ch]);
-        }
+        voiceOff(ch);
     }
 
     PlayNoteCh(ch);
 }
 
+int Generator::voiceChannels(int ch, uint32_t adlchannel[2]) const
+{
+    bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
+    bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
+    // Neighbour voices are going to different chips to spread the rendering load
+    uint32_t chips = m_engine.chipsCount();
+    uint32_t card = static_cast<uint32_t>(ch) % chips;
+    uint32_t local = static_cast<uint32_t>(ch) / chips;
+    uint32_t base = card * NUM_OF_CHANNELS;
+
+    if(pseudo_4op)
+    {
+        adlchannel[0] = base + g_channelsMap1_p4op[local];
+        adlchannel[1] = base + g_channelsMap2_p4op[local];
+        return 2;
+    }
+    else if(natural_4op)
+    {
+        adlchannel[0] = base + g_channelsMap1_4op[local];
+        adlchannel[1] = base + g_channelsMap2_4op[local];
+        return 2;
+    }
+
+    adlchannel[0] = base + g_channels2Map_2op[local];
+    adlchannel[1] = adlchannel[0];
+    return 1;
+}
+
+void Generator::voiceOff(int ch)
+{
+    bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
+    uint32_t adlchannel[2];
+    voiceChannels(ch, adlchannel);
+
+    // The slave of the 4-op channel is keyed by the master
+    NoteOff(adlchannel[0]);
+    if(pseudo_4op)
+        NoteOff(adlchannel[1]);
+}
+
 void Generator::PlayNoteCh(int ch)
 {
     if(!m_isInstrumentLoaded)
@@ -1501,29 +1625,16 @@ void Generator::PlayNoteCh(int ch)
     uint16_t i[2] = { 0, 1 };
     bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
     bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
-    uint16_t  adlchannel[2] = { 0, 0 };
+    uint32_t adlchannel[2] = { 0, 0 };
 
-    if(!natural_4op || pseudo_4op)
-    {
-        if(pseudo_4op)
-        {
-            adlchannel[0] = g_channelsMap1_p4op[ch];
-            adlchannel[1] = g_channelsMap2_p4op[ch];
-            m_debug.chanPs4op = ch;
-        }
-        else
-        {
-            adlchannel[0] = g_channels2Map_2op[ch];
-            adlchannel[1] = g_channels2Map_2op[ch];
-            m_debug.chan2op = ch;
-        }
-    }
+    voiceChannels(ch, adlchannel);
+
+    if(pseudo_4op)
+        m_debug.chanPs4op = ch;
     else if(natural_4op)
-    {
-        adlchannel[0] = g_channelsMap1_4op[ch];
-        adlchannel[1] = g_channelsMap2_4op[ch];
         m_debug.chan4op = ch;
-    }
+    else
+        m_debug.chan2op = ch;
 
     m_ins[adlchannel[0]] = i[0];
     m_ins[adlchannel[1]] = i[1];
@@ -1585,23 +1696,7 @@ void Generator::StopNoteCh(int ch)
     }
 
     m_noteManager.channelOff(ch);
-
-    bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
-    bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
-    if(natural_4op)
-    {
-        NoteOff(g_channelsMap1_4op[ch]);
-    }
-    else
-    {
-        if(pseudo_4op)
-        {
-            NoteOff(g_channelsMap1_p4op[ch]);
-            NoteOff(g_channelsMap2_p4op[ch]);
-        }
-        else
-            NoteOff(g_channels2Map_2op[ch]);
-    }
+    voiceOff(ch);
 }
 
 void Generator::PlayDrum(uint8_t drum, int noteID)
@@ -1630,12 +1725,13 @@ void Generator::PlayDrum(uint8_t drum, int noteID)
 
 void Generator::switch4op(bool enabled, bool patchCleanUp)
 {
+    const uint32_t channels = NUM_OF_CHANNELS * m_engine.chipsCount();
     m_4op_last_state = enabled;
     //Shut up currently playing stuff
-    for(uint32_t b = 0; b < NUM_OF_CHANNELS; ++b)
+    for(uint32_t b = 0; b < channels; ++b)
     {
-        if(m_chipType == OPLChipBase::CHIPTYPE_OPL2 && (b == 9))
-            b = 18;
+        if(m_chipType == OPLChipBase::CHIPTYPE_OPL2 && (b % NUM_OF_CHANNELS == 9))
+            b += 9;
         NoteOff(b);
         touchNote(b, 0, 0, 0);
     }
@@ -1665,7 +1761,7 @@ void Generator::switch4op(bool enabled, bool patchCleanUp)
     if(enabled && (m_chipType == OPLChipBase::CHIPTYPE_OPL3))
     {
         //Enable 4-operators mode
-        WriteReg(0x104, 0xFF);
+        WriteRegAll(0x104, 0xFF);
         uint32_t fours = 6;
         uint32_t nextfour = 0;
 
@@ -1696,7 +1792,7 @@ void Generator::switch4op(bool enabled, bool patchCleanUp)
     else
     {
         if(m_chipType == OPLChipBase::CHIPTYPE_OPL3)
-            WriteReg(0x104, 0x00);//Disable 4-operators mode
+            WriteRegAll(0x104, 0x00);//Disable 4-operators mode
         for(uint32_t a = 0; a < 18; ++a)
             m_four_op_category[a] = 0;
     }
@@ -1714,10 +1810,10 @@ void Generator::switch4op(bool enabled, bool patchCleanUp)
     }
 
     //Clear all operator registers from crap left from previous patches
-    for(uint32_t b = 0; b < NUM_OF_CHANNELS; ++b)
+    for(uint32_t b = 0; b < channels; ++b)
     {
-        if(m_chipType == OPLChipBase::CHIPTYPE_OPL2 && (b == 9))
-            b = 18;
+        if(m_chipType == OPLChipBase::CHIPTYPE_OPL2 && (b % NUM_OF_CHANNELS == 9))
+            b += 9;
         Patch(b, 0);
         Pan(b, (rythmModePercussionMode == 0) ? 0x00 : 0x30);
         touchNote(b, 0, 0, 0);
@@ -1727,7 +1823,7 @@ void Generator::switch4op(bool enabled, bool patchCleanUp)
 void Generator::Silence()
 {
     //Shutup!
-    for(uint32_t c = 0; c < NUM_OF_CHANNELS; ++c)
+    for(uint32_t c = 0; c < NUM_OF_CHANNELS * m_engine.chipsCount(); ++c)
     {
         NoteOff(c);
         touchNote(c, 0, 0, 0);
@@ -1757,18 +1853,9 @@ void Generator::NoteOffAllChans()
         return;
     }
 
-    //bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
-    bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
-    if(natural_4op)
-    {
-        for(uint32_t c = 0; c < USED_CHANNELS_4OP; ++c)
-            NoteOff(g_channelsMap1_4op[c]);
-    }
-    else
-    {
-        for(uint32_t c = 0; c < USED_CHANNELS_2OP; ++c)
-            NoteOff(g_channels2Map_2op[c]);
-    }
+    int channels = m_noteManager.channelCount();
+    for(int ch = 0; ch < channels; ++ch)
+        voiceOff(ch);
 
     m_noteManager.clearNotes();
 }
@@ -1884,6 +1971,76 @@ void Generator::Hold(bool held)
     }
 }
 
+void Generator::buildPatch(OPL_PatchSetup &patch, const FmBank::Instrument &instrument, bool isDrum)
+{
+    bool isRhythmMode = isDrum && (instrument.rhythm_drum_type >= 6);
+
+    patch.OPS[0].modulator_E862   = instrument.getDataE862(MODULATOR1);
+    patch.OPS[0].modulator_20     = instrument.getAVEKM(MODULATOR1);
+    patch.OPS[0].modulator_40     = instrument.getKSLL(MODULATOR1);
+    patch.OPS[0].carrier_E862     = instrument.getDataE862(CARRIER1);
+    patch.OPS[0].carrier_20       = instrument.getAVEKM(CARRIER1);
+    patch.OPS[0].carrier_40       = instrument.getKSLL(CARRIER1);
+    patch.OPS[0].feedconn         = instrument.getFBConn1();
+
+    patch.OPS[1].modulator_E862   = instrument.getDataE862(MODULATOR2);
+    patch.OPS[1].modulator_20     = instrument.getAVEKM(MODULATOR2);
+    patch.OPS[1].modulator_40     = instrument.getKSLL(MODULATOR2);
+    patch.OPS[1].carrier_E862     = instrument.getDataE862(CARRIER2);
+    patch.OPS[1].carrier_20       = instrument.getAVEKM(CARRIER2);
+    patch.OPS[1].carrier_40       = instrument.getKSLL(CARRIER2);
+    patch.OPS[1].feedconn         = instrument.getFBConn2();
+
+    patch.flags   = 0;
+    patch.tone    = 0;
+    patch.voice2_fine_tune = 0.0;
+
+    if(isDrum || instrument.is_fixed_note)
+        patch.tone = instrument.percNoteNum;
+
+    if(isRhythmMode)// Rhythm-mode percussion instrument, fine tuning is not in use
+        return;
+
+    if(instrument.en_4op && instrument.en_pseudo4op)
+    {
+        patch.voice2_fine_tune = (double)((((int)instrument.fine_tune + 128) >> 1) - 64) / 32.0;
+        patch.OPS[0].finetune = static_cast<int8_t>(instrument.note_offset1);
+        patch.OPS[1].finetune = static_cast<int8_t>(instrument.note_offset2);
+    }
+    else
+    {
+        patch.OPS[0].finetune = static_cast<int8_t>(instrument.note_offset1);
+        patch.OPS[1].finetune = static_cast<int8_t>(instrument.note_offset1);
+    }
+
+    if(instrument.en_4op)
+    {
+        if(instrument.en_pseudo4op)
+            patch.flags |= OPL_PatchSetup::Flag_Pseudo4op;
+        else
+            patch.flags |= OPL_PatchSetup::Flag_True4op;
+    }
+}
+
+unsigned Generator::patchDelta(const OPL_PatchSetup &from, const OPL_PatchSetup &to, int voice)
+{
+    const OPL_Operator &a = from.OPS[voice];
+    const OPL_Operator &b = to.OPS[voice];
+    unsigned delta = 0;
+
+    if(a.modulator_E862 != b.modulator_E862 || a.carrier_E862 != b.carrier_E862)
+        delta |= PATCH_OPERATORS;
+    if(a.modulator_40 != b.modulator_40 || a.carrier_40 != b.carrier_40)
+        delta |= PATCH_LEVELS;
+    if(a.feedconn != b.feedconn)
+        delta |= PATCH_FEEDCONN;
+    if(a.finetune != b.finetune || from.tone != to.tone ||
+       (voice == 1 && from.voice2_fine_tune != to.voice2_fine_tune))
+        delta |= PATCH_PITCH;
+
+    return delta;
+}
+
 void Generator::changePatch(const FmBank::Instrument &instrument, bool isDrum)
 {
     //Shutup everything
@@ -1896,28 +2053,7 @@ void Generator::changePatch(const FmBank::Instrument &instrument, bool isDrum)
     changeRhythmMode(isRhythmMode);
     switch4op(instrument.en_4op && !instrument.en_pseudo4op && (instrument.rhythm_drum_type == 0));
 
-    m_patch.OPS[0].modulator_E862   = instrument.getDataE862(MODULATOR1);
-    m_patch.OPS[0].modulator_20     = instrument.getAVEKM(MODULATOR1);
-    m_patch.OPS[0].modulator_40     = instrument.getKSLL(MODULATOR1);
-    m_patch.OPS[0].carrier_E862     = instrument.getDataE862(CARRIER1);
-    m_patch.OPS[0].carrier_20       = instrument.getAVEKM(CARRIER1);
-    m_patch.OPS[0].carrier_40       = instrument.getKSLL(CARRIER1);
-    m_patch.OPS[0].feedconn         = instrument.getFBConn1();
-
-    m_patch.OPS[1].modulator_E862   = instrument.getDataE862(MODULATOR2);
-    m_patch.OPS[1].modulator_20     = instrument.getAVEKM(MODULATOR2);
-    m_patch.OPS[1].modulator_40     = instrument.getKSLL(MODULATOR2);
-    m_patch.OPS[1].carrier_E862     = instrument.getDataE862(CARRIER2);
-    m_patch.OPS[1].carrier_20       = instrument.getAVEKM(CARRIER2);
-    m_patch.OPS[1].carrier_40       = instrument.getKSLL(CARRIER2);
-    m_patch.OPS[1].feedconn         = instrument.getFBConn2();
-
-    m_patch.flags   = 0;
-    m_patch.tone    = 0;
-    m_patch.voice2_fine_tune = 0.0;
-
-    if(isDrum || instrument.is_fixed_note)
-        m_patch.tone = instrument.percNoteNum;
+    buildPatch(m_patch, instrument, isDrum);
 
     if(isRhythmMode)// Rhythm-mode percussion instrument
     {
@@ -1925,30 +2061,71 @@ void Generator::changePatch(const FmBank::Instrument &instrument, bool isDrum)
         Patch(OPL3_CHANNELS_RHYTHM_BASE + testDrum, 0);
     }
     else // Melodic or Generic percussion instrument
+        updateChannelManager();
+
+    m_isInstrumentLoaded = true;//Mark instrument as loaded
+}
+
+void Generator::updatePatch(const FmBank::Instrument &instrument, bool isDrum)
+{
+    bool isRhythmMode = isDrum && (instrument.rhythm_drum_type >= 6);
+    bool true4op = instrument.en_4op && !instrument.en_pseudo4op && (instrument.rhythm_drum_type == 0);
+
+    OPL_PatchSetup patch = m_patch;
+    buildPatch(patch, instrument, isDrum);
+
+    // Voice layout changes are requiring channels to be reallocated
+    if(!m_isInstrumentLoaded || isRhythmMode || rythmModePercussionMode ||
+       true4op != m_4op_last_state || patch.flags != m_patch.flags)
     {
-        if(instrument.en_4op && instrument.en_pseudo4op)
-        {
-            m_patch.voice2_fine_tune = (double)((((int)instrument.fine_tune + 128) >> 1) - 64) / 32.0;
-            m_patch.OPS[0].finetune = static_cast<int8_t>(instrument.note_offset1);
-            m_patch.OPS[1].finetune = static_cast<int8_t>(instrument.note_offset2);
-        }
-        else
+        changePatch(instrument, isDrum);
+        return;
+    }
+
+    unsigned delta[2] =
+    {
+        patchDelta(m_patch, patch, 0),
+        patchDelta(m_patch, patch, 1)
+    };
+
+    m_patch = patch;
+
+    if((delta[0] | delta[1]) == 0)
+        return;
+
+    bool pseudo_4op  = (m_patch.flags & OPL_PatchSetup::Flag_Pseudo4op) != 0;
+    bool natural_4op = (m_patch.flags & OPL_PatchSetup::Flag_True4op) != 0;
+    int channels = m_noteManager.channelCount();
+
+    // Idle channels are getting the whole patch on the next note,
+    // so only sounding ones are touched, and only by changed registers
+    for(int ch = 0; ch < channels; ++ch)
+    {
+        const NotesManager::Note &channel = m_noteManager.channel(ch);
+        if(channel.note == -1)
+            continue;
+
+        if((delta[0] & PATCH_PITCH) || ((pseudo_4op || natural_4op) && (delta[1] & PATCH_PITCH)))
         {
-            m_patch.OPS[0].finetune = static_cast<int8_t>(instrument.note_offset1);
-            m_patch.OPS[1].finetune = static_cast<int8_t>(instrument.note_offset1);
+            PlayNoteCh(ch);  // retunes the note, unchanged registers are skipped by the shadow
+            continue;
         }
 
-        if(instrument.en_4op)
+        uint32_t adlchannel[2];
+        int voices = voiceChannels(ch, adlchannel);
+
+        for(int v = 0; v < voices; ++v)
         {
-            if(instrument.en_pseudo4op)
-                m_patch.flags |= OPL_PatchSetup::Flag_Pseudo4op;
-            else
-                m_patch.flags |= OPL_PatchSetup::Flag_True4op;
+            uint32_t c = adlchannel[v];
+            unsigned d = delta[m_ins[c]];
+            if(d & PATCH_OPERATORS)
+                Patch(c, m_ins[c]);
+            if(d & PATCH_FEEDCONN)
+                Pan(c, 0x30);
+            if(d & PATCH_LEVELS)
+                touchNote(c, channel.volume, channel.ccvolume, channel.ccexpr);
         }
-        updateChannelManager();
     }
-
-    m_isInstrumentLoaded = true;//Mark instrument as loaded
 }
 
 void Generator::changeNote(int newnote)
@@ -1982,7 +2159,10 @@ void Generator::changeRhythmMode(bool enabled)
 void Generator::updateRegBD()
 {
     m_regBD = (deepTremoloMode * 0x80) + (deepVibratoMode * 0x40) + (rythmModePercussionMode * 0x20);
-    WriteReg(0x0BD, m_regBD);
+    WriteReg(0, 0x0BD, m_regBD);
+    // Rhythm-mode percussion is played by the first chip only, others are getting the depth
+    for(uint32_t c = 1; c < m_engine.chipsCount(); ++c)
+        WriteReg(c, 0x0BD, m_regBD & 0xC0);
 }
 
 void Generator::updateChannelManager()
@@ -1998,20 +2178,52 @@ void Generator::updateChannelManager()
         chanPs4ops = USED_CHANNELS_2OP_PS4_OPL2;
     }
 
+    // Voices of every chip, see voiceChannels()
+    int chips = static_cast<int>(m_engine.chipsCount());
     if(pseudo_4op)
-        m_noteManager.allocateChannels(chanPs4ops);
+        m_noteManager.allocateChannels(chanPs4ops * chips);
     else if(natural_4op)
-        m_noteManager.allocateChannels(USED_CHANNELS_4OP);
+        m_noteManager.allocateChannels(USED_CHANNELS_4OP * chips);
     else
-        m_noteManager.allocateChannels(chan2ops);
+        m_noteManager.allocateChannels(chan2ops * chips);
 }
 
 void Generator::generate(int16_t *frames, unsigned nframes)
 {
-    chip->generate(frames, nframes);
+    while(nframes > 0)
+    {
+        unsigned chunk = (nframes < MIX_CHUNK_FRAMES) ? nframes : MIX_CHUNK_FRAMES;
+        generate(m_mixBuffer, chunk);
+        FloatMixer::toInt16(frames, m_mixBuffer, 2 * chunk);
+        frames += 2 * chunk;
+        nframes -= chunk;
+    }
+}
+
+void Generator::generate(float *frames, unsigned nframes)
+{
     // 2x Gain by default
-    for(size_t i = 0; i < nframes * 2; ++i)
-        frames[i] *= 2;
+    const float gain = 2.0f / 32768.0f;
+    // Every chip adds its output into the mix, nothing gets clipped here
+    m_engine.render(frames, nframes, gain);
+
+    m_limiter.process(frames, nframes);
+
+    if(m_capture)
+        m_captureFrame += nframes;
+
+    m_debug.regWrites = 0;
+    m_debug.regSkipped = 0;
+    for(uint32_t c = 0; c < m_engine.chipsCount(); ++c)
+    {
+        m_debug.regWrites += m_shadow[c].totalWrites();
+        m_debug.regSkipped += m_shadow[c].totalSkips();
+    }
+}
+
+void Generator::setSoftLimiter(bool enabled)
+{
+    m_limiter.setEnabled(enabled);
 }
 
 Generator::NotesManager::NotesManager()
@@ -2029,10 +2241,10 @@ void Generator::NotesManager::allocateChannels(int count)
     cycle = 0;
 }
 
-uint8_t Generator::NotesManager::noteOn(int note, uint32_t volume, uint8_t ccvolume, uint8_t ccexpr, bool *r)
+int Generator::NotesManager::noteOn(int note, uint32_t volume, uint8_t ccvolume, uint8_t ccexpr, bool *r)
 {
-    uint8_t beganAt = cycle;
-    uint8_t chan = 0;
+    int beganAt = cycle;
+    int chan = 0;
 
     // Increase age of all working notes;
     for(Note &ch : channels)
@@ -2067,7 +2279,7 @@ uint8_t Generator::NotesManager::noteOn(int note, uint32_t volume, uint8_t ccvol
             int age = -1;
             int oldest = -1;
             // Find oldest note
-            for(uint8_t c = 0; c < channels.size(); c++)
+            for(int c = 0; c < channels.size(); c++)
             {
                 if((channels[c].note >= 0) && ((age == -1) || (channels[c].age > age)))
                 {
@@ -2078,7 +2290,7 @@ uint8_t Generator::NotesManager::noteOn(int note, uint32_t volume, uint8_t ccvol
 
             if(age >= 0)
             {
-                chan = (uint8_t)oldest;
+                chan = oldest;
                 channels[chan].note = note;
                 channels[chan].volume = volume;
                 channels[chan].ccvolume = ccvolume;
@@ -2096,9 +2308,9 @@ uint8_t Generator::NotesManager::noteOn(int note, uint32_t volume, uint8_t ccvol
     return chan;
 }
 
-int8_t Generator::NotesManager::noteOff(int note)
+int Generator::NotesManager::noteOff(int note)
 {
-    int8_t chan = findNoteOffChannel(note);
+    int chan = findNoteOffChannel(note);
     if(chan != -1)
         channelOff(chan);
     return chan;
@@ -2109,13 +2321,13 @@ void Generator::NotesManager::channelOff(int ch)
     channels[ch].note = -1;
 }
 
-int8_t Generator::NotesManager::findNoteOffChannel(int note)
+int Generator::NotesManager::findNoteOffChannel(int note)
 {
     // find the first active note not in held state (delayed noteoff)
-    for(uint8_t chan = 0; chan < channels.size(); chan++)
+    for(int chan = 0; chan < channels.size(); chan++)
     {
         if(channels[chan].note == note && !channels[chan].held)
-            return (int8_t)chan;
+            return chan;
     }
     return -1;
 }
@@ -2127,6 +2339,6 @@ void Generator::NotesManager::hold(int ch, bool h)
 
 void Generator::NotesManager::clearNotes()
 {
-    for(uint8_t chan = 0; chan < channels.size(); chan++)
+    for(int chan = 0; chan < channels.size(); chan++)
         channels[chan].note = -1;
 }
@@ -25,6 +25,9 @@
 #include <QObject>
 
 #include "chips/opl_chip_base.h"
+#include "mixer.h"
+#include "multichip_engine.h"
+#include "shadow_registers.h"
 #include "../bank.h"
 
 #ifdef ENABLE_HW_OPL_PROXY
@@ -35,7 +38,10 @@ class Win9x_OPL_Proxy;
 class OPL_SerialPort;
 #endif
 
+class OPLRegisterCapture;
+
 #define NUM_OF_CHANNELS         23
+#define MAX_OF_CHIPS            8
 #define MAX_OPLGEN_BUFFER_SIZE  4096
 
 struct OPL_Operator
@@ -75,6 +81,10 @@ struct GeneratorDebugInfo
     int chan2op = -1;
     int chanPs4op = -1;
     int chan4op = -1;
+    //! Register writes passed to the chip
+    quint64 regWrites = 0;
+    //! Register writes skipped as redundant
+    quint64 regSkipped = 0;
     QString toStr();
 };
 
@@ -94,14 +104,42 @@ public:
         CHIP_SerialPort,
         CHIP_END
     };
-    Generator(uint32_t sampleRate, OPL_Chips initialChip);
+    /**
+     * @param sampleRate Output sample rate
+     * @param initialChip Chip emulator
+     * @param chipsCount Count of emulated chips, voices are allocated on all of them
+     */
+    Generator(uint32_t sampleRate, OPL_Chips initialChip, unsigned chipsCount = 1);
     ~Generator();
 
     void initChip();
     void switchChip(OPL_Chips chipId);
 
+    /**
+     * @brief Change the count of emulated chips, the hardware has always one chip
+     * @param count Count of chips, from 1 to MAX_OF_CHIPS
+     *
+     * Chips are rendered concurrently, so more chips are giving more voices
+     * without the extra latency. Chips are re-created and initialized.
+     */
+    void setChipsCount(unsigned count);
+    unsigned chipsCount() const
+        { return m_engine.chipsCount(); }
+
     void generate(int16_t *frames, unsigned nframes);
 
+    /**
+     * @brief Generate 32-bit floating point stereo frames, full scale is 1.0
+     * @param frames Output buffer
+     * @param nframes Count of frames
+     */
+    void generate(float *frames, unsigned nframes);
+
+    /**
+     * @brief Enable the look-ahead soft limiter on the output
+     */
+    void setSoftLimiter(bool enabled);
+
     /**
      * @brief Set the tone frequency on the chip channel and turn note on
      * @param c1 2-op channel or 4-op master channel index
@@ -165,6 +203,16 @@ public:
     void Hold(bool held);
 
     void changePatch(const FmBank::Instrument &instrument, bool isDrum = false);
+
+    /**
+     * @brief Apply the edited instrument without interrupting of playing notes
+     * @param instrument Instrument data
+     * @param isDrum Is percussion instrument
+     *
+     * Playing notes are receiving only registers of changed fields. Changes of
+     * the voice layout (4-op, pseudo 4-op or rhythm mode) are done by changePatch().
+     */
+    void updatePatch(const FmBank::Instrument &instrument, bool isDrum = false);
     void changeNote(int newnote);
     void changeDeepTremolo(bool enabled);
     void changeDeepVibrato(bool enabled);
@@ -176,6 +224,30 @@ public:
     const GeneratorDebugInfo &debugInfo() const
         { return m_debug; }
 
+    /**
+     * @brief Registers written into the chip with per-register write and skip counters
+     * @param chip Index of the chip
+     */
+    const OPLShadowRegisters &shadowRegisters(unsigned chip = 0) const
+        { return m_shadow[chip]; }
+
+    /**
+     * @brief Start recording of register writes into the log
+     * @param capture Capture to fill, its log is cleared and gets the state of the chip first
+     *
+     * Only the first chip is recorded, it plays the rhythm-mode percussion and
+     * the first voice. Writes are passed to the capture without locks and
+     * allocations, the caller drains them into the log while recording.
+     * Must be called when the generator doesn't render.
+     */
+    void startCapture(OPLRegisterCapture *capture);
+
+    /**
+     * @brief Stop recording of register writes, the log gets the rest of writes and its length
+     * Must be called when the generator doesn't render.
+     */
+    void stopCapture();
+
 #ifdef ENABLE_HW_OPL_PROXY
     static Win9x_OPL_Proxy &oplProxy();
 #endif
@@ -188,7 +260,37 @@ private:
     GeneratorDebugInfo m_debug;
 
 private:
-    void WriteReg(uint16_t address, uint8_t byte);
+    void WriteReg(uint32_t chip, uint16_t address, uint8_t byte);
+    //! Write the register of every chip
+    void WriteRegAll(uint16_t address, uint8_t byte);
+
+    /**
+     * @brief Chip channels of the voice of the notes manager
+     * @param ch Voice index
+     * @param adlchannel Receives the first and the second channel, they are the same with 2-op
+     * @return Count of channels used by the voice
+     */
+    int voiceChannels(int ch, uint32_t adlchannel[2]) const;
+    //! Turn off the note of the voice of the notes manager
+    void voiceOff(int ch);
+
+    /**
+     * @brief Groups of voice registers changed between two patches
+     */
+    enum PatchDelta
+    {
+        //! AM/VIB/EG/KSR/MULT, attack/decay, sustain/release and waveform
+        PATCH_OPERATORS = 0x01,
+        //! KSL/attenuation
+        PATCH_LEVELS    = 0x02,
+        //! Feedback/connection
+        PATCH_FEEDCONN  = 0x04,
+        //! Note tone and fine tuning
+        PATCH_PITCH     = 0x08
+    };
+
+    static void buildPatch(OPL_PatchSetup &patch, const FmBank::Instrument &instrument, bool isDrum);
+    static unsigned patchDelta(const OPL_PatchSetup &from, const OPL_PatchSetup &to, int voice);
 
     class NotesManager
     {
@@ -212,15 +314,15 @@ private:
         //! Channels range, contains entries count equal to chip channels
         QVector<Note> channels;
         //! Round-Robin cycler. Looks for any free channel that is not busy. Otherwise, oldest busy note will be replaced
-        uint8_t cycle = 0;
+        int cycle = 0;
     public:
         NotesManager();
         ~NotesManager();
         void allocateChannels(int count);
-        uint8_t noteOn(int note, uint32_t volume, uint8_t ccvolume, uint8_t ccexpr, bool *replace = nullptr);
-        int8_t  noteOff(int note);
+        int noteOn(int note, uint32_t volume, uint8_t ccvolume, uint8_t ccexpr, bool *replace = nullptr);
+        int     noteOff(int note);
         void    channelOff(int ch);
-        int8_t  findNoteOffChannel(int note);
+        int     findNoteOffChannel(int note);
         void hold(int ch, bool h);
         void clearNotes();
         const Note &channel(int ch) const
@@ -243,9 +345,28 @@ private:
 
     uint32_t    m_rate = 44100;
 
+    static bool isHardwareChip(OPLChipBase *chip);
+    static OPLChipBase *createChip(OPL_Chips chipId);
     struct OPLChipDelete { void operator()(OPLChipBase *); };
-    std::unique_ptr<OPLChipBase, OPLChipDelete> chip;
     OPLChipBase::ChipType m_chipType = OPLChipBase::CHIPTYPE_OPL3;
+    OPL_Chips   m_chipId = CHIP_Nuked;
+    //! Requested count of emulated chips
+    unsigned    m_chipsCount = 1;
+
+    //! Frames processed by the mixer at once
+    enum { MIX_CHUNK_FRAMES = 512 };
+    //! Register writes preallocated on the chip for one mixer chunk, up to 4 per frame
+    enum { SCHEDULE_RESERVE_WRITES = 4 * MIX_CHUNK_FRAMES };
+    float       m_mixBuffer[2 * MIX_CHUNK_FRAMES];
+    //! Owns and renders chips, all together are giving the voices to the notes manager
+    MultiChipEngine m_engine;
+    //! Last written registers of every chip, redundant writes are not reaching the chip
+    OPLShadowRegisters m_shadow[MAX_OF_CHIPS];
+    //! Receives register writes, null unless recording
+    OPLRegisterCapture *m_capture = nullptr;
+    //! Sample position of the recording
+    uint64_t    m_captureFrame = 0;
+    SoftLimiter m_limiter;
 
     OPL_PatchSetup m_patch;
     uint8_t     m_regBD;
@@ -275,6 +396,7 @@ private:
         ChanCat_Rhythm_Slave    = 8
     };
 
+    //! Categories of channels of one chip, every chip has the same layout
     int8_t      m_four_op_category[NUM_OF_CHANNELS * 2];
     // 1 = quad-master, 2 = quad-slave, 0 = regular
     // 3 = percussion BassDrum
@@ -285,9 +407,9 @@ private:
     // 8 = percussion slave
 
     //! index of operators pair, cached, needed by Touch()
-    uint16_t    m_ins[NUM_OF_CHANNELS];
+    uint16_t    m_ins[NUM_OF_CHANNELS * MAX_OF_CHIPS];
     //! value poked to B0, cached, needed by NoteOff)(
-    uint8_t     m_keyBlockFNumCache[NUM_OF_CHANNELS];
+    uint8_t     m_keyBlockFNumCache[NUM_OF_CHANNELS * MAX_OF_CHIPS];
 };
 
 #endif // GENERATOR_H
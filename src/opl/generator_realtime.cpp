@@ -59,11 +59,6 @@ struct ChordMessage
     unsigned note;
 };
 
-struct PatchChangeMessage
-{
-    FmBank::Instrument instrument;
-    bool isDrum;
-};
 // End Messages
 
 enum { fifo_capacity = 8192 };
@@ -114,6 +109,26 @@ void RealtimeGenerator::ctl_switchChip(int chipId)
     m_gen->switchChip((Generator::OPL_Chips)chipId);
 }
 
+void RealtimeGenerator::ctl_setChipsCount(int count)
+{
+    // non-RT, chips are re-created
+    std::unique_lock<mutex_type> lock(m_generator_mutex);
+    m_gen->setChipsCount(count > 0 ? unsigned(count) : 1u);
+}
+
+void RealtimeGenerator::ctl_startCapture(OPLRegisterCapture *capture)
+{
+    // non-RT, hence lock and processing in control thread
+    std::unique_lock<mutex_type> lock(m_generator_mutex);
+    m_gen->startCapture(capture);
+}
+
+void RealtimeGenerator::ctl_stopCapture()
+{
+    std::unique_lock<mutex_type> lock(m_generator_mutex);
+    m_gen->stopCapture();
+}
+
 void RealtimeGenerator::ctl_initChip()
 {
     Ring_Buffer &rb = *m_rb_ctl;
@@ -201,14 +216,31 @@ void IRealtimeControl::ctl_playMinor7Chord()
 
 void RealtimeGenerator::ctl_changePatch(FmBank::Instrument &instrument, bool isDrum)
 {
+    postPatch(instrument, isDrum, true);
+}
+
+void RealtimeGenerator::ctl_updatePatch(FmBank::Instrument &instrument, bool isDrum)
+{
+    postPatch(instrument, isDrum, false);
+}
+
+void RealtimeGenerator::postPatch(const FmBank::Instrument &instrument, bool isDrum, bool reset)
+{
+    {
+        std::unique_lock<mutex_type> lock(m_patch_mutex);
+        PendingPatch &pp = m_pendingPatch;
+        pp.instrument = instrument;
+        pp.isDrum = isDrum;
+        pp.reset = pp.reset || reset;
+        if(pp.queued)
+            return; // coalesced with the message which is already in the queue
+        pp.queued = true;
+    }
+
     Ring_Buffer &rb = *m_rb_ctl;
-    MessageHeader hdr = {MSG_CtlPatchChange, sizeof(PatchChangeMessage)};
+    MessageHeader hdr = {MSG_CtlPatchChange, 0};
     wait_for_fifo_write_space(rb, hdr.size);
     rb.put(hdr);
-    PatchChangeMessage pc;
-    pc.instrument = instrument;
-    pc.isDrum = isDrum;
-    rb.put(pc);
 }
 
 void RealtimeGenerator::ctl_changeDeepVibrato(bool enabled)
@@ -264,7 +296,7 @@ void RealtimeGenerator::midi_event(const uint8_t *msg, unsigned msglen)
 }
 
 /* Realtime */
-void RealtimeGenerator::rt_generate(int16_t *frames, unsigned nframes)
+void RealtimeGenerator::rt_generate(float *frames, unsigned nframes)
 {
     std::unique_lock<mutex_type> lock(m_generator_mutex, std::try_to_lock);
     if(!lock.owns_lock()) {
@@ -278,6 +310,14 @@ void RealtimeGenerator::rt_generate(int16_t *frames, unsigned nframes)
     for(Ring_Buffer &rb = *m_rb_ctl;
          rb.peek(header) && rb.size_used() >= sizeof(header) + header.size;)
     {
+        if(header.tag == MSG_CtlPatchChange)
+        {
+            // the pending patch is being written, retry on the next block
+            if(!rt_patch_process())
+                break;
+            rb.discard(sizeof(header));
+            continue;
+        }
         rb.discard(sizeof(header));
         rb.get(m_body.get(), header.size);
         rt_message_process(header.tag, m_body.get(), header.size);
@@ -295,6 +335,24 @@ void RealtimeGenerator::rt_generate(int16_t *frames, unsigned nframes)
     m_gen->generate(frames, nframes);
 }
 
+bool RealtimeGenerator::rt_patch_process()
+{
+    std::unique_lock<mutex_type> lock(m_patch_mutex, std::try_to_lock);
+    if(!lock.owns_lock())
+        return false;
+
+    PendingPatch pp = m_pendingPatch;
+    m_pendingPatch.reset = false;
+    m_pendingPatch.queued = false;
+    lock.unlock();
+
+    if(pp.reset)
+        m_gen->changePatch(pp.instrument, pp.isDrum);
+    else
+        m_gen->updatePatch(pp.instrument, pp.isDrum);
+    return true;
+}
+
 void RealtimeGenerator::rt_message_process(int tag, const uint8_t *data, unsigned len)
 {
     Generator &gen = *m_gen;
@@ -348,11 +406,6 @@ void RealtimeGenerator::rt_message_process(int tag, const uint8_t *data, unsigne
         }
         break;
     }
-    case MSG_CtlPatchChange: {
-        const PatchChangeMessage &pc = *(PatchChangeMessage *)data;
-        gen.changePatch(pc.instrument, pc.isDrum);
-        break;
-    }
     case MSG_CtlDeepVibrato:
         gen.changeDeepVibrato(*(bool *)data);
         break;
@@ -34,6 +34,7 @@
 #endif
 
 class Generator;
+class OPLRegisterCapture;
 struct GeneratorDebugInfo;
 
 /**
@@ -46,7 +47,16 @@ public:
     IRealtimeControl(QObject *parent = nullptr);
     virtual ~IRealtimeControl() {}
     virtual void ctl_switchChip(int chipId) = 0;
+    /**
+     * @brief Set the count of emulated chips, voices are allocated on all of them
+     */
+    virtual void ctl_setChipsCount(int count) = 0;
     virtual void ctl_initChip() = 0;
+    /**
+     * @brief Start recording of register writes, the log must be alive till the stop
+     */
+    virtual void ctl_startCapture(OPLRegisterCapture *capture) = 0;
+    virtual void ctl_stopCapture() = 0;
 
 public slots:
     void changeNote(int note) { m_note = note; }
@@ -67,6 +77,10 @@ public slots:
     void ctl_playMinor7Chord();
 
     virtual void ctl_changePatch(FmBank::Instrument &instrument, bool isDrum = false) = 0;
+    /**
+     * @brief Send the edited instrument, playing notes are kept and only changed registers are written
+     */
+    virtual void ctl_updatePatch(FmBank::Instrument &instrument, bool isDrum = false) = 0;
     virtual void ctl_changeDeepVibrato(bool enabled) = 0;
     virtual void ctl_changeDeepTremolo(bool enabled) = 0;
     virtual void ctl_changeVolumeModel(int model) = 0;
@@ -103,7 +117,10 @@ class IRealtimeProcess
 {
 public:
     virtual ~IRealtimeProcess() {}
-    virtual void rt_generate(int16_t *frames, unsigned nframes) = 0;
+    /**
+     * @brief Generate 32-bit floating point stereo frames, full scale is 1.0
+     */
+    virtual void rt_generate(float *frames, unsigned nframes) = 0;
 };
 
 class RealtimeGenerator :
@@ -120,7 +137,10 @@ private:
 public:
     /* Control */
     void ctl_switchChip(int chipId) override;
+    void ctl_setChipsCount(int count) override;
     void ctl_initChip() override;
+    void ctl_startCapture(OPLRegisterCapture *capture) override;
+    void ctl_stopCapture() override;
     void ctl_silence() override;
     void ctl_noteOffAllChans() override;
     void ctl_playNote() override;
@@ -129,6 +149,7 @@ public:
     void ctl_hold(bool held) override;
     void ctl_playChord(int chord) override;
     void ctl_changePatch(FmBank::Instrument &instrument, bool isDrum = false) override;
+    void ctl_updatePatch(FmBank::Instrument &instrument, bool isDrum = false) override;
     void ctl_changeDeepVibrato(bool enabled) override;
     void ctl_changeDeepTremolo(bool enabled) override;
     void ctl_changeVolumeModel(int model) override;
@@ -136,9 +157,11 @@ public:
     /* MIDI */
     void midi_event(const uint8_t *msg, unsigned msglen) override;
     /* Realtime */
-    void rt_generate(int16_t *frames, unsigned nframes) override;
+    void rt_generate(float *frames, unsigned nframes) override;
 
 private:
+    void postPatch(const FmBank::Instrument &instrument, bool isDrum, bool reset);
+    bool rt_patch_process();
     void rt_message_process(int tag, const uint8_t *data, unsigned len);
     void rt_midi_process(const uint8_t *data, unsigned len);
 
@@ -200,6 +223,24 @@ private:
     WindowsMutex m_generator_mutex;
     typedef WindowsMutex mutex_type;
 #endif
+
+    /**
+     * @brief Latest instrument which is waiting for the audio thread
+     *
+     * Only one patch message is queued at time, edits made before it's
+     * processed are replacing the pending instrument.
+     */
+    struct PendingPatch
+    {
+        FmBank::Instrument instrument;
+        bool isDrum = false;
+        //! Silence and reload everything instead of applying changes only
+        bool reset = false;
+        //! Patch message is in the control queue
+        bool queued = false;
+    };
+    PendingPatch m_pendingPatch;
+    mutex_type m_patch_mutex;
 };
 
 
@@ -21,6 +21,7 @@
 #include <QFuture>
 #endif
 #include <QQueue>
+#include <QThread>
 #include <QProgressDialog>
 
 #include <vector>
@@ -31,8 +32,12 @@
 #include <cstring>
 #include <cstdio>
 #include <limits>
+#include <complex>
+#include <algorithm>
+#include <functional>
 
 #include "measurer.h"
+#include "register_log.h"
 
 #ifndef M_PI
 #define M_PI    3.14159265358979323846
@@ -55,6 +60,14 @@ typedef DosBoxOPL3 DefaultOPL3;
 
 typedef Measurer::DurationInfo DurationInfo;
 
+//! Accurate emulator to confirm uncertain results of the default one
+typedef NukedOPL3 AccurateOPL3;
+
+//! Raise of delay thresholds to estimate the sensitivity of delays to the output level (+6 dB)
+static const double g_sensitivityRatio = 2.0;
+//! Smallest shift of the delay which is considered as sensitive, analysis periods
+static const size_t g_sensitivityMinShift = 10;
+
 template <class T>
 class AudioHistory
 {
@@ -407,6 +420,12 @@ static void ComputeDurations(const FmBank::Instrument *in_p, DurationInfo *resul
     size_t keyoff_out_time        = 0;
     bool   keyoff_out_time_found  = false;
 
+    /* Same delays at raised thresholds, to see how stable are the results */
+    size_t quarter_high_time      = max_period_on;
+    bool   quarter_high_time_found = false;
+    size_t keyoff_high_time       = 0;
+    bool   keyoff_high_time_found = false;
+
     const size_t audioBufferLength = 256;
     const size_t audioBufferSize = 2 * audioBufferLength;
     int16_t audioBuffer[audioBufferSize];
@@ -460,12 +479,20 @@ static void ComputeDurations(const FmBank::Instrument *in_p, DurationInfo *resul
             peak_amplitude_time  = period;
             // In next step, update the quater amplitude time
             quarter_amplitude_time_found = false;
+            quarter_high_time_found = false;
         }
         else if(!quarter_amplitude_time_found && (rms <= peak_amplitude_value * min_coefficient_on))
         {
             quarter_amplitude_time = period;
             quarter_amplitude_time_found = true;
         }
+
+        if(period > 0 && !quarter_high_time_found &&
+           (rms <= peak_amplitude_value * min_coefficient_on * g_sensitivityRatio))
+        {
+            quarter_high_time = period;
+            quarter_high_time_found = true;
+        }
         /* ======== Peak time detection =END==== */
 #if defined(ENABLE_PLOTS) || defined(DEBUG_AMPLITUDE_PEAK_VALIDATION) || defined(DEBUG_WRITE_AMPLITUDE_PLOT)
         amplitudecurve_on.push_back(rms);
@@ -481,6 +508,8 @@ static void ComputeDurations(const FmBank::Instrument *in_p, DurationInfo *resul
 
     if(!quarter_amplitude_time_found)
         quarter_amplitude_time = windows_passed_on;
+    if(!quarter_high_time_found)
+        quarter_high_time = windows_passed_on;
 
 #ifdef DEBUG_AMPLITUDE_PEAK_VALIDATION
     char outBufOld[250];
@@ -599,6 +628,11 @@ static void ComputeDurations(const FmBank::Instrument *in_p, DurationInfo *resul
             keyoff_out_time = period;
             keyoff_out_time_found = true;
         }
+        if(!keyoff_high_time_found && (rms <= peak_amplitude_value * min_coefficient_off * g_sensitivityRatio))
+        {
+            keyoff_high_time = period;
+            keyoff_high_time_found = true;
+        }
         /* ======== Find Key Off time ==END=== */
 #if defined(ENABLE_PLOTS) || defined(DEBUG_AMPLITUDE_PEAK_VALIDATION) || defined(DEBUG_WRITE_AMPLITUDE_PLOT)
         amplitudecurve_off.push_back(rms);
@@ -643,6 +677,20 @@ static void ComputeDurations(const FmBank::Instrument *in_p, DurationInfo *resul
     result.ms_sound_kon  = (int64_t)(quarter_amplitude_time * 1000.0 / interval);
     result.ms_sound_koff = (int64_t)(keyoff_out_time        * 1000.0 / interval);
     result.nosound = (peak_amplitude_value < 0.5) || ((sound_min >= -1) && (sound_max <= 1));
+
+    // Delays which are moving far away with a slightly different output level are uncertain
+    result.threshold_sensitivity = 0.0;
+    if(quarter_amplitude_time > quarter_high_time + g_sensitivityMinShift)
+        result.threshold_sensitivity = double(quarter_amplitude_time - quarter_high_time) / double(quarter_amplitude_time);
+    if(keyoff_out_time_found && keyoff_high_time_found && (keyoff_out_time > keyoff_high_time + g_sensitivityMinShift))
+    {
+        double off = double(keyoff_out_time - keyoff_high_time) / double(keyoff_out_time);
+        if(off > result.threshold_sensitivity)
+            result.threshold_sensitivity = off;
+    }
+
+    result.near_silence = (sound_min != 0 || sound_max != 0) &&
+                          ((peak_amplitude_value < 4.0) || ((sound_min >= -8) && (sound_max <= 8)));
 }
 
 static void ComputeDurationsDefault(const FmBank::Instrument *in, DurationInfo *result)
@@ -651,6 +699,13 @@ static void ComputeDurationsDefault(const FmBank::Instrument *in, DurationInfo *
     ComputeDurations(in, result, &chip);
 }
 
+static void ApplyDurations(FmBank::Instrument &in, const DurationInfo &result)
+{
+    in.ms_sound_kon = (uint16_t)result.ms_sound_kon;
+    in.ms_sound_koff = (uint16_t)result.ms_sound_koff;
+    in.is_blank = result.nosound;
+}
+
 static void MeasureDurations(FmBank::Instrument *in_p, OPLChipBase *chip)
 {
     FmBank::Instrument &in = *in_p;
@@ -659,9 +714,7 @@ static void MeasureDurations(FmBank::Instrument *in_p, OPLChipBase *chip)
     if(in_p->rhythm_drum_type == 0)
     {
         ComputeDurations(&in, &result, chip);
-        in.ms_sound_kon = (uint16_t)result.ms_sound_kon;
-        in.ms_sound_koff = (uint16_t)result.ms_sound_koff;
-        in.is_blank = result.nosound;
+        ApplyDurations(in, result);
     }
     else // Rhyth-mode percussion
     {
@@ -677,6 +730,221 @@ static void MeasureDurationsDefault(FmBank::Instrument *in_p)
     MeasureDurations(in_p, &chip);
 }
 
+/* ******** Tiered measurement ******** */
+
+//! Sensitivity of delays above which results of the fast emulator are confirmed
+static const double g_confirmSensitivity = 0.3;
+//! Largest difference of delays which is still an agreement of emulators, milliseconds
+static const int64_t g_agreementMs = 20;
+
+static bool IsUncertain(const DurationInfo &result)
+{
+    return result.near_silence || (result.threshold_sensitivity > g_confirmSensitivity);
+}
+
+static bool IsSameDelay(int64_t a, int64_t b)
+{
+    int64_t diff = (a > b) ? (a - b) : (b - a);
+    int64_t big = (a > b) ? a : b;
+    return (diff <= g_agreementMs) || (diff * 20 <= big); // Within 5%
+}
+
+struct MeasureTask
+{
+    FmBank::Instrument      *ins;
+    Measurer::MeasureMode   mode;
+    //! Class of the sound in the agreement history of emulators
+    unsigned                soundClass;
+    //! Result of the fast emulator looks uncertain
+    bool                    uncertain;
+    //! Result was confirmed by the accurate emulator
+    bool                    confirmed;
+    //! Fast and accurate emulators are disagree
+    bool                    corrected;
+};
+
+static void MeasureDurationsTask(MeasureTask *task)
+{
+    FmBank::Instrument &in = *task->ins;
+    task->uncertain = false;
+    task->confirmed = false;
+    task->corrected = false;
+
+    if(in.rhythm_drum_type != 0 || task->mode == Measurer::MEASURE_FAST)
+    {
+        MeasureDurationsDefault(&in);
+        return;
+    }
+
+    if(task->mode == Measurer::MEASURE_ACCURATE)
+    {
+        AccurateOPL3 chip;
+        MeasureDurations(&in, &chip);
+        return;
+    }
+
+    DefaultOPL3 chip;
+    DurationInfo result;
+    ComputeDurations(&in, &result, &chip);
+    ApplyDurations(in, result);
+    task->uncertain = IsUncertain(result);
+}
+
+static void ConfirmDurationsTask(MeasureTask *task)
+{
+    FmBank::Instrument &in = *task->ins;
+    AccurateOPL3 chip;
+    DurationInfo result;
+    ComputeDurations(&in, &result, &chip);
+
+    task->confirmed = true;
+    task->corrected = (in.is_blank != result.nosound) ||
+                      !IsSameDelay(in.ms_sound_kon, result.ms_sound_kon) ||
+                      !IsSameDelay(in.ms_sound_koff, result.ms_sound_koff);
+    ApplyDurations(in, result);
+}
+
+/**
+ * @brief Coarse class of the sound to collect the agreement history of emulators
+ *
+ * Emulators are mostly disagree on slow envelopes, so the class is made
+ * of the slowest decay and release rates of output operators.
+ */
+static unsigned SoundClass(const FmBank::Instrument &ins)
+{
+    unsigned dr = 15, rr = 15, eg = 0;
+    int ops = ins.en_4op ? 4 : 2;
+    for(int op = 0; op < ops; op++)
+    {
+        if(!ins.isOutputOperator(op))
+            continue;
+        dr = qMin(dr, unsigned(ins.OP[op].decay));
+        rr = qMin(rr, unsigned(ins.OP[op].release));
+        eg |= ins.OP[op].eg ? 1 : 0;
+    }
+    return rr | (dr << 4) | (eg << 8) | ((ins.en_4op ? 1 : 0) << 9);
+}
+
+/* ******** Loudness analysis ******** */
+
+//! Duration of the rendered key-on interval for the loudness analysis
+static const unsigned g_loudnessRenderMs = 1000;
+//! Attenuation step of the total level, dB
+static const double g_levelStepDb = 0.75;
+
+static double ToDecibels(double value)
+{
+    return (value > 0.000001) ? (20.0 * std::log10(value)) : -120.0;
+}
+
+unsigned Measurer::velocityAttenuation(int velocity)
+{
+    // Same formula as generator uses: SOLVE(V=127^3 * 2^( (A-63.49999) / 8), A)
+    double volume = double(velocity) * 127.0 * 127.0 * 127.0;
+    if(volume <= 8725.0 * 127.0)
+        return 63;
+    int v = int(std::log(volume) * 11.541560327111707 - 1.601379199767093e+02);
+    v = (v < 0) ? 0 : ((v > 63) ? 63 : v);
+    return unsigned(63 - v);
+}
+
+struct LoudnessTask
+{
+    FmBank::Instrument      ins;
+    int                     note;
+    int                     velocity;
+    Measurer::LoudnessInfo  *out;
+};
+
+static void ComputeLoudness(LoudnessTask &task, OPLChipBase *chip)
+{
+    FmBank::Instrument in = task.ins;
+    Measurer::LoudnessInfo &result = *task.out;
+
+    unsigned att = Measurer::velocityAttenuation(task.velocity);
+    for(int op = 0; op < 4; op++)
+    {
+        if(!in.isOutputOperator(op))
+            continue;
+        int level = int(in.OP[op].level) - int(att);
+        in.OP[op].level = uint8_t((level < 0) ? 0 : level);
+    }
+
+    TinySynth synth;
+    synth.m_chip = chip;
+    synth.resetChip();
+    synth.setInstrument(&in);
+    if(in.percNoteNum == 0)
+        synth.m_notenum = task.note;
+    synth.noteOn();
+
+    const size_t frames = size_t(g_outputRate) * g_loudnessRenderMs / 1000;
+    const size_t audioBufferLength = 256;
+    int16_t audioBuffer[2 * audioBufferLength];
+
+    double sum = 0.0;
+    int peak = 0;
+    for(size_t i = 0; i < frames;)
+    {
+        size_t blocksize = frames - i;
+        blocksize = (blocksize < audioBufferLength) ? blocksize : audioBufferLength;
+        synth.generate(audioBuffer, blocksize);
+        for(size_t j = 0; j < blocksize; ++j)
+        {
+            int sample = audioBuffer[2 * j];
+            sum += double(sample) * sample;
+            sample = (sample < 0) ? -sample : sample;
+            if(sample > peak)
+                peak = sample;
+        }
+        i += blocksize;
+    }
+
+    result.peak_db = ToDecibels(peak / 32768.0);
+    result.rms_db  = ToDecibels(std::sqrt(sum / double(frames)) / 32768.0);
+    result.nosound = (peak <= 1);
+    result.valid   = true;
+}
+
+static void ComputeLoudnessDefault(LoudnessTask &task)
+{
+    DefaultOPL3 chip;
+    ComputeLoudness(task, &chip);
+}
+
+static QByteArray SoundKey(const FmBank::Instrument &ins)
+{
+    // Only the data which are affecting the sound are making the key
+    QByteArray key;
+    key.reserve(32);
+    for(int op = 0; op < 4; op++)
+    {
+        key.append(char(ins.getAVEKM(op)));
+        key.append(char(ins.getKSLL(op)));
+        key.append(char(ins.getAtDec(op)));
+        key.append(char(ins.getSusRel(op)));
+        key.append(char(ins.getWaveForm(op)));
+    }
+    key.append(char(ins.getFBConn1()));
+    key.append(char(ins.getFBConn2()));
+    key.append(char((ins.en_4op ? 1 : 0) | (ins.en_pseudo4op ? 2 : 0)));
+    key.append(char(ins.percNoteNum));
+    key.append(char(ins.fine_tune));
+    key.append(char(ins.note_offset1 & 0xFF));
+    key.append(char((ins.note_offset1 >> 8) & 0xFF));
+    key.append(char(ins.note_offset2 & 0xFF));
+    key.append(char((ins.note_offset2 >> 8) & 0xFF));
+    return key;
+}
+
+static QByteArray LoudnessKey(const FmBank::Instrument &ins, int note, int velocity)
+{
+    QByteArray key = SoundKey(ins);
+    key.append(char(note));
+    key.append(char(velocity));
+    return key;
+}
+
 static void MeasureDurationsBenchmark(FmBank::Instrument *in_p, OPLChipBase *chip, QVector<Measurer::BenchmarkResult> *result)
 {
     std::chrono::steady_clock::time_point start, stop;
@@ -707,13 +975,447 @@ static void MeasureDurationsBenchmarkRunner(FmBank::Instrument *in_p, QVector<Me
         MeasureDurationsBenchmark(in_p, p.get(), result);
 }
 
+/* ******** Conformance checking ******** */
+
+//! Duration of the key-on interval of the conformance rendering
+static const unsigned g_conformanceKonMs = 500;
+//! Duration of the key-off interval of the conformance rendering
+static const unsigned g_conformanceKoffMs = 250;
+//! Size of the spectrum analysis frame (must be a power of two)
+static const unsigned g_spectrumFrame = 1024;
+//! Magnitudes below this level are not counted by the spectral comparison
+static const double g_spectrumFloorDb = -90.0;
+
+static void RenderConformance(const FmBank::Instrument *in_p, OPLChipBase *chip, std::vector<int16_t> &output)
+{
+    TinySynth synth;
+    synth.m_chip = chip;
+    synth.resetChip();
+    synth.setInstrument(in_p);
+
+    const size_t framesOn = size_t(g_outputRate) * g_conformanceKonMs / 1000;
+    const size_t framesOff = size_t(g_outputRate) * g_conformanceKoffMs / 1000;
+    const size_t audioBufferLength = 256;
+
+    output.assign(2 * (framesOn + framesOff), 0);
+
+    synth.noteOn();
+    for(size_t i = 0; i < framesOn;)
+    {
+        size_t blocksize = std::min(framesOn - i, audioBufferLength);
+        synth.generate(&output[2 * i], blocksize);
+        i += blocksize;
+    }
+
+    synth.noteOff();
+    for(size_t i = framesOn; i < framesOn + framesOff;)
+    {
+        size_t blocksize = std::min(framesOn + framesOff - i, audioBufferLength);
+        synth.generate(&output[2 * i], blocksize);
+        i += blocksize;
+    }
+}
+
+static void FFTInPlace(std::complex<double> *data, unsigned n)
+{
+    for(unsigned i = 1, j = 0; i < n; ++i)
+    {
+        unsigned bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j)
+            std::swap(data[i], data[j]);
+    }
+
+    for(unsigned len = 2; len <= n; len <<= 1)
+    {
+        double angle = -2.0 * M_PI / len;
+        std::complex<double> wlen(std::cos(angle), std::sin(angle));
+        for(unsigned i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1.0, 0.0);
+            for(unsigned j = 0; j < len / 2; ++j)
+            {
+                std::complex<double> u = data[i + j];
+                std::complex<double> v = data[i + j + len / 2] * w;
+                data[i + j] = u + v;
+                data[i + j + len / 2] = u - v;
+                w *= wlen;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Log-magnitude spectra of the mono mix, one g_spectrumFrame / 2 row per frame
+ */
+static void ComputeSpectra(const std::vector<int16_t> &pcm, std::vector<double> &spectra)
+{
+    const unsigned n = g_spectrumFrame;
+    const size_t frames = pcm.size() / 2;
+    const size_t count = frames / n;
+
+    std::vector<double> window(n);
+    HannWindow(window.data(), n);
+
+    std::vector<std::complex<double> > buf(n);
+    spectra.assign(count * (n / 2), g_spectrumFloorDb);
+
+    for(size_t f = 0; f < count; ++f)
+    {
+        for(unsigned i = 0; i < n; ++i)
+        {
+            size_t at = 2 * (f * n + i);
+            double mono = (double(pcm[at]) + double(pcm[at + 1])) / (2.0 * 32768.0);
+            buf[i] = std::complex<double>(mono * window[i], 0.0);
+        }
+
+        FFTInPlace(buf.data(), n);
+
+        for(unsigned i = 0; i < n / 2; ++i)
+        {
+            double mag = std::abs(buf[i]) * 4.0 / n;
+            double db = ToDecibels(mag);
+            spectra[f * (n / 2) + i] = std::max(db, g_spectrumFloorDb);
+        }
+    }
+}
+
+static double ComputeRMS(const std::vector<int16_t> &pcm)
+{
+    double sum = 0.0;
+    for(int16_t s : pcm)
+        sum += double(s) * s;
+    return pcm.empty() ? 0.0 : std::sqrt(sum / double(pcm.size()));
+}
+
+static void CompareConformance(const std::vector<int16_t> &ref, const std::vector<double> &refSpectra,
+                               const std::vector<int16_t> &test, int threshold,
+                               Measurer::ConformanceResult &res)
+{
+    const size_t count = std::min(ref.size(), test.size());
+    double diffSum = 0.0;
+
+    res.first_diverging_sample = -1;
+    res.max_sample_diff = 0;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        int d = int(test[i]) - int(ref[i]);
+        diffSum += double(d) * d;
+        d = (d < 0) ? -d : d;
+        if(d > res.max_sample_diff)
+            res.max_sample_diff = d;
+        if(d >= threshold && res.first_diverging_sample < 0)
+            res.first_diverging_sample = qint64(i / 2);
+    }
+
+    double refRms = ComputeRMS(ref);
+    double testRms = ComputeRMS(test);
+    double diffRms = count ? std::sqrt(diffSum / double(count)) : 0.0;
+
+    if(refRms > 0.0)
+        res.rms_divergence_db = std::max(ToDecibels(diffRms / refRms), -120.0);
+    else
+        res.rms_divergence_db = (diffRms > 0.0) ? 0.0 : -120.0;
+    res.level_diff_db = ToDecibels(testRms / 32768.0) - ToDecibels(refRms / 32768.0);
+
+    std::vector<double> testSpectra;
+    ComputeSpectra(test, testSpectra);
+
+    double spectralSum = 0.0;
+    size_t spectralCount = 0;
+    for(size_t i = 0, e = std::min(refSpectra.size(), testSpectra.size()); i < e; ++i)
+    {
+        // Bins where both signals are silent are not telling anything
+        if(refSpectra[i] <= g_spectrumFloorDb && testSpectra[i] <= g_spectrumFloorDb)
+            continue;
+        spectralSum += std::fabs(testSpectra[i] - refSpectra[i]);
+        ++spectralCount;
+    }
+    res.spectral_divergence_db = spectralCount ? (spectralSum / double(spectralCount)) : 0.0;
+}
+
+static void RenderConformanceLog(const OPLRegisterLog *log, OPLChipBase *chip, std::vector<int16_t> &output)
+{
+    output.clear();
+    output.reserve(size_t(2 * log->length()));
+    log->replay(*chip, [&output](const int32_t *frames, size_t nframes)
+    {
+        for(size_t i = 0; i < 2 * nframes; ++i)
+            output.push_back(int16_t(std::max(-32768, std::min(32767, frames[i]))));
+    });
+}
+
+typedef std::function<void(OPLChipBase *, std::vector<int16_t> &)> ConformanceRenderer;
+
+static void CheckConformance(const ConformanceRenderer &render,
+                             QVector<Measurer::ConformanceResult> &result,
+                             int threshold)
+{
+    std::vector<std::shared_ptr<OPLChipBase > > emuls =
+    {
+        // Reference emulator goes first
+        std::shared_ptr<OPLChipBase>(new NukedOPL3),
+        std::shared_ptr<OPLChipBase>(new NukedOPL3v174),
+        std::shared_ptr<OPLChipBase>(new DosBoxOPL3),
+        std::shared_ptr<OPLChipBase>(new OpalOPL3),
+        std::shared_ptr<OPLChipBase>(new JavaOPL3),
+        std::shared_ptr<OPLChipBase>(new Ymf262LLEOPL3)
+#ifdef ENABLE_YMFM_EMULATOR
+        , std::shared_ptr<OPLChipBase>(new YmFmOPL3)
+#endif
+    };
+
+    std::vector<int16_t> ref, test;
+    std::vector<double> refSpectra;
+    std::chrono::steady_clock::time_point start, stop;
+
+    result.clear();
+
+    for(size_t e = 0; e < emuls.size(); ++e)
+    {
+        OPLChipBase *chip = emuls[e].get();
+        Measurer::ConformanceResult res;
+        res.name = QString::fromUtf8(chip->emulatorName());
+
+        start = std::chrono::steady_clock::now();
+        render(chip, (e == 0) ? ref : test);
+        stop  = std::chrono::steady_clock::now();
+        res.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count();
+
+        if(e == 0)
+        {
+            ComputeSpectra(ref, refSpectra);
+            res.rms_divergence_db = -120.0;
+            res.level_diff_db = 0.0;
+        }
+        else
+            CompareConformance(ref, refSpectra, test, threshold, res);
+
+        result.push_back(res);
+    }
+}
+
+void Measurer::checkConformance(const FmBank::Instrument &instrument,
+                                QVector<ConformanceResult> &result,
+                                int threshold)
+{
+    using namespace std::placeholders;
+    CheckConformance(std::bind(RenderConformance, &instrument, _1, _2), result, threshold);
+}
+
+void Measurer::checkConformance(const OPLRegisterLog &log,
+                                QVector<ConformanceResult> &result,
+                                int threshold)
+{
+    using namespace std::placeholders;
+    CheckConformance(std::bind(RenderConformanceLog, &log, _1, _2), result, threshold);
+}
+
+//! Count of sounds of every class which are confirmed to learn the agreement of emulators
+static const int g_classExploreCount = 2;
+//! Count of sounds in the cache of measured delays before it gets flushed
+static const int g_durationCacheLimit = 65536;
+//! Count of sounds in the cache of loudness before it gets flushed
+static const int g_loudnessCacheLimit = 65536;
+//! Default delay between the last edit and the background measurement, milliseconds
+static const int g_measurementDebounceMs = 700;
+
 Measurer::Measurer(QWidget *parent) :
     QObject(parent),
     m_parentWindow(parent)
-{}
+{
+    m_debounce.setSingleShot(true);
+    m_debounce.setInterval(g_measurementDebounceMs);
+    connect(&m_debounce, SIGNAL(timeout()), this, SLOT(startScheduledMeasurements()));
+
+    // Leave most of cores to the UI and the audio output
+    int threads = QThread::idealThreadCount() / 2;
+    m_backgroundPool.setMaxThreadCount(threads > 0 ? threads : 1);
+}
 
 Measurer::~Measurer()
-{}
+{
+    m_debounce.stop();
+    m_scheduled.clear();
+    m_backgroundPool.clear();
+    m_backgroundPool.waitForDone();
+}
+
+QByteArray Measurer::durationKey(const FmBank::Instrument &ins)
+{
+    QByteArray key = SoundKey(ins);
+    key.append(char(ins.rhythm_drum_type));
+    return key;
+}
+
+QByteArray Measurer::cacheKey(const FmBank::Instrument &ins) const
+{
+    // Emulators are giving slightly different delays, never mix them
+    QByteArray key = durationKey(ins);
+    key.append(char(m_mode));
+    return key;
+}
+
+void Measurer::setMeasureMode(MeasureMode mode)
+{
+    m_mode = mode;
+}
+
+bool Measurer::isSuspiciousClass(unsigned soundClass) const
+{
+    QHash<unsigned, ClassStats>::const_iterator it = m_classStats.find(soundClass);
+    if(it == m_classStats.end())
+        return false;
+    return (it->checked >= g_classExploreCount) && (it->disagreed * 4 >= it->checked);
+}
+
+int Measurer::checkedInClass(unsigned soundClass) const
+{
+    QHash<unsigned, ClassStats>::const_iterator it = m_classStats.find(soundClass);
+    return (it == m_classStats.end()) ? 0 : it->checked;
+}
+
+void Measurer::recordConfirmation(unsigned soundClass, bool disagreed)
+{
+    ClassStats &st = m_classStats[soundClass];
+    st.checked++;
+    if(disagreed)
+        st.disagreed++;
+}
+
+bool Measurer::applyCachedDurations(FmBank::Instrument &ins, bool setBlank) const
+{
+    QHash<QByteArray, MeasuredDurations>::const_iterator it = m_durationCache.find(cacheKey(ins));
+    if(it == m_durationCache.end())
+        return false;
+    ins.ms_sound_kon = it->ms_sound_kon;
+    ins.ms_sound_koff = it->ms_sound_koff;
+    if(setBlank)
+        ins.is_blank = it->is_blank;
+    return true;
+}
+
+void Measurer::storeDurations(const QByteArray &key, const FmBank::Instrument &ins)
+{
+    if(m_durationCache.size() >= g_durationCacheLimit && !m_durationCache.contains(key))
+        m_durationCache.clear();
+    MeasuredDurations &d = m_durationCache[key];
+    d.ms_sound_kon = ins.ms_sound_kon;
+    d.ms_sound_koff = ins.ms_sound_koff;
+    d.is_blank = ins.is_blank;
+}
+
+void Measurer::scheduleMeasurement(bool percussion, int index, const FmBank::Instrument &ins)
+{
+#ifndef IS_QT_4
+    FmBank::Instrument blank = FmBank::emptyInst();
+    ScheduledJobPtr job(new ScheduledJob);
+    job->ins = ins;
+    job->ins.is_blank = false;
+    if(memcmp(&job->ins, &blank, sizeof(FmBank::Instrument)) == 0)
+        return; // Nothing to measure
+
+    job->percussion = percussion;
+    job->index = index;
+    job->key = cacheKey(job->ins);
+    job->mode = m_mode;
+    job->soundClass = SoundClass(job->ins);
+    job->forceConfirm = isSuspiciousClass(job->soundClass) ||
+                        (checkedInClass(job->soundClass) < g_classExploreCount);
+    job->confirmed = false;
+    job->corrected = false;
+    // Newer state of the same instrument replaces the older one
+    m_scheduled.insert(percussion ? (index | 0x40000000) : index, job);
+    m_debounce.start();
+#else
+    Q_UNUSED(percussion);
+    Q_UNUSED(index);
+    Q_UNUSED(ins);
+#endif
+}
+
+void Measurer::cancelScheduledMeasurements()
+{
+    m_debounce.stop();
+    m_scheduled.clear();
+}
+
+void Measurer::setMeasurementDebounce(int ms)
+{
+    m_debounce.setInterval(ms);
+}
+
+void Measurer::startScheduledMeasurements()
+{
+#ifndef IS_QT_4
+    QHash<int, ScheduledJobPtr> jobs;
+    jobs.swap(m_scheduled);
+
+    for(QHash<int, ScheduledJobPtr>::iterator it = jobs.begin(); it != jobs.end(); ++it)
+    {
+        ScheduledJobPtr job = it.value();
+
+        if(m_durationCache.contains(job->key))
+        {
+            emit instrumentMeasured(job->percussion, job->index);
+            continue;
+        }
+
+        // The same sound is already in work, pick its result when it will be cached
+        bool inWork = false;
+        for(QHash<QFutureWatcher<void> *, ScheduledJobPtr>::const_iterator r = m_running.begin(); r != m_running.end(); ++r)
+        {
+            if(r.value()->key == job->key)
+            {
+                inWork = true;
+                break;
+            }
+        }
+        if(inWork)
+        {
+            m_scheduled.insert(it.key(), job);
+            continue;
+        }
+
+        QFutureWatcher<void> *watcher = new QFutureWatcher<void>(this);
+        connect(watcher, SIGNAL(finished()), this, SLOT(scheduledMeasurementFinished()));
+        m_running.insert(watcher, job);
+        watcher->setFuture(QtConcurrent::run(&m_backgroundPool, [job]()
+        {
+            QThread::currentThread()->setPriority(QThread::LowestPriority);
+            MeasureTask task = {&job->ins, job->mode, job->soundClass, false, false, false};
+            MeasureDurationsTask(&task);
+            if(job->mode == MEASURE_TIERED && (task.uncertain || job->forceConfirm))
+                ConfirmDurationsTask(&task);
+            job->confirmed = task.confirmed;
+            job->corrected = task.corrected;
+        }));
+    }
+#endif
+}
+
+void Measurer::scheduledMeasurementFinished()
+{
+#ifndef IS_QT_4
+    QFutureWatcher<void> *watcher = static_cast<QFutureWatcher<void> *>(sender());
+    ScheduledJobPtr job = m_running.take(watcher);
+    watcher->deleteLater();
+    if(!job)
+        return;
+
+    storeDurations(job->key, job->ins);
+    if(job->confirmed)
+        recordConfirmation(job->soundClass, job->corrected);
+    emit instrumentMeasured(job->percussion, job->index);
+
+    // Duplicates of the finished sound are waiting for it
+    if(!m_scheduled.isEmpty() && !m_debounce.isActive())
+        startScheduledMeasurements();
+#endif
+}
 
 static void insertOrBlank(FmBank::Instrument &ins, const FmBank::Instrument &blank, QQueue<FmBank::Instrument *> &tasks)
 {
@@ -730,18 +1432,22 @@ static void insertOrBlank(FmBank::Instrument &ins, const FmBank::Instrument &bla
 
 bool Measurer::doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset)
 {
+    m_report = MeasureReport();
     QQueue<FmBank::Instrument *> tasks;
     FmBank::Instrument blank = FmBank::emptyInst();
 
     int i = 0;
     for(i = 0; i < bank.Ins_Melodic_box.size() && i < bankBackup.Ins_Melodic_box.size(); i++)
     {
-        FmBank::Instrument &ins1 = bank.Ins_Melodic_box[i];
-        FmBank::Instrument &ins2 = bankBackup.Ins_Melodic_box[i];
-        if(forceReset || (ins1.ms_sound_kon == 0) || (memcmp(&ins1, &ins2, sizeof(FmBank::Instrument)) != 0))
+        // Compare through const access first: unchanged entries must not detach shared blocks
+        const FmBank::Instrument &cins1 = bank.Ins_Melodic_box.at(i);
+        const FmBank::Instrument &cins2 = bankBackup.Ins_Melodic_box.at(i);
+        if(forceReset || (cins1.ms_sound_kon == 0) || (memcmp(&cins1, &cins2, sizeof(FmBank::Instrument)) != 0))
         {
+            FmBank::Instrument &ins1 = bank.Ins_Melodic_box[i];
             ins1.rhythm_drum_type = 0;
-            ins2.rhythm_drum_type = 0; // Just in a case, be sure this value is zero for all melodic instruments
+            if(bankBackup.Ins_Melodic_box.at(i).rhythm_drum_type != 0)
+                bankBackup.Ins_Melodic_box[i].rhythm_drum_type = 0; // Just in a case, be sure this value is zero for all melodic instruments
             insertOrBlank(ins1, blank, tasks);
         }
     }
@@ -750,10 +1456,10 @@ bool Measurer::doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset)
 
     for(i = 0; i < bank.Ins_Percussion_box.size() && i < bankBackup.Ins_Percussion_box.size(); i++)
     {
-        FmBank::Instrument &ins1 = bank.Ins_Percussion_box[i];
-        FmBank::Instrument &ins2 = bankBackup.Ins_Percussion_box[i];
-        if(forceReset || (ins1.ms_sound_kon == 0) || (memcmp(&ins1, &ins2, sizeof(FmBank::Instrument)) != 0))
-            insertOrBlank(ins1, blank, tasks);
+        const FmBank::Instrument &cins1 = bank.Ins_Percussion_box.at(i);
+        const FmBank::Instrument &cins2 = bankBackup.Ins_Percussion_box.at(i);
+        if(forceReset || (cins1.ms_sound_kon == 0) || (memcmp(&cins1, &cins2, sizeof(FmBank::Instrument)) != 0))
+            insertOrBlank(bank.Ins_Percussion_box[i], blank, tasks);
     }
     for(; i < bank.Ins_Percussion_box.size(); i++)
         insertOrBlank(bank.Ins_Percussion_box[i], blank, tasks);
@@ -761,11 +1467,100 @@ bool Measurer::doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset)
     if(tasks.isEmpty())
         return true;// Nothing to do! :)
 
+    bool ret = runTasks(tasks, !forceReset);
+
+    // Apply all calculated values into backup store to don't re-calculate same stuff
+    for(i = 0; i < bank.Ins_Melodic_box.size() && i < bankBackup.Ins_Melodic_box.size(); i++)
+    {
+        const FmBank::Instrument &ins1 = bank.Ins_Melodic_box.at(i);
+        const FmBank::Instrument &cins2 = bankBackup.Ins_Melodic_box.at(i);
+        if(cins2.ms_sound_kon == ins1.ms_sound_kon &&
+           cins2.ms_sound_koff == ins1.ms_sound_koff &&
+           cins2.is_blank == ins1.is_blank)
+            continue;
+        FmBank::Instrument &ins2 = bankBackup.Ins_Melodic_box[i];
+        ins2.ms_sound_kon  = ins1.ms_sound_kon;
+        ins2.ms_sound_koff = ins1.ms_sound_koff;
+        ins2.is_blank = ins1.is_blank;
+    }
+    for(i = 0; i < bank.Ins_Percussion_box.size() && i < bankBackup.Ins_Percussion_box.size(); i++)
+    {
+        const FmBank::Instrument &ins1 = bank.Ins_Percussion_box.at(i);
+        const FmBank::Instrument &cins2 = bankBackup.Ins_Percussion_box.at(i);
+        if(cins2.ms_sound_kon == ins1.ms_sound_kon &&
+           cins2.ms_sound_koff == ins1.ms_sound_koff &&
+           cins2.is_blank == ins1.is_blank)
+            continue;
+        FmBank::Instrument &ins2 = bankBackup.Ins_Percussion_box[i];
+        ins2.ms_sound_kon  = ins1.ms_sound_kon;
+        ins2.ms_sound_koff = ins1.ms_sound_koff;
+        ins2.is_blank = ins1.is_blank;
+    }
+
+    return ret;
+}
+
+bool Measurer::doMeasurement(FmBank::InsStorage &box, const QVector<int> &indices)
+{
+    m_report = MeasureReport();
+    QQueue<FmBank::Instrument *> tasks;
+    FmBank::Instrument blank = FmBank::emptyInst();
+
+    for(int i : indices)
+    {
+        if(i < 0 || i >= box.size())
+            continue;
+        insertOrBlank(box[i], blank, tasks);
+    }
+
+    if(tasks.isEmpty())
+        return true;
+
+    return runTasks(tasks);
+}
+
+bool Measurer::doLoudnessAnalysis(const FmBank::InsStorage &box, const QVector<int> &indices,
+                                  QVector<LoudnessInfo> &result, int note, int velocity)
+{
+    QVector<LoudnessTask> tasks;
+    QVector<QByteArray> keys;
+
+    result.clear();
+    result.resize(indices.size());
+
+    for(int k = 0; k < indices.size(); k++)
+    {
+        int i = indices[k];
+        if(i < 0 || i >= box.size() || box.at(i).is_blank)
+            continue;
+
+        QByteArray key = LoudnessKey(box.at(i), note, velocity);
+        QHash<QByteArray, LoudnessInfo>::const_iterator cached = m_loudnessCache.find(key);
+        if(cached != m_loudnessCache.end())
+        {
+            result[k] = cached.value();
+            continue;
+        }
+
+        LoudnessTask task;
+        task.ins = box.at(i);
+        task.note = note;
+        task.velocity = velocity;
+        task.out = &result[k];
+        tasks.push_back(task);
+        keys.push_back(key);
+    }
+
+    if(tasks.isEmpty())
+        return true;
+
     QProgressDialog m_progressBox(m_parentWindow);
     m_progressBox.setWindowModality(Qt::WindowModal);
-    m_progressBox.setWindowTitle(tr("Sounding delay calculation"));
+    m_progressBox.setWindowTitle(tr("Loudness analysis"));
     m_progressBox.setLabelText(tr("Please wait..."));
 
+    bool ok = true;
+
 #ifndef IS_QT_4
     QFutureWatcher<void> watcher;
     watcher.connect(&m_progressBox, SIGNAL(canceled()), &watcher, SLOT(cancel()));
@@ -773,41 +1568,149 @@ bool Measurer::doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset)
     watcher.connect(&watcher, SIGNAL(progressValueChanged(int)), &m_progressBox, SLOT(setValue(int)));
     watcher.connect(&watcher, SIGNAL(finished()), &m_progressBox, SLOT(accept()));
 
-    watcher.setFuture(QtConcurrent::map(tasks, &MeasureDurationsDefault));
+    watcher.setFuture(QtConcurrent::map(tasks, &ComputeLoudnessDefault));
 
     m_progressBox.exec();
     watcher.waitForFinished();
 
-    tasks.clear();
+    ok = !watcher.isCanceled();
+#else
+    m_progressBox.setMaximum(tasks.size());
+    m_progressBox.setValue(0);
+    for(int t = 0; t < tasks.size(); t++)
+    {
+        ComputeLoudnessDefault(tasks[t]);
+        m_progressBox.setValue(t + 1);
+        if(m_progressBox.wasCanceled())
+        {
+            ok = false;
+            break;
+        }
+    }
+#endif
 
-    // Apply all calculated values into backup store to don't re-calculate same stuff
-    for(i = 0; i < bank.Ins_Melodic_box.size() && i < bankBackup.Ins_Melodic_box.size(); i++)
+    for(int t = 0; t < tasks.size(); t++)
     {
-        FmBank::Instrument &ins1 = bank.Ins_Melodic_box[i];
-        FmBank::Instrument &ins2 = bankBackup.Ins_Melodic_box[i];
-        ins2.ms_sound_kon  = ins1.ms_sound_kon;
-        ins2.ms_sound_koff = ins1.ms_sound_koff;
-        ins2.is_blank = ins1.is_blank;
+        if(!tasks[t].out->valid)
+            continue;
+        if(m_loudnessCache.size() >= g_loudnessCacheLimit && !m_loudnessCache.contains(keys[t]))
+            m_loudnessCache.clear();
+        m_loudnessCache.insert(keys[t], *tasks[t].out);
     }
-    for(i = 0; i < bank.Ins_Percussion_box.size() && i < bankBackup.Ins_Percussion_box.size(); i++)
+
+    return ok;
+}
+
+void Measurer::computeLoudness(const FmBank::Instrument &instrument, LoudnessInfo &result,
+                               int note, int velocity)
+{
+    result = LoudnessInfo();
+    LoudnessTask task;
+    task.ins = instrument;
+    task.note = note;
+    task.velocity = velocity;
+    task.out = &result;
+    ComputeLoudnessDefault(task);
+}
+
+bool Measurer::adjustLoudness(FmBank::Instrument &instrument, const LoudnessInfo &loudness,
+                              double target_db, double tolerance_db)
+{
+    if(!loudness.valid || loudness.nosound)
+        return false;
+
+    double diff = target_db - loudness.rms_db;
+    if(std::fabs(diff) <= tolerance_db)
+        return false;
+
+    int steps = int(std::lround(diff / g_levelStepDb));
+    if(steps == 0)
+        return false;
+
+    bool modified = false;
+    for(int op = 0; op < 4; op++)
     {
-        FmBank::Instrument &ins1 = bank.Ins_Percussion_box[i];
-        FmBank::Instrument &ins2 = bankBackup.Ins_Percussion_box[i];
-        ins2.ms_sound_kon  = ins1.ms_sound_kon;
-        ins2.ms_sound_koff = ins1.ms_sound_koff;
-        ins2.is_blank = ins1.is_blank;
+        if(!instrument.en_4op && (op == CARRIER2 || op == MODULATOR2))
+            continue;
+        if(!instrument.isOutputOperator(op))
+            continue;
+        int level = int(instrument.OP[op].level) + steps;
+        level = (level < 0) ? 0 : ((level > 63) ? 63 : level);
+        if(level != instrument.OP[op].level)
+        {
+            instrument.OP[op].level = uint8_t(level);
+            modified = true;
+        }
+    }
+
+    return modified;
+}
+
+bool Measurer::normalizeLoudness(FmBank::InsStorage &box, const QVector<int> &indices,
+                                 double target_db, double tolerance_db,
+                                 QVector<int> *changed, int note, int velocity)
+{
+    QVector<int> pending = indices;
+
+    // Modulators and saturation are making the response non-linear, so repeat few passes
+    for(int pass = 0; pass < 4 && !pending.isEmpty(); ++pass)
+    {
+        QVector<LoudnessInfo> info;
+        if(!doLoudnessAnalysis(box, pending, info, note, velocity))
+            return false;
+
+        QVector<int> next;
+        for(int k = 0; k < pending.size(); k++)
+        {
+            int i = pending[k];
+            FmBank::Instrument ins = box.at(i);
+            if(!adjustLoudness(ins, info[k], target_db, tolerance_db))
+                continue; // Fits the target, or level is saturated
+
+            box[i] = ins;
+            if(changed && !changed->contains(i))
+                changed->push_back(i);
+            next.push_back(i);
+        }
+
+        pending = next;
     }
 
+    return true;
+}
+
+static bool RunMeasureStage(QWidget *parent, const QString &title, const QString &label,
+                            QVector<MeasureTask *> &tasks, void (*func)(MeasureTask *))
+{
+    if(tasks.isEmpty())
+        return true;
+
+    QProgressDialog m_progressBox(parent);
+    m_progressBox.setWindowModality(Qt::WindowModal);
+    m_progressBox.setWindowTitle(title);
+    m_progressBox.setLabelText(label);
+
+#ifndef IS_QT_4
+    QFutureWatcher<void> watcher;
+    watcher.connect(&m_progressBox, SIGNAL(canceled()), &watcher, SLOT(cancel()));
+    watcher.connect(&watcher, SIGNAL(progressRangeChanged(int,int)), &m_progressBox, SLOT(setRange(int,int)));
+    watcher.connect(&watcher, SIGNAL(progressValueChanged(int)), &m_progressBox, SLOT(setValue(int)));
+    watcher.connect(&watcher, SIGNAL(finished()), &m_progressBox, SLOT(accept()));
+
+    watcher.setFuture(QtConcurrent::map(tasks, func));
+
+    m_progressBox.exec();
+    watcher.waitForFinished();
+
     return !watcher.isCanceled();
 
 #else
     m_progressBox.setMaximum(tasks.size());
     m_progressBox.setValue(0);
-    int count = 0;
-    foreach(FmBank::Instrument *ins, tasks)
+    for(int i = 0; i < tasks.size(); i++)
     {
-        MeasureDurationsDefault(ins);
-        m_progressBox.setValue(++count);
+        func(tasks[i]);
+        m_progressBox.setValue(i + 1);
         if(m_progressBox.wasCanceled())
             return false;
     }
@@ -815,6 +1718,90 @@ bool Measurer::doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset)
 #endif
 }
 
+bool Measurer::runTasks(QQueue<FmBank::Instrument *> &tasks, bool useCache)
+{
+    // Sounds measured before (for example, in background while editing) are taken from the cache
+    QVector<MeasureTask> pending;
+    QVector<QByteArray> keys;
+    foreach(FmBank::Instrument *ins, tasks)
+    {
+        if(useCache && applyCachedDurations(*ins))
+            continue;
+        MeasureTask task = {ins, m_mode, SoundClass(*ins), false, false, false};
+        pending.push_back(task);
+        keys.push_back(cacheKey(*ins));
+    }
+    tasks.clear();
+
+    if(pending.isEmpty())
+        return true;
+
+    QVector<MeasureTask *> stage;
+    stage.reserve(pending.size());
+    for(int i = 0; i < pending.size(); i++)
+        stage.push_back(&pending[i]);
+
+    const QString title = tr("Sounding delay calculation");
+    if(!RunMeasureStage(m_parentWindow, title, tr("Please wait..."), stage, &MeasureDurationsTask))
+        return false;
+
+    if(m_mode == MEASURE_TIERED)
+    {
+        const QString label = tr("Confirming uncertain results by Nuked OPL3...");
+
+        // Uncertain results, known disagreeing sounds, and a few samples of unknown sounds
+        QHash<unsigned, int> explored;
+        stage.clear();
+        for(int i = 0; i < pending.size(); i++)
+        {
+            MeasureTask &task = pending[i];
+            if(task.ins->rhythm_drum_type != 0)
+                continue;
+            int &seen = explored[task.soundClass];
+            if(task.uncertain || isSuspiciousClass(task.soundClass) ||
+               (checkedInClass(task.soundClass) + seen < g_classExploreCount))
+            {
+                seen++;
+                stage.push_back(&task);
+            }
+        }
+
+        if(!RunMeasureStage(m_parentWindow, title, label, stage, &ConfirmDurationsTask))
+            return false;
+        foreach(MeasureTask *task, stage)
+            recordConfirmation(task->soundClass, task->corrected);
+
+        // Sounds whose disagreement is just discovered
+        stage.clear();
+        for(int i = 0; i < pending.size(); i++)
+        {
+            MeasureTask &task = pending[i];
+            if(!task.confirmed && task.ins->rhythm_drum_type == 0 && isSuspiciousClass(task.soundClass))
+                stage.push_back(&task);
+        }
+
+        if(!RunMeasureStage(m_parentWindow, title, label, stage, &ConfirmDurationsTask))
+            return false;
+        foreach(MeasureTask *task, stage)
+            recordConfirmation(task->soundClass, task->corrected);
+    }
+
+    for(int i = 0; i < pending.size(); i++)
+    {
+        const MeasureTask &task = pending[i];
+        storeDurations(keys[i], *task.ins);
+        if(task.confirmed)
+        {
+            m_report.confirmed++;
+            if(task.corrected)
+                m_report.corrected++;
+        }
+    }
+    m_report.measured += pending.size();
+
+    return true;
+}
+
 bool Measurer::doMeasurement(FmBank::Instrument &instrument)
 {
     QProgressDialog m_progressBox(m_parentWindow);
@@ -829,7 +1816,14 @@ bool Measurer::doMeasurement(FmBank::Instrument &instrument)
     watcher.connect(&watcher, SIGNAL(progressValueChanged(int)), &m_progressBox, SLOT(setValue(int)));
     watcher.connect(&watcher, SIGNAL(finished()), &m_progressBox, SLOT(accept()));
 
-    watcher.setFuture(QtConcurrent::run(&MeasureDurationsDefault, &instrument));
+    MeasureTask task = {&instrument, m_mode, SoundClass(instrument), false, false, false};
+    bool suspicious = isSuspiciousClass(task.soundClass);
+    watcher.setFuture(QtConcurrent::run([&task, suspicious]()
+    {
+        MeasureDurationsTask(&task);
+        if(task.mode == MEASURE_TIERED && (task.uncertain || suspicious))
+            ConfirmDurationsTask(&task);
+    }));
     m_progressBox.exec();
     watcher.waitForFinished();
 
@@ -837,7 +1831,10 @@ bool Measurer::doMeasurement(FmBank::Instrument &instrument)
 
 #else
     m_progressBox.show();
-    MeasureDurationsDefault(&instrument);
+    MeasureTask task = {&instrument, m_mode, SoundClass(instrument), false, false, false};
+    MeasureDurationsTask(&task);
+    if(task.mode == MEASURE_TIERED && (task.uncertain || isSuspiciousClass(task.soundClass)))
+        ConfirmDurationsTask(&task);
     return true;
 #endif
 }
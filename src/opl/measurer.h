@@ -22,9 +22,18 @@
 #include <QObject>
 #include <QWidget>
 #include <QVector>
+#include <QQueue>
+#include <QHash>
+#include <QByteArray>
+#include <QTimer>
+#include <QThreadPool>
+#include <QSharedPointer>
+#include <QFutureWatcher>
 #include <vector>
 #include "../bank.h"
 
+class OPLRegisterLog;
+
 class Measurer : public QObject
 {
     Q_OBJECT
@@ -35,9 +44,48 @@ public:
     explicit Measurer(QWidget *parent = nullptr);
     ~Measurer();
 
+    /**
+     * @brief Emulators used to measure sounding delays
+     */
+    enum MeasureMode
+    {
+        //! Fast emulator only (DOSBox)
+        MEASURE_FAST = 0,
+        //! Fast emulator, uncertain results are confirmed by the accurate one
+        MEASURE_TIERED,
+        //! Accurate emulator only (Nuked OPL3)
+        MEASURE_ACCURATE
+    };
+
+    void setMeasureMode(MeasureMode mode);
+    inline MeasureMode measureMode() const { return m_mode; }
+
+    /**
+     * @brief Statistics of the latest bank measurement
+     */
+    struct MeasureReport
+    {
+        //! Count of rendered instruments (cached sounds are not counted)
+        int measured = 0;
+        //! Count of instruments re-measured by the accurate emulator
+        int confirmed = 0;
+        //! Count of confirmed instruments whose delays were different
+        int corrected = 0;
+    };
+
+    inline const MeasureReport &lastReport() const { return m_report; }
+
     bool doMeasurement(FmBank &bank, FmBank &bankBackup, bool forceReset = false);
     bool doMeasurement(FmBank::Instrument &instrument);
 
+    /**
+     * @brief Re-calculate sounding delays of the listed instruments only
+     * @param box Instruments storage
+     * @param indices Indices of instruments to measure
+     * @return false if measurement was cancelled
+     */
+    bool doMeasurement(FmBank::InsStorage &box, const QVector<int> &indices);
+
     struct DurationInfo
     {
         uint64_t    peak_amplitude_time;
@@ -49,6 +97,10 @@ public:
         int64_t     ms_sound_kon;
         int64_t     ms_sound_koff;
         bool        nosound;
+        //! Relative shift of delays when thresholds are raised by 6 dB (0.0 for stable results)
+        double      threshold_sensitivity;
+        //! Output is close to the no-sound decision
+        bool        near_silence;
 #if defined(ENABLE_PLOTS)
         std::vector<double> amps_on;
         std::vector<double> amps_off;
@@ -57,11 +109,238 @@ public:
     };
     bool doComputation(const FmBank::Instrument &instrument, DurationInfo &result);
 
+    /**
+     * @brief Loudness of the instrument rendered at the reference note and velocity
+     */
+    struct LoudnessInfo
+    {
+        //! Highest absolute sample value, dBFS
+        double      peak_db = -120.0;
+        //! RMS integrated over the whole key-on interval, dBFS
+        double      rms_db = -120.0;
+        //! Instrument produces no sound
+        bool        nosound = true;
+        //! Analysis was done (false for blank instruments or when it was cancelled)
+        bool        valid = false;
+    };
+
+    /**
+     * @brief Render instruments and compute their loudness, results are cached
+     * @param box Instruments storage
+     * @param indices Indices of instruments to analyze
+     * @param result Receives loudness for every entry of indices
+     * @param note Reference MIDI note (instruments with fixed note are using their own)
+     * @param velocity Reference velocity
+     * @return false if analysis was cancelled
+     */
+    bool doLoudnessAnalysis(const FmBank::InsStorage &box, const QVector<int> &indices,
+                            QVector<LoudnessInfo> &result, int note = 60, int velocity = 127);
+
+    /**
+     * @brief Adjust levels of output operators to reach the target RMS loudness
+     * @param box Instruments storage
+     * @param indices Indices of instruments to normalize
+     * @param target_db Target RMS loudness, dBFS
+     * @param tolerance_db Allowed deviation from target loudness, dB
+     * @param changed unless null, receives indices of changed instruments
+     * @param note Reference MIDI note
+     * @param velocity Reference velocity
+     * @return false if normalization was cancelled
+     */
+    bool normalizeLoudness(FmBank::InsStorage &box, const QVector<int> &indices,
+                           double target_db, double tolerance_db,
+                           QVector<int> *changed = nullptr, int note = 60, int velocity = 127);
+
+    /**
+     * @brief Render the instrument and compute its loudness, the cache is not used
+     * @param instrument Instrument to render
+     * @param result Receives the loudness
+     * @param note Reference MIDI note (instruments with fixed note are using their own)
+     * @param velocity Reference velocity
+     *
+     * This call is thread-safe and doesn't use any UI.
+     */
+    static void computeLoudness(const FmBank::Instrument &instrument, LoudnessInfo &result,
+                                int note = 60, int velocity = 127);
+
+    /**
+     * @brief One step of the normalization: shift levels of output operators by the loudness difference
+     * @param instrument Instrument to change
+     * @param loudness Loudness of the instrument
+     * @param target_db Target RMS loudness, dBFS
+     * @param tolerance_db Allowed deviation from target loudness, dB
+     * @return true if levels were changed, false if the loudness fits or levels are saturated
+     */
+    static bool adjustLoudness(FmBank::Instrument &instrument, const LoudnessInfo &loudness,
+                               double target_db, double tolerance_db);
+
+    /**
+     * @brief Attenuation of output operators by the generic volume model at full channel volume
+     * @param velocity MIDI velocity
+     * @return attenuation in steps of the total level (0.75 dB)
+     */
+    static unsigned velocityAttenuation(int velocity);
+
     struct BenchmarkResult {
         QString name;
         qint64  elapsed;
     };
     bool runBenchmark(FmBank::Instrument &instrument, QVector<BenchmarkResult> &result);
+
+    /**
+     * @brief Divergence of the emulator output from the reference emulator
+     */
+    struct ConformanceResult
+    {
+        //! Name of the emulator
+        QString name;
+        //! RMS of the difference signal relative to the reference RMS, dB
+        double  rms_divergence_db = -120.0;
+        //! Difference of RMS levels against the reference, dB
+        double  level_diff_db = 0.0;
+        //! Mean absolute difference of log-magnitude spectra, dB
+        double  spectral_divergence_db = 0.0;
+        //! First sample frame which differs more than the threshold, or -1 if none
+        qint64  first_diverging_sample = -1;
+        //! Largest absolute difference of samples
+        int     max_sample_diff = 0;
+        //! Rendering time, milliseconds
+        qint64  elapsed = 0;
+    };
+
+    /**
+     * @brief Render the instrument through every emulator and compare with Nuked OPL3
+     * @param instrument Instrument to render
+     * @param result Receives one entry per emulator, the reference one goes first
+     * @param threshold Smallest absolute sample difference considered as a divergence
+     *
+     * This call is thread-safe and doesn't use any UI, so many instruments
+     * can be checked concurrently.
+     */
+    static void checkConformance(const FmBank::Instrument &instrument,
+                                 QVector<ConformanceResult> &result,
+                                 int threshold = 64);
+
+    /**
+     * @brief Replay the register stream through every emulator and compare with Nuked OPL3
+     * @param log Register writes to replay, the whole length of the log gets rendered
+     * @param result Receives one entry per emulator, the reference one goes first
+     * @param threshold Smallest absolute sample difference considered as a divergence
+     */
+    static void checkConformance(const OPLRegisterLog &log,
+                                 QVector<ConformanceResult> &result,
+                                 int threshold = 64);
+
+    /**
+     * @brief Key of the sound which is affecting measured sounding delays
+     * @param ins Instrument
+     * @return bytes of every sound parameter, the name and measured values are excluded
+     */
+    static QByteArray durationKey(const FmBank::Instrument &ins);
+
+    /**
+     * @brief Take already measured sounding delays of the same sound
+     * @param ins Instrument to update
+     * @param setBlank Also set the blank flag of the instrument
+     * @return true if the sound was measured before and the instrument got its delays
+     */
+    bool applyCachedDurations(FmBank::Instrument &ins, bool setBlank = true) const;
+
+    /**
+     * @brief Queue the edited instrument for the re-measurement in background
+     * @param percussion Instrument belongs to the percussion storage
+     * @param index Index of the instrument in its storage
+     * @param ins Current state of the instrument
+     *
+     * Frequent edits of the same instrument are collapsed, the measurement starts
+     * once edits are settled down. Results are going into the cache,
+     * the instrumentMeasured() signal is emitted when they are ready.
+     */
+    void scheduleMeasurement(bool percussion, int index, const FmBank::Instrument &ins);
+
+    /**
+     * @brief Drop every queued background measurement (running ones are still finishing into the cache)
+     */
+    void cancelScheduledMeasurements();
+
+    /**
+     * @brief Delay between the last edit and the beginning of the background measurement
+     * @param ms Delay in milliseconds
+     */
+    void setMeasurementDebounce(int ms);
+
+signals:
+    /**
+     * @brief Sounding delays of the scheduled instrument have been measured
+     * @param percussion Instrument belongs to the percussion storage
+     * @param index Index of the instrument in its storage
+     *
+     * Use applyCachedDurations() to take results: the instrument may be changed since scheduling.
+     */
+    void instrumentMeasured(bool percussion, int index);
+
+private slots:
+    void startScheduledMeasurements();
+    void scheduledMeasurementFinished();
+
+private:
+    bool runTasks(QQueue<FmBank::Instrument *> &tasks, bool useCache = true);
+
+    struct MeasuredDurations
+    {
+        uint16_t    ms_sound_kon;
+        uint16_t    ms_sound_koff;
+        bool        is_blank;
+    };
+
+    void storeDurations(const QByteArray &key, const FmBank::Instrument &ins);
+
+    struct ScheduledJob
+    {
+        bool                percussion;
+        int                 index;
+        QByteArray          key;
+        FmBank::Instrument  ins;
+        MeasureMode         mode;
+        unsigned            soundClass;
+        //! Confirm the result by the accurate emulator even when it looks certain
+        bool                forceConfirm;
+        bool                confirmed;
+        bool                corrected;
+    };
+
+    QByteArray cacheKey(const FmBank::Instrument &ins) const;
+    //! Sounds of the class are often measured differently by the fast emulator
+    bool isSuspiciousClass(unsigned soundClass) const;
+    //! Count of sounds of the class confirmed so far
+    int checkedInClass(unsigned soundClass) const;
+    void recordConfirmation(unsigned soundClass, bool disagreed);
+
+    //! History of the fast and accurate emulators agreement
+    struct ClassStats
+    {
+        int checked = 0;
+        int disagreed = 0;
+    };
+
+    MeasureMode     m_mode = MEASURE_FAST;
+    MeasureReport   m_report;
+    //! Agreement of emulators by sound class
+    QHash<unsigned, ClassStats> m_classStats;
+    typedef QSharedPointer<ScheduledJob> ScheduledJobPtr;
+
+    //! Loudness of already analyzed sounds
+    QHash<QByteArray, LoudnessInfo> m_loudnessCache;
+    //! Sounding delays of already measured sounds
+    QHash<QByteArray, MeasuredDurations> m_durationCache;
+
+    //! Edited instruments waiting for the measurement, by storage slot
+    QHash<int, ScheduledJobPtr> m_scheduled;
+    //! Measurements which are in progress
+    QHash<QFutureWatcher<void> *, ScheduledJobPtr> m_running;
+    QTimer      m_debounce;
+    //! Low-priority workers of background measurements
+    QThreadPool m_backgroundPool;
 };
 
 
@@ -0,0 +1,157 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mixer.h"
+#include <cmath>
+#include <cstring>
+
+// Vectorization hint, only where the build enables OpenMP SIMD for this file
+#if (defined(_OPENMP) || defined(ENABLE_OPENMP_SIMD)) && !defined(_MSC_VER)
+#define MIXER_SIMD _Pragma("omp simd")
+#else
+#define MIXER_SIMD
+#endif
+
+void FloatMixer::clear(float *out, size_t samples)
+{
+    std::memset(out, 0, samples * sizeof(float));
+}
+
+void FloatMixer::accumulate(float *out, const int32_t *in, size_t samples, float gain)
+{
+MIXER_SIMD
+    for(size_t i = 0; i < samples; ++i)
+        out[i] += static_cast<float>(in[i]) * gain;
+}
+
+void FloatMixer::applyGain(float *buf, size_t samples, float gain)
+{
+MIXER_SIMD
+    for(size_t i = 0; i < samples; ++i)
+        buf[i] *= gain;
+}
+
+void FloatMixer::toInt16(int16_t *out, const float *in, size_t samples)
+{
+MIXER_SIMD
+    for(size_t i = 0; i < samples; ++i)
+    {
+        float s = in[i] * 32768.0f;
+        s = (s > -32768.0f) ? s : -32768.0f;
+        s = (s < 32767.0f) ? s : 32767.0f;
+        out[i] = static_cast<int16_t>(s);
+    }
+}
+
+SoftLimiter::SoftLimiter() :
+    m_enabled(true)
+{
+    setup(44100);
+}
+
+void SoftLimiter::setup(uint32_t sampleRate, float threshold, float lookaheadMs, float releaseMs)
+{
+    m_threshold = threshold;
+
+    unsigned lookahead = static_cast<unsigned>(lookaheadMs * 0.001f * sampleRate);
+    lookahead = (lookahead < 1) ? 1 : lookahead;
+    m_lookahead = (lookahead < MaxLookahead) ? lookahead : MaxLookahead;
+
+    float releaseFrames = releaseMs * 0.001f * sampleRate;
+    m_releaseCoef = (releaseFrames > 1.0f) ? (1.0f - std::exp(-1.0f / releaseFrames)) : 1.0f;
+
+    reset();
+}
+
+void SoftLimiter::reset()
+{
+    m_gain = 1.0f;
+    m_target = 1.0f;
+    m_step = 0.0f;
+    m_delayPos = 0;
+    std::memset(m_delay, 0, sizeof(m_delay));
+    m_minHead = 0;
+    m_minCount = 0;
+    m_frameCounter = 0;
+}
+
+void SoftLimiter::process(float *frames, size_t nframes)
+{
+    if(!m_enabled)
+        return;
+
+    const unsigned lookahead = m_lookahead;
+    const float threshold = m_threshold;
+
+    for(size_t i = 0; i < nframes; ++i)
+    {
+        float *frame = frames + 2 * i;
+        float peak = std::fabs(frame[0]);
+        float peakR = std::fabs(frame[1]);
+        peak = (peakR > peak) ? peakR : peak;
+
+        // Keep the lowest gain required by any frame in the delay line
+        uint32_t n = m_frameCounter++;
+        float required = (peak > threshold) ? (threshold / peak) : 1.0f;
+        while(m_minCount > 0 && m_minGain[(m_minHead + m_minCount - 1) % QueueSize] >= required)
+            --m_minCount;
+        unsigned back = (m_minHead + m_minCount) % QueueSize;
+        m_minGain[back] = required;
+        m_minFrame[back] = n;
+        ++m_minCount;
+        while(n - m_minFrame[m_minHead] > lookahead)
+        {
+            m_minHead = (m_minHead + 1) % QueueSize;
+            --m_minCount;
+        }
+        float windowMin = m_minGain[m_minHead];
+
+        // Ramp down across the look-ahead time, so the gain is low enough
+        // when the loud frame leaves the delay line, then release smoothly
+        if(windowMin < m_target)
+        {
+            // Keep the faster ramp, so the previous loud frame is still covered in time
+            float step = (m_gain - windowMin) / float(lookahead);
+            m_step = (m_gain > m_target && m_step > step) ? m_step : step;
+            m_target = windowMin;
+        }
+
+        if(m_gain > m_target)
+        {
+            // A step too small to change the gain would never reach the target
+            float next = m_gain - m_step;
+            m_gain = (next > m_target && next < m_gain) ? next : m_target;
+        }
+        else
+        {
+            m_target = windowMin;
+            m_gain += (m_target - m_gain) * m_releaseCoef;
+        }
+
+        float *delayed = m_delay + 2 * m_delayPos;
+        float outL = delayed[0] * m_gain;
+        float outR = delayed[1] * m_gain;
+        delayed[0] = frame[0];
+        delayed[1] = frame[1];
+        frame[0] = outL;
+        frame[1] = outR;
+
+        m_delayPos = (m_delayPos + 1 < lookahead) ? (m_delayPos + 1) : 0;
+    }
+}
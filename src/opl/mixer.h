@@ -0,0 +1,116 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Kernels of the 32-bit floating point mixing pipeline
+ *
+ * Samples are interleaved, the full scale is [-1.0, 1.0]. Chip outputs are
+ * summed without any intermediate clipping, the conversion into integer
+ * samples is the only place where the signal gets clipped.
+ */
+namespace FloatMixer
+{
+    /**
+     * @brief Fill the buffer with silence
+     * @param out Output samples
+     * @param samples Count of samples (frames * channels)
+     */
+    void clear(float *out, size_t samples);
+
+    /**
+     * @brief Add the chip output to the mix
+     * @param out Mix to add into
+     * @param in Output of OPLChipBase::generate32()
+     * @param samples Count of samples (frames * channels)
+     * @param gain Gain, where 1.0 / 32768 keeps the chip's own level
+     */
+    void accumulate(float *out, const int32_t *in, size_t samples, float gain);
+
+    /**
+     * @brief Multiply every sample by the gain
+     */
+    void applyGain(float *buf, size_t samples, float gain);
+
+    /**
+     * @brief Convert to 16-bit integer samples with clipping
+     */
+    void toInt16(int16_t *out, const float *in, size_t samples);
+}
+
+/**
+ * @brief Stereo look-ahead peak limiter with a smooth gain curve
+ *
+ * The signal is delayed by the look-ahead time, so the gain reduction is
+ * ramped down before the peak arrives, and is released exponentially.
+ */
+class SoftLimiter
+{
+public:
+    SoftLimiter();
+
+    /**
+     * @brief Configure the limiter and reset its state
+     * @param sampleRate Sample rate
+     * @param threshold Highest allowed absolute sample value
+     * @param lookaheadMs Look-ahead time, milliseconds
+     * @param releaseMs Release time, milliseconds
+     */
+    void setup(uint32_t sampleRate, float threshold = 0.944f,
+               float lookaheadMs = 1.5f, float releaseMs = 60.0f);
+    void reset();
+
+    inline void setEnabled(bool enabled) { m_enabled = enabled; }
+    inline bool isEnabled() const { return m_enabled; }
+
+    /**
+     * @brief Process stereo interleaved frames in place
+     */
+    void process(float *frames, size_t nframes);
+
+private:
+    enum { MaxLookahead = 1024 };
+
+    bool     m_enabled;
+    float    m_threshold;
+    float    m_releaseCoef;
+    unsigned m_lookahead;
+
+    float    m_gain;
+    float    m_target;
+    float    m_step;
+
+    unsigned m_delayPos;
+    float    m_delay[2 * MaxLookahead];
+
+    //! Sliding minimum of required gains of delayed frames (monotonic queue)
+    enum { QueueSize = MaxLookahead + 1 };
+    float    m_minGain[QueueSize];
+    uint32_t m_minFrame[QueueSize];
+    unsigned m_minHead;
+    unsigned m_minCount;
+    uint32_t m_frameCounter;
+};
+
+#endif // MIXER_H
@@ -0,0 +1,188 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "multichip_engine.h"
+#include "mixer.h"
+#include "chips/opl_chip_base.h"
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#   include <immintrin.h>
+#   define CPU_RELAX() _mm_pause()
+#else
+#   define CPU_RELAX() do {} while(0)
+#endif
+
+MultiChipEngine::MultiChipEngine(int maxThreads) :
+    m_maxThreads(0),
+    m_generation(0),
+    m_nextChip(0),
+    m_doneChips(0),
+    m_quit(false),
+    m_sleepers(0),
+    m_blockFrames(0)
+{
+    if(maxThreads < 0)
+    {
+        unsigned cores = std::thread::hardware_concurrency();
+        m_maxThreads = (cores > 1) ? (cores - 1) : 0;
+    }
+    else
+        m_maxThreads = static_cast<unsigned>(maxThreads);
+}
+
+MultiChipEngine::~MultiChipEngine()
+{
+    stopWorkers();
+}
+
+void MultiChipEngine::addChip(const std::shared_ptr<OPLChipBase> &chip)
+{
+    stopWorkers();
+    m_chips.push_back(chip);
+    m_buffers.emplace_back(new int32_t[2 * BlockFrames]);
+    updateWorkers();
+}
+
+void MultiChipEngine::clearChips()
+{
+    stopWorkers();
+    m_chips.clear();
+    m_buffers.clear();
+}
+
+void MultiChipEngine::render(float *out, size_t nframes, float gain)
+{
+    const unsigned chips = chipsCount();
+
+    while(nframes > 0)
+    {
+        size_t frames = (nframes < BlockFrames) ? nframes : BlockFrames;
+
+        FloatMixer::clear(out, 2 * frames);
+
+        if(chips > 0 && m_workers.empty())
+        {
+            for(unsigned c = 0; c < chips; ++c)
+            {
+                m_chips[c]->generate32(m_buffers[c].get(), frames);
+                FloatMixer::accumulate(out, m_buffers[c].get(), 2 * frames, gain);
+            }
+        }
+        else if(chips > 0)
+        {
+            // Fork: the counter of done chips must be reset before chips can be claimed
+            m_doneChips.store(0, std::memory_order_relaxed);
+            m_blockFrames = frames;
+            m_nextChip.store(0, std::memory_order_release);
+            m_generation.fetch_add(1, std::memory_order_seq_cst);
+
+            // A worker counts itself before checking the generation, so either it sees
+            // the new block, or it is counted here and waits for the notification
+            if(m_sleepers.load(std::memory_order_seq_cst) > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_wakeMutex);
+                m_wake.notify_all();
+            }
+
+            renderPending();
+
+            // Join
+            while(m_doneChips.load(std::memory_order_acquire) < chips)
+                CPU_RELAX();
+
+            // The same order of mixing as without workers gives the same result
+            for(unsigned c = 0; c < chips; ++c)
+                FloatMixer::accumulate(out, m_buffers[c].get(), 2 * frames, gain);
+        }
+
+        out += 2 * frames;
+        nframes -= frames;
+    }
+}
+
+void MultiChipEngine::renderPending()
+{
+    const unsigned chips = chipsCount();
+    for(;;)
+    {
+        unsigned c = m_nextChip.fetch_add(1, std::memory_order_acq_rel);
+        if(c >= chips)
+            break;
+        m_chips[c]->generate32(m_buffers[c].get(), m_blockFrames);
+        m_doneChips.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void MultiChipEngine::updateWorkers()
+{
+    unsigned needed = (chipsCount() > 1) ? (chipsCount() - 1) : 0;
+    needed = (needed < m_maxThreads) ? needed : m_maxThreads;
+
+    m_quit.store(false);
+    m_nextChip.store(chipsCount());
+    for(unsigned i = 0; i < needed; ++i)
+        m_workers.emplace_back(&MultiChipEngine::workerLoop, this);
+}
+
+void MultiChipEngine::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_quit.store(true);
+    }
+    m_wake.notify_all();
+
+    for(std::thread &t : m_workers)
+        t.join();
+    m_workers.clear();
+}
+
+void MultiChipEngine::workerLoop()
+{
+    uint32_t seen = m_generation.load(std::memory_order_acquire);
+
+    for(;;)
+    {
+        // Blocks of one render call are following each other, so spin shortly first
+        uint32_t generation = m_generation.load(std::memory_order_acquire);
+        for(unsigned spin = 0; generation == seen && spin < 256; ++spin)
+        {
+            CPU_RELAX();
+            generation = m_generation.load(std::memory_order_acquire);
+        }
+
+        if(generation == seen)
+        {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_wake.wait(lock, [this, seen]()
+            {
+                return m_quit.load(std::memory_order_relaxed) ||
+                       m_generation.load(std::memory_order_seq_cst) != seen;
+            });
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            generation = m_generation.load(std::memory_order_acquire);
+        }
+
+        if(m_quit.load(std::memory_order_relaxed))
+            break;
+
+        seen = generation;
+        renderPending();
+    }
+}
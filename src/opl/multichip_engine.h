@@ -0,0 +1,110 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MULTICHIP_ENGINE_H
+#define MULTICHIP_ENGINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class OPLChipBase;
+
+/**
+ * @brief Renders several independent OPL chips concurrently and mixes them
+ *
+ * Chips are rendered block by block: the audio thread forks the block to
+ * worker threads, renders chips itself too, waits for others on a lock-free
+ * barrier and mixes the result. Workers spin shortly between blocks, then
+ * go to sleep on the condition variable; the audio thread takes the lock
+ * and notifies only when some worker is actually asleep.
+ *
+ * Register writes must be done from the audio thread between render calls,
+ * the same way as for a single chip.
+ */
+class MultiChipEngine
+{
+public:
+    enum
+    {
+        //! Frames rendered by each chip at once
+        BlockFrames = 512
+    };
+
+    /**
+     * @param maxThreads Maximum count of worker threads, 0 to render all chips
+     *        by the calling thread, negative to choose by count of CPU cores
+     */
+    explicit MultiChipEngine(int maxThreads = -1);
+    ~MultiChipEngine();
+
+    /**
+     * @brief Add the chip to render, the engine shares the ownership of the chip
+     */
+    void addChip(const std::shared_ptr<OPLChipBase> &chip);
+    void clearChips();
+
+    inline unsigned chipsCount() const { return static_cast<unsigned>(m_chips.size()); }
+    inline OPLChipBase *chip(unsigned i) const { return m_chips[i].get(); }
+
+    /**
+     * @brief Count of worker threads rendering the chips together with the calling thread
+     */
+    inline unsigned threadsCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+    /**
+     * @brief Render and mix all chips
+     * @param out Stereo interleaved output, full scale is 1.0
+     * @param nframes Count of frames
+     * @param gain Gain of chip outputs, where 1.0 / 32768 keeps the chip's own level
+     */
+    void render(float *out, size_t nframes, float gain);
+
+private:
+    void updateWorkers();
+    void stopWorkers();
+    void workerLoop();
+    void renderPending();
+
+    unsigned m_maxThreads;
+    std::vector<std::shared_ptr<OPLChipBase> > m_chips;
+    std::vector<std::unique_ptr<int32_t[]> > m_buffers;
+    std::vector<std::thread> m_workers;
+
+    //! Incremented to wake workers up for the new block
+    std::atomic<uint32_t> m_generation;
+    //! Index of the next chip to render in the current block
+    std::atomic<unsigned> m_nextChip;
+    //! Count of chips rendered in the current block
+    std::atomic<unsigned> m_doneChips;
+    std::atomic<bool> m_quit;
+    //! Count of workers which are going to sleep or sleeping, changed under the lock
+    std::atomic<unsigned> m_sleepers;
+    size_t m_blockFrames;
+
+    //! Taken by workers going to sleep, and by wake-ups of sleeping workers
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+};
+
+#endif // MULTICHIP_ENGINE_H
@@ -0,0 +1,696 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "register_log.h"
+#include "chips/opl_chip_base.h"
+#include <QFile>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+static const char s_logMagic[8] = {'O', 'P', 'L', 'R', 'L', 'O', 'G', '1'};
+static const size_t s_logHeaderSize = 24;
+
+static void putLE(QByteArray &out, uint64_t value, int bytes)
+{
+    for(int i = 0; i < bytes; ++i)
+        out.append(char((value >> (8 * i)) & 0xFF));
+}
+
+static void setLE(QByteArray &out, int offset, uint64_t value, int bytes)
+{
+    for(int i = 0; i < bytes; ++i)
+        out[offset + i] = char((value >> (8 * i)) & 0xFF);
+}
+
+static uint64_t getLE(const uint8_t *in, int bytes)
+{
+    uint64_t value = 0;
+    for(int i = 0; i < bytes; ++i)
+        value |= uint64_t(in[i]) << (8 * i);
+    return value;
+}
+
+static void putVarint(QByteArray &out, uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        out.append(char((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.append(char(value));
+}
+
+static bool getVarint(const uint8_t *&in, const uint8_t *end, uint64_t &value)
+{
+    value = 0;
+    for(int shift = 0; in < end && shift < 64; shift += 7)
+    {
+        uint8_t b = *in++;
+        value |= uint64_t(b & 0x7F) << shift;
+        if((b & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+void OPLRegisterLog::begin(uint32_t rate, int chipType)
+{
+    m_events.clear();
+    m_rate = rate;
+    m_chipType = chipType;
+    m_endFrame = 0;
+}
+
+uint64_t OPLRegisterLog::length() const
+{
+    uint64_t last = m_events.isEmpty() ? 0 : m_events.last().frame;
+    return (m_endFrame > last) ? m_endFrame : last;
+}
+
+QByteArray OPLRegisterLog::toLog() const
+{
+    QByteArray out;
+    out.reserve(int(s_logHeaderSize) + m_events.size() * 3);
+
+    out.append(s_logMagic, sizeof(s_logMagic));
+    putLE(out, m_rate, 4);
+    putLE(out, uint8_t(m_chipType), 1);
+    putLE(out, 0, 3);
+    putLE(out, length(), 8);
+
+    uint64_t frame = 0;
+    for(const Event &e : m_events)
+    {
+        putVarint(out, ((e.frame - frame) << 1) | ((e.addr >> 8) & 1));
+        out.append(char(e.addr & 0xFF));
+        out.append(char(e.data));
+        frame = e.frame;
+    }
+
+    return out;
+}
+
+bool OPLRegisterLog::fromLog(const QByteArray &data)
+{
+    if(size_t(data.size()) < s_logHeaderSize || memcmp(data.constData(), s_logMagic, sizeof(s_logMagic)) != 0)
+        return false;
+
+    const uint8_t *in = reinterpret_cast<const uint8_t *>(data.constData());
+    const uint8_t *end = in + data.size();
+
+    QVector<Event> events;
+    uint32_t rate = uint32_t(getLE(in + 8, 4));
+    int chipType = in[12];
+    uint64_t endFrame = getLE(in + 16, 8);
+
+    if(rate == 0)
+        return false;
+
+    in += s_logHeaderSize;
+
+    uint64_t frame = 0;
+    while(in < end)
+    {
+        uint64_t head;
+        if(!getVarint(in, end, head) || end - in < 2)
+            return false;
+        frame += head >> 1;
+        Event e;
+        e.frame = frame;
+        e.addr = uint16_t(((head & 1) << 8) | in[0]);
+        e.data = in[1];
+        events.push_back(e);
+        in += 2;
+    }
+
+    m_events.swap(events);
+    m_rate = rate;
+    m_chipType = chipType;
+    m_endFrame = endFrame;
+    return true;
+}
+
+bool OPLRegisterLog::saveLog(const QString &filePath) const
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly))
+        return false;
+    QByteArray data = toLog();
+    return file.write(data) == data.size();
+}
+
+bool OPLRegisterLog::loadLog(const QString &filePath)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+    return fromLog(file.readAll());
+}
+
+bool OPLRegisterLog::loadFile(const QString &filePath)
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QByteArray data = file.readAll();
+    if(data.size() >= 8 && memcmp(data.constData(), s_logMagic, sizeof(s_logMagic)) == 0)
+        return fromLog(data);
+    if(data.size() >= 8 && memcmp(data.constData(), "DBRAWOPL", 8) == 0)
+        return fromDRO(data);
+    if(data.size() >= 4 && memcmp(data.constData(), "Vgm ", 4) == 0)
+        return fromVGM(data);
+
+    return false;
+}
+
+/**
+ * @brief Length of operands of the VGM command, or -1 for commands with special handling
+ */
+static int vgmOperandsLength(uint8_t cmd)
+{
+    if(cmd >= 0x30 && cmd <= 0x3F)
+        return 1;
+    if(cmd >= 0x40 && cmd <= 0x4E)
+        return 2;
+    if(cmd == 0x4F || cmd == 0x50)
+        return 1;
+    if(cmd >= 0x51 && cmd <= 0x5F)
+        return 2;
+    if(cmd == 0x64)
+        return 3;
+    if(cmd == 0x68)
+        return 11;
+    if(cmd >= 0x70 && cmd <= 0x8F)
+        return 0;
+    switch(cmd)
+    {
+    case 0x90: case 0x91: case 0x95:
+        return 4;
+    case 0x92:
+        return 5;
+    case 0x93:
+        return 10;
+    case 0x94:
+        return 1;
+    default:
+        break;
+    }
+    if(cmd >= 0xA0 && cmd <= 0xBF)
+        return 2;
+    if(cmd >= 0xC0 && cmd <= 0xDF)
+        return 3;
+    if(cmd >= 0xE0)
+        return 4;
+    return -1;
+}
+
+bool OPLRegisterLog::fromVGM(const QByteArray &data)
+{
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(data.constData());
+    const size_t size = size_t(data.size());
+
+    if(size < 0x40 || memcmp(base, "Vgm ", 4) != 0)
+        return false;
+
+    uint32_t version = uint32_t(getLE(base + 0x08, 4));
+    size_t offset = 0x40;
+    if(version >= 0x150)
+    {
+        uint32_t dataOffset = uint32_t(getLE(base + 0x34, 4));
+        if(dataOffset != 0)
+            offset = 0x34 + dataOffset;
+    }
+
+    bool opl3 = size >= 0x60 && getLE(base + 0x5C, 4) != 0;
+
+    QVector<Event> events;
+    uint64_t frame = 0;
+
+    while(offset < size)
+    {
+        uint8_t cmd = base[offset++];
+
+        if(cmd == 0x66)
+            break;
+
+        if(cmd == 0x5A || cmd == 0x5E || cmd == 0x5F)
+        {
+            if(offset + 2 > size)
+                return false;
+            Event e;
+            e.frame = frame;
+            e.addr = uint16_t(base[offset] | ((cmd == 0x5F) ? 0x100 : 0));
+            e.data = base[offset + 1];
+            events.push_back(e);
+            offset += 2;
+            continue;
+        }
+
+        switch(cmd)
+        {
+        case 0x61:
+            if(offset + 2 > size)
+                return false;
+            frame += getLE(base + offset, 2);
+            offset += 2;
+            continue;
+        case 0x62:
+            frame += 735;
+            continue;
+        case 0x63:
+            frame += 882;
+            continue;
+        case 0x67:
+        {
+            // Data block: 0x66, type, 32-bit size, data
+            if(offset + 6 > size)
+                return false;
+            offset += 6 + size_t(getLE(base + offset + 2, 4));
+            continue;
+        }
+        default:
+            break;
+        }
+
+        if(cmd >= 0x70 && cmd <= 0x7F)
+            frame += (cmd & 0x0F) + 1;
+        else if(cmd >= 0x80 && cmd <= 0x8F)
+            frame += cmd & 0x0F;
+
+        int operands = vgmOperandsLength(cmd);
+        if(operands < 0)
+            return false;
+        offset += size_t(operands);
+    }
+
+    m_events.swap(events);
+    m_rate = 44100;
+    m_chipType = opl3 ? OPLChipBase::CHIPTYPE_OPL3 : OPLChipBase::CHIPTYPE_OPL2;
+    m_endFrame = frame;
+    return true;
+}
+
+bool OPLRegisterLog::fromDRO(const QByteArray &data)
+{
+    const uint8_t *in = reinterpret_cast<const uint8_t *>(data.constData());
+    const uint8_t *end = in + data.size();
+
+    if(data.size() < 12 || memcmp(in, "DBRAWOPL", 8) != 0)
+        return false;
+
+    // DRO timing is in milliseconds, the frame of each write is rounded down
+    const uint32_t rate = 44100;
+
+    uint16_t major = uint16_t(getLE(in + 8, 2));
+    uint16_t minor = uint16_t(getLE(in + 10, 2));
+    in += 12;
+
+    QVector<Event> events;
+    uint64_t ms = 0;
+    bool opl3 = false;
+
+    if(major < 2)
+    {
+        if(end - in < 12)
+            return false;
+        uint32_t lengthBytes = uint32_t(getLE(in + 4, 4));
+        uint32_t hardwareType = uint32_t(getLE(in + 8, 4));
+        in += 12;
+        if((hardwareType >> 8) != 0)
+        {
+            // Old files have the 8-bit hardware type
+            in -= 3;
+            hardwareType &= 0xFF;
+        }
+        opl3 = (hardwareType == 1);
+
+        const uint8_t *stop = (size_t(end - in) > lengthBytes) ? (in + lengthBytes) : end;
+        unsigned chipSelect = 0;
+
+        while(in < stop)
+        {
+            uint8_t reg = *in++;
+            switch(reg)
+            {
+            case 0x00:
+                if(in >= stop)
+                    return false;
+                ms += uint64_t(*in++) + 1;
+                break;
+            case 0x01:
+                if(stop - in < 2)
+                    return false;
+                ms += getLE(in, 2) + 1;
+                in += 2;
+                break;
+            case 0x02:
+            case 0x03:
+                chipSelect = reg - 0x02;
+                break;
+            default:
+            {
+                if(reg == 0x04)
+                {
+                    if(in >= stop)
+                        return false;
+                    reg = *in++;
+                }
+                if(in >= stop)
+                    return false;
+                uint8_t value = *in++;
+                if(chipSelect == 0 || opl3)
+                {
+                    Event e = {ms * rate / 1000, uint16_t(reg | (chipSelect ? 0x100 : 0)), value};
+                    events.push_back(e);
+                }
+                break;
+            }
+            }
+        }
+    }
+    else if(major == 2 && minor == 0)
+    {
+        if(end - in < 14)
+            return false;
+        uint32_t lengthPairs = uint32_t(getLE(in, 4));
+        uint8_t hardwareType = in[8];
+        uint8_t format = in[9];
+        uint8_t compression = in[10];
+        uint8_t shortDelay = in[11];
+        uint8_t longDelay = in[12];
+        uint8_t codeMapLength = in[13];
+        in += 14;
+
+        if(format != 0 || compression != 0 || codeMapLength >= 0x80 || end - in < codeMapLength)
+            return false;
+
+        const uint8_t *codeMap = in;
+        in += codeMapLength;
+        opl3 = (hardwareType == 2);
+
+        for(uint32_t i = 0; i < lengthPairs && end - in >= 2; ++i, in += 2)
+        {
+            uint8_t code = in[0], value = in[1];
+            if(code == shortDelay)
+                ms += uint64_t(value) + 1;
+            else if(code == longDelay)
+                ms += (uint64_t(value) + 1) << 8;
+            else
+            {
+                unsigned chipSelect = code >> 7;
+                if((code & 0x7F) >= codeMapLength)
+                    return false;
+                if(chipSelect && !opl3)
+                    continue;
+                Event e = {ms * rate / 1000, uint16_t(codeMap[code & 0x7F] | (chipSelect ? 0x100 : 0)), value};
+                events.push_back(e);
+            }
+        }
+    }
+    else
+        return false;
+
+    m_events.swap(events);
+    m_rate = rate;
+    m_chipType = opl3 ? OPLChipBase::CHIPTYPE_OPL3 : OPLChipBase::CHIPTYPE_OPL2;
+    m_endFrame = ms * rate / 1000;
+    return true;
+}
+
+static void putDROWait(QByteArray &out, uint64_t ms, uint8_t shortDelay, uint8_t longDelay, uint32_t &pairs)
+{
+    while(ms > 0)
+    {
+        if(ms > 256)
+        {
+            uint64_t blocks = ms >> 8;
+            if(blocks > 256)
+                blocks = 256;
+            out.append(char(longDelay));
+            out.append(char(blocks - 1));
+            ms -= blocks << 8;
+        }
+        else
+        {
+            out.append(char(shortDelay));
+            out.append(char(ms - 1));
+            ms = 0;
+        }
+        ++pairs;
+    }
+}
+
+QByteArray OPLRegisterLog::toDRO() const
+{
+    const bool opl2 = (m_chipType == OPLChipBase::CHIPTYPE_OPL2);
+
+    // Registers of both banks are sharing the code map, the bank is the high bit of the code
+    QByteArray codeMap;
+    int codeOf[256];
+    std::fill(codeOf, codeOf + 256, -1);
+    for(const Event &e : m_events)
+    {
+        uint8_t reg = uint8_t(e.addr & 0xFF);
+        if((opl2 && e.addr >= 0x100) || codeOf[reg] >= 0)
+            continue;
+        // Two more codes are needed for delays
+        if(codeMap.size() >= 0x7E)
+            return QByteArray();
+        codeOf[reg] = codeMap.size();
+        codeMap.append(char(reg));
+    }
+
+    const uint8_t shortDelay = uint8_t(codeMap.size());
+    const uint8_t longDelay = uint8_t(codeMap.size() + 1);
+
+    QByteArray body;
+    body.reserve(m_events.size() * 2);
+    uint32_t pairs = 0;
+    uint64_t written = 0;
+
+    for(const Event &e : m_events)
+    {
+        if(opl2 && e.addr >= 0x100)
+            continue;
+        uint64_t at = (e.frame * 1000 + m_rate / 2) / m_rate;
+        putDROWait(body, at - written, shortDelay, longDelay, pairs);
+        written = at;
+        body.append(char(codeOf[e.addr & 0xFF] | ((e.addr & 0x100) ? 0x80 : 0)));
+        body.append(char(e.data));
+        ++pairs;
+    }
+
+    uint64_t total = (length() * 1000 + m_rate / 2) / m_rate;
+    putDROWait(body, total - written, shortDelay, longDelay, pairs);
+
+    QByteArray out;
+    out.reserve(26 + codeMap.size() + body.size());
+    out.append("DBRAWOPL", 8);
+    putLE(out, 2, 2);                       // Version 2.0
+    putLE(out, 0, 2);
+    putLE(out, pairs, 4);
+    putLE(out, uint32_t(total), 4);          // Length in milliseconds
+    putLE(out, opl2 ? 0 : 2, 1);            // OPL2 or OPL3
+    putLE(out, 0, 1);                       // Interleaved format
+    putLE(out, 0, 1);                       // No compression
+    putLE(out, shortDelay, 1);
+    putLE(out, longDelay, 1);
+    putLE(out, uint8_t(codeMap.size()), 1);
+    out.append(codeMap);
+    out.append(body);
+    return out;
+}
+
+bool OPLRegisterLog::saveDRO(const QString &filePath) const
+{
+    QByteArray data = toDRO();
+    if(data.isEmpty())
+        return false;
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly))
+        return false;
+    return file.write(data) == data.size();
+}
+
+static void putVGMWait(QByteArray &out, uint64_t samples)
+{
+    while(samples > 0)
+    {
+        if(samples <= 16)
+        {
+            out.append(char(0x70 + (samples - 1)));
+            break;
+        }
+        else if(samples == 735)
+        {
+            out.append(char(0x62));
+            break;
+        }
+        else if(samples == 882)
+        {
+            out.append(char(0x63));
+            break;
+        }
+
+        uint64_t wait = (samples > 0xFFFF) ? 0xFFFF : samples;
+        out.append(char(0x61));
+        putLE(out, wait, 2);
+        samples -= wait;
+    }
+}
+
+QByteArray OPLRegisterLog::toVGM() const
+{
+    // VGM is always timed by 44100 Hz samples
+    const uint64_t vgmRate = 44100;
+    const bool opl2 = (m_chipType == OPLChipBase::CHIPTYPE_OPL2);
+
+    QByteArray out(0x100, '\0');
+    out.reserve(0x100 + m_events.size() * 4);
+
+    uint64_t written = 0;
+    for(const Event &e : m_events)
+    {
+        uint64_t at = (e.frame * vgmRate + m_rate / 2) / m_rate;
+        putVGMWait(out, at - written);
+        written = at;
+
+        if(opl2)
+        {
+            if(e.addr >= 0x100)
+                continue;
+            out.append(char(0x5A));
+        }
+        else
+            out.append(char((e.addr & 0x100) ? 0x5F : 0x5E));
+        out.append(char(e.addr & 0xFF));
+        out.append(char(e.data));
+    }
+
+    uint64_t total = (length() * vgmRate + m_rate / 2) / m_rate;
+    putVGMWait(out, total - written);
+    out.append(char(0x66));
+
+    setLE(out, 0x00, 0x206d6756, 4);                 // "Vgm "
+    setLE(out, 0x04, uint32_t(out.size() - 4), 4);   // EOF offset
+    setLE(out, 0x08, 0x151, 4);                      // Version
+    setLE(out, 0x18, uint32_t(total), 4);            // Total samples
+    setLE(out, 0x34, 0x100 - 0x34, 4);               // Data offset
+    if(opl2)
+        setLE(out, 0x50, 3579545, 4);                // YM3812 clock
+    else
+        setLE(out, 0x5C, 14318180, 4);               // YMF262 clock
+
+    return out;
+}
+
+bool OPLRegisterLog::saveVGM(const QString &filePath) const
+{
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly))
+        return false;
+    QByteArray data = toVGM();
+    return file.write(data) == data.size();
+}
+
+OPLRegisterLog::ReplayStats OPLRegisterLog::replay(OPLChipBase &chip, const SampleSink &sink, size_t chunkFrames) const
+{
+    ReplayStats stats;
+    std::vector<int32_t> buffer(2 * chunkFrames);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // Start from the clean chip like the generator does
+    chip.setRate(m_rate);
+    chip.reset();
+    chip.clearScheduledWrites();
+
+    uint64_t frame = 0;
+    const uint64_t total = length();
+    int next = 0;
+
+    while(frame < total)
+    {
+        size_t count = size_t(((total - frame) < chunkFrames) ? (total - frame) : chunkFrames);
+
+        // Every write of the chunk lands exactly on its frame
+        for(; next < m_events.size() && m_events[next].frame < frame + count; ++next)
+        {
+            const Event &e = m_events[next];
+            chip.scheduleWrite(uint32_t(e.frame - frame), e.addr, e.data);
+            ++stats.writes;
+        }
+
+        chip.generate32(buffer.data(), count);
+        if(sink)
+            sink(buffer.data(), count);
+        frame += count;
+    }
+
+    // Writes at the very end of the log are not affecting the output
+    for(; next < m_events.size(); ++next)
+    {
+        const Event &e = m_events[next];
+        chip.writeRegImmediate(e.addr, e.data);
+        ++stats.writes;
+    }
+
+    stats.frames = frame;
+    stats.seconds = double(timer.nsecsElapsed()) / 1e9;
+    return stats;
+}
+
+
+OPLRegisterCapture::OPLRegisterCapture(size_t capacity) :
+    m_ring(capacity * sizeof(OPLRegisterLog::Event)),
+    m_lost(0),
+    m_chipType(0)
+{}
+
+void OPLRegisterCapture::begin(uint32_t rate, int chipType)
+{
+    m_log.begin(rate, chipType);
+    m_ring.discard(m_ring.size_used());
+    m_lost.store(0);
+    m_chipType.store(chipType);
+}
+
+void OPLRegisterCapture::updateChipType(int chipType)
+{
+    // Writes of OPL2 are playing the same on OPL3, but not in reverse
+    if(chipType == OPLChipBase::CHIPTYPE_OPL3)
+        m_chipType.store(chipType, std::memory_order_relaxed);
+}
+
+void OPLRegisterCapture::drain()
+{
+    OPLRegisterLog::Event e;
+    while(m_ring.get(e))
+        m_log.append(e.frame, e.addr, e.data);
+}
+
+void OPLRegisterCapture::finish(uint64_t frame)
+{
+    drain();
+    m_log.setChipType(m_chipType.load(std::memory_order_relaxed));
+    m_log.finish(frame);
+}
@@ -0,0 +1,208 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REGISTER_LOG_H
+#define REGISTER_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <functional>
+#include <QVector>
+#include <QString>
+#include <QByteArray>
+#include "realtime/ring_buffer.h"
+
+class OPLChipBase;
+
+/**
+ * @brief Log of register writes stamped by the sample position
+ *
+ * The log is recorded from the generator and can be saved into a compact
+ * binary file, exported as VGM or DOSBox Raw OPL, or replayed into any chip.
+ *
+ * The binary file is "OPLRLOG1", the sample rate (32-bit), the chip type
+ * (8-bit), three reserved bytes and the length in frames (64-bit), all in
+ * little-endian. Then every write follows as a variable-length count of
+ * frames since the previous write, shifted left by one with the register
+ * bank in the lowest bit, then the register and the value bytes.
+ */
+class OPLRegisterLog
+{
+public:
+    struct Event
+    {
+        //! Sample position of the write
+        uint64_t frame;
+        uint16_t addr;
+        uint8_t  data;
+    };
+
+    /**
+     * @brief Result of the replay
+     */
+    struct ReplayStats
+    {
+        uint64_t frames = 0;
+        uint64_t writes = 0;
+        //! Wall time spent, in seconds
+        double   seconds = 0.0;
+    };
+
+    /**
+     * @brief Receives rendered stereo interleaved samples
+     */
+    typedef std::function<void(const int32_t *frames, size_t nframes)> SampleSink;
+
+    /**
+     * @brief Drop all writes and start the new log
+     * @param rate Sample rate where frames are counted
+     * @param chipType Type of the chip (OPLChipBase::ChipType)
+     */
+    void begin(uint32_t rate, int chipType);
+
+    inline void append(uint64_t frame, uint16_t addr, uint8_t data)
+    {
+        Event e = {frame, addr, data};
+        m_events.push_back(e);
+    }
+
+    /**
+     * @brief Mark the end of the log, it is the length of the replay
+     */
+    inline void finish(uint64_t frame) { m_endFrame = frame; }
+
+    inline const QVector<Event> &events() const { return m_events; }
+    inline uint32_t rate() const { return m_rate; }
+    inline int chipType() const { return m_chipType; }
+    inline void setChipType(int chipType) { m_chipType = chipType; }
+    //! Count of frames of the log
+    uint64_t length() const;
+
+    bool saveLog(const QString &filePath) const;
+    bool loadLog(const QString &filePath);
+
+    QByteArray toLog() const;
+    bool fromLog(const QByteArray &data);
+
+    /**
+     * @brief Load the register log, the uncompressed VGM or the DOSBox Raw OPL file
+     * @param filePath Path to the file, format is detected by its signature
+     * @return true on success
+     */
+    bool loadFile(const QString &filePath);
+
+    /**
+     * @brief Read writes of the first YMF262 or YM3812 chip from the VGM file
+     */
+    bool fromVGM(const QByteArray &data);
+
+    /**
+     * @brief Read writes of the first chip from the DOSBox Raw OPL file (version 1 or 2)
+     */
+    bool fromDRO(const QByteArray &data);
+
+    /**
+     * @brief Export the log as VGM 1.51 file with YMF262 or YM3812 commands
+     */
+    bool saveVGM(const QString &filePath) const;
+    QByteArray toVGM() const;
+
+    /**
+     * @brief Export the log as DOSBox Raw OPL 2.0 file, timed by milliseconds
+     * @return empty array when writes are using more than 126 different registers
+     */
+    bool saveDRO(const QString &filePath) const;
+    QByteArray toDRO() const;
+
+    /**
+     * @brief Feed the log into the chip as fast as possible
+     * @param chip Chip to play, it gets reset and set to the rate of the log
+     * @param sink Unless empty, receives the rendered output
+     * @param chunkFrames Frames rendered by one generate call, writes within are scheduled on their frames
+     * @return count of rendered frames, writes and the time spent
+     */
+    ReplayStats replay(OPLChipBase &chip, const SampleSink &sink = SampleSink(),
+                       size_t chunkFrames = 512) const;
+
+private:
+    QVector<Event> m_events;
+    uint32_t m_rate = 44100;
+    int      m_chipType = 0;
+    uint64_t m_endFrame = 0;
+};
+
+/**
+ * @brief Records register writes of the audio thread into the log
+ *
+ * The audio thread only puts writes into the preallocated lock-free ring.
+ * The control thread drains them into the log periodically and at the end.
+ */
+class OPLRegisterCapture
+{
+public:
+    /**
+     * @param capacity Count of writes the ring keeps between two drains
+     */
+    explicit OPLRegisterCapture(size_t capacity = 65536);
+
+    /**
+     * @brief Start the new log, must be done before the audio thread puts writes
+     */
+    void begin(uint32_t rate, int chipType);
+
+    /**
+     * @brief Put the write into the ring, called from the audio thread
+     * @return false if the ring is full and the write is lost
+     */
+    inline bool put(uint64_t frame, uint16_t addr, uint8_t data)
+    {
+        OPLRegisterLog::Event e = {frame, addr, data};
+        if(m_ring.put(e))
+            return true;
+        m_lost.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Take the type of the chip which is playing now, the log gets the widest of them
+     */
+    void updateChipType(int chipType);
+
+    /**
+     * @brief Move writes from the ring into the log, called from the control thread
+     */
+    void drain();
+
+    /**
+     * @brief Drain the rest of writes and mark the end of the log
+     */
+    void finish(uint64_t frame);
+
+    inline OPLRegisterLog &log() { return m_log; }
+    //! Count of writes which haven't fit into the ring
+    inline unsigned lost() const { return m_lost.load(std::memory_order_relaxed); }
+
+private:
+    OPLRegisterLog m_log;
+    Ring_Buffer m_ring;
+    std::atomic<unsigned> m_lost;
+    std::atomic<int> m_chipType;
+};
+
+#endif // REGISTER_LOG_H
@@ -0,0 +1,128 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHADOW_REGISTERS_H
+#define SHADOW_REGISTERS_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Copy of OPL3 registers which filters out writes of unchanged values
+ *
+ * Writes which are not changing the register are skipped, so slow chips
+ * (serial port hardware, queued emulators) are not spending time on them.
+ * Key-on/off is preserved: it takes the change of the bit in 0xB0-0xB8
+ * or in 0xBD, and writes which are changing a bit are never skipped.
+ * Timer and status registers are always passed because their writes are
+ * strobes rather than states.
+ */
+class OPLShadowRegisters
+{
+public:
+    enum { RegistersCount = 0x200 };
+
+    OPLShadowRegisters()
+    {
+        invalidate();
+        resetCounters();
+    }
+
+    /**
+     * @brief Forget all values, every next write of each register will be passed
+     *
+     * Must be called whenever the chip gets reset or replaced.
+     */
+    void invalidate()
+    {
+        memset(m_known, 0, sizeof(m_known));
+        memset(m_value, 0, sizeof(m_value));
+    }
+
+    void resetCounters()
+    {
+        memset(m_writes, 0, sizeof(m_writes));
+        memset(m_skips, 0, sizeof(m_skips));
+        m_totalWrites = 0;
+        m_totalSkips = 0;
+    }
+
+    /**
+     * @brief Record the write of register
+     * @param addr Register address (0x000...0x1FF)
+     * @param data Value to write
+     * @return true if the write must be passed to the chip
+     */
+    inline bool write(uint16_t addr, uint8_t data)
+    {
+        addr &= RegistersCount - 1;
+
+        if(m_known[addr] && m_value[addr] == data && !isStrobe(addr))
+        {
+            ++m_skips[addr];
+            ++m_totalSkips;
+            return false;
+        }
+
+        m_known[addr] = 1;
+        m_value[addr] = data;
+        ++m_writes[addr];
+        ++m_totalWrites;
+        return true;
+    }
+
+    /**
+     * @brief Last value written into the register
+     */
+    inline uint8_t value(uint16_t addr) const
+    { return m_value[addr & (RegistersCount - 1)]; }
+
+    inline bool isKnown(uint16_t addr) const
+    { return m_known[addr & (RegistersCount - 1)] != 0; }
+
+    //! Count of writes passed to the chip per register
+    inline uint32_t writesCount(uint16_t addr) const
+    { return m_writes[addr & (RegistersCount - 1)]; }
+    //! Count of skipped writes per register
+    inline uint32_t skipsCount(uint16_t addr) const
+    { return m_skips[addr & (RegistersCount - 1)]; }
+
+    inline uint64_t totalWrites() const { return m_totalWrites; }
+    inline uint64_t totalSkips() const { return m_totalSkips; }
+
+    /**
+     * @brief Is the write of the register an action rather than a state
+     */
+    static inline bool isStrobe(uint16_t addr)
+    {
+        // Test register, timers and the timer control with its IRQ reset bit,
+        // but 0x104 is the 4-operators connection select which is a state
+        uint16_t reg = addr & 0xFF;
+        return reg >= 0x01 && reg <= 0x04 && addr != 0x104;
+    }
+
+private:
+    uint8_t  m_value[RegistersCount];
+    uint8_t  m_known[RegistersCount];
+    uint32_t m_writes[RegistersCount];
+    uint32_t m_skips[RegistersCount];
+    uint64_t m_totalWrites;
+    uint64_t m_totalSkips;
+};
+
+#endif // SHADOW_REGISTERS_H
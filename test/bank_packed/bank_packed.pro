@@ -0,0 +1,28 @@
+#-------------------------------------------------
+#
+# Packed structure-of-arrays view of bank instruments
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_bank_packed
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_bank_packed.cpp \
+    ../../src/bank.cpp \
+    ../../src/bank_packed.cpp
+
+HEADERS += \
+    ../../src/bank.h \
+    ../../src/bank_packed.h
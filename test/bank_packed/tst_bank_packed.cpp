@@ -0,0 +1,107 @@
+#include <QString>
+#include <QtTest>
+#include <QRandomGenerator>
+
+#include <bank.h>
+#include <bank_packed.h>
+
+class BankPackedTest : public QObject
+{
+    Q_OBJECT
+
+    static FmBank::Instrument randomInstrument(QRandomGenerator &gen, int i)
+    {
+        FmBank::Instrument ins = FmBank::emptyInst();
+        for(int op = 0; op < 4; op++)
+        {
+            ins.setAVEKM(op, uint8_t(gen.bounded(0, 256)));
+            ins.setKSLL(op, uint8_t(gen.bounded(0, 256)));
+            ins.setAtDec(op, uint8_t(gen.bounded(0, 256)));
+            ins.setSusRel(op, uint8_t(gen.bounded(0, 256)));
+            ins.setWaveForm(op, uint8_t(gen.bounded(0, 8)));
+        }
+        ins.setFBConn1(uint8_t(gen.bounded(0, 16)));
+        ins.setFBConn2(uint8_t(gen.bounded(0, 16)));
+        ins.en_4op = gen.bounded(0, 2) != 0;
+        ins.en_pseudo4op = ins.en_4op && gen.bounded(0, 2) != 0;
+        ins.is_fixed_note = gen.bounded(0, 2) != 0;
+        ins.is_blank = (i % 7) == 0;
+        ins.percNoteNum = uint8_t(gen.bounded(0, 128));
+        ins.fine_tune = int8_t(gen.bounded(-128, 128));
+        ins.note_offset1 = int16_t(gen.bounded(-128, 128));
+        ins.note_offset2 = int16_t(gen.bounded(-128, 128));
+        ins.velocity_offset = int8_t(gen.bounded(-128, 128));
+        ins.rhythm_drum_type = uint8_t(gen.bounded(0, 11));
+        ins.ms_sound_kon = uint16_t(gen.bounded(0, 65536));
+        ins.ms_sound_koff = uint16_t(gen.bounded(0, 65536));
+        snprintf(ins.name, 32, "Packed %d", i);
+        return ins;
+    }
+
+    static void fillStorage(FmBank::InsStorage &box, int count)
+    {
+        QRandomGenerator gen(count);
+        box.resize(count);
+        for(int i = 0; i < count; i++)
+            box[i] = randomInstrument(gen, i);
+        // Entirely zero instrument
+        memset(&box[1], 0, sizeof(FmBank::Instrument));
+    }
+
+private Q_SLOTS:
+    void packRoundTrip()
+    {
+        FmBank::InsStorage box;
+        fillStorage(box, 300);
+
+        FmBankPacked packed(box);
+        QCOMPARE(packed.size(), 300);
+        for(int i = 0; i < box.size(); i++)
+        {
+            FmBank::Instrument ins = packed.instrument(i);
+            QVERIFY2(memcmp(&ins, &box.at(i), sizeof(FmBank::Instrument)) == 0,
+                     qPrintable(QString("Instrument %1 differs").arg(i)));
+        }
+    }
+
+    void hashes()
+    {
+        FmBank::InsStorage box;
+        fillStorage(box, 6);
+        box[3] = box.at(2);
+        // Same sound under another name and with other durations
+        box[4] = box.at(2);
+        snprintf(box[4].name, 32, "Another name");
+        box[4].ms_sound_kon++;
+        // Different sound
+        box[5] = box.at(2);
+        box[5].OP[CARRIER1].level = uint8_t((box.at(5).OP[CARRIER1].level + 1) & 0x3F);
+
+        FmBankPacked packed(box);
+        QVector<uint32_t> plain, named, measured;
+        packed.hashes(plain);
+        packed.hashes(named, FmBankPacked::HASH_NAME);
+        packed.hashes(measured, FmBankPacked::HASH_MEASURE);
+        QCOMPARE(plain.size(), 6);
+
+        QCOMPARE(plain[2], plain[3]);
+        QCOMPARE(named[2], named[3]);
+        QCOMPARE(measured[2], measured[3]);
+
+        QCOMPARE(plain[2], plain[4]);
+        QVERIFY(named[2] != named[4]);
+        QVERIFY(measured[2] != measured[4]);
+
+        QVERIFY(plain[2] != plain[5]);
+
+        // Hashes are the same for every packing of the same data
+        FmBankPacked again(box);
+        QVector<uint32_t> plainAgain;
+        again.hashes(plainAgain);
+        QCOMPARE(plainAgain, plain);
+    }
+};
+
+QTEST_APPLESS_MAIN(BankPackedTest)
+
+#include "tst_bank_packed.moc"
@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# Copy-on-write storage of bank instruments
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_bank_storage
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_bank_storage.cpp \
+    ../../src/bank.cpp
+
+HEADERS += \
+    ../../src/bank.h
@@ -0,0 +1,57 @@
+#include <QString>
+#include <QtTest>
+
+#include <bank.h>
+
+class BankStorageTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void copyKeepsVolumeModel()
+    {
+        FmBank src;
+        src.volume_model = FmBank::VOLUME_DMX;
+        src.deep_tremolo = true;
+
+        FmBank constructed(src);
+        QCOMPARE(constructed.volume_model, uint8_t(FmBank::VOLUME_DMX));
+        QVERIFY(constructed.deep_tremolo);
+
+        FmBank assigned;
+        assigned = src;
+        QCOMPARE(assigned.volume_model, uint8_t(FmBank::VOLUME_DMX));
+        QVERIFY(assigned.deep_tremolo);
+    }
+
+    void tmpBankHasExactSize()
+    {
+        FmBank src;
+        src.reset(2, 1);
+        src.Ins_Melodic_box[0].feedback1 = 5;
+        src.Ins_Melodic_box[200].feedback1 = 7;
+        src.Ins_Percussion_box[100].feedback1 = 3;
+
+        TmpBank cut(src, 128, 128);
+        QCOMPARE(cut.insMelodic.size(), 128);
+        QCOMPARE(cut.insPercussion.size(), 128);
+        QCOMPARE(cut.insMelodic.at(0).feedback1, uint8_t(5));
+        QVERIFY(cut.insMelodic.isSameBlock(src.Ins_Melodic_box, 0));
+
+        TmpBank padded(src, 384, 256);
+        QCOMPARE(padded.insMelodic.size(), 384);
+        QCOMPARE(padded.insPercussion.size(), 256);
+        QCOMPARE(padded.insMelodic.at(200).feedback1, uint8_t(7));
+        QCOMPARE(padded.insMelodic.at(300).feedback1, uint8_t(0));
+        QCOMPARE(padded.insPercussion.at(100).feedback1, uint8_t(3));
+        QCOMPARE(padded.insPercussion.at(200).feedback1, uint8_t(0));
+
+        // The source is not touched by the view
+        QCOMPARE(src.Ins_Melodic_box.size(), 256);
+        QCOMPARE(src.Ins_Percussion_box.size(), 128);
+    }
+};
+
+QTEST_APPLESS_MAIN(BankStorageTest)
+
+#include "tst_bank_storage.moc"
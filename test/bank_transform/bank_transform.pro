@@ -0,0 +1,29 @@
+#-------------------------------------------------
+#
+# Bulk transforms of bank instruments
+#
+#-------------------------------------------------
+
+QT       += testlib concurrent
+
+QT       -= gui
+
+TARGET = tst_bank_transform
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_bank_transform.cpp \
+    ../../src/bank.cpp \
+    ../../src/bank_transform.cpp
+
+HEADERS += \
+    ../../src/bank.h \
+    ../../src/bank_transform.h \
+    ../../src/metaparameter.h
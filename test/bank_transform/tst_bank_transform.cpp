@@ -0,0 +1,181 @@
+#include <QString>
+#include <QtTest>
+
+#include <bank.h>
+#include <bank_transform.h>
+
+class BankTransformTest : public QObject
+{
+    Q_OBJECT
+
+    static FmBank::Instrument makeInstrument()
+    {
+        FmBank::Instrument ins = FmBank::emptyInst();
+        ins.connection1 = FmBank::Instrument::FM;
+        ins.feedback1 = 2;
+        for(int op = 0; op < 4; op++)
+        {
+            ins.OP[op].level = 40;
+            ins.OP[op].fmult = 6;
+            ins.OP[op].attack = 12;
+        }
+        return ins;
+    }
+
+    static BankTransform::Operation makeOperation(BankTransform::Operation::Type type,
+                                                  const char *param, double value)
+    {
+        BankTransform::Operation op;
+        op.type = type;
+        op.param = QString::fromLatin1(param);
+        op.value = value;
+        return op;
+    }
+
+private Q_SLOTS:
+    void unknownParameterIsRejected()
+    {
+        BankTransform transform;
+        QVERIFY(!transform.addOperation(makeOperation(BankTransform::Operation::OP_SET, "nope", 1)));
+        QVERIFY(!transform.addOperation(makeOperation(BankTransform::Operation::OP_ADD, "", 1)));
+        QVERIFY(transform.isEmpty());
+        QVERIFY(!transform.affectsSound());
+
+        BankTransform::Operation conv;
+        conv.type = BankTransform::Operation::OP_PSEUDO4OP_TO_2OP;
+        QVERIFY(transform.addOperation(conv));
+        QCOMPARE(transform.operations().size(), 1);
+    }
+
+    void valueOperations()
+    {
+        BankTransform transform;
+        QVERIFY(transform.addOperation(makeOperation(BankTransform::Operation::OP_SET, "fb1", 5)));
+        QVERIFY(transform.addOperation(makeOperation(BankTransform::Operation::OP_ADD, "tl", 100)));
+        QVERIFY(transform.addOperation(makeOperation(BankTransform::Operation::OP_SCALE, "mul", 0.5)));
+        BankTransform::Operation clamp = makeOperation(BankTransform::Operation::OP_CLAMP, "ar", 0);
+        clamp.min = 2;
+        clamp.max = 5;
+        QVERIFY(transform.addOperation(clamp));
+
+        FmBank::Instrument ins = makeInstrument();
+        QVERIFY(transform.apply(ins));
+        QCOMPARE(ins.feedback1, uint8_t(5));
+        QCOMPARE(ins.OP[MODULATOR1].level, uint8_t(63));
+        QCOMPARE(ins.OP[CARRIER1].level, uint8_t(63));
+        QCOMPARE(ins.OP[MODULATOR1].fmult, uint8_t(3));
+        QCOMPARE(ins.OP[CARRIER1].attack, uint8_t(5));
+        // Operators of the second voice are not in use by a 2-operator instrument
+        QCOMPARE(ins.OP[MODULATOR2].level, uint8_t(40));
+        QCOMPARE(ins.OP[CARRIER2].fmult, uint8_t(6));
+
+        // Setting of the same value is not a change
+        FmBank::Instrument again = ins;
+        BankTransform set;
+        QVERIFY(set.addOperation(makeOperation(BankTransform::Operation::OP_SET, "fb1", 5)));
+        QVERIFY(!set.apply(again));
+    }
+
+    void operatorSelection()
+    {
+        BankTransform::Operation op = makeOperation(BankTransform::Operation::OP_SET, "tl", 10);
+        op.ops = BankTransform::OPS_CARRIERS;
+        BankTransform carriers;
+        QVERIFY(carriers.addOperation(op));
+
+        FmBank::Instrument fm = makeInstrument();
+        QVERIFY(carriers.apply(fm));
+        QCOMPARE(fm.OP[CARRIER1].level, uint8_t(10));
+        QCOMPARE(fm.OP[MODULATOR1].level, uint8_t(40));
+
+        // Both operators are sounding with additive synthesis
+        FmBank::Instrument am = makeInstrument();
+        am.connection1 = FmBank::Instrument::AM;
+        QVERIFY(carriers.apply(am));
+        QCOMPARE(am.OP[CARRIER1].level, uint8_t(10));
+        QCOMPARE(am.OP[MODULATOR1].level, uint8_t(10));
+
+        op.ops = BankTransform::OPS_MODULATORS;
+        BankTransform modulators;
+        QVERIFY(modulators.addOperation(op));
+        FmBank::Instrument fm2 = makeInstrument();
+        QVERIFY(modulators.apply(fm2));
+        QCOMPARE(fm2.OP[CARRIER1].level, uint8_t(40));
+        QCOMPARE(fm2.OP[MODULATOR1].level, uint8_t(10));
+    }
+
+    void pseudo4opTo2op()
+    {
+        BankTransform::Operation op;
+        op.type = BankTransform::Operation::OP_PSEUDO4OP_TO_2OP;
+        BankTransform transform;
+        QVERIFY(transform.addOperation(op));
+
+        FmBank::Instrument pseudo = makeInstrument();
+        pseudo.en_4op = true;
+        pseudo.en_pseudo4op = true;
+        QVERIFY(transform.apply(pseudo));
+        QVERIFY(!pseudo.en_4op);
+        QVERIFY(!pseudo.en_pseudo4op);
+
+        FmBank::Instrument real4op = makeInstrument();
+        real4op.en_4op = true;
+        QVERIFY(!transform.apply(real4op));
+        QVERIFY(real4op.en_4op);
+    }
+
+    void affectsSound()
+    {
+        BankTransform measure;
+        QVERIFY(measure.addOperation(makeOperation(BankTransform::Operation::OP_SET, "kon", 0)));
+        QVERIFY(measure.addOperation(makeOperation(BankTransform::Operation::OP_SET, "koff", 0)));
+        QVERIFY(!measure.affectsSound());
+
+        QVERIFY(measure.addOperation(makeOperation(BankTransform::Operation::OP_ADD, "tl", -1)));
+        QVERIFY(measure.affectsSound());
+    }
+
+    void storageKeepsUnchangedBlocks()
+    {
+        FmBank::InsStorage box;
+        box.resize(256);
+        box.fill(makeInstrument());
+        box[130].is_blank = true;
+        FmBank::InsStorage copy = box;
+
+        BankTransform same;
+        QVERIFY(same.addOperation(makeOperation(BankTransform::Operation::OP_SET, "fb1", 2)));
+        QVector<int> changed;
+        QCOMPARE(same.apply(copy, BankTransform::allIndices(copy), &changed), 0);
+        QVERIFY(changed.isEmpty());
+        QVERIFY(copy.isSameBlock(box, 0));
+        QVERIFY(copy.isSameBlock(box, 1));
+
+        BankTransform set;
+        QVERIFY(set.addOperation(makeOperation(BankTransform::Operation::OP_SET, "fb1", 7)));
+        QCOMPARE(set.apply(copy, BankTransform::bankIndices(copy, 1), &changed), 127);
+        QCOMPARE(changed.size(), 127);
+        QVERIFY(!changed.contains(130));
+        QVERIFY(copy.isSameBlock(box, 0));
+        QCOMPARE(copy.at(129).feedback1, uint8_t(7));
+        // Blank instruments are skipped
+        QCOMPARE(copy.at(130).feedback1, uint8_t(2));
+        QCOMPARE(box.at(129).feedback1, uint8_t(2));
+    }
+
+    void indices()
+    {
+        FmBank::InsStorage box;
+        box.resize(200);
+        QCOMPARE(BankTransform::allIndices(box).size(), 200);
+        QVector<int> second = BankTransform::bankIndices(box, 1);
+        QCOMPARE(second.size(), 72);
+        QCOMPARE(second.first(), 128);
+        QCOMPARE(second.last(), 199);
+        QVERIFY(BankTransform::bankIndices(box, 2).isEmpty());
+    }
+};
+
+QTEST_APPLESS_MAIN(BankTransformTest)
+
+#include "tst_bank_transform.moc"
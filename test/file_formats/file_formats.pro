@@ -0,0 +1,67 @@
+#-------------------------------------------------
+#
+# Reading and writing of banks through the formats factory,
+# and the catalog of banks in the directory
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_file_formats
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+LIBS += -lz
+
+SOURCES += \
+        tst_file_formats.cpp \
+    ../../src/bank.cpp \
+    ../../src/bank_packed.cpp \
+    ../../src/common.cpp \
+    ../../src/FileFormats/ffmt_base.cpp \
+    ../../src/FileFormats/ffmt_enums.cpp \
+    ../../src/FileFormats/ffmt_archive.cpp \
+    ../../src/FileFormats/ffmt_factory.cpp \
+    ../../src/FileFormats/ffmt_library.cpp \
+    ../../src/FileFormats/format_adlib_bnk.cpp \
+    ../../src/FileFormats/format_adlib_tim.cpp \
+    ../../src/FileFormats/format_adlibgold_bnk2.cpp \
+    ../../src/FileFormats/format_ail2_gtl.cpp \
+    ../../src/FileFormats/format_apogeetmb.cpp \
+    ../../src/FileFormats/format_bisqwit.cpp \
+    ../../src/FileFormats/format_cmf_importer.cpp \
+    ../../src/FileFormats/format_dmxopl2.cpp \
+    ../../src/FileFormats/format_imf_importer.cpp \
+    ../../src/FileFormats/format_junlevizion.cpp \
+    ../../src/FileFormats/format_rad_importer.cpp \
+    ../../src/FileFormats/format_sb_ibk.cpp \
+    ../../src/FileFormats/format_dro_importer.cpp \
+    ../../src/FileFormats/format_vgm_import.cpp \
+    ../../src/FileFormats/format_smaf_importer.cpp \
+    ../../src/FileFormats/format_misc_sgi.cpp \
+    ../../src/FileFormats/format_misc_cif.cpp \
+    ../../src/FileFormats/format_misc_hsc.cpp \
+    ../../src/FileFormats/format_wohlstand_opl3.cpp \
+    ../../src/FileFormats/format_flatbuffer_opl3.cpp \
+    ../../src/FileFormats/format_patch_fm4.cpp \
+    ../../src/FileFormats/ymf262_to_wopi.cpp \
+    ../../src/FileFormats/wopl/wopl_file.c
+
+HEADERS += \
+    ../../src/bank.h \
+    ../../src/bank_packed.h \
+    ../../src/common.h \
+    ../../src/FileFormats/ffmt_base.h \
+    ../../src/FileFormats/ffmt_enums.h \
+    ../../src/FileFormats/ffmt_archive.h \
+    ../../src/FileFormats/ffmt_factory.h \
+    ../../src/FileFormats/ffmt_library.h \
+    ../../src/FileFormats/format_flatbuffer_opl3.h
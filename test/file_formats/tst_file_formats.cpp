@@ -0,0 +1,1129 @@
+#include <QString>
+#include <QFile>
+#include <QBuffer>
+#include <QTemporaryDir>
+#include <QDir>
+#include <QDateTime>
+#include <QtTest>
+#include <zlib.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <bank.h>
+#include <FileFormats/ffmt_factory.h>
+#include <FileFormats/ffmt_archive.h>
+#include <FileFormats/ffmt_library.h>
+#include <FileFormats/format_sb_ibk.h>
+#include <FileFormats/format_flatbuffer_opl3.h>
+#include <FileFormats/Opl3Bank_generated.h>
+
+class FileFormatsTest : public QObject
+{
+    Q_OBJECT
+
+    QTemporaryDir m_dir;
+
+    static FmBank::Instrument makeInstrument(int i)
+    {
+        FmBank::Instrument ins = FmBank::emptyInst();
+        snprintf(ins.name, 32, "Instrument %d", i);
+        for(int op = 0; op < 4; op++)
+        {
+            ins.OP[op].level = uint8_t((i + op) % 64);
+            ins.OP[op].attack = uint8_t((i + op) % 16);
+            ins.OP[op].decay = uint8_t((i * 3 + op) % 16);
+            ins.OP[op].fmult = uint8_t(i % 16);
+            ins.OP[op].waveform = uint8_t(i % 8);
+        }
+        ins.feedback1 = uint8_t(i % 8);
+        ins.connection1 = uint8_t(i % 2);
+        ins.percNoteNum = uint8_t(35 + i % 40);
+        return ins;
+    }
+
+    static void fillBank(FmBank &bank)
+    {
+        bank.reset();
+        for(int i = 0; i < 128; i++)
+        {
+            bank.Ins_Melodic_box[i] = makeInstrument(i);
+            bank.Ins_Percussion_box[i] = makeInstrument(i + 128);
+        }
+    }
+
+    static QByteArray readFile(const QString &path)
+    {
+        QFile f(path);
+        if(!f.open(QIODevice::ReadOnly))
+            return QByteArray();
+        return f.readAll();
+    }
+
+    static bool writeFile(const QString &path, const QByteArray &data)
+    {
+        QDir().mkpath(QFileInfo(path).path());
+        QFile f(path);
+        if(!f.open(QIODevice::WriteOnly))
+            return false;
+        return f.write(data) == data.size();
+    }
+
+    static bool setModified(const QString &path, const QDateTime &time)
+    {
+        QFile f(path);
+        return f.open(QIODevice::ReadWrite) && f.setFileTime(time, QFileDevice::FileModificationTime);
+    }
+
+    static QByteArray bankData(const char *prefix, int melodicBanks = 1)
+    {
+        FmBank bank;
+        bank.reset(uint16_t(melodicBanks), 1);
+        for(int i = 0; i < bank.Ins_Melodic_box.size(); i++)
+        {
+            bank.Ins_Melodic_box[i] = makeInstrument(i);
+            snprintf(bank.Ins_Melodic_box[i].name, 32, "%s %d", prefix, i);
+        }
+        for(int i = 0; i < 128; i++)
+            bank.Ins_Percussion_box[i] = makeInstrument(i + 128);
+        QByteArray data;
+        FmBankFormatFactory::SaveBankData(data, bank, BankFormats::FORMAT_WOHLSTAND_OPL3);
+        return data;
+    }
+
+    static void putLE(QByteArray &out, quint64 value, int bytes)
+    {
+        for(int i = 0; i < bytes; i++)
+            out.append(char((value >> (8 * i)) & 0xFF));
+    }
+
+    struct ZipItem
+    {
+        QString    name;
+        QByteArray data;
+        bool       deflate;
+        //! Modification time in the DOS format
+        quint16    time;
+        quint16    date;
+        //! Size to record instead of the real one, -1 to record the real size
+        qint64     declaredSize;
+        //! Count of bytes to cut off the end of the packed data
+        int        cut;
+        bool       badCrc;
+    };
+
+    static ZipItem zipItem(const QString &name, const QByteArray &data, bool deflate, quint16 time = 0x6000)
+    {
+        ZipItem item;
+        item.name = name;
+        item.data = data;
+        item.deflate = deflate;
+        item.time = time;
+        item.date = 0x5A21;
+        item.declaredSize = -1;
+        item.cut = 0;
+        item.badCrc = false;
+        return item;
+    }
+
+    static QByteArray rawDeflate(const QByteArray &data)
+    {
+        z_stream zs;
+        memset(&zs, 0, sizeof(zs));
+        deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+        QByteArray out(int(deflateBound(&zs, uLong(data.size()))), '\0');
+        zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+        zs.avail_in = uInt(data.size());
+        zs.next_out = reinterpret_cast<Bytef *>(out.data());
+        zs.avail_out = uInt(out.size());
+        deflate(&zs, Z_FINISH);
+        out.resize(int(zs.total_out));
+        deflateEnd(&zs);
+        return out;
+    }
+
+    /**
+     * @brief Make the ZIP archive
+     * @param items Entries of the archive
+     * @param zip64 Put sizes and offsets into ZIP64 records
+     */
+    static QByteArray zipArchive(const QVector<ZipItem> &items, bool zip64 = false)
+    {
+        const quint64 mask = 0xFFFFFFFF;
+        QByteArray out, dir;
+        for(const ZipItem &item : items)
+        {
+            const QByteArray name = item.name.toUtf8();
+            QByteArray packed = item.deflate ? rawDeflate(item.data) : item.data;
+            packed.chop(item.cut);
+            quint32 crc = quint32(crc32(0, reinterpret_cast<const Bytef *>(item.data.constData()), uInt(item.data.size())));
+            if(item.badCrc)
+                crc ^= 1;
+            const quint64 size = (item.declaredSize >= 0) ? quint64(item.declaredSize) : quint64(item.data.size());
+            const quint64 offset = quint64(out.size());
+
+            QByteArray localExtra, dirExtra;
+            if(zip64)
+            {
+                putLE(localExtra, 0x0001, 2);
+                putLE(localExtra, 16, 2);
+                putLE(localExtra, size, 8);
+                putLE(localExtra, quint64(packed.size()), 8);
+                putLE(dirExtra, 0x0001, 2);
+                putLE(dirExtra, 24, 2);
+                putLE(dirExtra, size, 8);
+                putLE(dirExtra, quint64(packed.size()), 8);
+                putLE(dirExtra, offset, 8);
+            }
+
+            putLE(out, 0x04034b50, 4);
+            putLE(out, zip64 ? 45 : 20, 2);
+            putLE(out, 0x0800, 2);
+            putLE(out, item.deflate ? 8 : 0, 2);
+            putLE(out, item.time, 2);
+            putLE(out, item.date, 2);
+            putLE(out, crc, 4);
+            putLE(out, zip64 ? mask : quint64(packed.size()), 4);
+            putLE(out, zip64 ? mask : size, 4);
+            putLE(out, quint64(name.size()), 2);
+            putLE(out, quint64(localExtra.size()), 2);
+            out.append(name);
+            out.append(localExtra);
+            out.append(packed);
+
+            putLE(dir, 0x02014b50, 4);
+            putLE(dir, zip64 ? 45 : 20, 2);
+            putLE(dir, zip64 ? 45 : 20, 2);
+            putLE(dir, 0x0800, 2);
+            putLE(dir, item.deflate ? 8 : 0, 2);
+            putLE(dir, item.time, 2);
+            putLE(dir, item.date, 2);
+            putLE(dir, crc, 4);
+            putLE(dir, zip64 ? mask : quint64(packed.size()), 4);
+            putLE(dir, zip64 ? mask : size, 4);
+            putLE(dir, quint64(name.size()), 2);
+            putLE(dir, quint64(dirExtra.size()), 2);
+            putLE(dir, 0, 2);
+            putLE(dir, 0, 2);
+            putLE(dir, 0, 2);
+            putLE(dir, 0, 4);
+            putLE(dir, zip64 ? mask : offset, 4);
+            dir.append(name);
+            dir.append(dirExtra);
+        }
+
+        const quint64 dirOffset = quint64(out.size());
+        out.append(dir);
+        if(zip64)
+        {
+            const quint64 end64 = quint64(out.size());
+            putLE(out, 0x06064b50, 4);
+            putLE(out, 44, 8);
+            putLE(out, 45, 2);
+            putLE(out, 45, 2);
+            putLE(out, 0, 4);
+            putLE(out, 0, 4);
+            putLE(out, quint64(items.size()), 8);
+            putLE(out, quint64(items.size()), 8);
+            putLE(out, quint64(dir.size()), 8);
+            putLE(out, dirOffset, 8);
+
+            putLE(out, 0x07064b50, 4);
+            putLE(out, 0, 4);
+            putLE(out, end64, 8);
+            putLE(out, 1, 4);
+        }
+        putLE(out, 0x06054b50, 4);
+        putLE(out, 0, 4);
+        putLE(out, zip64 ? 0xFFFF : quint64(items.size()), 2);
+        putLE(out, zip64 ? 0xFFFF : quint64(items.size()), 2);
+        putLE(out, zip64 ? mask : quint64(dir.size()), 4);
+        putLE(out, zip64 ? mask : dirOffset, 4);
+        putLE(out, 0, 2);
+        return out;
+    }
+
+    static QByteArray gzip(const QByteArray &data)
+    {
+        z_stream zs;
+        memset(&zs, 0, sizeof(zs));
+        deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+        QByteArray out(int(deflateBound(&zs, uLong(data.size()))), '\0');
+        zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+        zs.avail_in = uInt(data.size());
+        zs.next_out = reinterpret_cast<Bytef *>(out.data());
+        zs.avail_out = uInt(out.size());
+        deflate(&zs, Z_FINISH);
+        out.resize(int(zs.total_out));
+        deflateEnd(&zs);
+        return out;
+    }
+
+    static bool gunzip(const QByteArray &data, QByteArray &out, qint64 maxSize = -1)
+    {
+        QBuffer in;
+        in.setData(data);
+        in.open(QIODevice::ReadOnly);
+        QBuffer unpacked;
+        unpacked.open(QIODevice::WriteOnly);
+        bool ret = FmBankArchive::gunzip(in, unpacked, maxSize);
+        out = unpacked.data();
+        return ret;
+    }
+
+    static QByteArray flatbufferBank(uint8_t program, BankType type)
+    {
+        flatbuffers::FlatBufferBuilder builder(1024);
+        Operator op(0x21, 0x10, 0xF2, 0x74, 0);
+        auto name = builder.CreateString("Bad");
+        std::vector<flatbuffers::Offset<Instrument>> instruments;
+        instruments.push_back(CreateInstrument(builder, program, name, 0, 0, 0, 0, 0, Mode_TwoOp, 0, 0, &op, &op));
+        auto bnk = CreateBank(builder, 0, type, 0, 0, builder.CreateVector(instruments));
+        std::vector<flatbuffers::Offset<Bank>> banks(1, bnk);
+        FinishOpl3BankBuffer(builder, CreateOpl3Bank(builder, 1, 0, VolumeModel_Auto, builder.CreateVector(banks)));
+        return QByteArray(reinterpret_cast<const char *>(builder.GetBufferPointer()), int(builder.GetSize()));
+    }
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        FmBankFormatFactory::registerAllFormats();
+        QVERIFY(m_dir.isValid());
+    }
+
+    void bankFileEqualsData()
+    {
+        int checked = 0;
+        for(const FmBankFormatBase *format : FmBankFormatFactory::allBankFormats())
+        {
+            if(!(format->formatCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)))
+                continue;
+            const BankFormats id = format->formatId();
+            const QString name = format->formatName();
+
+            FmBank forFile, forData;
+            fillBank(forFile);
+            fillBank(forData);
+
+            QString path = m_dir.filePath(QString("bank%1").arg(int(id)));
+            QByteArray data;
+            FfmtErrCode fileErr = FmBankFormatFactory::SaveBankFile(path, forFile, id);
+            FfmtErrCode dataErr = FmBankFormatFactory::SaveBankData(data, forData, id);
+            QVERIFY2(fileErr == dataErr, qPrintable(name));
+            if(fileErr != FfmtErrCode::ERR_OK)
+                continue;
+            QVERIFY2(readFile(path) == data, qPrintable(name));
+
+            if(!(format->formatCaps() & int(FormatCaps::FORMAT_CAPS_OPEN)))
+                continue;
+
+            FmBank fromFile, fromData;
+            BankFormats fileFormat, dataFormat;
+            fileErr = FmBankFormatFactory::OpenBankFile(path, fromFile, &fileFormat);
+            dataErr = FmBankFormatFactory::OpenBankData(data, path, fromData, &dataFormat);
+            QVERIFY2(fileErr == FfmtErrCode::ERR_OK, qPrintable(name));
+            QVERIFY2(dataErr == FfmtErrCode::ERR_OK, qPrintable(name));
+            QVERIFY2(fileFormat == dataFormat, qPrintable(name));
+            QVERIFY2(fromFile == fromData, qPrintable(name));
+            checked++;
+        }
+        QVERIFY(checked > 0);
+    }
+
+    void instrumentFileEqualsData()
+    {
+        int checked = 0;
+        for(const FmBankFormatBase *format : FmBankFormatFactory::allInstrumentFormats())
+        {
+            if(!(format->formatInstCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)))
+                continue;
+            const InstFormats id = format->formatInstId();
+            const QString name = format->formatInstName();
+
+            for(int drum = 0; drum < 2; drum++)
+            {
+                FmBank::Instrument forFile = makeInstrument(drum ? 160 : 10);
+                FmBank::Instrument forData = forFile;
+
+                QString path = m_dir.filePath(QString("ins%1-%2").arg(int(id)).arg(drum));
+                QByteArray data;
+                FfmtErrCode fileErr = FmBankFormatFactory::SaveInstrumentFile(path, forFile, id, drum != 0);
+                FfmtErrCode dataErr = FmBankFormatFactory::SaveInstrumentData(data, forData, id, drum != 0);
+                QVERIFY2(fileErr == dataErr, qPrintable(name));
+                if(fileErr != FfmtErrCode::ERR_OK)
+                    continue;
+                QVERIFY2(readFile(path) == data, qPrintable(name));
+
+                if(!(format->formatInstCaps() & int(FormatCaps::FORMAT_CAPS_OPEN)))
+                    continue;
+
+                FmBank::Instrument fromFile = FmBank::emptyInst();
+                FmBank::Instrument fromData = FmBank::emptyInst();
+                InstFormats fileFormat, dataFormat;
+                bool fileDrum = false, dataDrum = false;
+                fileErr = FmBankFormatFactory::OpenInstrumentFile(path, fromFile, &fileFormat, &fileDrum);
+                dataErr = FmBankFormatFactory::OpenInstrumentData(data, path, fromData, &dataFormat, &dataDrum);
+                QVERIFY2(fileErr == FfmtErrCode::ERR_OK, qPrintable(name));
+                QVERIFY2(dataErr == FfmtErrCode::ERR_OK, qPrintable(name));
+                QVERIFY2(fileFormat == dataFormat, qPrintable(name));
+                QCOMPARE(fileDrum, dataDrum);
+                QVERIFY2(memcmp(&fromFile, &fromData, sizeof(FmBank::Instrument)) == 0, qPrintable(name));
+                checked++;
+            }
+        }
+        QVERIFY(checked > 0);
+    }
+
+    void saveSizeMatchesData()
+    {
+        FmBank small, large;
+        fillBank(small);
+        fillBank(large);
+        large.Ins_Melodic_box.resize(256);
+        large.Banks_Melodic.resize(2);
+        FmBank *banks[] = {&small, &large};
+
+        int checked = 0;
+        for(const FmBankFormatBase *format : FmBankFormatFactory::allBankFormats())
+        {
+            if(!(format->formatCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)))
+                continue;
+            for(FmBank *source : banks)
+            {
+                FmBank bank = *source;
+                const qint64 size = format->saveSize(bank);
+                if(size < 0)
+                    continue;
+                QByteArray data;
+                QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, format->formatId()) == FfmtErrCode::ERR_OK);
+                QVERIFY2(size == data.size(), qPrintable(format->formatName()));
+                checked++;
+            }
+        }
+        QVERIFY(checked > 0);
+
+        checked = 0;
+        for(const FmBankFormatBase *format : FmBankFormatFactory::allInstrumentFormats())
+        {
+            if(!(format->formatInstCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)))
+                continue;
+            for(int drum = 0; drum < 2; drum++)
+            {
+                FmBank::Instrument ins = makeInstrument(drum ? 160 : 10);
+                const qint64 size = format->saveInstSize(ins, drum != 0);
+                if(size < 0)
+                    continue;
+                QByteArray data;
+                QVERIFY(FmBankFormatFactory::SaveInstrumentData(data, ins, format->formatInstId(), drum != 0) == FfmtErrCode::ERR_OK);
+                QVERIFY2(size == data.size(), qPrintable(format->formatInstName()));
+                checked++;
+            }
+        }
+        QVERIFY(checked > 0);
+    }
+
+    void failedSaveKeepsFile()
+    {
+        const QString path = m_dir.filePath("keep.ibk");
+        const QByteArray original("Original file content");
+        QFile f(path);
+        QVERIFY(f.open(QIODevice::WriteOnly));
+        f.write(original);
+        f.close();
+
+        // The reader can't serialize, the file must not be even opened for writing
+        FmBank bank;
+        fillBank(bank);
+        SbIBK_UNIX_READ reader;
+        QVERIFY(reader.saveFile(path, bank) != FfmtErrCode::ERR_OK);
+        QCOMPARE(readFile(path), original);
+    }
+
+    void failedWriteKeepsFile()
+    {
+        QDir dir(m_dir.path());
+        QVERIFY(dir.mkpath("readonly"));
+        const QString dirPath = dir.filePath("readonly");
+        const QString path = dirPath + "/keep.bin";
+        const QByteArray original("Original file content");
+        QFile f(path);
+        QVERIFY(f.open(QIODevice::WriteOnly));
+        f.write(original);
+        f.close();
+
+        // The temporary file can't be created near the destination
+        const QFileDevice::Permissions perms = QFile::permissions(dirPath);
+        QFile::setPermissions(dirPath, QFileDevice::ReadOwner | QFileDevice::ExeOwner);
+        QFile probe(dirPath + "/probe");
+        const bool writable = probe.open(QIODevice::WriteOnly);
+        if(writable)
+        {
+            probe.close();
+            probe.remove();
+        }
+
+        FfmtErrCode err = FfmtErrCode::ERR_OK;
+        if(!writable)
+            err = FmBankFormatBase::writeFileData(path, QByteArray(4096, 'x'));
+        QFile::setPermissions(dirPath, perms);
+
+        if(writable)
+            QSKIP("Permissions are not enforced for this user");
+        QCOMPARE(err, FfmtErrCode::ERR_NOFILE);
+        QCOMPARE(readFile(path), original);
+    }
+
+    void parallelMixedFormats()
+    {
+        // Readers of several variants are shared by all threads of the converter
+        struct Source
+        {
+            const char *name;
+            BankFormats saveAs;
+            QString path;
+            FmBank bank;
+            BankFormats format;
+        };
+        Source sources[] =
+        {
+            {"bank.o3", BankFormats::FORMAT_SB4OP, QString(), FmBank(), BankFormats::FORMAT_UNKNOWN},
+            {"bank.sb", BankFormats::FORMAT_SB2OP, QString(), FmBank(), BankFormats::FORMAT_UNKNOWN},
+            {"bank.ibk", BankFormats::FORMAT_IBK, QString(), FmBank(), BankFormats::FORMAT_UNKNOWN},
+            {"adlib.bnk", BankFormats::FORMAT_ADLIB_BKN1, QString(), FmBank(), BankFormats::FORMAT_UNKNOWN},
+            {"hmi.bnk", BankFormats::FORMAT_ADLIB_BKNHMI, QString(), FmBank(), BankFormats::FORMAT_UNKNOWN},
+        };
+        const int sourcesCount = int(sizeof(sources) / sizeof(*sources));
+
+        for(Source &src : sources)
+        {
+            FmBank bank;
+            fillBank(bank);
+            src.path = m_dir.filePath(src.name);
+            QByteArray data;
+            QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, src.saveAs) == FfmtErrCode::ERR_OK);
+            QFile f(src.path);
+            QVERIFY(f.open(QIODevice::WriteOnly));
+            f.write(data);
+            f.close();
+            QVERIFY(FmBankFormatFactory::OpenBankFile(src.path, src.bank, &src.format) == FfmtErrCode::ERR_OK);
+            QVERIFY2(src.format != BankFormats::FORMAT_UNKNOWN, src.name);
+        }
+        QVERIFY(sources[0].format == BankFormats::FORMAT_SB4OP || sources[0].format == BankFormats::FORMAT_SB4OP_DRUMS);
+        QVERIFY(sources[1].format == BankFormats::FORMAT_SB2OP || sources[1].format == BankFormats::FORMAT_SB2OP_DRUMS);
+        QCOMPARE(sources[3].format, BankFormats::FORMAT_ADLIB_BKN1);
+        QCOMPARE(sources[4].format, BankFormats::FORMAT_ADLIB_BKNHMI);
+
+        std::atomic<int> mismatches(0);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 8; t++)
+        {
+            threads.emplace_back([&, t]()
+            {
+                for(int i = 0; i < 200; i++)
+                {
+                    Source &src = sources[(t + i) % sourcesCount];
+                    FmBank bank;
+                    BankFormats format = BankFormats::FORMAT_UNKNOWN;
+                    FfmtErrCode err = FmBankFormatFactory::OpenBankFile(src.path, bank, &format);
+                    if(err != FfmtErrCode::ERR_OK || format != src.format || !(bank == src.bank))
+                        mismatches++;
+                }
+            });
+        }
+        for(std::thread &t : threads)
+            t.join();
+        QCOMPARE(mismatches.load(), 0);
+    }
+
+    void flatbufferLoaderMatchesBank()
+    {
+        FmBank bank;
+        fillBank(bank);
+        bank.Ins_Melodic_box[5].is_blank = true;
+        bank.Ins_Percussion_box[7].is_blank = true;
+        bank.Ins_Melodic_box[9].en_4op = true;
+        bank.Ins_Melodic_box[10].en_4op = true;
+        bank.Ins_Melodic_box[10].en_pseudo4op = true;
+        QByteArray data;
+        QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, BankFormats::FORMAT_FLATBUFFER_OPL3) == FfmtErrCode::ERR_OK);
+
+        FmBank loaded;
+        QVERIFY(FmBankFormatFactory::OpenBankData(data, "bank.fbop3", loaded) == FfmtErrCode::ERR_OK);
+
+        FlatbufferOpl3Loader loader;
+        QVERIFY(loader.openData(data) == FfmtErrCode::ERR_OK);
+        QVERIFY(loader.isOpen());
+        QCOMPARE(loader.countMelodic(), loaded.Ins_Melodic_box.size());
+        QCOMPARE(loader.countDrums(), loaded.Ins_Percussion_box.size());
+        for(int i = 0; i < loader.countMelodic(); i++)
+        {
+            FmBank::Instrument ins = loader.instrument(i, false);
+            QVERIFY2(memcmp(&ins, &loaded.Ins_Melodic_box.at(i), sizeof(FmBank::Instrument)) == 0,
+                     qPrintable(QString("Melodic %1 differs").arg(i)));
+        }
+        for(int i = 0; i < loader.countDrums(); i++)
+        {
+            FmBank::Instrument ins = loader.instrument(i, true);
+            QVERIFY(ins.is_fixed_note);
+            QVERIFY2(memcmp(&ins, &loaded.Ins_Percussion_box.at(i), sizeof(FmBank::Instrument)) == 0,
+                     qPrintable(QString("Percussion %1 differs").arg(i)));
+        }
+
+        // Slots out of the range are null
+        FmBank::Instrument missing = loader.instrument(loader.countMelodic(), false);
+        FmBank::Instrument empty = FmBank::emptyInst();
+        QVERIFY(memcmp(&missing, &empty, sizeof(FmBank::Instrument)) == 0);
+
+        FmBank converted;
+        loader.toBank(converted);
+        QVERIFY(converted == loaded);
+
+        loader.close();
+        QVERIFY(!loader.isOpen());
+        QCOMPARE(loader.countMelodic(), 0);
+    }
+
+    void flatbufferLoaderRejectsMalformed()
+    {
+        FmBank bank;
+        fillBank(bank);
+        QByteArray data;
+        QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, BankFormats::FORMAT_FLATBUFFER_OPL3) == FfmtErrCode::ERR_OK);
+
+        FlatbufferOpl3Loader loader;
+        QVERIFY(loader.openData(QByteArray()) == FfmtErrCode::ERR_BADFORMAT);
+        QVERIFY(loader.openData(data.left(7)) == FfmtErrCode::ERR_BADFORMAT);
+        QVERIFY(!loader.isOpen());
+
+        // Truncation is rejected unless it cuts off only the padding
+        FmBank full;
+        QVERIFY(loader.openData(data) == FfmtErrCode::ERR_OK);
+        loader.toBank(full);
+        int accepted = 0;
+        for(int size = 0; size < data.size(); size++)
+        {
+            if(loader.openData(data.left(size)) != FfmtErrCode::ERR_OK)
+            {
+                QVERIFY(!loader.isOpen());
+                continue;
+            }
+            FmBank truncated;
+            loader.toBank(truncated);
+            QVERIFY2(truncated == full, qPrintable(QString("Truncated to %1 bytes").arg(size)));
+            accepted++;
+        }
+        QVERIFY(accepted < 4);
+
+        QByteArray wrongId = data;
+        wrongId[4] = 'X';
+        QVERIFY(loader.openData(wrongId) == FfmtErrCode::ERR_BADFORMAT);
+
+        // Offsets out of the data
+        QByteArray badRoot = data;
+        badRoot[3] = char(0x7F);
+        QVERIFY(loader.openData(badRoot) == FfmtErrCode::ERR_BADFORMAT);
+
+        QVERIFY(loader.openData(flatbufferBank(127, BankType_Percussion)) == FfmtErrCode::ERR_OK);
+        QCOMPARE(loader.countDrums(), 128);
+        QCOMPARE(loader.instrument(127, true).OP[CARRIER1].level, loader.instrument(127, true).OP[MODULATOR1].level);
+        QVERIFY(loader.openData(flatbufferBank(128, BankType_Melodic)) == FfmtErrCode::ERR_BADFORMAT);
+        QVERIFY(loader.openData(flatbufferBank(0, BankType(2))) == FfmtErrCode::ERR_BADFORMAT);
+        QVERIFY(!loader.isOpen());
+
+        // Damaged bytes are either rejected, or give a bank which is safe to read
+        for(int i = 0; i < data.size(); i++)
+        {
+            QByteArray damaged = data;
+            damaged[i] = char(damaged.at(i) ^ 0xA5);
+            if(loader.openData(damaged) != FfmtErrCode::ERR_OK)
+                continue;
+            FmBank out;
+            loader.toBank(out);
+            QCOMPARE(out.Ins_Melodic_box.size(), loader.countMelodic());
+        }
+
+        FmBank loaded;
+        QVERIFY(FmBankFormatFactory::OpenBankData(data.left(data.size() / 2), "bank.fbop3", loaded) != FfmtErrCode::ERR_OK);
+    }
+
+    void libraryStore()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QVERIFY(writeFile(dir.filePath("a.wopl"), bankData("Alpha")));
+        QVERIFY(writeFile(dir.filePath("sub/b.wopl"), bankData("Beta")));
+        QVERIFY(writeFile(dir.filePath("junk.wopl"), QByteArray("not a bank")));
+
+        FmBankLibrary lib;
+        QVERIFY(!lib.open(dir.path()));
+        QCOMPARE(lib.count(), 0);
+
+        FmBankLibrary::UpdateStats st;
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.files, 3);
+        QCOMPARE(st.parsed, 2);
+        QCOMPARE(st.failed, 1);
+        QCOMPARE(st.instruments, 512);
+        QCOMPARE(lib.count(), 512);
+        QVERIFY(QFile::exists(lib.storePath()));
+
+        // The next opening uses the store as is
+        FmBankLibrary again;
+        QVERIFY(again.open(dir.path()));
+        QCOMPARE(again.filesCount(), 3);
+        QCOMPARE(again.count(), 512);
+        for(int i = 0; i < again.count(); i++)
+            QVERIFY(memcmp(&again.record(i), &lib.record(i), sizeof(FmBankLibrary::InstrumentRecord)) == 0);
+
+        FmBank a;
+        QVERIFY(FmBankFormatFactory::OpenBankFile(dir.filePath("a.wopl"), a) == FfmtErrCode::ERR_OK);
+        int aFile = -1;
+        for(int f = 0; f < again.filesCount(); f++)
+        {
+            if(again.filePath(f) == "a.wopl")
+                aFile = f;
+        }
+        QVERIFY(aFile >= 0);
+        const FmBankLibrary::FileRecord &rec = again.file(aFile);
+        QCOMPARE(int(rec.instrumentsCount), 256);
+        QCOMPARE(rec.format, int32_t(BankFormats::FORMAT_WOHLSTAND_OPL3));
+        for(int k = 0; k < 128; k++)
+        {
+            const int i = int(rec.firstInstrument) + k;
+            QVERIFY(!again.isDrum(i));
+            QCOMPARE(again.name(i), QString::fromUtf8(a.Ins_Melodic_box.at(k).name));
+            QVERIFY(again.findSound(a.Ins_Melodic_box.at(k)).contains(i));
+            QVERIFY(again.findSound(again.instrument(i)).contains(i));
+        }
+
+        QCOMPARE(again.search("alpha 12").size(), 9);
+        QCOMPARE(again.search("SUB/B").size(), 256);
+        QCOMPARE(again.search("beta", 5).size(), 5);
+        QCOMPARE(again.search(QString()).size(), 512);
+        QVERIFY(again.search("nothing").isEmpty());
+
+        FmBank found;
+        again.toBank(again.search("alpha"), found);
+        QCOMPARE(found.Ins_Melodic_box.size(), 128);
+        QCOMPARE(found.Ins_Percussion_box.size(), 0);
+    }
+
+    void libraryStoreValidation()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QVERIFY(writeFile(dir.filePath("a.wopl"), bankData("Alpha")));
+
+        FmBankLibrary lib;
+        lib.open(dir.path());
+        QVERIFY(lib.update() == FfmtErrCode::ERR_OK);
+        const QString storePath = lib.storePath();
+        lib.close();
+        const QByteArray store = readFile(storePath);
+
+        // The store is in the byte order of the host
+        auto field = [&store](int offset)
+        {
+            quint32 value;
+            memcpy(&value, store.constData() + offset, sizeof(value));
+            return value;
+        };
+        auto patched = [&store](int offset, quint32 value)
+        {
+            QByteArray out = store;
+            memcpy(out.data() + offset, &value, sizeof(value));
+            return out;
+        };
+        const int filesOffset = int(field(24));
+        const int instrumentsOffset = int(field(28));
+
+        QVector<QByteArray> broken;
+        broken << QByteArray()
+               << QByteArray("not a store")
+               << store.left(64)
+               << store.left(store.size() - 1)
+               << patched(0, 0x4C504F00)
+               << patched(8, field(8) + 1)
+               << patched(12, 0x04030201)
+               << patched(16, field(16) + 1)
+               << patched(20, 0x01000000)
+               << patched(24, 8)
+               << patched(28, field(28) + 4)
+               << patched(36, 0xFFFFFF00)
+               << patched(filesOffset + int(offsetof(FmBankLibrary::FileRecord, pathOffset)), 0x7FFFFFFF)
+               << patched(filesOffset + int(offsetof(FmBankLibrary::FileRecord, instrumentsCount)), 257)
+               << patched(instrumentsOffset + int(offsetof(FmBankLibrary::InstrumentRecord, file)), 1);
+
+        for(int i = 0; i < broken.size(); i++)
+        {
+            QVERIFY(writeFile(storePath, broken[i]));
+            FmBankLibrary damaged;
+            QVERIFY2(!damaged.open(dir.path()), qPrintable(QString("Store %1 is accepted").arg(i)));
+            QCOMPARE(damaged.count(), 0);
+            QCOMPARE(damaged.filesCount(), 0);
+
+            // Nothing is taken from the damaged store
+            FmBankLibrary::UpdateStats st;
+            QVERIFY(damaged.update(&st) == FfmtErrCode::ERR_OK);
+            QCOMPARE(st.parsed, 1);
+            QCOMPARE(st.unchanged, 0);
+            QCOMPARE(readFile(storePath), store);
+        }
+
+        QVERIFY(lib.open(dir.path()));
+        QVERIFY(lib.replaceStore(QByteArray("not a store")) == FfmtErrCode::ERR_BADFORMAT);
+        QCOMPARE(lib.count(), 0);
+    }
+
+    void libraryIncrementalUpdate()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString a = dir.filePath("a.wopl");
+        const QString b = dir.filePath("b.wopl");
+        const QString c = dir.filePath("c.zip");
+        QVERIFY(writeFile(a, bankData("Alpha")));
+        QVERIFY(writeFile(b, bankData("Beta")));
+        const QByteArray x = bankData("Xray");
+        QVERIFY(writeFile(c, zipArchive(QVector<ZipItem>() << zipItem("x.wopl", x, false)
+                                                           << zipItem("y.wopl", bankData("Yankee"), true))));
+
+        FmBankLibrary lib;
+        lib.open(dir.path());
+        FmBankLibrary::UpdateStats st;
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.files, 4);
+        QCOMPARE(st.parsed, 4);
+        QCOMPARE(lib.search("c.zip/y.wopl").size(), 256);
+
+        // Same size and time
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.unchanged, 4);
+        QCOMPARE(st.parsed, 0);
+
+        // Other time, same content
+        QVERIFY(setModified(a, QDateTime::currentDateTime().addSecs(3600)));
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.unchanged, 3);
+        QCOMPARE(st.sameContent, 1);
+        QCOMPARE(st.parsed, 0);
+
+        // Other content of the same size
+        const QByteArray betaData = bankData("Bet4");
+        QCOMPARE(betaData.size(), readFile(b).size());
+        QVERIFY(writeFile(b, betaData));
+        QVERIFY(setModified(b, QDateTime::currentDateTime().addSecs(7200)));
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.parsed, 1);
+        QCOMPARE(st.sameContent, 0);
+        QCOMPARE(lib.search("bet4").size(), 128);
+        QVERIFY(lib.search("beta").isEmpty());
+
+        // Other size
+        QVERIFY(writeFile(a, bankData("Alpha", 2)));
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.parsed, 1);
+        QCOMPARE(lib.search("alpha").size(), 256);
+
+        // Entries of the archive are compared by their CRC, the changed one only is parsed
+        QVERIFY(writeFile(c, zipArchive(QVector<ZipItem>() << zipItem("x.wopl", x, false, 0x6001)
+                                                           << zipItem("y.wopl", bankData("Zulu"), true))));
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.files, 4);
+        QCOMPARE(st.sameContent, 1);
+        QCOMPARE(st.parsed, 1);
+        QCOMPARE(lib.search("zulu").size(), 128);
+
+        QVERIFY(QFile::remove(b));
+        QVERIFY(lib.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.removed, 1);
+        QCOMPARE(st.files, 3);
+
+        // The catalog is the same as the one made from scratch
+        FmBankLibrary fresh;
+        fresh.open(dir.path(), dir.filePath("fresh.store"));
+        QVERIFY(fresh.update(&st) == FfmtErrCode::ERR_OK);
+        QCOMPARE(st.parsed, 3);
+        QCOMPARE(readFile(dir.filePath("fresh.store")), readFile(lib.storePath()));
+    }
+
+    void libraryScanKeepsCatalog()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QVERIFY(writeFile(dir.filePath("a.wopl"), bankData("Alpha")));
+
+        FmBankLibrary lib;
+        lib.open(dir.path());
+        QVERIFY(lib.update() == FfmtErrCode::ERR_OK);
+        const QByteArray store = readFile(lib.storePath());
+
+        QVERIFY(writeFile(dir.filePath("b.wopl"), bankData("Beta")));
+        FmBankLibrary::UpdateStats st;
+        QByteArray next = lib.scan(&st);
+        QCOMPARE(st.unchanged, 1);
+        QCOMPARE(st.parsed, 1);
+        // Neither the catalog nor its store are changed by the scan
+        QCOMPARE(lib.count(), 256);
+        QCOMPARE(readFile(lib.storePath()), store);
+
+        QVERIFY(lib.replaceStore(next) == FfmtErrCode::ERR_OK);
+        QCOMPARE(lib.count(), 512);
+        QCOMPARE(readFile(lib.storePath()), next);
+    }
+
+    void gzipIsUnpackedOnce()
+    {
+        FmBank bank;
+        fillBank(bank);
+        QByteArray data;
+        QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, BankFormats::FORMAT_WOHLSTAND_OPL3) == FfmtErrCode::ERR_OK);
+
+        FmBank loaded;
+        BankFormats format;
+        QVERIFY(FmBankFormatFactory::OpenBankData(gzip(data), "bank.wopl.gz", loaded, &format) == FfmtErrCode::ERR_OK);
+        QCOMPARE(format, BankFormats::FORMAT_WOHLSTAND_OPL3);
+        QVERIFY(FmBankFormatFactory::OpenBankData(gzip(gzip(data)), "bank.wopl.gz.gz", loaded, &format) != FfmtErrCode::ERR_OK);
+        QCOMPARE(format, BankFormats::FORMAT_UNKNOWN);
+        QVERIFY(FmBankFormatFactory::ImportBankData(gzip(gzip(data)), "bank.wopl.gz.gz", loaded, &format) != FfmtErrCode::ERR_OK);
+
+        QByteArray broken = gzip(data);
+        broken.chop(100);
+        QVERIFY(FmBankFormatFactory::OpenBankData(broken, "bank.wopl.gz", loaded, &format) == FfmtErrCode::ERR_BADFORMAT);
+        QCOMPARE(format, BankFormats::FORMAT_UNKNOWN);
+
+        FmBank::Instrument ins = makeInstrument(3);
+        QByteArray insData;
+        QVERIFY(FmBankFormatFactory::SaveInstrumentData(insData, ins, InstFormats::FORMAT_INST_WOPL3, false) == FfmtErrCode::ERR_OK);
+
+        FmBank::Instrument out = FmBank::emptyInst();
+        InstFormats insFormat;
+        QVERIFY(FmBankFormatFactory::OpenInstrumentData(gzip(insData), "ins.opli.gz", out, &insFormat) == FfmtErrCode::ERR_OK);
+        QCOMPARE(insFormat, InstFormats::FORMAT_INST_WOPL3);
+        QVERIFY(FmBankFormatFactory::OpenInstrumentData(gzip(gzip(insData)), "ins.opli.gz.gz", out, &insFormat) != FfmtErrCode::ERR_OK);
+        QCOMPARE(insFormat, InstFormats::FORMAT_INST_UNKNOWN);
+    }
+
+    void gunzipEndOfInput()
+    {
+        QByteArray data;
+        for(int i = 0; i < 100000; i++)
+            data.append(char((i * 13) ^ (i >> 7)));
+        const QByteArray packed = gzip(data);
+
+        // The end of input fails the unfinished stream, the inflated part is kept
+        QByteArray out;
+        for(int cut = 1; cut < packed.size(); cut += qMax(1, cut / 3))
+        {
+            QVERIFY2(!gunzip(packed.left(packed.size() - cut), out),
+                     qPrintable(QString("%1 bytes are cut").arg(cut)));
+            QVERIFY(data.startsWith(out));
+        }
+        QVERIFY(!gunzip(packed.left(packed.size() - 8), out));
+        QCOMPARE(out, data);
+
+        // The limit is reached before the end of the truncated stream, like on detection of VGZ files
+        QVERIFY(gunzip(packed.left(packed.size() / 2), out, 4));
+        QCOMPARE(out, data.left(4));
+        QVERIFY(gunzip(packed, out, data.size()));
+        QCOMPARE(out, data);
+        QVERIFY(!gunzip(packed.left(packed.size() / 2), out, data.size()));
+
+        QByteArray vgm("Vgm ");
+        vgm.append(QByteArray(60, '\0'));
+        vgm.append(data);
+        QByteArray vgz = gzip(vgm);
+        vgz.chop(20);
+        FmBank bank;
+        QVERIFY(FmBankFormatFactory::ImportBankData(vgz, "music.vgz", bank) == FfmtErrCode::ERR_BADFORMAT);
+    }
+
+    void archiveEntries()
+    {
+        const QByteArray wopl = bankData("Zipped");
+        QByteArray text;
+        for(int i = 0; i < 5000; i++)
+            text.append(char('a' + i % 26));
+
+        QVector<ZipItem> items;
+        items << zipItem("dir/", QByteArray(), false)
+              << zipItem("dir/stored.wopl", wopl, false)
+              << zipItem("deflated.wopl", wopl, true)
+              << zipItem("empty.txt", QByteArray(), true)
+              << zipItem("text.txt", text, true);
+
+        for(int zip64 = 0; zip64 < 2; zip64++)
+        {
+            QBuffer device;
+            device.setData(zipArchive(items, zip64 != 0));
+            device.open(QIODevice::ReadOnly);
+
+            FmBankArchive archive;
+            QVERIFY(archive.open(&device) == FfmtErrCode::ERR_OK);
+            QCOMPARE(archive.entries().size(), items.size());
+            QVERIFY(archive.entries()[0].isDir());
+            for(int i = 0; i < items.size(); i++)
+            {
+                const FmBankArchive::Entry &e = archive.entries()[i];
+                QCOMPARE(e.name, items[i].name);
+                QCOMPARE(e.size, qint64(items[i].data.size()));
+                QCOMPARE(e.method, quint16(items[i].deflate ? 8 : 0));
+                QCOMPARE(archive.findEntry(items[i].name), i);
+
+                QByteArray data;
+                QVERIFY(archive.read(i, data) == FfmtErrCode::ERR_OK);
+                QCOMPARE(data, items[i].data);
+            }
+            QCOMPARE(archive.findEntry("missing.wopl"), -1);
+        }
+
+        // Banks are opened right from the archive
+        const QString path = m_dir.filePath("banks.zip");
+        QVERIFY(writeFile(path, zipArchive(items, true)));
+        QVERIFY(FmBankArchive::isZipFile(path));
+        FmBank plain, stored, deflated;
+        QVERIFY(FmBankFormatFactory::OpenBankData(wopl, "bank.wopl", plain) == FfmtErrCode::ERR_OK);
+        QVERIFY(FmBankFormatFactory::OpenBankFile(path + "/dir/stored.wopl", stored) == FfmtErrCode::ERR_OK);
+        QVERIFY(FmBankFormatFactory::OpenBankFile(path + "/deflated.wopl", deflated) == FfmtErrCode::ERR_OK);
+        QVERIFY(stored == plain);
+        QVERIFY(deflated == plain);
+        QVERIFY(FmBankFormatFactory::OpenBankFile(path + "/missing.wopl", stored) != FfmtErrCode::ERR_OK);
+    }
+
+    void archiveDamagedEntries()
+    {
+        const QByteArray wopl = bankData("Damaged");
+
+        for(int deflate = 0; deflate < 2; deflate++)
+        {
+            ZipItem badCrc = zipItem("crc.wopl", wopl, deflate != 0);
+            badCrc.badCrc = true;
+            ZipItem truncated = zipItem("truncated.wopl", wopl, deflate != 0);
+            truncated.cut = 16;
+            ZipItem longer = zipItem("longer.wopl", wopl, deflate != 0);
+            longer.declaredSize = wopl.size() - 1;
+            ZipItem shorter = zipItem("shorter.wopl", wopl, deflate != 0);
+            shorter.declaredSize = wopl.size() + 1;
+
+            QVector<ZipItem> items;
+            items << zipItem("good.wopl", wopl, deflate != 0) << badCrc << truncated << longer << shorter;
+
+            for(int zip64 = 0; zip64 < 2; zip64++)
+            {
+                QBuffer device;
+                device.setData(zipArchive(items, zip64 != 0));
+                device.open(QIODevice::ReadOnly);
+
+                FmBankArchive archive;
+                QVERIFY(archive.open(&device) == FfmtErrCode::ERR_OK);
+                QByteArray data;
+                QVERIFY(archive.read(0, data) == FfmtErrCode::ERR_OK);
+                QCOMPARE(data, wopl);
+                for(int i = 1; i < items.size(); i++)
+                {
+                    QVERIFY2(archive.read(i, data) == FfmtErrCode::ERR_BADFORMAT,
+                             qPrintable(items[i].name));
+                }
+            }
+        }
+
+        // Every truncation loses the end record
+        const QByteArray zip = zipArchive(QVector<ZipItem>() << zipItem("a.wopl", wopl, true));
+        for(int size = 0; size < zip.size(); size += 7)
+        {
+            QBuffer device;
+            device.setData(zip.left(size));
+            device.open(QIODevice::ReadOnly);
+            FmBankArchive archive;
+            QVERIFY(archive.open(&device) == FfmtErrCode::ERR_BADFORMAT);
+            QVERIFY(!archive.isOpen());
+        }
+    }
+
+    void archiveOversizedEntries()
+    {
+        ZipItem huge = zipItem("huge.wopl", QByteArray(16, 'x'), false);
+        huge.declaredSize = FmBankArchive::maxUnpackedSize + 1;
+        ZipItem giant = zipItem("giant.wopl", QByteArray(16, 'x'), false);
+        giant.declaredSize = qint64(5) << 30;
+
+        for(int zip64 = 0; zip64 < 2; zip64++)
+        {
+            QVector<ZipItem> items;
+            items << huge;
+            // Only ZIP64 records can keep sizes over 4 GiB
+            if(zip64)
+                items << giant;
+
+            QBuffer device;
+            device.setData(zipArchive(items, zip64 != 0));
+            device.open(QIODevice::ReadOnly);
+
+            FmBankArchive archive;
+            QVERIFY(archive.open(&device) == FfmtErrCode::ERR_OK);
+            QCOMPARE(archive.entries().size(), items.size());
+            for(int i = 0; i < items.size(); i++)
+            {
+                QCOMPARE(archive.entries()[i].size, items[i].declaredSize);
+                QByteArray data;
+                QVERIFY(archive.read(i, data) == FfmtErrCode::ERR_UNSUPPORTED_FORMAT);
+                QVERIFY(data.isEmpty());
+            }
+        }
+
+        const QString path = m_dir.filePath("huge.zip");
+        QVERIFY(writeFile(path, zipArchive(QVector<ZipItem>() << huge)));
+        FmBank bank;
+        QVERIFY(FmBankFormatFactory::OpenBankFile(path + "/huge.wopl", bank) != FfmtErrCode::ERR_OK);
+    }
+
+    void gzippedBankEqualsPlain()
+    {
+        FmBank bank;
+        fillBank(bank);
+        QByteArray data;
+        QVERIFY(FmBankFormatFactory::SaveBankData(data, bank, BankFormats::FORMAT_WOHLSTAND_OPL3) == FfmtErrCode::ERR_OK);
+
+        FmBank plain, packed;
+        BankFormats plainFormat, packedFormat;
+        QVERIFY(FmBankFormatFactory::OpenBankData(data, "bank.wopl", plain, &plainFormat) == FfmtErrCode::ERR_OK);
+        QVERIFY(FmBankFormatFactory::OpenBankData(gzip(data), "bank.wopl.gz", packed, &packedFormat) == FfmtErrCode::ERR_OK);
+        QCOMPARE(plainFormat, packedFormat);
+        QVERIFY(plain == packed);
+    }
+
+    void gunzipMultiMember()
+    {
+        QByteArray first(10000, 'a');
+        QByteArray second;
+        for(int i = 0; i < 70000; i++)
+            second.append(char(i * 7));
+
+        QByteArray out;
+        QVERIFY(gunzip(gzip(first) + gzip(second), out));
+        QCOMPARE(out, first + second);
+
+        // Empty members are valid too
+        QVERIFY(gunzip(gzip(QByteArray()) + gzip(first), out));
+        QCOMPARE(out, first);
+
+        // Trailing garbage is ignored
+        QVERIFY(gunzip(gzip(first) + QByteArray(3, '\0'), out));
+        QCOMPARE(out, first);
+        QVERIFY(gunzip(gzip(first) + QByteArray(1, '\x1F'), out));
+        QCOMPARE(out, first);
+
+        // The limit counts the data of all members
+        QVERIFY(gunzip(gzip(first) + gzip(second), out, 10005));
+        QCOMPARE(out, first + second.left(5));
+
+        // A damaged second member fails
+        QByteArray broken = gzip(first) + gzip(second);
+        broken.chop(20);
+        QVERIFY(!gunzip(broken, out));
+    }
+};
+
+QTEST_APPLESS_MAIN(FileFormatsTest)
+
+#include "tst_file_formats.moc"
@@ -0,0 +1,28 @@
+#-------------------------------------------------
+#
+# Index of MIDI instrument names
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_ins_names
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_ins_names.cpp \
+    ../../src/ins_names.cpp
+
+HEADERS += \
+    ../../src/ins_names.h \
+    ../../src/ins_names_data.h \
+    ../../src/ins_names_index.h
@@ -0,0 +1,143 @@
+#include <QString>
+#include <QtTest>
+#include <QHash>
+
+#include <ins_names.h>
+#include <ins_names_data.h>
+
+/*
+ * Reference lookup, as it was done by hash maps before the sorted index
+ */
+class ReferenceNames
+{
+    typedef QHash<uint32_t, const MidiProgram *> InstrumentMap;
+
+    struct SpecMap
+    {
+        MidiSpec spec;
+        InstrumentMap map;
+    };
+
+    SpecMap m_maps[5];
+
+    static void fillInstMap(InstrumentMap &map, const MidiProgram *pgms, unsigned size)
+    {
+        for(unsigned i = 0; i < size; ++i)
+        {
+            MidiProgramId id(pgms[i].kind == 'P', pgms[i].bankMsb, pgms[i].bankLsb, pgms[i].program);
+            map[id.identifier] = &pgms[i];
+            id.reserved = 1;
+            id.program = 0;
+            if(!map.contains(id.identifier))
+                map[id.identifier] = &pgms[i];
+        }
+    }
+
+public:
+    ReferenceNames()
+    {
+        m_maps[0].spec = kMidiSpecXG;
+        fillInstMap(m_maps[0].map, XgSet, sizeof(XgSet) / sizeof(*XgSet));
+        m_maps[1].spec = kMidiSpecGS;
+        fillInstMap(m_maps[1].map, GsSet, sizeof(GsSet) / sizeof(*GsSet));
+        m_maps[2].spec = kMidiSpecSC;
+        fillInstMap(m_maps[2].map, ScSet, sizeof(ScSet) / sizeof(*ScSet));
+        m_maps[3].spec = kMidiSpecGM2;
+        fillInstMap(m_maps[3].map, Gm2Set, sizeof(Gm2Set) / sizeof(*Gm2Set));
+        m_maps[4].spec = kMidiSpecGM1;
+        fillInstMap(m_maps[4].map, Gm1Set, sizeof(Gm1Set) / sizeof(*Gm1Set));
+    }
+
+    const MidiProgram *program(MidiProgramId id, unsigned spec, unsigned *specObtained) const
+    {
+        *specObtained = kMidiSpecNone;
+        for(const SpecMap &m : m_maps)
+        {
+            if(!(spec & m.spec))
+                continue;
+            if(const MidiProgram *pgm = m.map.value(id.identifier))
+            {
+                *specObtained = m.spec;
+                return pgm;
+            }
+        }
+        return nullptr;
+    }
+
+    const MidiProgram *fallback(MidiProgramId id, unsigned spec, unsigned *specObtained) const
+    {
+        *specObtained = kMidiSpecNone;
+        if(!id.percussive || (id.bankMsb == 0 && id.bankLsb == 0))
+            return nullptr;
+        id.bankMsb = 0;
+        id.bankLsb = 0;
+        return program(id, spec & kMidiSpecGM1, specObtained);
+    }
+};
+
+class InsNamesTest : public QObject
+{
+    Q_OBJECT
+
+    // Tables of names are static, so every translation unit has own copies of them
+    static bool samePrograms(const MidiProgram *a, const MidiProgram *b)
+    {
+        if(!a || !b)
+            return a == b;
+        return a->kind == b->kind && a->bankMsb == b->bankMsb && a->bankLsb == b->bankLsb &&
+               a->program == b->program && strcmp(a->bankName, b->bankName) == 0 &&
+               strcmp(a->patchName, b->patchName) == 0;
+    }
+
+    static void compareAllIds(const ReferenceNames &ref, unsigned spec)
+    {
+        for(uint32_t i = 0; i < (1u << 23); ++i)
+        {
+            MidiProgramId id(i);
+
+            unsigned refSpec, gotSpec;
+            const MidiProgram *expected = ref.program(id, spec, &refSpec);
+            const MidiProgram *got = getMidiProgram(id, spec, &gotSpec);
+            if(!samePrograms(got, expected) || gotSpec != refSpec)
+                QFAIL(qPrintable(QString("Program 0x%1 differs for spec %2").arg(i, 6, 16, QChar('0')).arg(spec)));
+
+            bool isFallback = false;
+            const MidiProgram *found = findMidiProgram(id, spec, &gotSpec, &isFallback);
+            if(!expected)
+                expected = ref.fallback(id, spec, &refSpec);
+            if(!samePrograms(found, expected) || gotSpec != refSpec || isFallback != (got == nullptr))
+                QFAIL(qPrintable(QString("Fallback of 0x%1 differs for spec %2").arg(i, 6, 16, QChar('0')).arg(spec)));
+        }
+    }
+
+private Q_SLOTS:
+    void sameAsHashMaps()
+    {
+        const ReferenceNames ref;
+        const unsigned specs[] =
+        {
+            kMidiSpecAny,
+            kMidiSpecNone,
+            kMidiSpecGM1,
+            kMidiSpecGM1 | kMidiSpecGM2,
+            kMidiSpecGS | kMidiSpecSC,
+            kMidiSpecXG | kMidiSpecGM1,
+            kMidiSpecGM2,
+        };
+        for(unsigned spec : specs)
+            compareAllIds(ref, spec);
+    }
+
+    void banks()
+    {
+        unsigned spec;
+        const MidiProgram *bank = getMidiBank(MidiProgramId(false, 0, 0, 5), kMidiSpecGM1, &spec);
+        QVERIFY(bank != nullptr);
+        QCOMPARE(spec, unsigned(kMidiSpecGM1));
+        QVERIFY(samePrograms(bank, &Gm1Set[0]));
+    }
+};
+
+QTEST_APPLESS_MAIN(InsNamesTest)
+
+#include "tst_ins_names.moc"
@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Loudness analysis and normalization of instruments
+#
+#-------------------------------------------------
+
+QT       += testlib widgets concurrent
+
+TARGET = tst_loudness
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+include($$PWD/../../src/opl/chips/chipset.pri)
+
+SOURCES += \
+        tst_loudness.cpp \
+    ../../src/bank.cpp \
+    ../../src/opl/measurer.cpp \
+    ../../src/opl/register_log.cpp \
+    ../../src/opl/realtime/ring_buffer.cpp
+
+HEADERS += \
+    ../../src/bank.h \
+    ../../src/opl/measurer.h \
+    ../../src/opl/register_log.h \
+    ../../src/opl/realtime/ring_buffer.h \
+    ../../src/opl/realtime/ring_buffer.tcc
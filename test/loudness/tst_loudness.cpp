@@ -0,0 +1,140 @@
+#include <QString>
+#include <QtTest>
+#include <cmath>
+
+#include <bank.h>
+#include <opl/measurer.h>
+
+class LoudnessTest : public QObject
+{
+    Q_OBJECT
+
+    /**
+     * @brief Sustained sine of the carrier, the modulator is muted
+     * @param level Volume level of the carrier, 63 is the loudest
+     */
+    static FmBank::Instrument makeSine(uint8_t level)
+    {
+        FmBank::Instrument ins = FmBank::emptyInst();
+        ins.connection1 = FmBank::Instrument::FM;
+        for(int op = 0; op < 4; op++)
+        {
+            ins.OP[op].level = 0;
+            ins.OP[op].attack = 15;
+            ins.OP[op].fmult = 1;
+            ins.OP[op].eg = true;
+        }
+        ins.OP[CARRIER1].level = level;
+        return ins;
+    }
+
+private Q_SLOTS:
+    void velocityAttenuation()
+    {
+        QCOMPARE(Measurer::velocityAttenuation(127), 0u);
+        QCOMPARE(Measurer::velocityAttenuation(0), 63u);
+
+        unsigned prev = 63;
+        for(int v = 0; v <= 127; v++)
+        {
+            unsigned att = Measurer::velocityAttenuation(v);
+            QVERIFY(att <= prev);
+            prev = att;
+        }
+
+        // Half of the velocity is 6 dB, the level step is 0.75 dB
+        QCOMPARE(Measurer::velocityAttenuation(64), 8u);
+        QCOMPARE(Measurer::velocityAttenuation(32), 16u);
+    }
+
+    void computeLoudness()
+    {
+        Measurer::LoudnessInfo full, quieter, soft, silent;
+        Measurer::computeLoudness(makeSine(63), full);
+        Measurer::computeLoudness(makeSine(55), quieter);
+        Measurer::computeLoudness(makeSine(63), soft, 60, 64);
+
+        QVERIFY(full.valid);
+        QVERIFY(!full.nosound);
+        QVERIFY(full.peak_db > full.rms_db);
+        QVERIFY(full.peak_db < 0.0);
+
+        // Each level step is 0.75 dB
+        QVERIFY2(std::fabs((full.rms_db - quieter.rms_db) - 6.0) < 0.5,
+                 qPrintable(QString("%1 dB against %2 dB").arg(full.rms_db).arg(quieter.rms_db)));
+        // Velocity is attenuating output operators in the same way
+        QVERIFY(std::fabs(soft.rms_db - quieter.rms_db) < 0.5);
+
+        FmBank::Instrument mute = makeSine(63);
+        mute.OP[CARRIER1].attack = 0;
+        Measurer::computeLoudness(mute, silent);
+        QVERIFY(silent.valid);
+        QVERIFY(silent.nosound);
+    }
+
+    void normalizationConverges()
+    {
+        const double target = -40.0, tolerance = 0.75;
+
+        QVector<FmBank::Instrument> set;
+        for(uint8_t level : {63, 50, 40, 30, 20})
+            set.push_back(makeSine(level));
+
+        FmBank::Instrument fm = makeSine(45);
+        fm.OP[MODULATOR1].level = 40;
+        fm.feedback1 = 4;
+        set.push_back(fm);
+
+        FmBank::Instrument fourOp = makeSine(35);
+        fourOp.en_4op = true;
+        fourOp.connection1 = FmBank::Instrument::AM;
+        fourOp.connection2 = FmBank::Instrument::FM;
+        fourOp.OP[MODULATOR1].level = 30;
+        fourOp.OP[CARRIER2].level = 30;
+        set.push_back(fourOp);
+
+        // The same passes as normalizeLoudness() does
+        for(int pass = 0; pass < 4; pass++)
+        {
+            for(FmBank::Instrument &ins : set)
+            {
+                Measurer::LoudnessInfo li;
+                Measurer::computeLoudness(ins, li);
+                Measurer::adjustLoudness(ins, li, target, tolerance);
+            }
+        }
+
+        for(int i = 0; i < set.size(); i++)
+        {
+            Measurer::LoudnessInfo li;
+            Measurer::computeLoudness(set[i], li);
+            QVERIFY2(std::fabs(li.rms_db - target) <= tolerance,
+                     qPrintable(QString("Instrument %1 is at %2 dB").arg(i).arg(li.rms_db)));
+
+            FmBank::Instrument again = set[i];
+            QVERIFY(!Measurer::adjustLoudness(again, li, target, tolerance));
+        }
+    }
+
+    void saturatedLevelIsNotChanged()
+    {
+        FmBank::Instrument ins = makeSine(63);
+        Measurer::LoudnessInfo li;
+        Measurer::computeLoudness(ins, li);
+        // The loudest level can't be raised more
+        QVERIFY(!Measurer::adjustLoudness(ins, li, li.rms_db + 10.0, 0.75));
+        QCOMPARE(ins.OP[CARRIER1].level, uint8_t(63));
+
+        // Silent and not analyzed instruments are left as is
+        Measurer::LoudnessInfo none;
+        QVERIFY(!Measurer::adjustLoudness(ins, none, -40.0, 0.75));
+        QVERIFY(Measurer::adjustLoudness(ins, li, li.rms_db - 10.0, 0.75));
+        QVERIFY(ins.OP[CARRIER1].level < 63);
+        // The muted modulator is not an output operator and keeps its level
+        QCOMPARE(ins.OP[MODULATOR1].level, uint8_t(0));
+    }
+};
+
+QTEST_APPLESS_MAIN(LoudnessTest)
+
+#include "tst_loudness.moc"
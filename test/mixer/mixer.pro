@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# Floating point mixing kernels and the soft limiter
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_mixer
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_mixer.cpp \
+    ../../src/opl/mixer.cpp
+
+HEADERS += \
+    ../../src/opl/mixer.h
@@ -0,0 +1,171 @@
+#include <QString>
+#include <QtTest>
+#include <vector>
+#include <cmath>
+
+#include <opl/mixer.h>
+
+class MixerTest : public QObject
+{
+    Q_OBJECT
+
+    enum { RATE = 44100 };
+
+    /**
+     * @brief Quiet two-tone signal with the loud burst
+     * @param burstLevel Amplitude of the burst
+     * @param burstBegin First frame of the burst
+     * @param burstFrames Length of the burst
+     * @param total Count of frames
+     */
+    static std::vector<float> makeSignal(float burstLevel, size_t burstBegin, size_t burstFrames, size_t total)
+    {
+        std::vector<float> out(2 * total);
+        for(size_t i = 0; i < total; ++i)
+        {
+            double t = double(i) / RATE;
+            float a = (i >= burstBegin && i < burstBegin + burstFrames) ? burstLevel : 0.1f;
+            out[2 * i] = a * float(std::sin(2.0 * M_PI * 440.0 * t));
+            out[2 * i + 1] = a * float(std::sin(2.0 * M_PI * 660.0 * t + 0.3));
+        }
+        return out;
+    }
+
+    //! Process in blocks of varying sizes, like the audio callback does
+    static void processBlocks(SoftLimiter &limiter, std::vector<float> &buf)
+    {
+        size_t total = buf.size() / 2, pos = 0, block = 1;
+        while(pos < total)
+        {
+            size_t n = (total - pos < block) ? (total - pos) : block;
+            limiter.process(buf.data() + 2 * pos, n);
+            pos += n;
+            block = (block * 3) % 1000 + 1;
+        }
+    }
+
+private Q_SLOTS:
+    void limiterHoldsThreshold_data()
+    {
+        QTest::addColumn<float>("factor");
+        QTest::addColumn<float>("threshold");
+        QTest::newRow("6x") << 6.0f << 0.5f;
+        QTest::newRow("12x") << 12.0f << 0.5f;
+        QTest::newRow("6x default") << 6.0f << 0.944f;
+        QTest::newRow("12x default") << 12.0f << 0.944f;
+    }
+
+    void limiterHoldsThreshold()
+    {
+        QFETCH(float, factor);
+        QFETCH(float, threshold);
+
+        const size_t burstBegin = RATE / 5, burstFrames = RATE / 20, total = 2 * RATE;
+        const std::vector<float> in = makeSignal(factor * threshold, burstBegin, burstFrames, total);
+        std::vector<float> out = in;
+
+        SoftLimiter limiter;
+        limiter.setup(RATE, threshold);
+        processBlocks(limiter, out);
+
+        // The output is the input delayed by the look-ahead time
+        const size_t lookahead = size_t(1.5f * 0.001f * RATE);
+
+        float peak = 0.0f, burstPeak = 0.0f;
+        for(size_t i = 0; i < out.size(); ++i)
+        {
+            float v = std::fabs(out[i]);
+            peak = (v > peak) ? v : peak;
+            size_t frame = i / 2;
+            if(frame >= burstBegin + lookahead && frame < burstBegin + burstFrames + lookahead)
+                burstPeak = (v > burstPeak) ? v : burstPeak;
+        }
+        QVERIFY2(peak <= threshold * 1.0001f,
+                 qPrintable(QString("Peak %1 is over the threshold %2").arg(peak).arg(threshold)));
+        // The burst is limited, not muted
+        QVERIFY(burstPeak >= threshold * 0.9f);
+
+        // Quiet signal before the burst is untouched
+        for(size_t i = lookahead; i < burstBegin; ++i)
+        {
+            QCOMPARE(out[2 * i], in[2 * (i - lookahead)]);
+            QCOMPARE(out[2 * i + 1], in[2 * (i - lookahead) + 1]);
+        }
+
+        // The gain is released back after the burst, 0.5 s is many times the release time
+        float deviation = 0.0f;
+        for(size_t i = burstBegin + burstFrames + RATE / 2; i < total; ++i)
+        {
+            for(size_t c = 0; c < 2; ++c)
+            {
+                float d = std::fabs(out[2 * i + c] - in[2 * (i - lookahead) + c]);
+                deviation = (d > deviation) ? d : deviation;
+            }
+        }
+        QVERIFY2(deviation < 0.001f, qPrintable(QString("Gain is not recovered, deviation %1").arg(deviation)));
+    }
+
+    void disabledLimiterPassesThrough()
+    {
+        const std::vector<float> in = makeSignal(6.0f, 1000, 2000, 8000);
+        std::vector<float> out = in;
+        SoftLimiter limiter;
+        limiter.setup(RATE, 0.5f);
+        limiter.setEnabled(false);
+        processBlocks(limiter, out);
+        QVERIFY(out == in);
+    }
+
+    void toInt16Clips()
+    {
+        const float in[] = {0.0f, 0.5f, -0.25f, 0.99999f, 1.0f, 1.5f, -1.0f, -1.5f, 1e9f, -1e9f};
+        const int16_t expected[] = {0, 16384, -8192, 32767, 32767, 32767, -32768, -32768, 32767, -32768};
+        const size_t count = sizeof(in) / sizeof(in[0]);
+        int16_t out[count];
+        FloatMixer::toInt16(out, in, count);
+        for(size_t i = 0; i < count; ++i)
+            QCOMPARE(out[i], expected[i]);
+    }
+
+    void accumulateDoesNotClip()
+    {
+        enum { SAMPLES = 64, CHIPS = 5 };
+        const float gain = 1.0f / 32768.0f;
+        std::vector<int32_t> chips[CHIPS];
+        for(int c = 0; c < CHIPS; ++c)
+        {
+            chips[c].resize(SAMPLES);
+            for(int i = 0; i < SAMPLES; ++i)
+                chips[c][i] = (c < CHIPS - 1) ? (30000 - i * 100) : -(90000 - i * 300);
+        }
+
+        std::vector<float> mix(SAMPLES);
+        FloatMixer::clear(mix.data(), SAMPLES);
+        for(int c = 0; c < CHIPS - 1; ++c)
+            FloatMixer::accumulate(mix.data(), chips[c].data(), SAMPLES, gain);
+
+        // Four loud chips are far over the full scale, nothing is clipped yet
+        for(int i = 0; i < SAMPLES; ++i)
+            QCOMPARE(mix[i], float(4 * (30000 - i * 100)) * gain);
+
+        // The last chip brings the sum back into the range without any loss
+        FloatMixer::accumulate(mix.data(), chips[CHIPS - 1].data(), SAMPLES, gain);
+        std::vector<int16_t> out(SAMPLES);
+        FloatMixer::toInt16(out.data(), mix.data(), SAMPLES);
+        for(int i = 0; i < SAMPLES; ++i)
+        {
+            int32_t sum = 0;
+            for(int c = 0; c < CHIPS; ++c)
+                sum += chips[c][i];
+            QCOMPARE(mix[i], float(sum) * gain);
+            QCOMPARE(int32_t(out[i]), sum);
+        }
+
+        FloatMixer::applyGain(mix.data(), SAMPLES, 2.0f);
+        QCOMPARE(mix[1], float(2 * (4 * 29900 - 89700)) * gain);
+    }
+};
+
+QTEST_APPLESS_MAIN(MixerTest)
+
+#include "tst_mixer.moc"
@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Parallel rendering of several chips against sequential one
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_multichip_engine
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_multichip_engine.cpp \
+    ../../src/opl/multichip_engine.cpp \
+    ../../src/opl/mixer.cpp \
+    ../../src/opl/chips/nuked_opl3.cpp \
+    ../../src/opl/chips/nuked/nukedopl3.c
+
+HEADERS += \
+    ../../src/opl/multichip_engine.h \
+    ../../src/opl/mixer.h \
+    ../../src/opl/chips/opl_chip_base.h \
+    ../../src/opl/chips/opl_chip_base.tcc \
+    ../../src/opl/chips/nuked_opl3.h
@@ -0,0 +1,172 @@
+#include <QString>
+#include <QtTest>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+#include <opl/multichip_engine.h>
+#include <opl/chips/nuked_opl3.h>
+
+class MultiChipEngineTest : public QObject
+{
+    Q_OBJECT
+
+    enum { RATE = 49716 };
+
+    /**
+     * @brief Chip which plays its own note, so every chip sounds differently
+     */
+    static std::shared_ptr<OPLChipBase> makeChip(unsigned index)
+    {
+        std::shared_ptr<OPLChipBase> chip(new NukedOPL3);
+        chip->setRate(RATE);
+        chip->writeReg(0x105, 0x01);
+        chip->writeReg(0x001, 0x20);
+        for(uint16_t ch = 0; ch < 9; ++ch)
+        {
+            static const uint8_t ops[9] = {0x00, 0x01, 0x02, 0x08, 0x09, 0x0A, 0x10, 0x11, 0x12};
+            uint16_t mod = ops[ch], car = uint16_t(ops[ch] + 3);
+            chip->writeReg(0x20 + mod, uint8_t(0x01 + index));
+            chip->writeReg(0x20 + car, 0x01);
+            chip->writeReg(0x40 + mod, uint8_t(0x10 + ch));
+            chip->writeReg(0x40 + car, 0x00);
+            chip->writeReg(0x60 + mod, 0xF2);
+            chip->writeReg(0x60 + car, 0xF2);
+            chip->writeReg(0x80 + mod, 0x24);
+            chip->writeReg(0x80 + car, 0x24);
+            chip->writeReg(0xE0 + mod, uint8_t(index & 3));
+            chip->writeReg(0xC0 + ch, uint8_t(0x30 | ((index + ch) & 0x0E)));
+            uint16_t fnum = uint16_t(0x150 + 37 * index + 11 * ch);
+            chip->writeReg(0xA0 + ch, uint8_t(fnum & 0xFF));
+            chip->writeReg(0xB0 + ch, uint8_t(0x20 | (4 << 2) | (fnum >> 8)));
+        }
+        return chip;
+    }
+
+    static void fill(MultiChipEngine &engine, unsigned chips)
+    {
+        for(unsigned c = 0; c < chips; ++c)
+            engine.addChip(makeChip(c));
+    }
+
+    static std::vector<float> render(MultiChipEngine &engine, const std::vector<size_t> &calls)
+    {
+        size_t total = 0;
+        for(size_t n : calls)
+            total += n;
+        std::vector<float> out(2 * total);
+        float *dst = out.data();
+        for(size_t n : calls)
+        {
+            engine.render(dst, n, 1.0f / 32768.0f);
+            dst += 2 * n;
+        }
+        return out;
+    }
+
+private Q_SLOTS:
+    void parallelEqualsSequential()
+    {
+        // Odd sizes are splitting blocks and leaving partial ones
+        std::vector<size_t> calls;
+        for(size_t i = 0; i < 40; ++i)
+            calls.push_back(1 + (i * 389) % 1500);
+
+        for(unsigned chips : {2u, 3u, 5u})
+        {
+            MultiChipEngine sequential(0);
+            MultiChipEngine parallel(3);
+            fill(sequential, chips);
+            fill(parallel, chips);
+            QCOMPARE(sequential.threadsCount(), 0u);
+            QCOMPARE(parallel.threadsCount(), chips - 1 < 3 ? chips - 1 : 3u);
+
+            std::vector<float> a = render(sequential, calls);
+            std::vector<float> b = render(parallel, calls);
+            QCOMPARE(a.size(), b.size());
+            QVERIFY2(memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0,
+                     qPrintable(QString("%1 chips are mixed differently").arg(chips)));
+
+            bool silent = true;
+            for(float f : a)
+                silent = silent && (f == 0.0f);
+            QVERIFY(!silent);
+        }
+    }
+
+    void sleepingWorkersWakeUp()
+    {
+        // Pauses between calls are longer than the spin, so workers are going to sleep
+        std::vector<size_t> calls(30, MultiChipEngine::BlockFrames + 100);
+        MultiChipEngine sequential(0);
+        MultiChipEngine parallel(3);
+        fill(sequential, 4);
+        fill(parallel, 4);
+
+        std::vector<float> a = render(sequential, calls);
+        std::vector<float> b(a.size());
+        float *dst = b.data();
+        for(size_t i = 0; i < calls.size(); ++i)
+        {
+            // Odd calls are following right after the previous one, racing workers going to sleep
+            if((i & 1) == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            parallel.render(dst, calls[i], 1.0f / 32768.0f);
+            dst += 2 * calls[i];
+        }
+        QVERIFY(memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+    }
+
+    void mixIsSumOfChips()
+    {
+        enum { FRAMES = 3000, CHIPS = 4 };
+        MultiChipEngine engine(2);
+        fill(engine, CHIPS);
+        std::vector<float> mixed(2 * FRAMES);
+        engine.render(mixed.data(), FRAMES, 1.0f);
+
+        std::vector<float> expected(2 * FRAMES, 0.0f);
+        std::vector<int32_t> chipOut(2 * MultiChipEngine::BlockFrames);
+        std::vector<std::shared_ptr<OPLChipBase> > chips;
+        for(unsigned c = 0; c < CHIPS; ++c)
+            chips.push_back(makeChip(c));
+        for(size_t pos = 0; pos < FRAMES; pos += MultiChipEngine::BlockFrames)
+        {
+            size_t n = FRAMES - pos;
+            if(n > MultiChipEngine::BlockFrames)
+                n = MultiChipEngine::BlockFrames;
+            for(unsigned c = 0; c < CHIPS; ++c)
+            {
+                chips[c]->generate32(chipOut.data(), n);
+                for(size_t i = 0; i < 2 * n; ++i)
+                    expected[2 * pos + i] += float(chipOut[i]);
+            }
+        }
+
+        QVERIFY(memcmp(mixed.data(), expected.data(), expected.size() * sizeof(float)) == 0);
+    }
+
+    void chipsAreOwned()
+    {
+        std::weak_ptr<OPLChipBase> watch;
+        {
+            MultiChipEngine engine(1);
+            std::shared_ptr<OPLChipBase> chip = makeChip(0);
+            watch = chip;
+            engine.addChip(chip);
+            engine.addChip(makeChip(1));
+            chip.reset();
+            QVERIFY(!watch.expired());
+            QCOMPARE(engine.chip(0), watch.lock().get());
+
+            engine.clearChips();
+            QVERIFY(watch.expired());
+            QCOMPARE(engine.chipsCount(), 0u);
+            QCOMPARE(engine.threadsCount(), 0u);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(MultiChipEngineTest)
+
+#include "tst_multichip_engine.moc"
@@ -0,0 +1,30 @@
+#-------------------------------------------------
+#
+# Round trips of register logs through the log, VGM and DRO files
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_register_log
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_register_log.cpp \
+    ../../src/opl/register_log.cpp \
+    ../../src/opl/realtime/ring_buffer.cpp
+
+HEADERS += \
+    ../../src/opl/register_log.h \
+    ../../src/opl/realtime/ring_buffer.h \
+    ../../src/opl/realtime/ring_buffer.tcc \
+    ../../src/opl/chips/opl_chip_base.h
@@ -0,0 +1,286 @@
+#include <QString>
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QRandomGenerator>
+#include <atomic>
+#include <thread>
+
+#include <opl/register_log.h>
+#include <opl/chips/opl_chip_base.h>
+
+class RegisterLogTest : public QObject
+{
+    Q_OBJECT
+
+    typedef QVector<OPLRegisterLog::Event> Events;
+
+    static OPLRegisterLog::Event event(uint64_t frame, uint16_t addr, uint8_t data)
+    {
+        OPLRegisterLog::Event e = {frame, addr, data};
+        return e;
+    }
+
+    static bool sameEvents(const Events &a, const Events &b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(int i = 0; i < a.size(); ++i)
+        {
+            if(a[i].frame != b[i].frame || a[i].addr != b[i].addr || a[i].data != b[i].data)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes to a limited set of registers, like the generator does
+     * @param msTimed Place writes on frames of whole milliseconds at 44100 Hz
+     */
+    static void fillLog(OPLRegisterLog &log, int chipType, bool msTimed)
+    {
+        static const uint8_t regs[] = {0x01, 0x04, 0x05, 0x08, 0x20, 0x23, 0x40, 0x43,
+                                       0x60, 0x63, 0x80, 0x83, 0xA0, 0xB0, 0xBD, 0xC0, 0xE0, 0xE3};
+        QRandomGenerator gen(uint32_t(chipType + (msTimed ? 10 : 0)));
+        log.begin(44100, chipType);
+        uint64_t ms = 0;
+        uint64_t frame = 0;
+        for(int i = 0; i < 3000; ++i)
+        {
+            // Mostly short steps, sometimes long pauses to check the long waits
+            uint32_t step = (i % 500 == 499) ? gen.bounded(70000, 100000) : gen.bounded(0, 40);
+            if(msTimed)
+            {
+                ms += step;
+                frame = ms * 44100 / 1000;
+            }
+            else
+                frame += step * 37;
+            uint16_t addr = regs[gen.bounded(int(sizeof(regs)))];
+            if(chipType == OPLChipBase::CHIPTYPE_OPL3 && addr != 0x01 && addr != 0x08 && gen.bounded(2))
+                addr |= 0x100;
+            log.append(frame, addr, uint8_t(gen.bounded(256)));
+        }
+        log.finish(frame + 44100);
+    }
+
+    static QByteArray droV2(const QByteArray &pairs, uint8_t codeMapLength, const char *codeMap)
+    {
+        QByteArray out("DBRAWOPL", 8);
+        const char head[] = {2, 0, 0, 0};
+        out.append(head, 4);
+        uint32_t count = uint32_t(pairs.size() / 2);
+        for(int i = 0; i < 4; ++i)
+            out.append(char((count >> (8 * i)) & 0xFF));
+        out.append(QByteArray(4, '\0'));        // Length in milliseconds, unused
+        const char info[] = {2, 0, 0, char(codeMapLength), char(codeMapLength + 1), char(codeMapLength)};
+        out.append(info, 6);
+        out.append(codeMap, codeMapLength);
+        out.append(pairs);
+        return out;
+    }
+
+private Q_SLOTS:
+    void logRoundTrip()
+    {
+        OPLRegisterLog log;
+        fillLog(log, OPLChipBase::CHIPTYPE_OPL3, false);
+
+        OPLRegisterLog back;
+        QVERIFY(back.fromLog(log.toLog()));
+        QVERIFY(sameEvents(back.events(), log.events()));
+        QCOMPARE(back.rate(), log.rate());
+        QCOMPARE(back.chipType(), log.chipType());
+        QCOMPARE(back.length(), log.length());
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QString path = dir.filePath("test.oplr");
+        QVERIFY(log.saveLog(path));
+        OPLRegisterLog loaded;
+        QVERIFY(loaded.loadFile(path));
+        QVERIFY(sameEvents(loaded.events(), log.events()));
+
+        // Truncated write
+        QByteArray cut = log.toLog();
+        cut.chop(1);
+        QVERIFY(!back.fromLog(cut));
+    }
+
+    void vgmRoundTrip()
+    {
+        OPLRegisterLog log;
+        fillLog(log, OPLChipBase::CHIPTYPE_OPL3, false);
+
+        OPLRegisterLog back;
+        QVERIFY(back.fromVGM(log.toVGM()));
+        QVERIFY(sameEvents(back.events(), log.events()));
+        QCOMPARE(back.chipType(), int(OPLChipBase::CHIPTYPE_OPL3));
+        QCOMPARE(back.length(), log.length());
+
+        QTemporaryDir dir;
+        QString path = dir.filePath("test.vgm");
+        QVERIFY(log.saveVGM(path));
+        OPLRegisterLog loaded;
+        QVERIFY(loaded.loadFile(path));
+        QVERIFY(sameEvents(loaded.events(), log.events()));
+    }
+
+    void vgmOpl2AndResampling()
+    {
+        OPLRegisterLog log;
+        log.begin(49716, OPLChipBase::CHIPTYPE_OPL2);
+        log.append(0, 0x20, 0x01);
+        log.append(1000, 0x120, 0x02);     // Second bank is not a part of OPL2
+        log.append(49716, 0xB0, 0x31);
+        log.finish(99432);
+
+        OPLRegisterLog back;
+        QVERIFY(back.fromVGM(log.toVGM()));
+        QCOMPARE(back.chipType(), int(OPLChipBase::CHIPTYPE_OPL2));
+        QCOMPARE(back.rate(), 44100u);
+        Events expected;
+        expected << event(0, 0x20, 0x01) << event(44100, 0xB0, 0x31);
+        QVERIFY(sameEvents(back.events(), expected));
+        QCOMPARE(back.length(), uint64_t(88200));
+    }
+
+    void droRoundTrip()
+    {
+        for(int chipType : {int(OPLChipBase::CHIPTYPE_OPL3), int(OPLChipBase::CHIPTYPE_OPL2)})
+        {
+            OPLRegisterLog log;
+            fillLog(log, chipType, true);
+
+            QByteArray dro = log.toDRO();
+            QVERIFY(!dro.isEmpty());
+            OPLRegisterLog back;
+            QVERIFY(back.fromDRO(dro));
+            QVERIFY(sameEvents(back.events(), log.events()));
+            QCOMPARE(back.chipType(), chipType);
+            QCOMPARE(back.length(), log.length());
+
+            QTemporaryDir dir;
+            QString path = dir.filePath("test.dro");
+            QVERIFY(log.saveDRO(path));
+            OPLRegisterLog loaded;
+            QVERIFY(loaded.loadFile(path));
+            QVERIFY(sameEvents(loaded.events(), log.events()));
+        }
+    }
+
+    void droTooManyRegisters()
+    {
+        OPLRegisterLog log;
+        log.begin(44100, OPLChipBase::CHIPTYPE_OPL3);
+        for(uint16_t reg = 0; reg < 126; ++reg)
+            log.append(reg, reg, 0);
+        QVERIFY(!log.toDRO().isEmpty());
+        log.append(200, 0x105, 0);  // The same register of the second bank shares the code
+        QVERIFY(!log.toDRO().isEmpty());
+        log.append(200, 0xFE, 0);
+        QVERIFY(log.toDRO().isEmpty());
+    }
+
+    void droTiming()
+    {
+        // Delays of 1, 10 and 1000 milliseconds: 44.1 frames per millisecond
+        const char codeMap[] = {char(0xB0)};
+        QByteArray pairs;
+        pairs.append(char(1)).append(char(0));          // 1 ms
+        pairs.append(char(0)).append(char(0x20));
+        pairs.append(char(1)).append(char(9));          // 10 ms
+        pairs.append(char(0x80)).append(char(0x21));
+        pairs.append(char(2)).append(char(2));          // 768 ms
+        pairs.append(char(1)).append(char(231));        // 232 ms
+        pairs.append(char(0)).append(char(0x22));
+
+        OPLRegisterLog log;
+        QVERIFY(log.fromDRO(droV2(pairs, 1, codeMap)));
+        QCOMPARE(log.rate(), 44100u);
+        Events expected;
+        expected << event(44, 0xB0, 0x20) << event(485, 0x1B0, 0x21) << event(44585, 0xB0, 0x22);
+        QVERIFY(sameEvents(log.events(), expected));
+
+        // Version 1 with the 32-bit hardware type
+        QByteArray v1("DBRAWOPL", 8);
+        const char v1head[] = {0, 0, 1, 0,  0x10, 0x27, 0, 0,  10, 0, 0, 0,  1, 0, 0, 0};
+        v1.append(v1head, sizeof(v1head));
+        const char v1data[] = {0x00, 0x02, char(0xB0), 0x20,  0x01, char(0xE7), 0x03,  0x03, char(0xB0), 0x21};
+        v1.append(v1data, sizeof(v1data));
+        QVERIFY(log.fromDRO(v1));
+        Events expectedV1;
+        expectedV1 << event(132, 0xB0, 0x20) << event(44232, 0x1B0, 0x21);
+        QVERIFY(sameEvents(log.events(), expectedV1));
+        QCOMPARE(log.chipType(), int(OPLChipBase::CHIPTYPE_OPL3));
+    }
+
+    void captureRing()
+    {
+        OPLRegisterCapture capture(4);
+        capture.begin(44100, OPLChipBase::CHIPTYPE_OPL2);
+        for(uint16_t i = 0; i < 4; ++i)
+            QVERIFY(capture.put(i, 0x20 + i, uint8_t(i)));
+        QVERIFY(!capture.put(4, 0x40, 0));
+        QCOMPARE(capture.lost(), 1u);
+
+        capture.drain();
+        QCOMPARE(capture.log().events().size(), 4);
+        QVERIFY(capture.put(10, 0xA0, 0x55));
+
+        // Switching to OPL3 and back while recording keeps the log playable on OPL3
+        capture.updateChipType(OPLChipBase::CHIPTYPE_OPL3);
+        capture.updateChipType(OPLChipBase::CHIPTYPE_OPL2);
+        capture.finish(20);
+        QCOMPARE(capture.log().events().size(), 5);
+        QCOMPARE(capture.log().events().last().addr, uint16_t(0xA0));
+        QCOMPARE(capture.log().length(), uint64_t(20));
+        QCOMPARE(capture.log().chipType(), int(OPLChipBase::CHIPTYPE_OPL3));
+
+        capture.begin(44100, OPLChipBase::CHIPTYPE_OPL2);
+        QVERIFY(capture.log().events().isEmpty());
+        QCOMPARE(capture.lost(), 0u);
+        capture.finish(0);
+        QCOMPARE(capture.log().chipType(), int(OPLChipBase::CHIPTYPE_OPL2));
+    }
+
+    void captureConcurrent()
+    {
+        enum { WRITES = 200000 };
+        OPLRegisterCapture capture(256);
+        capture.begin(44100, OPLChipBase::CHIPTYPE_OPL3);
+
+        std::atomic<bool> done(false);
+
+        // Like the audio thread: writes are never waiting for the free space
+        std::thread producer([&capture, &done]()
+        {
+            for(uint32_t i = 0; i < WRITES; ++i)
+            {
+                capture.put(i, uint16_t(i & 0x1FF), uint8_t(i));
+                if((i & 0xFF) == 0)
+                    std::this_thread::yield();
+            }
+            done.store(true);
+        });
+
+        while(!done.load())
+            capture.drain();
+        producer.join();
+        capture.finish(WRITES);
+
+        const Events &events = capture.log().events();
+        QCOMPARE(events.size() + int(capture.lost()), int(WRITES));
+        uint64_t previous = 0;
+        for(int i = 0; i < events.size(); ++i)
+        {
+            QVERIFY(i == 0 || events[i].frame > previous);
+            QCOMPARE(events[i].addr, uint16_t(events[i].frame & 0x1FF));
+            QCOMPARE(events[i].data, uint8_t(events[i].frame));
+            previous = events[i].frame;
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(RegisterLogTest)
+
+#include "tst_register_log.moc"
@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Sound Blaster IBK and SB/O3 banks reading and writing
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_sb_ibk_rw
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_sb_ibk_rw.cpp \
+    ../../src/bank.cpp \
+    ../../src/common.cpp \
+    ../../src/FileFormats/ffmt_base.cpp \
+    ../../src/FileFormats/format_sb_ibk.cpp
+
+HEADERS += \
+    ../../src/bank.h \
+    ../../src/common.h \
+    ../../src/FileFormats/ffmt_base.h \
+    ../../src/FileFormats/ffmt_enums.h \
+    ../../src/FileFormats/format_sb_ibk.h
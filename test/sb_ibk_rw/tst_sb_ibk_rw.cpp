@@ -0,0 +1,54 @@
+#include <QString>
+#include <QFile>
+#include <QtTest>
+
+#include <bank.h>
+#include <FileFormats/format_sb_ibk.h>
+
+class SbIbkRwTest : public QObject
+{
+    Q_OBJECT
+
+    static void fillBank(FmBank &bank)
+    {
+        bank.reset();
+        for(int i = 0; i < 128; i++)
+        {
+            FmBank::Instrument &ins = bank.Ins_Melodic_box[i];
+            snprintf(ins.name, 32, "Melodic instrument %d", i);
+            ins.OP[CARRIER1].level = uint8_t(i % 64);
+            ins.OP[MODULATOR1].attack = uint8_t(i % 16);
+            ins.feedback1 = uint8_t(i % 8);
+        }
+    }
+
+private Q_SLOTS:
+    void saveKeepsBankNames()
+    {
+        FmBank bank;
+        fillBank(bank);
+        const FmBank original = bank;
+
+        SbIBK_DOS format;
+        QVERIFY(format.saveFile("temp-names.ibk", bank) == FfmtErrCode::ERR_OK);
+        QVERIFY2(bank == original, "Saving must not modify the bank");
+
+        FmBank loaded;
+        QVERIFY(format.loadFile("temp-names.ibk", loaded) == FfmtErrCode::ERR_OK);
+        QFile("temp-names.ibk").remove();
+
+        for(int i = 0; i < 128; i++)
+        {
+            // Names are limited to 8 characters by the format
+            QCOMPARE(QString::fromUtf8(loaded.Ins_Melodic_box[i].name),
+                     QString::fromUtf8(original.Ins_Melodic_box[i].name).left(8));
+            QCOMPARE(loaded.Ins_Melodic_box[i].OP[CARRIER1].level, original.Ins_Melodic_box[i].OP[CARRIER1].level);
+            QCOMPARE(loaded.Ins_Melodic_box[i].OP[MODULATOR1].attack, original.Ins_Melodic_box[i].OP[MODULATOR1].attack);
+            QCOMPARE(loaded.Ins_Melodic_box[i].feedback1, original.Ins_Melodic_box[i].feedback1);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(SbIbkRwTest)
+
+#include "tst_sb_ibk_rw.moc"
@@ -0,0 +1,31 @@
+#-------------------------------------------------
+#
+# Loop-back test of the serial port OPL transport over a pseudo-terminal
+#
+#-------------------------------------------------
+
+QT       += testlib serialport
+
+QT       -= gui
+
+TARGET = tst_serial_loopback
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS ENABLE_HW_OPL_SERIAL_PORT
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_serial_loopback.cpp \
+    ../../src/opl/chips/opl_serial_port.cpp \
+    ../../src/opl/realtime/ring_buffer.cpp
+
+HEADERS += \
+    ../../src/opl/chips/opl_chip_base.h \
+    ../../src/opl/chips/opl_chip_base.tcc \
+    ../../src/opl/chips/opl_serial_port.h \
+    ../../src/opl/realtime/ring_buffer.h \
+    ../../src/opl/realtime/ring_buffer.tcc
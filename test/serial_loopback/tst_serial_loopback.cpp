@@ -0,0 +1,315 @@
+#include <QString>
+#include <QVector>
+#include <QtTest>
+
+#include <opl/chips/opl_serial_port.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/**
+ * @brief Decoder of the framed stream produced by OPL_SerialPort
+ */
+class SerialDecoder
+{
+public:
+    struct Write
+    {
+        uint16_t addr;
+        uint8_t  data;
+        bool operator==(const Write &o) const
+        { return addr == o.addr && data == o.data; }
+    };
+
+    explicit SerialDecoder(unsigned protocol) : m_protocol(protocol) {}
+
+    void feed(const QByteArray &bytes)
+    {
+        m_buf.append(bytes);
+
+        switch(m_protocol)
+        {
+        default:
+        case OPL_SerialPort::ProtocolArduinoOPL2:
+            decodeArduino();
+            break;
+        case OPL_SerialPort::ProtocolNukeYktOPL3:
+            decodeNukeYkt();
+            break;
+        case OPL_SerialPort::ProtocolRetroWaveOPL3:
+            decodeRetroWave();
+            break;
+        }
+    }
+
+    QVector<Write> writes;
+    //! Bytes which were not recognized as a part of any frame
+    int garbage = 0;
+
+private:
+    void decodeArduino()
+    {
+        int i = 0;
+        for(; i + 2 <= m_buf.size(); i += 2)
+            writes.push_back({uint8_t(m_buf[i]), uint8_t(m_buf[i + 1])});
+        m_buf.remove(0, i);
+    }
+
+    void decodeNukeYkt()
+    {
+        int i = 0;
+        while(i + 3 <= m_buf.size())
+        {
+            uint8_t b0 = uint8_t(m_buf[i]), b1 = uint8_t(m_buf[i + 1]), b2 = uint8_t(m_buf[i + 2]);
+            if((b0 & 0x80) == 0 || (b1 & 0x80) != 0 || (b2 & 0x80) != 0)
+            {
+                ++garbage;
+                ++i;
+                continue;
+            }
+            uint16_t addr = uint16_t(((b0 & 0x7f) << 6) | (b1 >> 1));
+            uint8_t data = uint8_t(((b1 & 1) << 7) | b2);
+            writes.push_back({addr, data});
+            i += 3;
+        }
+        m_buf.remove(0, i);
+    }
+
+    void decodeRetroWave()
+    {
+        for(;;)
+        {
+            int begin = m_buf.indexOf(char(0x00));
+            if(begin < 0)
+            {
+                garbage += m_buf.size();
+                m_buf.clear();
+                return;
+            }
+            int end = m_buf.indexOf(char(0x02), begin + 1);
+            if(end < 0)
+            {
+                garbage += begin;
+                m_buf.remove(0, begin);
+                return;
+            }
+
+            // Every byte of the frame carries 7 bits in its high bits
+            QVector<uint8_t> payload;
+            uint32_t acc = 0;
+            int bits = 0;
+            for(int i = begin + 1; i < end; ++i)
+            {
+                acc = (acc << 7) | (uint8_t(m_buf[i]) >> 1);
+                bits += 7;
+                if(bits >= 8)
+                {
+                    payload.push_back(uint8_t(acc >> (bits - 8)));
+                    bits -= 8;
+                }
+            }
+
+            if(payload.size() >= 6 && payload[0] == (0x21 << 1) && payload[1] == 0x12)
+            {
+                uint16_t addr = payload[3] | ((payload[2] == 0xe5) ? 0x100 : 0);
+                writes.push_back({addr, payload[5]});
+            }
+            else
+                ++garbage;
+
+            garbage += begin;
+            m_buf.remove(0, end + 1);
+        }
+    }
+
+    unsigned   m_protocol;
+    QByteArray m_buf;
+};
+
+class SerialLoopbackTest : public QObject
+{
+    Q_OBJECT
+
+    int     m_master = -1;
+    QString m_slaveName;
+
+    QByteArray readMaster()
+    {
+        QByteArray out;
+        char buf[4096];
+        ssize_t got;
+        while((got = ::read(m_master, buf, sizeof(buf))) > 0)
+            out.append(buf, int(got));
+        return out;
+    }
+
+    static QVector<SerialDecoder::Write> makeWrites(unsigned protocol, int count)
+    {
+        QVector<SerialDecoder::Write> out;
+        out.reserve(count);
+        uint16_t addrMask = (protocol == OPL_SerialPort::ProtocolArduinoOPL2) ? 0xFF : 0x1FF;
+        uint32_t seed = 12345;
+        for(int i = 0; i < count; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            out.push_back({uint16_t((seed >> 8) & addrMask), uint8_t(seed >> 20)});
+        }
+        return out;
+    }
+
+    /**
+     * @brief Send writes in blocks like the generator does, and decode them back
+     */
+    bool roundTrip(OPL_SerialPort &port, const QVector<SerialDecoder::Write> &writes,
+                   int perBlock, SerialDecoder &decoder)
+    {
+        int32_t frames[2 * 64];
+        for(int i = 0; i < writes.size(); ++i)
+        {
+            port.writeReg(writes[i].addr, writes[i].data);
+            if((i + 1) % perBlock == 0 || i + 1 == writes.size())
+            {
+                // End of the block: the batch gets queued and sent by the event loop
+                port.generate32(frames, 64);
+                QCoreApplication::processEvents();
+                decoder.feed(readMaster());
+            }
+        }
+
+        QElapsedTimer timeout;
+        timeout.start();
+        while(decoder.writes.size() < writes.size() && timeout.elapsed() < 10000)
+        {
+            QCoreApplication::processEvents();
+            decoder.feed(readMaster());
+            if(decoder.writes.size() < writes.size())
+                QTest::qWait(1);
+        }
+        return decoder.writes.size() == writes.size();
+    }
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        m_master = ::posix_openpt(O_RDWR | O_NOCTTY);
+        QVERIFY2(m_master >= 0, "Pseudo-terminals are not available");
+        QVERIFY(::grantpt(m_master) == 0);
+        QVERIFY(::unlockpt(m_master) == 0);
+        m_slaveName = QString::fromLocal8Bit(::ptsname(m_master));
+
+        // Bytes must pass through the terminal as is
+        struct termios tio;
+        QVERIFY(::tcgetattr(m_master, &tio) == 0);
+        ::cfmakeraw(&tio);
+        QVERIFY(::tcsetattr(m_master, TCSANOW, &tio) == 0);
+        ::fcntl(m_master, F_SETFL, ::fcntl(m_master, F_GETFL) | O_NONBLOCK);
+    }
+
+    void cleanupTestCase()
+    {
+        if(m_master >= 0)
+            ::close(m_master);
+    }
+
+    void loopback_data()
+    {
+        QTest::addColumn<unsigned>("protocol");
+        QTest::newRow("ArduinoOPL2") << unsigned(OPL_SerialPort::ProtocolArduinoOPL2);
+        QTest::newRow("NukeYktOPL3") << unsigned(OPL_SerialPort::ProtocolNukeYktOPL3);
+        QTest::newRow("RetroWaveOPL3") << unsigned(OPL_SerialPort::ProtocolRetroWaveOPL3);
+    }
+
+    void loopback()
+    {
+        QFETCH(unsigned, protocol);
+
+        OPL_SerialPort port;
+        QVERIFY(port.connectPort(m_slaveName, 115200, protocol));
+        // Batches are only sent by the end of the block
+        port.setFlushDeadline(10000000);
+        readMaster();
+
+        const QVector<SerialDecoder::Write> writes = makeWrites(protocol, 2000);
+        SerialDecoder decoder(protocol);
+        QVERIFY(roundTrip(port, writes, 40, decoder));
+
+        QCOMPARE(decoder.writes, writes);
+        QCOMPARE(decoder.garbage, 0);
+
+        OPL_SerialPort::Statistics stats = port.statistics();
+        QCOMPARE(stats.writes, quint64(writes.size()));
+        // Writes of one block must go out together
+        QCOMPARE(stats.batches, quint64(writes.size() / 40));
+        QCOMPARE(stats.dropped, quint64(0));
+    }
+
+    void overflow()
+    {
+        const unsigned protocol = OPL_SerialPort::ProtocolArduinoOPL2;
+        OPL_SerialPort port;
+        QVERIFY(port.connectPort(m_slaveName, 115200, protocol));
+        readMaster();
+
+        // Nothing is sent while the event loop is not running, the queue gets full
+        const QVector<SerialDecoder::Write> writes = makeWrites(protocol, 40000);
+        for(const SerialDecoder::Write &w : writes)
+            port.writeReg(w.addr, w.data);
+
+        OPL_SerialPort::Statistics stats = port.statistics();
+        QVERIFY(stats.dropped > 0);
+        QVERIFY(stats.dropped < quint64(writes.size()));
+        QCOMPARE(stats.writes, quint64(0));
+
+        // Writes which have fit are sent in order as one batch
+        const int kept = writes.size() - int(stats.dropped);
+        SerialDecoder decoder(protocol);
+        QElapsedTimer timeout;
+        timeout.start();
+        while(decoder.writes.size() < kept && timeout.elapsed() < 10000)
+        {
+            QCoreApplication::processEvents();
+            decoder.feed(readMaster());
+            if(decoder.writes.size() < kept)
+                QTest::qWait(1);
+        }
+        QCOMPARE(decoder.writes, writes.mid(0, kept));
+
+        stats = port.statistics();
+        QCOMPARE(stats.writes, quint64(kept));
+        QCOMPARE(stats.batches, quint64(1));
+    }
+
+    void throughput_data()
+    {
+        loopback_data();
+    }
+
+    void throughput()
+    {
+        QFETCH(unsigned, protocol);
+
+        OPL_SerialPort port;
+        QVERIFY(port.connectPort(m_slaveName, 115200, protocol));
+        readMaster();
+
+        const QVector<SerialDecoder::Write> writes = makeWrites(protocol, 50000);
+        SerialDecoder decoder(protocol);
+        QElapsedTimer timer;
+        timer.start();
+        QVERIFY(roundTrip(port, writes, 64, decoder));
+        qint64 elapsed = timer.nsecsElapsed();
+
+        OPL_SerialPort::Statistics stats = port.statistics();
+        qInfo("%llu writes in %llu batches, %.1f bytes/write: "
+              "%.0f writes/s sent, %.0f writes/s end-to-end, latency %.3f ms mean, %.3f ms max",
+              stats.writes, stats.batches, double(stats.bytes) / double(stats.writes),
+              stats.writesPerSecond, double(writes.size()) * 1e9 / double(elapsed),
+              stats.meanLatencyMs, stats.maxLatencyMs);
+    }
+};
+
+QTEST_GUILESS_MAIN(SerialLoopbackTest)
+
+#include "tst_serial_loopback.moc"
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# Filtering of redundant register writes by the shadow register file
+#
+#-------------------------------------------------
+
+QT       += testlib
+
+QT       -= gui
+
+TARGET = tst_shadow_registers
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/../../src
+
+SOURCES += \
+        tst_shadow_registers.cpp
+
+HEADERS += \
+    ../../src/opl/shadow_registers.h
@@ -0,0 +1,121 @@
+#include <QString>
+#include <QtTest>
+
+#include <opl/shadow_registers.h>
+
+class ShadowRegistersTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void equalWriteIsSkipped()
+    {
+        OPLShadowRegisters regs;
+        QVERIFY(!regs.isKnown(0x40));
+
+        // The first write is passed even when it writes the power-on value
+        QVERIFY(regs.write(0x40, 0x00));
+        QVERIFY(regs.isKnown(0x40));
+        QVERIFY(!regs.write(0x40, 0x00));
+        QVERIFY(!regs.write(0x40, 0x00));
+        QCOMPARE(regs.writesCount(0x40), 1u);
+        QCOMPARE(regs.skipsCount(0x40), 2u);
+
+        QVERIFY(regs.write(0x40, 0x3F));
+        QCOMPARE(regs.value(0x40), uint8_t(0x3F));
+        QCOMPARE(regs.writesCount(0x40), 2u);
+        QCOMPARE(regs.skipsCount(0x40), 2u);
+
+        // Registers of the second bank are kept apart
+        QVERIFY(regs.write(0x140, 0x3F));
+        QVERIFY(!regs.write(0x140, 0x3F));
+        QCOMPARE(regs.skipsCount(0x140), 1u);
+        QCOMPARE(regs.skipsCount(0x40), 2u);
+        QCOMPARE(regs.skipsCount(0x41), 0u);
+
+        QCOMPARE(regs.totalWrites(), uint64_t(3));
+        QCOMPARE(regs.totalSkips(), uint64_t(3));
+    }
+
+    void keyBitChangePasses()
+    {
+        OPLShadowRegisters regs;
+        for(uint16_t bank = 0; bank < 0x200; bank += 0x100)
+        {
+            for(uint16_t ch = 0; ch < 9; ch++)
+            {
+                const uint16_t addr = uint16_t(bank + 0xB0 + ch);
+                const uint8_t keyOn = 0x31, keyOff = 0x11;
+                QVERIFY(regs.write(addr, keyOn));
+                QVERIFY(!regs.write(addr, keyOn));
+                QVERIFY(regs.write(addr, keyOff));
+                QVERIFY(!regs.write(addr, keyOff));
+                // Retrigger of the same note
+                QVERIFY(regs.write(addr, keyOn));
+                QCOMPARE(regs.writesCount(addr), 3u);
+                QCOMPARE(regs.skipsCount(addr), 2u);
+            }
+        }
+
+        // Rhythm mode keys are bits of 0xBD
+        QVERIFY(regs.write(0xBD, 0x20));
+        QVERIFY(regs.write(0xBD, 0x30));
+        QVERIFY(regs.write(0xBD, 0x20));
+        QVERIFY(!regs.write(0xBD, 0x20));
+    }
+
+    void strobesAlwaysPass()
+    {
+        OPLShadowRegisters regs;
+        const uint16_t strobes[] = {0x002, 0x003, 0x004, 0x102, 0x103};
+        for(uint16_t addr : strobes)
+        {
+            QVERIFY(OPLShadowRegisters::isStrobe(addr));
+            for(int i = 0; i < 3; i++)
+                QVERIFY2(regs.write(addr, 0x80), qPrintable(QString::number(addr, 16)));
+            QCOMPARE(regs.writesCount(addr), 3u);
+            QCOMPARE(regs.skipsCount(addr), 0u);
+        }
+
+        // The 4-operator connection select is a state
+        QVERIFY(!OPLShadowRegisters::isStrobe(0x104));
+        QVERIFY(regs.write(0x104, 0x3F));
+        QVERIFY(!regs.write(0x104, 0x3F));
+        QCOMPARE(regs.skipsCount(0x104), 1u);
+        QVERIFY(regs.write(0x104, 0x00));
+
+        // Same for the OPL3 mode and the rest of state registers
+        QVERIFY(!OPLShadowRegisters::isStrobe(0x105));
+        QVERIFY(!OPLShadowRegisters::isStrobe(0x008));
+        QVERIFY(regs.write(0x105, 0x01));
+        QVERIFY(!regs.write(0x105, 0x01));
+    }
+
+    void invalidateLetsWriteThrough()
+    {
+        OPLShadowRegisters regs;
+        QVERIFY(regs.write(0x20, 0x21));
+        QVERIFY(regs.write(0xA0, 0x98));
+        QVERIFY(!regs.write(0x20, 0x21));
+
+        // The chip was reset, its registers are unknown again
+        regs.invalidate();
+        QVERIFY(!regs.isKnown(0x20));
+        QVERIFY(regs.write(0x20, 0x21));
+        QVERIFY(regs.write(0xA0, 0x98));
+        QVERIFY(!regs.write(0xA0, 0x98));
+
+        // Counters are kept till they are reset
+        QCOMPARE(regs.writesCount(0x20), 2u);
+        QCOMPARE(regs.skipsCount(0x20), 1u);
+        regs.resetCounters();
+        QCOMPARE(regs.writesCount(0x20), 0u);
+        QCOMPARE(regs.totalWrites(), uint64_t(0));
+        QCOMPARE(regs.totalSkips(), uint64_t(0));
+        QVERIFY(!regs.write(0x20, 0x21));
+    }
+};
+
+QTEST_APPLESS_MAIN(ShadowRegistersTest)
+
+#include "tst_shadow_registers.moc"
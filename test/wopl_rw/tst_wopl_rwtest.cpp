@@ -181,6 +181,43 @@ private Q_SLOTS:
             WOPL_Free(probe_dst);
         }
     }
+
+    void savePartialBank()
+    {
+        // Count of instruments is not a multiple of 128: the rest of the last bank is blank
+        FmBank src;
+        src.reset(1, 1);
+        src.Ins_Melodic_box.resize(200);
+        src.autocreateMissingBanks();
+        for(int i = 0; i < src.countMelodic(); i++)
+        {
+            FmBank::Instrument &ins = src.Ins_Melodic_box[i];
+            snprintf(ins.name, 32, "Instrument %d", i);
+            ins.OP[CARRIER1].level = uint8_t(i % 64);
+            ins.OP[MODULATOR1].fmult = uint8_t(i % 16);
+        }
+
+        WohlstandOPL3 format;
+        QVERIFY2(format.saveFile("temp-partial.wopl", src) == FfmtErrCode::ERR_OK, "Saving of partial bank failed");
+        FmBank dst;
+        QVERIFY2(format.loadFile("temp-partial.wopl", dst) == FfmtErrCode::ERR_OK, "Loading of partial bank failed");
+        QFile("temp-partial.wopl").remove();
+
+        QCOMPARE(dst.countMelodic(), 256);
+        for(int i = 0; i < src.countMelodic(); i++)
+        {
+            QCOMPARE(QString::fromUtf8(dst.Ins_Melodic_box[i].name), QString::fromUtf8(src.Ins_Melodic_box[i].name));
+            QCOMPARE(dst.Ins_Melodic_box[i].OP[CARRIER1].level, src.Ins_Melodic_box[i].OP[CARRIER1].level);
+            QCOMPARE(dst.Ins_Melodic_box[i].OP[MODULATOR1].fmult, src.Ins_Melodic_box[i].OP[MODULATOR1].fmult);
+        }
+        for(int i = src.countMelodic(); i < dst.countMelodic(); i++)
+        {
+            const FmBank::Instrument &ins = dst.Ins_Melodic_box.at(i);
+            QVERIFY2(ins.name[0] == '\0', "Instrument past the end must be empty");
+            QCOMPARE(ins.OP[CARRIER1].level, uint8_t(0));
+            QCOMPARE(ins.OP[MODULATOR1].fmult, uint8_t(0));
+        }
+    }
 };
 
 Wopl_rwTest::Wopl_rwTest() :
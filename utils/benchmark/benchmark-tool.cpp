@@ -0,0 +1,472 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs fixed workloads through every chip emulator and reports their speed
+ * as JSON. With a baseline report, compares the speed with it and fails
+ * when any emulator became slower than the tolerance allows.
+ *
+ * Usage: opl3_benchmark [-o report.json] [-b baseline.json] [-t tolerance%]
+ *                       [-c emulator] [-n repeats] [-s seconds] [workload-file]...
+ *
+ * Workload files are register logs, uncompressed VGM or DRO files, which are
+ * giving dense register changes of real music.
+ */
+
+#include <opl/register_log.h>
+#include <opl/chips/opl_chip_base.h>
+#include <opl/chips/nuked_opl3.h>
+#include <opl/chips/nuked_opl3_v174.h>
+#include <opl/chips/dosbox_opl3.h>
+#include <opl/chips/opal_opl3.h>
+#include <opl/chips/java_opl3.h>
+#include <opl/chips/ymf262_lle.h>
+#ifdef ENABLE_YMFM_EMULATOR
+#include <opl/chips/ymfm_opl3.h>
+#endif
+#include "../common/bench_report.h"
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#   include <intrin.h>
+#   define HAS_CYCLE_COUNTER 1
+static inline uint64_t readCycles() { return __rdtsc(); }
+#elif defined(__i386__) || defined(__x86_64__)
+#   include <x86intrin.h>
+#   define HAS_CYCLE_COUNTER 1
+static inline uint64_t readCycles() { return __rdtsc(); }
+#else
+#   define HAS_CYCLE_COUNTER 0
+static inline uint64_t readCycles() { return 0; }
+#endif
+
+static OPLChipBase *createChip(const QString &name)
+{
+    if(name == "nuked")
+        return new NukedOPL3;
+    if(name == "nuked174")
+        return new NukedOPL3v174;
+    if(name == "dosbox")
+        return new DosBoxOPL3;
+    if(name == "opal")
+        return new OpalOPL3;
+    if(name == "java")
+        return new JavaOPL3;
+    if(name == "lle")
+        return new Ymf262LLEOPL3;
+#ifdef ENABLE_YMFM_EMULATOR
+    if(name == "ymfm")
+        return new YmFmOPL3;
+#endif
+    return nullptr;
+}
+
+static const char *const s_chipNames[] =
+{
+    "nuked", "nuked174", "dosbox", "opal", "java",
+#ifdef ENABLE_YMFM_EMULATOR
+    "ymfm",
+#endif
+    "lle"
+};
+
+struct Workload
+{
+    QString name;
+    OPLRegisterLog log;
+};
+
+/* ******** Synthetic workloads ******** */
+
+static const uint32_t s_rate = 44100;
+
+static inline uint16_t modulatorOf(unsigned channel)
+{
+    unsigned local = channel % 9;
+    return uint16_t((channel / 9) * 0x100 + (local / 3) * 8 + (local % 3));
+}
+
+static inline uint16_t channelReg(unsigned channel, uint16_t base)
+{
+    return uint16_t((channel / 9) * 0x100 + base + (channel % 9));
+}
+
+/**
+ * @brief Collects writes of the synthetic workload in any order
+ */
+class WorkloadBuilder
+{
+public:
+    explicit WorkloadBuilder(uint8_t fourOps)
+    {
+        write(0, 0x105, 0x01);
+        write(0, 0x104, fourOps);
+        write(0, 0x001, 0x20);
+        write(0, 0x0BD, 0x00);
+    }
+
+    void write(uint64_t frame, uint16_t addr, uint8_t data)
+    {
+        OPLRegisterLog::Event e = {frame, addr, data};
+        m_events.push_back(e);
+    }
+
+    void writeOperator(uint16_t op, uint8_t level, uint8_t env)
+    {
+        write(0, 0x20 + op, 0x21);
+        write(0, 0x40 + op, level);
+        write(0, 0x60 + op, 0xF2);
+        write(0, 0x80 + op, env);
+        write(0, 0xE0 + op, 0x00);
+    }
+
+    void writeVoice(unsigned channel, uint8_t feedConn)
+    {
+        writeOperator(modulatorOf(channel), 0x18, 0x54);
+        writeOperator(modulatorOf(channel) + 3, 0x08, 0x36);
+        write(0, channelReg(channel, 0xC0), feedConn);
+    }
+
+    /**
+     * @brief Play notes on given channels, retriggered every quarter of the second
+     */
+    void playNotes(const QVector<unsigned> &channels, uint64_t frames)
+    {
+        const uint64_t period = s_rate / 4;
+        unsigned step = 0;
+        for(uint64_t frame = 0; frame < frames; frame += period, ++step)
+        {
+            for(int i = 0; i < channels.size(); ++i)
+            {
+                unsigned ch = channels[i];
+                unsigned fnum = 0x200 + ((step * 37 + unsigned(i) * 53) & 0xFF);
+                unsigned block = 3 + (unsigned(i) % 3);
+                uint8_t hi = uint8_t(((fnum >> 8) & 3) | (block << 2));
+                write(frame, channelReg(ch, 0xB0), hi);
+                write(frame, channelReg(ch, 0xA0), uint8_t(fnum & 0xFF));
+                write(frame + 1, channelReg(ch, 0xB0), uint8_t(0x20 | hi));
+            }
+        }
+    }
+
+    /**
+     * @brief Fill the log with writes ordered by their time
+     */
+    void build(OPLRegisterLog &log, uint64_t frames)
+    {
+        std::stable_sort(m_events.begin(), m_events.end(),
+                         [](const OPLRegisterLog::Event &a, const OPLRegisterLog::Event &b)
+        {
+            return a.frame < b.frame;
+        });
+
+        log.begin(s_rate, OPLChipBase::CHIPTYPE_OPL3);
+        for(const OPLRegisterLog::Event &e : m_events)
+            log.append(e.frame, e.addr, e.data);
+        log.finish(frames);
+    }
+
+private:
+    QVector<OPLRegisterLog::Event> m_events;
+};
+
+static void makeIdle(Workload &w, uint64_t frames)
+{
+    w.name = "idle";
+    WorkloadBuilder b(0x00);
+    b.build(w.log, frames);
+}
+
+static void makePoly2op(Workload &w, uint64_t frames)
+{
+    w.name = "poly2op";
+    WorkloadBuilder b(0x00);
+    QVector<unsigned> channels;
+    for(unsigned ch = 0; ch < 18; ++ch)
+    {
+        b.writeVoice(ch, 0x3C);
+        channels.push_back(ch);
+    }
+    b.playNotes(channels, frames);
+    b.build(w.log, frames);
+}
+
+static void make4op(Workload &w, uint64_t frames)
+{
+    w.name = "4op";
+    WorkloadBuilder b(0x3F);
+    QVector<unsigned> channels;
+    static const unsigned primary[6] = {0, 1, 2, 9, 10, 11};
+    for(unsigned ch : primary)
+    {
+        b.writeVoice(ch, 0x3C);
+        b.writeVoice(ch + 3, 0x3D);
+        channels.push_back(ch);
+    }
+    b.playNotes(channels, frames);
+    b.build(w.log, frames);
+}
+
+static void makeRhythm(Workload &w, uint64_t frames)
+{
+    w.name = "rhythm";
+    WorkloadBuilder b(0x00);
+    QVector<unsigned> channels;
+    for(unsigned ch = 0; ch < 18; ++ch)
+    {
+        b.writeVoice(ch, 0x3C);
+        if(ch < 6 || ch >= 9)
+            channels.push_back(ch);
+    }
+
+    // Drum channels need their pitch before they are hit
+    for(unsigned ch = 6; ch < 9; ++ch)
+    {
+        b.write(0, channelReg(ch, 0xA0), 0x57);
+        b.write(0, channelReg(ch, 0xB0), 0x09);
+    }
+
+    const uint64_t period = s_rate / 8;
+    unsigned step = 0;
+    for(uint64_t frame = 0; frame < frames; frame += period, ++step)
+    {
+        uint8_t hits = uint8_t(0x1F & (0x11 | (step * 0x0B)));
+        b.write(frame, 0xBD, 0x20);
+        b.write(frame + 1, 0xBD, uint8_t(0x20 | hits));
+    }
+
+    b.playNotes(channels, frames);
+    b.build(w.log, frames);
+}
+
+/* ******** Measurement ******** */
+
+struct BenchResult
+{
+    QString emulator;
+    QString emulatorName;
+    QString workload;
+    uint64_t frames = 0;
+    int      repeats = 0;
+    double   samplesPerSec = 0.0;
+    double   samplesPerSecStddev = 0.0;
+    double   realtimeFactor = 0.0;
+    double   cyclesPerSample = 0.0;
+};
+
+static BenchResult runWorkload(const QString &emulator, const Workload &w, int repeats)
+{
+    BenchResult res;
+    res.emulator = emulator;
+    res.workload = w.name;
+    res.repeats = repeats;
+
+    std::unique_ptr<OPLChipBase> chip(createChip(emulator));
+    res.emulatorName = QString::fromUtf8(chip->emulatorName());
+
+    // Warm-up run, caches and the resampler are getting ready
+    OPLRegisterLog::ReplayStats stats = w.log.replay(*chip);
+    res.frames = stats.frames;
+
+    double sum = 0.0, sumSq = 0.0;
+    uint64_t bestCycles = 0;
+    for(int r = 0; r < repeats; ++r)
+    {
+        uint64_t c0 = readCycles();
+        stats = w.log.replay(*chip);
+        uint64_t cycles = readCycles() - c0;
+
+        double sps = (stats.seconds > 0.0) ? double(stats.frames) / stats.seconds : 0.0;
+        sum += sps;
+        sumSq += sps * sps;
+        if(r == 0 || cycles < bestCycles)
+            bestCycles = cycles;
+    }
+
+    res.samplesPerSec = sum / repeats;
+    res.samplesPerSecStddev = (repeats > 1) ?
+        std::sqrt(std::max(0.0, (sumSq - sum * sum / repeats) / (repeats - 1))) : 0.0;
+    res.realtimeFactor = res.samplesPerSec / double(w.log.rate());
+    res.cyclesPerSample = (HAS_CYCLE_COUNTER && res.frames > 0) ? double(bestCycles) / double(res.frames) : 0.0;
+    return res;
+}
+
+static QJsonObject resultToJson(const BenchResult &r)
+{
+    QJsonObject o;
+    o["emulator"] = r.emulator;
+    o["emulator_name"] = r.emulatorName;
+    o["workload"] = r.workload;
+    o["frames"] = double(r.frames);
+    o["repeats"] = r.repeats;
+    o["samples_per_sec"] = r.samplesPerSec;
+    o["samples_per_sec_stddev"] = r.samplesPerSecStddev;
+    o["realtime_factor"] = r.realtimeFactor;
+    if(HAS_CYCLE_COUNTER)
+        o["cycles_per_sample"] = r.cyclesPerSample;
+    else
+        o["cycles_per_sample"] = QJsonValue();
+    return o;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QString reportPath;
+    QString baselinePath;
+    double tolerance = 5.0;
+    int repeats = 5;
+    double seconds = 10.0;
+    QStringList chips;
+    QStringList files;
+
+    QStringList args = app.arguments();
+    for(int i = 1; i < args.size(); i++)
+    {
+        if(args[i] == "-o" && i + 1 < args.size())
+            reportPath = args[++i];
+        else if(args[i] == "-b" && i + 1 < args.size())
+            baselinePath = args[++i];
+        else if(args[i] == "-t" && i + 1 < args.size())
+            tolerance = args[++i].toDouble();
+        else if(args[i] == "-n" && i + 1 < args.size())
+            repeats = qMax(1, args[++i].toInt());
+        else if(args[i] == "-s" && i + 1 < args.size())
+            seconds = qMax(0.1, args[++i].toDouble());
+        else if(args[i] == "-c" && i + 1 < args.size())
+            chips.push_back(args[++i]);
+        else if(args[i] == "-h" || args[i] == "--help")
+        {
+            fprintf(stderr, "%s [-o report.json] [-b baseline.json] [-t tolerance%%]\n"
+                            "    [-c emulator] [-n repeats] [-s seconds] [workload-file]...\n", argv[0]);
+            return 1;
+        }
+        else
+            files.push_back(args[i]);
+    }
+
+    if(chips.isEmpty())
+    {
+        for(const char *name : s_chipNames)
+            chips.push_back(QString::fromLatin1(name));
+    }
+
+    for(const QString &name : chips)
+    {
+        std::unique_ptr<OPLChipBase> chip(createChip(name));
+        if(!chip)
+        {
+            fprintf(stderr, "Unknown emulator %s\n", qPrintable(name));
+            return 1;
+        }
+    }
+
+    const uint64_t frames = uint64_t(seconds * s_rate);
+    QVector<Workload> workloads(4);
+    makeIdle(workloads[0], frames);
+    makePoly2op(workloads[1], frames);
+    make4op(workloads[2], frames);
+    makeRhythm(workloads[3], frames);
+
+    for(const QString &path : files)
+    {
+        Workload w;
+        w.name = QFileInfo(path).fileName();
+        if(!w.log.loadFile(path))
+        {
+            fprintf(stderr, "Can't load the workload %s\n", qPrintable(path));
+            return 1;
+        }
+        workloads.push_back(w);
+    }
+
+    QVector<BenchResult> results;
+    QJsonArray jsonResults;
+
+    printf("%-10s %-24s %14s %8s %10s %12s\n", "emulator", "workload", "samples/s", "+/-%", "realtime", "cycles/smp");
+    for(const QString &name : chips)
+    {
+        for(const Workload &w : workloads)
+        {
+            BenchResult r = runWorkload(name, w, repeats);
+            printf("%-10s %-24s %14.0f %8.2f %9.1fx %12.1f\n", qPrintable(r.emulator), qPrintable(r.workload),
+                   r.samplesPerSec, (r.samplesPerSec > 0.0) ? 100.0 * r.samplesPerSecStddev / r.samplesPerSec : 0.0,
+                   r.realtimeFactor, r.cyclesPerSample);
+            fflush(stdout);
+            results.push_back(r);
+            jsonResults.append(resultToJson(r));
+        }
+    }
+
+    QJsonObject report;
+    report["host"] = benchHostInfo();
+    report["rate"] = double(s_rate);
+    report["repeats"] = repeats;
+    report["results"] = jsonResults;
+
+    if(!reportPath.isEmpty())
+    {
+        QFile out(reportPath);
+        if(!out.open(QIODevice::WriteOnly))
+        {
+            fprintf(stderr, "Can't write the report %s\n", qPrintable(reportPath));
+            return 1;
+        }
+        out.write(QJsonDocument(report).toJson());
+    }
+
+    if(!baselinePath.isEmpty())
+    {
+        QFile in(baselinePath);
+        if(!in.open(QIODevice::ReadOnly))
+        {
+            fprintf(stderr, "Can't read the baseline %s\n", qPrintable(baselinePath));
+            return 1;
+        }
+        QJsonObject baseline = QJsonDocument::fromJson(in.readAll()).object();
+        QVector<BenchThroughput> throughput;
+        for(const BenchResult &r : results)
+        {
+            BenchThroughput t;
+            t.label = QString("%1 %2").arg(r.emulator, -10).arg(r.workload, -10);
+            t.key["emulator"] = r.emulator;
+            t.key["workload"] = r.workload;
+            t.value = r.samplesPerSec;
+            throughput.push_back(t);
+        }
+        int regressions = compareThroughputWithBaseline(QString("%1 %2").arg("emulator", -10).arg("workload", -10),
+                                                        throughput, baseline, "samples_per_sec", tolerance);
+        if(regressions > 0)
+        {
+            printf("\n%d regression(s) beyond %.1f%%\n", regressions, tolerance);
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bench_report.h"
+#include <QJsonArray>
+#include <QSysInfo>
+#include <QThread>
+#include <cstdio>
+
+QJsonObject benchHostInfo()
+{
+    QJsonObject o;
+    o["os"] = QSysInfo::prettyProductName();
+    o["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    o["threads"] = QThread::idealThreadCount();
+#if defined(__VERSION__)
+    o["compiler"] = QString::fromLatin1(__VERSION__);
+#elif defined(_MSC_VER)
+    o["compiler"] = QString("MSVC %1").arg(_MSC_VER);
+#endif
+    return o;
+}
+
+static bool isSameCase(const QJsonObject &key, const QJsonObject &o)
+{
+    for(QJsonObject::const_iterator it = key.begin(); it != key.end(); ++it)
+    {
+        if(o.value(it.key()) != it.value())
+            return false;
+    }
+    return true;
+}
+
+int compareThroughputWithBaseline(const QString &labelHeader,
+                                  const QVector<BenchThroughput> &results,
+                                  const QJsonObject &baseline,
+                                  const char *valueKey,
+                                  double tolerance)
+{
+    int regressions = 0;
+    QJsonArray base = baseline["results"].toArray();
+
+    printf("\n%s %14s %14s %9s\n", qPrintable(labelHeader), "baseline", "current", "change");
+    for(const BenchThroughput &r : results)
+    {
+        double ref = 0.0;
+        for(const QJsonValue &v : base)
+        {
+            QJsonObject o = v.toObject();
+            if(isSameCase(r.key, o))
+            {
+                ref = o[valueKey].toDouble();
+                break;
+            }
+        }
+
+        if(ref <= 0.0)
+        {
+            printf("%s %14s %14.2f %9s\n", qPrintable(r.label), "-", r.value, "new");
+            continue;
+        }
+
+        double change = (r.value / ref - 1.0) * 100.0;
+        bool regression = change < -tolerance;
+        if(regression)
+            ++regressions;
+        printf("%s %14.2f %14.2f %+8.1f%%%s\n", qPrintable(r.label),
+               ref, r.value, change, regression ? "  REGRESSION" : "");
+    }
+
+    return regressions;
+}
@@ -0,0 +1,60 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#include <QString>
+#include <QVector>
+#include <QJsonObject>
+
+/*
+ * Parts of JSON reports which are shared by the benchmark tools
+ */
+
+/**
+ * @brief Description of the host for the report
+ */
+QJsonObject benchHostInfo();
+
+struct BenchThroughput
+{
+    //! Printed name of the case, formatted into columns by the caller
+    QString label;
+    //! Fields which are identifying the same case in the results of the baseline
+    QJsonObject key;
+    //! Measured throughput, the more is the better
+    double value = 0.0;
+};
+
+/**
+ * @brief Compare the throughput with the baseline report and print the table
+ * @param labelHeader Header of the label column, formatted like labels
+ * @param results Measured cases
+ * @param baseline Whole baseline report, its cases are in the "results" array
+ * @param valueKey Name of the throughput field in the baseline cases
+ * @param tolerance Allowed slowdown in percents
+ * @return count of regressions
+ */
+int compareThroughputWithBaseline(const QString &labelHeader,
+                                  const QVector<BenchThroughput> &results,
+                                  const QJsonObject &baseline,
+                                  const char *valueKey,
+                                  double tolerance);
+
+#endif // BENCH_REPORT_H
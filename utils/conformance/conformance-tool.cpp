@@ -0,0 +1,420 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Renders every instrument of given banks and every given register stream
+ * (register log, VGM or DOSBox Raw OPL) through all emulators and compares
+ * their output with Nuked OPL3. Writes the JSON report.
+ *
+ * When the baseline report is given, divergences which got worse than the
+ * baseline by more than the tolerance are printed and the exit code is 2.
+ *
+ * Usage: opl3_conformance [-o report.json] [-t threshold]
+ *                         [-b baseline.json] [-d tolerance-db] <file-or-directory>...
+ */
+
+#include <FileFormats/ffmt_factory.h>
+#include <FileFormats/ffmt_enums.h>
+#include <opl/measurer.h>
+#include <opl/register_log.h>
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QMap>
+#include <QtConcurrent/QtConcurrent>
+#include <atomic>
+#include <cstdio>
+#include <cmath>
+
+struct ConformanceTask
+{
+    int file;
+    int index;
+    bool percussion;
+    FmBank::Instrument ins;
+    QVector<Measurer::ConformanceResult> result;
+};
+
+struct StreamTask
+{
+    int file;
+    OPLRegisterLog log;
+    QVector<Measurer::ConformanceResult> result;
+};
+
+struct EmulatorSummary
+{
+    double rms_divergence_sum = 0.0;
+    double rms_divergence_max = -120.0;
+    double spectral_divergence_sum = 0.0;
+    double spectral_divergence_max = 0.0;
+    int diverging = 0;
+    int count = 0;
+    qint64 elapsed = 0;
+};
+
+static void collectFiles(const QString &path, QStringList &out)
+{
+    QFileInfo info(path);
+    if(!info.isDir())
+    {
+        out.push_back(path);
+        return;
+    }
+
+    QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+    while(it.hasNext())
+        out.push_back(it.next());
+}
+
+static void collectInstruments(const FmBank::InsStorage &box, int file, bool percussion,
+                               QVector<ConformanceTask> &tasks)
+{
+    for(int i = 0; i < box.size(); i++)
+    {
+        const FmBank::Instrument &ins = box.at(i);
+        if(ins.is_blank)
+            continue;
+        ConformanceTask task;
+        task.file = file;
+        task.index = i;
+        task.percussion = percussion;
+        task.ins = ins;
+        tasks.push_back(task);
+    }
+}
+
+static QJsonObject resultToJson(const Measurer::ConformanceResult &r)
+{
+    QJsonObject o;
+    o["emulator"] = r.name;
+    o["rms_divergence_db"] = r.rms_divergence_db;
+    o["level_diff_db"] = r.level_diff_db;
+    o["spectral_divergence_db"] = r.spectral_divergence_db;
+    o["first_diverging_sample"] = double(r.first_diverging_sample);
+    o["max_sample_diff"] = r.max_sample_diff;
+    o["elapsed_ms"] = double(r.elapsed);
+    return o;
+}
+
+static void addToSummary(const QVector<Measurer::ConformanceResult> &result,
+                         QMap<QString, EmulatorSummary> &summary, QString &reference,
+                         QJsonArray &je)
+{
+    for(int e = 0; e < result.size(); e++)
+    {
+        const Measurer::ConformanceResult &r = result[e];
+        if(e == 0)
+        {
+            reference = r.name;
+            summary[r.name].elapsed += r.elapsed;
+            continue;
+        }
+
+        je.push_back(resultToJson(r));
+
+        EmulatorSummary &s = summary[r.name];
+        s.rms_divergence_sum += r.rms_divergence_db;
+        s.rms_divergence_max = qMax(s.rms_divergence_max, r.rms_divergence_db);
+        s.spectral_divergence_sum += r.spectral_divergence_db;
+        s.spectral_divergence_max = qMax(s.spectral_divergence_max, r.spectral_divergence_db);
+        s.diverging += (r.first_diverging_sample >= 0) ? 1 : 0;
+        s.count++;
+        s.elapsed += r.elapsed;
+    }
+}
+
+/**
+ * @brief Key of the checked sound which doesn't depend on the location of input files
+ */
+static QString soundKey(const QJsonObject &file, const QJsonObject &sound)
+{
+    QString name = QFileInfo(file["path"].toString()).fileName();
+    if(sound.contains("index"))
+        return QString("%1:%2:%3").arg(name)
+                                  .arg(sound["percussion"].toBool() ? "P" : "M")
+                                  .arg(sound["index"].toInt());
+    return name;
+}
+
+static void collectSounds(const QJsonObject &root, QMap<QString, QJsonArray> &out)
+{
+    const QJsonArray files = root["files"].toArray();
+    for(const QJsonValue &fv : files)
+    {
+        QJsonObject file = fv.toObject();
+        if(file.contains("emulators"))
+            out[soundKey(file, file)] = file["emulators"].toArray();
+        const QJsonArray instruments = file["instruments"].toArray();
+        for(const QJsonValue &iv : instruments)
+        {
+            QJsonObject ins = iv.toObject();
+            out[soundKey(file, ins)] = ins["emulators"].toArray();
+        }
+    }
+}
+
+/**
+ * @brief Print every divergence which got worse than in the baseline report
+ * @return count of regressions
+ */
+static int compareDivergencesWithBaseline(const QJsonObject &root, const QJsonObject &baseline, double tolerance)
+{
+    QMap<QString, QJsonArray> current, base;
+    collectSounds(root, current);
+    collectSounds(baseline, base);
+
+    int regressions = 0;
+    int missing = 0;
+
+    for(QMap<QString, QJsonArray>::const_iterator it = current.begin(); it != current.end(); ++it)
+    {
+        if(!base.contains(it.key()))
+        {
+            ++missing;
+            continue;
+        }
+
+        QMap<QString, QJsonObject> baseEmuls;
+        for(const QJsonValue &v : base[it.key()])
+            baseEmuls[v.toObject()["emulator"].toString()] = v.toObject();
+
+        for(const QJsonValue &v : it.value())
+        {
+            QJsonObject r = v.toObject();
+            QString emulator = r["emulator"].toString();
+            if(!baseEmuls.contains(emulator))
+                continue;
+            const QJsonObject &b = baseEmuls[emulator];
+
+            // Level difference counts in both directions
+            static const char *const metrics[] = {"rms_divergence_db", "spectral_divergence_db", "level_diff_db"};
+            for(const char *m : metrics)
+            {
+                bool absolute = (m == metrics[2]);
+                double was = absolute ? std::fabs(b[m].toDouble()) : b[m].toDouble();
+                double now = absolute ? std::fabs(r[m].toDouble()) : r[m].toDouble();
+                if(now > was + tolerance)
+                {
+                    fprintf(stderr, "REGRESSION: %s, %s: %s %.2f -> %.2f\n",
+                            qPrintable(it.key()), qPrintable(emulator), m, was, now);
+                    ++regressions;
+                }
+            }
+        }
+    }
+
+    if(missing > 0)
+        fprintf(stderr, "%d sounds are not in the baseline\n", missing);
+    fprintf(stderr, "%d regressions against the baseline\n", regressions);
+
+    return regressions;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QString reportPath;
+    QString baselinePath;
+    int threshold = 64;
+    double tolerance = 1.0;
+    QStringList inputs;
+
+    QStringList args = app.arguments();
+    for(int i = 1; i < args.size(); i++)
+    {
+        if(args[i] == "-o" && i + 1 < args.size())
+            reportPath = args[++i];
+        else if(args[i] == "-t" && i + 1 < args.size())
+            threshold = args[++i].toInt();
+        else if(args[i] == "-b" && i + 1 < args.size())
+            baselinePath = args[++i];
+        else if(args[i] == "-d" && i + 1 < args.size())
+            tolerance = args[++i].toDouble();
+        else
+            inputs.push_back(args[i]);
+    }
+
+    if(inputs.isEmpty())
+    {
+        fprintf(stderr, "%s [-o report.json] [-t threshold] [-b baseline.json] [-d tolerance-db] "
+                        "<file-or-directory>...\n", argv[0]);
+        return 1;
+    }
+
+    FmBankFormatFactory::registerAllFormats();
+
+    QStringList files;
+    for(const QString &in : inputs)
+        collectFiles(in, files);
+    files.sort();
+
+    QJsonArray jsonFiles;
+    QVector<int> fileSlots;
+    QVector<ConformanceTask> tasks;
+    QVector<StreamTask> streams;
+
+    for(const QString &path : files)
+    {
+        StreamTask stream;
+        if(stream.log.loadFile(path))
+        {
+            QJsonObject jf;
+            jf["path"] = path;
+            stream.file = jsonFiles.size();
+            jsonFiles.push_back(jf);
+            streams.push_back(stream);
+            continue;
+        }
+
+        FmBank bank;
+        FfmtErrCode err = FmBankFormatFactory::OpenBankFile(path, bank);
+        if(err == FfmtErrCode::ERR_UNSUPPORTED_FORMAT)
+            err = FmBankFormatFactory::ImportBankFile(path, bank);
+
+        QJsonObject jf;
+        jf["path"] = path;
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            jf["error"] = FileFormats::getErrorText(err);
+            jsonFiles.push_back(jf);
+            continue;
+        }
+
+        int file = jsonFiles.size();
+        jsonFiles.push_back(jf);
+        fileSlots.push_back(file);
+        collectInstruments(bank.Ins_Melodic_box, file, false, tasks);
+        collectInstruments(bank.Ins_Percussion_box, file, true, tasks);
+    }
+
+    fprintf(stderr, "Checking %d instruments from %d files and %d register streams...\n",
+            int(tasks.size()), int(fileSlots.size()), int(streams.size()));
+
+    QtConcurrent::blockingMap(streams, [threshold](StreamTask &stream)
+    {
+        Measurer::checkConformance(stream.log, stream.result, threshold);
+    });
+
+    std::atomic<int> done(0);
+    const int total = tasks.size();
+    QtConcurrent::blockingMap(tasks, [threshold, total, &done](ConformanceTask &task)
+    {
+        Measurer::checkConformance(task.ins, task.result, threshold);
+        int d = ++done;
+        if((d % 64) == 0 || d == total)
+            fprintf(stderr, "%d/%d\r", d, total);
+    });
+    fprintf(stderr, "\n");
+
+    QMap<QString, EmulatorSummary> summary;
+    QMap<int, QJsonArray> instrumentsOfFile;
+    QString reference;
+
+    for(const ConformanceTask &task : tasks)
+    {
+        QJsonObject ji;
+        ji["index"] = task.index;
+        ji["percussion"] = task.percussion;
+        ji["name"] = QString::fromUtf8(task.ins.name);
+
+        QJsonArray je;
+        addToSummary(task.result, summary, reference, je);
+        ji["emulators"] = je;
+        instrumentsOfFile[task.file].push_back(ji);
+    }
+
+    for(const StreamTask &stream : streams)
+    {
+        QJsonArray je;
+        addToSummary(stream.result, summary, reference, je);
+        QJsonObject jf = jsonFiles[stream.file].toObject();
+        jf["frames"] = double(stream.log.length());
+        jf["writes"] = stream.log.events().size();
+        jf["emulators"] = je;
+        jsonFiles[stream.file] = jf;
+    }
+
+    for(int file : fileSlots)
+    {
+        QJsonObject jf = jsonFiles[file].toObject();
+        jf["instruments"] = instrumentsOfFile.value(file);
+        jsonFiles[file] = jf;
+    }
+
+    QJsonArray jsonSummary;
+    for(QMap<QString, EmulatorSummary>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        const EmulatorSummary &s = it.value();
+        QJsonObject o;
+        o["emulator"] = it.key();
+        o["sounds"] = s.count;
+        o["elapsed_ms"] = double(s.elapsed);
+        if(it.key() != reference)
+        {
+            o["mean_rms_divergence_db"] = s.count ? (s.rms_divergence_sum / s.count) : 0.0;
+            o["max_rms_divergence_db"] = s.rms_divergence_max;
+            o["mean_spectral_divergence_db"] = s.count ? (s.spectral_divergence_sum / s.count) : 0.0;
+            o["max_spectral_divergence_db"] = s.spectral_divergence_max;
+            o["diverging_instruments"] = s.diverging;
+        }
+        jsonSummary.push_back(o);
+    }
+
+    QJsonObject root;
+    root["reference"] = reference;
+    root["threshold"] = threshold;
+    root["summary"] = jsonSummary;
+    root["files"] = jsonFiles;
+
+    QByteArray report = QJsonDocument(root).toJson();
+
+    if(reportPath.isEmpty())
+        fwrite(report.constData(), 1, size_t(report.size()), stdout);
+    else
+    {
+        QFile out(reportPath);
+        if(!out.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            fprintf(stderr, "Could not write the report file.\n");
+            return 1;
+        }
+        out.write(report);
+        out.close();
+    }
+
+    if(!baselinePath.isEmpty())
+    {
+        QFile in(baselinePath);
+        if(!in.open(QIODevice::ReadOnly))
+        {
+            fprintf(stderr, "Could not read the baseline file.\n");
+            return 1;
+        }
+        QJsonObject baseline = QJsonDocument::fromJson(in.readAll()).object();
+        if(compareDivergencesWithBaseline(root, baseline, tolerance) > 0)
+            return 2;
+    }
+
+    return 0;
+}
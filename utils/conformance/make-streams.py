@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+#
+# Generates the register streams used by the conformance check of emulators.
+# Every stream is a register log ("OPLRLOG1") which stresses some part of the
+# chip: melodic voices, 4-operator voices, rhythm mode, LFO, envelopes and
+# the OPL2 mode. Run it to regenerate files in the "streams" directory.
+#
+
+import os
+import struct
+
+RATE = 49716
+CHIP_OPL3 = 0
+CHIP_OPL2 = 1
+
+# First operator of every 2-operator channel, the second one goes 3 slots later
+OP_SLOT = [0, 1, 2, 8, 9, 10, 16, 17, 18]
+
+
+class Stream:
+    def __init__(self, chip_type=CHIP_OPL3):
+        self.chip_type = chip_type
+        self.frame = 0
+        self.events = []
+
+    def write(self, addr, data):
+        self.events.append((self.frame, addr, data & 0xFF))
+
+    def wait_ms(self, ms):
+        self.frame += RATE * ms // 1000
+
+    def wait_frames(self, frames):
+        self.frame += frames
+
+    def save(self, path):
+        out = bytearray(b"OPLRLOG1")
+        out += struct.pack("<IB3xQ", RATE, self.chip_type, self.frame)
+        frame = 0
+        for at, addr, data in self.events:
+            value = ((at - frame) << 1) | ((addr >> 8) & 1)
+            while value >= 0x80:
+                out.append((value & 0x7F) | 0x80)
+                value >>= 7
+            out.append(value)
+            out.append(addr & 0xFF)
+            out.append(data)
+            frame = at
+        with open(path, "wb") as f:
+            f.write(out)
+
+
+def op_addr(channel, second):
+    bank = 0x100 if channel >= 9 else 0
+    slot = OP_SLOT[channel % 9] + (3 if second else 0)
+    return bank, slot
+
+
+def set_operator(s, channel, second, avekm, ksltl, ardr, slrr, wave):
+    bank, slot = op_addr(channel, second)
+    s.write(bank + 0x20 + slot, avekm)
+    s.write(bank + 0x40 + slot, ksltl)
+    s.write(bank + 0x60 + slot, ardr)
+    s.write(bank + 0x80 + slot, slrr)
+    s.write(bank + 0xE0 + slot, wave)
+
+
+def set_channel(s, channel, fbcnt, stereo=0x30):
+    bank = 0x100 if channel >= 9 else 0
+    s.write(bank + 0xC0 + channel % 9, fbcnt | stereo)
+
+
+def fnum(freq):
+    block = 0
+    f = int(freq * (1 << 20) / RATE)
+    while f >= 1024 and block < 7:
+        block += 1
+        f = int(freq * (1 << (20 - block)) / RATE)
+    return min(f, 1023), block
+
+
+def key(s, channel, freq, on):
+    bank = 0x100 if channel >= 9 else 0
+    f, block = fnum(freq)
+    s.write(bank + 0xA0 + channel % 9, f & 0xFF)
+    s.write(bank + 0xB0 + channel % 9, (0x20 if on else 0) | (block << 2) | (f >> 8))
+
+
+def note_freq(note):
+    return 440.0 * 2.0 ** ((note - 69) / 12.0)
+
+
+def opl3_init(s, four_op=0):
+    s.write(0x105, 0x01)
+    s.write(0x104, four_op)
+    s.write(0x001, 0x20)
+    s.write(0x0BD, 0x00)
+
+
+def melodic():
+    s = Stream()
+    opl3_init(s)
+    patches = [
+        # modulator, carrier, feedback/connection
+        ((0x21, 0x1A, 0xF2, 0x53, 0), (0x21, 0x00, 0xF2, 0x54, 0), 0x0C),
+        ((0x01, 0x4F, 0xF1, 0x53, 1), (0x11, 0x00, 0xD2, 0x74, 0), 0x06),
+        ((0x31, 0x1C, 0x51, 0x03, 2), (0x61, 0x06, 0x52, 0x06, 4), 0x0E),
+        ((0xA1, 0x8F, 0xF2, 0x35, 3), (0x21, 0x80, 0x73, 0x1A, 5), 0x01),
+        ((0x05, 0x23, 0xF8, 0x75, 6), (0x01, 0x08, 0xF6, 0x25, 7), 0x0A),
+    ]
+    for ch in range(18):
+        m, c, fb = patches[ch % len(patches)]
+        set_operator(s, ch, False, *m)
+        set_operator(s, ch, True, *c)
+        set_channel(s, ch, fb, [0x10, 0x20, 0x30][ch % 3])
+
+    # Chords over both register banks
+    for step in range(8):
+        for ch in range(18):
+            key(s, ch, note_freq(36 + (ch * 5 + step * 7) % 60), True)
+        s.wait_ms(120)
+        for ch in range(18):
+            key(s, ch, note_freq(36 + (ch * 5 + step * 7) % 60), False)
+        s.wait_ms(30)
+
+    # Pitch glide while the key is held
+    for i in range(200):
+        key(s, 0, 110.0 * 2.0 ** (i / 50.0), True)
+        s.wait_ms(2)
+    key(s, 0, 440.0, False)
+    s.wait_ms(300)
+    return s
+
+
+def four_op():
+    s = Stream()
+    opl3_init(s, 0x3F)
+    for pair in range(6):
+        base = [0, 1, 2, 9, 10, 11][pair]
+        for half in range(2):
+            ch = base + half * 3
+            set_operator(s, ch, False, 0x21 + half, 0x10 + pair * 3, 0xF3, 0x35, pair % 8)
+            set_operator(s, ch, True, 0x21, 0x02 * half, 0xE4, 0x46, (pair + half) % 8)
+        # Every combination of both connection bits makes one of 4 algorithms
+        set_channel(s, base, 0x06 | (pair & 1))
+        set_channel(s, base + 3, (pair >> 1) & 1)
+
+    for step in range(6):
+        for pair in range(6):
+            base = [0, 1, 2, 9, 10, 11][pair]
+            key(s, base, note_freq(48 + pair * 4 + step), True)
+        s.wait_ms(200)
+        for pair in range(6):
+            base = [0, 1, 2, 9, 10, 11][pair]
+            key(s, base, note_freq(48 + pair * 4 + step), False)
+        s.wait_ms(50)
+    s.wait_ms(300)
+    return s
+
+
+def rhythm():
+    s = Stream()
+    opl3_init(s)
+    # Bass drum
+    set_operator(s, 6, False, 0x00, 0x0B, 0xA8, 0x4C, 0)
+    set_operator(s, 6, True, 0x00, 0x00, 0xD6, 0x4F, 0)
+    set_channel(s, 6, 0x00)
+    # Hi-hat and snare drum
+    set_operator(s, 7, False, 0x0C, 0x00, 0xF8, 0xB5, 0)
+    set_operator(s, 7, True, 0x00, 0x00, 0xF8, 0x08, 0)
+    set_channel(s, 7, 0x00)
+    # Tom-tom and cymbal
+    set_operator(s, 8, False, 0x04, 0x00, 0xF8, 0x67, 0)
+    set_operator(s, 8, True, 0x01, 0x00, 0xF5, 0x35, 0)
+    set_channel(s, 8, 0x00)
+    key(s, 6, 80.0, False)
+    key(s, 7, 480.0, False)
+    key(s, 8, 320.0, False)
+
+    pattern = [0x11, 0x01, 0x09, 0x01, 0x13, 0x01, 0x0B, 0x05,
+               0x11, 0x03, 0x09, 0x01, 0x17, 0x01, 0x0F, 0x1F]
+    for bits in pattern * 2:
+        s.write(0x0BD, 0x20)
+        s.wait_frames(3)
+        s.write(0x0BD, 0x20 | bits)
+        s.wait_ms(90)
+    s.write(0x0BD, 0x20)
+    s.wait_ms(400)
+    return s
+
+
+def lfo():
+    s = Stream()
+    opl3_init(s)
+    for ch in range(4):
+        set_operator(s, ch, False, 0xC1, 0x18, 0xF1, 0x02, ch)
+        set_operator(s, ch, True, 0xC1 if ch & 1 else 0x41, 0x00, 0xF1, 0x02, 0)
+        set_channel(s, ch, 0x04 | (ch >> 1))
+    for depth in (0xC0, 0x80, 0x40, 0x00):
+        s.write(0x0BD, depth)
+        for ch in range(4):
+            key(s, ch, note_freq(57 + ch * 7), True)
+        s.wait_ms(400)
+        for ch in range(4):
+            key(s, ch, note_freq(57 + ch * 7), False)
+        s.wait_ms(50)
+    s.wait_ms(200)
+    return s
+
+
+def envelopes():
+    s = Stream()
+    opl3_init(s)
+    rates = [(0xFF, 0x0F), (0xF0, 0xFF), (0x1F, 0x0F), (0xFA, 0xF3), (0x88, 0x88), (0x33, 0x3F)]
+    for ch, (ardr, slrr) in enumerate(rates):
+        ksr = 0x10 if ch & 1 else 0x00
+        set_operator(s, ch, False, 0x01 | ksr, 0x3F, 0x00, 0x00, 0)
+        set_operator(s, ch, True, 0x01 | ksr | (0x20 if ch < 3 else 0), 0x40 * (ch % 4), ardr, slrr, 0)
+        set_channel(s, ch, 0x00)
+
+    for rep in range(5):
+        for ch in range(6):
+            key(s, ch, note_freq(40 + ch * 9 + rep), True)
+        s.wait_ms(150)
+        # Retrigger which lands within a few samples
+        for ch in range(6):
+            key(s, ch, note_freq(40 + ch * 9 + rep), False)
+        s.wait_frames(2 + rep)
+        for ch in range(6):
+            key(s, ch, note_freq(40 + ch * 9 + rep), True)
+        s.wait_ms(100)
+        for ch in range(6):
+            key(s, ch, note_freq(40 + ch * 9 + rep), False)
+        s.wait_ms(80)
+    s.wait_ms(300)
+    return s
+
+
+def opl2():
+    s = Stream(CHIP_OPL2)
+    s.write(0x001, 0x20)
+    for ch in range(9):
+        set_operator(s, ch, False, 0x21, 0x20 + ch, 0xF4, 0x46, ch % 4)
+        set_operator(s, ch, True, 0x21, 0x00, 0xF4, 0x46, (ch + 1) % 4)
+        set_channel(s, ch, (ch % 7) << 1, 0)
+    for step in range(4):
+        for ch in range(9):
+            key(s, ch, note_freq(45 + ch * 3 + step * 2), True)
+        s.wait_ms(180)
+        for ch in range(9):
+            key(s, ch, note_freq(45 + ch * 3 + step * 2), False)
+        s.wait_ms(40)
+    # Waveform select gets disabled while notes are sounding
+    for ch in range(9):
+        key(s, ch, note_freq(60 + ch), True)
+    s.wait_ms(150)
+    s.write(0x001, 0x00)
+    s.wait_ms(150)
+    for ch in range(9):
+        key(s, ch, note_freq(60 + ch), False)
+    s.wait_ms(300)
+    return s
+
+
+if __name__ == "__main__":
+    out = os.path.join(os.path.dirname(os.path.abspath(__file__)), "streams")
+    melodic().save(os.path.join(out, "melodic.oplr"))
+    four_op().save(os.path.join(out, "four_op.oplr"))
+    rhythm().save(os.path.join(out, "rhythm.oplr"))
+    lfo().save(os.path.join(out, "lfo.oplr"))
+    envelopes().save(os.path.join(out, "envelopes.oplr"))
+    opl2().save(os.path.join(out, "opl2.oplr"))
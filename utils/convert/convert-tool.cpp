@@ -0,0 +1,535 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Converts banks between any formats known to the editor without the GUI.
+ *
+ * Usage: opl3-convert -f format [-f format...] [-o output-dir] [-j jobs] [-m] <file|glob|directory>...
+ *        opl3-convert -f format [-f format...] [-o output-dir] [-j jobs] [-m] -s text <directory>...
+ *
+ * Files are converted in parallel, every worker keeps only one bank in the
+ * memory. Directories are scanned recursively for files with extensions of
+ * supported formats, and their structure is repeated in the output directory.
+ * When several output formats are given, every format is written into its own
+ * sub-directory named by the format key (see -l).
+ *
+ * With -s, every directory is a library: its catalog (see opl3-library) is
+ * updated, and instruments found by the text are written into one bank named
+ * by the directory. Only new and changed files are parsed, and banks are not
+ * loaded at all for the conversion.
+ *
+ * With -m, sounding delays of instruments are measured before writing into
+ * formats which are keeping them (like WOPL). Measurement is running on the
+ * main thread, and it's parallel by itself.
+ *
+ * The status of every written file is printed to the standard output as one
+ * JSON object per line.
+ */
+
+#include <FileFormats/ffmt_factory.h>
+#include <FileFormats/ffmt_library.h>
+#include <opl/measurer.h>
+#include <QApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThreadPool>
+#include <QRunnable>
+#include <memory>
+#include <cstdio>
+
+struct OutputFormat
+{
+    BankFormats id;
+    QString     key;
+    bool        needsMeasure;
+};
+
+struct ConvertItem
+{
+    QString input;
+    //! Output path without the extension
+    QString outputBase;
+    //! Catalog to take found instruments from instead of the input file
+    const FmBankLibrary *library = nullptr;
+    QVector<int> found;
+};
+
+//! Bank which waits for the measurement on the main thread
+struct MeasureRequest
+{
+    FmBank *bank;
+    bool    done;
+    bool    ok;
+    qint64  elapsedMs;
+};
+
+/**
+ * @brief State shared between workers and the main thread
+ */
+struct ConvertShared
+{
+    QMutex          mutex;
+    //! Wakes the main thread up when a bank needs the measurement, or a file is done
+    QWaitCondition  wakeMain;
+    //! Wakes workers up when a measurement is finished
+    QWaitCondition  measured;
+    QList<MeasureRequest *> requests;
+    int             finished = 0;
+    int             failed = 0;
+
+    QList<OutputFormat> formats;
+    bool            measure = false;
+
+    QMutex          outputMutex;
+};
+
+static QString formatKey(const FmBankFormatBase *format, const QList<const FmBankFormatBase *> &all)
+{
+    const QString ext = format->formatDefaultExtension();
+    int sameExt = 0;
+    for(const FmBankFormatBase *f : all)
+    {
+        if((f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_SAVE) && f->formatDefaultExtension() == ext)
+            sameExt++;
+    }
+    if(sameExt > 1)
+        return QString("%1-%2").arg(ext).arg((int)format->formatId());
+    return ext;
+}
+
+static const FmBankFormatBase *findOutputFormat(const QString &name, const QList<const FmBankFormatBase *> &all)
+{
+    bool isNumber = false;
+    int id = name.toInt(&isNumber);
+    for(const FmBankFormatBase *f : all)
+    {
+        if((f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_SAVE) == 0)
+            continue;
+        if(isNumber ? ((int)f->formatId() == id) : (formatKey(f, all) == name))
+            return f;
+    }
+    return nullptr;
+}
+
+static void printLine(ConvertShared &shared, const QJsonObject &obj)
+{
+    QByteArray line = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+    line.append('\n');
+    QMutexLocker lock(&shared.outputMutex);
+    fwrite(line.constData(), 1, size_t(line.size()), stdout);
+    fflush(stdout);
+}
+
+/**
+ * @brief Make the bank of instruments found in the library
+ */
+static void libraryBank(const ConvertItem &item, FmBank &bank)
+{
+    item.library->toBank(item.found, bank);
+    // Formats are keeping whole banks of 128 instruments
+    do
+        bank.Ins_Melodic_box.push_back(FmBank::blankInst());
+    while(bank.Ins_Melodic_box.size() % 128 != 0);
+    do
+        bank.Ins_Percussion_box.push_back(FmBank::blankInst(true));
+    while(bank.Ins_Percussion_box.size() % 128 != 0);
+    bank.autocreateMissingBanks();
+}
+
+class ConvertJob : public QRunnable
+{
+    ConvertShared  &m_shared;
+    ConvertItem     m_item;
+
+public:
+    ConvertJob(ConvertShared &shared, const ConvertItem &item) :
+        m_shared(shared), m_item(item)
+    {}
+
+    void run() override
+    {
+        FmBank bank;
+        BankFormats sourceFormat = BankFormats::FORMAT_UNKNOWN;
+        QElapsedTimer timer;
+        timer.start();
+        FfmtErrCode err = FfmtErrCode::ERR_OK;
+        if(m_item.library)
+            libraryBank(m_item, bank);
+        else
+            err = FmBankFormatFactory::OpenBankFile(m_item.input, bank, &sourceFormat);
+        const qint64 loadMs = timer.elapsed();
+        bool failed = false;
+
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            QJsonObject obj;
+            obj["input"] = m_item.input;
+            obj["status"] = "error";
+            obj["error"] = FileFormats::getErrorText(err);
+            obj["load_ms"] = loadMs;
+            printLine(m_shared, obj);
+            failed = true;
+        }
+        else
+        {
+            // Formats without delays first, the measured bank is written after
+            bool measured = false;
+            qint64 measureMs = 0;
+            for(int pass = 0; pass < 2; pass++)
+            {
+                for(const OutputFormat &fmt : m_shared.formats)
+                {
+                    if(fmt.needsMeasure != (pass == 1))
+                        continue;
+
+                    QJsonObject obj;
+                    if(pass == 1 && m_shared.measure && !measured)
+                    {
+                        MeasureRequest req = {&bank, false, false, 0};
+                        QMutexLocker lock(&m_shared.mutex);
+                        m_shared.requests.push_back(&req);
+                        m_shared.wakeMain.wakeAll();
+                        while(!req.done)
+                            m_shared.measured.wait(&m_shared.mutex);
+                        measured = req.ok;
+                        measureMs = req.elapsedMs;
+                        if(!req.ok)
+                        {
+                            obj["input"] = m_item.input;
+                            obj["status"] = "error";
+                            obj["error"] = "measurement was interrupted";
+                            lock.unlock();
+                            printLine(m_shared, obj);
+                            failed = true;
+                            break;
+                        }
+                    }
+
+                    QString outputPath = m_item.outputBase;
+                    if(m_shared.formats.size() > 1)
+                    {
+                        QFileInfo base(outputPath);
+                        outputPath = base.path() + "/" + fmt.key + "/" + base.fileName();
+                    }
+                    QDir().mkpath(QFileInfo(outputPath).path());
+
+                    timer.restart();
+                    FfmtErrCode saveErr = FmBankFormatFactory::SaveBankFile(outputPath, bank, fmt.id);
+                    const qint64 saveMs = timer.elapsed();
+
+                    obj["input"] = m_item.input;
+                    obj["output"] = outputPath;
+                    if(m_item.library)
+                        obj["found"] = m_item.found.size();
+                    else
+                        obj["source_format"] = FmBankFormatFactory::formatName(sourceFormat);
+                    obj["format"] = fmt.key;
+                    obj["melodic"] = bank.countMelodic();
+                    obj["percussion"] = bank.countDrums();
+                    obj["load_ms"] = loadMs;
+                    if(pass == 1 && measured)
+                        obj["measure_ms"] = measureMs;
+                    obj["save_ms"] = saveMs;
+                    if(saveErr == FfmtErrCode::ERR_OK)
+                        obj["status"] = "ok";
+                    else
+                    {
+                        obj["status"] = "error";
+                        obj["error"] = FileFormats::getErrorText(saveErr);
+                        failed = true;
+                    }
+                    printLine(m_shared, obj);
+                }
+            }
+        }
+
+        QMutexLocker lock(&m_shared.mutex);
+        m_shared.finished++;
+        if(failed)
+            m_shared.failed++;
+        m_shared.wakeMain.wakeAll();
+    }
+};
+
+static QStringList openableMasks()
+{
+    QStringList masks;
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allBankFormats())
+    {
+        if((f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_OPEN) == 0)
+            continue;
+        for(const QString &mask : f->formatExtensionMask().split(' '))
+        {
+            if(!mask.isEmpty() && !masks.contains(mask, Qt::CaseInsensitive))
+                masks.push_back(mask);
+        }
+    }
+    return masks;
+}
+
+static void collectInputs(const QString &arg, const QString &outputDir, QList<ConvertItem> &items)
+{
+    QFileInfo info(arg);
+
+    if(info.isDir())
+    {
+        QDir root(info.absoluteFilePath());
+        QDirIterator it(root.path(), openableMasks(), QDir::Files, QDirIterator::Subdirectories);
+        QStringList found;
+        while(it.hasNext())
+            found.push_back(it.next());
+        found.sort();
+        for(const QString &path : found)
+        {
+            QFileInfo f(path);
+            QString rel = root.relativeFilePath(f.path());
+            ConvertItem item;
+            item.input = path;
+            item.outputBase = QDir::cleanPath(outputDir + "/" + rel + "/" + f.completeBaseName());
+            items.push_back(item);
+        }
+        return;
+    }
+
+    if(arg.contains('*') || arg.contains('?') || arg.contains('['))
+    {
+        QDir dir(info.path());
+        for(const QString &name : dir.entryList(QStringList(info.fileName()), QDir::Files, QDir::Name))
+        {
+            ConvertItem item;
+            item.input = dir.filePath(name);
+            item.outputBase = QDir::cleanPath(outputDir + "/" + QFileInfo(name).completeBaseName());
+            items.push_back(item);
+        }
+        return;
+    }
+
+    ConvertItem item;
+    item.input = arg;
+    item.outputBase = QDir::cleanPath(outputDir + "/" + info.completeBaseName());
+    items.push_back(item);
+}
+
+/**
+ * @brief Update the catalog of the directory and find instruments in it
+ * @return false if the directory can't be used as a library
+ */
+static bool collectLibrary(const QString &arg, const QString &outputDir, const QString &text,
+                           QList<FmBankLibrary *> &libraries, QList<ConvertItem> &items)
+{
+    QFileInfo info(arg);
+    if(!info.isDir())
+    {
+        fprintf(stderr, "%s is not a directory\n", arg.toLocal8Bit().constData());
+        return false;
+    }
+
+    FmBankLibrary *library = new FmBankLibrary;
+    libraries.push_back(library);
+    library->open(info.absoluteFilePath());
+    FfmtErrCode err = library->update();
+    // The catalog is usable even if the store can't be written
+    if(err != FfmtErrCode::ERR_OK)
+        fprintf(stderr, "Can't write the catalog of %s: %s\n", arg.toLocal8Bit().constData(),
+                FileFormats::getErrorText(err).toLocal8Bit().constData());
+
+    ConvertItem item;
+    item.input = info.absoluteFilePath();
+    item.outputBase = QDir::cleanPath(outputDir + "/" + QDir(item.input).dirName());
+    item.library = library;
+    item.found = library->search(text);
+    if(item.found.isEmpty())
+        fprintf(stderr, "No instruments were found in %s\n", arg.toLocal8Bit().constData());
+    else
+        items.push_back(item);
+    return true;
+}
+
+static void printUsage(const char *prog)
+{
+    fprintf(stderr, "%s -f format [-f format...] [-o output-dir] [-j jobs] [-m] <file|glob|directory>...\n", prog);
+    fprintf(stderr, "       %s -f format [-f format...] [-o output-dir] [-j jobs] [-m] -s text <directory>...\n", prog);
+    fprintf(stderr, "       %s -l\n", prog);
+    fprintf(stderr, "  -f  Output format, by the key or the numeric identifier\n");
+    fprintf(stderr, "  -o  Output directory (current directory by default)\n");
+    fprintf(stderr, "  -j  Count of files converted at once (count of CPU cores by default)\n");
+    fprintf(stderr, "  -m  Measure sounding delays for formats which are keeping them\n");
+    fprintf(stderr, "  -s  Write instruments found in the catalog of every directory into one bank,\n"
+                    "      an empty text takes all instruments\n");
+    fprintf(stderr, "  -l  List output formats\n");
+}
+
+int main(int argc, char *argv[])
+{
+    QStringList formatNames;
+    QStringList inputs;
+    QString outputDir = ".";
+    int jobs = QThread::idealThreadCount();
+    bool measure = false;
+    bool list = false;
+    bool search = false;
+    QString searchText;
+
+    for(int i = 1; i < argc; i++)
+    {
+        QString arg = QString::fromLocal8Bit(argv[i]);
+        if(arg == "-f" && i + 1 < argc)
+            formatNames.push_back(QString::fromLocal8Bit(argv[++i]));
+        else if(arg == "-o" && i + 1 < argc)
+            outputDir = QString::fromLocal8Bit(argv[++i]);
+        else if(arg == "-j" && i + 1 < argc)
+            jobs = qMax(1, QString::fromLocal8Bit(argv[++i]).toInt());
+        else if(arg == "-m")
+            measure = true;
+        else if(arg == "-s" && i + 1 < argc)
+        {
+            search = true;
+            searchText = QString::fromLocal8Bit(argv[++i]);
+        }
+        else if(arg == "-l")
+            list = true;
+        else
+            inputs.push_back(arg);
+    }
+
+    // The measurer is using widgets, everything else is fine without them
+    std::unique_ptr<QCoreApplication> app;
+    if(measure)
+    {
+        if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+        app.reset(new QApplication(argc, argv));
+    }
+    else
+        app.reset(new QCoreApplication(argc, argv));
+
+    FmBankFormatFactory::registerAllFormats();
+    const QList<const FmBankFormatBase *> all = FmBankFormatFactory::allBankFormats();
+
+    if(list)
+    {
+        for(const FmBankFormatBase *f : all)
+        {
+            if((f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_SAVE) == 0)
+                continue;
+            printf("%3d  %-10s %s%s\n", (int)f->formatId(),
+                   formatKey(f, all).toLocal8Bit().constData(),
+                   f->formatName().toLocal8Bit().constData(),
+                   (f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_NEEDS_MEASURE) ? " (measured)" : "");
+        }
+        return 0;
+    }
+
+    if(formatNames.isEmpty() || inputs.isEmpty())
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    ConvertShared shared;
+    shared.measure = measure;
+    for(const QString &name : formatNames)
+    {
+        const FmBankFormatBase *f = findOutputFormat(name, all);
+        if(!f)
+        {
+            fprintf(stderr, "Unknown output format %s, see -l\n", name.toLocal8Bit().constData());
+            return 2;
+        }
+        OutputFormat fmt;
+        fmt.id = f->formatId();
+        fmt.key = formatKey(f, all);
+        fmt.needsMeasure = (f->formatCaps() & (int)FormatCaps::FORMAT_CAPS_NEEDS_MEASURE) != 0;
+        shared.formats.push_back(fmt);
+    }
+
+    QList<ConvertItem> items;
+    QList<FmBankLibrary *> libraries;
+    for(const QString &arg : inputs)
+    {
+        if(!search)
+            collectInputs(arg, outputDir, items);
+        else if(!collectLibrary(arg, outputDir, searchText, libraries, items))
+        {
+            qDeleteAll(libraries);
+            return 2;
+        }
+    }
+
+    if(items.isEmpty())
+    {
+        fprintf(stderr, "No input files\n");
+        qDeleteAll(libraries);
+        return 1;
+    }
+
+    std::unique_ptr<Measurer> measurer;
+    if(measure)
+        measurer.reset(new Measurer);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(jobs);
+
+    QElapsedTimer total;
+    total.start();
+
+    for(const ConvertItem &item : items)
+        pool.start(new ConvertJob(shared, item));
+
+    // Serve measurement requests until every file is done
+    {
+        QMutexLocker lock(&shared.mutex);
+        while(shared.finished < items.size())
+        {
+            if(shared.requests.isEmpty())
+            {
+                shared.wakeMain.wait(&shared.mutex);
+                continue;
+            }
+
+            MeasureRequest *req = shared.requests.takeFirst();
+            lock.unlock();
+
+            QElapsedTimer timer;
+            timer.start();
+            FmBank backup = *req->bank;
+            bool ok = measurer->doMeasurement(*req->bank, backup);
+            qint64 elapsed = timer.elapsed();
+
+            lock.relock();
+            req->ok = ok;
+            req->elapsedMs = elapsed;
+            req->done = true;
+            shared.measured.wakeAll();
+        }
+    }
+
+    pool.waitForDone();
+    qDeleteAll(libraries);
+
+    fprintf(stderr, "Converted %d of %d files in %.3f s\n",
+            items.size() - shared.failed, items.size(), double(total.elapsed()) / 1000.0);
+
+    return (shared.failed > 0) ? 1 : 0;
+}
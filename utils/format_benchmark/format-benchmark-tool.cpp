@@ -0,0 +1,745 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Measures the speed of parsers and serializers of every bank and instrument
+ * format and reports it as JSON. With a baseline report, compares the speed
+ * with it and fails when any case became slower than the tolerance allows.
+ *
+ * Usage: opl3_format_benchmark [-o report.json] [-b baseline.json] [-t tolerance%]
+ *                              [-s seconds] [-x scale] [file|directory]...
+ *
+ * Every given file (directories are scanned recursively) is loaded from the
+ * memory with the format detection, like the editor does. Then a synthetic
+ * bank of `scale` melodic and `scale` percussion banks is saved into every
+ * writable format and the result is loaded back. Importers of music files
+ * (IMF and VGM) are receiving synthetic songs of the same scale.
+ *
+ * Files are read into the memory once, so the disk speed is not counted.
+ */
+
+#include <FileFormats/ffmt_factory.h>
+#include <opl/register_log.h>
+#include <opl/chips/opl_chip_base.h>
+#include "../common/bench_report.h"
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <functional>
+#include <cstdio>
+#include <cstring>
+
+/* ******** Synthetic data ******** */
+
+/**
+ * @brief Small deterministic generator, results must be equal on every run
+ */
+class Random
+{
+public:
+    explicit Random(uint32_t seed) : m_state(seed) {}
+
+    uint8_t byte()
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return uint8_t(m_state >> 24);
+    }
+
+private:
+    uint32_t m_state;
+};
+
+static void randomInstrument(FmBank::Instrument &ins, Random &rnd, int index, bool isDrum)
+{
+    ins = FmBank::emptyInst();
+    for(int op = 0; op < 4; op++)
+    {
+        ins.setAVEKM(op, rnd.byte());
+        ins.setKSLL(op, rnd.byte() & 0xBF);
+        ins.setAtDec(op, rnd.byte() | 0x80);
+        ins.setSusRel(op, rnd.byte());
+        ins.setWaveForm(op, rnd.byte() & 0x07);
+    }
+    ins.setFBConn1(rnd.byte() & 0x0F);
+    ins.setFBConn2(rnd.byte() & 0x0F);
+    ins.en_4op = (index % 4) == 3;
+    ins.en_pseudo4op = ins.en_4op && (index % 8) == 7;
+    ins.note_offset1 = int16_t(int(rnd.byte() % 25) - 12);
+    ins.velocity_offset = int8_t(int(rnd.byte() % 11) - 5);
+    ins.percNoteNum = isDrum ? uint8_t(35 + index % 47) : 0;
+    ins.is_fixed_note = isDrum;
+    ins.ms_sound_kon = uint16_t(100 + rnd.byte() * 10);
+    ins.ms_sound_koff = uint16_t(rnd.byte() * 4);
+    snprintf(ins.name, sizeof(ins.name), "%s instrument %d", isDrum ? "Drum" : "Melodic", index);
+}
+
+static void makeSyntheticBank(FmBank &bank, int scale)
+{
+    Random rnd(0x0B1A0B1Au);
+    bank.reset(uint16_t(scale), uint16_t(scale));
+
+    for(int i = 0; i < bank.Ins_Melodic_box.size(); i++)
+        randomInstrument(bank.Ins_Melodic_box[i], rnd, i, false);
+    for(int i = 0; i < bank.Ins_Percussion_box.size(); i++)
+        randomInstrument(bank.Ins_Percussion_box[i], rnd, i, true);
+
+    for(int i = 0; i < bank.Banks_Melodic.size(); i++)
+    {
+        FmBank::MidiBank &b = bank.Banks_Melodic[i];
+        snprintf(b.name, sizeof(b.name), "Melodic %d", i);
+        b.msb = uint8_t(i / 128);
+        b.lsb = uint8_t(i % 128);
+    }
+    for(int i = 0; i < bank.Banks_Percussion.size(); i++)
+    {
+        FmBank::MidiBank &b = bank.Banks_Percussion[i];
+        snprintf(b.name, sizeof(b.name), "Percussion %d", i);
+        b.msb = uint8_t(i / 128);
+        b.lsb = uint8_t(i % 128);
+    }
+}
+
+struct SongWrite
+{
+    //! Delay before this write in ticks of 1/700 of second
+    uint16_t delay;
+    uint8_t  reg;
+    uint8_t  val;
+};
+
+/**
+ * @brief Song which is playing a new instrument on every note of nine OPL2 channels
+ * @param notes Count of notes
+ */
+static QVector<SongWrite> makeSyntheticSong(int notes)
+{
+    static const uint8_t modulators[9] = {0x00, 0x01, 0x02, 0x08, 0x09, 0x0A, 0x10, 0x11, 0x12};
+    Random rnd(0x50C0FFEEu);
+    QVector<SongWrite> song;
+    song.reserve(notes * 14 + 2);
+
+    SongWrite init = {0, 0x01, 0x20};
+    song.push_back(init);
+
+    for(int i = 0; i < notes; i++)
+    {
+        uint8_t ch = uint8_t(i % 9);
+        uint8_t mod = modulators[ch];
+        SongWrite keyOff = {0, uint8_t(0xB0 + ch), 0x00};
+        song.push_back(keyOff);
+
+        for(uint8_t op = mod; op <= mod + 3; op += 3)
+        {
+            SongWrite w[5] =
+            {
+                {0, uint8_t(0x20 + op), rnd.byte()},
+                {0, uint8_t(0x40 + op), uint8_t(rnd.byte() & 0xBF)},
+                {0, uint8_t(0x60 + op), uint8_t(rnd.byte() | 0x80)},
+                {0, uint8_t(0x80 + op), rnd.byte()},
+                {0, uint8_t(0xE0 + op), uint8_t(rnd.byte() & 0x03)}
+            };
+            for(const SongWrite &e : w)
+                song.push_back(e);
+        }
+
+        SongWrite fbConn = {0, uint8_t(0xC0 + ch), uint8_t(rnd.byte() & 0x0F)};
+        SongWrite fnum = {0, uint8_t(0xA0 + ch), rnd.byte()};
+        SongWrite keyOn = {0, uint8_t(0xB0 + ch), uint8_t(0x20 | (rnd.byte() & 0x1F))};
+        song.push_back(fbConn);
+        song.push_back(fnum);
+        song.push_back(keyOn);
+        // Instruments are captured when the time goes on
+        SongWrite wait = {35, 0x00, 0x00};
+        song.push_back(wait);
+    }
+
+    return song;
+}
+
+/**
+ * @brief Build the IMF type 1 file in the same entry layout which the importer reads
+ */
+static QByteArray makeImf(const QVector<SongWrite> &song)
+{
+    QByteArray out;
+    uint32_t len = uint32_t(4 + song.size() * 4);
+    out.reserve(int(len));
+    for(int i = 0; i < 4; i++)
+        out.push_back(char((len >> (i * 8)) & 0xFF));
+    for(const SongWrite &w : song)
+    {
+        out.push_back(char(w.delay & 0xFF));
+        out.push_back(char(w.delay >> 8));
+        out.push_back(char(w.reg));
+        out.push_back(char(w.val));
+    }
+    return out;
+}
+
+static QByteArray makeVgm(const QVector<SongWrite> &song)
+{
+    const uint32_t rate = 44100;
+    OPLRegisterLog log;
+    log.begin(rate, OPLChipBase::CHIPTYPE_OPL3);
+    uint64_t frame = 0;
+    for(const SongWrite &w : song)
+    {
+        frame += uint64_t(w.delay) * rate / 700;
+        if(w.reg != 0)
+            log.append(frame, w.reg, w.val);
+    }
+    log.finish(frame + rate / 10);
+    return log.toVGM();
+}
+
+static int countInstruments(const FmBank &bank)
+{
+    int count = 0;
+    for(int i = 0; i < bank.Ins_Melodic_box.size(); i++)
+        count += bank.Ins_Melodic_box[i].is_blank ? 0 : 1;
+    for(int i = 0; i < bank.Ins_Percussion_box.size(); i++)
+        count += bank.Ins_Percussion_box[i].is_blank ? 0 : 1;
+    return count;
+}
+
+/* ******** Measurement ******** */
+
+struct BenchCase
+{
+    QString kind;
+    int     formatId = -1;
+    QString formatName;
+    QString source;
+    QString op;
+    qint64  bytes = 0;
+    int     instruments = 0;
+    int     iterations = 0;
+    double  bestSeconds = 0.0;
+    double  mbPerSec = 0.0;
+    double  instrumentsPerSec = 0.0;
+    QString error;
+};
+
+static double s_minSeconds = 0.2;
+
+/**
+ * @brief Run the operation until the minimal time is spent, and take the best run
+ * @param c Case to fill, bytes and instruments must be set before
+ * @param op Operation, returns false on failure
+ */
+static void runCase(BenchCase &c, const std::function<bool()> &op)
+{
+    QElapsedTimer total;
+    total.start();
+    qint64 best = -1;
+    int iterations = 0;
+
+    while(iterations < 3 || total.nsecsElapsed() < qint64(s_minSeconds * 1e9))
+    {
+        QElapsedTimer t;
+        t.start();
+        bool ok = op();
+        qint64 ns = t.nsecsElapsed();
+        if(!ok)
+        {
+            if(c.error.isEmpty())
+                c.error = "operation has failed";
+            return;
+        }
+        if(best < 0 || ns < best)
+            best = ns;
+        ++iterations;
+    }
+
+    c.iterations = iterations;
+    c.bestSeconds = double(qMax<qint64>(best, 1)) / 1e9;
+    c.mbPerSec = double(c.bytes) / c.bestSeconds / 1e6;
+    c.instrumentsPerSec = double(c.instruments) / c.bestSeconds;
+}
+
+static FfmtErrCode openBank(const QByteArray &data, const QString &fileName, FmBank &bank, BankFormats &format)
+{
+    format = BankFormats::FORMAT_UNKNOWN;
+    FfmtErrCode err = FmBankFormatFactory::OpenBankData(data, fileName, bank, &format);
+    if(err == FfmtErrCode::ERR_UNSUPPORTED_FORMAT)
+        err = FmBankFormatFactory::ImportBankData(data, fileName, bank, &format);
+    return err;
+}
+
+static FfmtErrCode openInstrument(const QByteArray &data, const QString &fileName, FmBank::Instrument &ins, InstFormats &format)
+{
+    bool isDrum = false;
+    format = InstFormats::FORMAT_INST_UNKNOWN;
+    FfmtErrCode err = FmBankFormatFactory::OpenInstrumentData(data, fileName, ins, &format, &isDrum, false);
+    if(err == FfmtErrCode::ERR_UNSUPPORTED_FORMAT)
+        err = FmBankFormatFactory::OpenInstrumentData(data, fileName, ins, &format, &isDrum, true);
+    return err;
+}
+
+static QString bankFormatName(BankFormats id)
+{
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allBankFormats())
+    {
+        if(f->formatId() == id)
+            return f->formatName();
+    }
+    return QString();
+}
+
+static QString instFormatName(InstFormats id)
+{
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allInstrumentFormats())
+    {
+        if(f->formatInstId() == id)
+            return f->formatInstName();
+    }
+    return QString();
+}
+
+/**
+ * @brief Load the sample file as a bank, or as a single instrument when it's not a bank
+ * @return false if no format has recognized the file
+ */
+static bool benchSampleFile(const QString &path, QVector<BenchCase> &results)
+{
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArray data = file.readAll();
+    file.close();
+
+    BenchCase c;
+    c.source = path;
+    c.op = "open";
+    c.bytes = data.size();
+
+    FmBank bank;
+    BankFormats bankFormat;
+    if(openBank(data, path, bank, bankFormat) == FfmtErrCode::ERR_OK)
+    {
+        c.kind = "bank";
+        c.formatId = int(bankFormat);
+        c.formatName = bankFormatName(bankFormat);
+        c.instruments = countInstruments(bank);
+        runCase(c, [&]()
+        {
+            FmBank b;
+            BankFormats f;
+            return openBank(data, path, b, f) == FfmtErrCode::ERR_OK;
+        });
+        results.push_back(c);
+        return true;
+    }
+
+    FmBank::Instrument ins;
+    InstFormats instFormat;
+    if(openInstrument(data, path, ins, instFormat) == FfmtErrCode::ERR_OK)
+    {
+        c.kind = "instrument";
+        c.formatId = int(instFormat);
+        c.formatName = instFormatName(instFormat);
+        c.instruments = 1;
+        runCase(c, [&]()
+        {
+            FmBank::Instrument i;
+            InstFormats f;
+            return openInstrument(data, path, i, f) == FfmtErrCode::ERR_OK;
+        });
+        results.push_back(c);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Save the synthetic bank into every writable format and load it back
+ */
+static void benchSyntheticBanks(FmBank &synth, QVector<BenchCase> &results)
+{
+    const QString source = QString("synthetic-%1x128").arg(synth.Banks_Melodic.size());
+
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allBankFormats())
+    {
+        if((f->formatCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)) == 0)
+            continue;
+
+        const BankFormats id = f->formatId();
+        const QString fileName = "synthetic." + f->formatDefaultExtension();
+
+        BenchCase save;
+        save.kind = "bank";
+        save.formatId = int(id);
+        save.formatName = f->formatName();
+        save.source = source;
+        save.op = "save";
+
+        QByteArray data;
+        FfmtErrCode err = FmBankFormatFactory::SaveBankData(data, synth, id);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            save.error = FileFormats::getErrorText(err);
+            results.push_back(save);
+            continue;
+        }
+
+        // Formats are keeping different parts of the bank, count only what survives
+        BenchCase load = save;
+        load.op = "open";
+        load.bytes = data.size();
+
+        FmBank loaded;
+        BankFormats loadedFormat;
+        err = openBank(data, fileName, loaded, loadedFormat);
+        if(err == FfmtErrCode::ERR_OK)
+            load.instruments = countInstruments(loaded);
+        else
+            load.error = FileFormats::getErrorText(err);
+
+        save.bytes = data.size();
+        save.instruments = (err == FfmtErrCode::ERR_OK) ? load.instruments : countInstruments(synth);
+        runCase(save, [&]()
+        {
+            QByteArray out;
+            return FmBankFormatFactory::SaveBankData(out, synth, id) == FfmtErrCode::ERR_OK;
+        });
+        results.push_back(save);
+
+        if(err == FfmtErrCode::ERR_OK)
+        {
+            runCase(load, [&]()
+            {
+                FmBank b;
+                BankFormats lf;
+                return openBank(data, fileName, b, lf) == FfmtErrCode::ERR_OK;
+            });
+        }
+        results.push_back(load);
+    }
+}
+
+/**
+ * @brief Save one instrument into every writable instrument format and load it back
+ */
+static void benchSyntheticInstruments(QVector<BenchCase> &results)
+{
+    Random rnd(0x1A57A11Eu);
+    FmBank::Instrument ins;
+    randomInstrument(ins, rnd, 3, false);
+
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allInstrumentFormats())
+    {
+        if((f->formatInstCaps() & int(FormatCaps::FORMAT_CAPS_SAVE)) == 0)
+            continue;
+
+        const InstFormats id = f->formatInstId();
+        const QString fileName = "synthetic." + f->formatInstDefaultExtension();
+
+        BenchCase save;
+        save.kind = "instrument";
+        save.formatId = int(id);
+        save.formatName = f->formatInstName();
+        save.source = "synthetic-instrument";
+        save.op = "save";
+        save.instruments = 1;
+
+        QByteArray data;
+        FfmtErrCode err = FmBankFormatFactory::SaveInstrumentData(data, ins, id, false);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            save.error = FileFormats::getErrorText(err);
+            results.push_back(save);
+            continue;
+        }
+
+        save.bytes = data.size();
+        BenchCase load = save;
+        load.op = "open";
+
+        runCase(save, [&]()
+        {
+            QByteArray out;
+            return FmBankFormatFactory::SaveInstrumentData(out, ins, id, false) == FfmtErrCode::ERR_OK;
+        });
+        results.push_back(save);
+
+        FmBank::Instrument loaded;
+        InstFormats loadedFormat;
+        err = openInstrument(data, fileName, loaded, loadedFormat);
+        if(err == FfmtErrCode::ERR_OK)
+        {
+            runCase(load, [&]()
+            {
+                FmBank::Instrument i;
+                InstFormats lf;
+                return openInstrument(data, fileName, i, lf) == FfmtErrCode::ERR_OK;
+            });
+        }
+        else
+            load.error = FileFormats::getErrorText(err);
+        results.push_back(load);
+    }
+}
+
+/**
+ * @brief Feed synthetic songs into importers of music files
+ */
+static void benchSyntheticSongs(int scale, QVector<BenchCase> &results)
+{
+    const QVector<SongWrite> song = makeSyntheticSong(scale * 256);
+
+    struct Song
+    {
+        QString    fileName;
+        QByteArray data;
+    };
+    const Song songs[2] =
+    {
+        {"synthetic.imf", makeImf(song)},
+        {"synthetic.vgm", makeVgm(song)}
+    };
+
+    for(const Song &s : songs)
+    {
+        BenchCase c;
+        c.kind = "bank";
+        c.source = QString("synthetic-%1-notes").arg(scale * 256);
+        c.op = "import";
+        c.bytes = s.data.size();
+
+        FmBank bank;
+        BankFormats format;
+        FfmtErrCode err = openBank(s.data, s.fileName, bank, format);
+        c.formatId = int(format);
+        c.formatName = bankFormatName(format);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            c.formatName = s.fileName;
+            c.error = FileFormats::getErrorText(err);
+            results.push_back(c);
+            continue;
+        }
+
+        c.instruments = countInstruments(bank);
+        runCase(c, [&]()
+        {
+            FmBank b;
+            BankFormats f;
+            return openBank(s.data, s.fileName, b, f) == FfmtErrCode::ERR_OK;
+        });
+        results.push_back(c);
+    }
+}
+
+static QStringList collectFiles(const QStringList &inputs)
+{
+    QStringList files;
+    for(const QString &in : inputs)
+    {
+        if(QFileInfo(in).isDir())
+        {
+            QStringList found;
+            QDirIterator it(in, QDir::Files, QDirIterator::Subdirectories);
+            while(it.hasNext())
+                found.push_back(it.next());
+            found.sort();
+            files.append(found);
+        }
+        else
+            files.push_back(in);
+    }
+    return files;
+}
+
+static QJsonObject caseToJson(const BenchCase &c)
+{
+    QJsonObject o;
+    o["kind"] = c.kind;
+    o["format_id"] = c.formatId;
+    o["format"] = c.formatName;
+    o["source"] = c.source;
+    o["op"] = c.op;
+    o["bytes"] = double(c.bytes);
+    o["instruments"] = c.instruments;
+    o["iterations"] = c.iterations;
+    o["best_seconds"] = c.bestSeconds;
+    o["mb_per_sec"] = c.mbPerSec;
+    o["instruments_per_sec"] = c.instrumentsPerSec;
+    if(!c.error.isEmpty())
+        o["error"] = c.error;
+    return o;
+}
+
+/**
+ * @brief Registered formats which have got no successful case
+ */
+static QJsonArray uncoveredFormats(const QVector<BenchCase> &results)
+{
+    QJsonArray out;
+    for(const FmBankFormatBase *f : FmBankFormatFactory::allBankFormats())
+    {
+        bool covered = false;
+        for(const BenchCase &c : results)
+        {
+            if(c.kind == "bank" && c.formatId == int(f->formatId()) && c.error.isEmpty())
+            {
+                covered = true;
+                break;
+            }
+        }
+        if(!covered)
+            out.append(f->formatName());
+    }
+    return out;
+}
+
+static void printCase(const BenchCase &c)
+{
+    const QString source = QFileInfo(c.source).fileName();
+    if(!c.error.isEmpty())
+    {
+        printf("%-6s %-36s %-40s %s\n", qPrintable(c.op), qPrintable(c.formatName.left(36)),
+               qPrintable(source.left(40)), qPrintable(c.error));
+    }
+    else
+    {
+        printf("%-6s %-36s %-40s %10.2f %14.0f %8d\n", qPrintable(c.op), qPrintable(c.formatName.left(36)),
+               qPrintable(source.left(40)), c.mbPerSec, c.instrumentsPerSec, c.iterations);
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QString reportPath;
+    QString baselinePath;
+    double tolerance = 10.0;
+    int scale = 16;
+    QStringList inputs;
+
+    QStringList args = app.arguments();
+    for(int i = 1; i < args.size(); i++)
+    {
+        if(args[i] == "-o" && i + 1 < args.size())
+            reportPath = args[++i];
+        else if(args[i] == "-b" && i + 1 < args.size())
+            baselinePath = args[++i];
+        else if(args[i] == "-t" && i + 1 < args.size())
+            tolerance = args[++i].toDouble();
+        else if(args[i] == "-s" && i + 1 < args.size())
+            s_minSeconds = qMax(0.01, args[++i].toDouble());
+        else if(args[i] == "-x" && i + 1 < args.size())
+            scale = qBound(1, args[++i].toInt(), 128);
+        else if(args[i] == "-h" || args[i] == "--help")
+        {
+            fprintf(stderr, "%s [-o report.json] [-b baseline.json] [-t tolerance%%]\n"
+                            "    [-s seconds] [-x scale] [file|directory]...\n", argv[0]);
+            return 1;
+        }
+        else
+            inputs.push_back(args[i]);
+    }
+
+    FmBankFormatFactory::registerAllFormats();
+
+    QVector<BenchCase> results;
+
+    printf("%-6s %-36s %-40s %10s %14s %8s\n", "op", "format", "source", "MB/s", "instruments/s", "runs");
+    for(const QString &path : collectFiles(inputs))
+    {
+        int first = results.size();
+        if(!benchSampleFile(path, results))
+            continue;
+        for(int i = first; i < results.size(); i++)
+            printCase(results[i]);
+    }
+
+    FmBank synth;
+    makeSyntheticBank(synth, scale);
+
+    int first = results.size();
+    benchSyntheticBanks(synth, results);
+    benchSyntheticInstruments(results);
+    benchSyntheticSongs(scale, results);
+    for(int i = first; i < results.size(); i++)
+        printCase(results[i]);
+
+    QJsonArray jsonResults;
+    for(const BenchCase &c : results)
+        jsonResults.append(caseToJson(c));
+
+    QJsonObject report;
+    report["host"] = benchHostInfo();
+    report["scale"] = scale;
+    report["min_seconds"] = s_minSeconds;
+    report["results"] = jsonResults;
+    report["uncovered_formats"] = uncoveredFormats(results);
+
+    if(!reportPath.isEmpty())
+    {
+        QFile out(reportPath);
+        if(!out.open(QIODevice::WriteOnly))
+        {
+            fprintf(stderr, "Can't write the report %s\n", qPrintable(reportPath));
+            return 1;
+        }
+        out.write(QJsonDocument(report).toJson());
+    }
+
+    if(!baselinePath.isEmpty())
+    {
+        QFile in(baselinePath);
+        if(!in.open(QIODevice::ReadOnly))
+        {
+            fprintf(stderr, "Can't read the baseline %s\n", qPrintable(baselinePath));
+            return 1;
+        }
+        QJsonObject baseline = QJsonDocument::fromJson(in.readAll()).object();
+        QVector<BenchThroughput> throughput;
+        for(const BenchCase &c : results)
+        {
+            if(!c.error.isEmpty())
+                continue;
+            BenchThroughput t;
+            t.label = QString("%1 %2 %3").arg(c.op, -6).arg(c.formatName.left(36), -36)
+                                         .arg(QFileInfo(c.source).fileName().left(40), -40);
+            t.key["kind"] = c.kind;
+            t.key["format_id"] = c.formatId;
+            t.key["source"] = c.source;
+            t.key["op"] = c.op;
+            t.value = c.mbPerSec;
+            throughput.push_back(t);
+        }
+        int regressions = compareThroughputWithBaseline(QString("%1 %2 %3").arg("op", -6).arg("format", -36).arg("source", -40),
+                                                        throughput, baseline, "mb_per_sec", tolerance);
+        if(regressions > 0)
+        {
+            printf("\n%d regression(s) beyond %.1f%%\n", regressions, tolerance);
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Generates the sorted index of MIDI instrument names (src/ins_names_index.h)
+ * from the tables of ins_names_data.h, so names are found by a single binary
+ * search through all MIDI specifications without building anything at run time.
+ *
+ * Usage: ins_names_index [output.h]
+ *
+ * Run it after every change of ins_names_data.h, the "ins_names_index" build
+ * target does it in place.
+ */
+
+#include "ins_names.h"
+#include "ins_names_data.h"
+#include <map>
+#include <array>
+#include <cstdio>
+#include <cstdint>
+
+struct ProgramSet
+{
+    const char *name;
+    const MidiProgram *programs;
+    unsigned size;
+};
+
+#define PROGRAM_SET(x) { #x, x, sizeof(x) / sizeof(*x) }
+
+// The order is the priority of specifications, it must match ins_names.cpp
+static const ProgramSet s_sets[] =
+{
+    PROGRAM_SET(XgSet),
+    PROGRAM_SET(GsSet),
+    PROGRAM_SET(ScSet),
+    PROGRAM_SET(Gm2Set),
+    PROGRAM_SET(Gm1Set),
+};
+
+enum { SetsCount = sizeof(s_sets) / sizeof(*s_sets) };
+
+typedef std::array<int, SetsCount> Entry;
+
+static const char *s_header =
+"/*\n"
+" * OPL Bank Editor by Wohlstand, a free tool for music bank editing\n"
+" * Copyright (c) 2016-2023 Vitaly Novichkov <admin@wohlnet.ru>\n"
+" *\n"
+" * This program is free software: you can redistribute it and/or modify\n"
+" * it under the terms of the GNU General Public License as published by\n"
+" * the Free Software Foundation, either version 3 of the License, or\n"
+" * any later version.\n"
+" *\n"
+" * This program is distributed in the hope that it will be useful,\n"
+" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+" * GNU General Public License for more details.\n"
+" *\n"
+" * You should have received a copy of the GNU General Public License\n"
+" * along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+" */\n"
+"\n"
+"/* Generated by utils/ins_names_index from ins_names_data.h, do not edit */\n"
+"\n";
+
+int main(int argc, char *argv[])
+{
+    std::map<uint32_t, Entry> index;
+    Entry none;
+    none.fill(-1);
+
+    for(unsigned s = 0; s < SetsCount; ++s)
+    {
+        const ProgramSet &set = s_sets[s];
+        // Positions are stored as int16_t by MidiProgramIndex
+        if(set.size > unsigned(INT16_MAX) + 1)
+        {
+            std::fprintf(stderr, "%s has %u programs, the index can't refer more than %d\n",
+                         set.name, set.size, INT16_MAX + 1);
+            return 1;
+        }
+
+        for(unsigned i = 0; i < set.size; ++i)
+        {
+            const MidiProgram &p = set.programs[i];
+            MidiProgramId id(p.kind == 'P', p.bankMsb, p.bankLsb, p.program);
+
+            auto it = index.insert(std::make_pair(id.key(), none)).first;
+            it->second[s] = int(i); // the last duplicate wins
+
+            // pseudo-entry for bank (reserved = 1, program = 0), the first program wins
+            id.reserved = 1;
+            id.program = 0;
+            it = index.insert(std::make_pair(id.key(), none)).first;
+            if(it->second[s] < 0)
+                it->second[s] = int(i);
+        }
+    }
+
+    FILE *out = stdout;
+    if(argc > 1)
+    {
+        out = std::fopen(argv[1], "w");
+        if(!out)
+        {
+            std::fprintf(stderr, "Can't write %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    std::fputs(s_header, out);
+    std::fputs("static constexpr MidiProgramIndex g_midiProgramIndex[] =\n{\n", out);
+    for(const auto &e : index)
+    {
+        std::fprintf(out, "    {0x%06X, {", unsigned(e.first));
+        for(unsigned s = 0; s < SetsCount; ++s)
+            std::fprintf(out, s ? ", %5d" : "%5d", e.second[s]);
+        std::fputs("}},\n", out);
+    }
+    std::fputs("};\n", out);
+
+    if(out != stdout)
+        std::fclose(out);
+
+    std::fprintf(stderr, "%u programs and banks are indexed\n", unsigned(index.size()));
+    return 0;
+}
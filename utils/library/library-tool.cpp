@@ -0,0 +1,167 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Builds and queries the catalog of instruments of all banks in a directory.
+ *
+ * Usage: opl3-library update <directory> [-s store]
+ *        opl3-library search <directory> [-s store] [-n limit] [text]
+ *        opl3-library find <directory> [-s store] <instrument-file>
+ *
+ * The update parses only new and changed files. Search and find are working
+ * on the catalog only, without reading any bank. Results are printed as one
+ * JSON object per line.
+ */
+
+#include <FileFormats/ffmt_factory.h>
+#include <FileFormats/ffmt_library.h>
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <cstdio>
+
+static void printJson(const QJsonObject &obj)
+{
+    QByteArray line = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+    line.append('\n');
+    fwrite(line.constData(), 1, size_t(line.size()), stdout);
+}
+
+static void printInstrument(const FmBankLibrary &lib, int i)
+{
+    const FmBankLibrary::InstrumentRecord &r = lib.record(i);
+    QJsonObject o;
+    o["index"] = i;
+    o["file"] = QDir(lib.rootDir()).filePath(lib.filePath(int(r.file)));
+    o["name"] = lib.name(i);
+    o["percussion"] = lib.isDrum(i);
+    o["program"] = r.program;
+    o["bank_msb"] = r.bankMsb;
+    o["bank_lsb"] = r.bankLsb;
+    if(lib.isDrum(i))
+        o["key"] = r.percNoteNum;
+    o["four_op"] = (r.flags & FmBankPacked::FLAG_4OP) != 0;
+    o["pseudo_four_op"] = (r.flags & FmBankPacked::FLAG_PSEUDO4OP) != 0;
+    o["ms_sound_kon"] = r.msSoundKon;
+    o["ms_sound_koff"] = r.msSoundKoff;
+    o["hash"] = QString("%1").arg(r.hash, 8, 16, QChar('0'));
+    printJson(o);
+}
+
+static int usage(const char *self)
+{
+    fprintf(stderr, "%s update <directory> [-s store]\n"
+                    "%s search <directory> [-s store] [-n limit] [text]\n"
+                    "%s find <directory> [-s store] <instrument-file>\n", self, self, self);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QStringList args = app.arguments();
+    if(args.size() < 3)
+        return usage(argv[0]);
+
+    const QString command = args[1];
+    const QString dir = args[2];
+    QString storePath;
+    int limit = -1;
+    QStringList rest;
+
+    for(int i = 3; i < args.size(); i++)
+    {
+        if(args[i] == "-s" && i + 1 < args.size())
+            storePath = args[++i];
+        else if(args[i] == "-n" && i + 1 < args.size())
+            limit = args[++i].toInt();
+        else
+            rest.push_back(args[i]);
+    }
+
+    if(!QFileInfo(dir).isDir())
+    {
+        fprintf(stderr, "%s is not a directory\n", qPrintable(dir));
+        return 2;
+    }
+
+    FmBankFormatFactory::registerAllFormats();
+
+    FmBankLibrary lib;
+    bool hasStore = lib.open(dir, storePath);
+
+    if(command == "update")
+    {
+        QElapsedTimer timer;
+        timer.start();
+        FmBankLibrary::UpdateStats stats;
+        FfmtErrCode err = lib.update(&stats);
+
+        QJsonObject o;
+        o["store"] = lib.storePath();
+        o["files"] = stats.files;
+        o["unchanged"] = stats.unchanged;
+        o["same_content"] = stats.sameContent;
+        o["parsed"] = stats.parsed;
+        o["failed"] = stats.failed;
+        o["removed"] = stats.removed;
+        o["instruments"] = stats.instruments;
+        o["elapsed_ms"] = double(timer.elapsed());
+        if(err != FfmtErrCode::ERR_OK)
+            o["error"] = FileFormats::getErrorText(err);
+        printJson(o);
+        return (err == FfmtErrCode::ERR_OK) ? 0 : 1;
+    }
+
+    if(!hasStore)
+    {
+        fprintf(stderr, "No catalog of %s, run the update first\n", qPrintable(dir));
+        return 1;
+    }
+
+    if(command == "search")
+    {
+        QVector<int> found = lib.search(rest.join(' '), limit);
+        for(int i : found)
+            printInstrument(lib, i);
+        return 0;
+    }
+
+    if(command == "find" && rest.size() == 1)
+    {
+        FmBank::Instrument ins = FmBank::emptyInst();
+        bool isDrum = false;
+        FfmtErrCode err = FmBankFormatFactory::OpenInstrumentFile(rest[0], ins, nullptr, &isDrum, true);
+        if(err != FfmtErrCode::ERR_OK)
+        {
+            fprintf(stderr, "Can't open %s: %s\n", qPrintable(rest[0]), qPrintable(FileFormats::getErrorText(err)));
+            return 1;
+        }
+
+        QVector<int> found = lib.findSound(ins);
+        for(int i = 0; i < found.size() && (limit < 0 || i < limit); i++)
+            printInstrument(lib, found[i]);
+        return 0;
+    }
+
+    return usage(argv[0]);
+}
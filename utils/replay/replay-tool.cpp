@@ -0,0 +1,186 @@
+/*
+ * OPL Bank Editor by Wohlstand, a free tool for music bank editing
+ * Copyright (c) 2018-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Replays the register log recorded by the editor into chip emulators
+ * as fast as possible. Prints the speed of every emulator and the hash of
+ * its output, so the output of emulators can be compared bit by bit
+ * between their versions.
+ *
+ * Usage: opl3_replay [-c emulator] [-n repeats] [-o output.raw] <log.oplr|song.vgm|song.dro>
+ *
+ * The output file receives 16-bit stereo PCM of the first emulator.
+ */
+
+#include <opl/register_log.h>
+#include <opl/chips/opl_chip_base.h>
+#include <opl/chips/nuked_opl3.h>
+#include <opl/chips/nuked_opl3_v174.h>
+#include <opl/chips/dosbox_opl3.h>
+#include <opl/chips/opal_opl3.h>
+#include <opl/chips/java_opl3.h>
+#include <opl/chips/ymf262_lle.h>
+#ifdef ENABLE_YMFM_EMULATOR
+#include <opl/chips/ymfm_opl3.h>
+#endif
+#include <QCoreApplication>
+#include <QStringList>
+#include <QFile>
+#include <memory>
+#include <cstdio>
+
+static OPLChipBase *createChip(const QString &name)
+{
+    if(name == "nuked")
+        return new NukedOPL3;
+    if(name == "nuked174")
+        return new NukedOPL3v174;
+    if(name == "dosbox")
+        return new DosBoxOPL3;
+    if(name == "opal")
+        return new OpalOPL3;
+    if(name == "java")
+        return new JavaOPL3;
+    if(name == "lle")
+        return new Ymf262LLEOPL3;
+#ifdef ENABLE_YMFM_EMULATOR
+    if(name == "ymfm")
+        return new YmFmOPL3;
+#endif
+    return nullptr;
+}
+
+static const char *const s_chipNames[] =
+{
+    "nuked", "nuked174", "dosbox", "opal", "java",
+#ifdef ENABLE_YMFM_EMULATOR
+    "ymfm",
+#endif
+    "lle"
+};
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QStringList chips;
+    QString outputPath;
+    QString logPath;
+    int repeats = 1;
+
+    QStringList args = app.arguments();
+    for(int i = 1; i < args.size(); i++)
+    {
+        if(args[i] == "-c" && i + 1 < args.size())
+            chips.push_back(args[++i]);
+        else if(args[i] == "-n" && i + 1 < args.size())
+            repeats = qMax(1, args[++i].toInt());
+        else if(args[i] == "-o" && i + 1 < args.size())
+            outputPath = args[++i];
+        else
+            logPath = args[i];
+    }
+
+    if(logPath.isEmpty())
+    {
+        fprintf(stderr, "%s [-c emulator] [-n repeats] [-o output.raw] <log.oplr|song.vgm|song.dro>\n", argv[0]);
+        fprintf(stderr, "Emulators:");
+        for(const char *name : s_chipNames)
+            fprintf(stderr, " %s", name);
+        fprintf(stderr, "\n");
+        return 1;
+    }
+
+    OPLRegisterLog log;
+    if(!log.loadFile(logPath))
+    {
+        fprintf(stderr, "Can't load the register log %s\n", logPath.toLocal8Bit().constData());
+        return 1;
+    }
+
+    if(chips.isEmpty())
+    {
+        for(const char *name : s_chipNames)
+            chips.push_back(QString::fromLatin1(name));
+    }
+
+    QFile output;
+    if(!outputPath.isEmpty())
+    {
+        output.setFileName(outputPath);
+        if(!output.open(QIODevice::WriteOnly))
+        {
+            fprintf(stderr, "Can't open the output file %s\n", outputPath.toLocal8Bit().constData());
+            return 1;
+        }
+    }
+
+    const double duration = double(log.length()) / double(log.rate());
+    printf("%s: %d writes, %.2f s at %u Hz\n", logPath.toLocal8Bit().constData(),
+           log.events().size(), duration, log.rate());
+
+    for(const QString &name : chips)
+    {
+        std::unique_ptr<OPLChipBase> chip(createChip(name));
+        if(!chip)
+        {
+            fprintf(stderr, "Unknown emulator %s\n", name.toLocal8Bit().constData());
+            return 1;
+        }
+
+        double best = 0.0;
+        uint64_t hash = 0;
+
+        for(int r = 0; r < repeats; r++)
+        {
+            // FNV-1a of the output, the same log must always give the same hash
+            uint64_t h = 14695981039346656037ull;
+            bool save = (r == 0) && output.isOpen();
+            OPLRegisterLog::ReplayStats stats = log.replay(*chip, [&](const int32_t *frames, size_t nframes)
+            {
+                const uint8_t *bytes = reinterpret_cast<const uint8_t *>(frames);
+                for(size_t i = 0; i < nframes * 2 * sizeof(int32_t); i++)
+                    h = (h ^ bytes[i]) * 1099511628211ull;
+                if(save)
+                {
+                    for(size_t i = 0; i < nframes * 2; i++)
+                    {
+                        int32_t s = frames[i];
+                        int16_t s16 = int16_t((s > 32767) ? 32767 : ((s < -32768) ? -32768 : s));
+                        output.write(reinterpret_cast<const char *>(&s16), sizeof(s16));
+                    }
+                }
+            });
+
+            if(r == 0 || stats.seconds < best)
+                best = stats.seconds;
+            hash = h;
+        }
+
+        printf("%-10s %-32s %8.3f s %8.1fx realtime  hash %016llx\n",
+               name.toLocal8Bit().constData(), chip->emulatorName(),
+               best, (best > 0.0) ? (duration / best) : 0.0,
+               static_cast<unsigned long long>(hash));
+
+        // Only the first emulator is written
+        if(output.isOpen())
+            output.close();
+    }
+
+    return 0;
+}